@@ -0,0 +1,12 @@
+#include "benchmark_case.h"
+#include "benchmark_support.h"
+
+static ZrBenchInt zr_bench_case_ffi_call_overhead_run(int scale) {
+    return zr_bench_run_ffi_call_overhead(scale);
+}
+
+const ZrBenchCaseDescriptor zr_bench_case_descriptor_ffi_call_overhead = {
+        "ffi_call_overhead",
+        "BENCH_FFI_CALL_OVERHEAD_PASS",
+        zr_bench_case_ffi_call_overhead_run
+};
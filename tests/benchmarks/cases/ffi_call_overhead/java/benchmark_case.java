@@ -0,0 +1,10 @@
+final class FfiCallOverheadCase {
+    static final String NAME = "ffi_call_overhead";
+    static final String PASS_BANNER = "BENCH_FFI_CALL_OVERHEAD_PASS";
+
+    private FfiCallOverheadCase() {}
+
+    static long run(int scale) {
+        return BenchmarkSupport.ffiCallOverhead(scale);
+    }
+}
@@ -0,0 +1,12 @@
+#include "benchmark_case.h"
+#include "benchmark_support.h"
+
+static ZrBenchInt zr_bench_case_math_value_ops_run(int scale) {
+    return zr_bench_run_math_value_ops(scale);
+}
+
+const ZrBenchCaseDescriptor zr_bench_case_descriptor_math_value_ops = {
+        "math_value_ops",
+        "BENCH_MATH_VALUE_OPS_PASS",
+        zr_bench_case_math_value_ops_run
+};
@@ -0,0 +1,10 @@
+final class MathValueOpsCase {
+    static final String NAME = "math_value_ops";
+    static final String PASS_BANNER = "BENCH_MATH_VALUE_OPS_PASS";
+
+    private MathValueOpsCase() {}
+
+    static long run(int scale) {
+        return BenchmarkSupport.mathValueOps(scale);
+    }
+}
@@ -0,0 +1,12 @@
+#include "benchmark_case.h"
+#include "benchmark_support.h"
+
+static ZrBenchInt zr_bench_case_module_startup_run(int scale) {
+    return zr_bench_run_module_startup(scale);
+}
+
+const ZrBenchCaseDescriptor zr_bench_case_descriptor_module_startup = {
+        "module_startup",
+        "BENCH_MODULE_STARTUP_PASS",
+        zr_bench_case_module_startup_run
+};
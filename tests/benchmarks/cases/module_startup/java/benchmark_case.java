@@ -0,0 +1,10 @@
+final class ModuleStartupCase {
+    static final String NAME = "module_startup";
+    static final String PASS_BANNER = "BENCH_MODULE_STARTUP_PASS";
+
+    private ModuleStartupCase() {}
+
+    static long run(int scale) {
+        return BenchmarkSupport.moduleStartup(scale);
+    }
+}
@@ -0,0 +1,3 @@
+const { runMain } = require("../../../common/node/benchmark_runner");
+
+runMain("module_startup");
@@ -0,0 +1,12 @@
+#include "benchmark_case.h"
+#include "benchmark_support.h"
+
+static ZrBenchInt zr_bench_case_task_spawn_complete_run(int scale) {
+    return zr_bench_run_task_spawn_complete(scale);
+}
+
+const ZrBenchCaseDescriptor zr_bench_case_descriptor_task_spawn_complete = {
+        "task_spawn_complete",
+        "BENCH_TASK_SPAWN_COMPLETE_PASS",
+        zr_bench_case_task_spawn_complete_run
+};
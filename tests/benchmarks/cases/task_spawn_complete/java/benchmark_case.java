@@ -0,0 +1,10 @@
+final class TaskSpawnCompleteCase {
+    static final String NAME = "task_spawn_complete";
+    static final String PASS_BANNER = "BENCH_TASK_SPAWN_COMPLETE_PASS";
+
+    private TaskSpawnCompleteCase() {}
+
+    static long run(int scale) {
+        return BenchmarkSupport.taskSpawnComplete(scale);
+    }
+}
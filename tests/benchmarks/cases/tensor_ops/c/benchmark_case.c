@@ -0,0 +1,12 @@
+#include "benchmark_case.h"
+#include "benchmark_support.h"
+
+static ZrBenchInt zr_bench_case_tensor_ops_run(int scale) {
+    return zr_bench_run_tensor_ops(scale);
+}
+
+const ZrBenchCaseDescriptor zr_bench_case_descriptor_tensor_ops = {
+        "tensor_ops",
+        "BENCH_TENSOR_OPS_PASS",
+        zr_bench_case_tensor_ops_run
+};
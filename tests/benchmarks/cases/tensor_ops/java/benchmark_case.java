@@ -0,0 +1,10 @@
+final class TensorOpsCase {
+    static final String NAME = "tensor_ops";
+    static final String PASS_BANNER = "BENCH_TENSOR_OPS_PASS";
+
+    private TensorOpsCase() {}
+
+    static long run(int scale) {
+        return BenchmarkSupport.tensorOps(scale);
+    }
+}
@@ -771,6 +771,149 @@ function gcFragmentStress(scale) {
     return (checksum + survivors.length * 17 + anchorCount * 19 + oldArchive.length * 23 + seed) % MOD;
 }
 
+function moduleStartupValue(unit, index, x) {
+    let acc = x * 31 + unit * 97 + index;
+    if (acc % 3 === 0) {
+        acc += 1;
+    }
+    return (acc * ((index % 13) + 17) + unit) % 1000003;
+}
+
+function moduleStartup(scale) {
+    const rounds = 8 * scale;
+    const calledFunctions = [0, 48, 95];
+    let checksum = 0;
+
+    for (let round = 0; round < rounds; round += 1) {
+        for (let unit = 0; unit < 6; unit += 1) {
+            for (const index of calledFunctions) {
+                checksum = (checksum * 131 + moduleStartupValue(unit, index, round + 1)) % MOD;
+            }
+        }
+    }
+
+    return checksum;
+}
+
+function tensorOps(scale) {
+    const n = 16 * scale + 16;
+    const lhs = new Array(n * n);
+    const rhs = new Array(n * n);
+    const combined = new Array(n * n);
+    let total = 0;
+
+    for (let row = 0; row < n; row += 1) {
+        for (let col = 0; col < n; col += 1) {
+            lhs[row * n + col] = (row * 7 + col * 3) % 11;
+            rhs[row * n + col] = (row * 5 + col * 11) % 13;
+        }
+    }
+
+    for (let row = 0; row < n; row += 1) {
+        for (let col = 0; col < n; col += 1) {
+            let product = 0;
+            let crossed = 0;
+            for (let k = 0; k < n; k += 1) {
+                product += lhs[row * n + k] * rhs[k * n + col];
+                crossed += lhs[row * n + k] * rhs[col * n + k];
+            }
+            const value = (product + crossed + lhs[row * n + col]) * 2 - lhs[row * n + col];
+            combined[row * n + col] = value;
+            total += value;
+        }
+    }
+
+    let checksum = total % MOD;
+    for (let row = 0; row < n; row += 1) {
+        checksum = (checksum * 31 + combined[row * n + ((row * 3) % n)]) % MOD;
+    }
+
+    return checksum;
+}
+
+function ffiAddI32(lhs, rhs) {
+    return (lhs + rhs) | 0;
+}
+
+function ffiFillBytes(buffer, length, seed) {
+    for (let index = 0; index < length; index += 1) {
+        buffer[index] = (seed + index) & 0xff;
+    }
+    return length;
+}
+
+function ffiCallOverhead(scale) {
+    const n = 4000 * scale;
+    const buffer = new Uint8Array(64);
+    let checksum = 0;
+
+    for (let i = 0; i < n; i += 1) {
+        checksum = ffiAddI32(checksum, i % 97) % 1000003;
+    }
+    for (let i = 0; i < n; i += 1) {
+        checksum = (checksum * 7 + ffiAddI32(i % 89, i % 13)) % 1000003;
+    }
+    for (let i = 0; i < Math.floor(n / 8); i += 1) {
+        checksum = (checksum + ffiFillBytes(buffer, buffer.length, i % 251)) % 1000003;
+    }
+
+    return (checksum * 31 + buffer[63]) % 1000003;
+}
+
+function taskLeaf(seed) {
+    return (seed * 31 + 7) % 1000003;
+}
+
+function taskSpawnComplete(scale) {
+    let checksum = 0;
+
+    for (let group = 0; group < 500 * scale; group += 1) {
+        const base = group * 4;
+        const value =
+            (taskLeaf(base) + taskLeaf(base + 1) * 3 + taskLeaf(base + 2) * 5 + taskLeaf(base + 3) * 7) % 1000003;
+        checksum = (checksum * 7 + value) % 1000003;
+    }
+
+    return checksum;
+}
+
+function mat4Mul(lhs, rhs) {
+    const out = new Array(16);
+    for (let row = 0; row < 4; row += 1) {
+        for (let col = 0; col < 4; col += 1) {
+            let sum = 0;
+            for (let k = 0; k < 4; k += 1) {
+                sum += lhs[row * 4 + k] * rhs[k * 4 + col];
+            }
+            out[row * 4 + col] = sum;
+        }
+    }
+    return out;
+}
+
+function mathValueOps(scale) {
+    let checksum = 0;
+
+    for (let i = 0; i < 2000 * scale; i += 1) {
+        const moved = [1, 0, 0, i % 7, 0, 1, 0, i % 5, 0, 0, 1, i % 3, 0, 0, 0, 1];
+        const scaled = [(i % 4) + 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1];
+        const combined = mat4Mul(moved, scaled);
+        const input = [i % 11, i % 13, 1, 1];
+        const point = [0, 0, 0, 0];
+        for (let row = 0; row < 4; row += 1) {
+            for (let k = 0; k < 4; k += 1) {
+                point[row] += combined[row * 4 + k] * input[k];
+            }
+        }
+        const w = [(i % 3) + 1, 2, i % 5];
+        const dot = point[0] * w[0] + point[1] * w[1] + point[2] * w[2];
+        const crossZ = point[0] * w[1] - point[1] * w[0];
+        checksum = (checksum * 31 + dot + crossZ + 1000) % MOD;
+    }
+
+    return checksum;
+}
+
 const CASE_HANDLERS = {
     numeric_loops: ["BENCH_NUMERIC_LOOPS_PASS", numericLoops],
     dispatch_loops: ["BENCH_DISPATCH_LOOPS_PASS", dispatchLoops],
@@ -788,6 +931,11 @@ const CASE_HANDLERS = {
     mixed_service_loop: ["BENCH_MIXED_SERVICE_LOOP_PASS", mixedServiceLoop],
     gc_fragment_baseline: ["BENCH_GC_FRAGMENT_BASELINE_PASS", gcFragmentStress],
     gc_fragment_stress: ["BENCH_GC_FRAGMENT_STRESS_PASS", gcFragmentStress],
+    module_startup: ["BENCH_MODULE_STARTUP_PASS", moduleStartup],
+    tensor_ops: ["BENCH_TENSOR_OPS_PASS", tensorOps],
+    ffi_call_overhead: ["BENCH_FFI_CALL_OVERHEAD_PASS", ffiCallOverhead],
+    task_spawn_complete: ["BENCH_TASK_SPAWN_COMPLETE_PASS", taskSpawnComplete],
+    math_value_ops: ["BENCH_MATH_VALUE_OPS_PASS", mathValueOps],
 };
 
 function runMain(caseName) {
@@ -682,6 +682,118 @@ def gc_fragment_stress(scale: int) -> int:
     return (checksum + len(survivors) * 17 + anchor_count * 19 + len(old_archive) * 23 + seed) % MOD
 
 
+def module_startup_value(unit: int, index: int, x: int) -> int:
+    acc = x * 31 + unit * 97 + index
+    if acc % 3 == 0:
+        acc += 1
+    return (acc * (index % 13 + 17) + unit) % 1000003
+
+
+def module_startup(scale: int) -> int:
+    rounds = 8 * scale
+    checksum = 0
+
+    for round_index in range(rounds):
+        for unit in range(6):
+            for index in (0, 48, 95):
+                checksum = (checksum * 131 + module_startup_value(unit, index, round_index + 1)) % MOD
+
+    return checksum
+
+
+def tensor_ops(scale: int) -> int:
+    n = 16 * scale + 16
+    lhs = [[(row * 7 + col * 3) % 11 for col in range(n)] for row in range(n)]
+    rhs = [[(row * 5 + col * 11) % 13 for col in range(n)] for row in range(n)]
+    rhs_columns = [list(column) for column in zip(*rhs)]
+    combined = []
+    total = 0
+
+    for row in range(n):
+        lhs_row = lhs[row]
+        combined_row = []
+        for col in range(n):
+            product = sum(a * b for a, b in zip(lhs_row, rhs_columns[col]))
+            crossed = sum(a * b for a, b in zip(lhs_row, rhs[col]))
+            value = (product + crossed + lhs_row[col]) * 2 - lhs_row[col]
+            combined_row.append(value)
+            total += value
+        combined.append(combined_row)
+
+    checksum = total % MOD
+    for row in range(n):
+        checksum = (checksum * 31 + combined[row][(row * 3) % n]) % MOD
+
+    return checksum
+
+
+def _ffi_add_i32(lhs: int, rhs: int) -> int:
+    return lhs + rhs
+
+
+def _ffi_fill_bytes(buffer: bytearray, length: int, seed: int) -> int:
+    for index in range(length):
+        buffer[index] = (seed + index) & 0xFF
+    return length
+
+
+def ffi_call_overhead(scale: int) -> int:
+    n = 4000 * scale
+    buffer = bytearray(64)
+    checksum = 0
+
+    for i in range(n):
+        checksum = _ffi_add_i32(checksum, i % 97) % 1_000_003
+    for i in range(n):
+        checksum = (checksum * 7 + _ffi_add_i32(i % 89, i % 13)) % 1_000_003
+    for i in range(n // 8):
+        checksum = (checksum + _ffi_fill_bytes(buffer, len(buffer), i % 251)) % 1_000_003
+
+    return (checksum * 31 + buffer[63]) % 1_000_003
+
+
+def _task_leaf(seed: int) -> int:
+    return (seed * 31 + 7) % 1_000_003
+
+
+def task_spawn_complete(scale: int) -> int:
+    checksum = 0
+
+    for group in range(500 * scale):
+        base = group * 4
+        value = (
+            _task_leaf(base) + _task_leaf(base + 1) * 3 + _task_leaf(base + 2) * 5 + _task_leaf(base + 3) * 7
+        ) % 1_000_003
+        checksum = (checksum * 7 + value) % 1_000_003
+
+    return checksum
+
+
+def _mat4_mul(lhs: list, rhs: list) -> list:
+    return [
+        sum(lhs[row * 4 + k] * rhs[k * 4 + col] for k in range(4))
+        for row in range(4)
+        for col in range(4)
+    ]
+
+
+def math_value_ops(scale: int) -> int:
+    checksum = 0
+
+    for i in range(2000 * scale):
+        moved = [1, 0, 0, i % 7, 0, 1, 0, i % 5, 0, 0, 1, i % 3, 0, 0, 0, 1]
+        scaled = [i % 4 + 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1]
+        combined = _mat4_mul(moved, scaled)
+        vector = (i % 11, i % 13, 1, 1)
+        point = [sum(combined[row * 4 + k] * vector[k] for k in range(4)) for row in range(4)]
+        w = (i % 3 + 1, 2, i % 5)
+        dot = point[0] * w[0] + point[1] * w[1] + point[2] * w[2]
+        cross_z = point[0] * w[1] - point[1] * w[0]
+        checksum = (checksum * 31 + dot + cross_z + 1000) % MOD
+
+    return checksum
+
+
 CASE_HANDLERS = {
     "numeric_loops": ("BENCH_NUMERIC_LOOPS_PASS", numeric_loops),
     "dispatch_loops": ("BENCH_DISPATCH_LOOPS_PASS", dispatch_loops),
@@ -699,6 +811,11 @@ CASE_HANDLERS = {
     "mixed_service_loop": ("BENCH_MIXED_SERVICE_LOOP_PASS", mixed_service_loop),
     "gc_fragment_baseline": ("BENCH_GC_FRAGMENT_BASELINE_PASS", gc_fragment_stress),
     "gc_fragment_stress": ("BENCH_GC_FRAGMENT_STRESS_PASS", gc_fragment_stress),
+    "module_startup": ("BENCH_MODULE_STARTUP_PASS", module_startup),
+    "tensor_ops": ("BENCH_TENSOR_OPS_PASS", tensor_ops),
+    "ffi_call_overhead": ("BENCH_FFI_CALL_OVERHEAD_PASS", ffi_call_overhead),
+    "task_spawn_complete": ("BENCH_TASK_SPAWN_COMPLETE_PASS", task_spawn_complete),
+    "math_value_ops": ("BENCH_MATH_VALUE_OPS_PASS", math_value_ops),
 }
 
 
@@ -108,6 +108,26 @@ public final class BenchmarkRunner {
                 passBanner = GcFragmentStressCase.PASS_BANNER;
                 checksum = GcFragmentStressCase.run(scale);
                 break;
+            case ModuleStartupCase.NAME:
+                passBanner = ModuleStartupCase.PASS_BANNER;
+                checksum = ModuleStartupCase.run(scale);
+                break;
+            case TensorOpsCase.NAME:
+                passBanner = TensorOpsCase.PASS_BANNER;
+                checksum = TensorOpsCase.run(scale);
+                break;
+            case FfiCallOverheadCase.NAME:
+                passBanner = FfiCallOverheadCase.PASS_BANNER;
+                checksum = FfiCallOverheadCase.run(scale);
+                break;
+            case TaskSpawnCompleteCase.NAME:
+                passBanner = TaskSpawnCompleteCase.PASS_BANNER;
+                checksum = TaskSpawnCompleteCase.run(scale);
+                break;
+            case MathValueOpsCase.NAME:
+                passBanner = MathValueOpsCase.PASS_BANNER;
+                checksum = MathValueOpsCase.run(scale);
+                break;
             default:
                 fail("unknown benchmark case: " + caseName);
                 return;
@@ -845,6 +845,148 @@ final class BenchmarkSupport {
         return gcFragmentStress(scale);
     }
 
+    static long moduleStartup(int scale) {
+        int[] calledFunctions = {0, 48, 95};
+        int rounds = 8 * scale;
+        long checksum = 0;
+
+        for (int round = 0; round < rounds; round++) {
+            for (int unit = 0; unit < 6; unit++) {
+                for (int index : calledFunctions) {
+                    checksum = modReduce(checksum * 131 + moduleStartupValue(unit, index, round + 1L));
+                }
+            }
+        }
+
+        return checksum;
+    }
+
+    private static long moduleStartupValue(int unit, int index, long x) {
+        long acc = x * 31 + unit * 97L + index;
+        if (acc % 3 == 0) {
+            acc += 1;
+        }
+        return (acc * (index % 13 + 17) + unit) % 1000003;
+    }
+
+    static long tensorOps(int scale) {
+        int n = 16 * scale + 16;
+        long[] lhs = new long[n * n];
+        long[] rhs = new long[n * n];
+        long[] combined = new long[n * n];
+        long total = 0;
+
+        for (int row = 0; row < n; row++) {
+            for (int col = 0; col < n; col++) {
+                lhs[row * n + col] = (row * 7 + col * 3) % 11;
+                rhs[row * n + col] = (row * 5 + col * 11) % 13;
+            }
+        }
+
+        for (int row = 0; row < n; row++) {
+            for (int col = 0; col < n; col++) {
+                long product = 0;
+                long crossed = 0;
+                for (int k = 0; k < n; k++) {
+                    product += lhs[row * n + k] * rhs[k * n + col];
+                    crossed += lhs[row * n + k] * rhs[col * n + k];
+                }
+                combined[row * n + col] = (product + crossed + lhs[row * n + col]) * 2 - lhs[row * n + col];
+                total += combined[row * n + col];
+            }
+        }
+
+        long checksum = modReduce(total);
+        for (int row = 0; row < n; row++) {
+            checksum = modReduce(checksum * 31 + combined[row * n + (row * 3) % n]);
+        }
+
+        return checksum;
+    }
+
+    private static int ffiAddI32(int lhs, int rhs) {
+        return lhs + rhs;
+    }
+
+    private static int ffiFillBytes(byte[] buffer, int length, int seed) {
+        for (int index = 0; index < length; index++) {
+            buffer[index] = (byte) (seed + index);
+        }
+        return length;
+    }
+
+    static long ffiCallOverhead(int scale) {
+        int n = 4000 * scale;
+        byte[] buffer = new byte[64];
+        long checksum = 0;
+
+        for (int i = 0; i < n; i++) {
+            checksum = ffiAddI32((int) checksum, i % 97) % 1000003;
+        }
+        for (int i = 0; i < n; i++) {
+            checksum = (checksum * 7 + ffiAddI32(i % 89, i % 13)) % 1000003;
+        }
+        for (int i = 0; i < n / 8; i++) {
+            checksum = (checksum + ffiFillBytes(buffer, buffer.length, i % 251)) % 1000003;
+        }
+
+        return (checksum * 31 + (buffer[63] & 0xFF)) % 1000003;
+    }
+
+    private static long taskLeaf(long seed) {
+        return (seed * 31 + 7) % 1000003;
+    }
+
+    static long taskSpawnComplete(int scale) {
+        long checksum = 0;
+
+        for (int group = 0; group < 500 * scale; group++) {
+            long base = group * 4L;
+            long value = (taskLeaf(base) + taskLeaf(base + 1) * 3 + taskLeaf(base + 2) * 5 + taskLeaf(base + 3) * 7)
+                    % 1000003;
+            checksum = (checksum * 7 + value) % 1000003;
+        }
+
+        return checksum;
+    }
+
+    private static double[] mat4Mul(double[] lhs, double[] rhs) {
+        double[] out = new double[16];
+        for (int row = 0; row < 4; row++) {
+            for (int col = 0; col < 4; col++) {
+                double sum = 0.0;
+                for (int k = 0; k < 4; k++) {
+                    sum += lhs[row * 4 + k] * rhs[k * 4 + col];
+                }
+                out[row * 4 + col] = sum;
+            }
+        }
+        return out;
+    }
+
+    static long mathValueOps(int scale) {
+        long checksum = 0;
+
+        for (int i = 0; i < 2000 * scale; i++) {
+            double[] moved = {1, 0, 0, i % 7, 0, 1, 0, i % 5, 0, 0, 1, i % 3, 0, 0, 0, 1};
+            double[] scaled = {i % 4 + 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1};
+            double[] combined = mat4Mul(moved, scaled);
+            double[] input = {i % 11, i % 13, 1, 1};
+            double[] point = new double[4];
+            for (int row = 0; row < 4; row++) {
+                for (int k = 0; k < 4; k++) {
+                    point[row] += combined[row * 4 + k] * input[k];
+                }
+            }
+            double[] w = {i % 3 + 1, 2, i % 5};
+            double dot = point[0] * w[0] + point[1] * w[1] + point[2] * w[2];
+            double crossZ = point[0] * w[1] - point[1] * w[0];
+            checksum = modReduce(checksum * 31 + (long) (dot + crossZ) + 1000);
+        }
+
+        return checksum;
+    }
+
     private static long routeService(Service service, long value, long ticket) {
         return service.handle(value, ticket);
     }
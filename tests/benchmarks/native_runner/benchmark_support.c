@@ -945,3 +945,189 @@ ZrBenchInt zr_bench_run_mixed_service_loop(int scale) {
     free(counters);
     return checksum;
 }
+
+static ZrBenchInt zr_bench_module_startup_value(int unit, int index, ZrBenchInt x) {
+    ZrBenchInt acc = x * 31 + unit * 97 + index;
+
+    if (acc % 3 == 0) {
+        acc += 1;
+    }
+    return (acc * (index % 13 + 17) + unit) % 1000003;
+}
+
+ZrBenchInt zr_bench_run_module_startup(int scale) {
+    static const int calledFunctions[] = {0, 48, 95};
+    const int rounds = 8 * scale;
+    ZrBenchInt checksum = 0;
+    int round;
+    int unit;
+    int slot;
+
+    for (round = 0; round < rounds; round++) {
+        for (unit = 0; unit < 6; unit++) {
+            for (slot = 0; slot < 3; slot++) {
+                checksum = zr_bench_mod(checksum * 131 +
+                                        zr_bench_module_startup_value(unit, calledFunctions[slot], round + 1));
+            }
+        }
+    }
+
+    return checksum;
+}
+
+ZrBenchInt zr_bench_run_tensor_ops(int scale) {
+    const int n = 16 * scale + 16;
+    ZrBenchInt *lhs = (ZrBenchInt *)calloc((size_t)n * (size_t)n, sizeof(ZrBenchInt));
+    ZrBenchInt *rhs = (ZrBenchInt *)calloc((size_t)n * (size_t)n, sizeof(ZrBenchInt));
+    ZrBenchInt *combined = (ZrBenchInt *)calloc((size_t)n * (size_t)n, sizeof(ZrBenchInt));
+    ZrBenchInt checksum = 0;
+    ZrBenchInt total = 0;
+    int row;
+    int col;
+    int k;
+
+    if (lhs == NULL || rhs == NULL || combined == NULL) {
+        free(lhs);
+        free(rhs);
+        free(combined);
+        return -1;
+    }
+
+    for (row = 0; row < n; row++) {
+        for (col = 0; col < n; col++) {
+            lhs[row * n + col] = (row * 7 + col * 3) % 11;
+            rhs[row * n + col] = (row * 5 + col * 11) % 13;
+        }
+    }
+
+    for (row = 0; row < n; row++) {
+        for (col = 0; col < n; col++) {
+            ZrBenchInt product = 0;
+            ZrBenchInt crossed = 0;
+            for (k = 0; k < n; k++) {
+                product += lhs[row * n + k] * rhs[k * n + col];
+                crossed += lhs[row * n + k] * rhs[col * n + k];
+            }
+            combined[row * n + col] = (product + crossed + lhs[row * n + col]) * 2 - lhs[row * n + col];
+            total += combined[row * n + col];
+        }
+    }
+
+    checksum = zr_bench_mod(total);
+    for (row = 0; row < n; row++) {
+        checksum = zr_bench_mod(checksum * 31 + combined[row * n + (row * 3) % n]);
+    }
+
+    free(lhs);
+    free(rhs);
+    free(combined);
+    return checksum;
+}
+
+static int32_t zr_bench_ffi_add_i32(int32_t lhs, int32_t rhs) {
+    return lhs + rhs;
+}
+
+static int32_t zr_bench_ffi_fill_bytes(uint8_t *buffer, size_t length, uint8_t seed) {
+    size_t index;
+
+    for (index = 0; index < length; index++) {
+        buffer[index] = (uint8_t)(seed + (uint8_t)index);
+    }
+
+    return (int32_t)length;
+}
+
+ZrBenchInt zr_bench_run_ffi_call_overhead(int scale) {
+    // call through pointers so the native row pays a real call like the ffi fixture does
+    int32_t (*volatile addI32)(int32_t, int32_t) = zr_bench_ffi_add_i32;
+    int32_t (*volatile fillBytes)(uint8_t *, size_t, uint8_t) = zr_bench_ffi_fill_bytes;
+    const int n = 4000 * scale;
+    uint8_t buffer[64];
+    ZrBenchInt checksum = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        checksum = addI32((int32_t)checksum, i % 97) % 1000003;
+    }
+    for (i = 0; i < n; i++) {
+        checksum = (checksum * 7 + addI32(i % 89, i % 13)) % 1000003;
+    }
+    for (i = 0; i < n / 8; i++) {
+        checksum = (checksum + fillBytes(buffer, sizeof(buffer), (uint8_t)(i % 251))) % 1000003;
+    }
+
+    return (checksum * 31 + buffer[63]) % 1000003;
+}
+
+static ZrBenchInt zr_bench_task_leaf(ZrBenchInt seed) {
+    return (seed * 31 + 7) % 1000003;
+}
+
+ZrBenchInt zr_bench_run_task_spawn_complete(int scale) {
+    const int groups = 500 * scale;
+    ZrBenchInt checksum = 0;
+    int group;
+
+    for (group = 0; group < groups; group++) {
+        ZrBenchInt base = (ZrBenchInt)group * 4;
+        ZrBenchInt value = (zr_bench_task_leaf(base) + zr_bench_task_leaf(base + 1) * 3 +
+                            zr_bench_task_leaf(base + 2) * 5 + zr_bench_task_leaf(base + 3) * 7) %
+                           1000003;
+        checksum = (checksum * 7 + value) % 1000003;
+    }
+
+    return checksum;
+}
+
+static void zr_bench_mat4_mul(const double *lhs, const double *rhs, double *out) {
+    int row;
+    int col;
+    int k;
+
+    for (row = 0; row < 4; row++) {
+        for (col = 0; col < 4; col++) {
+            double sum = 0.0;
+            for (k = 0; k < 4; k++) {
+                sum += lhs[row * 4 + k] * rhs[k * 4 + col];
+            }
+            out[row * 4 + col] = sum;
+        }
+    }
+}
+
+ZrBenchInt zr_bench_run_math_value_ops(int scale) {
+    const int n = 2000 * scale;
+    ZrBenchInt checksum = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        double moved[16] = {1.0, 0.0, 0.0, (double)(i % 7),
+                            0.0, 1.0, 0.0, (double)(i % 5),
+                            0.0, 0.0, 1.0, (double)(i % 3),
+                            0.0, 0.0, 0.0, 1.0};
+        double scaled[16] = {(double)(i % 4 + 1), 0.0, 0.0, 0.0,
+                             0.0, 2.0, 0.0, 0.0,
+                             0.0, 0.0, 3.0, 0.0,
+                             0.0, 0.0, 0.0, 1.0};
+        double combined[16];
+        double input[4] = {(double)(i % 11), (double)(i % 13), 1.0, 1.0};
+        double point[4];
+        double w[3] = {(double)(i % 3 + 1), 2.0, (double)(i % 5)};
+        double dot;
+        double crossZ;
+        int row;
+
+        zr_bench_mat4_mul(moved, scaled, combined);
+        for (row = 0; row < 4; row++) {
+            point[row] = combined[row * 4] * input[0] + combined[row * 4 + 1] * input[1] +
+                         combined[row * 4 + 2] * input[2] + combined[row * 4 + 3] * input[3];
+        }
+
+        dot = point[0] * w[0] + point[1] * w[1] + point[2] * w[2];
+        crossZ = point[0] * w[1] - point[1] * w[0];
+        checksum = zr_bench_mod(checksum * 31 + (ZrBenchInt)(dot + crossZ) + 1000);
+    }
+
+    return checksum;
+}
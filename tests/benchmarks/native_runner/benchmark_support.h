@@ -25,5 +25,10 @@ ZrBenchInt zr_bench_run_branch_jump_dense(int scale);
 ZrBenchInt zr_bench_run_mixed_service_loop(int scale);
 ZrBenchInt zr_bench_run_gc_fragment_baseline(int scale);
 ZrBenchInt zr_bench_run_gc_fragment_stress(int scale);
+ZrBenchInt zr_bench_run_module_startup(int scale);
+ZrBenchInt zr_bench_run_tensor_ops(int scale);
+ZrBenchInt zr_bench_run_ffi_call_overhead(int scale);
+ZrBenchInt zr_bench_run_task_spawn_complete(int scale);
+ZrBenchInt zr_bench_run_math_value_ops(int scale);
 
 #endif
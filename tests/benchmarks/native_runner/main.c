@@ -21,6 +21,11 @@ extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_branch_jump_dense;
 extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_mixed_service_loop;
 extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_gc_fragment_baseline;
 extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_gc_fragment_stress;
+extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_module_startup;
+extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_tensor_ops;
+extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_ffi_call_overhead;
+extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_task_spawn_complete;
+extern const ZrBenchCaseDescriptor zr_bench_case_descriptor_math_value_ops;
 
 static void zr_bench_print_usage(const char *executable) {
     fprintf(stderr,
@@ -46,7 +51,12 @@ static const ZrBenchCaseDescriptor *zr_bench_find_case(const char *caseName) {
             &zr_bench_case_descriptor_branch_jump_dense,
             &zr_bench_case_descriptor_mixed_service_loop,
             &zr_bench_case_descriptor_gc_fragment_baseline,
-            &zr_bench_case_descriptor_gc_fragment_stress
+            &zr_bench_case_descriptor_gc_fragment_stress,
+            &zr_bench_case_descriptor_module_startup,
+            &zr_bench_case_descriptor_tensor_ops,
+            &zr_bench_case_descriptor_ffi_call_overhead,
+            &zr_bench_case_descriptor_task_spawn_complete,
+            &zr_bench_case_descriptor_math_value_ops
     };
     int index;
 
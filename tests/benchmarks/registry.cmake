@@ -5,6 +5,12 @@ set(ZR_VM_BENCHMARK_IMPLEMENTATION_ORDER
         "c"
         "zr_interp"
         "zr_binary"
+        "zr_jit"
+        "zr_gc_w2"
+        "zr_gc_w4"
+        "zr_gc_w8"
+        "zr_gc_bgsweep"
+        "zr_gc_nursery"
         "python"
         "node"
         "qjs"
@@ -195,7 +201,7 @@ zr_vm_register_benchmark_case(
         WORKLOAD_TAG "call,recursion"
         PROFILE_SCALE 1
         TIERS "smoke;core;stress;profile"
-        IMPLEMENTATIONS "c" "zr_interp" "python" "node" "java"
+        IMPLEMENTATIONS "c" "zr_interp" "zr_jit" "python" "node" "java"
         CORE_IMPLEMENTATIONS "c" "zr_interp" "python"
         CHECKSUM_SMOKE "79101464"
         CHECKSUM_CORE "110316398"
@@ -279,7 +285,8 @@ zr_vm_register_benchmark_case(
         WORKLOAD_TAG "gc,string,container,baseline"
         PROFILE_SCALE 1
         TIERS "core;stress;profile"
-        IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
+        IMPLEMENTATIONS "c" "zr_interp" "zr_binary" "zr_gc_w2" "zr_gc_w4" "zr_gc_w8" "zr_gc_bgsweep"
+                        "zr_gc_nursery"
         CORE_IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
         CHECKSUM_SMOKE "829044624"
         CHECKSUM_CORE "857265678"
@@ -293,9 +300,82 @@ zr_vm_register_benchmark_case(
         WORKLOAD_TAG "gc,string,container"
         PROFILE_SCALE 1
         TIERS "core;stress;profile"
-        IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
+        IMPLEMENTATIONS "c" "zr_interp" "zr_binary" "zr_gc_w2" "zr_gc_w4" "zr_gc_w8" "zr_gc_bgsweep"
+                        "zr_gc_nursery"
         CORE_IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
         CHECKSUM_SMOKE "829044624"
         CHECKSUM_CORE "857265678"
         CHECKSUM_PROFILE "829044624"
         CHECKSUM_STRESS "47994849")
+
+zr_vm_register_benchmark_case(
+        module_startup
+        DESCRIPTION "Binary load of six wide modules whose exported functions are mostly never called."
+        PASS_BANNER "BENCH_MODULE_STARTUP_PASS"
+        WORKLOAD_TAG "startup,module,load"
+        PROFILE_SCALE 1
+        TIERS "core;stress;profile"
+        IMPLEMENTATIONS "c" "zr_interp" "zr_binary" "python" "node" "java"
+        CORE_IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
+        CHECKSUM_SMOKE "118684447"
+        CHECKSUM_CORE "89862997"
+        CHECKSUM_PROFILE "118684447"
+        CHECKSUM_STRESS "811327046")
+
+zr_vm_register_benchmark_case(
+        tensor_ops
+        DESCRIPTION "Dense zr.math Tensor matmul, transpose and elementwise ops over packed float64 storage."
+        PASS_BANNER "BENCH_TENSOR_OPS_PASS"
+        WORKLOAD_TAG "numeric,tensor,native"
+        PROFILE_SCALE 1
+        TIERS "core;stress;profile"
+        IMPLEMENTATIONS "c" "zr_interp" "zr_binary" "python" "node" "java"
+        CORE_IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
+        CHECKSUM_SMOKE "348171027"
+        CHECKSUM_CORE "934271767"
+        CHECKSUM_PROFILE "348171027"
+        CHECKSUM_STRESS "4259568")
+
+zr_vm_register_benchmark_case(
+        ffi_call_overhead
+        DESCRIPTION "Tight zr.ffi calls into the fixture library, one batched symbol call and Buffer pointer arguments."
+        PASS_BANNER "BENCH_FFI_CALL_OVERHEAD_PASS"
+        WORKLOAD_TAG "ffi,native,call"
+        PROFILE_SCALE 1
+        TIERS "core;stress;profile"
+        IMPLEMENTATIONS "c" "zr_interp" "zr_binary" "python" "node" "java"
+        CORE_IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
+        CHECKSUM_SMOKE "272120"
+        CHECKSUM_CORE "354745"
+        CHECKSUM_PROFILE "272120"
+        CHECKSUM_STRESS "445763")
+
+zr_vm_register_benchmark_case(
+        task_spawn_complete
+        DESCRIPTION "Spawn-and-await throughput of %async tasks on zr.task.defaultScheduler, including parked waiters."
+        PASS_BANNER "BENCH_TASK_SPAWN_COMPLETE_PASS"
+        WORKLOAD_TAG "task,scheduler,call"
+        PROFILE_SCALE 1
+        TIERS "core;stress;profile"
+        # The zr rows stay out until script-level %async compiles; zr_vm_task_spawn_complete_benchmark
+        # measures the scheduler through the C API meanwhile.
+        IMPLEMENTATIONS "c" "python" "node" "java"
+        CORE_IMPLEMENTATIONS "c"
+        CHECKSUM_SMOKE "349405"
+        CHECKSUM_CORE "907562"
+        CHECKSUM_PROFILE "349405"
+        CHECKSUM_STRESS "601916")
+
+zr_vm_register_benchmark_case(
+        math_value_ops
+        DESCRIPTION "Small zr.math Matrix4x4/Vector3/Vector4 values built and read through their fixed float64 layouts."
+        PASS_BANNER "BENCH_MATH_VALUE_OPS_PASS"
+        WORKLOAD_TAG "numeric,math,native"
+        PROFILE_SCALE 1
+        TIERS "core;stress;profile"
+        IMPLEMENTATIONS "c" "zr_interp" "zr_binary" "python" "node" "java"
+        CORE_IMPLEMENTATIONS "c" "zr_interp" "zr_binary"
+        CHECKSUM_SMOKE "55093880"
+        CHECKSUM_CORE "128030658"
+        CHECKSUM_PROFILE "55093880"
+        CHECKSUM_STRESS "4806239")
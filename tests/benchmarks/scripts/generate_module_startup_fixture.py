@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Generate the wide unit_<n>.zr modules imported by the module_startup benchmark case.
+
+Runs at test build time (see tests/CMakeLists.txt); the checked-in main.zr imports
+UNIT_COUNT units and calls the first, middle and last function of each, so keep
+the two in step.
+"""
+
+from __future__ import annotations
+
+import argparse
+from pathlib import Path
+
+
+UNIT_COUNT = 6
+FUNCTIONS_PER_UNIT = 96
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--out", type=Path, required=True)
+    return parser.parse_args()
+
+
+def unit_function(unit: int, index: int) -> str:
+    return (
+        f"pub func u{unit}_f{index}(x: int): int {{\n"
+        f"    var acc = x * 31 + {unit * 97 + index};\n"
+        f"    if (acc % 3 == 0) {{\n"
+        f"        acc = acc + 1;\n"
+        f"    }}\n"
+        f"    return (acc * {index % 13 + 17} + {unit}) % 1000003;\n"
+        f"}}\n"
+    )
+
+
+def unit_source(unit: int) -> str:
+    return "\n".join(unit_function(unit, index) for index in range(FUNCTIONS_PER_UNIT))
+
+
+def main() -> None:
+    args = parse_args()
+    args.out.mkdir(parents=True, exist_ok=True)
+    for unit in range(UNIT_COUNT):
+        (args.out / f"unit_{unit}.zr").write_text(unit_source(unit), encoding="utf-8", newline="\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -187,7 +187,12 @@ int main(void) {
             "branch_jump_dense",
             "mixed_service_loop",
             "gc_fragment_baseline",
-            "gc_fragment_stress"
+            "gc_fragment_stress",
+            "module_startup",
+            "tensor_ops",
+            "ffi_call_overhead",
+            "task_spawn_complete",
+            "math_value_ops"
     };
     char registryPath[ZR_TESTS_PATH_MAX];
     char readmePath[ZR_TESTS_PATH_MAX];
@@ -285,6 +290,26 @@ int main(void) {
             testsCmakePath,
             "tests/benchmarks/cases/gc_fragment_baseline/c/benchmark_case.c",
             "gc_fragment_baseline native runner CMake registration");
+    failures += benchmark_registry_expect_file_contains(
+            testsCmakePath,
+            "tests/benchmarks/cases/module_startup/c/benchmark_case.c",
+            "module_startup native runner CMake registration");
+    failures += benchmark_registry_expect_file_contains(
+            testsCmakePath,
+            "tests/benchmarks/cases/tensor_ops/c/benchmark_case.c",
+            "tensor_ops native runner CMake registration");
+    failures += benchmark_registry_expect_file_contains(
+            testsCmakePath,
+            "tests/benchmarks/cases/ffi_call_overhead/c/benchmark_case.c",
+            "ffi_call_overhead native runner CMake registration");
+    failures += benchmark_registry_expect_file_contains(
+            testsCmakePath,
+            "tests/benchmarks/cases/task_spawn_complete/c/benchmark_case.c",
+            "task_spawn_complete native runner CMake registration");
+    failures += benchmark_registry_expect_file_contains(
+            testsCmakePath,
+            "tests/benchmarks/cases/math_value_ops/c/benchmark_case.c",
+            "math_value_ops native runner CMake registration");
 
     for (index = 0; index < sizeof(benchmarkCases) / sizeof(benchmarkCases[0]); index++) {
         char casePath[ZR_TESTS_PATH_MAX];
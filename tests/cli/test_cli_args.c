@@ -622,6 +622,73 @@ static int test_heap_summary_run_flags_parse_and_require_run_path(void) {
     return 0;
 }
 
+static int test_jit_run_flag_parses_and_requires_run_path(void) {
+    char *argv1[] = {"zr_vm_cli", "demo.zrp", "--jit"};
+    char *argv2[] = {"zr_vm_cli", "--compile", "demo.zrp", "--jit"};
+    char error[256];
+    SZrCliCommand command;
+
+    CLI_ASSERT_TRUE(ZrCli_Command_Parse(3, argv1, &command, error, sizeof(error)), "parse run jit flag");
+    CLI_ASSERT_INT_EQ(ZR_CLI_MODE_RUN_PROJECT, command.mode, "mode should be run project");
+    CLI_ASSERT_TRUE(command.jitEnabled, "jit flag should be set");
+
+    CLI_ASSERT_TRUE(!ZrCli_Command_Parse(4, argv2, &command, error, sizeof(error)), "compile-only jit should fail");
+    CLI_ASSERT_TRUE(strstr(error, "--jit") != ZR_NULL, "compile-only jit error should mention jit");
+    return 0;
+}
+
+static int test_gc_workers_flag_parses_and_requires_run_path(void) {
+    char *argv1[] = {"zr_vm_cli", "demo.zrp", "--gc-workers", "4"};
+    char *argv2[] = {"zr_vm_cli", "--compile", "demo.zrp", "--gc-workers", "4"};
+    char *argv3[] = {"zr_vm_cli", "demo.zrp", "--gc-workers", "0"};
+    char *argv4[] = {"zr_vm_cli", "demo.zrp", "--gc-workers"};
+    char error[256];
+    SZrCliCommand command;
+
+    CLI_ASSERT_TRUE(ZrCli_Command_Parse(4, argv1, &command, error, sizeof(error)), "parse run gc workers flag");
+    CLI_ASSERT_INT_EQ(ZR_CLI_MODE_RUN_PROJECT, command.mode, "mode should be run project");
+    CLI_ASSERT_INT_EQ(4, (int)command.gcWorkerCount, "gc worker count should be 4");
+
+    CLI_ASSERT_TRUE(!ZrCli_Command_Parse(5, argv2, &command, error, sizeof(error)),
+                    "compile-only gc workers should fail");
+    CLI_ASSERT_TRUE(strstr(error, "--gc-workers") != ZR_NULL, "compile-only error should mention gc workers");
+    CLI_ASSERT_TRUE(!ZrCli_Command_Parse(4, argv3, &command, error, sizeof(error)), "zero gc workers should fail");
+    CLI_ASSERT_TRUE(!ZrCli_Command_Parse(3, argv4, &command, error, sizeof(error)), "missing gc workers should fail");
+    return 0;
+}
+
+static int test_gc_background_sweep_flag_parses_and_requires_run_path(void) {
+    char *argv1[] = {"zr_vm_cli", "demo.zrp", "--gc-background-sweep"};
+    char *argv2[] = {"zr_vm_cli", "--compile", "demo.zrp", "--gc-background-sweep"};
+    char error[256];
+    SZrCliCommand command;
+
+    CLI_ASSERT_TRUE(ZrCli_Command_Parse(3, argv1, &command, error, sizeof(error)), "parse run background sweep flag");
+    CLI_ASSERT_INT_EQ(ZR_CLI_MODE_RUN_PROJECT, command.mode, "mode should be run project");
+    CLI_ASSERT_TRUE(command.gcBackgroundSweep, "background sweep should be enabled");
+
+    CLI_ASSERT_TRUE(!ZrCli_Command_Parse(4, argv2, &command, error, sizeof(error)),
+                    "compile-only background sweep should fail");
+    CLI_ASSERT_TRUE(strstr(error, "--gc-background-sweep") != ZR_NULL,
+                    "compile-only error should mention background sweep");
+    return 0;
+}
+
+static int test_gc_nursery_flag_parses_and_requires_run_path(void) {
+    char *argv1[] = {"zr_vm_cli", "demo.zrp", "--gc-nursery"};
+    char *argv2[] = {"zr_vm_cli", "--compile", "demo.zrp", "--gc-nursery"};
+    char error[256];
+    SZrCliCommand command;
+
+    CLI_ASSERT_TRUE(ZrCli_Command_Parse(3, argv1, &command, error, sizeof(error)), "parse run nursery flag");
+    CLI_ASSERT_INT_EQ(ZR_CLI_MODE_RUN_PROJECT, command.mode, "mode should be run project");
+    CLI_ASSERT_TRUE(command.gcNursery, "nursery should be enabled");
+
+    CLI_ASSERT_TRUE(!ZrCli_Command_Parse(4, argv2, &command, error, sizeof(error)), "compile-only nursery should fail");
+    CLI_ASSERT_TRUE(strstr(error, "--gc-nursery") != ZR_NULL, "compile-only error should mention nursery");
+    return 0;
+}
+
 static int test_zrp_metadata_dump_mode_parse(void) {
     char *argv[] = {"zr_vm_cli", "--dump-zrp-metadata", "module.zrp"};
     char error[256];
@@ -795,6 +862,18 @@ int main(void) {
     if (test_heap_summary_run_flags_parse_and_require_run_path() != 0) {
         return 1;
     }
+    if (test_jit_run_flag_parses_and_requires_run_path() != 0) {
+        return 1;
+    }
+    if (test_gc_workers_flag_parses_and_requires_run_path() != 0) {
+        return 1;
+    }
+    if (test_gc_background_sweep_flag_parses_and_requires_run_path() != 0) {
+        return 1;
+    }
+    if (test_gc_nursery_flag_parses_and_requires_run_path() != 0) {
+        return 1;
+    }
     if (test_zrp_metadata_dump_mode_parse() != 0) {
         return 1;
     }
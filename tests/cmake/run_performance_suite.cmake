@@ -28,6 +28,11 @@ file(TO_CMAKE_PATH "${GENERATED_DIR}" GENERATED_DIR)
 if (DEFINED HOST_BINARY_DIR AND NOT HOST_BINARY_DIR STREQUAL "")
     file(TO_CMAKE_PATH "${HOST_BINARY_DIR}" HOST_BINARY_DIR)
 endif ()
+if (DEFINED FFI_FIXTURE_LIB AND NOT FFI_FIXTURE_LIB STREQUAL "")
+    file(TO_CMAKE_PATH "${FFI_FIXTURE_LIB}" FFI_FIXTURE_LIB)
+else ()
+    set(FFI_FIXTURE_LIB "")
+endif ()
 
 if (NOT EXISTS "${CLI_EXE}")
     message(FATAL_ERROR "CLI executable does not exist: ${CLI_EXE}. Build target zr_vm_cli_executable first.")
@@ -320,6 +325,10 @@ function(perf_prepare_zr_case case_name out_project_dir_var out_project_file_var
     file(REMOVE_RECURSE "${destination_dir}")
     file(MAKE_DIRECTORY "${destination_dir}")
     file(COPY "${source_dir}/src" DESTINATION "${destination_dir}")
+    # Build-time generated sources (tests/CMakeLists.txt) sit next to the checked-in ones.
+    if (EXISTS "${GENERATED_DIR}/benchmarks/cases/${case_name}/zr/src")
+        file(COPY "${GENERATED_DIR}/benchmarks/cases/${case_name}/zr/src" DESTINATION "${destination_dir}")
+    endif ()
     execute_process(
             COMMAND "${CMAKE_COMMAND}" -E copy_if_different "${source_dir}/benchmark_${case_name}.zrp" "${project_file}"
             RESULT_VARIABLE copy_result
@@ -333,6 +342,10 @@ function(perf_prepare_zr_case case_name out_project_dir_var out_project_file_var
             "${destination_dir}/src/bench_config.zr"
             "pub scale(): int {\n"
             "    return ${case_scale};\n"
+            "}\n"
+            "\n"
+            "pub ffiFixturePath(): string {\n"
+            "    return \"${FFI_FIXTURE_LIB}\";\n"
             "}\n")
 
     set(${out_project_dir_var} "${destination_dir}" PARENT_SCOPE)
@@ -644,6 +657,35 @@ foreach (case_name IN LISTS ZR_VM_BENCHMARK_CASE_NAMES)
             set(command_list "${CLI_EXE};${zr_project_file};--execution-mode;binary")
             set(working_directory "${zr_project_dir}")
             set(should_measure TRUE)
+        elseif (implementation_id STREQUAL "zr_jit")
+            set(implementation_name "ZR jit")
+            set(language "ZR")
+            set(mode "jit")
+            set(command_list "${CLI_EXE};${zr_project_file};--jit")
+            set(working_directory "${zr_project_dir}")
+            set(should_measure TRUE)
+        elseif (implementation_id MATCHES "^zr_gc_w([0-9]+)$")
+            set(gc_worker_count "${CMAKE_MATCH_1}")
+            set(implementation_name "ZR interp gc x${gc_worker_count}")
+            set(language "ZR")
+            set(mode "gc-w${gc_worker_count}")
+            set(command_list "${CLI_EXE};${zr_project_file};--gc-workers;${gc_worker_count}")
+            set(working_directory "${zr_project_dir}")
+            set(should_measure TRUE)
+        elseif (implementation_id STREQUAL "zr_gc_bgsweep")
+            set(implementation_name "ZR interp gc bg sweep")
+            set(language "ZR")
+            set(mode "gc-bgsweep")
+            set(command_list "${CLI_EXE};${zr_project_file};--gc-background-sweep")
+            set(working_directory "${zr_project_dir}")
+            set(should_measure TRUE)
+        elseif (implementation_id STREQUAL "zr_gc_nursery")
+            set(implementation_name "ZR interp gc nursery")
+            set(language "ZR")
+            set(mode "gc-nursery")
+            set(command_list "${CLI_EXE};${zr_project_file};--gc-nursery")
+            set(working_directory "${zr_project_dir}")
+            set(should_measure TRUE)
         elseif (implementation_id STREQUAL "python")
             set(implementation_name "Python")
             set(language "Python")
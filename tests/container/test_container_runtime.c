@@ -1686,9 +1686,179 @@ static void test_container_set_runtime_raw_int_contains_and_remove_use_current_s
     TEST_ASSERT_NOT_NULL(entriesObject);
     TEST_ASSERT_NOT_NULL(entriesObject->superArrayRawIntData);
     TEST_ASSERT_FALSE(entriesObject->superArrayRawIntDirty);
-    TEST_ASSERT_EQUAL_UINT64(2, (UNITY_UINT64)entriesObject->superArrayRawIntLength);
+    // the removed value stays in place as a tombstone until enough removals pile up to compact
+    TEST_ASSERT_EQUAL_UINT64(3, (UNITY_UINT64)entriesObject->superArrayRawIntLength);
+    TEST_ASSERT_EQUAL_UINT64(1, (UNITY_UINT64)entriesObject->hashIndexTombstoneCount);
+    TEST_ASSERT_NOT_NULL(entriesObject->hashIndexTombstones);
+    TEST_ASSERT_EQUAL_UINT64(2u, (UNITY_UINT64)entriesObject->hashIndexTombstones[0]);
     TEST_ASSERT_EQUAL_INT64(1, entriesObject->superArrayRawIntData[0]);
-    TEST_ASSERT_EQUAL_INT64(3, entriesObject->superArrayRawIntData[1]);
+    TEST_ASSERT_EQUAL_INT64(3, entriesObject->superArrayRawIntData[2]);
+
+    ZrCore_Function_Free(state, entryFunction);
+    ZrContainerTests_DestroyState(state);
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, summary);
+    TEST_DIVIDER();
+}
+
+static void test_container_map_runtime_large_key_set_uses_hash_index_and_keeps_insertion_order(void) {
+    SZrTestTimer timer = {0};
+    const char *summary = "Container Runtime - Map Large Key Set Uses Hash Index And Keeps Insertion Order";
+    SZrState *state;
+    SZrFunction *entryFunction;
+    SZrTypeValue resultValue;
+    SZrObject *mapObject;
+    SZrObject *entriesObject;
+    const char *source =
+            "var container = %import(\"zr.container\");\n"
+            "var map = new container.Map<string, int>();\n"
+            "for (var i = 0; i < 512; i = i + 1) {\n"
+            "    map[\"key_\" + i] = i;\n"
+            "}\n"
+            "for (var i = 0; i < 512; i = i + 2) {\n"
+            "    if (!map.remove(\"key_\" + i)) {\n"
+            "        return null;\n"
+            "    }\n"
+            "}\n"
+            "for (var i = 0; i < 512; i = i + 1) {\n"
+            "    if (map.containsKey(\"key_\" + i) != (i % 2 == 1)) {\n"
+            "        return null;\n"
+            "    }\n"
+            "}\n"
+            "map[\"key_511\"] = 1000;\n"
+            "var expected = 1;\n"
+            "for (var entry in map) {\n"
+            "    if (expected < 511 && entry.second != expected) {\n"
+            "        return null;\n"
+            "    }\n"
+            "    expected = expected + 2;\n"
+            "}\n"
+            "if (map.count != 256 || map[\"key_511\"] != 1000 || map[\"key_510\"] != null) {\n"
+            "    return null;\n"
+            "}\n"
+            "if (!map.remove(\"key_1\") || !map.remove(\"key_255\") || map.containsKey(\"key_1\") ||\n"
+            "    map[\"key_255\"] != null || map.count != 254) {\n"
+            "    return null;\n"
+            "}\n"
+            "map[\"key_1\"] = 2000;\n"
+            "expected = 3;\n"
+            "var visited = 0;\n"
+            "for (var entry in map) {\n"
+            "    if (expected == 255) {\n"
+            "        expected = 257;\n"
+            "    }\n"
+            "    if (expected < 511 && entry.second != expected) {\n"
+            "        return null;\n"
+            "    }\n"
+            "    if (expected == 511 && entry.second != 1000) {\n"
+            "        return null;\n"
+            "    }\n"
+            "    if (expected == 513 && (entry.first != \"key_1\" || entry.second != 2000)) {\n"
+            "        return null;\n"
+            "    }\n"
+            "    expected = expected + 2;\n"
+            "    visited = visited + 1;\n"
+            "}\n"
+            "if (visited != 255 || map.count != 255 || map[\"key_1\"] != 2000) {\n"
+            "    return null;\n"
+            "}\n"
+            "return map;\n";
+
+    TEST_START(summary);
+    timer.startTime = clock();
+
+    state = ZrContainerTests_CreateState();
+    TEST_ASSERT_NOT_NULL(state);
+
+    entryFunction = compile_test_script(state, "container_map_hash_index_runtime_test.zr", source);
+    TEST_ASSERT_NOT_NULL(entryFunction);
+    TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, entryFunction, &resultValue));
+    TEST_ASSERT_TRUE(resultValue.type == ZR_VALUE_TYPE_OBJECT || resultValue.type == ZR_VALUE_TYPE_ARRAY);
+    TEST_ASSERT_NOT_NULL(resultValue.value.object);
+
+    mapObject = ZR_CAST_OBJECT(state, resultValue.value.object);
+    TEST_ASSERT_NOT_NULL(mapObject);
+    entriesObject = mapObject->cachedHiddenItemsObject;
+    TEST_ASSERT_NOT_NULL(entriesObject);
+    TEST_ASSERT_NOT_NULL(entriesObject->hashIndexSlots);
+    TEST_ASSERT_EQUAL_UINT64(255, (UNITY_UINT64)entriesObject->hashIndexCount);
+    TEST_ASSERT_EQUAL_UINT64(0, (UNITY_UINT64)entriesObject->hashIndexTombstoneCount);
+    TEST_ASSERT_EQUAL_UINT64(255, (UNITY_UINT64)ZrContainerTests_GetArrayLength(entriesObject));
+    TEST_ASSERT_TRUE(entriesObject->hashIndexCapacity > entriesObject->hashIndexCount);
+
+    ZrCore_Function_Free(state, entryFunction);
+    ZrContainerTests_DestroyState(state);
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, summary);
+    TEST_DIVIDER();
+}
+
+static void test_container_set_runtime_raw_int_hash_index_tracks_add_remove_and_clear(void) {
+    SZrTestTimer timer = {0};
+    const char *summary = "Container Runtime - Set Raw Int Hash Index Tracks Add Remove And Clear";
+    SZrState *state;
+    SZrFunction *entryFunction;
+    SZrTypeValue resultValue;
+    SZrObject *setObject;
+    SZrObject *entriesObject;
+    const char *source =
+            "var container = %import(\"zr.container\");\n"
+            "var values = new container.Set<int>();\n"
+            "for (var i = 0; i < 300; i = i + 1) {\n"
+            "    values.add(i % 100);\n"
+            "}\n"
+            "if (values.count != 100 || !values.contains(99) || values.contains(100)) {\n"
+            "    return null;\n"
+            "}\n"
+            "values.remove(0);\n"
+            "values.remove(50);\n"
+            "if (values.contains(0) || values.contains(50) || !values.contains(51) || values.count != 98) {\n"
+            "    return null;\n"
+            "}\n"
+            "var expected = 1;\n"
+            "for (var item in values) {\n"
+            "    if (expected == 50) {\n"
+            "        expected = 51;\n"
+            "    }\n"
+            "    if (item != expected) {\n"
+            "        return null;\n"
+            "    }\n"
+            "    expected = expected + 1;\n"
+            "}\n"
+            "if (expected != 100) {\n"
+            "    return null;\n"
+            "}\n"
+            "values.clear();\n"
+            "for (var i = 0; i < 20; i = i + 1) {\n"
+            "    values.add(i * 7);\n"
+            "}\n"
+            "if (!values.contains(133) || values.contains(134)) {\n"
+            "    return null;\n"
+            "}\n"
+            "return values;\n";
+
+    TEST_START(summary);
+    timer.startTime = clock();
+
+    state = ZrContainerTests_CreateState();
+    TEST_ASSERT_NOT_NULL(state);
+
+    entryFunction = compile_test_script(state, "container_set_hash_index_runtime_test.zr", source);
+    TEST_ASSERT_NOT_NULL(entryFunction);
+    TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, entryFunction, &resultValue));
+    TEST_ASSERT_TRUE(resultValue.type == ZR_VALUE_TYPE_OBJECT || resultValue.type == ZR_VALUE_TYPE_ARRAY);
+    TEST_ASSERT_NOT_NULL(resultValue.value.object);
+
+    setObject = ZR_CAST_OBJECT(state, resultValue.value.object);
+    TEST_ASSERT_NOT_NULL(setObject);
+    entriesObject = setObject->cachedHiddenItemsObject;
+    TEST_ASSERT_NOT_NULL(entriesObject);
+    TEST_ASSERT_NOT_NULL(entriesObject->superArrayRawIntData);
+    TEST_ASSERT_NOT_NULL(entriesObject->hashIndexSlots);
+    TEST_ASSERT_EQUAL_UINT64(20, (UNITY_UINT64)entriesObject->hashIndexCount);
+    TEST_ASSERT_EQUAL_UINT64(20, (UNITY_UINT64)entriesObject->superArrayRawIntLength);
 
     ZrCore_Function_Free(state, entryFunction);
     ZrContainerTests_DestroyState(state);
@@ -2597,6 +2767,8 @@ int main(void) {
     RUN_TEST(test_container_set_runtime_enforces_pair_uniqueness);
     RUN_TEST(test_container_set_runtime_clear_reuses_entries_storage);
     RUN_TEST(test_container_set_runtime_raw_int_contains_and_remove_use_current_storage);
+    RUN_TEST(test_container_map_runtime_large_key_set_uses_hash_index_and_keeps_insertion_order);
+    RUN_TEST(test_container_set_runtime_raw_int_hash_index_tracks_add_remove_and_clear);
     RUN_TEST(test_container_pair_runtime_exposes_value_semantics);
     RUN_TEST(test_container_linked_list_runtime_detaches_removed_and_cleared_nodes);
     RUN_TEST(test_container_linked_list_runtime_empty_removals_return_null);
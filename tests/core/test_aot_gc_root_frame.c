@@ -2,6 +2,7 @@
 
 #include "tests/harness/runtime_support.h"
 #include "zr_vm_common/zr_aot_abi.h"
+#include "zr_vm_core/exception.h"
 #include "zr_vm_core/gc.h"
 #include "zr_vm_core/global.h"
 #include "zr_vm_core/object.h"
@@ -92,6 +93,7 @@ static void test_aot_root_frame_keeps_young_value_above_stack_top_live(void) {
         SZrRawObject *oldObject = ZR_CAST_RAW_OBJECT_AS_SUPER(object);
         SZrTypeValue *rootValue = &frameBase->value;
         SZrRawObject *newObject;
+        TZrBool wasNurseryResident = oldObject->garbageCollectMark.nurseryChunkId != 0u;
 
         TEST_ASSERT_NOT_NULL(object);
         TEST_ASSERT_TRUE(frameBase < state->stackTail.valuePointer);
@@ -107,7 +109,14 @@ static void test_aot_root_frame_keeps_young_value_above_stack_top_live(void) {
 
         TEST_ASSERT_TRUE(rootValue->isGarbageCollectable);
         newObject = rootValue->value.object;
-        TEST_ASSERT_TRUE(newObject == oldObject || oldObject->garbageCollectMark.forwardingAddress == newObject);
+        // an evacuated nursery resident leaves its from-space header behind; only the rewritten root may be read
+        if (wasNurseryResident) {
+            TEST_ASSERT_TRUE(newObject != oldObject);
+        } else {
+            TEST_ASSERT_TRUE(newObject == oldObject);
+        }
+        TEST_ASSERT_EQUAL_UINT32(ZR_RAW_OBJECT_TYPE_OBJECT, newObject->type);
+        TEST_ASSERT_EQUAL_UINT32(0u, newObject->garbageCollectMark.nurseryChunkId);
         TEST_ASSERT_EQUAL_UINT32(ZR_GARBAGE_COLLECT_REGION_KIND_SURVIVOR,
                                  newObject->garbageCollectMark.regionKind);
         TEST_ASSERT_EQUAL_UINT32(ZR_GARBAGE_COLLECT_STORAGE_KIND_YOUNG_MOVABLE,
@@ -247,6 +256,94 @@ static void test_gc_native_call_pin_value_marks_and_releases_temporary_pin(void)
     ZrTests_Runtime_State_Destroy(state);
 }
 
+static void test_gc_handle_scope_roots_object_in_place_and_clears_pin_on_close(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrGcHandleScope scope;
+
+    TEST_ASSERT_NOT_NULL(state);
+    TEST_ASSERT_NOT_NULL(state->global);
+    TEST_ASSERT_NOT_NULL(state->global->garbageCollector);
+    TEST_ASSERT_NULL(state->gcHandleScopeStack);
+
+    {
+        SZrGarbageCollector *collector = state->global->garbageCollector;
+        SZrObject *object = ZrCore_Object_New(state, ZR_NULL);
+        SZrRawObject *rawObject = ZR_CAST_RAW_OBJECT_AS_SUPER(object);
+        TZrSize ignoredBefore = collector->ignoredObjectCount;
+
+        TEST_ASSERT_NOT_NULL(object);
+        collector->gcMode = ZR_GARBAGE_COLLECT_MODE_GENERATIONAL;
+
+        // the object is referenced only from the scope: no stack slot, no ignore-registry entry
+        ZrCore_State_HandleScopeOpen(state, &scope);
+        TEST_ASSERT_EQUAL_PTR(&scope, state->gcHandleScopeStack);
+        TEST_ASSERT_TRUE(ZrCore_State_HandleScopePushObject(&scope, rawObject));
+        TEST_ASSERT_EQUAL_UINT64(ignoredBefore, collector->ignoredObjectCount);
+        TEST_ASSERT_TRUE((rawObject->garbageCollectMark.pinFlags & ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE) != 0u);
+
+        collector->gcDebtSize = 4096;
+        collector->gcLastStepWork = 0;
+        ZrCore_GarbageCollector_GcStep(state);
+
+        TEST_ASSERT_NULL(rawObject->garbageCollectMark.forwardingAddress);
+        TEST_ASSERT_EQUAL_PTR(rawObject, scope.objects[0]);
+        TEST_ASSERT_EQUAL_UINT32(ZR_GARBAGE_COLLECT_REGION_KIND_SURVIVOR, rawObject->garbageCollectMark.regionKind);
+
+        ZrCore_State_HandleScopeClose(state, &scope);
+        TEST_ASSERT_NULL(state->gcHandleScopeStack);
+        TEST_ASSERT_EQUAL_UINT32(0u, rawObject->garbageCollectMark.pinFlags);
+    }
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+typedef struct SZrHandleScopeThrowProbe {
+    SZrRawObject *sharedObject;
+    SZrRawObject *innerObject;
+} SZrHandleScopeThrowProbe;
+
+static void handle_scope_push_and_throw(SZrState *state, TZrPtr arguments) {
+    SZrHandleScopeThrowProbe *probe = (SZrHandleScopeThrowProbe *)arguments;
+    SZrGcHandleScope innerScope;
+
+    ZrCore_State_HandleScopeOpen(state, &innerScope);
+    ZrCore_State_HandleScopePushObject(&innerScope, probe->sharedObject);
+    ZrCore_State_HandleScopePushObject(&innerScope, probe->innerObject);
+    ZrCore_Exception_Throw(state, ZR_THREAD_STATUS_RUNTIME_ERROR);
+}
+
+static void test_gc_handle_scope_nested_scopes_unwind_on_throw(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrGcHandleScope outerScope;
+    SZrHandleScopeThrowProbe probe;
+    EZrThreadStatus status;
+
+    TEST_ASSERT_NOT_NULL(state);
+    probe.sharedObject = ZR_CAST_RAW_OBJECT_AS_SUPER(ZrCore_Object_New(state, ZR_NULL));
+    probe.innerObject = ZR_CAST_RAW_OBJECT_AS_SUPER(ZrCore_Object_New(state, ZR_NULL));
+    TEST_ASSERT_NOT_NULL(probe.sharedObject);
+    TEST_ASSERT_NOT_NULL(probe.innerObject);
+
+    ZrCore_State_HandleScopeOpen(state, &outerScope);
+    TEST_ASSERT_TRUE(ZrCore_State_HandleScopePushObject(&outerScope, probe.sharedObject));
+
+    status = ZrCore_Exception_TryRun(state, handle_scope_push_and_throw, &probe);
+
+    TEST_ASSERT_EQUAL_INT(ZR_THREAD_STATUS_RUNTIME_ERROR, status);
+    TEST_ASSERT_EQUAL_PTR(&outerScope, state->gcHandleScopeStack);
+    // the inner scope only released the pin it added; the outer scope still owns the shared one
+    TEST_ASSERT_EQUAL_UINT32(0u, probe.innerObject->garbageCollectMark.pinFlags);
+    TEST_ASSERT_TRUE((probe.sharedObject->garbageCollectMark.pinFlags & ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE) != 0u);
+
+    ZrCore_State_HandleScopeClose(state, &outerScope);
+    TEST_ASSERT_NULL(state->gcHandleScopeStack);
+    TEST_ASSERT_EQUAL_UINT32(0u, probe.sharedObject->garbageCollectMark.pinFlags);
+
+    state->threadStatus = ZR_THREAD_STATUS_FINE;
+    state->hasCurrentException = ZR_FALSE;
+    ZrTests_Runtime_State_Destroy(state);
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_aot_root_frame_push_pop_balances_state_stack);
@@ -254,5 +351,7 @@ int main(void) {
     RUN_TEST(test_gc_safepoint_advances_pending_collection_debt);
     RUN_TEST(test_gc_write_barrier_records_old_to_young_value);
     RUN_TEST(test_gc_native_call_pin_value_marks_and_releases_temporary_pin);
+    RUN_TEST(test_gc_handle_scope_roots_object_in_place_and_clears_pin_on_close);
+    RUN_TEST(test_gc_handle_scope_nested_scopes_unwind_on_throw);
     return UNITY_END();
 }
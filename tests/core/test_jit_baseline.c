@@ -0,0 +1,219 @@
+#include <string.h>
+
+#include "unity.h"
+
+#include "tests/harness/runtime_support.h"
+#include "zr_vm_common/zr_instruction_conf.h"
+#include "zr_vm_core/function.h"
+#include "zr_vm_core/global.h"
+#include "zr_vm_core/jit.h"
+#include "zr_vm_core/memory.h"
+
+#define ZR_JIT_TEST_LOOP_LIMIT 10000
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static TZrInstruction make_instruction_1(EZrInstructionCode opcode, TZrUInt16 operandExtra, TZrInt32 operand) {
+    TZrInstruction instruction = {0};
+    instruction.instruction.operationCode = (TZrUInt16)opcode;
+    instruction.instruction.operandExtra = operandExtra;
+    instruction.instruction.operand.operand2[0] = operand;
+    return instruction;
+}
+
+static TZrInstruction make_instruction_2(EZrInstructionCode opcode,
+                                         TZrUInt16 operandExtra,
+                                         TZrUInt16 operand1,
+                                         TZrUInt16 operand2) {
+    TZrInstruction instruction = {0};
+    instruction.instruction.operationCode = (TZrUInt16)opcode;
+    instruction.instruction.operandExtra = operandExtra;
+    instruction.instruction.operand.operand1[0] = operand1;
+    instruction.instruction.operand.operand1[1] = operand2;
+    return instruction;
+}
+
+static SZrFunction *create_test_function(SZrState *state,
+                                         const TZrInstruction *instructions,
+                                         TZrUInt32 instructionCount,
+                                         const SZrTypeValue *constants,
+                                         TZrUInt32 constantCount,
+                                         TZrUInt32 stackSize) {
+    SZrFunction *function = ZrCore_Function_New(state);
+    TZrSize instructionsSize = (TZrSize)instructionCount * sizeof(*instructions);
+    TZrSize constantsSize = (TZrSize)constantCount * sizeof(*constants);
+
+    if (function == ZR_NULL) {
+        return ZR_NULL;
+    }
+    function->instructionsList = (TZrInstruction *)ZrCore_Memory_RawMallocWithType(state->global,
+                                                                                   instructionsSize,
+                                                                                   ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+    function->constantValueList = (SZrTypeValue *)ZrCore_Memory_RawMallocWithType(state->global,
+                                                                                  constantsSize,
+                                                                                  ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+    if (function->instructionsList == ZR_NULL || function->constantValueList == ZR_NULL) {
+        ZrCore_Function_Free(state, function);
+        return ZR_NULL;
+    }
+    memcpy(function->instructionsList, instructions, instructionsSize);
+    memcpy(function->constantValueList, constants, constantsSize);
+    function->instructionsLength = instructionCount;
+    function->constantValueLength = constantCount;
+    function->stackSize = stackSize;
+    function->parameterCount = 0u;
+    function->hasVariableArguments = ZR_FALSE;
+    return function;
+}
+
+// sum = 0; i = 0; while (!(i > n)) { sum = sum + i; i = i + 1 } return sum
+// slot 0 = sum, 1 = i, 2 = n; bodyOpcode computes slot 0 from slots 0 and 1.
+static SZrFunction *create_sum_loop_function(SZrState *state, EZrInstructionCode bodyOpcode) {
+    SZrTypeValue constants[3];
+    TZrInstruction instructions[8];
+
+    ZrCore_Value_InitAsInt(state, &constants[0], 0);
+    ZrCore_Value_InitAsInt(state, &constants[1], ZR_JIT_TEST_LOOP_LIMIT);
+    ZrCore_Value_InitAsInt(state, &constants[2], 1);
+    instructions[0] = make_instruction_1(ZR_INSTRUCTION_ENUM(GET_CONSTANT), 0u, 0);
+    instructions[1] = make_instruction_1(ZR_INSTRUCTION_ENUM(GET_CONSTANT), 1u, 0);
+    instructions[2] = make_instruction_1(ZR_INSTRUCTION_ENUM(GET_CONSTANT), 2u, 1);
+    instructions[3] = make_instruction_2(ZR_INSTRUCTION_ENUM(JUMP_IF_GREATER_SIGNED), 1u, 2u, 3u);
+    instructions[4] = make_instruction_2(bodyOpcode, 0u, 0u, 1u);
+    instructions[5] = make_instruction_2(ZR_INSTRUCTION_ENUM(ADD_SIGNED_CONST), 1u, 1u, 2u);
+    instructions[6] = make_instruction_1(ZR_INSTRUCTION_ENUM(JUMP), 0u, -4);
+    instructions[7] = make_instruction_2(ZR_INSTRUCTION_ENUM(FUNCTION_RETURN), 1u, 0u, 0u);
+    return create_test_function(state, instructions, 8u, constants, 3u, 3u);
+}
+
+static TZrInt64 run_sum_loop(TZrBool jitEnabled, TZrBool *outCompiled) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrFunction *function;
+    TZrInt64 result = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    state->global->jitEnabled = jitEnabled;
+    function = create_sum_loop_function(state, ZR_INSTRUCTION_ENUM(ADD_SIGNED));
+    TEST_ASSERT_NOT_NULL(function);
+
+    TEST_ASSERT_TRUE(ZrTests_Runtime_Function_ExecuteExpectInt64(state, function, &result));
+    *outCompiled = function->jitCode != ZR_NULL;
+
+    ZrCore_Function_Free(state, function);
+    ZrTests_Runtime_State_Destroy(state);
+    return result;
+}
+
+static void test_hot_integer_loop_is_compiled_and_matches_the_interpreter(void) {
+    TZrBool compiled = ZR_FALSE;
+    TZrInt64 expected = (TZrInt64)ZR_JIT_TEST_LOOP_LIMIT * (ZR_JIT_TEST_LOOP_LIMIT + 1) / 2;
+
+    if (!ZrCore_Jit_IsSupported()) {
+        TEST_IGNORE_MESSAGE("baseline JIT is not built for this target");
+    }
+
+    TEST_ASSERT_EQUAL_INT64(expected, run_sum_loop(ZR_FALSE, &compiled));
+    TEST_ASSERT_FALSE(compiled);
+    TEST_ASSERT_EQUAL_INT64(expected, run_sum_loop(ZR_TRUE, &compiled));
+    TEST_ASSERT_TRUE(compiled);
+}
+
+static void test_type_guard_failure_resumes_the_interpreter_at_the_guarded_instruction(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrTypeValueOnStack frame[3];
+    SZrFunction *function;
+    TZrUInt32 resumeIndex = 0;
+    volatile TZrDebugSignal trap = ZR_DEBUG_SIGNAL_NONE;
+
+    if (!ZrCore_Jit_IsSupported()) {
+        ZrTests_Runtime_State_Destroy(state);
+        TEST_IGNORE_MESSAGE("baseline JIT is not built for this target");
+    }
+
+    TEST_ASSERT_NOT_NULL(state);
+    function = create_sum_loop_function(state, ZR_INSTRUCTION_ENUM(ADD_SIGNED));
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_TRUE(ZrCore_Jit_CompileFunction(state, function));
+
+    memset(frame, 0, sizeof(frame));
+    ZrCore_Value_InitAsInt(state, &frame[0].value, 0);
+    ZrCore_Value_InitAsFloat(state, &frame[1].value, 1.5);
+    ZrCore_Value_InitAsInt(state, &frame[2].value, 100);
+    TEST_ASSERT_TRUE(ZrCore_Jit_TryRunLoop(state, function, frame, &trap, 3u, &resumeIndex));
+    TEST_ASSERT_EQUAL_UINT32(3u, resumeIndex);
+    TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_DOUBLE, frame[1].value.type);
+
+    ZrCore_Value_InitAsInt(state, &frame[1].value, 0);
+    TEST_ASSERT_TRUE(ZrCore_Jit_TryRunLoop(state, function, frame, &trap, 3u, &resumeIndex));
+    TEST_ASSERT_EQUAL_UINT32(7u, resumeIndex);
+    TEST_ASSERT_EQUAL_INT64(5050, frame[0].value.value.nativeObject.nativeInt64);
+    TEST_ASSERT_EQUAL_INT64(101, frame[1].value.value.nativeObject.nativeInt64);
+
+    // only loop heads are entries; the interpreter keeps everything else.
+    TEST_ASSERT_FALSE(ZrCore_Jit_TryRunLoop(state, function, frame, &trap, 4u, &resumeIndex));
+
+    ZrCore_Function_Free(state, function);
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_freeing_a_function_releases_its_compiled_code(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrFunction *first;
+    SZrFunction *second;
+    SZrJitCode *secondCode;
+
+    if (!ZrCore_Jit_IsSupported()) {
+        ZrTests_Runtime_State_Destroy(state);
+        TEST_IGNORE_MESSAGE("baseline JIT is not built for this target");
+    }
+
+    TEST_ASSERT_NOT_NULL(state);
+    first = create_sum_loop_function(state, ZR_INSTRUCTION_ENUM(ADD_SIGNED));
+    second = create_sum_loop_function(state, ZR_INSTRUCTION_ENUM(ADD_SIGNED));
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_TRUE(ZrCore_Jit_CompileFunction(state, first));
+    TEST_ASSERT_TRUE(ZrCore_Jit_CompileFunction(state, second));
+    secondCode = second->jitCode;
+    TEST_ASSERT_EQUAL_PTR(secondCode, state->global->jitCodeAllocations);
+
+    // freeing the older function unlinks its code from the middle of the list and leaves the newer one alone
+    ZrCore_Function_Free(state, first);
+    TEST_ASSERT_NULL(first->jitCode);
+    TEST_ASSERT_EQUAL_PTR(secondCode, state->global->jitCodeAllocations);
+    TEST_ASSERT_NULL(secondCode->nextAllocated);
+
+    ZrCore_Function_Free(state, second);
+    TEST_ASSERT_NULL(state->global->jitCodeAllocations);
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_loop_with_unsupported_instruction_is_left_to_the_interpreter(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrFunction *function;
+
+    TEST_ASSERT_NOT_NULL(state);
+    function = create_sum_loop_function(state, ZR_INSTRUCTION_ENUM(BITWISE_AND));
+    TEST_ASSERT_NOT_NULL(function);
+
+    TEST_ASSERT_FALSE(ZrCore_Jit_CompileFunction(state, function));
+    TEST_ASSERT_NULL(function->jitCode);
+    TEST_ASSERT_EQUAL_UINT32(ZR_JIT_HOTNESS_DISABLED, function->jitHotness);
+
+    ZrCore_Function_Free(state, function);
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_hot_integer_loop_is_compiled_and_matches_the_interpreter);
+    RUN_TEST(test_type_guard_failure_resumes_the_interpreter_at_the_guarded_instruction);
+    RUN_TEST(test_freeing_a_function_releases_its_compiled_code);
+    RUN_TEST(test_loop_with_unsupported_instruction_is_left_to_the_interpreter);
+
+    return UNITY_END();
+}
@@ -0,0 +1,167 @@
+#include "unity.h"
+
+#include "tests/harness/runtime_support.h"
+#include "zr_vm_core/gc.h"
+#include "zr_vm_core/object.h"
+#include "zr_vm_core/object_shape.h"
+#include "zr_vm_core/string.h"
+#include "zr_vm_core/value.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static SZrObject *create_shape_test_object(SZrState *state) {
+    SZrObject *object = ZrCore_Object_New(state, ZR_NULL);
+
+    TEST_ASSERT_NOT_NULL(object);
+    ZrCore_Object_Init(state, object);
+    TEST_ASSERT_TRUE(ZrCore_GarbageCollector_IgnoreObject(state, ZR_CAST_RAW_OBJECT_AS_SUPER(object)));
+    return object;
+}
+
+static void set_string_field(SZrState *state, SZrObject *object, SZrString *name, TZrInt64 intValue) {
+    SZrTypeValue key;
+    SZrTypeValue value;
+
+    ZrCore_Value_InitAsRawObject(state, &key, ZR_CAST_RAW_OBJECT_AS_SUPER(name));
+    ZrCore_Value_InitAsInt(state, &value, intValue);
+    ZrCore_Object_SetValue(state, object, &key, &value);
+}
+
+static void test_objects_adding_fields_in_the_same_order_share_a_shape(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrString *xName;
+    SZrString *yName;
+    SZrObject *first;
+    SZrObject *second;
+    SZrObject *swapped;
+    SZrHashKeyValuePair *pair;
+
+    TEST_ASSERT_NOT_NULL(state);
+    xName = ZrCore_String_CreateFromNative(state, "x");
+    yName = ZrCore_String_CreateFromNative(state, "y");
+    first = create_shape_test_object(state);
+    second = create_shape_test_object(state);
+    swapped = create_shape_test_object(state);
+
+    set_string_field(state, first, xName, 1);
+    set_string_field(state, first, yName, 2);
+    set_string_field(state, second, xName, 3);
+    set_string_field(state, second, yName, 4);
+    set_string_field(state, swapped, yName, 5);
+    set_string_field(state, swapped, xName, 6);
+
+    TEST_ASSERT_NOT_NULL(first->shape);
+    TEST_ASSERT_EQUAL_PTR(first->shape, second->shape);
+    TEST_ASSERT_NOT_NULL(swapped->shape);
+    TEST_ASSERT_TRUE(first->shape != swapped->shape);
+    TEST_ASSERT_EQUAL_PTR(first->shape->root, swapped->shape->root);
+    TEST_ASSERT_EQUAL_UINT32(2u, first->shape->slotCount);
+
+    TEST_ASSERT_EQUAL_INT(0, ZrCore_ObjectShape_FindSlot(first->shape, xName));
+    TEST_ASSERT_EQUAL_INT(1, ZrCore_ObjectShape_FindSlot(first->shape, yName));
+    TEST_ASSERT_EQUAL_INT(1, ZrCore_ObjectShape_FindSlot(swapped->shape, xName));
+
+    pair = ZrCore_Object_GetShapeSlotPair(second, 1u);
+    TEST_ASSERT_NOT_NULL(pair);
+    TEST_ASSERT_EQUAL_PTR(yName, pair->key.value.object);
+    TEST_ASSERT_EQUAL_INT64(4, pair->value.value.nativeObject.nativeInt64);
+
+    // overwriting an existing field keeps the shape.
+    set_string_field(state, second, yName, 7);
+    TEST_ASSERT_EQUAL_PTR(first->shape, second->shape);
+    TEST_ASSERT_EQUAL_INT64(7, ZrCore_Object_GetShapeSlotPair(second, 1u)->value.value.nativeObject.nativeInt64);
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_non_string_keys_drop_the_object_to_dictionary_mode(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrString *xName;
+    SZrObject *object;
+    SZrTypeValue key;
+    SZrTypeValue value;
+    const SZrTypeValue *stored;
+
+    TEST_ASSERT_NOT_NULL(state);
+    xName = ZrCore_String_CreateFromNative(state, "x");
+    object = create_shape_test_object(state);
+
+    set_string_field(state, object, xName, 1);
+    TEST_ASSERT_NOT_NULL(object->shape);
+
+    ZrCore_Value_InitAsInt(state, &key, 42);
+    ZrCore_Value_InitAsInt(state, &value, 9);
+    ZrCore_Object_SetValue(state, object, &key, &value);
+    TEST_ASSERT_NULL(object->shape);
+    TEST_ASSERT_NULL(ZrCore_Object_GetShapeSlotPair(object, 0u));
+
+    // dictionary mode still finds every field through the nodeMap.
+    ZrCore_Value_InitAsRawObject(state, &key, ZR_CAST_RAW_OBJECT_AS_SUPER(xName));
+    stored = ZrCore_Object_GetValue(state, object, &key);
+    TEST_ASSERT_NOT_NULL(stored);
+    TEST_ASSERT_EQUAL_INT64(1, stored->value.nativeObject.nativeInt64);
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_full_collection_frees_unused_shapes_and_shrinks_the_slot_estimate(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrString *names[4];
+    SZrObject *kept;
+    SZrObject *temporary;
+    SZrObjectShape *keptShape;
+    SZrObject *regrown;
+
+    TEST_ASSERT_NOT_NULL(state);
+    names[0] = ZrCore_String_CreateFromNative(state, "shapeGcA");
+    names[1] = ZrCore_String_CreateFromNative(state, "shapeGcB");
+    names[2] = ZrCore_String_CreateFromNative(state, "shapeGcC");
+    names[3] = ZrCore_String_CreateFromNative(state, "shapeGcD");
+    kept = create_shape_test_object(state);
+    set_string_field(state, kept, names[0], 1);
+    set_string_field(state, kept, names[1], 2);
+
+    // nothing roots the wider object, so the next full collection leaves its two deeper shapes unused.
+    temporary = ZrCore_Object_New(state, ZR_NULL);
+    TEST_ASSERT_NOT_NULL(temporary);
+    ZrCore_Object_Init(state, temporary);
+    for (TZrUInt32 index = 0; index < 4u; index++) {
+        set_string_field(state, temporary, names[index], (TZrInt64)index);
+    }
+    keptShape = kept->shape;
+    TEST_ASSERT_NOT_NULL(keptShape);
+    TEST_ASSERT_NOT_NULL(keptShape->firstTransition);
+    TEST_ASSERT_TRUE(keptShape->root->expectedSlotCount >= 4u);
+    temporary = ZR_NULL;
+
+    ZrCore_GarbageCollector_GcFull(state, ZR_TRUE);
+
+    TEST_ASSERT_EQUAL_PTR(keptShape, kept->shape);
+    TEST_ASSERT_NULL(keptShape->firstTransition);
+    TEST_ASSERT_EQUAL_UINT32(0u, keptShape->transitionCount);
+    TEST_ASSERT_EQUAL_UINT32(2u, keptShape->root->expectedSlotCount);
+    TEST_ASSERT_EQUAL_INT(1, ZrCore_ObjectShape_FindSlot(kept->shape, names[1]));
+
+    // the freed branch is rebuilt on demand and the surviving prefix is shared again.
+    regrown = create_shape_test_object(state);
+    for (TZrUInt32 index = 0; index < 3u; index++) {
+        set_string_field(state, regrown, names[index], (TZrInt64)index);
+    }
+    TEST_ASSERT_NOT_NULL(regrown->shape);
+    TEST_ASSERT_EQUAL_PTR(keptShape, regrown->shape->parent);
+    TEST_ASSERT_EQUAL_UINT32(3u, regrown->shape->slotCount);
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_objects_adding_fields_in_the_same_order_share_a_shape);
+    RUN_TEST(test_non_string_keys_drop_the_object_to_dictionary_mode);
+    RUN_TEST(test_full_collection_frees_unused_shapes_and_shrinks_the_slot_estimate);
+
+    return UNITY_END();
+}
@@ -671,7 +671,7 @@ static void test_frame_gc_visitor_includes_value_layout_slots(void) {
     TEST_ASSERT_NOT_NULL(function);
     function->stackSize = 2;
     function->parameterCount = 0;
-    function->frameByteSize = (TZrUInt32)(sizeof(SZrTypeValueOnStack) * 4u);
+    function->frameByteSize = (TZrUInt32)(sizeof(SZrTypeValueOnStack) * 4u + ZR_ALIGN_SIZE);
     function->frameByteAlign = ZR_ALIGN_SIZE;
     function->frameSlotLayoutLength = 1u;
     layout = (SZrFunctionFrameSlotLayout *)ZrCore_Memory_RawMallocWithType(
@@ -681,7 +681,9 @@ static void test_frame_gc_visitor_includes_value_layout_slots(void) {
     TEST_ASSERT_NOT_NULL(layout);
     memset(layout, 0, sizeof(*layout));
     layout->stackSlot = 1u;
-    layout->byteOffset = (TZrUInt32)(sizeof(SZrTypeValueOnStack) * 3u);
+    // stack slots need not be a multiple of ZR_ALIGN_SIZE, so round the span the way the compiler does.
+    layout->byteOffset = (TZrUInt32)((sizeof(SZrTypeValueOnStack) * 3u + ZR_ALIGN_SIZE - 1u) / ZR_ALIGN_SIZE *
+                                     ZR_ALIGN_SIZE);
     layout->byteSize = (TZrUInt32)sizeof(SZrTypeValue);
     layout->byteAlign = ZR_ALIGN_SIZE;
     layout->slotKind = ZR_FUNCTION_FRAME_SLOT_KIND_VALUE;
@@ -0,0 +1,182 @@
+#include <string.h>
+
+#include "unity.h"
+
+#include "tests/harness/runtime_support.h"
+#include "zr_vm_core/string.h"
+#include "zr_vm_core/utf8.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// cycles through 1-, 2-, 3- and 4-byte sequences so breadcrumbs land inside every sequence width
+static TZrSize build_mixed_text(char *buffer, TZrSize codePointCount) {
+    static const char *const kPieces[] = {"a", "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "z"};
+    TZrSize length = 0;
+
+    for (TZrSize index = 0; index < codePointCount; index++) {
+        const char *piece = kPieces[index % (sizeof(kPieces) / sizeof(kPieces[0]))];
+        TZrSize pieceLength = strlen(piece);
+
+        memcpy(buffer + length, piece, pieceLength);
+        length += pieceLength;
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+static void assert_offsets_match_linear_walk(SZrState *state, SZrString *string, TZrSize codePointCount) {
+    const char *bytes = ZrCore_String_GetNativeString(string);
+    TZrSize byteLength = ZrCore_String_GetByteLength(string);
+
+    for (TZrSize count = 0; count <= codePointCount + 2; count++) {
+        TZrSize expected = 0;
+        TZrSize actual = 0;
+
+        TEST_ASSERT_TRUE(ZrCore_Utf8_CodePointCountToByteOffset((TZrNativeString)bytes, byteLength, count, &expected));
+        TEST_ASSERT_TRUE(ZrCore_String_CodePointCountToByteOffset(state, string, count, &actual));
+        TEST_ASSERT_EQUAL_UINT64((unsigned long long)expected, (unsigned long long)actual);
+    }
+}
+
+static void test_ascii_strings_are_flagged_and_index_by_byte(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    char longText[300];
+    SZrString *shortString;
+    SZrString *longString;
+    TZrSize length = 0;
+    TZrSize offset = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    memset(longText, 'q', sizeof(longText));
+    shortString = ZrCore_String_CreateFromNative(state, "plain ascii");
+    longString = ZrCore_String_Create(state, longText, sizeof(longText));
+
+    TEST_ASSERT_TRUE(ZrCore_String_IsAscii(shortString));
+    TEST_ASSERT_TRUE(ZrCore_String_IsAscii(longString));
+    TEST_ASSERT_TRUE(ZrCore_String_GetCodePointLength(state, longString, &length));
+    TEST_ASSERT_EQUAL_UINT64(300u, (unsigned long long)length);
+    TEST_ASSERT_TRUE(ZrCore_String_CodePointCountToByteOffset(state, longString, 123, &offset));
+    TEST_ASSERT_EQUAL_UINT64(123u, (unsigned long long)offset);
+    TEST_ASSERT_TRUE(ZrCore_String_CodePointCountToByteOffset(state, longString, 1000, &offset));
+    TEST_ASSERT_EQUAL_UINT64(300u, (unsigned long long)offset);
+    TEST_ASSERT_FALSE(ZrCore_String_IsAscii(ZrCore_String_CreateFromNative(state, "caf\xC3\xA9")));
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_long_non_ascii_string_offsets_follow_breadcrumbs(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    char text[1000 * 4 + 1];
+    TZrSize byteLength = build_mixed_text(text, 1000);
+    SZrString *string;
+    TZrSize length = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    string = ZrCore_String_Create(state, text, byteLength);
+    TEST_ASSERT_FALSE(ZrCore_String_IsAscii(string));
+    TEST_ASSERT_TRUE(ZrCore_String_GetCodePointLength(state, string, &length));
+    TEST_ASSERT_EQUAL_UINT64(1000u, (unsigned long long)length);
+    // the second query is served from the cached index
+    TEST_ASSERT_TRUE(ZrCore_String_GetCodePointLength(state, string, &length));
+    TEST_ASSERT_EQUAL_UINT64(1000u, (unsigned long long)length);
+    assert_offsets_match_linear_walk(state, string, 1000);
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_short_non_ascii_string_caches_code_point_length(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    char text[20 * 4 + 1];
+    TZrSize byteLength = build_mixed_text(text, 20);
+    SZrString *string;
+    TZrSize length = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    string = ZrCore_String_Create(state, text, byteLength);
+    TEST_ASSERT_TRUE(ZrCore_String_GetCodePointLength(state, string, &length));
+    TEST_ASSERT_EQUAL_UINT64(20u, (unsigned long long)length);
+    TEST_ASSERT_TRUE((string->stringFlags & ZR_VM_STRING_FLAG_CODE_POINTS_READY) != 0);
+    assert_offsets_match_linear_walk(state, string, 20);
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_invalid_utf8_is_rejected_and_remembered(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    char text[400];
+    SZrString *string;
+    TZrSize length = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    memset(text, 'v', sizeof(text));
+    text[333] = (char)0xC3;
+    string = ZrCore_String_Create(state, text, sizeof(text));
+
+    TEST_ASSERT_FALSE(ZrCore_String_IsValidUtf8(state, string));
+    TEST_ASSERT_TRUE((string->stringFlags & ZR_VM_STRING_FLAG_UTF8_INVALID) != 0);
+    TEST_ASSERT_FALSE(ZrCore_String_GetCodePointLength(state, string, &length));
+    TEST_ASSERT_FALSE(ZrCore_Utf8_IsValid(text, sizeof(text)));
+    TEST_ASSERT_TRUE(ZrCore_Utf8_IsValid(text, 333));
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_concat_nodes_carry_ascii_flag_and_index_without_flattening(void) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    char ascii[100];
+    char mixed[40 * 4 + 1];
+    TZrSize mixedLength = build_mixed_text(mixed, 40);
+    SZrString *asciiNode;
+    SZrString *mixedNode;
+    TZrSize length = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    memset(ascii, 'k', sizeof(ascii));
+    asciiNode = ZrCore_String_ConcatPair(state,
+                                         ZrCore_String_Create(state, ascii, sizeof(ascii)),
+                                         ZrCore_String_Create(state, ascii, sizeof(ascii)));
+    TEST_ASSERT_TRUE(ZrCore_String_IsConcatNode(asciiNode));
+    TEST_ASSERT_TRUE(ZrCore_String_IsAscii(asciiNode));
+
+    mixedNode = ZrCore_String_ConcatStringAndNative(state, asciiNode, mixed, mixedLength, ZR_TRUE);
+    TEST_ASSERT_TRUE(ZrCore_String_IsConcatNode(mixedNode));
+    TEST_ASSERT_FALSE(ZrCore_String_IsAscii(mixedNode));
+    TEST_ASSERT_TRUE(ZrCore_String_GetCodePointLength(state, mixedNode, &length));
+    TEST_ASSERT_EQUAL_UINT64(240u, (unsigned long long)length);
+    TEST_ASSERT_NULL(((SZrStringConcatNode *)mixedNode->stringDataExtend)->flatString);
+    assert_offsets_match_linear_walk(state, mixedNode, 240);
+
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_utf8_word_helpers_handle_unaligned_tails(void) {
+    char text[64];
+
+    memset(text, 'w', sizeof(text));
+    for (TZrSize start = 0; start < 8; start++) {
+        for (TZrSize length = 0; length + start <= sizeof(text); length++) {
+            TEST_ASSERT_TRUE(ZrCore_Utf8_IsAscii(text + start, length));
+        }
+    }
+    text[37] = (char)0x80;
+    TEST_ASSERT_FALSE(ZrCore_Utf8_IsAscii(text + 3, 40));
+    TEST_ASSERT_TRUE(ZrCore_Utf8_IsAscii(text + 3, 34));
+    TEST_ASSERT_EQUAL_UINT64(5u, (unsigned long long)ZrCore_Utf8_SkipCodePoints("ab\xE4\xB8\xAD", 5, 0, 3));
+    TEST_ASSERT_EQUAL_UINT64(2u, (unsigned long long)ZrCore_Utf8_SkipCodePoints("ab\xE4\xB8\xAD", 5, 0, 2));
+    TEST_ASSERT_EQUAL_UINT64(5u, (unsigned long long)ZrCore_Utf8_SkipCodePoints("ab\xE4\xB8\xAD", 5, 2, 9));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_ascii_strings_are_flagged_and_index_by_byte);
+    RUN_TEST(test_long_non_ascii_string_offsets_follow_breadcrumbs);
+    RUN_TEST(test_short_non_ascii_string_caches_code_point_length);
+    RUN_TEST(test_invalid_utf8_is_rejected_and_remembered);
+    RUN_TEST(test_concat_nodes_carry_ascii_flag_and_index_without_flattening);
+    RUN_TEST(test_utf8_word_helpers_handle_unaligned_tails);
+
+    return UNITY_END();
+}
@@ -250,6 +250,9 @@ static void test_stack_inline_copy_uses_byte_offsets_from_stack_base(void) {
     TEST_ASSERT_TRUE(ZrCore_Stack_CopyInline(state, &layout, destinationOffset, sourceOffset));
     TEST_ASSERT_EQUAL_UINT8_ARRAY(pattern, stackBytes + destinationOffset, sizeof(pattern));
 
+    // the raw bytes overlap the tags of the first stack values; clear them before teardown scans the stack.
+    ZrCore_Value_ResetAsNull(ZrCore_Stack_GetValue(state->stackBase.valuePointer));
+    ZrCore_Value_ResetAsNull(ZrCore_Stack_GetValue(state->stackBase.valuePointer + 1));
     ZrTests_Runtime_State_Destroy(state);
 }
 
@@ -1,3 +1,6 @@
+#include <stdint.h>
+#include <string.h>
+
 #include "unity.h"
 
 #include "tests/harness/runtime_support.h"
@@ -192,6 +195,51 @@ static void test_value_try_copy_fast_rejects_null_heap_object_payload(void) {
     ZrTests_Runtime_State_Destroy(state);
 }
 
+static void test_value_compact_layout_round_trips_every_tag(void) {
+    struct SZrOwnershipControl *controlSentinel = (struct SZrOwnershipControl *)(TZrPtr)(uintptr_t)0x1230u;
+    struct SZrOwnershipWeakRef *weakSentinel = (struct SZrOwnershipWeakRef *)(TZrPtr)(uintptr_t)0x4560u;
+
+#if !defined(ZR_VALUE_LAYOUT_WIDE)
+    TEST_ASSERT_TRUE(sizeof(SZrTypeValue) <= 2u * sizeof(TZrPureValue) + 2u * sizeof(TZrPtr));
+#endif
+
+    for (TZrUInt32 type = 0; type < ZR_VALUE_TYPE_ENUM_MAX; type++) {
+        SZrTypeValue value;
+
+        ZR_VALUE_FAST_SET(&value, nativeInt64, -7 - (TZrInt64)type, (EZrValueType)type);
+        TEST_ASSERT_EQUAL_INT((int)type, value.type);
+        TEST_ASSERT_EQUAL_INT64(-7 - (TZrInt64)type, value.value.nativeObject.nativeInt64);
+        TEST_ASSERT_TRUE(value.isNative);
+        TEST_ASSERT_FALSE(value.isGarbageCollectable);
+        TEST_ASSERT_EQUAL_INT(ZR_OWNERSHIP_VALUE_KIND_NONE, value.ownershipKind);
+
+        for (TZrUInt32 kind = ZR_OWNERSHIP_VALUE_KIND_NONE; kind <= ZR_OWNERSHIP_VALUE_KIND_LOANED; kind++) {
+            for (TZrUInt32 flags = 0; flags < 4u; flags++) {
+                SZrTypeValue relocated;
+
+                value.value.nativeObject.nativeUInt64 = 0xA5A5A5A5A5A5A5A5ull ^ ((TZrUInt64)type << 8) ^ kind;
+                value.type = (EZrValueType)type;
+                value.ownershipKind = (EZrOwnershipValueKind)kind;
+                value.isGarbageCollectable = (flags & 1u) != 0 ? ZR_TRUE : ZR_FALSE;
+                value.isNative = (flags & 2u) != 0 ? ZR_TRUE : ZR_FALSE;
+                value.ownershipControl = controlSentinel;
+                value.ownershipWeakRef = weakSentinel;
+
+                // stack relocation and array growth move cells with a raw copy
+                memcpy(&relocated, &value, sizeof(relocated));
+                TEST_ASSERT_EQUAL_INT((int)type, relocated.type);
+                TEST_ASSERT_EQUAL_INT((int)kind, relocated.ownershipKind);
+                TEST_ASSERT_EQUAL_INT((flags & 1u) != 0, relocated.isGarbageCollectable != ZR_FALSE);
+                TEST_ASSERT_EQUAL_INT((flags & 2u) != 0, relocated.isNative != ZR_FALSE);
+                TEST_ASSERT_EQUAL_UINT64(0xA5A5A5A5A5A5A5A5ull ^ ((TZrUInt64)type << 8) ^ kind,
+                                         relocated.value.nativeObject.nativeUInt64);
+                TEST_ASSERT_EQUAL_PTR(controlSentinel, relocated.ownershipControl);
+                TEST_ASSERT_EQUAL_PTR(weakSentinel, relocated.ownershipWeakRef);
+            }
+        }
+    }
+}
+
 int main(void) {
     UNITY_BEGIN();
 
@@ -201,6 +249,7 @@ int main(void) {
     RUN_TEST(test_value_copy_clones_plain_struct_object);
     RUN_TEST(test_value_try_copy_fast_rejects_plain_struct_object);
     RUN_TEST(test_value_try_copy_fast_rejects_null_heap_object_payload);
+    RUN_TEST(test_value_compact_layout_round_trips_every_tag);
 
     return UNITY_END();
 }
@@ -195,16 +195,14 @@ static void test_debug_evaluate_semantic_summary_reports_unsigned_numeric_range(
 
 static void test_debug_evaluate_semantic_summary_reports_parser_member_reference_fact(void) {
     SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
-    SZrString *arrayText;
-    SZrObject *arrayObject = ZR_NULL;
+    static const TZrInt64 kArrayValues[] = {'a', 'b', 'c', 'd'};
+    SZrObject *arrayObject;
     ZrDebugAgent agent;
     ZrDebugEvaluateResult result;
     TZrChar error[ZR_DEBUG_TEXT_CAPACITY];
 
     TEST_ASSERT_NOT_NULL(state);
-    arrayText = ZrCore_String_CreateFromNative(state, "abcd");
-    TEST_ASSERT_NOT_NULL(arrayText);
-    TEST_ASSERT_TRUE(ZrCore_String_ToByteArray(state, arrayText, &arrayObject));
+    arrayObject = ZrTests_Runtime_Array_NewInt(state, kArrayValues, sizeof(kArrayValues) / sizeof(kArrayValues[0]));
     TEST_ASSERT_NOT_NULL(arrayObject);
     ZrCore_Value_InitAsRawObject(state, &state->global->zrObject, ZR_CAST_RAW_OBJECT_AS_SUPER(arrayObject));
     state->global->zrObject.type = ZR_VALUE_TYPE_ARRAY;
@@ -584,16 +582,14 @@ static void test_debug_condition_evaluates_selected_ternary_branch_without_resol
 
 static void test_debug_condition_reference_summary_tracks_selected_branch_reads(void) {
     SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
-    SZrString *arrayText;
-    SZrObject *arrayObject = ZR_NULL;
+    static const TZrInt64 kArrayValues[] = {'a', 'b', 'c', 'd'};
+    SZrObject *arrayObject;
     ZrDebugAgent agent;
     ZrDebugEvaluateResult result;
     TZrChar error[ZR_DEBUG_TEXT_CAPACITY];
 
     TEST_ASSERT_NOT_NULL(state);
-    arrayText = ZrCore_String_CreateFromNative(state, "abcd");
-    TEST_ASSERT_NOT_NULL(arrayText);
-    TEST_ASSERT_TRUE(ZrCore_String_ToByteArray(state, arrayText, &arrayObject));
+    arrayObject = ZrTests_Runtime_Array_NewInt(state, kArrayValues, sizeof(kArrayValues) / sizeof(kArrayValues[0]));
     TEST_ASSERT_NOT_NULL(arrayObject);
     ZrCore_Value_InitAsRawObject(state, &state->global->zrObject, ZR_CAST_RAW_OBJECT_AS_SUPER(arrayObject));
     state->global->zrObject.type = ZR_VALUE_TYPE_ARRAY;
@@ -808,8 +808,8 @@ static void test_debug_evaluate_index_window_reports_base_reference_summary(void
     const int breakpointLine = 2;
     SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
     SZrFunction *function;
-    SZrString *arrayText;
-    SZrObject *arrayObject = ZR_NULL;
+    static const TZrInt64 kArrayValues[] = {'a', 'b', 'c', 'd'};
+    SZrObject *arrayObject;
     ZrDebugAgentConfig config;
     ZrDebugAgent *agent = ZR_NULL;
     SZrNetworkStream client;
@@ -820,9 +820,7 @@ static void test_debug_evaluate_index_window_reports_base_reference_summary(void
     cJSON *result;
 
     TEST_ASSERT_NOT_NULL(state);
-    arrayText = ZrCore_String_CreateFromNative(state, "abcd");
-    TEST_ASSERT_NOT_NULL(arrayText);
-    TEST_ASSERT_TRUE(ZrCore_String_ToByteArray(state, arrayText, &arrayObject));
+    arrayObject = ZrTests_Runtime_Array_NewInt(state, kArrayValues, sizeof(kArrayValues) / sizeof(kArrayValues[0]));
     TEST_ASSERT_NOT_NULL(arrayObject);
     ZrCore_Value_InitAsRawObject(state, &state->global->zrObject, ZR_CAST_RAW_OBJECT_AS_SUPER(arrayObject));
     state->global->zrObject.type = ZR_VALUE_TYPE_ARRAY;
@@ -582,6 +582,65 @@ static void test_zr_ffi_can_lower_buffer_handle_directly_to_pointer_argument(voi
     ZR_TEST_DIVIDER();
 }
 
+static void test_zr_ffi_call_batch_marshals_columns_and_broadcasts_scalars(void) {
+    static const TZrChar *kSourceTemplate =
+            "var ffi = %%import(\"zr.ffi\");\n"
+            "var lib = ffi.loadLibrary(\"%s\");\n"
+            "var add = lib.getSymbol(\"zr_ffi_add_i32\", {\n"
+            "  returnType: \"i32\",\n"
+            "  parameters: [{ type: \"i32\" }, { type: \"i32\" }]\n"
+            "});\n"
+            "var mul = lib.getSymbol(\"zr_ffi_mul_f64\", {\n"
+            "  returnType: \"f64\",\n"
+            "  parameters: [{ type: \"f64\" }, { type: \"f64\" }]\n"
+            "});\n"
+            "var fillBytes = lib.getSymbol(\"zr_ffi_fill_bytes\", {\n"
+            "  returnType: \"i32\",\n"
+            "  parameters: [\n"
+            "    { type: { kind: \"pointer\", to: \"u8\", direction: \"inout\" } },\n"
+            "    { type: \"u64\" },\n"
+            "    { type: \"u8\" }\n"
+            "  ]\n"
+            "});\n"
+            "var sums = add.callBatch([[1, 2, 3, 4], 10]);\n"
+            "var products = mul.callBatch([[1.5, 2.0], [2, 4]]);\n"
+            "var buffer = ffi.BufferHandle.allocate(4);\n"
+            "var written = fillBytes.callBatch([buffer, [4, 2], [10, 20]]);\n"
+            "var bytes = buffer.read(0, 4);\n"
+            "return sums[0] + sums[3] + <int> products[1] + written[0] + written[1] + bytes[0] + bytes[3] +\n"
+            "       add(5, 6);\n";
+    SZrTestTimer timer;
+    char source[4096];
+    char escapedPath[4096];
+    SZrState *state;
+    SZrFunction *entryFunction;
+    SZrTypeValue result;
+
+    ZR_TEST_START("zr.ffi callBatch marshals columns and broadcasts scalars");
+    timer.startTime = clock();
+
+    escape_for_zr_string_literal(escapedPath, sizeof(escapedPath), ZR_VM_FFI_FIXTURE_PATH);
+    snprintf(source, sizeof(source), kSourceTemplate, escapedPath);
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+
+    entryFunction = compile_source(state, source, "ffi_call_batch.zr");
+    TEST_ASSERT_NOT_NULL(entryFunction);
+    TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, entryFunction, &result));
+    TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_SIGNED_INT(result.type) || ZR_VALUE_IS_TYPE_UNSIGNED_INT(result.type));
+    if (ZR_VALUE_IS_TYPE_UNSIGNED_INT(result.type)) {
+        TEST_ASSERT_EQUAL_UINT64(83, result.value.nativeObject.nativeUInt64);
+    } else {
+        TEST_ASSERT_EQUAL_INT64(83, result.value.nativeObject.nativeInt64);
+    }
+
+    ZrCore_Function_Free(state, entryFunction);
+    destroy_test_state(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "zr.ffi callBatch marshals columns and broadcasts scalars");
+    ZR_TEST_DIVIDER();
+}
+
 static void test_zr_ffi_can_create_callback_handle(void) {
     static const TZrChar *kSource =
             "var ffi = %import(\"zr.ffi\");\n"
@@ -1504,6 +1563,7 @@ int main(void) {
     test_zr_ffi_buffer_and_pointer_methods_work();
     test_zr_ffi_can_fill_buffer_via_symbol();
     test_zr_ffi_can_lower_buffer_handle_directly_to_pointer_argument();
+    test_zr_ffi_call_batch_marshals_columns_and_broadcasts_scalars();
     test_zr_ffi_can_create_callback_handle();
     test_zr_ffi_can_call_callback_symbol();
     test_zr_ffi_can_roundtrip_structs_buffers_and_callbacks();
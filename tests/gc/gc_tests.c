@@ -2,6 +2,7 @@
 // Created by AI Assistant on 2026/1/2.
 //
 
+#include <stddef.h>
 #include <stdio.h>
 #include <time.h>
 #include <string.h>
@@ -2670,6 +2671,360 @@ static void test_gc_propagate_all_drains_large_gray_queue(void) {
     TEST_DIVIDER();
 }
 
+#define ZR_GC_TEST_PARALLEL_MARK_BRANCHES 64u
+#define ZR_GC_TEST_PARALLEL_MARK_LEAVES 16u
+#define ZR_GC_TEST_BACKGROUND_SWEEP_GARBAGE 2048u
+#define ZR_GC_TEST_NURSERY_CHUNK_BYTES (16u * 1024u)
+#define ZR_GC_TEST_NURSERY_GARBAGE 1024u
+#define ZR_GC_NURSERY_TEST_ALIGN(SIZE) (((SIZE) + ZR_ALIGN_SIZE - 1u) & ~((TZrSize)ZR_ALIGN_SIZE - 1u))
+
+static TZrUInt64 gc_test_sum_mark_worker_objects(const SZrGarbageCollectorStatsSnapshot *snapshot) {
+    TZrUInt64 total = 0;
+
+    for (TZrUInt32 index = 0; index < ZR_GC_PARALLEL_MARK_WORKER_MAX; index++) {
+        total += snapshot->lastMarkWorkerObjects[index];
+    }
+    return total;
+}
+
+static void gc_test_run_fanout_full_collection(TZrUInt32 workerCount, SZrGarbageCollectorStatsSnapshot *outSnapshot) {
+    SZrState *state = createTestState();
+    TZrStackValuePointer rootSlot;
+    SZrObject *root;
+    SZrObject *lastBranch = ZR_NULL;
+    SZrObject *lastLeaf = ZR_NULL;
+
+    TEST_ASSERT_NOT_NULL(state);
+    TEST_ASSERT_NOT_NULL(state->global);
+
+    rootSlot = state->stackBase.valuePointer;
+    root = ZrCore_Object_New(state, ZR_NULL);
+    TEST_ASSERT_NOT_NULL(root);
+    ZrCore_Stack_SetRawObjectValue(state, rootSlot, ZR_CAST_RAW_OBJECT_AS_SUPER(root));
+    state->stackTop.valuePointer = rootSlot + 1;
+
+    for (TZrUInt32 branchIndex = 0; branchIndex < ZR_GC_TEST_PARALLEL_MARK_BRANCHES; branchIndex++) {
+        SZrObject *branch = ZrCore_Object_New(state, ZR_NULL);
+        SZrTypeValue key;
+        SZrTypeValue value;
+
+        TEST_ASSERT_NOT_NULL(branch);
+        ZrCore_Value_InitAsInt(state, &key, (TZrInt64)branchIndex);
+        ZrCore_Value_InitAsRawObject(state, &value, ZR_CAST_RAW_OBJECT_AS_SUPER(branch));
+        ZrCore_Object_SetValue(state, root, &key, &value);
+        for (TZrUInt32 leafIndex = 0; leafIndex < ZR_GC_TEST_PARALLEL_MARK_LEAVES; leafIndex++) {
+            SZrObject *leaf = ZrCore_Object_New(state, ZR_NULL);
+
+            TEST_ASSERT_NOT_NULL(leaf);
+            ZrCore_Value_InitAsInt(state, &key, (TZrInt64)leafIndex);
+            ZrCore_Value_InitAsRawObject(state, &value, ZR_CAST_RAW_OBJECT_AS_SUPER(leaf));
+            ZrCore_Object_SetValue(state, branch, &key, &value);
+            lastLeaf = leaf;
+        }
+        lastBranch = branch;
+    }
+
+    ZrCore_GarbageCollector_SetWorkerCount(state->global, workerCount);
+    ZrCore_GarbageCollector_GcFull(state, ZR_FALSE);
+    ZrCore_GarbageCollector_GetStatsSnapshot(state->global, outSnapshot);
+
+    TEST_ASSERT_EQUAL_UINT32(ZR_GARBAGE_COLLECT_RUNNING_STATUS_PAUSED, state->global->garbageCollector->gcRunningStatus);
+    TEST_ASSERT_FALSE(state->global->garbageCollector->parallelMarkActive);
+    TEST_ASSERT_FALSE(ZrCore_RawObject_IsReleased(ZR_CAST_RAW_OBJECT_AS_SUPER(lastBranch)));
+    TEST_ASSERT_FALSE(ZrCore_RawObject_IsReleased(ZR_CAST_RAW_OBJECT_AS_SUPER(lastLeaf)));
+    TEST_ASSERT_TRUE(ZR_GC_IS_REFERENCED(ZR_CAST_RAW_OBJECT_AS_SUPER(lastLeaf)));
+    TEST_ASSERT_EQUAL_UINT32(ZR_GC_TEST_PARALLEL_MARK_BRANCHES, (TZrUInt32)root->nodeMap.elementCount);
+
+    destroyTestState(state);
+}
+
+static void test_gc_parallel_mark_matches_serial_mark(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "GC Parallel Mark Matches Serial Mark";
+    SZrGarbageCollectorStatsSnapshot serialSnapshot;
+    SZrGarbageCollectorStatsSnapshot parallelSnapshot;
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    TEST_INFO("Parallel full mark",
+              "Testing that a full collection with four mark workers keeps the whole reachable graph alive, scans the same number of objects as the serial drain, and reports per-worker counts");
+
+    gc_test_run_fanout_full_collection(1u, &serialSnapshot);
+    TEST_ASSERT_EQUAL_UINT32(1u, serialSnapshot.lastMarkWorkerCount);
+    TEST_ASSERT_EQUAL_UINT64(0u, serialSnapshot.parallelMarkCount);
+    TEST_ASSERT_TRUE(serialSnapshot.lastMarkWorkerObjects[0] >=
+                     (TZrUInt64)ZR_GC_TEST_PARALLEL_MARK_BRANCHES * ZR_GC_TEST_PARALLEL_MARK_LEAVES);
+
+    gc_test_run_fanout_full_collection(4u, &parallelSnapshot);
+    TEST_ASSERT_EQUAL_UINT32(4u, parallelSnapshot.lastMarkWorkerCount);
+    TEST_ASSERT_EQUAL_UINT64(1u, parallelSnapshot.parallelMarkCount);
+    TEST_ASSERT_EQUAL_UINT64(gc_test_sum_mark_worker_objects(&serialSnapshot),
+                             gc_test_sum_mark_worker_objects(&parallelSnapshot));
+    // how the work splits depends on scheduling; only slots past the pool size must stay empty.
+    for (TZrUInt32 index = 4u; index < ZR_GC_PARALLEL_MARK_WORKER_MAX; index++) {
+        TEST_ASSERT_EQUAL_UINT64(0u, parallelSnapshot.lastMarkWorkerObjects[index]);
+    }
+
+    timer.endTime = clock();
+    TEST_PASS(timer, testSummary);
+    TEST_DIVIDER();
+}
+
+static void gc_test_run_minor_collection_over_garbage(SZrState *state, TZrStackValuePointer rootSlot) {
+    SZrGarbageCollector *gc = state->global->garbageCollector;
+    SZrTypeValue *rootValue;
+
+    for (TZrUInt32 index = 0; index < ZR_GC_TEST_BACKGROUND_SWEEP_GARBAGE; index++) {
+        TEST_ASSERT_NOT_NULL(ZrCore_Object_New(state, ZR_NULL));
+    }
+    gc->gcDebtSize = 4096;
+    gc->gcLastStepWork = 0;
+    ZrCore_GarbageCollector_GcStep(state);
+
+    // the root may have been evacuated; it must still be a live object either way.
+    rootValue = ZrCore_Stack_GetValue(rootSlot);
+    TEST_ASSERT_TRUE(rootValue->isGarbageCollectable);
+    TEST_ASSERT_FALSE(ZrCore_RawObject_IsReleased(rootValue->value.object));
+}
+
+static void test_gc_background_sweep_frees_dead_objects_off_the_mutator(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "GC Background Sweep Frees Dead Objects Off The Mutator";
+    SZrState *state;
+    TZrStackValuePointer rootSlot;
+    SZrObject *root;
+    SZrGarbageCollectorStatsSnapshot snapshot;
+    TZrUInt64 objectCountAfterEnabledRun;
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    TEST_INFO("Background sweep hand-off",
+              "Testing that dead young objects freed by a minor collection with background sweep enabled are released by the sweeper thread, the root survives, and the snapshot reports the moved work");
+
+    state = createTestState();
+    TEST_ASSERT_NOT_NULL(state);
+    state->global->garbageCollector->gcMode = ZR_GARBAGE_COLLECT_MODE_GENERATIONAL;
+    rootSlot = state->stackBase.valuePointer;
+    root = ZrCore_Object_New(state, ZR_NULL);
+    TEST_ASSERT_NOT_NULL(root);
+    ZrCore_Stack_SetRawObjectValue(state, rootSlot, ZR_CAST_RAW_OBJECT_AS_SUPER(root));
+    state->stackTop.valuePointer = rootSlot + 1;
+
+    ZrCore_GarbageCollector_SetBackgroundSweep(state->global, ZR_TRUE);
+    gc_test_run_minor_collection_over_garbage(state, rootSlot);
+    ZrCore_GarbageCollector_WaitBackgroundSweep(state->global);
+    ZrCore_GarbageCollector_GetStatsSnapshot(state->global, &snapshot);
+
+    TEST_ASSERT_TRUE(snapshot.backgroundSweepEnabled);
+    TEST_ASSERT_TRUE(snapshot.backgroundSweepObjectCount >= ZR_GC_TEST_BACKGROUND_SWEEP_GARBAGE);
+    TEST_ASSERT_TRUE(snapshot.backgroundSweepFreeCount >= snapshot.backgroundSweepObjectCount);
+    TEST_ASSERT_TRUE(snapshot.backgroundSweepBatchCount >=
+                     ZR_GC_TEST_BACKGROUND_SWEEP_GARBAGE / ZR_GC_BACKGROUND_SWEEP_BATCH_CAPACITY);
+    TEST_ASSERT_TRUE(snapshot.backgroundSweepBytes >=
+                     (TZrUInt64)ZR_GC_TEST_BACKGROUND_SWEEP_GARBAGE * sizeof(SZrObject));
+    objectCountAfterEnabledRun = snapshot.backgroundSweepObjectCount;
+
+    // once disabled, sweeping frees inline again and the totals stay put.
+    ZrCore_GarbageCollector_SetBackgroundSweep(state->global, ZR_FALSE);
+    gc_test_run_minor_collection_over_garbage(state, rootSlot);
+    ZrCore_GarbageCollector_GetStatsSnapshot(state->global, &snapshot);
+    TEST_ASSERT_FALSE(snapshot.backgroundSweepEnabled);
+    TEST_ASSERT_EQUAL_UINT64(objectCountAfterEnabledRun, snapshot.backgroundSweepObjectCount);
+
+    // shutdown with batches still queued must drain them before the allocator goes away.
+    ZrCore_GarbageCollector_SetBackgroundSweep(state->global, ZR_TRUE);
+    gc_test_run_minor_collection_over_garbage(state, rootSlot);
+    destroyTestState(state);
+
+    timer.endTime = clock();
+    TEST_PASS(timer, testSummary);
+    TEST_DIVIDER();
+}
+
+static void gc_test_allocate_nursery_garbage_and_run_minor(SZrState *state) {
+    SZrGarbageCollector *gc = state->global->garbageCollector;
+
+    for (TZrUInt32 index = 0; index < ZR_GC_TEST_NURSERY_GARBAGE; index++) {
+        TEST_ASSERT_NOT_NULL(ZrCore_Object_New(state, ZR_NULL));
+    }
+    gc->gcDebtSize = 4096;
+    gc->gcLastStepWork = 0;
+    ZrCore_GarbageCollector_GcStep(state);
+}
+
+static void test_gc_nursery_evacuates_survivors_and_rewinds_chunks(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "GC Nursery Evacuates Survivors And Rewinds Chunks";
+    SZrState *state;
+    SZrGarbageCollector *gc;
+    TZrStackValuePointer rootSlot;
+    SZrObject *parent;
+    SZrObject *child;
+    SZrObject *pinned;
+    SZrString *memberName;
+    SZrTypeValue memberKey;
+    SZrTypeValue childValue;
+    SZrTypeValue *rootValue;
+    const SZrTypeValue *resolvedChildValue;
+    SZrGcNativeCallPin pin;
+    SZrGarbageCollectorStatsSnapshot snapshot;
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    TEST_INFO("Copying nursery",
+              "Testing that plain objects are bump-allocated in eden chunks, a minor collection copies unpinned survivors out and rewrites references to them, a native-call pinned survivor keeps its address and chunk, and emptied chunks are rewound");
+
+    state = createTestState();
+    TEST_ASSERT_NOT_NULL(state);
+    gc = state->global->garbageCollector;
+    gc->gcMode = ZR_GARBAGE_COLLECT_MODE_GENERATIONAL;
+    // two small chunks so the garbage overflows into the allocator and chunks have to be reused.
+    gc->youngRegionSize = ZR_GC_TEST_NURSERY_CHUNK_BYTES;
+    gc->youngRegionCountTarget = 2u;
+    ZrCore_GarbageCollector_SetNursery(state->global, ZR_TRUE);
+
+    parent = ZrCore_Object_New(state, ZR_NULL);
+    child = ZrCore_Object_New(state, ZR_NULL);
+    pinned = ZrCore_Object_New(state, ZR_NULL);
+    memberName = ZrCore_String_CreateFromNative(state, "child");
+    TEST_ASSERT_NOT_NULL(parent);
+    TEST_ASSERT_NOT_NULL(child);
+    TEST_ASSERT_NOT_NULL(pinned);
+    TEST_ASSERT_NOT_NULL(memberName);
+    TEST_ASSERT_TRUE(parent->super.garbageCollectMark.nurseryChunkId != 0u);
+    TEST_ASSERT_TRUE(pinned->super.garbageCollectMark.nurseryChunkId != 0u);
+    // bump allocation hands out neighbouring slots.
+    TEST_ASSERT_EQUAL_PTR((TZrBytePtr)parent + ZR_GC_NURSERY_TEST_ALIGN(sizeof(SZrObject)), (TZrBytePtr)child);
+    TEST_ASSERT_EQUAL_UINT32(0u, memberName->super.garbageCollectMark.nurseryChunkId);
+
+    ZrCore_Value_InitAsRawObject(state, &memberKey, ZR_CAST_RAW_OBJECT_AS_SUPER(memberName));
+    memberKey.type = ZR_VALUE_TYPE_STRING;
+    ZrCore_Value_InitAsRawObject(state, &childValue, ZR_CAST_RAW_OBJECT_AS_SUPER(child));
+    ZrCore_Object_SetValue(state, parent, &memberKey, &childValue);
+
+    rootSlot = state->stackBase.valuePointer;
+    ZrCore_Stack_SetRawObjectValue(state, rootSlot, ZR_CAST_RAW_OBJECT_AS_SUPER(parent));
+    ZrCore_Stack_SetRawObjectValue(state, rootSlot + 1, ZR_CAST_RAW_OBJECT_AS_SUPER(pinned));
+    state->stackTop.valuePointer = rootSlot + 2;
+    TEST_ASSERT_TRUE(ZrCore_Gc_NativeCallPinObject(state, ZR_CAST_RAW_OBJECT_AS_SUPER(pinned), &pin));
+
+    gc_test_allocate_nursery_garbage_and_run_minor(state);
+
+    rootValue = ZrCore_Stack_GetValue(rootSlot);
+    TEST_ASSERT_TRUE(rootValue->isGarbageCollectable);
+    TEST_ASSERT_TRUE(rootValue->value.object != ZR_CAST_RAW_OBJECT_AS_SUPER(parent));
+    TEST_ASSERT_EQUAL_UINT32(0u, rootValue->value.object->garbageCollectMark.nurseryChunkId);
+    TEST_ASSERT_FALSE(ZrCore_RawObject_IsReleased(rootValue->value.object));
+    resolvedChildValue = ZrCore_Object_GetValue(state, ZR_CAST_OBJECT(state, rootValue->value.object), &memberKey);
+    TEST_ASSERT_NOT_NULL(resolvedChildValue);
+    TEST_ASSERT_TRUE(resolvedChildValue->value.object != ZR_CAST_RAW_OBJECT_AS_SUPER(child));
+    TEST_ASSERT_EQUAL_UINT32(0u, resolvedChildValue->value.object->garbageCollectMark.nurseryChunkId);
+    TEST_ASSERT_FALSE(ZrCore_RawObject_IsReleased(resolvedChildValue->value.object));
+
+    rootValue = ZrCore_Stack_GetValue(rootSlot + 1);
+    TEST_ASSERT_EQUAL_PTR(ZR_CAST_RAW_OBJECT_AS_SUPER(pinned), rootValue->value.object);
+    TEST_ASSERT_TRUE(pinned->super.garbageCollectMark.nurseryChunkId != 0u);
+
+    ZrCore_GarbageCollector_GetStatsSnapshot(state->global, &snapshot);
+    TEST_ASSERT_TRUE(snapshot.nurseryEnabled);
+    TEST_ASSERT_EQUAL_UINT32(2u, snapshot.nurseryChunkCount);
+    TEST_ASSERT_EQUAL_UINT64(2u * ZR_GC_TEST_NURSERY_CHUNK_BYTES, snapshot.nurseryCapacityBytes);
+    TEST_ASSERT_TRUE(snapshot.nurseryFallbackCount > 0u);
+    TEST_ASSERT_EQUAL_UINT64(2u, snapshot.nurseryEvacuatedCount);
+    TEST_ASSERT_EQUAL_UINT64(2u * sizeof(SZrObject), snapshot.nurseryEvacuatedBytes);
+    TEST_ASSERT_EQUAL_UINT64(1u, snapshot.nurseryRetainedCount);
+
+    // the chunk without the pinned object is empty now and gets rewound on the next chunk switch.
+    gc_test_allocate_nursery_garbage_and_run_minor(state);
+    ZrCore_GarbageCollector_GetStatsSnapshot(state->global, &snapshot);
+    TEST_ASSERT_TRUE(snapshot.nurseryChunkResetCount >= 1u);
+    TEST_ASSERT_EQUAL_UINT32(2u, snapshot.nurseryChunkCount);
+    TEST_ASSERT_EQUAL_PTR(ZR_CAST_RAW_OBJECT_AS_SUPER(pinned), ZrCore_Stack_GetValue(rootSlot + 1)->value.object);
+
+    // pinning promoted it to old in place, so unpinning does not make it movable again.
+    ZrCore_Gc_NativeCallUnpin(state->global, &pin);
+    gc_test_allocate_nursery_garbage_and_run_minor(state);
+    TEST_ASSERT_EQUAL_PTR(ZR_CAST_RAW_OBJECT_AS_SUPER(pinned), ZrCore_Stack_GetValue(rootSlot + 1)->value.object);
+    TEST_ASSERT_FALSE(ZrCore_RawObject_IsReleased(ZR_CAST_RAW_OBJECT_AS_SUPER(pinned)));
+
+    ZrCore_GarbageCollector_SetNursery(state->global, ZR_FALSE);
+    TEST_ASSERT_EQUAL_UINT32(0u, ZrCore_Object_New(state, ZR_NULL)->super.garbageCollectMark.nurseryChunkId);
+    destroyTestState(state);
+
+    timer.endTime = clock();
+    TEST_PASS(timer, testSummary);
+    TEST_DIVIDER();
+}
+
+static void test_gc_object_header_keeps_mark_fields_compact(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "GC Object Header Keeps Mark Fields Compact";
+    SZrState *state;
+    SZrGarbageCollector *gc;
+    TZrStackValuePointer rootSlot;
+    SZrObject *hashedBeforeMove;
+    SZrObject *hashedAfterMove;
+    SZrRawObject *movedObject;
+    TZrUInt64 hashBeforeMove;
+    SZrTypeValue value;
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    TEST_INFO("Object header layout",
+              "Testing that the fields touched by marking share the first cache line, the mark packs into 64 bytes, and the lazy identity hash survives a nursery copy");
+
+    TEST_ASSERT_TRUE(sizeof(SZrGarbageCollectionObjectMark) <= 64u);
+    TEST_ASSERT_TRUE(offsetof(SZrRawObject, gcList) < 64u);
+    TEST_ASSERT_TRUE(offsetof(SZrRawObject, scanMarkGcFunction) < 64u);
+    TEST_ASSERT_TRUE(offsetof(SZrRawObject, garbageCollectMark) + offsetof(SZrGarbageCollectionObjectMark, status) +
+                             sizeof(EZrGarbageCollectIncrementalObjectStatus) <=
+                     64u);
+
+    state = createTestState();
+    TEST_ASSERT_NOT_NULL(state);
+    gc = state->global->garbageCollector;
+    gc->gcMode = ZR_GARBAGE_COLLECT_MODE_GENERATIONAL;
+    gc->youngRegionSize = ZR_GC_TEST_NURSERY_CHUNK_BYTES;
+    gc->youngRegionCountTarget = 2u;
+    ZrCore_GarbageCollector_SetNursery(state->global, ZR_TRUE);
+
+    hashedBeforeMove = ZrCore_Object_New(state, ZR_NULL);
+    hashedAfterMove = ZrCore_Object_New(state, ZR_NULL);
+    TEST_ASSERT_NOT_NULL(hashedBeforeMove);
+    TEST_ASSERT_NOT_NULL(hashedAfterMove);
+    TEST_ASSERT_EQUAL_UINT64(0u, hashedBeforeMove->super.hash);
+
+    ZrCore_Value_InitAsRawObject(state, &value, ZR_CAST_RAW_OBJECT_AS_SUPER(hashedBeforeMove));
+    hashBeforeMove = ZrCore_Value_GetHash(state, &value);
+    TEST_ASSERT_TRUE(hashBeforeMove != 0u);
+    TEST_ASSERT_EQUAL_UINT64(hashBeforeMove, ZrCore_Value_GetHash(state, &value));
+
+    rootSlot = state->stackBase.valuePointer;
+    ZrCore_Stack_SetRawObjectValue(state, rootSlot, ZR_CAST_RAW_OBJECT_AS_SUPER(hashedBeforeMove));
+    ZrCore_Stack_SetRawObjectValue(state, rootSlot + 1, ZR_CAST_RAW_OBJECT_AS_SUPER(hashedAfterMove));
+    state->stackTop.valuePointer = rootSlot + 2;
+    gc_test_allocate_nursery_garbage_and_run_minor(state);
+
+    movedObject = ZrCore_Stack_GetValue(rootSlot)->value.object;
+    TEST_ASSERT_TRUE(movedObject != ZR_CAST_RAW_OBJECT_AS_SUPER(hashedBeforeMove));
+    TEST_ASSERT_EQUAL_UINT64(hashBeforeMove, ZrCore_RawObject_GetHash(movedObject));
+
+    movedObject = ZrCore_Stack_GetValue(rootSlot + 1)->value.object;
+    TEST_ASSERT_TRUE(movedObject != ZR_CAST_RAW_OBJECT_AS_SUPER(hashedAfterMove));
+    TEST_ASSERT_EQUAL_UINT64(0u, movedObject->hash);
+    TEST_ASSERT_TRUE(ZrCore_RawObject_GetHash(movedObject) != hashBeforeMove);
+
+    destroyTestState(state);
+
+    timer.endTime = clock();
+    TEST_PASS(timer, testSummary);
+    TEST_DIVIDER();
+}
+
 static SZrFunction *gc_test_create_function_with_return_escape(SZrState *state,
                                                                TZrUInt32 stackSlot,
                                                                TZrUInt32 scopeDepth,
@@ -3195,7 +3550,8 @@ static void test_gc_minor_collection_rewrites_inline_frame_value_with_layout_vis
         TZrByte *prototypeData;
         TZrUInt32 prototypeDataLength;
         TZrUInt32 inlineByteOffset =
-                (TZrUInt32)(3u * sizeof(SZrTypeValueOnStack) + (TZrUInt32)ZR_ALIGN_SIZE);
+                (TZrUInt32)((3u * sizeof(SZrTypeValueOnStack) + (TZrUInt32)ZR_ALIGN_SIZE) / ZR_ALIGN_SIZE *
+                            ZR_ALIGN_SIZE);
         TZrSize frameStorageSlotCount;
         TZrStackValuePointer slot;
         SZrStackFramePlace inlinePlace;
@@ -4634,6 +4990,10 @@ int main(void) {
     RUN_TEST(test_gc_function_auxiliary_metadata_is_marked_from_root_function);
     RUN_TEST(test_gc_released_embedded_child_function_is_not_remarked_from_root_value);
     RUN_TEST(test_gc_propagate_all_drains_large_gray_queue);
+    RUN_TEST(test_gc_parallel_mark_matches_serial_mark);
+    RUN_TEST(test_gc_background_sweep_frees_dead_objects_off_the_mutator);
+    RUN_TEST(test_gc_nursery_evacuates_survivors_and_rewinds_chunks);
+    RUN_TEST(test_gc_object_header_keeps_mark_fields_compact);
     RUN_TEST(test_function_return_escape_promotes_returned_object_during_minor_gc);
     RUN_TEST(test_module_export_marks_exported_object_as_module_root);
     RUN_TEST(test_gc_object_base_size_tracks_custom_object_layouts);
@@ -6,6 +6,7 @@
 #include "zr_vm_core/conversion.h"
 #include "zr_vm_core/exception.h"
 #include "zr_vm_core/gc.h"
+#include "zr_vm_core/object.h"
 #include "zr_vm_core/stack.h"
 
 #if defined(_MSC_VER)
@@ -458,3 +459,32 @@ TZrBool ZrTests_Runtime_Function_ExecuteExpectInt64(SZrState *state, SZrFunction
     *result = returnValue.value.nativeObject.nativeInt64;
     return ZR_TRUE;
 }
+
+SZrObject *ZrTests_Runtime_Array_NewInt(SZrState *state, const TZrInt64 *values, TZrSize count) {
+    SZrObject *array;
+    SZrTypeValue receiver;
+
+    if (state == ZR_NULL || (values == ZR_NULL && count > 0)) {
+        return ZR_NULL;
+    }
+
+    array = ZrCore_Object_NewCustomized(state, sizeof(SZrObject), ZR_OBJECT_INTERNAL_TYPE_ARRAY);
+    if (array == ZR_NULL) {
+        return ZR_NULL;
+    }
+    ZrCore_Object_Init(state, array);
+
+    ZrCore_Value_InitAsRawObject(state, &receiver, ZR_CAST_RAW_OBJECT_AS_SUPER(array));
+    receiver.type = ZR_VALUE_TYPE_ARRAY;
+    for (TZrSize index = 0; index < count; index++) {
+        SZrTypeValue indexValue;
+        SZrTypeValue elementValue;
+
+        ZrCore_Value_InitAsInt(state, &indexValue, (TZrInt64)index);
+        ZrCore_Value_InitAsInt(state, &elementValue, values[index]);
+        if (!ZrCore_Object_SetByIndex(state, &receiver, &indexValue, &elementValue)) {
+            return ZR_NULL;
+        }
+    }
+    return array;
+}
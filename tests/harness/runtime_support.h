@@ -28,6 +28,8 @@ TZrBool ZrTests_Runtime_Function_Execute(SZrState *state, SZrFunction *function,
 
 TZrBool ZrTests_Runtime_Function_ExecuteExpectInt64(SZrState *state, SZrFunction *function, TZrInt64 *result);
 
+struct SZrObject *ZrTests_Runtime_Array_NewInt(SZrState *state, const TZrInt64 *values, TZrSize count);
+
 void ZrTests_Runtime_CrashScope_Begin(SZrState *state);
 
 void ZrTests_Runtime_CrashScope_End(SZrState *state);
@@ -0,0 +1,208 @@
+#include "unity.h"
+
+#include "zr_vm_library/pooled_allocator.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+#define ZR_POOLED_ALLOCATOR_TEST_WORKER_BLOCKS 256
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static TZrPtr pool_allocate(TZrSize size, EZrMemoryNativeType type) {
+    return ZrLibrary_PooledAllocator_Allocate(ZR_NULL, ZR_NULL, 0, size, type);
+}
+
+static TZrPtr pool_reallocate(TZrPtr pointer, TZrSize originalSize, TZrSize newSize, EZrMemoryNativeType type) {
+    return ZrLibrary_PooledAllocator_Allocate(ZR_NULL, pointer, originalSize, newSize, type);
+}
+
+static void pool_free(TZrPtr pointer, TZrSize size, EZrMemoryNativeType type) {
+    ZrLibrary_PooledAllocator_Allocate(ZR_NULL, pointer, size, 0, type);
+}
+
+static void assert_bytes_equal(TZrByte expected, const TZrPtr pointer, TZrSize length) {
+    const TZrByte *bytes = (const TZrByte *)pointer;
+    TZrSize index;
+
+    for (index = 0; index < length; index++) {
+        TEST_ASSERT_EQUAL_UINT8(expected, bytes[index]);
+    }
+}
+
+static void test_freed_small_block_is_reused_by_its_size_class(void) {
+    TZrPtr first = pool_allocate(40, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    TZrPtr second = pool_allocate(40, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    TZrPtr reused;
+
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_EQUAL_UINT(0u, (unsigned)((uintptr_t)first % ZR_LIBRARY_POOLED_ALLOCATOR_ALIGNMENT));
+    TEST_ASSERT_EQUAL_UINT(0u, (unsigned)((uintptr_t)second % ZR_LIBRARY_POOLED_ALLOCATOR_ALIGNMENT));
+    memset(first, 0x5A, 40);
+    memset(second, 0xA5, 40);
+
+    pool_free(first, 40, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    // 33..48 bytes share a class, so the freed block comes straight back.
+    reused = pool_allocate(33, ZR_MEMORY_NATIVE_TYPE_STRING);
+    TEST_ASSERT_EQUAL_PTR(first, reused);
+    assert_bytes_equal(0xA5, second, 40);
+
+    pool_free(reused, 33, ZR_MEMORY_NATIVE_TYPE_STRING);
+    pool_free(second, 40, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+}
+
+static void test_reallocate_keeps_contents_across_size_classes(void) {
+    TZrByte *bytes = (TZrByte *)pool_allocate(24, ZR_MEMORY_NATIVE_TYPE_HASH_PAIR);
+    TZrByte *same;
+    TZrByte *grown;
+    TZrByte *large;
+    TZrSize index;
+
+    TEST_ASSERT_NOT_NULL(bytes);
+    for (index = 0; index < 24; index++) {
+        bytes[index] = (TZrByte)index;
+    }
+
+    same = (TZrByte *)pool_reallocate(bytes, 24, 30, ZR_MEMORY_NATIVE_TYPE_HASH_PAIR);
+    TEST_ASSERT_EQUAL_PTR(bytes, same);
+
+    grown = (TZrByte *)pool_reallocate(same, 30, 700, ZR_MEMORY_NATIVE_TYPE_HASH_PAIR);
+    TEST_ASSERT_NOT_NULL(grown);
+    for (index = 0; index < 24; index++) {
+        TEST_ASSERT_EQUAL_UINT8((TZrByte)index, grown[index]);
+    }
+
+    large = (TZrByte *)pool_reallocate(grown, 700, 64 * 1024, ZR_MEMORY_NATIVE_TYPE_HASH_PAIR);
+    TEST_ASSERT_NOT_NULL(large);
+    for (index = 0; index < 24; index++) {
+        TEST_ASSERT_EQUAL_UINT8((TZrByte)index, large[index]);
+    }
+    large[64 * 1024 - 1] = 0x7F;
+    pool_free(large, 64 * 1024, ZR_MEMORY_NATIVE_TYPE_HASH_PAIR);
+}
+
+static void test_growable_types_and_large_requests_go_to_the_system(void) {
+    SZrLibrary_PooledAllocatorStats before;
+    SZrLibrary_PooledAllocatorStats after;
+    TZrPtr stack;
+    TZrPtr large;
+    TZrPtr small;
+
+    ZrLibrary_PooledAllocator_GetStats(&before);
+    stack = pool_allocate(64, ZR_MEMORY_NATIVE_TYPE_STACK);
+    large = pool_allocate(ZR_LIBRARY_POOLED_ALLOCATOR_MAX_SMALL_SIZE + 1, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    small = pool_allocate(64, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    ZrLibrary_PooledAllocator_GetStats(&after);
+
+    TEST_ASSERT_NOT_NULL(stack);
+    TEST_ASSERT_NOT_NULL(large);
+    TEST_ASSERT_NOT_NULL(small);
+    TEST_ASSERT_EQUAL_UINT64(before.systemAllocations + 2u, after.systemAllocations);
+    TEST_ASSERT_EQUAL_UINT64(before.pooledAllocations + 1u, after.pooledAllocations);
+    TEST_ASSERT_EQUAL_INT64(before.liveAllocations[ZR_MEMORY_NATIVE_TYPE_OBJECT] + 2,
+                            after.liveAllocations[ZR_MEMORY_NATIVE_TYPE_OBJECT]);
+    TEST_ASSERT_EQUAL_INT64(before.liveAllocations[ZR_MEMORY_NATIVE_TYPE_STACK] + 1,
+                            after.liveAllocations[ZR_MEMORY_NATIVE_TYPE_STACK]);
+
+    stack = pool_reallocate(stack, 64, 4096, ZR_MEMORY_NATIVE_TYPE_STACK);
+    TEST_ASSERT_NOT_NULL(stack);
+    pool_free(stack, 4096, ZR_MEMORY_NATIVE_TYPE_STACK);
+    pool_free(large, ZR_LIBRARY_POOLED_ALLOCATOR_MAX_SMALL_SIZE + 1, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    pool_free(small, 64, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+
+    ZrLibrary_PooledAllocator_GetStats(&after);
+    TEST_ASSERT_EQUAL_INT64(before.liveAllocations[ZR_MEMORY_NATIVE_TYPE_OBJECT],
+                            after.liveAllocations[ZR_MEMORY_NATIVE_TYPE_OBJECT]);
+    TEST_ASSERT_EQUAL_INT64(before.liveAllocations[ZR_MEMORY_NATIVE_TYPE_STACK],
+                            after.liveAllocations[ZR_MEMORY_NATIVE_TYPE_STACK]);
+}
+
+#if !defined(_WIN32)
+typedef struct SZrPooledAllocatorTestWorker {
+    TZrPtr blocks[ZR_POOLED_ALLOCATOR_TEST_WORKER_BLOCKS];
+    TZrBool freeOnWorker;
+} SZrPooledAllocatorTestWorker;
+
+static void *pooled_allocator_test_worker_main(void *argument) {
+    SZrPooledAllocatorTestWorker *worker = (SZrPooledAllocatorTestWorker *)argument;
+    TZrSize index;
+
+    for (index = 0; index < ZR_POOLED_ALLOCATOR_TEST_WORKER_BLOCKS; index++) {
+        worker->blocks[index] = pool_allocate(96, ZR_MEMORY_NATIVE_TYPE_CALL_INFO);
+        if (worker->blocks[index] != ZR_NULL) {
+            memset(worker->blocks[index], (int)index, 96);
+        }
+    }
+    if (worker->freeOnWorker) {
+        for (index = 0; index < ZR_POOLED_ALLOCATOR_TEST_WORKER_BLOCKS; index++) {
+            pool_free(worker->blocks[index], 96, ZR_MEMORY_NATIVE_TYPE_CALL_INFO);
+        }
+    }
+    return ZR_NULL;
+}
+
+static void run_worker(SZrPooledAllocatorTestWorker *worker) {
+    pthread_t thread;
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, ZR_NULL, pooled_allocator_test_worker_main, worker));
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(thread, ZR_NULL));
+}
+
+static void test_worker_thread_stats_and_blocks_outlive_the_worker(void) {
+    SZrPooledAllocatorTestWorker worker;
+    SZrLibrary_PooledAllocatorStats before;
+    SZrLibrary_PooledAllocatorStats after;
+    TZrSize index;
+
+    ZrLibrary_PooledAllocator_GetStats(&before);
+
+    // blocks allocated on a worker stay valid after it exits and can be freed elsewhere.
+    memset(&worker, 0, sizeof(worker));
+    run_worker(&worker);
+    ZrLibrary_PooledAllocator_GetStats(&after);
+    TEST_ASSERT_EQUAL_INT64(before.liveAllocations[ZR_MEMORY_NATIVE_TYPE_CALL_INFO] +
+                                    ZR_POOLED_ALLOCATOR_TEST_WORKER_BLOCKS,
+                            after.liveAllocations[ZR_MEMORY_NATIVE_TYPE_CALL_INFO]);
+    for (index = 0; index < ZR_POOLED_ALLOCATOR_TEST_WORKER_BLOCKS; index++) {
+        TEST_ASSERT_NOT_NULL(worker.blocks[index]);
+        assert_bytes_equal((TZrByte)index, worker.blocks[index], 96);
+        pool_free(worker.blocks[index], 96, ZR_MEMORY_NATIVE_TYPE_CALL_INFO);
+    }
+    ZrLibrary_PooledAllocator_GetStats(&after);
+    TEST_ASSERT_EQUAL_INT64(before.liveAllocations[ZR_MEMORY_NATIVE_TYPE_CALL_INFO],
+                            after.liveAllocations[ZR_MEMORY_NATIVE_TYPE_CALL_INFO]);
+
+    // a worker that frees its own blocks hands them to the depot, so the next worker needs no new chunk.
+    memset(&worker, 0, sizeof(worker));
+    worker.freeOnWorker = ZR_TRUE;
+    run_worker(&worker);
+    ZrLibrary_PooledAllocator_GetStats(&before);
+    memset(&worker, 0, sizeof(worker));
+    worker.freeOnWorker = ZR_TRUE;
+    run_worker(&worker);
+    ZrLibrary_PooledAllocator_GetStats(&after);
+    TEST_ASSERT_EQUAL_UINT64(before.reservedChunkBytes, after.reservedChunkBytes);
+    TEST_ASSERT_EQUAL_UINT64(before.pooledAllocations + ZR_POOLED_ALLOCATOR_TEST_WORKER_BLOCKS,
+                             after.pooledAllocations);
+}
+#endif
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_freed_small_block_is_reused_by_its_size_class);
+    RUN_TEST(test_reallocate_keeps_contents_across_size_classes);
+    RUN_TEST(test_growable_types_and_large_requests_go_to_the_system);
+#if !defined(_WIN32)
+    RUN_TEST(test_worker_thread_stats_and_blocks_outlive_the_worker);
+#endif
+
+    return UNITY_END();
+}
@@ -1443,6 +1443,68 @@ static void test_reader_rejects_future_metadata_patch_with_version_diagnostic(vo
     ZrTests_Runtime_State_Destroy(state);
 }
 
+static void assert_reader_rejects_binary(const TZrByte *buffer, TZrSize bufferLength, const TZrChar *expectedMessage) {
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrBinaryFixtureReader reader;
+    SZrIo io;
+    SZrReadSourceTryContext readContext;
+    EZrThreadStatus status;
+    const TZrChar *message;
+
+    TEST_ASSERT_NOT_NULL(state);
+    memset(&reader, 0, sizeof(reader));
+    reader.bytes = buffer;
+    reader.length = bufferLength;
+    memset(&io, 0, sizeof(io));
+    ZrCore_Io_Init(state, &io, binary_fixture_reader_read, binary_fixture_reader_close, &reader);
+    io.isBinary = ZR_TRUE;
+    memset(&readContext, 0, sizeof(readContext));
+    readContext.io = &io;
+
+    status = ZrCore_Exception_TryRun(state, read_source_try_body, &readContext);
+    TEST_ASSERT_TRUE(ZrCore_Exception_IsStausError(status));
+    TEST_ASSERT_NULL(readContext.source);
+    message = current_exception_message(state);
+    TEST_ASSERT_NOT_NULL(message);
+    TEST_ASSERT_NOT_NULL(strstr(message, expectedMessage));
+    ZrTests_Runtime_State_Destroy(state);
+}
+
+static void test_reader_rejects_frame_layout_written_for_another_value_cell(void) {
+    const char *binaryPath = "metadata_token_value_cell.zro";
+    SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
+    SZrFunction *function;
+    TZrByte *buffer = ZR_NULL;
+    TZrSize bufferLength = 0;
+    const TZrSize versionPatchOffset = 12u;
+    const TZrSize valueCellSizeOffset = 32u;
+
+    TEST_ASSERT_NOT_NULL(state);
+
+    function = create_metadata_token_fixture(state);
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_TRUE(ZrParser_Writer_WriteBinaryFile(state, function, binaryPath));
+    buffer = read_binary_file_owned(binaryPath, &bufferLength);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_TRUE(bufferLength > valueCellSizeOffset + 2u);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(SZrTypeValue), buffer[valueCellSizeOffset]);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(SZrTypeValueOnStack), buffer[valueCellSizeOffset + 1u]);
+
+    // a module compiled for a different value cell must not load with shifted frame offsets
+    buffer[valueCellSizeOffset] = (TZrByte)(sizeof(SZrTypeValue) + 16u);
+    assert_reader_rejects_binary(buffer, bufferLength, "io source frame layout was written for another value cell");
+
+    // patches that carry frame layouts but predate the recorded cell size are rejected outright
+    buffer[valueCellSizeOffset] = (TZrByte)sizeof(SZrTypeValue);
+    write_u32_le(buffer, versionPatchOffset, ZR_IO_SOURCE_PATCH_HAS_SEMIR_STATIC_C_TYPES);
+    assert_reader_rejects_binary(buffer, bufferLength, "predates the recorded value cell size");
+
+    remove(binaryPath);
+    free(buffer);
+    ZrCore_Function_Free(state, function);
+    ZrTests_Runtime_State_Destroy(state);
+}
+
 static void test_module_signature_hash_changes_with_module_version(void) {
     SZrState *state = ZrTests_Runtime_State_Create(ZR_NULL);
     SZrFunction *firstFunction;
@@ -2226,6 +2288,7 @@ int main(void) {
     RUN_TEST(test_module_metadata_binding_roundtrips_through_binary_and_runtime);
     RUN_TEST(test_metadata_strings_are_indexed_in_shared_heap_through_binary_and_runtime);
     RUN_TEST(test_reader_rejects_future_metadata_patch_with_version_diagnostic);
+    RUN_TEST(test_reader_rejects_frame_layout_written_for_another_value_cell);
     RUN_TEST(test_signature_hash_is_stable_and_changes_with_normalized_signature);
     RUN_TEST(test_module_signature_hash_changes_with_module_version);
     RUN_TEST(test_module_signature_hash_changes_with_union_type_def_contract);
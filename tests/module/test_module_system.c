@@ -18,6 +18,7 @@
 #include "zr_vm_core/closure.h"
 #include "zr_vm_core/module.h"
 #include "zr_vm_core/object.h"
+#include "zr_vm_core/object_shape.h"
 #include "zr_vm_core/ownership.h"
 #include "zr_vm_core/state.h"
 #include "zr_vm_core/string.h"
@@ -2269,6 +2270,170 @@ static void test_source_module_preinstalled_callable_preserves_imported_module_c
     TEST_DIVIDER();
 }
 
+static void test_startup_image_loads_imports_without_source_loader(void) {
+    static const SZrModuleFixtureSource kFixtures[] = {
+            MODULE_FIXTURE_SOURCE_TEXT(
+                    "image_dep",
+                    "scaleImpl(seed) {\n"
+                    "    return seed * 3;\n"
+                    "}\n"
+                    "pub var scale = scaleImpl;\n"),
+            MODULE_FIXTURE_SOURCE_TEXT(
+                    "image_main",
+                    "var dep = %import(\"image_dep\");\n"
+                    "\n"
+                    "pub runImage(): int {\n"
+                    "    return dep.scale(5) + 2;\n"
+                    "}\n"),
+    };
+    SZrTestTimer timer;
+    const char *testSummary = "Startup Image Loads Imports Without Source Loader";
+    const SZrModuleFixtureSource *previousFixtures = g_module_fixture_sources;
+    TZrSize previousFixtureCount = g_module_fixture_source_count;
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    {
+        SZrState *parentState = create_test_state();
+        SZrState *workerState;
+        SZrModuleStartupImage *image;
+        SZrObjectModule *module;
+        const SZrTypeValue *runExport;
+        SZrTypeValue result;
+
+        TEST_ASSERT_NOT_NULL(parentState);
+        g_module_fixture_sources = kFixtures;
+        g_module_fixture_source_count = ZR_ARRAY_COUNT(kFixtures);
+        parentState->global->sourceLoader = module_fixture_source_loader;
+        TEST_ASSERT_NOT_NULL(import_native_module(parentState, "image_main"));
+
+        image = ZrCore_Module_CaptureStartupImage(parentState,
+                                                  ZrParser_Writer_WriteBinaryBuffer,
+                                                  ZrParser_Writer_FreeBinaryBuffer);
+        TEST_ASSERT_NOT_NULL(image);
+        TEST_ASSERT_EQUAL_UINT32(2, image->entryCount);
+        TEST_ASSERT_NOT_NULL(ZrCore_Module_FindStartupImageEntry(image, "image_dep", strlen("image_dep")));
+        TEST_ASSERT_NULL(ZrCore_Module_FindStartupImageEntry(image, "zr.math", strlen("zr.math")));
+
+        // the module set did not change, so a second capture hands out the cached image.
+        {
+            SZrModuleStartupImage *again = ZrCore_Module_CaptureStartupImage(parentState,
+                                                                             ZrParser_Writer_WriteBinaryBuffer,
+                                                                             ZrParser_Writer_FreeBinaryBuffer);
+            TEST_ASSERT_EQUAL_PTR(image, again);
+            ZrCore_Module_ReleaseStartupImage(again);
+        }
+
+        // the worker has no source loader at all and must serve both modules from the image.
+        parentState->global->sourceLoader = ZR_NULL;
+        g_module_fixture_sources = previousFixtures;
+        g_module_fixture_source_count = previousFixtureCount;
+        destroy_test_state(parentState);
+
+        workerState = create_test_state();
+        TEST_ASSERT_NOT_NULL(workerState);
+        ZrCore_Module_SetStartupImage(workerState->global, image);
+        ZrCore_Module_ReleaseStartupImage(image);
+
+        module = import_native_module(workerState, "image_main");
+        TEST_ASSERT_NOT_NULL(module);
+        runExport = get_module_export_value(workerState, module, "runImage");
+        TEST_ASSERT_NOT_NULL(runExport);
+        TEST_ASSERT_TRUE(ZrLib_CallValue(workerState, runExport, ZR_NULL, ZR_NULL, 0, &result));
+        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_INT64, result.type);
+        TEST_ASSERT_EQUAL_INT64(17, result.value.nativeObject.nativeInt64);
+        TEST_ASSERT_NULL(import_native_module(workerState, "image_missing"));
+
+        destroy_test_state(workerState);
+    }
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, testSummary);
+    TEST_DIVIDER();
+}
+
+static void test_startup_image_recaptures_after_module_replacement(void) {
+    static const SZrModuleFixtureSource kFixtures[] = {
+            MODULE_FIXTURE_SOURCE_TEXT(
+                    "image_dep",
+                    "scaleImpl(seed) {\n"
+                    "    return seed * 3;\n"
+                    "}\n"
+                    "pub var scale = scaleImpl;\n"),
+            MODULE_FIXTURE_SOURCE_TEXT(
+                    "image_other",
+                    "pub runOther(): int {\n"
+                    "    return 31;\n"
+                    "}\n"),
+    };
+    SZrTestTimer timer;
+    const char *testSummary = "Startup Image Recaptures After Module Replacement";
+    const SZrModuleFixtureSource *previousFixtures = g_module_fixture_sources;
+    TZrSize previousFixtureCount = g_module_fixture_source_count;
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    {
+        SZrState *parentState = create_test_state();
+        SZrState *workerState;
+        SZrModuleStartupImage *image;
+        SZrModuleStartupImage *replaced;
+        SZrObjectModule *module;
+        const SZrTypeValue *runExport;
+        SZrTypeValue result;
+
+        TEST_ASSERT_NOT_NULL(parentState);
+        g_module_fixture_sources = kFixtures;
+        g_module_fixture_source_count = ZR_ARRAY_COUNT(kFixtures);
+        parentState->global->sourceLoader = module_fixture_source_loader;
+        TEST_ASSERT_NOT_NULL(import_native_module(parentState, "image_dep"));
+
+        image = ZrCore_Module_CaptureStartupImage(parentState,
+                                                  ZrParser_Writer_WriteBinaryBuffer,
+                                                  ZrParser_Writer_FreeBinaryBuffer);
+        TEST_ASSERT_NOT_NULL(image);
+        TEST_ASSERT_NULL(ZrCore_Module_FindStartupImageEntry(image, "image_other", strlen("image_other")));
+
+        // unloading one module and loading another keeps the module count but must still invalidate the image.
+        ZrCore_Module_RemoveFromCache(parentState, ZrCore_String_CreateFromNative(parentState, "image_dep"));
+        TEST_ASSERT_NOT_NULL(import_native_module(parentState, "image_other"));
+
+        replaced = ZrCore_Module_CaptureStartupImage(parentState,
+                                                     ZrParser_Writer_WriteBinaryBuffer,
+                                                     ZrParser_Writer_FreeBinaryBuffer);
+        TEST_ASSERT_NOT_NULL(replaced);
+        TEST_ASSERT_TRUE(replaced != image);
+        TEST_ASSERT_NOT_NULL(ZrCore_Module_FindStartupImageEntry(replaced, "image_other", strlen("image_other")));
+        ZrCore_Module_ReleaseStartupImage(image);
+
+        parentState->global->sourceLoader = ZR_NULL;
+        g_module_fixture_sources = previousFixtures;
+        g_module_fixture_source_count = previousFixtureCount;
+        destroy_test_state(parentState);
+
+        workerState = create_test_state();
+        TEST_ASSERT_NOT_NULL(workerState);
+        ZrCore_Module_SetStartupImage(workerState->global, replaced);
+        ZrCore_Module_ReleaseStartupImage(replaced);
+
+        module = import_native_module(workerState, "image_other");
+        TEST_ASSERT_NOT_NULL(module);
+        runExport = get_module_export_value(workerState, module, "runOther");
+        TEST_ASSERT_NOT_NULL(runExport);
+        TEST_ASSERT_TRUE(ZrLib_CallValue(workerState, runExport, ZR_NULL, ZR_NULL, 0, &result));
+        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_INT64, result.type);
+        TEST_ASSERT_EQUAL_INT64(31, result.value.nativeObject.nativeInt64);
+
+        destroy_test_state(workerState);
+    }
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, testSummary);
+    TEST_DIVIDER();
+}
+
 static void test_imported_function_alias_with_parameters_preserves_call_signature(void) {
     static const SZrModuleFixtureSource kFixtures[] = {
             MODULE_FIXTURE_SOURCE_TEXT(
@@ -2865,6 +3030,118 @@ static void test_binary_roundtrip_preserves_module_init_callable_metadata(void)
     TEST_DIVIDER();
 }
 
+typedef struct SZrLazyImageProbe {
+    SZrModuleFixtureReader reader;
+    TZrUInt32 closeCount;
+} SZrLazyImageProbe;
+
+static void lazy_image_probe_close(SZrState *state, TZrPtr customData) {
+    ZR_UNUSED_PARAMETER(state);
+    ((SZrLazyImageProbe *)customData)->closeCount++;
+}
+
+static SZrFunction *find_child_function_by_name(SZrFunction *function, const TZrChar *name) {
+    for (TZrUInt32 index = 0; index < function->childFunctionLength; index++) {
+        if (string_equals_cstring(function->childFunctionList[index].functionName, name)) {
+            return &function->childFunctionList[index];
+        }
+    }
+    return ZR_NULL;
+}
+
+static void test_resident_binary_defers_nested_function_bodies_until_first_call(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "Resident Binary Defers Nested Function Bodies Until First Call";
+    const TZrChar *moduleSource =
+            "addOne(value: int): int {\n"
+            "    return value + 1;\n"
+            "}\n"
+            "neverCalled(value: int): int {\n"
+            "    var total = value * 7;\n"
+            "    return total + 3;\n"
+            "}\n"
+            "return addOne(41);\n";
+    const TZrChar *binaryPath = "resident_binary_lazy_bodies.zro";
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    {
+        SZrState *state = create_test_state();
+        SZrString *sourceName;
+        SZrFunction *sourceFunction;
+        TZrByte *binaryBytes;
+        TZrSize binaryLength = 0;
+        SZrLazyImageProbe probe = {0};
+        SZrIo io;
+        SZrIoResidentImage *image;
+        SZrIoSource *sourceObject;
+        SZrFunction *runtimeFunction;
+        SZrFunction *calledChild;
+        SZrFunction *idleChild;
+        SZrTypeValue result;
+
+        TEST_ASSERT_NOT_NULL(state);
+        sourceName = ZrCore_String_Create(state, "resident_binary_lazy_bodies.zr", strlen("resident_binary_lazy_bodies.zr"));
+        sourceFunction = ZrParser_Source_Compile(state, moduleSource, strlen(moduleSource), sourceName);
+        TEST_ASSERT_NOT_NULL(sourceFunction);
+        TEST_ASSERT_TRUE(ZrParser_Writer_WriteBinaryFile(state, sourceFunction, binaryPath));
+        binaryBytes = read_test_file_bytes(binaryPath, &binaryLength);
+        TEST_ASSERT_NOT_NULL(binaryBytes);
+
+        ZrCore_Memory_RawSet(&io, 0, sizeof(io));
+        probe.reader.bytes = binaryBytes;
+        probe.reader.length = binaryLength;
+        probe.reader.consumed = ZR_FALSE;
+        ZrCore_Io_Init(state, &io, module_fixture_reader_read, lazy_image_probe_close, &probe);
+        io.isBinary = ZR_TRUE;
+        io.isResidentImage = ZR_TRUE;
+        io.borrowResidentImage = ZR_TRUE;
+        image = ZrCore_Io_ResidentImage_Adopt(state, &io);
+        TEST_ASSERT_NOT_NULL(image);
+        TEST_ASSERT_NULL(io.close);
+
+        sourceObject = ZrCore_Io_ReadSourceNew(&io);
+        TEST_ASSERT_NOT_NULL(sourceObject);
+        runtimeFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, sourceObject);
+        ZrCore_Io_ReadSourceFree(state->global, sourceObject);
+        ZrCore_Io_ResidentImage_Release(state, image);
+        TEST_ASSERT_NOT_NULL(runtimeFunction);
+        TEST_ASSERT_NULL(runtimeFunction->lazyBody);
+        // the shells still reference the image, so the loader giving up its reference must not close it
+        TEST_ASSERT_EQUAL_UINT32(0u, probe.closeCount);
+
+        calledChild = find_child_function_by_name(runtimeFunction, "addOne");
+        idleChild = find_child_function_by_name(runtimeFunction, "neverCalled");
+        TEST_ASSERT_NOT_NULL(calledChild);
+        TEST_ASSERT_NOT_NULL(idleChild);
+        TEST_ASSERT_NOT_NULL(calledChild->lazyBody);
+        TEST_ASSERT_NULL(calledChild->instructionsList);
+        TEST_ASSERT_NOT_NULL(idleChild->lazyBody);
+
+        TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, runtimeFunction, &result));
+        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_INT64, result.type);
+        TEST_ASSERT_EQUAL_INT64(42, result.value.nativeObject.nativeInt64);
+        TEST_ASSERT_NULL(calledChild->lazyBody);
+        TEST_ASSERT_NOT_NULL(calledChild->instructionsList);
+        TEST_ASSERT_NOT_NULL(idleChild->lazyBody);
+
+        ZrCore_Function_MaterializeGraph(state, runtimeFunction);
+        TEST_ASSERT_NULL(idleChild->lazyBody);
+        TEST_ASSERT_TRUE(idleChild->instructionsLength > 0u);
+
+        ZrCore_Function_Free(state, sourceFunction);
+        destroy_test_state(state);
+        TEST_ASSERT_EQUAL_UINT32(1u, probe.closeCount);
+        free(binaryBytes);
+        remove(binaryPath);
+    }
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, testSummary);
+    TEST_DIVIDER();
+}
+
 static void test_system_vm_call_module_export_executes_nested_native_export(void) {
     SZrTestTimer timer;
     const char *testSummary = "System Vm CallModuleExport Executes Nested Native Export";
@@ -2925,9 +3202,7 @@ static void test_native_vector3_constructor_binds_all_numeric_arguments_at_runti
         SZrFunction *entryFunction;
         SZrTypeValue result;
         SZrObject *vectorObject;
-        const SZrTypeValue *xValue;
-        const SZrTypeValue *yValue;
-        const SZrTypeValue *zValue;
+        const TZrFloat64 *components;
 
         TEST_ASSERT_NOT_NULL(state);
         TEST_ASSERT_TRUE(ZrVmLibMath_Register(state->global));
@@ -2944,19 +3219,210 @@ static void test_native_vector3_constructor_binds_all_numeric_arguments_at_runti
         vectorObject = ZR_CAST_OBJECT(state, result.value.object);
         TEST_ASSERT_NOT_NULL(vectorObject);
 
-        xValue = get_object_field_value(state, vectorObject, "x");
-        yValue = get_object_field_value(state, vectorObject, "y");
-        zValue = get_object_field_value(state, vectorObject, "z");
+        TEST_ASSERT_EQUAL_UINT64(3u * sizeof(TZrFloat64), vectorObject->byteStorageLength);
+        components = (const TZrFloat64 *)ZrCore_Object_GetByteStorageData(vectorObject);
+        TEST_ASSERT_NOT_NULL(components);
+        TEST_ASSERT_DOUBLE_WITHIN(0.0001, 2.0, components[0]);
+        TEST_ASSERT_DOUBLE_WITHIN(0.0001, 3.0, components[1]);
+        TEST_ASSERT_DOUBLE_WITHIN(0.0001, 4.0, components[2]);
+
+        ZrCore_Function_Free(state, entryFunction);
+        destroy_test_state(state);
+    }
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, testSummary);
+    TEST_DIVIDER();
+}
+
+static void test_native_matrix4x4_values_use_packed_float64_storage(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "Native Matrix4x4 Values Use Packed Float64 Storage";
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    {
+        SZrState *state = create_test_state();
+        const TZrChar *source =
+                "var math = %import(\"zr.math\");\n"
+                "var moved = math.Matrix4x4.translation(1.0, 2.0, 3.0);\n"
+                "var scaled = math.Matrix4x4.scale(2.0, 3.0, 4.0);\n"
+                "return moved.mulMatrix(scaled).mulMatrix(moved);\n";
+        const TZrChar *sourceNameText = "native_matrix4x4_layout_test.zr";
+        // translation(1,2,3) * scale(2,3,4) * translation(1,2,3), row-major
+        const TZrFloat64 expected[] = {2.0, 0.0, 0.0, 3.0, 0.0, 3.0, 0.0, 8.0, 0.0, 0.0, 4.0, 15.0, 0.0, 0.0, 0.0, 1.0};
+        SZrString *sourceName;
+        SZrFunction *entryFunction;
+        SZrTypeValue result;
+        SZrObject *matrixObject;
+        const TZrFloat64 *components;
+        TZrUInt32 index;
+
+        TEST_ASSERT_NOT_NULL(state);
+        TEST_ASSERT_TRUE(ZrVmLibMath_Register(state->global));
+
+        sourceName = ZrCore_String_Create(state, (TZrNativeString)sourceNameText, strlen(sourceNameText));
+        TEST_ASSERT_NOT_NULL(sourceName);
 
-        TEST_ASSERT_NOT_NULL(xValue);
-        TEST_ASSERT_NOT_NULL(yValue);
-        TEST_ASSERT_NOT_NULL(zValue);
-        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_FLOAT(xValue->type));
-        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_FLOAT(yValue->type));
-        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_FLOAT(zValue->type));
-        TEST_ASSERT_DOUBLE_WITHIN(0.0001, 2.0, xValue->value.nativeObject.nativeDouble);
-        TEST_ASSERT_DOUBLE_WITHIN(0.0001, 3.0, yValue->value.nativeObject.nativeDouble);
-        TEST_ASSERT_DOUBLE_WITHIN(0.0001, 4.0, zValue->value.nativeObject.nativeDouble);
+        entryFunction = ZrParser_Source_Compile(state, source, strlen(source), sourceName);
+        TEST_ASSERT_NOT_NULL(entryFunction);
+
+        TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, entryFunction, &result));
+        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_OBJECT, result.type);
+
+        matrixObject = ZR_CAST_OBJECT(state, result.value.object);
+        TEST_ASSERT_NOT_NULL(matrixObject);
+        TEST_ASSERT_NOT_NULL(matrixObject->prototype);
+        TEST_ASSERT_EQUAL_UINT32(16u * sizeof(TZrFloat64), matrixObject->prototype->layoutByteSize);
+        TEST_ASSERT_EQUAL_UINT32(sizeof(TZrFloat64), matrixObject->prototype->layoutByteAlign);
+        // the components live only in the packed storage; the instance carries no per-field pairs.
+        TEST_ASSERT_EQUAL_UINT64(16u * sizeof(TZrFloat64), matrixObject->byteStorageLength);
+        TEST_ASSERT_NULL(get_object_field_value(state, matrixObject, "m00"));
+        components = (const TZrFloat64 *)ZrCore_Object_GetByteStorageData(matrixObject);
+        TEST_ASSERT_NOT_NULL(components);
+        for (index = 0; index < 16u; index++) {
+            TEST_ASSERT_DOUBLE_WITHIN(0.0001, expected[index], components[index]);
+        }
+
+        ZrCore_Function_Free(state, entryFunction);
+        destroy_test_state(state);
+    }
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, testSummary);
+    TEST_DIVIDER();
+}
+
+static void test_native_math_storage_reads_see_script_field_writes(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "Native Math Storage Reads See Script Field Writes";
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    {
+        SZrState *state = create_test_state();
+        const TZrChar *source =
+                "var math = %import(\"zr.math\");\n"
+                "var m = math.Matrix4x4.translation(1.0, 2.0, 3.0);\n"
+                "m.m03 = 7.0;\n"
+                "var moved = m.mulVector(new math.Vector4(1.0, 1.0, 1.0, 1.0));\n"
+                "var c = new math.Complex(3.0, 4.0);\n"
+                "return moved.x * 100.0 + moved.y * 10.0 + c.magnitude();\n";
+        const TZrChar *sourceNameText = "native_math_storage_write_test.zr";
+        SZrString *sourceName;
+        SZrFunction *entryFunction;
+        SZrTypeValue result;
+
+        TEST_ASSERT_NOT_NULL(state);
+        TEST_ASSERT_TRUE(ZrVmLibMath_Register(state->global));
+
+        sourceName = ZrCore_String_Create(state, (TZrNativeString)sourceNameText, strlen(sourceNameText));
+        TEST_ASSERT_NOT_NULL(sourceName);
+
+        entryFunction = ZrParser_Source_Compile(state, source, strlen(source), sourceName);
+        TEST_ASSERT_NOT_NULL(entryFunction);
+
+        // the m03 setter writes storage double 3, so mulVector sees 7 there; Complex shares Vector2's width
+        TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, entryFunction, &result));
+        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_FLOAT(result.type));
+        TEST_ASSERT_DOUBLE_WITHIN(0.0001, 8.0 * 100.0 + 3.0 * 10.0 + 5.0, result.value.nativeObject.nativeDouble);
+
+        ZrCore_Function_Free(state, entryFunction);
+        destroy_test_state(state);
+    }
+
+    timer.endTime = clock();
+    TEST_PASS_CUSTOM(timer, testSummary);
+    TEST_DIVIDER();
+}
+
+static void test_native_tensor_kernels_match_reference_across_block_edges(void) {
+    SZrTestTimer timer;
+    const char *testSummary = "Native Tensor Kernels Match Reference Across Block Edges";
+
+    TEST_START(testSummary);
+    timer.startTime = clock();
+
+    {
+        // 131 x 261 crosses both matmul block edges (128 inner, 256 columns) and leaves odd vector tails.
+        enum { kRows = 9, kInner = 131, kCols = 261 };
+        SZrState *state = create_test_state();
+        const TZrChar *source =
+                "var math = %import(\"zr.math\");\n"
+                "var rows = 9;\n"
+                "var inner = 131;\n"
+                "var cols = 261;\n"
+                "var lhsData = [];\n"
+                "var rhsData = [];\n"
+                "var index = 0;\n"
+                "while (index < rows * inner) {\n"
+                "    lhsData[index] = ((index / inner) * 7 + (index % inner) * 3) % 11 - 5.0;\n"
+                "    index = index + 1;\n"
+                "}\n"
+                "index = 0;\n"
+                "while (index < inner * cols) {\n"
+                "    rhsData[index] = ((index / cols) * 5 + (index % cols) * 11) % 13 - 6.0;\n"
+                "    index = index + 1;\n"
+                "}\n"
+                "var lhs = new math.Tensor([rows, inner], lhsData);\n"
+                "var rhs = new math.Tensor([inner, cols], rhsData);\n"
+                "var product = lhs.matmul(rhs);\n"
+                "var mixed = product.add(product).sub(product.mulScalar(0.5));\n"
+                "var flipped = product.transpose2D();\n"
+                "var filled = rhs.clone().fill(2.0).reshape([cols, inner]);\n"
+                "return mixed.sum() + flipped.get([cols - 1, rows - 1]) * 3.0 + flipped.get([1, 2]) + filled.sum() +\n"
+                "       lhs.set([0, 0], 100.0).get([0, 0]);\n";
+        const TZrChar *sourceNameText = "native_tensor_kernels_test.zr";
+        SZrString *sourceName;
+        SZrFunction *entryFunction;
+        SZrTypeValue result;
+        static TZrFloat64 lhs[kRows * kInner];
+        static TZrFloat64 rhs[kInner * kCols];
+        TZrFloat64 productSum = 0.0;
+        TZrFloat64 lastProduct = 0.0;
+        TZrFloat64 probeProduct = 0.0;
+        TZrFloat64 expected;
+        int row;
+        int col;
+        int k;
+
+        for (k = 0; k < kRows * kInner; k++) {
+            lhs[k] = (TZrFloat64)(((k / kInner) * 7 + (k % kInner) * 3) % 11 - 5);
+        }
+        for (k = 0; k < kInner * kCols; k++) {
+            rhs[k] = (TZrFloat64)(((k / kCols) * 5 + (k % kCols) * 11) % 13 - 6);
+        }
+        for (row = 0; row < kRows; row++) {
+            for (col = 0; col < kCols; col++) {
+                TZrFloat64 cell = 0.0;
+                for (k = 0; k < kInner; k++) {
+                    cell += lhs[row * kInner + k] * rhs[k * kCols + col];
+                }
+                productSum += cell;
+                if (row == kRows - 1 && col == kCols - 1) {
+                    lastProduct = cell;
+                }
+                if (row == 2 && col == 1) {
+                    probeProduct = cell;
+                }
+            }
+        }
+        expected = productSum * 1.5 + lastProduct * 3.0 + probeProduct + 2.0 * kInner * kCols + 100.0;
+
+        TEST_ASSERT_NOT_NULL(state);
+        TEST_ASSERT_TRUE(ZrVmLibMath_Register(state->global));
+
+        sourceName = ZrCore_String_Create(state, (TZrNativeString)sourceNameText, strlen(sourceNameText));
+        TEST_ASSERT_NOT_NULL(sourceName);
+
+        entryFunction = ZrParser_Source_Compile(state, source, strlen(source), sourceName);
+        TEST_ASSERT_NOT_NULL(entryFunction);
+
+        TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, entryFunction, &result));
+        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_FLOAT(result.type));
+        TEST_ASSERT_DOUBLE_WITHIN(0.0001, expected, result.value.nativeObject.nativeDouble);
 
         ZrCore_Function_Free(state, entryFunction);
         destroy_test_state(state);
@@ -3463,7 +3929,15 @@ static void test_system_root_native_module_info_exposes_module_links(void) {
         TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_ARRAY, modulesValue->type);
         TEST_ASSERT_EQUAL_UINT64(0, get_array_length(ZR_CAST_OBJECT(state, functionsValue->value.object)));
         TEST_ASSERT_EQUAL_UINT64(0, get_array_length(ZR_CAST_OBJECT(state, constantsValue->value.object)));
-        TEST_ASSERT_EQUAL_UINT64(0, get_array_length(ZR_CAST_OBJECT(state, typesValue->value.object)));
+        TEST_ASSERT_EQUAL_UINT64(2, get_array_length(ZR_CAST_OBJECT(state, typesValue->value.object)));
+        TEST_ASSERT_NOT_NULL(find_named_entry_in_array(state,
+                                                       ZR_CAST_OBJECT(state, typesValue->value.object),
+                                                       "name",
+                                                       "Bytes"));
+        TEST_ASSERT_NOT_NULL(find_named_entry_in_array(state,
+                                                       ZR_CAST_OBJECT(state, typesValue->value.object),
+                                                       "name",
+                                                       "StringBuilder"));
         TEST_ASSERT_EQUAL_UINT64(ZR_ARRAY_COUNT(kExpectedModules), get_array_length(ZR_CAST_OBJECT(state, modulesValue->value.object)));
 
         for (index = 0; index < ZR_ARRAY_COUNT(kExpectedModules); index++) {
@@ -9083,6 +9557,10 @@ int main(void) {
     // 13.1 preinstalled callable 不应在 native import 期间丢失 imported module captures
     RUN_TEST(test_source_module_preinstalled_callable_preserves_imported_module_captures_after_native_imports);
 
+    // 13.2 启动镜像中的模块在没有 source loader 的 isolate 中直接加载
+    RUN_TEST(test_startup_image_loads_imports_without_source_loader);
+    RUN_TEST(test_startup_image_recaptures_after_module_replacement);
+
     // 14. 带参导出函数别名在跨模块调用时保留调用签名
     RUN_TEST(test_imported_function_alias_with_parameters_preserves_call_signature);
 
@@ -9100,12 +9578,16 @@ int main(void) {
 
     // 17. binary roundtrip 保留模块初始化 callable metadata
     RUN_TEST(test_binary_roundtrip_preserves_module_init_callable_metadata);
+    RUN_TEST(test_resident_binary_defers_nested_function_bodies_until_first_call);
 
     // 18. zr.system.vm.callModuleExport 可执行嵌套 native 导出
     RUN_TEST(test_system_vm_call_module_export_executes_nested_native_export);
 
     // 19. native Vector3 构造在 runtime 绑定全部数值参数
     RUN_TEST(test_native_vector3_constructor_binds_all_numeric_arguments_at_runtime);
+    RUN_TEST(test_native_matrix4x4_values_use_packed_float64_storage);
+    RUN_TEST(test_native_math_storage_reads_see_script_field_writes);
+    RUN_TEST(test_native_tensor_kernels_match_reference_across_block_edges);
 
     // 19. zr.system 聚合根导出叶子模块
     RUN_TEST(test_system_root_aggregates_leaf_modules_and_reuses_cached_instances);
@@ -0,0 +1,227 @@
+//
+// Loopback echo throughput benchmark: one client thread pipelines a message over every connection,
+// one server thread echoes them back, and both sides multiplex all connections through the reactor.
+//
+// usage: zr_vm_network_echo_benchmark [connections] [rounds] [payloadBytes]
+//
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zr_vm_lib_network/network.h"
+
+#if defined(_WIN32)
+#include <process.h>
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#define ZR_NETWORK_BENCH_MAX_PAYLOAD 65536u
+#define ZR_NETWORK_BENCH_TIMEOUT_MS 10000u
+
+typedef struct ZrNetworkBenchShared {
+    SZrNetworkStream *clients;
+    SZrNetworkStream *servers;
+    TZrUInt32 connections;
+    TZrUInt32 rounds;
+    TZrSize payloadBytes;
+    volatile int failed;
+} ZrNetworkBenchShared;
+
+static double zr_network_bench_now_ms(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+#endif
+}
+
+static TZrBool zr_network_bench_read_exact(SZrNetworkStream *stream, TZrByte *buffer, TZrSize length) {
+    TZrSize total = 0;
+
+    while (total < length) {
+        TZrSize received = 0;
+
+        if (!ZrNetwork_StreamRead(stream, ZR_NETWORK_BENCH_TIMEOUT_MS, buffer + total, length - total, &received)) {
+            return ZR_FALSE;
+        }
+        total += received;
+    }
+    return ZR_TRUE;
+}
+
+static void zr_network_bench_serve(ZrNetworkBenchShared *shared) {
+    TZrByte buffer[ZR_NETWORK_BENCH_MAX_PAYLOAD];
+    TZrUInt32 round;
+
+    for (round = 0; round < shared->rounds && !shared->failed; round++) {
+        TZrUInt32 index;
+
+        // the client writes in the same order, so most reads find data pending and never park.
+        for (index = 0; index < shared->connections; index++) {
+            TZrSize written = 0;
+
+            if (!zr_network_bench_read_exact(&shared->servers[index], buffer, shared->payloadBytes) ||
+                !ZrNetwork_StreamWrite(&shared->servers[index], buffer, shared->payloadBytes, &written)) {
+                shared->failed = 1;
+                return;
+            }
+        }
+    }
+}
+
+#if defined(_WIN32)
+static unsigned __stdcall zr_network_bench_server_entry(void *argument) {
+    zr_network_bench_serve((ZrNetworkBenchShared *)argument);
+    return 0;
+}
+#else
+static void *zr_network_bench_server_entry(void *argument) {
+    zr_network_bench_serve((ZrNetworkBenchShared *)argument);
+    return NULL;
+}
+#endif
+
+static TZrBool zr_network_bench_open(ZrNetworkBenchShared *shared, SZrNetworkListener *listener) {
+    SZrNetworkEndpoint endpoint;
+    TZrChar error[256];
+    TZrUInt32 index;
+
+    memset(&endpoint, 0, sizeof(endpoint));
+    strcpy(endpoint.host, "127.0.0.1");
+    if (!ZrNetwork_TcpListenerOpen(&endpoint, listener, error, sizeof(error))) {
+        fprintf(stderr, "listen failed: %s\n", error);
+        return ZR_FALSE;
+    }
+    for (index = 0; index < shared->connections; index++) {
+        if (!ZrNetwork_TcpStreamConnect(&listener->endpoint,
+                                        ZR_NETWORK_BENCH_TIMEOUT_MS,
+                                        &shared->clients[index],
+                                        error,
+                                        sizeof(error)) ||
+            !ZrNetwork_ListenerAccept(listener, ZR_NETWORK_BENCH_TIMEOUT_MS, &shared->servers[index])) {
+            fprintf(stderr, "connection %u failed: %s\n", index, error);
+            return ZR_FALSE;
+        }
+    }
+    return ZR_TRUE;
+}
+
+static int zr_network_bench_run(ZrNetworkBenchShared *shared) {
+    TZrByte payload[ZR_NETWORK_BENCH_MAX_PAYLOAD];
+    TZrByte echo[ZR_NETWORK_BENCH_MAX_PAYLOAD];
+    double startMs;
+    double elapsedMs;
+    TZrUInt64 messages;
+    TZrUInt32 round;
+#if defined(_WIN32)
+    HANDLE server;
+#else
+    pthread_t server;
+#endif
+
+    memset(payload, 0x5A, shared->payloadBytes);
+#if defined(_WIN32)
+    server = (HANDLE)_beginthreadex(NULL, 0, zr_network_bench_server_entry, shared, 0, NULL);
+#else
+    pthread_create(&server, NULL, zr_network_bench_server_entry, shared);
+#endif
+
+    startMs = zr_network_bench_now_ms();
+    for (round = 0; round < shared->rounds && !shared->failed; round++) {
+        TZrUInt32 index;
+
+        for (index = 0; index < shared->connections; index++) {
+            TZrSize written = 0;
+
+            payload[0] = (TZrByte)(round + index);
+            if (!ZrNetwork_StreamWrite(&shared->clients[index], payload, shared->payloadBytes, &written)) {
+                shared->failed = 1;
+                break;
+            }
+        }
+        for (index = 0; index < shared->connections && !shared->failed; index++) {
+            if (!zr_network_bench_read_exact(&shared->clients[index], echo, shared->payloadBytes) ||
+                echo[0] != (TZrByte)(round + index)) {
+                shared->failed = 1;
+            }
+        }
+    }
+    elapsedMs = zr_network_bench_now_ms() - startMs;
+
+#if defined(_WIN32)
+    WaitForSingleObject(server, INFINITE);
+    CloseHandle(server);
+#else
+    pthread_join(server, NULL);
+#endif
+
+    messages = (TZrUInt64)shared->connections * shared->rounds;
+    printf("backend=%s connections=%u rounds=%u payload=%llu\n",
+           ZrNetwork_Reactor_BackendName(),
+           shared->connections,
+           shared->rounds,
+           (unsigned long long)shared->payloadBytes);
+    printf("%10.2f ms %12.0f echo/s %10.2f MiB/s%s\n",
+           elapsedMs,
+           elapsedMs > 0.0 ? (double)messages * 1000.0 / elapsedMs : 0.0,
+           elapsedMs > 0.0 ? (double)messages * 2.0 * (double)shared->payloadBytes * 1000.0 / elapsedMs / 1048576.0
+                           : 0.0,
+           shared->failed ? "  ECHO FAILED" : "");
+    return shared->failed ? 1 : 0;
+}
+
+static TZrUInt64 zr_network_bench_argument(int argc, char **argv, int index, TZrUInt64 defaultValue) {
+    return argc > index ? (TZrUInt64)strtoull(argv[index], NULL, 10) : defaultValue;
+}
+
+int main(int argc, char **argv) {
+    ZrNetworkBenchShared shared;
+    SZrNetworkListener listener;
+    TZrUInt32 index;
+    int status = 1;
+
+    memset(&shared, 0, sizeof(shared));
+    memset(&listener, 0, sizeof(listener));
+    shared.connections = (TZrUInt32)zr_network_bench_argument(argc, argv, 1, 1000u);
+    shared.rounds = (TZrUInt32)zr_network_bench_argument(argc, argv, 2, 200u);
+    shared.payloadBytes = (TZrSize)zr_network_bench_argument(argc, argv, 3, 64u);
+    if (shared.connections == 0 || shared.rounds == 0 || shared.payloadBytes == 0 ||
+        shared.payloadBytes > ZR_NETWORK_BENCH_MAX_PAYLOAD) {
+        fprintf(stderr,
+                "usage: %s [connections>0] [rounds>0] [payloadBytes<=%u]\n",
+                argv[0],
+                ZR_NETWORK_BENCH_MAX_PAYLOAD);
+        return 2;
+    }
+
+    shared.clients = (SZrNetworkStream *)calloc(shared.connections, sizeof(SZrNetworkStream));
+    shared.servers = (SZrNetworkStream *)calloc(shared.connections, sizeof(SZrNetworkStream));
+    if (shared.clients != NULL && shared.servers != NULL && zr_network_bench_open(&shared, &listener)) {
+        status = zr_network_bench_run(&shared);
+    }
+
+    for (index = 0; shared.clients != NULL && shared.servers != NULL && index < shared.connections; index++) {
+        ZrNetwork_StreamClose(&shared.clients[index]);
+        ZrNetwork_StreamClose(&shared.servers[index]);
+    }
+    ZrNetwork_ListenerClose(&listener);
+    free(shared.clients);
+    free(shared.servers);
+    return status;
+}
@@ -0,0 +1,216 @@
+//
+// zr.network readiness reactor tests: non-blocking sockets, descriptors past FD_SETSIZE and the
+// cooperative idle hook used to step the coroutine scheduler.
+//
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "unity.h"
+
+#include "zr_vm_lib_network/network.h"
+
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+
+#define ZR_NETWORK_REACTOR_TEST_PAIRS 64
+
+typedef struct ZrNetworkReactorTestPair {
+    SZrNetworkStream client;
+    SZrNetworkStream server;
+} ZrNetworkReactorTestPair;
+
+typedef struct ZrNetworkReactorIdleProbe {
+    SZrNetworkStream *writer;
+    TZrUInt32 calls;
+} ZrNetworkReactorIdleProbe;
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static void open_listener(SZrNetworkListener *listener) {
+    SZrNetworkEndpoint endpoint;
+    TZrChar error[256];
+
+    memset(&endpoint, 0, sizeof(endpoint));
+    strcpy(endpoint.host, "127.0.0.1");
+    memset(listener, 0, sizeof(*listener));
+    TEST_ASSERT_TRUE_MESSAGE(ZrNetwork_TcpListenerOpen(&endpoint, listener, error, sizeof(error)), error);
+}
+
+static void connect_pair(SZrNetworkListener *listener, ZrNetworkReactorTestPair *pair) {
+    TZrChar error[256];
+
+    memset(pair, 0, sizeof(*pair));
+    TEST_ASSERT_TRUE_MESSAGE(ZrNetwork_TcpStreamConnect(&listener->endpoint, 3000, &pair->client, error, sizeof(error)),
+                             error);
+    TEST_ASSERT_TRUE(ZrNetwork_ListenerAccept(listener, 3000, &pair->server));
+}
+
+static TZrBool idle_probe_write_once(TZrPtr userData) {
+    ZrNetworkReactorIdleProbe *probe = (ZrNetworkReactorIdleProbe *)userData;
+    TZrSize written = 0;
+
+    probe->calls++;
+    if (probe->calls != 1) {
+        return ZR_FALSE;
+    }
+    // stands in for a queued coroutine that produces the data the waiter is parked on.
+    return ZrNetwork_StreamWrite(probe->writer, (const TZrByte *)"wake", 4, &written) && written == 4;
+}
+
+static void test_reactor_reports_an_event_driven_backend(void) {
+    const TZrChar *backend = ZrNetwork_Reactor_BackendName();
+
+    TEST_ASSERT_NOT_NULL(backend);
+#if defined(__linux__)
+    TEST_ASSERT_EQUAL_STRING("epoll", backend);
+#endif
+}
+
+static void test_reactor_echoes_across_many_streams_out_of_order(void) {
+    ZrNetworkReactorTestPair pairs[ZR_NETWORK_REACTOR_TEST_PAIRS];
+    SZrNetworkListener listener;
+    TZrSize index;
+
+    open_listener(&listener);
+    for (index = 0; index < ZR_NETWORK_REACTOR_TEST_PAIRS; index++) {
+        connect_pair(&listener, &pairs[index]);
+    }
+
+    // write in reverse so every read below parks on a socket whose peers already reported readiness.
+    for (index = ZR_NETWORK_REACTOR_TEST_PAIRS; index > 0; index--) {
+        TZrByte payload = (TZrByte)(index - 1);
+        TZrSize written = 0;
+
+        TEST_ASSERT_TRUE(ZrNetwork_StreamWrite(&pairs[index - 1].client, &payload, 1, &written));
+        TEST_ASSERT_EQUAL_UINT32(1, (TZrUInt32)written);
+    }
+    for (index = 0; index < ZR_NETWORK_REACTOR_TEST_PAIRS; index++) {
+        TZrByte payload = 0xFF;
+        TZrSize length = 0;
+
+        TEST_ASSERT_TRUE(ZrNetwork_StreamRead(&pairs[index].server, 3000, &payload, 1, &length));
+        TEST_ASSERT_EQUAL_UINT32(1, (TZrUInt32)length);
+        TEST_ASSERT_EQUAL_UINT8((TZrUInt8)index, payload);
+    }
+
+    for (index = 0; index < ZR_NETWORK_REACTOR_TEST_PAIRS; index++) {
+        ZrNetwork_StreamClose(&pairs[index].client);
+        ZrNetwork_StreamClose(&pairs[index].server);
+    }
+    ZrNetwork_ListenerClose(&listener);
+}
+
+static void test_reactor_times_out_and_observes_peer_close(void) {
+    ZrNetworkReactorTestPair pair;
+    SZrNetworkListener listener;
+    SZrNetworkStream pending;
+    TZrByte buffer[8];
+    TZrSize length = 0;
+
+    open_listener(&listener);
+    TEST_ASSERT_FALSE(ZrNetwork_ListenerAccept(&listener, 20, &pending));
+    connect_pair(&listener, &pair);
+
+    TEST_ASSERT_FALSE(ZrNetwork_StreamRead(&pair.server, 0, buffer, sizeof(buffer), &length));
+    TEST_ASSERT_FALSE(ZrNetwork_StreamRead(&pair.server, 20, buffer, sizeof(buffer), &length));
+    ZrNetwork_StreamClose(&pair.client);
+    TEST_ASSERT_FALSE(ZrNetwork_StreamRead(&pair.server, 3000, buffer, sizeof(buffer), &length));
+    TEST_ASSERT_EQUAL_UINT32(0, (TZrUInt32)length);
+
+    ZrNetwork_StreamClose(&pair.server);
+    ZrNetwork_ListenerClose(&listener);
+}
+
+static void test_reactor_runs_idle_hook_until_the_socket_is_ready(void) {
+    ZrNetworkReactorTestPair pair;
+    SZrNetworkListener listener;
+    ZrNetworkReactorIdleProbe probe;
+    SZrNetworkIdleHook hook;
+    SZrNetworkIdleHook previous;
+    TZrByte buffer[8];
+    TZrSize length = 0;
+    TZrBool received;
+
+    open_listener(&listener);
+    connect_pair(&listener, &pair);
+
+    memset(&probe, 0, sizeof(probe));
+    probe.writer = &pair.client;
+    hook.callback = idle_probe_write_once;
+    hook.userData = &probe;
+    previous = ZrNetwork_Reactor_SetIdleHook(hook);
+    received = ZrNetwork_StreamRead(&pair.server, 3000, buffer, sizeof(buffer), &length);
+    ZrNetwork_Reactor_SetIdleHook(previous);
+
+    TEST_ASSERT_TRUE(received);
+    TEST_ASSERT_EQUAL_UINT32(4, (TZrUInt32)length);
+    TEST_ASSERT_EQUAL_MEMORY("wake", buffer, 4);
+    TEST_ASSERT_TRUE(probe.calls >= 1);
+
+    ZrNetwork_StreamClose(&pair.client);
+    ZrNetwork_StreamClose(&pair.server);
+    ZrNetwork_ListenerClose(&listener);
+}
+
+static void test_reactor_serves_descriptors_beyond_fd_setsize(void) {
+#if defined(_WIN32)
+    TEST_IGNORE_MESSAGE("Windows sockets are not small-integer descriptors");
+#else
+    struct rlimit limit;
+    int fillers[FD_SETSIZE + 8];
+    int fillerCount = 0;
+    ZrNetworkReactorTestPair pair;
+    SZrNetworkListener listener;
+    TZrByte payload = 0x5A;
+    TZrSize length = 0;
+
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0 || limit.rlim_cur < (rlim_t)FD_SETSIZE + 64) {
+        TEST_IGNORE_MESSAGE("open file limit is too low to push descriptors past FD_SETSIZE");
+    }
+
+    // occupy the low descriptor numbers so the sockets below land where select() cannot reach.
+    while (fillerCount < (int)(sizeof(fillers) / sizeof(fillers[0]))) {
+        int filler = dup(0);
+        if (filler < 0) {
+            break;
+        }
+        fillers[fillerCount++] = filler;
+        if (filler >= FD_SETSIZE) {
+            break;
+        }
+    }
+
+    open_listener(&listener);
+    connect_pair(&listener, &pair);
+    TEST_ASSERT_TRUE(ZrNetwork_StreamWrite(&pair.client, &payload, 1, &length));
+    payload = 0;
+    TEST_ASSERT_TRUE(ZrNetwork_StreamRead(&pair.server, 3000, &payload, 1, &length));
+    TEST_ASSERT_EQUAL_UINT8(0x5A, payload);
+
+    ZrNetwork_StreamClose(&pair.client);
+    ZrNetwork_StreamClose(&pair.server);
+    ZrNetwork_ListenerClose(&listener);
+    while (fillerCount > 0) {
+        close(fillers[--fillerCount]);
+    }
+#endif
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_reactor_reports_an_event_driven_backend);
+    RUN_TEST(test_reactor_echoes_across_many_streams_out_of_order);
+    RUN_TEST(test_reactor_times_out_and_observes_peer_close);
+    RUN_TEST(test_reactor_runs_idle_hook_until_the_socket_is_ready);
+    RUN_TEST(test_reactor_serves_descriptors_beyond_fd_setsize);
+    return UNITY_END();
+}
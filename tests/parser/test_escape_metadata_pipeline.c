@@ -26,6 +26,7 @@ void test_binary_roundtrip_runtime_returned_callable_capture_preserves_closed_ca
 void test_binary_roundtrip_runtime_global_callable_capture_preserves_closed_capture_escape_flags(void);
 void test_runtime_compiled_child_functions_detach_owner_links(void);
 void test_binary_roundtrip_runtime_child_functions_detach_owner_links(void);
+void test_binary_buffer_writer_matches_file_writer_and_loads_from_memory(void);
 
 static void fixture_reader_close_noop(SZrState *state, TZrPtr customData) {
     ZR_UNUSED_PARAMETER(state);
@@ -1088,3 +1089,65 @@ void test_binary_roundtrip_runtime_global_callable_capture_preserves_closed_capt
     ZR_TEST_PASS(timer, testSummary);
     ZR_TEST_DIVIDER();
 }
+
+void test_binary_buffer_writer_matches_file_writer_and_loads_from_memory(void) {
+    SZrTestTimer timer;
+    const TZrChar *testSummary = "Binary Buffer Writer Matches File Writer And Loads From Memory";
+    const TZrChar *binaryPath = "escape_metadata_buffer_writer.zro";
+    SZrState *state;
+    SZrFunction *sourceFunction;
+    SZrFunction *runtimeFunction;
+    TZrByte *bufferBytes = ZR_NULL;
+    TZrSize bufferLength = 0;
+    TZrByte *fileBytes;
+    TZrSize fileLength = 0;
+    ZrTestsFixtureReader reader;
+    SZrIo *io;
+    SZrIoSource *sourceObject;
+
+    timer.startTime = clock();
+    ZR_TEST_START(testSummary);
+    ZR_TEST_INFO("in-memory .zro writer",
+                 "Testing that the buffer writer emits the same bytes as the file writer and that the buffer loads back without touching the filesystem");
+
+    state = ZrTests_Runtime_State_Create(ZR_NULL);
+    TEST_ASSERT_NOT_NULL(state);
+    ZrParser_ToGlobalState_Register(state);
+    TEST_ASSERT_TRUE(ZrVmLibFfi_Register(state->global));
+
+    sourceFunction = compile_escape_metadata_fixture(state);
+    TEST_ASSERT_NOT_NULL(sourceFunction);
+    TEST_ASSERT_TRUE(ZrParser_Writer_WriteBinaryBuffer(state, sourceFunction, &bufferBytes, &bufferLength));
+    TEST_ASSERT_NOT_NULL(bufferBytes);
+    TEST_ASSERT_TRUE(ZrParser_Writer_WriteBinaryFile(state, sourceFunction, binaryPath));
+
+    fileBytes = ZrTests_Fixture_ReadFileBytes(binaryPath, &fileLength);
+    TEST_ASSERT_NOT_NULL(fileBytes);
+    TEST_ASSERT_EQUAL_UINT64((TZrUInt64)fileLength, (TZrUInt64)bufferLength);
+    TEST_ASSERT_EQUAL_MEMORY(fileBytes, bufferBytes, bufferLength);
+    free(fileBytes);
+    remove(binaryPath);
+
+    reader.bytes = bufferBytes;
+    reader.length = bufferLength;
+    reader.consumed = ZR_FALSE;
+    io = ZrCore_Io_New(state->global);
+    TEST_ASSERT_NOT_NULL(io);
+    ZrCore_Io_Init(state, io, ZrTests_Fixture_ReaderRead, fixture_reader_close_noop, &reader);
+    io->isBinary = ZR_TRUE;
+    sourceObject = ZrCore_Io_ReadSourceNew(io);
+    TEST_ASSERT_NOT_NULL(sourceObject);
+    runtimeFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, sourceObject);
+    TEST_ASSERT_NOT_NULL(runtimeFunction);
+    assert_runtime_child_owner_links_detached_recursive(runtimeFunction);
+
+    ZrCore_Io_Free(state->global, io);
+    ZrParser_Writer_FreeBinaryBuffer(bufferBytes);
+    ZrCore_Function_Free(state, runtimeFunction);
+    ZrCore_Function_Free(state, sourceFunction);
+    ZrTests_Runtime_State_Destroy(state);
+
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, testSummary);
+    ZR_TEST_DIVIDER();
+}
@@ -15,6 +15,7 @@ extern void test_binary_roundtrip_runtime_returned_callable_capture_preserves_cl
 extern void test_binary_roundtrip_runtime_global_callable_capture_preserves_closed_capture_escape_flags(void);
 extern void test_runtime_compiled_child_functions_detach_owner_links(void);
 extern void test_binary_roundtrip_runtime_child_functions_detach_owner_links(void);
+extern void test_binary_buffer_writer_matches_file_writer_and_loads_from_memory(void);
 
 int main(void) {
     printf("\n");
@@ -44,6 +45,7 @@ int main(void) {
     RUN_TEST(test_binary_roundtrip_runtime_global_callable_capture_preserves_closed_capture_escape_flags);
     RUN_TEST(test_runtime_compiled_child_functions_detach_owner_links);
     RUN_TEST(test_binary_roundtrip_runtime_child_functions_detach_owner_links);
+    RUN_TEST(test_binary_buffer_writer_matches_file_writer_and_loads_from_memory);
 
     printf("\n");
     ZR_TEST_MODULE_DIVIDER();
@@ -1832,55 +1832,40 @@ static void test_execute_string_to_array_returns_utf8_bytes(void) {
         SZrState *state = create_test_state();
         SZrString *text;
         SZrString *memberName;
-        SZrString *lengthName;
         SZrTypeValue receiver;
         SZrTypeValue result;
-        SZrTypeValue lengthValue;
-        SZrTypeValue keyValue;
-        SZrTypeValue firstByteValue;
+        SZrObject *bytes;
 
         TEST_ASSERT_NOT_NULL(state);
 
         TEST_INFO("String toArray member",
-                  "Testing that string.toArray() resolves through the string prototype and exposes raw UTF-8 bytes");
+                  "Testing that string.toArray() resolves through the string prototype and copies raw UTF-8 bytes "
+                  "into a byte buffer");
 
         text = ZrCore_String_Create(state, (TZrNativeString)asciiInput, strlen(asciiInput));
         memberName = ZrCore_String_CreateFromNative(state, "toArray");
-        lengthName = ZrCore_String_CreateFromNative(state, "length");
         TEST_ASSERT_NOT_NULL(text);
         TEST_ASSERT_NOT_NULL(memberName);
-        TEST_ASSERT_NOT_NULL(lengthName);
 
         ZrCore_Value_InitAsRawObject(state, &receiver, ZR_CAST_RAW_OBJECT_AS_SUPER(text));
         ZrCore_Value_ResetAsNull(&result);
         TEST_ASSERT_TRUE(ZrCore_Object_InvokeMember(state, &receiver, memberName, ZR_NULL, 0, &result));
-        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_ARRAY, result.type);
-
-        ZrCore_Value_ResetAsNull(&lengthValue);
-        TEST_ASSERT_TRUE(ZrCore_Object_GetMember(state, &result, lengthName, &lengthValue));
-        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_INT(lengthValue.type));
-        TEST_ASSERT_EQUAL_INT64(1, lengthValue.value.nativeObject.nativeInt64);
-
-        ZrCore_Value_InitAsInt(state, &keyValue, 0);
-        ZrCore_Value_ResetAsNull(&firstByteValue);
-        TEST_ASSERT_TRUE(ZrCore_Object_GetByIndex(state, &result, &keyValue, &firstByteValue));
-        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_UNSIGNED_INT(firstByteValue.type) || ZR_VALUE_IS_TYPE_INT(firstByteValue.type));
-        TEST_ASSERT_EQUAL_INT64(65,
-                                ZR_VALUE_IS_TYPE_UNSIGNED_INT(firstByteValue.type)
-                                        ? (TZrInt64)firstByteValue.value.nativeObject.nativeUInt64
-                                        : firstByteValue.value.nativeObject.nativeInt64);
+        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_OBJECT, result.type);
+        bytes = ZR_CAST_OBJECT(state, result.value.object);
+        TEST_ASSERT_NOT_NULL(bytes->byteStorage);
+        TEST_ASSERT_EQUAL_INT64(1, (TZrInt64)bytes->byteStorageLength);
+        TEST_ASSERT_EQUAL_UINT8(65, ZrCore_Object_GetByteStorageData(bytes)[0]);
 
         text = ZrCore_String_Create(state, (TZrNativeString)utf8Input, strlen(utf8Input));
         TEST_ASSERT_NOT_NULL(text);
         ZrCore_Value_InitAsRawObject(state, &receiver, ZR_CAST_RAW_OBJECT_AS_SUPER(text));
         ZrCore_Value_ResetAsNull(&result);
         TEST_ASSERT_TRUE(ZrCore_Object_InvokeMember(state, &receiver, memberName, ZR_NULL, 0, &result));
-        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_ARRAY, result.type);
-
-        ZrCore_Value_ResetAsNull(&lengthValue);
-        TEST_ASSERT_TRUE(ZrCore_Object_GetMember(state, &result, lengthName, &lengthValue));
-        TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_INT(lengthValue.type));
-        TEST_ASSERT_EQUAL_INT64(3, lengthValue.value.nativeObject.nativeInt64);
+        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_OBJECT, result.type);
+        bytes = ZR_CAST_OBJECT(state, result.value.object);
+        TEST_ASSERT_NOT_NULL(bytes->byteStorage);
+        TEST_ASSERT_EQUAL_INT64(3, (TZrInt64)bytes->byteStorageLength);
+        TEST_ASSERT_EQUAL_MEMORY(utf8Input, ZrCore_Object_GetByteStorageData(bytes), 3);
 
         destroy_test_state(state);
     }
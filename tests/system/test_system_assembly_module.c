@@ -69,36 +69,19 @@ static TZrBool bool_value_is(const SZrTypeValue *value, TZrBool expected) {
            (value->value.nativeObject.nativeBool ? ZR_TRUE : ZR_FALSE) == expected;
 }
 
-static TZrBool array_matches_bytes(SZrState *state,
+static TZrBool bytes_value_matches(SZrState *state,
                                    const SZrTypeValue *value,
                                    const TZrByte *expected,
                                    TZrSize expectedCount) {
-    SZrObject *array;
-    TZrSize index;
+    SZrObject *bytes;
 
-    if (state == ZR_NULL || value == ZR_NULL || expected == ZR_NULL ||
-        value->type != ZR_VALUE_TYPE_ARRAY || value->value.object == ZR_NULL) {
+    if (state == ZR_NULL || value == ZR_NULL || expected == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    array = ZR_CAST_OBJECT(state, value->value.object);
-    if (array == ZR_NULL || ZrLib_Array_Length(array) != expectedCount) {
-        return ZR_FALSE;
-    }
-
-    for (index = 0; index < expectedCount; index++) {
-        const SZrTypeValue *entry = ZrLib_Array_Get(state, array, index);
-        TZrInt64 actual;
-        if (entry == ZR_NULL || !ZR_VALUE_IS_TYPE_SIGNED_INT(entry->type)) {
-            return ZR_FALSE;
-        }
-        actual = entry->value.nativeObject.nativeInt64;
-        if (actual < 0 || actual > 255 || (TZrByte)actual != expected[index]) {
-            return ZR_FALSE;
-        }
-    }
-
-    return ZR_TRUE;
+    bytes = ZrLib_Value_GetBytes(state, value);
+    return bytes != ZR_NULL && ZrLib_Bytes_Length(bytes) == expectedCount &&
+           memcmp(ZrLib_Bytes_Data(bytes), expected, expectedCount) == 0;
 }
 
 static TZrBool create_assembly_resource_fixture(TZrChar *projectPath,
@@ -272,7 +255,7 @@ static void test_system_assembly_reads_current_project_zrm_resources(void) {
                                             &argument,
                                             1,
                                             &result));
-    TEST_ASSERT_TRUE(array_matches_bytes(state, &result, resourceText, sizeof(resourceText) - 1U));
+    TEST_ASSERT_TRUE(bytes_value_matches(state, &result, resourceText, sizeof(resourceText) - 1U));
 
     ZrLibrary_CommonState_CommonGlobalState_Free(global);
 }
@@ -12,6 +12,7 @@
 #include "zr_vm_ffi_fixture_path.h"
 #include "zr_vm_core/exception.h"
 #include "zr_vm_core/function.h"
+#include "zr_vm_core/gc.h"
 #include "zr_vm_core/module.h"
 #include "zr_vm_core/object.h"
 #include "zr_vm_core/state.h"
@@ -558,6 +559,147 @@ static void test_system_fs_copy_result_supports_exists_and_read_text_separately(
     ZR_TEST_DIVIDER();
 }
 
+static void test_system_fs_source_runtime_round_trips_bytes_buffers(void) {
+    static const TZrChar *kSourceTemplate =
+            "var system = %%import(\"zr.system\");\n"
+            "var fs = %%import(\"zr.system.fs\");\n"
+            "var root = new fs.Folder(\"%s\");\n"
+            "var file = new fs.File(\"%s\");\n"
+            "root.create(true);\n"
+            "var buffer = new system.Bytes(4);\n"
+            "if (buffer.length != 4 || buffer[0] != 0) { return -1; }\n"
+            "buffer[0] = 104;\n"
+            "buffer[1] = 105;\n"
+            "buffer.fill(33, 2);\n"
+            "if (buffer.toString() != \"hi!!\") { return -2; }\n"
+            "var view = buffer.slice(1, 3);\n"
+            "if (view.length != 2 || view[0] != 105) { return -3; }\n"
+            "view[1] = 63;\n"
+            "if (buffer[2] != 63) { return -4; }\n"
+            "var encoded = system.Bytes.fromString(\"zr\");\n"
+            "if (encoded.length != 2 || encoded[1] != 114) { return -5; }\n"
+            "if (file.writeBytes(buffer) != 4) { return -6; }\n"
+            "file.appendBytes(encoded);\n"
+            "var loaded = file.readBytes();\n"
+            "if (loaded.length != 6 || loaded.toString() != \"hi?!zr\") { return -7; }\n"
+            "var stream = file.open(\"r\");\n"
+            "var head = stream.readBytes(2);\n"
+            "var tail = stream.readBytes(-1);\n"
+            "stream.close();\n"
+            "if (head.length != 2 || head[1] != 105 || tail.length != 4 || tail[3] != 114) { return -8; }\n"
+            "var copied = loaded.copy();\n"
+            "copied[0] = 72;\n"
+            "if (loaded[0] != 104 || copied.toArray()[0] != 72) { return -9; }\n"
+            "root.delete(true);\n"
+            "return 1;\n";
+    SZrTestTimer timer = {0};
+    TZrChar rootPath[ZR_TESTS_PATH_MAX];
+    TZrChar filePath[ZR_TESTS_PATH_MAX];
+    char source[8192];
+    char escapedRoot[ZR_TESTS_PATH_MAX * 2];
+    char escapedFile[ZR_TESTS_PATH_MAX * 2];
+    SZrState *state;
+    SZrFunction *entryFunction;
+    TZrInt64 result = 0;
+
+    ZR_TEST_START("zr.system.fs runtime round-trips Bytes buffers");
+    timer.startTime = clock();
+
+    TEST_ASSERT_TRUE(make_unique_test_root("bytes_buffers", rootPath, sizeof(rootPath)));
+    snprintf(filePath, sizeof(filePath), "%s/raw.bin", rootPath);
+
+    escape_for_zr_string_literal(escapedRoot, sizeof(escapedRoot), rootPath);
+    escape_for_zr_string_literal(escapedFile, sizeof(escapedFile), filePath);
+
+    snprintf(source, sizeof(source), kSourceTemplate, escapedRoot, escapedFile);
+
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+
+    entryFunction = compile_source(state, source, "system_fs_bytes_buffers_runtime.zr");
+    TEST_ASSERT_NOT_NULL(entryFunction);
+    TEST_ASSERT_TRUE(ZrTests_Function_ExecuteExpectInt64(state, entryFunction, &result));
+    TEST_ASSERT_EQUAL_INT64(1, result);
+
+    ZrCore_Function_Free(state, entryFunction);
+    destroy_test_state(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "zr.system.fs runtime round-trips Bytes buffers");
+    ZR_TEST_DIVIDER();
+}
+
+static void test_string_to_array_returns_bytes_with_live_length(void) {
+    static const TZrChar *kSource =
+            "var system = %import(\"zr.system\");\n"
+            "var raw = \"a\xE4\xB8\xAD\".toArray();\n"
+            "if (raw.length != 4 || raw[0] != 97 || raw[1] != 228) { return -1; }\n"
+            "var view = system.Bytes.fromString(\"a\xE4\xB8\xAD\").slice(1);\n"
+            "if (view.length != 3 || view[2] != 173) { return -2; }\n"
+            "var empty = \"\".toArray();\n"
+            "if (empty.length != 0 || system.Bytes.fromString(\"zr\").length != 2) { return -3; }\n"
+            "return 1;\n";
+    SZrTestTimer timer = {0};
+    SZrState *state;
+    SZrFunction *entryFunction;
+    TZrInt64 result = 0;
+
+    ZR_TEST_START("String toArray returns a Bytes buffer whose length reads the storage");
+    timer.startTime = clock();
+
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+
+    entryFunction = compile_source(state, kSource, "system_string_to_bytes_runtime.zr");
+    TEST_ASSERT_NOT_NULL(entryFunction);
+    TEST_ASSERT_TRUE(ZrTests_Function_ExecuteExpectInt64(state, entryFunction, &result));
+    TEST_ASSERT_EQUAL_INT64(1, result);
+
+    ZrCore_Function_Free(state, entryFunction);
+    destroy_test_state(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "String toArray returns a Bytes buffer whose length reads the storage");
+    ZR_TEST_DIVIDER();
+}
+
+static void test_bytes_storage_release_pays_back_gc_debt(void) {
+    SZrTestTimer timer;
+    SZrState *state;
+    SZrObject *owner;
+    SZrObject *view;
+    SZrGarbageCollector *collector;
+    TZrMemoryOffset debtBefore;
+    const TZrSize length = 64 * 1024;
+
+    ZR_TEST_START("releasing Bytes storage pays back the GC debt its allocation added");
+    timer.startTime = clock();
+
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+    owner = ZrCore_Object_New(state, ZR_NULL);
+    view = ZrCore_Object_New(state, ZR_NULL);
+    TEST_ASSERT_NOT_NULL(owner);
+    TEST_ASSERT_NOT_NULL(view);
+    ZrCore_Object_Init(state, owner);
+    ZrCore_Object_Init(state, view);
+
+    collector = state->global->garbageCollector;
+    debtBefore = collector->gcDebtSize;
+    TEST_ASSERT_TRUE(ZrCore_Object_AllocateByteStorage(state, owner, length));
+    TEST_ASSERT_TRUE(collector->gcDebtSize >= debtBefore + (TZrMemoryOffset)length);
+    TEST_ASSERT_TRUE(ZrCore_Object_ShareByteStorage(state, view, owner, 16, 32));
+
+    // a live slice view keeps the block, so nothing is paid back yet
+    ZrCore_Object_ReleaseByteStorage(state->global, owner);
+    TEST_ASSERT_TRUE(collector->gcDebtSize >= debtBefore + (TZrMemoryOffset)length);
+    ZrCore_Object_ReleaseByteStorage(state->global, view);
+    TEST_ASSERT_TRUE(collector->gcDebtSize == debtBefore);
+
+    destroy_test_state(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "releasing Bytes storage pays back the GC debt its allocation added");
+    ZR_TEST_DIVIDER();
+}
+
 static void test_system_fs_source_runtime_supports_stream_modes_and_using(void) {
     static const TZrChar *kSourceTemplate =
             "%%extern(\"%s\") {\n"
@@ -1059,6 +1201,9 @@ int main(void) {
     RUN_TEST(test_system_fs_module_metadata_exposes_object_surface_and_wrapper_fields);
     RUN_TEST(test_system_fs_source_runtime_supports_path_objects_and_directory_operations);
     RUN_TEST(test_system_fs_copy_result_supports_exists_and_read_text_separately);
+    RUN_TEST(test_system_fs_source_runtime_round_trips_bytes_buffers);
+    RUN_TEST(test_string_to_array_returns_bytes_with_live_length);
+    RUN_TEST(test_bytes_storage_release_pays_back_gc_debt);
     RUN_TEST(test_tellfd_stream_call_bytecode_and_symbol_handle_meta_probe);
     RUN_TEST(test_system_fs_source_runtime_supports_stream_modes_and_using);
     RUN_TEST(test_system_fs_source_runtime_raises_io_exception_for_missing_file);
@@ -0,0 +1,257 @@
+//
+// Concat-node long strings and zr.system.StringBuilder tests.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "unity.h"
+#include "test_support.h"
+#include "zr_vm_core/exception.h"
+#include "zr_vm_core/function.h"
+#include "zr_vm_core/hash.h"
+#include "zr_vm_core/state.h"
+#include "zr_vm_core/string.h"
+#include "zr_vm_core/value.h"
+#include "zr_vm_lib_system/module.h"
+#include "zr_vm_library.h"
+#include "zr_vm_parser.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static void test_panic_handler(SZrState *state) {
+    ZR_UNUSED_PARAMETER(state);
+}
+
+static SZrState *create_test_state(void) {
+    SZrState *state = ZrTests_State_Create(test_panic_handler);
+    if (state != ZR_NULL) {
+        ZrParser_ToGlobalState_Register(state);
+        ZrVmLibSystem_Register(state->global);
+    }
+    return state;
+}
+
+static SZrFunction *compile_source(SZrState *state, const TZrChar *source, const TZrChar *sourceNameText) {
+    SZrString *sourceName = ZrCore_String_CreateFromNative(state, (TZrNativeString)sourceNameText);
+    SZrFunction *compiled;
+
+    if (sourceName == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    compiled = ZrParser_Source_Compile(state, source, strlen(source), sourceName);
+    if (compiled == ZR_NULL && state->hasCurrentException) {
+        ZrCore_Exception_PrintUnhandled(state, &state->currentException, stderr);
+    }
+    return compiled;
+}
+
+static SZrString *create_filled_string(SZrState *state, char fill, TZrSize length) {
+    char buffer[256];
+
+    TEST_ASSERT_TRUE(length <= sizeof(buffer));
+    memset(buffer, fill, length);
+    return ZrCore_String_Create(state, buffer, length);
+}
+
+static void assert_string_bytes(const SZrString *string, const char *expected, TZrSize expectedLength) {
+    TEST_ASSERT_NOT_NULL(string);
+    TEST_ASSERT_EQUAL_UINT64((unsigned long long)expectedLength,
+                             (unsigned long long)ZrCore_String_GetByteLength(string));
+    TEST_ASSERT_EQUAL_MEMORY(expected, ZrCore_String_GetNativeString(string), expectedLength);
+    TEST_ASSERT_EQUAL_CHAR('\0', ZrCore_String_GetNativeString(string)[expectedLength]);
+}
+
+static void test_long_concat_chain_builds_nodes_with_eager_hash(void) {
+    SZrTestTimer timer = {0};
+    SZrState *state;
+    SZrString *piece;
+    SZrString *text;
+    SZrString *flat;
+    char expected[64 * 40];
+    TZrSize expectedLength = 0;
+    TZrSize index;
+
+    ZR_TEST_START("long concat chains share one append buffer and hash like flat strings");
+    timer.startTime = clock();
+
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+
+    text = create_filled_string(state, 'b', 40);
+    memset(expected, 'b', 40);
+    expectedLength = 40;
+    for (index = 0; index < 63; index++) {
+        char fill = (char)('c' + (index % 20));
+
+        piece = create_filled_string(state, fill, 40);
+        text = ZrCore_String_ConcatPair(state, text, piece);
+        memset(expected + expectedLength, fill, 40);
+        expectedLength += 40;
+    }
+
+    TEST_ASSERT_TRUE(ZrCore_String_IsConcatNode(text));
+    TEST_ASSERT_EQUAL_UINT64(ZrCore_Hash_Create(state->global, expected, expectedLength), text->super.hash);
+    assert_string_bytes(text, expected, expectedLength);
+
+    flat = ZrCore_String_Create(state, expected, expectedLength);
+    TEST_ASSERT_FALSE(ZrCore_String_IsConcatNode(flat));
+    TEST_ASSERT_TRUE(ZrCore_String_Equal(text, flat));
+
+    ZrTests_State_Destroy(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "long concat chains share one append buffer and hash like flat strings");
+    ZR_TEST_DIVIDER();
+}
+
+static void test_forked_concat_nodes_keep_their_own_contents(void) {
+    SZrTestTimer timer = {0};
+    SZrState *state;
+    SZrString *base;
+    SZrString *left;
+    SZrString *right;
+    SZrString *grown;
+    char expected[256];
+
+    ZR_TEST_START("appending to an older node copies instead of clobbering the shared tail");
+    timer.startTime = clock();
+
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+
+    base = ZrCore_String_ConcatPair(state, create_filled_string(state, 'x', 100), create_filled_string(state, 'y', 100));
+    TEST_ASSERT_TRUE(ZrCore_String_IsConcatNode(base));
+    // materialise the tip so the next append has to detach it from the shared buffer
+    TEST_ASSERT_NOT_NULL(ZrCore_String_GetNativeString(base));
+
+    left = ZrCore_String_ConcatStringAndNative(state, base, "LLLL", 4, ZR_TRUE);
+    right = ZrCore_String_ConcatStringAndNative(state, base, "RRRR", 4, ZR_TRUE);
+    grown = ZrCore_String_ConcatStringAndNative(state, left, "++", 2, ZR_TRUE);
+
+    memset(expected, 'x', 100);
+    memset(expected + 100, 'y', 100);
+    assert_string_bytes(base, expected, 200);
+    memcpy(expected + 200, "LLLL", 4);
+    assert_string_bytes(left, expected, 204);
+    memcpy(expected + 204, "++", 2);
+    assert_string_bytes(grown, expected, 206);
+    memcpy(expected + 200, "RRRR", 4);
+    assert_string_bytes(right, expected, 204);
+    TEST_ASSERT_EQUAL_UINT64(ZrCore_Hash_Create(state->global, expected, 204), right->super.hash);
+
+    ZrTests_State_Destroy(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "appending to an older node copies instead of clobbering the shared tail");
+    ZR_TEST_DIVIDER();
+}
+
+static void test_flattened_tip_pointer_survives_later_appends(void) {
+    SZrTestTimer timer = {0};
+    SZrState *state;
+    SZrString *base;
+    SZrString *text;
+    TZrNativeString held;
+    char expected[320];
+    TZrSize index;
+
+    ZR_TEST_START("a native pointer taken from the buffer tip stays valid across later appends");
+    timer.startTime = clock();
+
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+
+    base = ZrCore_String_ConcatPair(state, create_filled_string(state, 'p', 160), create_filled_string(state, 'q', 160));
+    TEST_ASSERT_TRUE(ZrCore_String_IsConcatNode(base));
+    held = ZrCore_String_GetNativeString(base);
+    TEST_ASSERT_NOT_NULL(held);
+
+    // enough appends to outgrow the block the tip was flattened into
+    text = base;
+    for (index = 0; index < 8; index++) {
+        text = ZrCore_String_ConcatPair(state, text, create_filled_string(state, (char)('r' + index), 200));
+    }
+    TEST_ASSERT_EQUAL_UINT64(320u + 8u * 200u, (unsigned long long)ZrCore_String_GetByteLength(text));
+
+    memset(expected, 'p', 160);
+    memset(expected + 160, 'q', 160);
+    TEST_ASSERT_EQUAL_PTR(held, ZrCore_String_GetNativeString(base));
+    TEST_ASSERT_EQUAL_MEMORY(expected, held, sizeof(expected));
+    TEST_ASSERT_EQUAL_CHAR('\0', held[sizeof(expected)]);
+    TEST_ASSERT_EQUAL_CHAR('y', ZrCore_String_GetNativeString(text)[320u + 7u * 200u]);
+
+    ZrTests_State_Destroy(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "a native pointer taken from the buffer tip stays valid across later appends");
+    ZR_TEST_DIVIDER();
+}
+
+static void test_string_builder_appends_and_materialises_once(void) {
+    static const TZrChar *kSource =
+            "var system = %import(\"zr.system\");\n"
+            "var sb = new system.StringBuilder(\"head:\");\n"
+            "var i = 0;\n"
+            "while (i < 200) {\n"
+            "    sb.append(i % 10);\n"
+            "    i = i + 1;\n"
+            "}\n"
+            "sb = sb + \"|\";\n"
+            "sb += 42;\n"
+            "var text = sb.toString();\n"
+            "if (sb.length() != 208) { return -1; }\n"
+            "var suffixed = sb + \"!\";\n"
+            "if (sb.length() != 208 || suffixed != text + \"!\") { return -4; }\n"
+            "var probe = new system.StringBuilder();\n"
+            "probe.append(\"ab\").append(true);\n"
+            "if (probe.toString() != \"abtrue\") { return -2; }\n"
+            "probe.clear();\n"
+            "if (probe.length() != 0 || probe.toString() != \"\") { return -3; }\n"
+            "return text;\n";
+    SZrTestTimer timer = {0};
+    SZrState *state;
+    SZrFunction *entryFunction;
+    SZrTypeValue result;
+    char expected[256];
+    TZrSize index;
+
+    ZR_TEST_START("zr.system.StringBuilder appends in place and materialises on toString");
+    timer.startTime = clock();
+
+    state = create_test_state();
+    TEST_ASSERT_NOT_NULL(state);
+
+    entryFunction = compile_source(state, kSource, "system_string_builder_runtime.zr");
+    TEST_ASSERT_NOT_NULL(entryFunction);
+    TEST_ASSERT_TRUE(ZrTests_Function_Execute(state, entryFunction, &result));
+    TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_STRING, result.type);
+
+    memcpy(expected, "head:", 5);
+    for (index = 0; index < 200; index++) {
+        expected[5 + index] = (char)('0' + (index % 10));
+    }
+    memcpy(expected + 205, "|42", 3);
+    assert_string_bytes(ZR_CAST_STRING(state, result.value.object), expected, 208);
+
+    ZrCore_Function_Free(state, entryFunction);
+    ZrTests_State_Destroy(state);
+    timer.endTime = clock();
+    ZR_TEST_PASS(timer, "zr.system.StringBuilder appends in place and materialises on toString");
+    ZR_TEST_DIVIDER();
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_long_concat_chain_builds_nodes_with_eager_hash);
+    RUN_TEST(test_forked_concat_nodes_keep_their_own_contents);
+    RUN_TEST(test_flattened_tip_pointer_survives_later_appends);
+    RUN_TEST(test_string_builder_appends_and_materialises_once);
+
+    return UNITY_END();
+}
@@ -0,0 +1,273 @@
+//
+// Task spawn/complete benchmark: runs the task_spawn_complete workload on zr.task.defaultScheduler through the
+// C API. Every round starts one fanOut task that starts four leaf tasks and awaits them in order, so a round
+// spawns five tasks and parks and wakes fanOut at least once. Reports wall time and nanoseconds per task.
+//
+// usage: zr_vm_task_spawn_complete_benchmark [rounds]
+//
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include "test_support.h"
+#include "zr_vm_core/task_runtime.h"
+#include "zr_vm_library/native_binding.h"
+#include "zr_vm_library/project.h"
+#include "zr_vm_parser.h"
+
+#define ZR_TASK_BENCH_MAX_ROUNDS 10000000u
+#define ZR_TASK_BENCH_TASKS_PER_ROUND 5u
+
+enum {
+    ZR_TASK_BENCH_EXPORT_CREATE_RUNNER = 0,
+    ZR_TASK_BENCH_EXPORT_SCHEDULER,
+    ZR_TASK_BENCH_EXPORT_MAKE_LEAF,
+    ZR_TASK_BENCH_EXPORT_FAN_OUT,
+    ZR_TASK_BENCH_EXPORT_SLOTS
+};
+
+// slots[0..3] hold the leaf handles fanOut awaits and slots[4] roots fanOut's own handle
+#define ZR_TASK_BENCH_FAN_OUT_SLOT 4
+
+static double zr_task_bench_now_ms(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+#endif
+}
+
+static SZrState *zr_task_bench_create_state(void) {
+    // autoCoroutine stays off so every round is one explicit pump of the default scheduler
+    static const char *kProjectJson =
+            "{\n"
+            "  \"name\": \"task_spawn_complete_benchmark\",\n"
+            "  \"source\": \"src\",\n"
+            "  \"binary\": \"bin\",\n"
+            "  \"entry\": \"main\",\n"
+            "  \"supportMultithread\": false,\n"
+            "  \"autoCoroutine\": false\n"
+            "}";
+    SZrState *state = ZrTests_State_Create(ZR_NULL);
+    SZrLibrary_Project *project;
+
+    if (state == ZR_NULL || state->global == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    ZrParser_ToGlobalState_Register(state);
+    if (!ZrCore_TaskRuntime_RegisterBuiltins(state->global)) {
+        ZrTests_State_Destroy(state);
+        return ZR_NULL;
+    }
+
+    project = ZrLibrary_Project_New(state,
+                                    (TZrNativeString)kProjectJson,
+                                    (TZrNativeString)"tests/fixtures/projects/hello_world/hello_world.zrp");
+    if (project == ZR_NULL) {
+        ZrTests_State_Destroy(state);
+        return ZR_NULL;
+    }
+
+    state->global->userData = project;
+    return state;
+}
+
+static void zr_task_bench_destroy_state(SZrState *state) {
+    if (state->global->userData != ZR_NULL) {
+        ZrLibrary_Project_Free(state, (SZrLibrary_Project *)state->global->userData);
+        state->global->userData = ZR_NULL;
+    }
+    ZrTests_State_Destroy(state);
+}
+
+static TZrBool zr_task_bench_invoke(SZrState *state,
+                                    SZrTypeValue *scheduler,
+                                    const char *memberName,
+                                    const SZrTypeValue *argument,
+                                    SZrTypeValue *result) {
+    SZrString *member = ZrCore_String_Create(state, (TZrNativeString)memberName, strlen(memberName));
+
+    return member != ZR_NULL && ZrCore_Object_InvokeMember(state,
+                                                           scheduler,
+                                                           member,
+                                                           argument,
+                                                           argument != ZR_NULL ? 1u : 0u,
+                                                           result);
+}
+
+static TZrInt64 zr_task_bench_leaf(TZrInt64 seed) {
+    return (seed * 31 + 7) % 1000003;
+}
+
+static TZrInt64 zr_task_bench_expected(TZrUInt32 rounds) {
+    TZrInt64 checksum = 0;
+    TZrUInt32 round;
+
+    for (round = 0; round < rounds; round++) {
+        TZrInt64 base = (TZrInt64)round * 4;
+        TZrInt64 value = (zr_task_bench_leaf(base) + zr_task_bench_leaf(base + 1) * 3 +
+                          zr_task_bench_leaf(base + 2) * 5 + zr_task_bench_leaf(base + 3) * 7) %
+                         1000003;
+
+        checksum = (checksum * 7 + value) % 1000003;
+    }
+    return checksum;
+}
+
+static TZrBool zr_task_bench_start(SZrState *state,
+                                   SZrTypeValue *createRunner,
+                                   SZrTypeValue *scheduler,
+                                   SZrTypeValue *body,
+                                   SZrObject *slots,
+                                   TZrInt64 slot,
+                                   SZrTypeValue *outHandle) {
+    SZrTypeValue runner;
+    SZrTypeValue key;
+
+    if (!ZrLib_CallValue(state, createRunner, ZR_NULL, body, 1, &runner) ||
+        !zr_task_bench_invoke(state, scheduler, "start", &runner, outHandle) ||
+        outHandle->type != ZR_VALUE_TYPE_OBJECT) {
+        return ZR_FALSE;
+    }
+    ZrLib_Value_SetInt(state, &key, slot);
+    ZrCore_Object_SetValue(state, slots, &key, outHandle);
+    return ZR_TRUE;
+}
+
+// per round: start fanOut, then its four leaves, pump once and fold fanOut's result into the checksum.
+static TZrBool zr_task_bench_rounds(SZrState *state, SZrObject *exports, TZrUInt32 rounds, TZrInt64 *outChecksum) {
+    SZrTypeValue createRunner = *ZrLib_Array_Get(state, exports, ZR_TASK_BENCH_EXPORT_CREATE_RUNNER);
+    SZrTypeValue scheduler = *ZrLib_Array_Get(state, exports, ZR_TASK_BENCH_EXPORT_SCHEDULER);
+    SZrTypeValue makeLeaf = *ZrLib_Array_Get(state, exports, ZR_TASK_BENCH_EXPORT_MAKE_LEAF);
+    SZrTypeValue fanOut = *ZrLib_Array_Get(state, exports, ZR_TASK_BENCH_EXPORT_FAN_OUT);
+    SZrObject *slots = ZR_CAST_OBJECT(state, ZrLib_Array_Get(state, exports, ZR_TASK_BENCH_EXPORT_SLOTS)->value.object);
+    TZrInt64 checksum = 0;
+    TZrUInt32 round;
+
+    for (round = 0; round < rounds; round++) {
+        SZrTypeValue fanOutHandle;
+        SZrTypeValue pumped;
+        const SZrTypeValue *result;
+        TZrInt64 leaf;
+
+        // fanOut is queued first, so it runs and parks on its first leaf before any leaf completes
+        if (!zr_task_bench_start(
+                    state, &createRunner, &scheduler, &fanOut, slots, ZR_TASK_BENCH_FAN_OUT_SLOT, &fanOutHandle)) {
+            return ZR_FALSE;
+        }
+        for (leaf = 0; leaf < 4; leaf++) {
+            SZrTypeValue seed;
+            SZrTypeValue body;
+            SZrTypeValue leafHandle;
+
+            ZrLib_Value_SetInt(state, &seed, (TZrInt64)round * 4 + leaf);
+            if (!ZrLib_CallValue(state, &makeLeaf, ZR_NULL, &seed, 1, &body) ||
+                !zr_task_bench_start(state, &createRunner, &scheduler, &body, slots, leaf, &leafHandle)) {
+                return ZR_FALSE;
+            }
+        }
+
+        if (!zr_task_bench_invoke(state, &scheduler, "pump", ZR_NULL, &pumped) ||
+            ZrCore_TaskRuntime_GetTaskStatus(state, ZR_CAST_OBJECT(state, fanOutHandle.value.object)) !=
+                    ZR_VM_TASK_STATUS_COMPLETED) {
+            return ZR_FALSE;
+        }
+        result = ZrLib_Object_GetFieldCString(
+                state, ZR_CAST_OBJECT(state, fanOutHandle.value.object), "__zr_task_result");
+        if (result == ZR_NULL || !ZR_VALUE_IS_TYPE_INT(result->type)) {
+            return ZR_FALSE;
+        }
+        checksum = (checksum * 7 + result->value.nativeObject.nativeInt64) % 1000003;
+    }
+
+    *outChecksum = checksum;
+    return ZR_TRUE;
+}
+
+int main(int argc, char **argv) {
+    // script code cannot call the generic scheduler.start yet, so the C driver starts the leaves and hands their
+    // handles to fanOut through `slots`; fanOut still awaits them in order like the %async script of the case
+    static const char *kSource =
+            "var task = %import(\"zr.task\");\n"
+            "var awaitTask = task.__awaitTask;\n"
+            "var slots = [null, null, null, null, null];\n"
+            "var makeLeaf = (seed) => {\n"
+            "    return () => { return (seed * 31 + 7) % 1000003; };\n"
+            "};\n"
+            "var fanOut = () => {\n"
+            "    return (awaitTask(slots[0]) + awaitTask(slots[1]) * 3 + awaitTask(slots[2]) * 5 +\n"
+            "            awaitTask(slots[3]) * 7) % 1000003;\n"
+            "};\n"
+            "return [task.__createTaskRunner, task.defaultScheduler, makeLeaf, fanOut, slots];\n";
+    TZrUInt32 rounds = argc > 1 ? (TZrUInt32)strtoul(argv[1], ZR_NULL, 10) : 20000u;
+    SZrState *state;
+    SZrString *sourceName;
+    SZrFunction *function;
+    SZrTypeValue exportsValue;
+    SZrObject *exports;
+    TZrInt64 checksum = 0;
+    TZrInt64 expectedChecksum;
+    double startMs;
+    double elapsedMs;
+    TZrBool ok;
+
+    if (rounds == 0 || rounds > ZR_TASK_BENCH_MAX_ROUNDS) {
+        fprintf(stderr, "usage: %s [rounds<=%u]\n", argv[0], ZR_TASK_BENCH_MAX_ROUNDS);
+        return 2;
+    }
+
+    state = zr_task_bench_create_state();
+    if (state == ZR_NULL) {
+        fprintf(stderr, "failed to create the benchmark state\n");
+        return 1;
+    }
+    sourceName = ZrCore_String_Create(state, (TZrNativeString)"task_spawn_complete_benchmark.zr", 32);
+    function = ZrParser_Source_Compile(state, kSource, strlen(kSource), sourceName);
+    if (function == ZR_NULL || !ZrTests_Runtime_Function_Execute(state, function, &exportsValue) ||
+        exportsValue.type != ZR_VALUE_TYPE_ARRAY) {
+        fprintf(stderr, "failed to load the benchmark script\n");
+        zr_task_bench_destroy_state(state);
+        return 1;
+    }
+    exports = ZR_CAST_OBJECT(state, exportsValue.value.object);
+
+    // one untimed batch warms the scheduler, the coroutine pool and the call caches
+    ok = zr_task_bench_rounds(state, exports, rounds / 10u + 1u, &checksum);
+    startMs = zr_task_bench_now_ms();
+    ok = ok && zr_task_bench_rounds(state, exports, rounds, &checksum);
+    elapsedMs = zr_task_bench_now_ms() - startMs;
+    zr_task_bench_destroy_state(state);
+    if (!ok) {
+        fprintf(stderr, "benchmark run failed\n");
+        return 1;
+    }
+
+    expectedChecksum = zr_task_bench_expected(rounds);
+    printf("rounds=%u tasks=%u\n", rounds, rounds * ZR_TASK_BENCH_TASKS_PER_ROUND);
+    printf("%10.2f ms %10.0f tasks/s %8.1f ns/task  checksum=%lld%s\n",
+           elapsedMs,
+           elapsedMs > 0.0 ? (double)rounds * ZR_TASK_BENCH_TASKS_PER_ROUND * 1000.0 / elapsedMs : 0.0,
+           elapsedMs * 1000000.0 / ((double)rounds * ZR_TASK_BENCH_TASKS_PER_ROUND),
+           (long long)checksum,
+           checksum == expectedChecksum ? "" : "  CHECKSUM MISMATCH");
+    return checksum == expectedChecksum ? 0 : 1;
+}
@@ -1265,6 +1265,186 @@ static void test_default_scheduler_property_is_readable_and_writable(void) {
     ZrTests_State_Destroy(state);
 }
 
+typedef struct {
+    SZrState *state;
+    SZrObject *exports;
+} SZrTaskSuspendFixture;
+
+static const char *kTaskSuspendFixtureSource =
+        "var task = %import(\"zr.task\");\n"
+        "var awaitTask = task.__awaitTask;\n"
+        "var slots = [null, 0];\n"
+        "var helper = (awaited) => { return awaitTask(awaited) + 1; };\n"
+        "var outer = () => {\n"
+        "    slots[1] = slots[1] * 10 + 1;\n"
+        "    var value = awaitTask(slots[0]);\n"
+        "    slots[1] = slots[1] * 10 + 4;\n"
+        "    return value * 10;\n"
+        "};\n"
+        "var inner = () => { slots[1] = slots[1] * 10 + 2; return 5; };\n"
+        "var nested = () => { slots[1] = slots[1] * 10 + 3; return helper(slots[0]) * 100; };\n"
+        "var failing = () => { slots[1] = slots[1] * 10 + 2; throw \"boom\"; };\n"
+        "return [task.__createTaskRunner, task.defaultScheduler, slots, outer, inner, nested, failing];\n";
+
+enum {
+    ZR_TASK_SUSPEND_EXPORT_CREATE_RUNNER = 0,
+    ZR_TASK_SUSPEND_EXPORT_SCHEDULER,
+    ZR_TASK_SUSPEND_EXPORT_SLOTS,
+    ZR_TASK_SUSPEND_EXPORT_OUTER,
+    ZR_TASK_SUSPEND_EXPORT_INNER,
+    ZR_TASK_SUSPEND_EXPORT_NESTED,
+    ZR_TASK_SUSPEND_EXPORT_FAILING
+};
+
+static const SZrTypeValue *task_suspend_fixture_export(SZrTaskSuspendFixture *fixture, TZrSize index) {
+    return ZrLib_Array_Get(fixture->state, fixture->exports, index);
+}
+
+static SZrObject *task_suspend_fixture_slots(SZrTaskSuspendFixture *fixture) {
+    const SZrTypeValue *slots = task_suspend_fixture_export(fixture, ZR_TASK_SUSPEND_EXPORT_SLOTS);
+
+    TEST_ASSERT_NOT_NULL(slots);
+    return ZR_CAST_OBJECT(fixture->state, slots->value.object);
+}
+
+static void task_suspend_fixture_init(SZrTaskSuspendFixture *fixture, const char *sourceName) {
+    SZrFunction *function;
+    SZrTypeValue exportsValue;
+
+    memset(fixture, 0, sizeof(*fixture));
+    // automatic pumping stays off so the test decides when queued tasks run
+    fixture->state = create_task_test_state_with_project_flags(ZR_FALSE, ZR_FALSE);
+    TEST_ASSERT_NOT_NULL(fixture->state);
+    function = compile_task_source(fixture->state, kTaskSuspendFixtureSource, sourceName);
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(fixture->state, function, &exportsValue));
+    TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_ARRAY, exportsValue.type);
+    fixture->exports = ZR_CAST_OBJECT(fixture->state, exportsValue.value.object);
+}
+
+static void task_suspend_fixture_invoke_scheduler(SZrTaskSuspendFixture *fixture,
+                                                  const char *memberName,
+                                                  const SZrTypeValue *argument,
+                                                  SZrTypeValue *result) {
+    SZrTypeValue scheduler = *task_suspend_fixture_export(fixture, ZR_TASK_SUSPEND_EXPORT_SCHEDULER);
+    SZrString *member = ZrCore_String_Create(fixture->state, (TZrNativeString)memberName, strlen(memberName));
+
+    TEST_ASSERT_TRUE(ZrCore_Object_InvokeMember(
+            fixture->state, &scheduler, member, argument, argument != ZR_NULL ? 1u : 0u, result));
+}
+
+static void task_suspend_fixture_start(SZrTaskSuspendFixture *fixture, TZrSize bodyIndex, SZrTypeValue *handle) {
+    SZrTypeValue createRunner = *task_suspend_fixture_export(fixture, ZR_TASK_SUSPEND_EXPORT_CREATE_RUNNER);
+    SZrTypeValue runner;
+
+    TEST_ASSERT_TRUE(ZrLib_CallValue(
+            fixture->state, &createRunner, ZR_NULL, task_suspend_fixture_export(fixture, bodyIndex), 1, &runner));
+    task_suspend_fixture_invoke_scheduler(fixture, "start", &runner, handle);
+    TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_OBJECT, handle->type);
+}
+
+static void task_suspend_fixture_pump(SZrTaskSuspendFixture *fixture) {
+    SZrTypeValue pumped;
+
+    task_suspend_fixture_invoke_scheduler(fixture, "pump", ZR_NULL, &pumped);
+}
+
+static void task_suspend_fixture_set_awaited(SZrTaskSuspendFixture *fixture, const SZrTypeValue *handle) {
+    SZrTypeValue key;
+
+    ZrLib_Value_SetInt(fixture->state, &key, 0);
+    ZrCore_Object_SetValue(fixture->state, task_suspend_fixture_slots(fixture), &key, handle);
+}
+
+static TZrInt64 task_suspend_fixture_int(SZrTaskSuspendFixture *fixture, const SZrTypeValue *value) {
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_TRUE(ZR_VALUE_IS_TYPE_INT(value->type));
+    ZR_UNUSED_PARAMETER(fixture);
+    return value->value.nativeObject.nativeInt64;
+}
+
+static TZrInt64 task_suspend_fixture_trace(SZrTaskSuspendFixture *fixture) {
+    return task_suspend_fixture_int(fixture, ZrLib_Array_Get(fixture->state, task_suspend_fixture_slots(fixture), 1));
+}
+
+static const SZrTypeValue *task_suspend_fixture_field(SZrTaskSuspendFixture *fixture,
+                                                      const SZrTypeValue *handle,
+                                                      const char *field) {
+    return ZrLib_Object_GetFieldCString(fixture->state, ZR_CAST_OBJECT(fixture->state, handle->value.object), field);
+}
+
+static TZrInt64 task_suspend_fixture_status(SZrTaskSuspendFixture *fixture, const SZrTypeValue *handle) {
+    return ZrCore_TaskRuntime_GetTaskStatus(fixture->state, ZR_CAST_OBJECT(fixture->state, handle->value.object));
+}
+
+static TZrInt64 task_suspend_fixture_result(SZrTaskSuspendFixture *fixture, const SZrTypeValue *handle) {
+    return task_suspend_fixture_int(fixture, task_suspend_fixture_field(fixture, handle, "__zr_task_result"));
+}
+
+static void test_await_parks_task_until_awaited_task_completes(void) {
+    SZrTaskSuspendFixture fixture;
+    SZrTypeValue outer;
+    SZrTypeValue inner;
+
+    task_suspend_fixture_init(&fixture, "task_await_parks_task_test.zr");
+    task_suspend_fixture_start(&fixture, ZR_TASK_SUSPEND_EXPORT_OUTER, &outer);
+    task_suspend_fixture_start(&fixture, ZR_TASK_SUSPEND_EXPORT_INNER, &inner);
+    task_suspend_fixture_set_awaited(&fixture, &inner);
+    task_suspend_fixture_pump(&fixture);
+
+    // outer runs first, parks on inner, and only resumes after inner completed on the same scheduler
+    TEST_ASSERT_EQUAL_INT64(124, task_suspend_fixture_trace(&fixture));
+    TEST_ASSERT_EQUAL_INT64(ZR_VM_TASK_STATUS_COMPLETED, task_suspend_fixture_status(&fixture, &inner));
+    TEST_ASSERT_EQUAL_INT64(ZR_VM_TASK_STATUS_COMPLETED, task_suspend_fixture_status(&fixture, &outer));
+    TEST_ASSERT_EQUAL_INT64(50, task_suspend_fixture_result(&fixture, &outer));
+
+    destroy_task_test_state(fixture.state);
+}
+
+static void test_await_inside_nested_call_survives_full_gc_while_parked(void) {
+    SZrTaskSuspendFixture fixture;
+    SZrTypeValue nested;
+    SZrTypeValue inner;
+    SZrTypeValue stepped;
+
+    task_suspend_fixture_init(&fixture, "task_await_nested_call_test.zr");
+    task_suspend_fixture_start(&fixture, ZR_TASK_SUSPEND_EXPORT_NESTED, &nested);
+    task_suspend_fixture_start(&fixture, ZR_TASK_SUSPEND_EXPORT_INNER, &inner);
+    task_suspend_fixture_set_awaited(&fixture, &inner);
+
+    // park the nested frame, then collect while it is only reachable from the coroutine thread
+    task_suspend_fixture_invoke_scheduler(&fixture, "step", ZR_NULL, &stepped);
+    TEST_ASSERT_EQUAL_INT64(3, task_suspend_fixture_trace(&fixture));
+    TEST_ASSERT_EQUAL_INT64(ZR_VM_TASK_STATUS_SUSPENDED, task_suspend_fixture_status(&fixture, &nested));
+    ZrCore_GarbageCollector_GcFull(fixture.state, ZR_TRUE);
+
+    task_suspend_fixture_pump(&fixture);
+    TEST_ASSERT_EQUAL_INT64(32, task_suspend_fixture_trace(&fixture));
+    TEST_ASSERT_EQUAL_INT64(ZR_VM_TASK_STATUS_COMPLETED, task_suspend_fixture_status(&fixture, &nested));
+    TEST_ASSERT_EQUAL_INT64(600, task_suspend_fixture_result(&fixture, &nested));
+
+    destroy_task_test_state(fixture.state);
+}
+
+static void test_await_propagates_fault_into_parked_task(void) {
+    SZrTaskSuspendFixture fixture;
+    SZrTypeValue outer;
+    SZrTypeValue failing;
+
+    task_suspend_fixture_init(&fixture, "task_await_fault_test.zr");
+    task_suspend_fixture_start(&fixture, ZR_TASK_SUSPEND_EXPORT_OUTER, &outer);
+    task_suspend_fixture_start(&fixture, ZR_TASK_SUSPEND_EXPORT_FAILING, &failing);
+    task_suspend_fixture_set_awaited(&fixture, &failing);
+    task_suspend_fixture_pump(&fixture);
+
+    // the resumed await rethrows the awaited fault, so outer never reaches its trailing trace step
+    TEST_ASSERT_EQUAL_INT64(12, task_suspend_fixture_trace(&fixture));
+    TEST_ASSERT_EQUAL_INT64(ZR_VM_TASK_STATUS_FAULTED, task_suspend_fixture_status(&fixture, &failing));
+    TEST_ASSERT_EQUAL_INT64(ZR_VM_TASK_STATUS_FAULTED, task_suspend_fixture_status(&fixture, &outer));
+
+    destroy_task_test_state(fixture.state);
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_project_config_defaults_enable_local_async_manual_threads_disabled);
@@ -1311,5 +1491,8 @@ int main(void) {
     RUN_TEST(test_task_runner_start_and_await_execute_with_explicit_async_return_type);
     RUN_TEST(test_coroutine_scheduler_manual_pump_executes_started_runner);
     RUN_TEST(test_default_scheduler_property_is_readable_and_writable);
+    RUN_TEST(test_await_parks_task_until_awaited_task_completes);
+    RUN_TEST(test_await_inside_nested_call_survives_full_gc_while_parked);
+    RUN_TEST(test_await_propagates_fault_into_parked_task);
     return UNITY_END();
 }
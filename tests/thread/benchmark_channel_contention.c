@@ -0,0 +1,241 @@
+//
+// Channel<T> transport contention benchmark: N producers and M consumers hammer one transport and
+// report throughput for the unbounded mutex list and the bounded lock-free ring, single and batched.
+//
+// usage: zr_vm_thread_channel_benchmark [producers] [consumers] [messagesPerProducer] [capacity] [batch]
+//
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "runtime/runtime_internal.h"
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <sched.h>
+#endif
+
+#define ZR_CHANNEL_BENCH_MAX_THREADS 64
+#define ZR_CHANNEL_BENCH_MAX_BATCH 256
+
+typedef struct ZrChannelBenchShared {
+    ZrVmTaskChannelTransport *transport;
+    TZrUInt64 messagesPerProducer;
+    TZrUInt64 totalMessages;
+    TZrSize batch;
+    volatile TZrUInt64 received;
+    volatile TZrUInt64 checksum;
+} ZrChannelBenchShared;
+
+typedef struct ZrChannelBenchWorker {
+    ZrChannelBenchShared *shared;
+    TZrUInt64 producerIndex;
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+} ZrChannelBenchWorker;
+
+static double zr_channel_bench_now_ms(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+#endif
+}
+
+static void zr_channel_bench_produce(ZrChannelBenchWorker *worker) {
+    ZrChannelBenchShared *shared = worker->shared;
+    ZrVmTaskTransportValue values[ZR_CHANNEL_BENCH_MAX_BATCH];
+    TZrUInt64 next = 0;
+
+    while (next < shared->messagesPerProducer) {
+        TZrSize count = shared->batch;
+        TZrSize sent = 0;
+        TZrSize index;
+
+        if (count > shared->messagesPerProducer - next) {
+            count = (TZrSize)(shared->messagesPerProducer - next);
+        }
+        for (index = 0; index < count; index++) {
+            values[index].kind = ZR_VM_TASK_TRANSPORT_KIND_INT;
+            values[index].as.intValue = (TZrInt64)(worker->producerIndex * shared->messagesPerProducer + next + index);
+        }
+
+        while (sent < count) {
+            EZrVmTaskChannelStatus status;
+
+            sent += zr_vm_task_channel_transport_send_many(shared->transport, values + sent, count - sent, &status);
+            if (status == ZR_VM_TASK_CHANNEL_STATUS_FULL) {
+                zr_vm_task_channel_transport_wait_not_full(shared->transport, ZR_VM_TASK_CHANNEL_SEND_WAIT_MS);
+            }
+        }
+        next += count;
+    }
+}
+
+static void zr_channel_bench_consume(ZrChannelBenchWorker *worker) {
+    ZrChannelBenchShared *shared = worker->shared;
+    ZrVmTaskTransportValue values[ZR_CHANNEL_BENCH_MAX_BATCH];
+    TZrUInt64 localSum = 0;
+
+    while (zr_vm_task_atomic_load(&shared->received) < shared->totalMessages) {
+        TZrSize count = zr_vm_task_channel_transport_recv_many(shared->transport, values, shared->batch);
+        TZrSize index;
+
+        if (count == 0) {
+#if defined(_WIN32)
+            SwitchToThread();
+#else
+            sched_yield();
+#endif
+            continue;
+        }
+        for (index = 0; index < count; index++) {
+            localSum += (TZrUInt64)values[index].as.intValue;
+        }
+        zr_vm_task_atomic_add(&shared->received, (TZrInt64)count);
+    }
+    zr_vm_task_atomic_add(&shared->checksum, (TZrInt64)localSum);
+}
+
+#if defined(_WIN32)
+static unsigned __stdcall zr_channel_bench_producer_entry(void *argument) {
+    zr_channel_bench_produce((ZrChannelBenchWorker *)argument);
+    return 0;
+}
+
+static unsigned __stdcall zr_channel_bench_consumer_entry(void *argument) {
+    zr_channel_bench_consume((ZrChannelBenchWorker *)argument);
+    return 0;
+}
+
+static void zr_channel_bench_start(ZrChannelBenchWorker *worker, unsigned(__stdcall *entry)(void *)) {
+    worker->handle = (HANDLE)_beginthreadex(ZR_NULL, 0, entry, worker, 0, ZR_NULL);
+}
+
+static void zr_channel_bench_join(ZrChannelBenchWorker *worker) {
+    WaitForSingleObject(worker->handle, INFINITE);
+    CloseHandle(worker->handle);
+}
+#else
+static void *zr_channel_bench_producer_entry(void *argument) {
+    zr_channel_bench_produce((ZrChannelBenchWorker *)argument);
+    return ZR_NULL;
+}
+
+static void *zr_channel_bench_consumer_entry(void *argument) {
+    zr_channel_bench_consume((ZrChannelBenchWorker *)argument);
+    return ZR_NULL;
+}
+
+static void zr_channel_bench_start(ZrChannelBenchWorker *worker, void *(*entry)(void *)) {
+    pthread_create(&worker->handle, ZR_NULL, entry, worker);
+}
+
+static void zr_channel_bench_join(ZrChannelBenchWorker *worker) {
+    pthread_join(worker->handle, ZR_NULL);
+}
+#endif
+
+static int zr_channel_bench_run(const char *label,
+                                TZrUInt32 producers,
+                                TZrUInt32 consumers,
+                                TZrUInt64 messagesPerProducer,
+                                TZrUInt64 capacity,
+                                TZrSize batch) {
+    ZrChannelBenchWorker workers[ZR_CHANNEL_BENCH_MAX_THREADS * 2];
+    ZrChannelBenchShared shared;
+    TZrUInt64 expectedChecksum;
+    double startMs;
+    double elapsedMs;
+    TZrUInt32 index;
+
+    memset(&shared, 0, sizeof(shared));
+    shared.transport = zr_vm_task_channel_transport_new(capacity);
+    shared.messagesPerProducer = messagesPerProducer;
+    shared.totalMessages = messagesPerProducer * producers;
+    shared.batch = batch;
+    if (shared.transport == ZR_NULL) {
+        fprintf(stderr, "%s: failed to allocate channel transport\n", label);
+        return 1;
+    }
+
+    startMs = zr_channel_bench_now_ms();
+    for (index = 0; index < consumers; index++) {
+        workers[producers + index].shared = &shared;
+        workers[producers + index].producerIndex = 0;
+        zr_channel_bench_start(&workers[producers + index], zr_channel_bench_consumer_entry);
+    }
+    for (index = 0; index < producers; index++) {
+        workers[index].shared = &shared;
+        workers[index].producerIndex = index;
+        zr_channel_bench_start(&workers[index], zr_channel_bench_producer_entry);
+    }
+    for (index = 0; index < producers + consumers; index++) {
+        zr_channel_bench_join(&workers[index]);
+    }
+    elapsedMs = zr_channel_bench_now_ms() - startMs;
+
+    // every producer sends a disjoint range of 0..total-1, so the consumers must sum to its triangle number.
+    expectedChecksum = shared.totalMessages * (shared.totalMessages - 1u) / 2u;
+    printf("%-22s capacity=%-6llu batch=%-4llu %10.2f ms %12.0f msg/s%s\n",
+           label,
+           (unsigned long long)(capacity > 0 ? shared.transport->capacity : 0),
+           (unsigned long long)batch,
+           elapsedMs,
+           elapsedMs > 0.0 ? (double)shared.totalMessages * 1000.0 / elapsedMs : 0.0,
+           shared.checksum == expectedChecksum ? "" : "  CHECKSUM MISMATCH");
+    zr_vm_task_channel_transport_free(shared.transport);
+    return shared.checksum == expectedChecksum ? 0 : 1;
+}
+
+static TZrUInt64 zr_channel_bench_argument(int argc, char **argv, int index, TZrUInt64 defaultValue) {
+    return argc > index ? (TZrUInt64)strtoull(argv[index], ZR_NULL, 10) : defaultValue;
+}
+
+int main(int argc, char **argv) {
+    TZrUInt32 producers = (TZrUInt32)zr_channel_bench_argument(argc, argv, 1, 4u);
+    TZrUInt32 consumers = (TZrUInt32)zr_channel_bench_argument(argc, argv, 2, 4u);
+    TZrUInt64 messages = zr_channel_bench_argument(argc, argv, 3, 200000u);
+    TZrUInt64 capacity = zr_channel_bench_argument(argc, argv, 4, 1024u);
+    TZrSize batch = (TZrSize)zr_channel_bench_argument(argc, argv, 5, 32u);
+    int failures = 0;
+
+    if (producers == 0 || consumers == 0 || producers > ZR_CHANNEL_BENCH_MAX_THREADS ||
+        consumers > ZR_CHANNEL_BENCH_MAX_THREADS || capacity == 0 || batch == 0 ||
+        batch > ZR_CHANNEL_BENCH_MAX_BATCH) {
+        fprintf(stderr,
+                "usage: %s [producers<=%d] [consumers<=%d] [messagesPerProducer] [capacity>0] [batch<=%d]\n",
+                argv[0],
+                ZR_CHANNEL_BENCH_MAX_THREADS,
+                ZR_CHANNEL_BENCH_MAX_THREADS,
+                ZR_CHANNEL_BENCH_MAX_BATCH);
+        return 2;
+    }
+
+    printf("producers=%u consumers=%u messagesPerProducer=%llu\n",
+           producers,
+           consumers,
+           (unsigned long long)messages);
+    failures += zr_channel_bench_run("unbounded-list", producers, consumers, messages, 0, 1);
+    failures += zr_channel_bench_run("unbounded-list-batch", producers, consumers, messages, 0, batch);
+    failures += zr_channel_bench_run("bounded-ring", producers, consumers, messages, capacity, 1);
+    failures += zr_channel_bench_run("bounded-ring-batch", producers, consumers, messages, capacity, batch);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,282 @@
+//
+// WorkStealingScheduler scaling benchmark: starts CPU-bound Send runners on 1, 2, 4, 8 and 16 worker
+// isolates and reports wall time, throughput, speedup over one worker and how many launches were stolen.
+//
+// usage: zr_vm_thread_steal_scheduler_benchmark [jobs] [iterationsPerJob]
+//
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include "test_support.h"
+#include "zr_vm_core/task_runtime.h"
+#include "zr_vm_library/project.h"
+#include "zr_vm_lib_thread/module.h"
+#include "zr_vm_lib_thread/runtime.h"
+#include "zr_vm_parser.h"
+
+#define ZR_STEAL_BENCH_MAX_JOBS 100000u
+
+typedef struct ZrStealBenchRun {
+    double elapsedMs;
+    TZrInt64 stealCount;
+    TZrBool checksumMatches;
+} ZrStealBenchRun;
+
+static double zr_steal_bench_now_ms(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+#endif
+}
+
+static SZrState *zr_steal_bench_create_state(void) {
+    static const char *kProjectJson =
+            "{\n"
+            "  \"name\": \"steal_scheduler_benchmark\",\n"
+            "  \"source\": \"src\",\n"
+            "  \"binary\": \"bin\",\n"
+            "  \"entry\": \"main\",\n"
+            "  \"supportMultithread\": true,\n"
+            "  \"autoCoroutine\": true\n"
+            "}";
+    SZrState *state = ZrTests_State_Create(ZR_NULL);
+    SZrLibrary_Project *project;
+
+    if (state == ZR_NULL || state->global == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    ZrParser_ToGlobalState_Register(state);
+    if (!ZrCore_TaskRuntime_RegisterBuiltins(state->global) || !ZrVmThread_Register(state->global)) {
+        ZrTests_State_Destroy(state);
+        return ZR_NULL;
+    }
+
+    project = ZrLibrary_Project_New(state,
+                                    (TZrNativeString)kProjectJson,
+                                    (TZrNativeString)"tests/fixtures/projects/hello_world/hello_world.zrp");
+    if (project == ZR_NULL) {
+        ZrTests_State_Destroy(state);
+        return ZR_NULL;
+    }
+
+    state->global->userData = project;
+    return state;
+}
+
+static void zr_steal_bench_destroy_state(SZrState *state) {
+    if (state->global->userData != ZR_NULL) {
+        ZrLibrary_Project_Free(state, (SZrLibrary_Project *)state->global->userData);
+        state->global->userData = ZR_NULL;
+    }
+    ZrTests_State_Destroy(state);
+}
+
+static TZrBool zr_steal_bench_invoke(SZrState *state,
+                                     SZrTypeValue *scheduler,
+                                     const char *memberName,
+                                     const SZrTypeValue *argument,
+                                     SZrTypeValue *result) {
+    SZrString *member = ZrCore_String_Create(state, (TZrNativeString)memberName, strlen(memberName));
+
+    return member != ZR_NULL && ZrCore_Object_InvokeMember(state,
+                                                           scheduler,
+                                                           member,
+                                                           argument,
+                                                           argument != ZR_NULL ? 1u : 0u,
+                                                           result);
+}
+
+static TZrInt64 zr_steal_bench_expected_job(TZrInt64 seed, TZrUInt32 iterations) {
+    TZrInt64 acc = seed;
+    TZrUInt32 index;
+
+    for (index = 0; index < iterations; index++) {
+        acc = (acc * 31 + (TZrInt64)index) % 1000003;
+    }
+    return acc;
+}
+
+// starts `jobs` runners, pumps until every completion is applied and folds the results into a checksum.
+static TZrBool zr_steal_bench_batch(SZrState *state,
+                                    SZrObject *exports,
+                                    TZrUInt32 jobs,
+                                    TZrInt64 *outChecksum) {
+    SZrTypeValue createRunner = *ZrLib_Array_Get(state, exports, 0);
+    SZrTypeValue scheduler = *ZrLib_Array_Get(state, exports, 1);
+    SZrTypeValue makeJob = *ZrLib_Array_Get(state, exports, 2);
+    SZrObject *handles = ZrLib_Array_New(state);
+    SZrTypeValue handlesValue;
+    SZrTypeValue key;
+    SZrTypeValue pumped;
+    TZrInt64 checksum = 0;
+    TZrUInt32 index;
+
+    if (handles == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // the exports array keeps the handles rooted while their launches run on the workers
+    ZrLib_Value_SetObject(state, &handlesValue, handles, ZR_VALUE_TYPE_ARRAY);
+    ZrLib_Value_SetInt(state, &key, 3);
+    ZrCore_Object_SetValue(state, exports, &key, &handlesValue);
+    for (index = 0; index < jobs; index++) {
+        SZrTypeValue seed;
+        SZrTypeValue job;
+        SZrTypeValue runner;
+        SZrTypeValue handle;
+
+        ZrLib_Value_SetInt(state, &seed, (TZrInt64)index);
+        if (!ZrLib_CallValue(state, &makeJob, ZR_NULL, &seed, 1, &job) ||
+            !ZrLib_CallValue(state, &createRunner, ZR_NULL, &job, 1, &runner) ||
+            !zr_steal_bench_invoke(state, &scheduler, "start", &runner, &handle)) {
+            return ZR_FALSE;
+        }
+        ZrLib_Value_SetInt(state, &key, (TZrInt64)index);
+        ZrCore_Object_SetValue(state, handles, &key, &handle);
+    }
+
+    if (!zr_steal_bench_invoke(state, &scheduler, "pump", ZR_NULL, &pumped)) {
+        return ZR_FALSE;
+    }
+
+    for (index = 0; index < jobs; index++) {
+        const SZrTypeValue *handle = ZrLib_Array_Get(state, handles, index);
+        const SZrTypeValue *result;
+
+        if (handle == ZR_NULL || handle->type != ZR_VALUE_TYPE_OBJECT) {
+            return ZR_FALSE;
+        }
+        result = ZrLib_Object_GetFieldCString(state, ZR_CAST_OBJECT(state, handle->value.object), "__zr_task_result");
+        if (result == ZR_NULL || !ZR_VALUE_IS_TYPE_INT(result->type)) {
+            return ZR_FALSE;
+        }
+        checksum = (checksum * 7 + result->value.nativeObject.nativeInt64) % 1000003;
+    }
+
+    *outChecksum = checksum;
+    return ZR_TRUE;
+}
+
+static TZrBool zr_steal_bench_run(TZrUInt32 workers, TZrUInt32 jobs, TZrUInt32 iterations, ZrStealBenchRun *run) {
+    static const char *kSourceTemplate =
+            "var task = %%import(\"zr.task\");\n"
+            "var thread = %%import(\"zr.thread\");\n"
+            "var scheduler = new thread.WorkStealingScheduler(%u);\n"
+            "var makeJob = (seed) => {\n"
+            "    return () => {\n"
+            "        var acc = seed;\n"
+            "        var i = 0;\n"
+            "        while (i < %u) { acc = (acc * 31 + i) %% 1000003; i = i + 1; }\n"
+            "        return acc;\n"
+            "    };\n"
+            "};\n"
+            "return [task.__createTaskRunner, scheduler, makeJob];\n";
+    char source[1024];
+    SZrState *state = zr_steal_bench_create_state();
+    SZrString *sourceName;
+    SZrFunction *function;
+    SZrTypeValue exportsValue;
+    SZrTypeValue scheduler;
+    SZrTypeValue value;
+    SZrObject *exports;
+    TZrInt64 checksum = 0;
+    TZrInt64 expectedChecksum = 0;
+    TZrUInt32 index;
+    double startMs;
+    TZrBool ok;
+
+    if (state == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    snprintf(source, sizeof(source), kSourceTemplate, workers, iterations);
+    sourceName = ZrCore_String_Create(state, (TZrNativeString)"steal_scheduler_benchmark.zr", 28);
+    function = ZrParser_Source_Compile(state, source, strlen(source), sourceName);
+    if (function == ZR_NULL || !ZrTests_Runtime_Function_Execute(state, function, &exportsValue) ||
+        exportsValue.type != ZR_VALUE_TYPE_ARRAY) {
+        zr_steal_bench_destroy_state(state);
+        return ZR_FALSE;
+    }
+    exports = ZR_CAST_OBJECT(state, exportsValue.value.object);
+    scheduler = *ZrLib_Array_Get(state, exports, 1);
+
+    // one untimed round lets every worker build its isolate and load the job function
+    ok = zr_steal_bench_batch(state, exports, workers * 2u, &checksum);
+    if (ok) {
+        startMs = zr_steal_bench_now_ms();
+        ok = zr_steal_bench_batch(state, exports, jobs, &checksum);
+        run->elapsedMs = zr_steal_bench_now_ms() - startMs;
+    }
+    ok = ok && zr_steal_bench_invoke(state, &scheduler, "stealCount", ZR_NULL, &value);
+    run->stealCount = ok ? value.value.nativeObject.nativeInt64 : 0;
+    ok = zr_steal_bench_invoke(state, &scheduler, "shutdown", ZR_NULL, &value) && ok;
+
+    for (index = 0; index < jobs; index++) {
+        expectedChecksum = (expectedChecksum * 7 + zr_steal_bench_expected_job(index, iterations)) % 1000003;
+    }
+    run->checksumMatches = checksum == expectedChecksum;
+    zr_steal_bench_destroy_state(state);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    static const TZrUInt32 kWorkerCounts[] = {1u, 2u, 4u, 8u, 16u};
+    TZrUInt32 jobs = argc > 1 ? (TZrUInt32)strtoul(argv[1], ZR_NULL, 10) : 512u;
+    TZrUInt32 iterations = argc > 2 ? (TZrUInt32)strtoul(argv[2], ZR_NULL, 10) : 20000u;
+    double baselineMs = 0.0;
+    int failures = 0;
+    size_t index;
+
+    if (jobs == 0 || jobs > ZR_STEAL_BENCH_MAX_JOBS || iterations == 0) {
+        fprintf(stderr, "usage: %s [jobs<=%u] [iterationsPerJob>0]\n", argv[0], ZR_STEAL_BENCH_MAX_JOBS);
+        return 2;
+    }
+
+    printf("jobs=%u iterationsPerJob=%u\n", jobs, iterations);
+    for (index = 0; index < sizeof(kWorkerCounts) / sizeof(kWorkerCounts[0]); index++) {
+        ZrStealBenchRun run;
+
+        memset(&run, 0, sizeof(run));
+        if (!zr_steal_bench_run(kWorkerCounts[index], jobs, iterations, &run)) {
+            fprintf(stderr, "workers=%u: benchmark run failed\n", kWorkerCounts[index]);
+            failures++;
+            continue;
+        }
+        if (index == 0) {
+            baselineMs = run.elapsedMs;
+        }
+        printf("workers=%-3u %10.2f ms %10.0f jobs/s  speedup=%5.2fx  steals=%-8lld%s\n",
+               kWorkerCounts[index],
+               run.elapsedMs,
+               run.elapsedMs > 0.0 ? (double)jobs * 1000.0 / run.elapsedMs : 0.0,
+               run.elapsedMs > 0.0 && baselineMs > 0.0 ? baselineMs / run.elapsedMs : 0.0,
+               (long long)run.stealCount,
+               run.checksumMatches ? "" : "  CHECKSUM MISMATCH");
+        if (!run.checksumMatches) {
+            failures++;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -7,6 +7,7 @@
 #include "zr_vm_library/native_registry.h"
 #include "zr_vm_library/project.h"
 #include "zr_vm_lib_thread/module.h"
+#include "zr_vm_lib_thread/runtime.h"
 #include "zr_vm_parser.h"
 #include "zr_vm_parser/compiler.h"
 #include "../../zr_vm_parser/src/zr_vm_parser/compiler/compiler_internal.h"
@@ -279,6 +280,7 @@ static void test_zr_thread_registers_public_shapes_without_legacy_mutex_or_atomi
     threadDescriptor = ZrLibrary_NativeRegistry_FindModule(state->global, "zr.thread");
     TEST_ASSERT_NOT_NULL(threadDescriptor);
     TEST_ASSERT_NOT_NULL(find_type_descriptor(threadDescriptor, "Scheduler"));
+    TEST_ASSERT_NOT_NULL(find_type_descriptor(threadDescriptor, "WorkStealingScheduler"));
     TEST_ASSERT_NOT_NULL(find_type_descriptor(threadDescriptor, "Thread"));
     TEST_ASSERT_NOT_NULL(find_type_descriptor(threadDescriptor, "Channel"));
     TEST_ASSERT_NOT_NULL(find_type_descriptor(threadDescriptor, "Shared"));
@@ -677,6 +679,36 @@ static void test_spawn_thread_requires_support_multithread(void) {
     destroy_thread_test_state(state);
 }
 
+static void test_configure_worker_pool_accepts_size_and_rejects_empty_pool(void) {
+    static const char *configureSource =
+            "var thread = %import(\"zr.thread\");\n"
+            "thread.configureWorkerPool(2, 250);\n"
+            "return 1;\n";
+    static const char *rejectSource =
+            "var thread = %import(\"zr.thread\");\n"
+            "thread.configureWorkerPool(0, 250);\n"
+            "return 1;\n";
+    SZrState *state = create_thread_test_state_with_project_flags(ZR_TRUE, ZR_TRUE);
+    SZrFunction *function;
+    SZrTypeValue result;
+    TZrInt64 value = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    function = compile_thread_source(state, configureSource, "thread_configure_worker_pool_test.zr");
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_TRUE(ZrTests_Function_ExecuteExpectInt64(state, function, &value));
+    TEST_ASSERT_EQUAL_INT64(1, value);
+
+    function = compile_thread_source(state, rejectSource, "thread_configure_worker_pool_reject_test.zr");
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_FALSE(ZrTests_Function_Execute(state, function, &result));
+
+    ZrVmThread_WorkerPool_Shutdown();
+    ZrVmThread_WorkerPool_Configure(ZR_VM_THREAD_WORKER_POOL_DEFAULT_SIZE,
+                                    ZR_VM_THREAD_WORKER_POOL_DEFAULT_IDLE_TIMEOUT_MS);
+    destroy_thread_test_state(state);
+}
+
 static void test_thread_start_and_await_execute_runner_result(void) {
     static const char *source =
             "var thread = %import(\"zr.thread\");\n"
@@ -804,6 +836,38 @@ static void test_channel_transports_value_back_from_worker_isolate(void) {
     destroy_thread_test_state(state);
 }
 
+static void test_bounded_channel_applies_backpressure_and_batches(void) {
+    static const char *source =
+            "var thread = %import(\"zr.thread\");\n"
+            "var channel = new thread.Channel<int>(3);\n"
+            "if (channel.capacity() != 4) { return 0; }\n"
+            "if (channel.trySend(1) != true) { return 0; }\n"
+            "if (channel.sendMany([2, 3, 4]) != 3) { return 0; }\n"
+            "if (channel.trySend(5) != false) { return 0; }\n"
+            "if (channel.length() != 4) { return 0; }\n"
+            "var batch = channel.recvMany(3);\n"
+            "if (batch.length != 3 || batch[0] != 1 || batch[2] != 3) { return 0; }\n"
+            "channel.send(5);\n"
+            "var rest = channel.recvMany(8);\n"
+            "if (rest.length != 2 || rest[0] != 4 || rest[1] != 5) { return 0; }\n"
+            "if (channel.recv() != null) { return 0; }\n"
+            "var unbounded = new thread.Channel<int>();\n"
+            "if (unbounded.capacity() != 0 || unbounded.sendMany([7, 8]) != 2) { return 0; }\n"
+            "if (unbounded.recvMany(1)[0] != 7 || unbounded.recv() != 8) { return 0; }\n"
+            "return 1;\n";
+    SZrState *state = create_thread_test_state_with_project_flags(ZR_TRUE, ZR_TRUE);
+    SZrFunction *function;
+    TZrInt64 result = 0;
+
+    TEST_ASSERT_NOT_NULL(state);
+    function = compile_thread_source(state, source, "thread_bounded_channel_test.zr");
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_TRUE(ZrTests_Function_ExecuteExpectInt64(state, function, &result));
+    TEST_ASSERT_EQUAL_INT64(1, result);
+
+    destroy_thread_test_state(state);
+}
+
 static void test_transfer_moves_value_into_worker_isolate_and_invalidates_source(void) {
     static const char *source =
             "var thread = %import(\"zr.thread\");\n"
@@ -993,6 +1057,112 @@ static void test_lock_guard_rejects_transfer_storage(void) {
     destroy_thread_test_state(state);
 }
 
+static const char *kStealSchedulerFixtureSource =
+        "var task = %import(\"zr.task\");\n"
+        "var thread = %import(\"zr.thread\");\n"
+        "var scheduler = new thread.WorkStealingScheduler(4);\n"
+        "var makeJob = (seed) => {\n"
+        "    return () => {\n"
+        "        var acc = seed;\n"
+        "        var i = 0;\n"
+        "        while (i < 200) { acc = (acc * 31 + i) % 1000003; i = i + 1; }\n"
+        "        return acc;\n"
+        "    };\n"
+        "};\n"
+        "return [task.__createTaskRunner, scheduler, makeJob];\n";
+
+static TZrInt64 steal_scheduler_expected_job(TZrInt64 seed) {
+    TZrInt64 acc = seed;
+    TZrInt64 i;
+
+    for (i = 0; i < 200; i++) {
+        acc = (acc * 31 + i) % 1000003;
+    }
+    return acc;
+}
+
+static void steal_scheduler_invoke(SZrState *state,
+                                   SZrTypeValue *scheduler,
+                                   const char *memberName,
+                                   const SZrTypeValue *argument,
+                                   SZrTypeValue *result) {
+    SZrString *member = ZrCore_String_Create(state, (TZrNativeString)memberName, strlen(memberName));
+
+    TEST_ASSERT_TRUE(ZrCore_Object_InvokeMember(
+            state, scheduler, member, argument, argument != ZR_NULL ? 1u : 0u, result));
+}
+
+static void test_work_stealing_scheduler_spreads_runners_over_worker_isolates(void) {
+    enum { kJobCount = 48 };
+    SZrState *state = create_thread_test_state_with_project_flags(ZR_TRUE, ZR_TRUE);
+    SZrFunction *function;
+    SZrTypeValue exportsValue;
+    SZrObject *exports;
+    SZrObject *handles;
+    SZrTypeValue createRunner;
+    SZrTypeValue scheduler;
+    SZrTypeValue makeJob;
+    SZrTypeValue handlesValue;
+    SZrTypeValue value;
+    TZrInt64 index;
+
+    TEST_ASSERT_NOT_NULL(state);
+    function = compile_thread_source(state, kStealSchedulerFixtureSource, "thread_steal_scheduler_test.zr");
+    TEST_ASSERT_NOT_NULL(function);
+    TEST_ASSERT_TRUE(ZrTests_Runtime_Function_Execute(state, function, &exportsValue));
+    TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_ARRAY, exportsValue.type);
+    exports = ZR_CAST_OBJECT(state, exportsValue.value.object);
+    createRunner = *ZrLib_Array_Get(state, exports, 0);
+    scheduler = *ZrLib_Array_Get(state, exports, 1);
+    makeJob = *ZrLib_Array_Get(state, exports, 2);
+
+    steal_scheduler_invoke(state, &scheduler, "workerCount", ZR_NULL, &value);
+    TEST_ASSERT_EQUAL_INT64(4, value.value.nativeObject.nativeInt64);
+
+    // handles live in an array owned by the exports so they stay rooted while the workers run
+    handles = ZrLib_Array_New(state);
+    TEST_ASSERT_NOT_NULL(handles);
+    ZrLib_Value_SetObject(state, &handlesValue, handles, ZR_VALUE_TYPE_ARRAY);
+    ZrLib_Value_SetInt(state, &value, 3);
+    ZrCore_Object_SetValue(state, exports, &value, &handlesValue);
+    for (index = 0; index < kJobCount; index++) {
+        SZrTypeValue seed;
+        SZrTypeValue job;
+        SZrTypeValue runner;
+        SZrTypeValue handle;
+        SZrTypeValue key;
+
+        ZrLib_Value_SetInt(state, &seed, index);
+        TEST_ASSERT_TRUE(ZrLib_CallValue(state, &makeJob, ZR_NULL, &seed, 1, &job));
+        TEST_ASSERT_TRUE(ZrLib_CallValue(state, &createRunner, ZR_NULL, &job, 1, &runner));
+        steal_scheduler_invoke(state, &scheduler, "start", &runner, &handle);
+        TEST_ASSERT_EQUAL_INT(ZR_VALUE_TYPE_OBJECT, handle.type);
+        ZrLib_Value_SetInt(state, &key, index);
+        ZrCore_Object_SetValue(state, handles, &key, &handle);
+    }
+
+    // pump keeps stepping while worker launches are pending, so every completion is applied on return
+    steal_scheduler_invoke(state, &scheduler, "pump", ZR_NULL, &value);
+    for (index = 0; index < kJobCount; index++) {
+        const SZrTypeValue *handle = ZrLib_Array_Get(state, handles, (TZrSize)index);
+        SZrObject *handleObject;
+        const SZrTypeValue *result;
+
+        TEST_ASSERT_NOT_NULL(handle);
+        handleObject = ZR_CAST_OBJECT(state, handle->value.object);
+        TEST_ASSERT_EQUAL_INT64(ZR_VM_TASK_STATUS_COMPLETED, ZrCore_TaskRuntime_GetTaskStatus(state, handleObject));
+        result = ZrLib_Object_GetFieldCString(state, handleObject, "__zr_task_result");
+        TEST_ASSERT_NOT_NULL(result);
+        TEST_ASSERT_EQUAL_INT64(steal_scheduler_expected_job(index), result->value.nativeObject.nativeInt64);
+    }
+
+    steal_scheduler_invoke(state, &scheduler, "shutdown", ZR_NULL, &value);
+    steal_scheduler_invoke(state, &scheduler, "workerCount", ZR_NULL, &value);
+    TEST_ASSERT_EQUAL_INT64(0, value.value.nativeObject.nativeInt64);
+
+    destroy_thread_test_state(state);
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_zr_thread_registers_public_shapes_without_legacy_mutex_or_atomic);
@@ -1003,11 +1173,13 @@ int main(void) {
     RUN_TEST(test_thread_start_infers_task_handle_for_local_async_runner_call);
     RUN_TEST(test_lock_guard_is_rejected_after_await_boundary);
     RUN_TEST(test_spawn_thread_requires_support_multithread);
+    RUN_TEST(test_configure_worker_pool_accepts_size_and_rejects_empty_pool);
     RUN_TEST(test_async_runner_creation_still_works_with_thread_import_present);
     RUN_TEST(test_thread_start_with_precomputed_runner_execute_runner_result);
     RUN_TEST(test_thread_start_and_await_execute_runner_result);
     RUN_TEST(test_thread_start_with_local_async_function_execute_runner_result);
     RUN_TEST(test_channel_transports_value_back_from_worker_isolate);
+    RUN_TEST(test_bounded_channel_applies_backpressure_and_batches);
     RUN_TEST(test_transfer_moves_value_into_worker_isolate_and_invalidates_source);
     RUN_TEST(test_transfer_rejects_non_send_thread_handle_payload);
     RUN_TEST(test_shared_handle_capture_roundtrips_across_worker_isolate);
@@ -1016,5 +1188,6 @@ int main(void) {
     RUN_TEST(test_unique_mutex_lock_guard_updates_value);
     RUN_TEST(test_shared_mutex_read_and_write_guards_observe_updates);
     RUN_TEST(test_lock_guard_rejects_transfer_storage);
+    RUN_TEST(test_work_stealing_scheduler_spreads_runners_over_worker_isolates);
     return UNITY_END();
 }
@@ -59,11 +59,16 @@ static ZR_FORCE_INLINE TZrUInt32 backend_aot_llvm_type_value_alignment(void) {
     return (TZrUInt32)ZR_ALIGN_SIZE;
 }
 
+// type and ownershipKind are byte tags in the compact value layout and enums in the wide one.
+static ZR_FORCE_INLINE const TZrChar *backend_aot_llvm_value_tag_type_text(void) {
+    return sizeof(TZrValueTypeTag) == 1u ? "i8" : "i32";
+}
+
 static ZR_FORCE_INLINE TZrUInt32 backend_aot_llvm_value_field_alignment(TZrUInt32 fieldIndex) {
     switch (fieldIndex) {
         case 0:
         case 4:
-            return 4u;
+            return (TZrUInt32)sizeof(TZrValueTypeTag);
         case 1:
         case 5:
         case 6:
@@ -141,12 +146,31 @@ static ZR_FORCE_INLINE TZrUInt32 backend_aot_llvm_emit_load_value_type(FILE *fil
     TZrUInt32 typePointerTemp = backend_aot_llvm_emit_value_field_pointer(file, tempCounter, valuePointerTemp, 0);
     TZrUInt32 typeTemp = backend_aot_llvm_next_temp(tempCounter);
 
+    TZrUInt32 tagTemp;
+
+    if (sizeof(TZrValueTypeTag) == sizeof(TZrUInt32)) {
+        fprintf(file,
+                "  %%t%u = load i32, ptr %%t%u, align %u\n",
+                (unsigned)typeTemp,
+                (unsigned)typePointerTemp,
+                (unsigned)backend_aot_llvm_value_field_alignment(0));
+        return typeTemp;
+    }
+
+    // callers compare the type as i32, so widen the byte tag.
+    tagTemp = backend_aot_llvm_next_temp(tempCounter);
     fprintf(file,
-            "  %%t%u = load i32, ptr %%t%u, align %u\n",
+            "  %%t%u = load %s, ptr %%t%u, align %u\n",
             (unsigned)typeTemp,
+            backend_aot_llvm_value_tag_type_text(),
             (unsigned)typePointerTemp,
             (unsigned)backend_aot_llvm_value_field_alignment(0));
-    return typeTemp;
+    fprintf(file,
+            "  %%t%u = zext %s %%t%u to i32\n",
+            (unsigned)tagTemp,
+            backend_aot_llvm_value_tag_type_text(),
+            (unsigned)typeTemp);
+    return tagTemp;
 }
 
 static ZR_FORCE_INLINE TZrUInt32 backend_aot_llvm_emit_load_value_bits(FILE *file,
@@ -180,12 +204,30 @@ static ZR_FORCE_INLINE TZrUInt32 backend_aot_llvm_emit_load_value_ownership_kind
     TZrUInt32 ownershipPointerTemp = backend_aot_llvm_emit_value_field_pointer(file, tempCounter, valuePointerTemp, 4);
     TZrUInt32 ownershipTemp = backend_aot_llvm_next_temp(tempCounter);
 
+    TZrUInt32 tagTemp;
+
+    if (sizeof(TZrOwnershipValueKindTag) == sizeof(TZrUInt32)) {
+        fprintf(file,
+                "  %%t%u = load i32, ptr %%t%u, align %u\n",
+                (unsigned)ownershipTemp,
+                (unsigned)ownershipPointerTemp,
+                (unsigned)backend_aot_llvm_value_field_alignment(4));
+        return ownershipTemp;
+    }
+
+    tagTemp = backend_aot_llvm_next_temp(tempCounter);
     fprintf(file,
-            "  %%t%u = load i32, ptr %%t%u, align %u\n",
+            "  %%t%u = load %s, ptr %%t%u, align %u\n",
             (unsigned)ownershipTemp,
+            backend_aot_llvm_value_tag_type_text(),
             (unsigned)ownershipPointerTemp,
             (unsigned)backend_aot_llvm_value_field_alignment(4));
-    return ownershipTemp;
+    fprintf(file,
+            "  %%t%u = zext %s %%t%u to i32\n",
+            (unsigned)tagTemp,
+            backend_aot_llvm_value_tag_type_text(),
+            (unsigned)ownershipTemp);
+    return tagTemp;
 }
 
 static ZR_FORCE_INLINE void backend_aot_llvm_emit_fast_set_bits(FILE *file,
@@ -210,7 +252,8 @@ static ZR_FORCE_INLINE void backend_aot_llvm_emit_fast_set_bits(FILE *file,
     ownershipWeakRefPointerTemp = backend_aot_llvm_emit_value_field_pointer(file, tempCounter, valuePointerTemp, 6);
 
     fprintf(file,
-            "  store i32 %u, ptr %%t%u, align %u\n",
+            "  store %s %u, ptr %%t%u, align %u\n",
+            backend_aot_llvm_value_tag_type_text(),
             (unsigned)valueType,
             (unsigned)typePointerTemp,
             (unsigned)backend_aot_llvm_value_field_alignment(0));
@@ -222,7 +265,8 @@ static ZR_FORCE_INLINE void backend_aot_llvm_emit_fast_set_bits(FILE *file,
     fprintf(file, "  store i8 0, ptr %%t%u, align 1\n", (unsigned)isGcPointerTemp);
     fprintf(file, "  store i8 1, ptr %%t%u, align 1\n", (unsigned)isNativePointerTemp);
     fprintf(file,
-            "  store i32 0, ptr %%t%u, align %u\n",
+            "  store %s 0, ptr %%t%u, align %u\n",
+            backend_aot_llvm_value_tag_type_text(),
             (unsigned)ownershipKindPointerTemp,
             (unsigned)backend_aot_llvm_value_field_alignment(4));
     fprintf(file,
@@ -6,6 +6,7 @@
 #include <string.h>
 
 #include "zr_vm_common/zr_version_info.h"
+#include "zr_vm_core/gc.h"
 #include "zr_vm_core/log.h"
 
 typedef enum EZrCliPrimaryMode {
@@ -70,6 +71,27 @@ static void zr_cli_command_init(SZrCliCommand *command) {
     command->coverageEnabled = ZR_FALSE;
     command->dumpBytecodeEnabled = ZR_FALSE;
     command->heapSummaryEnabled = ZR_FALSE;
+    command->jitEnabled = ZR_FALSE;
+    command->gcWorkerCount = 0;
+    command->gcBackgroundSweep = ZR_FALSE;
+    command->gcNursery = ZR_FALSE;
+}
+
+static TZrBool zr_cli_command_parse_gc_worker_count(const TZrChar *text, TZrUInt32 *outCount) {
+    char *end = ZR_NULL;
+    unsigned long value;
+
+    if (text == ZR_NULL || outCount == ZR_NULL || text[0] < '0' || text[0] > '9') {
+        return ZR_FALSE;
+    }
+
+    value = strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || value == 0ul || value > ZR_GC_PARALLEL_MARK_WORKER_MAX) {
+        return ZR_FALSE;
+    }
+
+    *outCount = (TZrUInt32)value;
+    return ZR_TRUE;
 }
 
 static TZrBool zr_cli_command_parse_execution_mode(const TZrChar *text, EZrCliExecutionMode *outMode) {
@@ -166,6 +188,10 @@ static TZrChar *zr_cli_command_format_help_text(const TZrChar *programName) {
             "  --coverage[=out]                 Collect executable line coverage data.\n"
             "  --dump-bytecode <out>            Write bytecode disassembly for the loaded entry function.\n"
             "  --heap-summary[=out]             Print or write heap and GC summary after a successful run.\n"
+            "  --jit                            Compile hot integer loops to native code (x86-64 baseline JIT).\n"
+            "  --gc-workers <n>                 Mark full and major collections with n threads (1-32).\n"
+            "  --gc-background-sweep            Free swept objects through the allocator on a background thread.\n"
+            "  --gc-nursery                     Bump-allocate young objects in eden chunks and copy survivors out.\n"
             "  --intermediate                   Also emit .zri files next to .zro outputs.\n"
             "  --emit-zrm                       Pack reachable .zro outputs and resources into a .zrm assembly.\n"
             "  --emit-aot-c                     Emit AOT C sources under the project binary directory.\n"
@@ -250,6 +276,10 @@ static TZrChar *zr_cli_command_format_help_text(const TZrChar *programName) {
              "  --coverage[=out]                 Collect executable line coverage data.\n"
              "  --dump-bytecode <out>            Write bytecode disassembly for the loaded entry function.\n"
              "  --heap-summary[=out]             Print or write heap and GC summary after a successful run.\n"
+             "  --jit                            Compile hot integer loops to native code (x86-64 baseline JIT).\n"
+             "  --gc-workers <n>                 Mark full and major collections with n threads (1-32).\n"
+             "  --gc-background-sweep            Free swept objects through the allocator on a background thread.\n"
+             "  --gc-nursery                     Bump-allocate young objects in eden chunks and copy survivors out.\n"
              "  --intermediate                   Also emit .zri files next to .zro outputs.\n"
              "  --emit-zrm                       Pack reachable .zro outputs and resources into a .zrm assembly.\n"
              "  --emit-aot-c                     Emit AOT C sources under the project binary directory.\n"
@@ -620,6 +650,34 @@ TZrBool ZrCli_Command_Parse(int argc,
             continue;
         }
 
+        if (strcmp(argument, "--jit") == 0) {
+            outCommand->jitEnabled = ZR_TRUE;
+            continue;
+        }
+
+        if (strcmp(argument, "--gc-background-sweep") == 0) {
+            outCommand->gcBackgroundSweep = ZR_TRUE;
+            continue;
+        }
+
+        if (strcmp(argument, "--gc-nursery") == 0) {
+            outCommand->gcNursery = ZR_TRUE;
+            continue;
+        }
+
+        if (strcmp(argument, "--gc-workers") == 0) {
+            if (index + 1 >= argc) {
+                zr_cli_write_error(errorBuffer, errorBufferSize, "Missing worker count after --gc-workers");
+                return ZR_FALSE;
+            }
+            if (!zr_cli_command_parse_gc_worker_count(argv[index + 1], &outCommand->gcWorkerCount)) {
+                zr_cli_write_error(errorBuffer, errorBufferSize, "Invalid --gc-workers count: %s", argv[index + 1]);
+                return ZR_FALSE;
+            }
+            index += 1;
+            continue;
+        }
+
         if (strcmp(argument, "--execution-mode") == 0) {
             if (index + 1 >= argc) {
                 zr_cli_write_error(errorBuffer, errorBufferSize, "Missing execution mode after --execution-mode");
@@ -693,7 +751,9 @@ TZrBool ZrCli_Command_Parse(int argc,
             outCommand->emitExecutedVia ||
             outCommand->debugEnabled || outCommand->debugWait || outCommand->debugPrintEndpoint ||
             outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-            outCommand->heapSummaryEnabled ||
+            outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+            outCommand->gcBackgroundSweep ||
+            outCommand->gcNursery ||
             outCommand->debugAddress != ZR_NULL || outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP ||
             outCommand->moduleName != ZR_NULL || outCommand->programArgCount > 0) {
             zr_cli_write_error(errorBuffer, errorBufferSize, "--help cannot be combined with other options");
@@ -710,7 +770,9 @@ TZrBool ZrCli_Command_Parse(int argc,
             outCommand->emitExecutedVia ||
             outCommand->debugEnabled || outCommand->debugWait || outCommand->debugPrintEndpoint ||
             outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-            outCommand->heapSummaryEnabled ||
+            outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+            outCommand->gcBackgroundSweep ||
+            outCommand->gcNursery ||
             outCommand->debugAddress != ZR_NULL || outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP ||
             outCommand->moduleName != ZR_NULL || outCommand->programArgCount > 0) {
             zr_cli_write_error(errorBuffer, errorBufferSize, "--version cannot be combined with other options");
@@ -742,7 +804,9 @@ TZrBool ZrCli_Command_Parse(int argc,
          outCommand->emitExecutedVia ||
          outCommand->debugEnabled || outCommand->debugWait || outCommand->debugPrintEndpoint ||
          outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-         outCommand->heapSummaryEnabled ||
+         outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+         outCommand->gcBackgroundSweep ||
+         outCommand->gcNursery ||
          outCommand->debugAddress != ZR_NULL || outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP ||
          outCommand->moduleName != ZR_NULL || compileSeen || explicitProjectSeen)) {
         zr_cli_write_error(errorBuffer,
@@ -757,7 +821,9 @@ TZrBool ZrCli_Command_Parse(int argc,
          outCommand->emitExecutedVia ||
          outCommand->debugEnabled || outCommand->debugWait || outCommand->debugPrintEndpoint ||
          outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-         outCommand->heapSummaryEnabled ||
+         outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+         outCommand->gcBackgroundSweep ||
+         outCommand->gcNursery ||
          outCommand->debugAddress != ZR_NULL || outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP ||
          outCommand->moduleName != ZR_NULL || outCommand->programArgCount > 0 ||
          compileSeen || explicitProjectSeen || positionalSeen)) {
@@ -773,7 +839,9 @@ TZrBool ZrCli_Command_Parse(int argc,
          outCommand->emitExecutedVia ||
          outCommand->debugEnabled || outCommand->debugWait || outCommand->debugPrintEndpoint ||
          outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-         outCommand->heapSummaryEnabled ||
+         outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+         outCommand->gcBackgroundSweep ||
+         outCommand->gcNursery ||
          outCommand->debugAddress != ZR_NULL || outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP ||
          outCommand->moduleName != ZR_NULL || outCommand->programArgCount > 0 ||
          compileSeen || explicitProjectSeen || positionalSeen)) {
@@ -789,7 +857,9 @@ TZrBool ZrCli_Command_Parse(int argc,
          outCommand->emitExecutedVia ||
          outCommand->debugEnabled || outCommand->debugWait || outCommand->debugPrintEndpoint ||
          outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-         outCommand->heapSummaryEnabled ||
+         outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+         outCommand->gcBackgroundSweep ||
+         outCommand->gcNursery ||
          outCommand->debugAddress != ZR_NULL || outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP ||
          outCommand->moduleName != ZR_NULL || outCommand->programArgCount > 0 ||
          compileSeen || explicitProjectSeen || positionalSeen)) {
@@ -802,22 +872,26 @@ TZrBool ZrCli_Command_Parse(int argc,
     if (compileSeen && !outCommand->runAfterCompile &&
         (outCommand->emitExecutedVia || outCommand->debugEnabled ||
          outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-         outCommand->heapSummaryEnabled ||
+         outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+         outCommand->gcBackgroundSweep ||
+         outCommand->gcNursery ||
          outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP || outCommand->programArgCount > 0)) {
         zr_cli_write_error(errorBuffer,
                            errorBufferSize,
-                           "--execution-mode, --emit-executed-via, --debug, --profile, --coverage, --dump-bytecode, --heap-summary, and user program arguments require an active run path");
+                           "--execution-mode, --emit-executed-via, --debug, --profile, --coverage, --dump-bytecode, --heap-summary, --jit, --gc-workers, --gc-background-sweep, --gc-nursery, and user program arguments require an active run path");
         return ZR_FALSE;
     }
 
     if (primaryMode == ZR_CLI_PRIMARY_MODE_NONE &&
         (outCommand->emitExecutedVia || outCommand->debugEnabled ||
          outCommand->profileEnabled || outCommand->coverageEnabled || outCommand->dumpBytecodeEnabled ||
-         outCommand->heapSummaryEnabled ||
+         outCommand->heapSummaryEnabled || outCommand->jitEnabled || outCommand->gcWorkerCount != 0 ||
+         outCommand->gcBackgroundSweep ||
+         outCommand->gcNursery ||
          outCommand->executionMode != ZR_CLI_EXECUTION_MODE_INTERP || outCommand->programArgCount > 0)) {
         zr_cli_write_error(errorBuffer,
                            errorBufferSize,
-                           "--execution-mode, --emit-executed-via, --debug, --profile, --coverage, --dump-bytecode, --heap-summary, and user program arguments require a project run path");
+                           "--execution-mode, --emit-executed-via, --debug, --profile, --coverage, --dump-bytecode, --heap-summary, --jit, --gc-workers, --gc-background-sweep, --gc-nursery, and user program arguments require a project run path");
         return ZR_FALSE;
     }
 
@@ -55,6 +55,11 @@ typedef struct SZrCliCommand {
     TZrBool coverageEnabled;
     TZrBool dumpBytecodeEnabled;
     TZrBool heapSummaryEnabled;
+    TZrBool jitEnabled;
+    // 0 keeps the collector default; otherwise forwarded to ZrCore_GarbageCollector_SetWorkerCount.
+    TZrUInt32 gcWorkerCount;
+    TZrBool gcBackgroundSweep;
+    TZrBool gcNursery;
 } SZrCliCommand;
 
 TZrBool ZrCli_Command_Parse(int argc,
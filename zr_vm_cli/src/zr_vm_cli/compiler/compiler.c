@@ -340,16 +340,15 @@ static TZrBool zr_cli_load_binary_function(SZrState *state, const TZrChar *path,
         return ZR_FALSE;
     }
 
+    io.borrowResidentImage = ZR_TRUE;
     ioSource = ZrCore_Io_ReadSourceNew(&io);
+    if (ioSource != ZR_NULL) {
+        *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, ioSource);
+        ZrCore_Io_ReadSourceFree(state->global, ioSource);
+    }
     if (io.close != ZR_NULL) {
         io.close(state, io.customData);
     }
-    if (ioSource == ZR_NULL) {
-        return ZR_FALSE;
-    }
-
-    *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, ioSource);
-    ZrCore_Io_ReadSourceFree(state->global, ioSource);
     return *outFunction != ZR_NULL;
 }
 
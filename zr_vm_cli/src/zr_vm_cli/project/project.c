@@ -502,6 +502,10 @@ TZrBool ZrCli_Project_OpenFileIo(SZrState *state, const TZrChar *path, TZrBool i
         return ZR_FALSE;
     }
 
+    if (isBinary) {
+        return ZrLibrary_File_OpenMappedBinaryIo(state, (TZrNativeString)path, io);
+    }
+
     reader = ZrLibrary_File_OpenRead(state->global, (TZrNativeString)path, isBinary);
     if (reader == ZR_NULL) {
         return ZR_FALSE;
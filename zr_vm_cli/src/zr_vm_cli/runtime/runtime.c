@@ -98,6 +98,7 @@ static TZrBool zr_cli_runtime_start_coverage(SZrState *state,
         return ZR_TRUE;
     }
 
+    ZrCore_Function_MaterializeGraph(state, entryFunction);
     if (!ZrDebug_Coverage_RegisterFunctionTree(coverage, entryFunction) ||
         !ZrDebug_Coverage_Start(coverage, state)) {
         ZrCore_Log_Error(state, "failed to start coverage\n");
@@ -244,6 +245,8 @@ static TZrBool zr_cli_runtime_dump_bytecode(SZrState *state,
         return ZR_FALSE;
     }
 
+    // functions loaded from a resident .zro keep their bodies in the image until called; dump them all.
+    ZrCore_Function_MaterializeGraph(state, entryFunction);
     ZrCore_Debug_DisassembleFunction(state, entryFunction, output);
     fclose(output);
     return ZR_TRUE;
@@ -633,22 +636,24 @@ static TZrBool zr_cli_runtime_load_entry_function(SZrState *state,
     if (preferBinary && ZrLibrary_File_Exist(entryBinaryPath) == ZR_LIBRARY_FILE_IS_FILE) {
         SZrIo io;
         SZrIoSource *ioSource;
+        SZrIoResidentImage *residentImage;
 
         if (!ZrCli_Project_OpenFileIo(state, entryBinaryPath, ZR_TRUE, &io)) {
             return ZR_FALSE;
         }
 
+        io.borrowResidentImage = ZR_TRUE;
+        residentImage = ZrCore_Io_ResidentImage_Adopt(state, &io);
         ioSource = ZrCore_Io_ReadSourceNew(&io);
+        if (ioSource != ZR_NULL) {
+            *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, ioSource);
+            ZrCore_Io_ReadSourceFree(state->global, ioSource);
+        }
+        ZrCore_Io_ResidentImage_Release(state, residentImage);
         if (io.close != ZR_NULL) {
             io.close(state, io.customData);
         }
 
-        if (ioSource == ZR_NULL) {
-            return ZR_FALSE;
-        }
-
-        *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, ioSource);
-        ZrCore_Io_ReadSourceFree(state->global, ioSource);
         if (*outFunction == ZR_NULL) {
             return ZR_FALSE;
         }
@@ -818,6 +823,16 @@ TZrBool ZrCli_Runtime_PrepareProjectExecutionWithBootstrap(const SZrCliCommand *
         ZrCore_Log_Error(ZR_NULL, "failed to load project: %s\n", command->projectPath);
         return ZR_FALSE;
     }
+    outPrepared->global->jitEnabled = command->jitEnabled;
+    if (command->gcWorkerCount != 0) {
+        ZrCore_GarbageCollector_SetWorkerCount(outPrepared->global, command->gcWorkerCount);
+    }
+    if (command->gcBackgroundSweep) {
+        ZrCore_GarbageCollector_SetBackgroundSweep(outPrepared->global, ZR_TRUE);
+    }
+    if (command->gcNursery) {
+        ZrCore_GarbageCollector_SetNursery(outPrepared->global, ZR_TRUE);
+    }
 
     zr_cli_runtime_trace("register standard modules");
     if (!ZrCli_Project_RegisterStandardModulesWithBootstrap(outPrepared->global, bootstrap, userData)) {
@@ -35,8 +35,11 @@ static const union {
  *  27 ENDIAN 1
  *  28 DEBUG 1
  *  29 OPT 3
- *  32 MODULES_LENGTH 8
- *  40 MODULES [.MODULE]
+ *  if VERSION_PATCH >= ZR_IO_SOURCE_PATCH_HAS_VALUE_CELL_SIZE:
+ *    32 VALUE_CELL_SIZE 1   (sizeof(SZrTypeValue), the unit of frame-layout byte offsets)
+ *    33 STACK_SLOT_SIZE 1   (sizeof(SZrTypeValueOnStack))
+ *  MODULES_LENGTH 8
+ *  MODULES [.MODULE]
  */
 #define ZR_IO_SOURCE_SIGNATURE "\x1ZR\x2"
 #define ZR_IO_SOURCE_PATCH_HAS_COMPILE_TIME_METADATA 2U
@@ -69,7 +72,9 @@ static const union {
 #define ZR_IO_SOURCE_PATCH_HAS_METADATA_BINDING_LAYOUT_IDENTITY 32U
 #define ZR_IO_SOURCE_PATCH_HAS_MODULE_EFFECT_ASSEMBLY_NAME 33U
 #define ZR_IO_SOURCE_PATCH_HAS_SEMIR_STATIC_C_TYPES 34U
-#define ZR_IO_SOURCE_PATCH_CURRENT ZR_IO_SOURCE_PATCH_HAS_SEMIR_STATIC_C_TYPES
+#define ZR_IO_SOURCE_PATCH_HAS_VALUE_CELL_SIZE 35U
+#define ZR_IO_SOURCE_PATCH_HAS_FUNCTION_RECORD_LENGTH 36U
+#define ZR_IO_SOURCE_PATCH_CURRENT ZR_IO_SOURCE_PATCH_HAS_FUNCTION_RECORD_LENGTH
 
 /* .MODULE:
  * NAME [string]
@@ -128,13 +133,17 @@ static const union {
 /* .CONSTANT:
  * TYPE [4]
  * DATA [string|uint|int|float|...]
+ *   FUNCTION/CLOSURE: HAS_FUNCTION_VALUE [1], then if set:
+ *     if VERSION_PATCH >= ZR_IO_SOURCE_PATCH_HAS_FUNCTION_RECORD_LENGTH: RECORD_LENGTH [8]
+ *     FUNCTION [.FUNCTION]
  * START_LINE [8] (DEBUG)
  * END_LINE [8] (DEBUG)
  */
 
 /* .CLOSURE:
+ * if VERSION_PATCH >= ZR_IO_SOURCE_PATCH_HAS_FUNCTION_RECORD_LENGTH:
+ *   RECORD_LENGTH [8]  (SUB_FUNCTION 的字节数，驻留镜像加载时据此跳过尚未调用的函数体)
  * SUB_FUNCTION [.FUNCTION]
- * todo
  */
 
 /* .DEBUG_INFO:
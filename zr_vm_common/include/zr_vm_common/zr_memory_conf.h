@@ -26,6 +26,8 @@ enum EZrMemoryNativeType {
 
     ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER,
     ZR_MEMORY_NATIVE_TYPE_PROJECT,
+    ZR_MEMORY_NATIVE_TYPE_OBJECT_SHAPE,
+    ZR_MEMORY_NATIVE_TYPE_JIT_CODE,
 
 
     ZR_MEMORY_NATIVE_TYPE_ENUM_MAX,
@@ -150,7 +150,9 @@ enum EZrGarbageCollectPinKind {
     ZR_GARBAGE_COLLECT_PIN_KIND_HOST_HANDLE = 1 << 0,
     ZR_GARBAGE_COLLECT_PIN_KIND_NATIVE_HANDLE = 1 << 1,
     ZR_GARBAGE_COLLECT_PIN_KIND_PERSISTENT_ROOT = 1 << 2,
-    ZR_GARBAGE_COLLECT_PIN_KIND_LARGE_OBJECT = 1 << 3
+    ZR_GARBAGE_COLLECT_PIN_KIND_LARGE_OBJECT = 1 << 3,
+    // 原生调用句柄作用域持有期间临时钉住，作用域关闭即清除，不参与晋升到钉住区域
+    ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE = 1 << 4
 };
 
 typedef enum EZrGarbageCollectPinKind EZrGarbageCollectPinKind;
@@ -201,27 +203,38 @@ enum EZrObjectPrototypeType {
 
 typedef enum EZrObjectPrototypeType EZrObjectPrototypeType;
 
+// status stays 32-bit for the parallel-mark CAS; the small enums and flag sets are stored narrow so the whole mark
+// packs into 64 bytes. survivalAge saturates at ZR_GC_SURVIVAL_AGE_MAX.
 struct SZrGarbageCollectionObjectMark {
     EZrGarbageCollectIncrementalObjectStatus status;
-    EZrGarbageCollectGenerationalObjectStatus generationalStatus;
-    EZrGarbageCollectGeneration generation;
     TZrUInt32 minorScanEpoch;
-    EZrGarbageCollectHeapGenerationKind heapGenerationKind;
-    EZrGarbageCollectRegionKind regionKind;
-    EZrGarbageCollectStorageKind storageKind;
     TZrUInt32 regionId;
-    TZrUInt32 survivalAge;
-    TZrUInt32 escapeFlags;
     TZrUInt32 anchorScopeDepth;
-    TZrUInt32 pinFlags;
-    EZrGarbageCollectPromotionReason promotionReason;
+    TZrUInt32 nurseryChunkId;
+    TZrUInt16 escapeFlags;
+    TZrUInt16 survivalAge;
+    // EZrGarbageCollectGenerationalObjectStatus
+    TZrUInt8 generationalStatus;
+    // EZrGarbageCollectGeneration
+    TZrUInt8 generation;
+    // EZrGarbageCollectHeapGenerationKind
+    TZrUInt8 heapGenerationKind;
+    // EZrGarbageCollectRegionKind
+    TZrUInt8 regionKind;
+    // EZrGarbageCollectStorageKind
+    TZrUInt8 storageKind;
+    // EZrGarbageCollectPromotionReason
+    TZrUInt8 promotionReason;
+    // EZrGarbageCollectPinKind flags
+    TZrUInt8 pinFlags;
     TZrSize ignoredRegistryIndex;
     TZrSize rememberedRegistryIndex;
     TZrSize regionDescriptorIndex;
     TZrPtr forwardingAddress;
-    TZrPtr forwardingRefLocation;
 };
 
+#define ZR_GC_SURVIVAL_AGE_MAX 0xFFFFu
+
 typedef struct SZrGarbageCollectionObjectMark SZrGarbageCollectionObjectMark;
 
 
@@ -30,6 +30,7 @@
 #define ZR_RUNTIME_DEBUG_COLLECTION_PREVIEW_MAX 10U
 #define ZR_RUNTIME_REFLECTION_FORMAT_BUFFER_LENGTH 8192U
 #define ZR_RUNTIME_OBJECT_CALL_INLINE_ARGUMENT_CAPACITY 8U
+#define ZR_RUNTIME_GC_HANDLE_SCOPE_CAPACITY 16U
 #define ZR_RUNTIME_OBJECT_PROTOTYPE_INITIAL_CAPACITY 4U
 #define ZR_RUNTIME_OBJECT_PROTOTYPE_GROWTH_FACTOR 2U
 #define ZR_RUNTIME_PROTOTYPE_INHERIT_INITIAL_CAPACITY 4U
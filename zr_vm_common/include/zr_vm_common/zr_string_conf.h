@@ -15,6 +15,13 @@
 #define ZR_VM_SHORT_STRING_MAX 127U // 短字符串最大长度 不得超过UINT8_MAX
 #define ZR_VM_LONG_STRING_FLAG (0XFF) // 长字符串最大长度 不得超过INT32_MAX
 
+#define ZR_VM_STRING_FLAG_CONCAT_NODE 0x01U // 长字符串为拼接节点：内容位于共享追加缓冲区，按需展平
+#define ZR_VM_STRING_FLAG_ASCII 0x02U // 创建时确定：全部字节为 ASCII，码点下标即字节下标
+#define ZR_VM_STRING_FLAG_CODE_POINTS_READY 0x04U // 短字符串的码点长度已缓存在 shortCodePointLength 中
+#define ZR_VM_STRING_FLAG_UTF8_INVALID 0x08U // 已验证为非法 UTF-8，之后的码点查询直接失败
+#define ZR_VM_STRING_APPEND_BUFFER_MIN_CAPACITY 256U // 追加缓冲区的最小容量，之后按倍数增长
+#define ZR_VM_STRING_CODE_POINT_BREADCRUMB_STRIDE 64U // 长字符串码点索引每隔多少个码点记录一次字节偏移
+
 #define ZR_NUMBER_TO_STRING_LENGTH_MAX 44
 
 #define ZR_STRING_NULL_STRING "null"
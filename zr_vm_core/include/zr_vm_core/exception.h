@@ -22,6 +22,8 @@ struct SZrExceptionLongJump {
     TZrExceptionLongJump jumpBuffer;
     struct SZrExceptionLongJump *previous;
     volatile EZrThreadStatus status;
+    // 进入时的句柄作用域栈顶，抛出前据此展开更深的作用域
+    struct SZrGcHandleScope *handleScope;
 };
 
 typedef struct SZrExceptionLongJump SZrExceptionLongJump;
@@ -16,6 +16,9 @@ struct SZrTypeValueOnStack;
 struct SZrString;
 struct SZrObject;
 struct SZrObjectPrototype;
+struct SZrObjectShape;
+struct SZrJitCode;
+struct SZrIoResidentImage;
 struct SZrClosure;
 struct SZrTypeLayoutField;
 struct SZrAotCodeRegistration;
@@ -444,6 +447,9 @@ typedef struct SZrFunctionCallSitePicSlot {
     struct SZrHashKeyValuePair *cachedReceiverPair;
     struct SZrFunction *cachedFunction;
     struct SZrString *cachedMemberName;
+    // instance fields: any receiver with this shape holds the field at cachedShapeSlotIndex
+    const struct SZrObjectShape *cachedReceiverShape;
+    TZrUInt32 cachedShapeSlotIndex;
     TZrUInt32 cachedReceiverVersion;
     TZrUInt32 cachedOwnerVersion;
     TZrUInt32 cachedDescriptorIndex;
@@ -595,8 +601,21 @@ struct ZR_STRUCT_ALIGN SZrFunction {
     SZrMetadataTokenBinding *moduleMetadataBindings;
     TZrUInt32 moduleMetadataBindingLength;
     TZrUInt32 moduleMetadataBindingCapacity;
+    // baseline JIT: native code is owned by the global state; hotness counts loop back-edges until compiled
+    struct SZrJitCode *jitCode;
+    TZrUInt32 jitHotness;
+    // resident .zro load: body still undecoded in the mapped image until the first call (see io_runtime.c)
+    struct SZrFunctionLazyBody *lazyBody;
 };
 
+// 驻留镜像中尚未解码的函数体；外壳只持有函数头与闭包捕获列表，instructionsLength 暂存于此。
+typedef struct SZrFunctionLazyBody {
+    struct SZrIoResidentImage *image;
+    const TZrByte *record;
+    TZrSize recordLength;
+    TZrUInt32 instructionsLength;
+} SZrFunctionLazyBody;
+
 typedef struct SZrFunction SZrFunction;
 
 typedef const SZrTypeLayout *(*FZrFunctionFrameTypeLayoutResolver)(const SZrFunction *function,
@@ -623,6 +642,21 @@ ZR_CORE_API SZrFunction *ZrCore_Function_New(struct SZrState *state);
 
 ZR_CORE_API void ZrCore_Function_Free(struct SZrState *state, SZrFunction *function);
 
+// 从驻留镜像就地解码 lazyBody 指向的函数体（实现位于 io_runtime.c），失败时抛出运行时错误。
+ZR_CORE_API void ZrCore_Function_MaterializeLazyBody(struct SZrState *state, SZrFunction *function);
+
+// 递归解码函数及其子函数、常量函数；调试器、覆盖率与反汇编等需要完整函数树时使用。
+ZR_CORE_API void ZrCore_Function_MaterializeGraph(struct SZrState *state, SZrFunction *function);
+
+// 释放函数及其内联子函数仍未解码的函数体所持有的镜像引用；ZrCore_Function_Free 与回收器清扫函数时调用。
+ZR_CORE_API void ZrCore_Function_ReleaseLazyBodies(struct SZrState *state, SZrFunction *function);
+
+ZR_FORCE_INLINE void ZrCore_Function_EnsureMaterialized(struct SZrState *state, SZrFunction *function) {
+    if (ZR_UNLIKELY(function->lazyBody != ZR_NULL)) {
+        ZrCore_Function_MaterializeLazyBody(state, function);
+    }
+}
+
 ZR_CORE_API struct SZrString *ZrCore_Function_GetLocalVariableName(SZrFunction *function, TZrUInt32 index,
                                                              TZrUInt32 programCounter);
 
@@ -84,6 +84,40 @@ enum EZrGarbageCollectCollectionPhase {
 
 typedef enum EZrGarbageCollectCollectionPhase EZrGarbageCollectCollectionPhase;
 
+/*
+** 并行标记
+** - workerCount > 1 时，非 minor 的 ZrGarbageCollectorPropagateAll 由 workerCount 个标记线程（含调用线程）共同排空灰色对象
+** - 每个线程持有私有灰栈，积压时把一批对象放到可窃取链表，空闲线程从其他线程的可窃取链表整批窃取
+** - 对象由 INITED -> WAIT_TO_SCAN 的原子比较交换认领，每个对象只被一个线程扫描
+** - THREAD 的扫描与 NATIVE_DATA 的 scanMarkGcFunction 回调不保证线程安全，交回调用线程串行处理
+** - 标记线程在第一次有灰色对象可排空时才创建，之后常驻到 workerCount 变化或回收器释放
+** - 超过 ZR_GC_PARALLEL_MARK_WORKER_MAX 的部分按上限处理
+*/
+#define ZR_GC_PARALLEL_MARK_WORKER_MAX 32u
+
+/*
+** 后台清扫
+** - 开启后，清扫仍在调用线程上判定死亡对象、摘链，并完成调用线程可见的收尾：
+**   区域记账、登记表、所有权通知、NATIVE_DATA 回调、共享字节存储的引用计数与债务
+** - 死亡对象本体及其独占缓冲（superArrayRawIntData、hashIndexSlots）的释放打包成批次，
+**   由后台清扫线程通过 global->allocator 释放；批次装满或每次 GcStep/GcFull 结束时交出
+** - 要求 global->allocator 可在其他线程调用（内置分配器满足）；默认关闭
+** - 清扫线程在队列排空后退出，分配器的线程缓存随之归还，调用线程可以复用这些内存
+** - 关闭后台清扫与回收器释放时会等待已交出的批次全部释放
+*/
+#define ZR_GC_BACKGROUND_SWEEP_BATCH_CAPACITY 512u
+
+/*
+** 复制式新生代（nursery）
+** - 开启后，大小为 sizeof(SZrObject) 的普通对象在 eden 块内按指针碰撞分配，不再逐个调用分配器
+** - 块大小为 youngRegionSize，块数不超过 youngRegionCountTarget；块满且没有可复用的块时退回分配器
+** - minor GC 把块内存活对象复制到分配器内存（按年龄进入 survivor 或 old），原对象留下转发地址，
+**   根与对象图由既有的转发改写流程更新
+** - 带 pinFlags（含原生调用钉住）、在忽略表中或带 ownershipControl 的对象原地保留，其所在块保留到这些对象死亡
+** - 块内驻留对象全部死亡或迁出后，块在下一次换块时整块回卷
+** - 原生代码若在可能触发 GC 的调用前后持有新生代对象的裸指针，需要先钉住或加入忽略表；默认关闭
+*/
+
 typedef struct SZrGarbageCollectRegionDescriptor {
     TZrUInt32 id;
     EZrGarbageCollectRegionKind kind;
@@ -136,6 +170,30 @@ typedef struct SZrGarbageCollectorStatsSnapshot {
     TZrUInt64 minorCollectionMaxDurationUs;
     TZrUInt64 majorCollectionMaxDurationUs;
     TZrUInt64 fullCollectionMaxDurationUs;
+    // 最近一次标记重启以来 PropagateAll 的分线程统计；串行排空记在 0 号
+    TZrUInt32 lastMarkWorkerCount;
+    TZrUInt64 parallelMarkCount;
+    TZrUInt64 lastMarkWorkerObjects[ZR_GC_PARALLEL_MARK_WORKER_MAX];
+    TZrUInt64 lastMarkWorkerWork[ZR_GC_PARALLEL_MARK_WORKER_MAX];
+    TZrUInt64 lastMarkWorkerSteals[ZR_GC_PARALLEL_MARK_WORKER_MAX];
+    // 后台清扫累计统计；backgroundSweepDurationUs 即移出调用线程的释放耗时
+    TZrBool backgroundSweepEnabled;
+    TZrUInt64 backgroundSweepBatchCount;
+    TZrUInt64 backgroundSweepObjectCount;
+    TZrUInt64 backgroundSweepFreeCount;
+    TZrUInt64 backgroundSweepBytes;
+    TZrUInt64 backgroundSweepDurationUs;
+    // nursery 统计；nurseryUsedBytes 为各块已碰撞分配的字节数，其余计数自开启以来累计
+    TZrBool nurseryEnabled;
+    TZrUInt32 nurseryChunkCount;
+    TZrUInt64 nurseryCapacityBytes;
+    TZrUInt64 nurseryUsedBytes;
+    TZrUInt64 nurseryAllocationCount;
+    TZrUInt64 nurseryFallbackCount;
+    TZrUInt64 nurseryEvacuatedCount;
+    TZrUInt64 nurseryEvacuatedBytes;
+    TZrUInt64 nurseryRetainedCount;
+    TZrUInt64 nurseryChunkResetCount;
 } SZrGarbageCollectorStatsSnapshot;
 
 // generational mode
@@ -201,6 +259,12 @@ struct ZR_STRUCT_ALIGN SZrGarbageCollector {
     TZrUInt64 pauseBudgetUs;
     TZrUInt64 remarkBudgetUs;
     TZrUInt32 workerCount;
+    TZrBool parallelMarkActive;
+    struct SZrGcParallelMarker *parallelMarker;
+    TZrBool backgroundSweepEnabled;
+    struct SZrGcBackgroundSweeper *backgroundSweeper;
+    TZrBool nurseryEnabled;
+    struct SZrGcNursery *nursery;
     TZrUInt32 fragmentationCompactThreshold;
     TZrUInt32 gcFlags;
     EZrGarbageCollectCollectionKind scheduledCollectionKind;
@@ -308,6 +372,9 @@ ZR_CORE_API void ZrCore_GarbageCollector_Barrier(struct SZrState *state, SZrRawO
 
 ZR_CORE_API void ZrCore_GarbageCollector_BarrierBack(struct SZrState *state, SZrRawObject *object);
 
+// 对象的全部引用被就地重建（如延迟解码的函数体）后调用：老对象记入记忆集，已标黑的对象立即重新扫描。
+ZR_CORE_API void ZrCore_GarbageCollector_BarrierRebuilt(struct SZrState *state, SZrRawObject *object);
+
 ZR_CORE_API void ZrCore_RawObject_Barrier(struct SZrState *state, SZrRawObject *object, SZrRawObject *valueObject);
 
 ZR_CORE_API void ZrCore_GarbageCollector_SetHeapLimitBytes(struct SZrGlobalState *global, TZrMemoryOffset heapLimitBytes);
@@ -315,6 +382,11 @@ ZR_CORE_API void ZrCore_GarbageCollector_SetPauseBudgetUs(struct SZrGlobalState
                                                           TZrUInt64 pauseBudgetUs,
                                                           TZrUInt64 remarkBudgetUs);
 ZR_CORE_API void ZrCore_GarbageCollector_SetWorkerCount(struct SZrGlobalState *global, TZrUInt32 workerCount);
+ZR_CORE_API void ZrCore_GarbageCollector_SetBackgroundSweep(struct SZrGlobalState *global, TZrBool enabled);
+// 等待已交出的后台清扫批次全部释放
+ZR_CORE_API void ZrCore_GarbageCollector_WaitBackgroundSweep(struct SZrGlobalState *global);
+// 关闭后不再向 nursery 分配，已驻留的对象留在原块直到死亡或被 minor GC 迁出
+ZR_CORE_API void ZrCore_GarbageCollector_SetNursery(struct SZrGlobalState *global, TZrBool enabled);
 ZR_CORE_API void ZrCore_GarbageCollector_ScheduleCollection(struct SZrGlobalState *global,
                                                             EZrGarbageCollectCollectionKind kind);
 ZR_CORE_API void ZrCore_GarbageCollector_GetStatsSnapshot(struct SZrGlobalState *global,
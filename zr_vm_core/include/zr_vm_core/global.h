@@ -22,7 +22,10 @@ struct SZrStringTable;
 
 // from object.h
 struct SZrObjectPrototype;
+struct SZrObjectShape;
+struct SZrJitCode;
 struct SZrObjectModule;
+struct SZrModuleStartupImage;
 struct SZrRawObject;
 
 // from state.h
@@ -69,6 +72,8 @@ struct ZR_STRUCT_ALIGN SZrGlobalState {
     struct SZrState *mainThreadState;
     // closure
     struct SZrState *threadWithStackClosures;
+    // coroutine threads (task runtime)
+    struct SZrState *coroutineList;
 
     // hash
     TZrUInt64 hashSeed;
@@ -103,6 +108,12 @@ struct ZR_STRUCT_ALIGN SZrGlobalState {
     TZrPtr aotModuleLoaderUserData;
     FZrNativeModuleLoader nativeModuleLoader;
     TZrPtr nativeModuleLoaderUserData;
+    // 启动镜像（见 module.h）：在 sourceLoader 之前查询，命中时直接加载已编译模块
+    struct SZrModuleStartupImage *startupImage;
+    // 模块注册表版本：每次注册、替换、卸载或模块就绪时递增
+    TZrUInt64 moduleRegistryGeneration;
+    // startupImage 捕获或继承时的注册表版本；与 moduleRegistryGeneration 相同时镜像仍然有效
+    TZrUInt64 startupImageGeneration;
     TZrChar moduleLoadDiagnostic[ZR_RUNTIME_ERROR_BUFFER_LENGTH];
     FZrOwnershipStrongRefObserver ownershipStrongRefObserver;
     TZrPtr ownershipStrongRefObserverUserData;
@@ -127,6 +138,16 @@ struct ZR_STRUCT_ALIGN SZrGlobalState {
 
     struct SZrObjectPrototype *basicTypeObjectPrototype[ZR_VALUE_TYPE_ENUM_MAX];
 
+    // object shapes (hidden classes); see object_shape.h
+    struct SZrObjectShape *objectShapeRoot;
+    struct SZrObjectShape *objectShapeAllocations;
+    TZrUInt32 objectShapeCount;
+    TZrUInt32 objectShapeMarkEpoch;
+
+    // baseline JIT; see jit.h. off unless the embedder opts in
+    TZrBool jitEnabled;
+    struct SZrJitCode *jitCodeAllocations;
+
     // callbacks
     SZrCallbackGlobal callbacks;
 
@@ -22,10 +22,21 @@ struct ZR_STRUCT_ALIGN SZrHashKeyValuePair {
 
 typedef struct SZrHashKeyValuePair SZrHashKeyValuePair;
 
+// 增量哈希流：分段输入的摘要与一次性 ZrCore_Hash_Create 相同
+typedef struct SZrHashStream SZrHashStream;
+
 ZR_CORE_API TZrUInt64 ZrCore_HashSeed_Create(struct SZrGlobalState *global, TZrUInt64 uniqueNumber);
 
 ZR_CORE_API TZrUInt64 ZrCore_Hash_Create(struct SZrGlobalState *global, TZrNativeString string, TZrSize length);
 
+ZR_CORE_API SZrHashStream *ZrCore_HashStream_New(struct SZrGlobalState *global);
+
+ZR_CORE_API TZrBool ZrCore_HashStream_Update(SZrHashStream *stream, const TZrByte *data, TZrSize length);
+
+ZR_CORE_API TZrUInt64 ZrCore_HashStream_Digest(const SZrHashStream *stream);
+
+ZR_CORE_API void ZrCore_HashStream_Free(SZrHashStream *stream);
+
 ZR_CORE_API TZrUInt64 ZrCore_Hash_CreateStable64(const TZrByte *data, TZrSize length);
 
 ZR_CORE_API TZrUInt64 ZrCore_Hash_CreateStable64WithPrefix(const TZrByte *prefix,
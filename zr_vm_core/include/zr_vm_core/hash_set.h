@@ -255,6 +255,17 @@ static ZR_FORCE_INLINE SZrHashKeyValuePair *ZrCore_HashSet_TakeReservedPairSpanE
     return ZrCore_HashSet_TakeReservedPairSpanExactAssumeAvailable(set, count);
 }
 
+ZR_FORCE_INLINE TZrBool ZrCore_HashSet_IsPooledPair(const SZrHashSet *set, const SZrHashKeyValuePair *pair) {
+    const struct SZrHashPairPoolBlock *block;
+
+    for (block = set->pairPoolHead; block != ZR_NULL; block = block->next) {
+        if (pair >= block->pairs && pair < block->pairs + block->capacity) {
+            return ZR_TRUE;
+        }
+    }
+    return ZR_FALSE;
+}
+
 ZR_FORCE_INLINE TZrSize ZrCore_HashSet_MinCapacityForElementCount(TZrSize elementCount) {
     TZrSize capacity = 1;
 
@@ -491,8 +502,15 @@ ZR_FORCE_INLINE SZrTypeValue ZrCore_HashSet_Remove(struct SZrState *state, SZrHa
             }
             set->elementCount--;
             SZrTypeValue result = object->key;
-            ZrCore_Memory_RawFreeWithType(state->global, object, sizeof(SZrHashKeyValuePair),
-                                    ZR_MEMORY_NATIVE_TYPE_HASH_PAIR);
+            if (ZrCore_HashSet_IsPooledPair(set, object)) {
+                // pooled pairs are released with their block; clear the key so slot caches stop matching it.
+                ZrCore_Value_ResetAsNull(&object->key);
+                ZrCore_Value_ResetAsNull(&object->value);
+                object->next = ZR_NULL;
+            } else {
+                ZrCore_Memory_RawFreeWithType(state->global, object, sizeof(SZrHashKeyValuePair),
+                                        ZR_MEMORY_NATIVE_TYPE_HASH_PAIR);
+            }
             return result;
         }
         prev = object;
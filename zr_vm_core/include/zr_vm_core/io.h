@@ -34,6 +34,16 @@ typedef EZrThreadStatus (*FZrIoWrite)(struct SZrState *state, TZrBytePtr buffer,
 
 typedef void (*FZrIoClose)(struct SZrState *state, TZrPtr customData);
 
+// 延迟解码的函数共享的驻留镜像：每个尚未解码的函数持有一个引用，最后一个引用释放时才 close 镜像。
+struct SZrIoResidentImage {
+    TZrSize referenceCount;
+    TZrUInt32 sourceVersionPatch;
+    FZrIoClose close;
+    TZrPtr customData;
+};
+
+typedef struct SZrIoResidentImage SZrIoResidentImage;
+
 struct ZR_STRUCT_ALIGN SZrIo {
     struct SZrState *state;
     FZrIoRead read;
@@ -42,7 +52,13 @@ struct ZR_STRUCT_ALIGN SZrIo {
     TZrPtr customData;
     FZrIoClose close;
     TZrBool isBinary;
+    // 读取器一次返回整个镜像，且在 close 之前保持有效（如映射的 .zro）。
+    TZrBool isResidentImage;
+    // 调用方保证在 SZrIoSource 转换为运行时函数之后才 close，此时指令、调试行表等大块区段直接指向镜像而不复制。
+    TZrBool borrowResidentImage;
     TZrUInt32 sourceVersionPatch;
+    // 非空时嵌套函数只解出头部，函数体留在该镜像中直到首次调用。
+    SZrIoResidentImage *residentImage;
 };
 
 typedef struct SZrIo SZrIo;
@@ -470,6 +486,10 @@ struct SZrIoFunction {
     SZrIoFunctionClosure *closures;
     TZrSize debugInfosLength;
     SZrIoFunctionDebugInfo *debugInfos;
+    // 延迟解码：只读出了头部与捕获列表，完整记录仍在 deferredImage 中
+    const TZrByte *deferredRecord;
+    TZrSize deferredRecordLength;
+    SZrIoResidentImage *deferredImage;
 };
 
 typedef struct SZrIoFunction SZrIoFunction;
@@ -587,6 +607,8 @@ struct SZrIoSource {
     TZrBool isBigEndian;
     TZrBool isDebug;
     TZrChar optional[3];
+    TZrUInt8 valueCellSize;
+    TZrUInt8 stackSlotSize;
     TZrSize modulesLength;
     SZrIoModule *modules;
 };
@@ -610,5 +632,15 @@ ZR_CORE_API SZrIoSource *ZrCore_Io_LoadSource(struct SZrState *state, TZrNativeS
 
 ZR_CORE_API struct SZrFunction *ZrCore_Io_LoadEntryFunctionToRuntime(struct SZrState *state,
                                                                      const SZrIoSource *source);
+// 接管 io 的 close；此后由 io 读出的嵌套函数延迟解码，调用方读完后以 Release 放弃自己的引用。
+ZR_CORE_API SZrIoResidentImage *ZrCore_Io_ResidentImage_Adopt(struct SZrState *state, SZrIo *io);
+
+ZR_CORE_API void ZrCore_Io_ResidentImage_Retain(SZrIoResidentImage *image);
+
+ZR_CORE_API void ZrCore_Io_ResidentImage_Release(struct SZrState *state, SZrIoResidentImage *image);
+
+// 解码一条完整的函数记录（不含长度前缀），其中的嵌套函数仍按 io->residentImage 延迟。
+ZR_CORE_API TZrBool ZrCore_Io_ReadFunction(SZrIo *io, SZrIoFunction *function);
+
 ZR_CORE_API FZrNativeFunction ZrCore_Io_GetSerializableNativeHelperFunction(TZrUInt64 helperId);
 #endif // ZR_VM_CORE_IO_H
@@ -0,0 +1,79 @@
+//
+// Baseline JIT: translates the quickened integer subset of a hot function to x86-64 and runs its loops natively.
+//
+
+#ifndef ZR_VM_CORE_JIT_H
+#define ZR_VM_CORE_JIT_H
+
+#include "zr_vm_core/conf.h"
+#include "zr_vm_core/stack.h"
+
+struct SZrState;
+struct SZrGlobalState;
+struct SZrFunction;
+
+#if defined(ZR_VM_JIT_ENABLED) && defined(__x86_64__) && (defined(__linux__) || defined(__APPLE__)) &&           \
+        (defined(__GNUC__) || defined(__clang__))
+#define ZR_JIT_SUPPORTED 1
+#else
+#define ZR_JIT_SUPPORTED 0
+#endif
+
+// loop back-edges a function takes before the whole function is compiled.
+#define ZR_JIT_HOTNESS_THRESHOLD ((TZrUInt32)256u)
+// hotness value marking a function the JIT gave up on; it is never counted again.
+#define ZR_JIT_HOTNESS_DISABLED ((TZrUInt32)0xFFFFFFFFu)
+#define ZR_JIT_NO_ENTRY ((TZrUInt32)0xFFFFFFFFu)
+
+// frame slot referenced by compiled code, addressed the way FRAME_VALUE_SLOT resolves it.
+typedef struct SZrJitSlot {
+    TZrUInt32 stackSlot;
+    // byte offset of the slot's SZrTypeValue from the frame base
+    TZrUInt32 byteOffset;
+    TZrBool written;
+} SZrJitSlot;
+
+// machine code for one function. every instruction index gets a label; only loop heads whose whole body
+// compiled get an entry, so a loop never bounces between native code and the interpreter per iteration.
+// compiled code writes every result straight into the frame slots, so a failed type guard or an unsupported
+// instruction just returns its instruction index and the interpreter resumes there with nothing to rebuild.
+typedef struct SZrJitCode {
+    // global->jitCodeAllocations is doubly linked so freeing one function's code does not walk the list
+    struct SZrJitCode *nextAllocated;
+    struct SZrJitCode *previousAllocated;
+    // function whose jitCode points here; a struct copy of that function never frees the code
+    struct SZrFunction *function;
+    TZrByte *code;
+    TZrSize codeCapacity;
+    TZrUInt32 instructionCount;
+    TZrUInt32 slotCount;
+    // instruction index -> code offset of the loop head entry, or ZR_JIT_NO_ENTRY
+    TZrUInt32 *entryOffsets;
+    // slots the code touches; written ones must hold plain (non-owning) values when a loop is entered
+    SZrJitSlot *slots;
+    TZrUInt64 entryCount;
+    TZrUInt64 rejectedEntryCount;
+} SZrJitCode;
+
+ZR_CORE_API TZrBool ZrCore_Jit_IsSupported(void);
+
+// compiles function unconditionally; returns ZR_FALSE (and leaves function->jitCode NULL) when the JIT is not
+// built for this target or no loop of the function is fully covered by the supported instruction subset.
+ZR_CORE_API TZrBool ZrCore_Jit_CompileFunction(struct SZrState *state, struct SZrFunction *function);
+
+// called on a loop back-edge that lands on loopHeadIndex. counts hotness, compiles once the threshold is
+// crossed, then runs the loop natively. on success *outResumeIndex is the instruction the interpreter
+// continues with.
+ZR_CORE_API TZrBool ZrCore_Jit_TryRunLoop(struct SZrState *state,
+                                          struct SZrFunction *function,
+                                          TZrStackValuePointer base,
+                                          const volatile TZrDebugSignal *trap,
+                                          TZrUInt32 loopHeadIndex,
+                                          TZrUInt32 *outResumeIndex);
+
+// unmaps function's code and unlinks it from global->jitCodeAllocations; called when the function is freed.
+ZR_CORE_API void ZrCore_Jit_FreeFunctionCode(struct SZrGlobalState *global, struct SZrFunction *function);
+
+ZR_CORE_API void ZrCore_Jit_FreeAll(struct SZrGlobalState *global);
+
+#endif // ZR_VM_CORE_JIT_H
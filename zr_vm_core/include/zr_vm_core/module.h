@@ -54,6 +54,28 @@ struct ZR_STRUCT_ALIGN SZrObjectModule {
 
 typedef struct SZrObjectModule SZrObjectModule;
 
+// 启动镜像：已加载脚本模块的 .zro 字节，按模块路径索引。
+// 镜像创建后只读，通过原子引用计数在多个 isolate 之间共享；新 isolate 导入时直接加载镜像中的字节，不再重新编译源码。
+typedef TZrBool (*FZrModuleStartupImageSerialize)(struct SZrState *state,
+                                                  struct SZrFunction *function,
+                                                  TZrByte **outBytes,
+                                                  TZrSize *outLength);
+typedef void (*FZrModuleStartupImageFreeBuffer)(TZrByte *bytes);
+
+typedef struct SZrModuleStartupImageEntry {
+    const TZrChar *path;
+    TZrSize pathLength;
+    const TZrByte *bytes;
+    TZrSize length;
+} SZrModuleStartupImageEntry;
+
+typedef struct SZrModuleStartupImage {
+    volatile TZrInt32 refCount;
+    TZrUInt32 entryCount;
+    SZrModuleStartupImageEntry *entries;
+    TZrSize storageSize;
+} SZrModuleStartupImage;
+
 // 创建模块对象
 ZR_CORE_API struct SZrObjectModule *ZrCore_Module_Create(struct SZrState *state);
 
@@ -106,6 +128,20 @@ ZR_CORE_API struct SZrObjectModule *ZrCore_Module_ImportByPath(struct SZrState *
 ZR_CORE_API TZrInt64 ZrCore_Module_ImportNativeEntry(struct SZrState *state);
 ZR_CORE_API TZrInt64 ZrCore_Module_ImportGuardNativeEntry(struct SZrState *state);
 
+// 启动镜像
+// 捕获当前 global 已就绪的脚本模块（serialize 通常为 ZrParser_Writer_WriteBinaryBuffer），结果缓存在 global 上；
+// 模块集合未变化时直接复用。返回值已 retain，调用方负责 release；没有可捕获的模块时返回 ZR_NULL
+ZR_CORE_API SZrModuleStartupImage *ZrCore_Module_CaptureStartupImage(struct SZrState *state,
+                                                                     FZrModuleStartupImageSerialize serialize,
+                                                                     FZrModuleStartupImageFreeBuffer freeBuffer);
+ZR_CORE_API SZrModuleStartupImage *ZrCore_Module_RetainStartupImage(SZrModuleStartupImage *image);
+ZR_CORE_API void ZrCore_Module_ReleaseStartupImage(SZrModuleStartupImage *image);
+// 让 global 的模块导入优先使用镜像（retain 新镜像，release 旧镜像；image 可为 ZR_NULL）
+ZR_CORE_API void ZrCore_Module_SetStartupImage(struct SZrGlobalState *global, SZrModuleStartupImage *image);
+ZR_CORE_API const SZrModuleStartupImageEntry *ZrCore_Module_FindStartupImageEntry(const SZrModuleStartupImage *image,
+                                                                                  const TZrChar *path,
+                                                                                  TZrSize pathLength);
+
 // 创建并注册 prototype 的 native 函数
 // 参数: (module, typeName, prototypeType, accessModifier, inherits..., members...)
 // 返回: prototype 对象
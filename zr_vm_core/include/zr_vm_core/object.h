@@ -11,6 +11,7 @@
 #include "zr_vm_core/stack.h"
 #include "zr_vm_core/string.h"
 #include "zr_vm_core/object_known_native_dispatch.h"
+#include "zr_vm_core/object_shape.h"
 #include "zr_vm_common/zr_contract_conf.h"
 struct SZrState;
 struct SZrGlobalState;
@@ -26,7 +27,8 @@ typedef enum EZrProtocolId {
     ZR_PROTOCOL_ID_ITERATOR = 5,
     ZR_PROTOCOL_ID_ARRAY_LIKE = 6,
     ZR_PROTOCOL_ID_TASK_HANDLE = 7,
-    ZR_PROTOCOL_ID_TASK_RUNNER = 8
+    ZR_PROTOCOL_ID_TASK_RUNNER = 8,
+    ZR_PROTOCOL_ID_STRING_BUILDER = 9
 } EZrProtocolId;
 
 #define ZR_PROTOCOL_BIT(PROTOCOL_ID) (1ull << (TZrUInt64)(PROTOCOL_ID))
@@ -94,12 +96,30 @@ enum EZrObjectInternalType {
 
 typedef enum EZrObjectInternalType EZrObjectInternalType;
 
+// open-addressing slot of a native hash index attached to an array object (container Map/Set entries).
+// entryIndexPlusOne == 0 marks an empty slot; the cached hash avoids re-hashing keys on resize.
+typedef struct SZrObjectHashIndexSlot {
+    TZrUInt64 hash;
+    TZrSize entryIndexPlusOne;
+} SZrObjectHashIndexSlot;
+
+// refcounted contiguous byte buffer (zr.system.Bytes). a buffer object and its slice views share one storage;
+// the payload follows the header in the same allocation.
+typedef struct SZrObjectByteStorage {
+    TZrSize referenceCount;
+    TZrSize capacity;
+} SZrObjectByteStorage;
+
+#define ZR_OBJECT_BYTE_STORAGE_DATA(STORAGE) ((TZrByte *)((SZrObjectByteStorage *)(STORAGE) + 1))
+
 struct ZR_STRUCT_ALIGN SZrObject {
     SZrRawObject super;
 
     struct SZrObjectPrototype *prototype;
 
     SZrHashSet nodeMap;
+    // ZR_NULL once the object left shaped mode (or before its first field)
+    SZrObjectShape *shape;
 
     EZrObjectInternalType internalType;
     TZrUInt32 memberVersion;
@@ -117,6 +137,16 @@ struct ZR_STRUCT_ALIGN SZrObject {
     TZrSize superArrayRawIntLength;
     TZrSize superArrayRawIntCapacity;
     TZrBool superArrayRawIntDirty;
+    SZrObjectHashIndexSlot *hashIndexSlots;
+    TZrSize hashIndexCapacity;
+    TZrSize hashIndexCount;
+    // one bit per entry position removed from the index but still sitting in storage until compaction
+    TZrUInt64 *hashIndexTombstones;
+    TZrSize hashIndexTombstoneWords;
+    TZrSize hashIndexTombstoneCount;
+    SZrObjectByteStorage *byteStorage;
+    TZrSize byteStorageOffset;
+    TZrSize byteStorageLength;
 
     // SZrRawObject *gcList;
 };
@@ -157,6 +187,7 @@ struct ZR_STRUCT_ALIGN SZrObjectPrototype {
     SZrManagedFieldInfo *managedFields;
     TZrUInt32 managedFieldCount;
     TZrUInt32 managedFieldCapacity;
+    SZrObjectShape *instanceShapeRoot;
 };
 
 typedef struct SZrObjectPrototype SZrObjectPrototype;
@@ -341,6 +372,25 @@ ZR_CORE_API TZrBool ZrCore_Object_SuperArrayEnsureRawIntCapacity(struct SZrState
                                                                  SZrObject *itemsObject,
                                                                  TZrSize requiredCapacity);
 
+// byte views own one reference of their storage; a null byteStorage means the object is not a byte buffer.
+ZR_CORE_API TZrBool ZrCore_Object_AllocateByteStorage(struct SZrState *state, SZrObject *object, TZrSize length);
+
+ZR_CORE_API TZrBool ZrCore_Object_ShareByteStorage(struct SZrState *state,
+                                                   SZrObject *object,
+                                                   const SZrObject *source,
+                                                   TZrSize offset,
+                                                   TZrSize length);
+
+ZR_CORE_API TZrBool ZrCore_Object_ResizeByteStorage(struct SZrState *state, SZrObject *object, TZrSize length);
+
+ZR_CORE_API void ZrCore_Object_ReleaseByteStorage(struct SZrGlobalState *global, SZrObject *object);
+
+ZR_FORCE_INLINE TZrByte *ZrCore_Object_GetByteStorageData(const SZrObject *object) {
+    return object != ZR_NULL && object->byteStorage != ZR_NULL
+                   ? ZR_OBJECT_BYTE_STORAGE_DATA(object->byteStorage) + object->byteStorageOffset
+                   : ZR_NULL;
+}
+
 ZR_CORE_API TZrBool ZrCore_Object_IterInit(struct SZrState *state,
                                            SZrTypeValue *iterableValue,
                                            SZrTypeValue *result);
@@ -0,0 +1,59 @@
+#ifndef ZR_VM_CORE_OBJECT_SHAPE_H
+#define ZR_VM_CORE_OBJECT_SHAPE_H
+
+#include "zr_vm_core/conf.h"
+
+struct SZrState;
+struct SZrGlobalState;
+struct SZrString;
+struct SZrObject;
+struct SZrObjectPrototype;
+struct SZrHashKeyValuePair;
+
+// an object stays shaped while it only gains short-string fields; past these limits it falls back to
+// plain nodeMap lookups (dictionary mode).
+#define ZR_OBJECT_SHAPE_MAX_SLOT_COUNT ((TZrUInt32)64u)
+#define ZR_OBJECT_SHAPE_MAX_TRANSITION_COUNT ((TZrUInt32)32u)
+
+// hidden class shared by every object that added the same field names in the same order.
+// slot i of a shaped object is the i-th pair taken from its nodeMap pair pool, so a call site that knows
+// (shape, slot) reaches the field without hashing. shapes are owned by the global state: each full mark
+// stamps the shapes live objects use, and the ones left unstamped are freed before the sweep. a call site
+// that still caches a freed shape address stays safe because a hit also checks the slot's key pointer.
+typedef struct SZrObjectShape {
+    struct SZrObjectShape *parent;
+    struct SZrObjectShape *root;
+    struct SZrObjectShape *firstTransition;
+    struct SZrObjectShape *nextSibling;
+    struct SZrObjectShape *nextAllocated;
+    // field added by the transition into this shape, ZR_NULL for roots. marked as a string root while the
+    // shape exists, so transition lookups never compare against a collected string's address.
+    struct SZrString *name;
+    TZrUInt32 id;
+    TZrUInt32 slotCount;
+    TZrUInt32 transitionCount;
+    // roots only: deepest slot count a live instance reached, used to size the slot pool of new instances.
+    // recomputed from the surviving shapes after every full mark, so it shrinks when large instances die.
+    TZrUInt32 expectedSlotCount;
+    // global->objectShapeMarkEpoch of the last full mark (or transition) that saw this shape in use
+    TZrUInt32 markEpoch;
+} SZrObjectShape;
+
+ZR_CORE_API SZrObjectShape *ZrCore_ObjectShape_GetRoot(struct SZrState *state, struct SZrObjectPrototype *prototype);
+
+ZR_CORE_API SZrObjectShape *ZrCore_ObjectShape_Transition(struct SZrState *state,
+                                                          SZrObjectShape *shape,
+                                                          struct SZrString *name);
+
+// returns the slot holding name, or -1 when the shape does not contain it.
+ZR_CORE_API TZrInt32 ZrCore_ObjectShape_FindSlot(const SZrObjectShape *shape, struct SZrString *name);
+
+ZR_CORE_API struct SZrHashKeyValuePair *ZrCore_Object_GetShapeSlotPair(struct SZrObject *object, TZrUInt32 slotIndex);
+
+// runs at the end of a full mark: frees every non-root shape the mark did not stamp and recomputes the
+// slot-count estimate of each root from what survived.
+ZR_CORE_API TZrSize ZrCore_ObjectShape_FreeUnmarked(struct SZrGlobalState *global);
+
+ZR_CORE_API void ZrCore_ObjectShape_FreeAll(struct SZrGlobalState *global);
+
+#endif // ZR_VM_CORE_OBJECT_SHAPE_H
@@ -13,15 +13,17 @@ struct SZrOwnershipControl;
 
 typedef void (*FRawObjectScanMarkGc)(struct SZrState *state, struct SZrRawObject *parentThis);
 
+// next, gcList, scanMarkGcFunction, type and garbageCollectMark.status are what marking touches; they are kept at
+// the front of the header.
 struct ZR_STRUCT_ALIGN SZrRawObject {
     struct SZrRawObject *next;
+    struct SZrRawObject *gcList;
+    FRawObjectScanMarkGc scanMarkGcFunction;
     EZrRawObjectType type;
     TZrBool isNative;
     SZrGarbageCollectionObjectMark garbageCollectMark;
-    struct SZrRawObject *gcList;
-    FRawObjectScanMarkGc scanMarkGcFunction;
     struct SZrOwnershipControl *ownershipControl;
-    // default hash value is the address of the object
+    // strings set a content hash on creation; other objects get an identity hash on first use (0 = not assigned yet)
     TZrUInt64 hash;
 };
 
@@ -44,20 +46,31 @@ ZR_FORCE_INLINE void ZrCore_RawObject_Construct(SZrRawObject *super, EZrRawObjec
     super->garbageCollectMark.anchorScopeDepth = ZR_GC_SCOPE_DEPTH_NONE;
     super->garbageCollectMark.pinFlags = ZR_GARBAGE_COLLECT_PIN_KIND_NONE;
     super->garbageCollectMark.promotionReason = ZR_GARBAGE_COLLECT_PROMOTION_REASON_NONE;
+    super->garbageCollectMark.nurseryChunkId = 0u;
     super->garbageCollectMark.ignoredRegistryIndex = ZR_MAX_SIZE;
     super->garbageCollectMark.rememberedRegistryIndex = ZR_MAX_SIZE;
     super->garbageCollectMark.regionDescriptorIndex = ZR_MAX_SIZE;
     super->garbageCollectMark.forwardingAddress = ZR_NULL;
-    super->garbageCollectMark.forwardingRefLocation = ZR_NULL;
     super->gcList = ZR_NULL;
     super->scanMarkGcFunction = ZR_NULL;
     super->ownershipControl = ZR_NULL;
-    // because of the alignment, the hash value should be address / ZR_ALIGN_SIZE
-    super->hash = ((TZrUInt64) &super) / ZR_ALIGN_SIZE;
+    super->hash = 0u;
 }
 
 ZR_FORCE_INLINE void ZrCore_RawObject_InitHash(SZrRawObject *super, TZrUInt64 hash) { super->hash = hash; }
 
+/*
+ * Identity hash for non-string objects, taken from the address the first time it is asked for and then kept in the
+ * header, so it stays stable when the nursery copies the object. Because of the alignment the address is divided by
+ * ZR_ALIGN_SIZE, which also keeps it non-zero.
+ */
+ZR_FORCE_INLINE TZrUInt64 ZrCore_RawObject_GetHash(SZrRawObject *super) {
+    if (super->hash == 0u && super->type != ZR_RAW_OBJECT_TYPE_STRING) {
+        super->hash = (TZrUInt64)(TZrSize)super / ZR_ALIGN_SIZE;
+    }
+    return super->hash;
+}
+
 ZR_FORCE_INLINE TZrBool ZrCore_RawObject_IsMarkInited(SZrRawObject *super) {
     return super->garbageCollectMark.status == ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_INITED;
 }
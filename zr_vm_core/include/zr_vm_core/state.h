@@ -50,6 +50,20 @@ typedef struct SZrAotGcRootFrame {
     struct SZrAotGcRootFrame *previous;
 } SZrAotGcRootFrame;
 
+/*
+** 原生调用句柄作用域：分配在 C 栈上，按 LIFO 链在线程状态上。
+** GC 在扫描所属线程栈时一并标记其中的对象，并保证这些对象在作用域存活期间地址不变，
+** 原生绑定因此无需为参数和临时对象修改全局忽略表。
+** 作用域关闭或异常展开时只清除由本作用域设置的 HANDLE_SCOPE 钉住位。
+*/
+typedef struct SZrGcHandleScope {
+    struct SZrGcHandleScope *previous;
+    TZrUInt32 count;
+    // 第 i 位表示 objects[i] 的钉住位由本作用域设置
+    TZrUInt32 pinAddedMask;
+    SZrRawObject *objects[ZR_RUNTIME_GC_HANDLE_SCOPE_CAPACITY];
+} SZrGcHandleScope;
+
 struct ZR_STRUCT_ALIGN SZrState {
     SZrRawObject super;
     // reverse pointer to global
@@ -76,10 +90,15 @@ struct ZR_STRUCT_ALIGN SZrState {
     TZrStackPointer toBeClosedValueList;
     SZrAotGcRootFrame *aotGcRootFrameStack;
     TZrUInt32 aotGcRootFrameDepth;
+    SZrGcHandleScope *gcHandleScopeStack;
     // closures
     struct SZrState *threadWithStackClosures;
     SZrClosureValue *stackClosureValueList;
 
+    // 协程线程：由 global->coroutineList 串联，作为 GC 根扫描
+    struct SZrState *nextCoroutine;
+    TZrBool isCoroutine;
+
 
     // for exceptions
     TZrUInt32 nestedNativeCalls;
@@ -128,6 +147,12 @@ ZR_CORE_API void ZrCore_State_Exit(SZrState *state);
 
 ZR_CORE_API void ZrCore_State_Free(struct SZrGlobalState *global, SZrState *state);
 
+// 创建协程线程：拥有独立的栈与调用链，可在挂起后由调度器恢复执行
+ZR_CORE_API SZrState *ZrCore_State_NewCoroutine(SZrState *state);
+
+// 释放协程线程：关闭其栈上的开放闭包值并从全局协程链表摘除
+ZR_CORE_API void ZrCore_State_FreeCoroutine(SZrState *coroutine);
+
 ZR_CORE_API TZrInt32 ZrCore_State_ResetThread(SZrState *state, EZrThreadStatus status);
 
 ZR_CORE_API EZrThreadStatus ZrCore_State_DoRun(SZrState *state, TZrNativeString entry);
@@ -141,5 +166,58 @@ ZR_FORCE_INLINE TZrBool ZrCore_State_IsInClosureValueThreadList(SZrState *state)
     return state->threadWithStackClosures != state;
 }
 
+static ZR_FORCE_INLINE void ZrCore_State_HandleScopeOpen(SZrState *state, SZrGcHandleScope *scope) {
+    scope->previous = state->gcHandleScopeStack;
+    scope->count = 0u;
+    scope->pinAddedMask = 0u;
+    state->gcHandleScopeStack = scope;
+}
+
+// 作用域已满时返回 ZR_FALSE，调用方需自行改用其他方式保护对象
+static ZR_FORCE_INLINE TZrBool ZrCore_State_HandleScopePushObject(SZrGcHandleScope *scope, SZrRawObject *object) {
+    if (object == ZR_NULL) {
+        return ZR_TRUE;
+    }
+    if (scope->count >= ZR_RUNTIME_GC_HANDLE_SCOPE_CAPACITY) {
+        return ZR_FALSE;
+    }
+
+    if ((object->garbageCollectMark.pinFlags & ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE) == 0u) {
+        object->garbageCollectMark.pinFlags |= ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE;
+        scope->pinAddedMask |= (TZrUInt32)1u << scope->count;
+    }
+    scope->objects[scope->count++] = object;
+    return ZR_TRUE;
+}
+
+static ZR_FORCE_INLINE TZrBool ZrCore_State_HandleScopePushValue(SZrGcHandleScope *scope, const SZrTypeValue *value) {
+    if (value == ZR_NULL || !ZrCore_Value_IsGarbageCollectable(value)) {
+        return ZR_TRUE;
+    }
+
+    return ZrCore_State_HandleScopePushObject(scope, ZrCore_Value_GetRawObject(value));
+}
+
+static ZR_FORCE_INLINE void ZrCore_State_HandleScopeClose(SZrState *state, SZrGcHandleScope *scope) {
+    if (scope->pinAddedMask != 0u) {
+        for (TZrUInt32 index = 0u; index < scope->count; index++) {
+            if ((scope->pinAddedMask & ((TZrUInt32)1u << index)) != 0u) {
+                scope->objects[index]->garbageCollectMark.pinFlags &=
+                        (TZrUInt32)~(TZrUInt32)ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE;
+            }
+        }
+    }
+    scope->count = 0u;
+    scope->pinAddedMask = 0u;
+    state->gcHandleScopeStack = scope->previous;
+}
+
+// 异常展开时关闭 target 之上仍打开的全部作用域
+static ZR_FORCE_INLINE void ZrCore_State_HandleScopeUnwind(SZrState *state, SZrGcHandleScope *target) {
+    while (state->gcHandleScopeStack != ZR_NULL && state->gcHandleScopeStack != target) {
+        ZrCore_State_HandleScopeClose(state, state->gcHandleScopeStack);
+    }
+}
+
 
 #endif // ZR_VM_CORE_STATE_H
@@ -16,6 +16,8 @@ struct SZrGlobalState;
 struct SZrState;
 struct SZrObject;
 struct SZrTypeValue;
+struct SZrStringAppendBuffer;
+struct SZrStringCodePointIndex;
 #define ZR_STRING_LITERAL(STATE, STR) (ZrCore_String_Create((STATE), "" STR, (sizeof(STR) / sizeof(char) - 1)))
 
 struct ZR_STRUCT_ALIGN SZrString {
@@ -28,13 +30,33 @@ struct ZR_STRUCT_ALIGN SZrString {
     };
 
     TZrUInt8 shortStringLength;
+    // ZR_VM_STRING_FLAG_*
+    TZrUInt8 stringFlags;
+    // 短字符串的码点长度，ZR_VM_STRING_FLAG_CODE_POINTS_READY 置位后有效
+    TZrUInt8 shortCodePointLength;
     // short string is raw data
-    // long string is a pointer
+    // long string is a SZrStringLongExtend
+    // concat node is a SZrStringConcatNode
     TZrUInt8 stringDataExtend[1];
 };
 
 typedef struct SZrString SZrString;
 
+// 普通长字符串的扩展区：字节指针与首次按码点访问时构建的码点索引
+typedef struct SZrStringLongExtend {
+    TZrNativeString nativeString;
+    struct SZrStringCodePointIndex *codePointIndex;
+} SZrStringLongExtend;
+
+// 拼接节点：长字符串的一个前缀视图，字节保存在多个节点共享的追加缓冲区中。
+// flatString 与普通长字符串的指针槽位重叠，展平前为 ZR_NULL；flatStringSize 为节点自有展平块的分配字节数。
+typedef struct SZrStringConcatNode {
+    TZrNativeString flatString;
+    struct SZrStringCodePointIndex *codePointIndex;
+    struct SZrStringAppendBuffer *appendBuffer;
+    TZrSize flatStringSize;
+} SZrStringConcatNode;
+
 
 struct ZR_STRUCT_ALIGN SZrStringTable {
     SZrHashSet stringHashSet;
@@ -179,11 +201,25 @@ ZR_FORCE_INLINE TZrNativeString *ZrCore_String_GetNativeStringLong(const SZrStri
     return (TZrNativeString *) string->stringDataExtend;
 }
 
+ZR_FORCE_INLINE TZrBool ZrCore_String_IsConcatNode(const SZrString *string) {
+    return string != ZR_NULL && (string->stringFlags & ZR_VM_STRING_FLAG_CONCAT_NODE) != 0;
+}
+
+// 展平拼接节点并缓存结果，之后的读取不再复制；内存不足时返回 ZR_NULL
+ZR_CORE_API TZrNativeString ZrCore_String_Flatten(const SZrString *string);
+
+// 拼接节点被回收时释放其展平副本与共享缓冲区引用
+ZR_CORE_API void ZrCore_String_ReleaseConcatNode(struct SZrGlobalState *global, SZrString *string);
+
+// 长字符串被回收时释放其码点索引
+ZR_CORE_API void ZrCore_String_ReleaseCodePointIndex(struct SZrGlobalState *global, SZrString *string);
+
 ZR_FORCE_INLINE TZrNativeString ZrCore_String_GetNativeString(const SZrString *string) {
     if (string->shortStringLength < ZR_VM_LONG_STRING_FLAG) {
         return ZrCore_String_GetNativeStringShort(string);
     } else {
-        return *ZrCore_String_GetNativeStringLong(string);
+        TZrNativeString nativeString = *ZrCore_String_GetNativeStringLong(string);
+        return nativeString != ZR_NULL ? nativeString : ZrCore_String_Flatten(string);
     }
 }
 
@@ -197,15 +233,28 @@ ZR_FORCE_INLINE TZrSize ZrCore_String_GetByteLength(const SZrString *string) {
                    : string->longStringLength;
 }
 
-ZR_CORE_API TZrBool ZrCore_String_GetCodePointLength(const SZrString *string, TZrSize *outLength);
+ZR_FORCE_INLINE TZrBool ZrCore_String_IsAscii(const SZrString *string) {
+    return string != ZR_NULL && (string->stringFlags & ZR_VM_STRING_FLAG_ASCII) != 0;
+}
+
+// 码点长度：ASCII 字符串 O(1)，其余字符串首次查询时验证并缓存；非法 UTF-8 返回 ZR_FALSE
+ZR_CORE_API TZrBool ZrCore_String_GetCodePointLength(struct SZrState *state,
+                                                     const SZrString *string,
+                                                     TZrSize *outLength);
 
-ZR_CORE_API TZrBool ZrCore_String_CodePointCountToByteOffset(const SZrString *string,
+// 前 codePointCount 个码点占用的字节数；长字符串通过码点索引跳到最近的记录点后最多前进一个步长
+ZR_CORE_API TZrBool ZrCore_String_CodePointCountToByteOffset(struct SZrState *state,
+                                                             const SZrString *string,
                                                              TZrSize codePointCount,
                                                              TZrSize *outOffset);
 
+// 字符串是否为合法 UTF-8，结果与码点长度一同缓存
+ZR_CORE_API TZrBool ZrCore_String_IsValidUtf8(struct SZrState *state, const SZrString *string);
+
+// 把 UTF-8 字节复制进一个 zr.system.Bytes 连续缓冲
 ZR_CORE_API TZrBool ZrCore_String_ToByteArray(struct SZrState *state,
                                               const SZrString *string,
-                                              struct SZrObject **outArray);
+                                              struct SZrObject **outBytes);
 
 ZR_CORE_API TZrBool ZrCore_String_Equal(SZrString *string1, SZrString *string2);
 
@@ -231,6 +280,17 @@ ZR_CORE_API SZrString *ZrCore_String_ConcatStringAndNative(struct SZrState *stat
                                                            TZrSize nativeLength,
                                                            TZrBool stringOnLeft);
 
+// zr.system.StringBuilder 实例把当前文本保存在该隐藏字段中，文本是追加缓冲区末端的拼接节点
+#define ZR_STRING_BUILDER_TEXT_FIELD "__zr_string_builder_text"
+
+// 把 value 转换为字符串后追加到 builder 的文本末尾（均摊 O(追加长度)）
+ZR_CORE_API TZrBool ZrCore_String_BuilderAppend(struct SZrState *state,
+                                                struct SZrObject *builder,
+                                                const struct SZrTypeValue *value);
+
+// builder 当前文本；尚未追加过内容时返回空字符串
+ZR_CORE_API SZrString *ZrCore_String_BuilderGetText(struct SZrState *state, struct SZrObject *builder);
+
 
 // todo: number to string
 ZR_CORE_API SZrString *ZrCore_String_FromNumber(struct SZrState *state, struct SZrTypeValue *value);
@@ -4,6 +4,8 @@
 #include "zr_vm_core/conf.h"
 #include "zr_vm_core/global.h"
 
+struct SZrObject;
+
 typedef enum EZrVmTaskStatus {
     ZR_VM_TASK_STATUS_CREATED = 0,
     ZR_VM_TASK_STATUS_QUEUED = 1,
@@ -15,4 +17,10 @@ typedef enum EZrVmTaskStatus {
 
 ZR_CORE_API TZrBool ZrCore_TaskRuntime_RegisterBuiltins(SZrGlobalState *global);
 
+// runs one queued zr.coroutine task when automatic pumping is enabled; ZR_FALSE when nothing ran.
+ZR_CORE_API TZrBool ZrCore_TaskRuntime_YieldCoroutineScheduler(struct SZrState *state);
+
+// status of a zr.task.Task handle; handles minted by zr.thread report the value of their hidden status field.
+ZR_CORE_API EZrVmTaskStatus ZrCore_TaskRuntime_GetTaskStatus(struct SZrState *state, struct SZrObject *task);
+
 #endif
@@ -9,6 +9,9 @@
 
 ZR_CORE_API TZrBool ZrCore_Utf8_IsValid(TZrNativeString string, TZrSize length);
 
+// word-at-a-time check that every byte is below 0x80
+ZR_CORE_API TZrBool ZrCore_Utf8_IsAscii(const TZrChar *string, TZrSize length);
+
 ZR_CORE_API TZrBool ZrCore_Utf8_DecodeCodePoint(TZrNativeString string,
                                                 TZrSize length,
                                                 TZrUInt32 *outCodePoint,
@@ -27,4 +30,10 @@ ZR_CORE_API TZrBool ZrCore_Utf8_CodePointCountToByteOffset(TZrNativeString strin
                                                            TZrSize codePointCount,
                                                            TZrSize *outOffset);
 
+// byte offset after skipping codePointCount code points from offset; the text must already be valid UTF-8
+ZR_CORE_API TZrSize ZrCore_Utf8_SkipCodePoints(const TZrChar *string,
+                                               TZrSize length,
+                                               TZrSize offset,
+                                               TZrSize codePointCount);
+
 #endif // ZR_VM_CORE_UTF8_H
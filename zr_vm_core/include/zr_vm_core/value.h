@@ -34,15 +34,37 @@ typedef enum EZrOwnershipValueKind {
     ZR_OWNERSHIP_VALUE_KIND_LOANED,
 } EZrOwnershipValueKind;
 
+#if defined(ZR_VALUE_LAYOUT_WIDE)
+// pre-compaction layout (48 bytes on 64-bit targets), kept selectable for A/B benchmarking.
+typedef EZrValueType TZrValueTypeTag;
+typedef EZrOwnershipValueKind TZrOwnershipValueKindTag;
+
 struct ZR_STRUCT_ALIGN SZrTypeValue {
-    EZrValueType type;
+    TZrValueTypeTag type;
     TZrPureValue value;
     TZrBool isGarbageCollectable;
     TZrBool isNative;
-    EZrOwnershipValueKind ownershipKind;
+    TZrOwnershipValueKindTag ownershipKind;
     struct SZrOwnershipControl *ownershipControl;
     struct SZrOwnershipWeakRef *ownershipWeakRef;
 };
+#else
+// tags are stored as single bytes packed behind the pointers, so a value is one 32-byte cell instead of 48.
+// this shrinks stack slots, array/hash storage and constant tables, and lets the compiler merge the tag
+// writes of ZR_VALUE_FAST_SET into one store.
+typedef TZrUInt8 TZrValueTypeTag;
+typedef TZrUInt8 TZrOwnershipValueKindTag;
+
+struct ZR_STRUCT_ALIGN SZrTypeValue {
+    TZrPureValue value;
+    struct SZrOwnershipControl *ownershipControl;
+    struct SZrOwnershipWeakRef *ownershipWeakRef;
+    TZrValueTypeTag type;
+    TZrBool isGarbageCollectable;
+    TZrBool isNative;
+    TZrOwnershipValueKindTag ownershipKind;
+};
+#endif
 
 typedef struct SZrTypeValue SZrTypeValue;
 
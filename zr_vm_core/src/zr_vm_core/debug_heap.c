@@ -237,6 +237,8 @@ void ZrCore_Debug_HeapSummary(struct SZrState *state, FILE *output) {
                                &totalBytes,
                                prototypeSummaries,
                                &prototypeSummaryCount);
+    // settle handed-off sweep batches so the background totals below are final.
+    ZrCore_GarbageCollector_WaitBackgroundSweep(state->global);
     ZrCore_GarbageCollector_GetStatsSnapshot(state->global, &snapshot);
 
     fprintf(output,
@@ -295,4 +297,37 @@ void ZrCore_Debug_HeapSummary(struct SZrState *state, FILE *output) {
             debug_heap_collection_phase_name(snapshot.collectionPhase),
             (unsigned)snapshot.rememberedObjectCount,
             (unsigned)snapshot.ignoredObjectCount);
+    fprintf(output,
+            "gc mark workers=%u parallel=%llu\n",
+            (unsigned)snapshot.lastMarkWorkerCount,
+            (unsigned long long)snapshot.parallelMarkCount);
+    for (index = 0u; index < snapshot.lastMarkWorkerCount && index < ZR_GC_PARALLEL_MARK_WORKER_MAX; index++) {
+        fprintf(output,
+                "gc mark worker %u objects %llu work %llu steals %llu\n",
+                (unsigned)index,
+                (unsigned long long)snapshot.lastMarkWorkerObjects[index],
+                (unsigned long long)snapshot.lastMarkWorkerWork[index],
+                (unsigned long long)snapshot.lastMarkWorkerSteals[index]);
+    }
+    fprintf(output,
+            "gc background sweep enabled=%u batches=%llu objects=%llu frees=%llu bytes=%llu us=%llu\n",
+            (unsigned)snapshot.backgroundSweepEnabled,
+            (unsigned long long)snapshot.backgroundSweepBatchCount,
+            (unsigned long long)snapshot.backgroundSweepObjectCount,
+            (unsigned long long)snapshot.backgroundSweepFreeCount,
+            (unsigned long long)snapshot.backgroundSweepBytes,
+            (unsigned long long)snapshot.backgroundSweepDurationUs);
+    fprintf(output,
+            "gc nursery enabled=%u chunks=%u capacity=%llu used=%llu allocations=%llu fallbacks=%llu evacuated=%llu "
+            "evacuatedBytes=%llu retained=%llu resets=%llu\n",
+            (unsigned)snapshot.nurseryEnabled,
+            (unsigned)snapshot.nurseryChunkCount,
+            (unsigned long long)snapshot.nurseryCapacityBytes,
+            (unsigned long long)snapshot.nurseryUsedBytes,
+            (unsigned long long)snapshot.nurseryAllocationCount,
+            (unsigned long long)snapshot.nurseryFallbackCount,
+            (unsigned long long)snapshot.nurseryEvacuatedCount,
+            (unsigned long long)snapshot.nurseryEvacuatedBytes,
+            (unsigned long long)snapshot.nurseryRetainedCount,
+            (unsigned long long)snapshot.nurseryChunkResetCount);
 }
@@ -495,9 +495,11 @@ EZrThreadStatus ZrCore_Exception_TryRun(SZrState *state, FZrTryFunction tryFunct
 
     exceptionLongJump.status = ZR_THREAD_STATUS_FINE;
     exceptionLongJump.previous = state->exceptionRecoverPoint;
+    exceptionLongJump.handleScope = state->gcHandleScopeStack;
     state->exceptionRecoverPoint = &exceptionLongJump;
     ZR_EXCEPTION_NATIVE_TRY(state, &exceptionLongJump, { tryFunction(state, arguments); });
     state->exceptionRecoverPoint = exceptionLongJump.previous;
+    state->gcHandleScopeStack = exceptionLongJump.handleScope;
     state->nestedNativeCalls = prevNestedNativeCalls;
     return exceptionLongJump.status;
 }
@@ -522,6 +524,8 @@ void ZrCore_Exception_Throw(SZrState *state, EZrThreadStatus errorCode) {
         }
         state->threadStatus = errorCode;
         state->exceptionRecoverPoint->status = errorCode;
+        // the scopes being skipped are still live here; release their pins before their frames go away
+        ZrCore_State_HandleScopeUnwind(state, state->exceptionRecoverPoint->handleScope);
         ZR_EXCEPTION_NATIVE_THROW(state, state->exceptionRecoverPoint);
     }
 
@@ -529,6 +533,7 @@ void ZrCore_Exception_Throw(SZrState *state, EZrThreadStatus errorCode) {
         ZR_ABORT();
     }
 
+    ZrCore_State_HandleScopeUnwind(state, ZR_NULL);
     if (state != state->global->mainThreadState) {
         errorCode = ZrCore_State_ResetThread(state, errorCode);
         state->threadStatus = errorCode;
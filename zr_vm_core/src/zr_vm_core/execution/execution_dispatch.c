@@ -8,6 +8,7 @@
 #include "object/object_super_array_internal.h"
 
 #include "zr_vm_core/closure.h"
+#include "zr_vm_core/jit.h"
 #include "zr_vm_core/profile.h"
 
 #include <stdarg.h>
@@ -1541,7 +1542,11 @@ static ZR_FORCE_INLINE TZrBool execution_member_try_dispatch_same_prototype_inst
     if (memberName == ZR_NULL) {
         return ZR_FALSE;
     }
-    pair = object_get_own_string_pair_by_name_cached_unchecked(state, receiverObject, memberName);
+    pair = object_shape_try_get_slot_pair_unchecked(
+            receiverObject, slot->cachedReceiverShape, slot->cachedShapeSlotIndex, memberName);
+    if (pair == ZR_NULL) {
+        pair = object_get_own_string_pair_by_name_cached_unchecked(state, receiverObject, memberName);
+    }
     if (pair == ZR_NULL) {
         return ZR_FALSE;
     }
@@ -1733,7 +1738,11 @@ static ZR_FORCE_INLINE TZrBool execution_member_try_dispatch_same_prototype_inst
     if (memberName == ZR_NULL) {
         return ZR_FALSE;
     }
-    pair = object_get_own_string_pair_by_name_cached_unchecked(state, receiverObject, memberName);
+    pair = object_shape_try_get_slot_pair_unchecked(
+            receiverObject, slot->cachedReceiverShape, slot->cachedShapeSlotIndex, memberName);
+    if (pair == ZR_NULL) {
+        pair = object_get_own_string_pair_by_name_cached_unchecked(state, receiverObject, memberName);
+    }
     if (pair == ZR_NULL) {
         return ZR_FALSE;
     }
@@ -5390,6 +5399,26 @@ void ZrCore_Execute(SZrState *state, SZrCallInfo *callInfo) {
         programCounter += A2(INSTRUCTION) + (OFFSET);                                                                  \
         UPDATE_TRAP_FAST(CALL_INFO);                                                                                   \
     }
+// loop back-edge: hand hot integer loops to the baseline JIT, which returns the instruction to resume at.
+#if defined(ZR_VM_JIT_ENABLED)
+#define EXECUTE_JIT_BACK_EDGE(CALL_INFO, INSTRUCTION)                                                                  \
+    {                                                                                                                  \
+        TZrUInt32 jitResumeIndex;                                                                                      \
+        if (A2(INSTRUCTION) < 0 && fastDispatchMode && state->global->jitEnabled &&                                   \
+            currentFunction->jitHotness != ZR_JIT_HOTNESS_DISABLED &&                                                  \
+            ZrCore_Jit_TryRunLoop(state,                                                                               \
+                                  currentFunction,                                                                     \
+                                  base,                                                                                \
+                                  &(CALL_INFO)->context.context.trap,                                                  \
+                                  (TZrUInt32)(programCounter + 1 - currentFunction->instructionsList),                 \
+                                  &jitResumeIndex)) {                                                                  \
+            programCounter = currentFunction->instructionsList + jitResumeIndex - 1;                                   \
+            UPDATE_TRAP_FAST(CALL_INFO);                                                                               \
+        }                                                                                                              \
+    }
+#else
+#define EXECUTE_JIT_BACK_EDGE(CALL_INFO, INSTRUCTION)
+#endif
 #define JUMP1_16(CALL_INFO, INSTRUCTION, OFFSET)                                                                       \
     {                                                                                                                  \
         programCounter += (TZrInt16)B1(INSTRUCTION) + (OFFSET);                                                        \
@@ -8520,10 +8549,16 @@ LZrFastInstruction_ITER_CURRENT: {
             }
             DONE(1);
 #if defined(ZR_INSTRUCTION_USE_DISPATCH_TABLE) && ZR_INSTRUCTION_DISPATCH_TABLE_SUPPORTED
-LZrFastInstruction_JUMP: { JUMP_FAST(callInfo, instruction, 0); }
+LZrFastInstruction_JUMP: {
+                JUMP_FAST(callInfo, instruction, 0);
+                EXECUTE_JIT_BACK_EDGE(callInfo, instruction);
+            }
             DONE_AFTER_TRAP_FAST_ONE();
 #endif
-            ZR_INSTRUCTION_LABEL(JUMP) { JUMP(callInfo, instruction, 0); }
+            ZR_INSTRUCTION_LABEL(JUMP) {
+                JUMP(callInfo, instruction, 0);
+                EXECUTE_JIT_BACK_EDGE(callInfo, instruction);
+            }
             DONE(1);
 #if defined(ZR_INSTRUCTION_USE_DISPATCH_TABLE) && ZR_INSTRUCTION_DISPATCH_TABLE_SUPPORTED
 LZrFastInstruction_JUMP_IF: {
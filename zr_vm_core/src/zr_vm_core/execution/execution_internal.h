@@ -180,6 +180,7 @@ static ZR_FORCE_INLINE void execution_member_dispatch_refresh_instance_field_pic
 
     slot->cachedReceiverObject = receiverObject;
     slot->cachedReceiverPair = pair;
+    object_shape_resolve_pair_slot(receiverObject, pair, &slot->cachedReceiverShape, &slot->cachedShapeSlotIndex);
     if (slot->cachedReceiverPrototype != ZR_NULL) {
         slot->cachedReceiverVersion = slot->cachedReceiverPrototype->super.memberVersion;
     }
@@ -0,0 +1,841 @@
+//
+// Baseline x86-64 JIT over the quickened bytecode. Each supported instruction becomes a fixed template that
+// reads and writes the frame slots in place, guarded on the INT64 tag; anything else returns its instruction
+// index to the interpreter. Loops are entered from the interpreter's back-edges (on-stack replacement).
+//
+
+#if !defined(_WIN32)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#endif
+
+#include "zr_vm_core/jit.h"
+
+#include "execution/execution_internal.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "zr_vm_common/zr_instruction_conf.h"
+#include "zr_vm_core/function.h"
+#include "zr_vm_core/global.h"
+#include "zr_vm_core/memory.h"
+#include "zr_vm_core/state.h"
+#include "zr_vm_core/value.h"
+
+#if ZR_JIT_SUPPORTED
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+TZrBool ZrCore_Jit_IsSupported(void) {
+    return ZR_JIT_SUPPORTED ? ZR_TRUE : ZR_FALSE;
+}
+
+static TZrSize jit_code_metadata_size(TZrUInt32 instructionCount, TZrUInt32 slotCount) {
+    return sizeof(SZrJitCode) + sizeof(SZrJitSlot) * (TZrSize)slotCount + sizeof(TZrUInt32) * (TZrSize)instructionCount;
+}
+
+static void jit_code_free(SZrGlobalState *global, SZrJitCode *code) {
+#if ZR_JIT_SUPPORTED
+    if (code->code != ZR_NULL) {
+        munmap(code->code, code->codeCapacity);
+    }
+#endif
+    ZrCore_Memory_RawFreeWithType(global,
+                                  code,
+                                  jit_code_metadata_size(code->instructionCount, code->slotCount),
+                                  ZR_MEMORY_NATIVE_TYPE_JIT_CODE);
+}
+
+void ZrCore_Jit_FreeFunctionCode(SZrGlobalState *global, SZrFunction *function) {
+    SZrJitCode *code;
+
+    if (global == ZR_NULL || function == ZR_NULL || function->jitCode == ZR_NULL) {
+        return;
+    }
+
+    code = function->jitCode;
+    function->jitCode = ZR_NULL;
+    if (code->function != function) {
+        return;
+    }
+    if (code->previousAllocated != ZR_NULL) {
+        code->previousAllocated->nextAllocated = code->nextAllocated;
+    } else {
+        global->jitCodeAllocations = code->nextAllocated;
+    }
+    if (code->nextAllocated != ZR_NULL) {
+        code->nextAllocated->previousAllocated = code->previousAllocated;
+    }
+    jit_code_free(global, code);
+}
+
+void ZrCore_Jit_FreeAll(SZrGlobalState *global) {
+    SZrJitCode *code;
+
+    if (global == ZR_NULL) {
+        return;
+    }
+
+    code = global->jitCodeAllocations;
+    while (code != ZR_NULL) {
+        SZrJitCode *next = code->nextAllocated;
+        jit_code_free(global, code);
+        code = next;
+    }
+    global->jitCodeAllocations = ZR_NULL;
+}
+
+#if ZR_JIT_SUPPORTED
+
+// longest template (ADD_SIGNED_MOD_CONST) is under 96 bytes; exit stubs are mov eax, imm32; ret.
+#define ZR_JIT_MAX_TEMPLATE_BYTES 128u
+#define ZR_JIT_EXIT_STUB_BYTES 6u
+#define ZR_JIT_MAX_FIXUPS_PER_INSTRUCTION 4u
+// slot displacements are encoded as signed disp32
+#define ZR_JIT_MAX_SLOT_BYTE_OFFSET 0x7FFF0000u
+
+#define ZR_JIT_REG_RAX 0u
+#define ZR_JIT_REG_RCX 1u
+
+#define ZR_JIT_CC_NE 0x85u
+#define ZR_JIT_CC_E 0x84u
+#define ZR_JIT_CC_LE 0x8Eu
+#define ZR_JIT_CC_G 0x8Fu
+
+typedef enum EZrJitBinaryKind {
+    ZR_JIT_BINARY_ADD,
+    ZR_JIT_BINARY_SUB,
+    ZR_JIT_BINARY_MUL,
+    ZR_JIT_BINARY_DIV,
+    ZR_JIT_BINARY_MOD
+} EZrJitBinaryKind;
+
+typedef struct SZrJitFixup {
+    TZrUInt32 patchOffset;
+    TZrUInt32 targetIndex;
+    TZrBool toExit;
+} SZrJitFixup;
+
+typedef struct SZrJitAssembler {
+    SZrGlobalState *global;
+    const SZrFunction *function;
+    TZrByte *buffer;
+    TZrSize length;
+    TZrSize capacity;
+    TZrBool overflowed;
+    TZrUInt32 *labelOffsets;
+    TZrUInt32 *exitOffsets;
+    TZrBool *compiled;
+    SZrJitFixup *fixups;
+    TZrUInt32 fixupCount;
+    TZrUInt32 fixupCapacity;
+    SZrJitSlot *slots;
+    TZrUInt32 slotCount;
+    // instruction currently being emitted; guards exit to it
+    TZrUInt32 currentIndex;
+} SZrJitAssembler;
+
+typedef TZrUInt32 (*FZrJitLoopEntry)(TZrStackValuePointer base,
+                                     const volatile TZrDebugSignal *trap,
+                                     const TZrByte *target);
+
+static void jit_emit_byte(SZrJitAssembler *assembler, TZrUInt32 byte) {
+    if (assembler->length >= assembler->capacity) {
+        assembler->overflowed = ZR_TRUE;
+        return;
+    }
+    assembler->buffer[assembler->length++] = (TZrByte)byte;
+}
+
+static void jit_emit_u32(SZrJitAssembler *assembler, TZrUInt32 value) {
+    jit_emit_byte(assembler, value & 0xFFu);
+    jit_emit_byte(assembler, (value >> 8) & 0xFFu);
+    jit_emit_byte(assembler, (value >> 16) & 0xFFu);
+    jit_emit_byte(assembler, (value >> 24) & 0xFFu);
+}
+
+static void jit_emit_u64(SZrJitAssembler *assembler, TZrUInt64 value) {
+    jit_emit_u32(assembler, (TZrUInt32)(value & 0xFFFFFFFFu));
+    jit_emit_u32(assembler, (TZrUInt32)(value >> 32));
+}
+
+// mirrors execution_inline_frame_get_value_slot: VALUE slots with a frame layout live at their layout offset,
+// everything else at the slot's own stack cell. TryRunLoop re-checks the resolved addresses on every entry.
+static TZrUInt32 jit_slot_byte_offset(SZrJitAssembler *assembler, TZrUInt32 stackSlot, TZrBool written) {
+    const SZrFunctionFrameSlotLayout *slotLayout;
+    SZrJitSlot *slot;
+    TZrUInt32 index;
+
+    for (index = 0; index < assembler->slotCount; index++) {
+        if (assembler->slots[index].stackSlot == stackSlot) {
+            assembler->slots[index].written = assembler->slots[index].written || written;
+            return assembler->slots[index].byteOffset;
+        }
+    }
+
+    slot = &assembler->slots[assembler->slotCount++];
+    slot->stackSlot = stackSlot;
+    slot->written = written;
+    slotLayout = ZrCore_Function_FindFrameSlotLayout(assembler->function, stackSlot);
+    if (slotLayout != ZR_NULL && slotLayout->slotKind == (TZrUInt8)ZR_FUNCTION_FRAME_SLOT_KIND_VALUE &&
+        slotLayout->byteSize >= (TZrUInt32)sizeof(SZrTypeValue)) {
+        slot->byteOffset = slotLayout->byteOffset;
+    } else {
+        slot->byteOffset = (TZrUInt32)(stackSlot * sizeof(SZrTypeValueOnStack) + offsetof(SZrTypeValueOnStack, value));
+    }
+    if (slot->byteOffset > ZR_JIT_MAX_SLOT_BYTE_OFFSET) {
+        assembler->overflowed = ZR_TRUE;
+    }
+    return slot->byteOffset;
+}
+
+static TZrUInt32 jit_slot_value_displacement(SZrJitAssembler *assembler, TZrUInt32 stackSlot, TZrBool written) {
+    return jit_slot_byte_offset(assembler, stackSlot, written) + (TZrUInt32)offsetof(SZrTypeValue, value);
+}
+
+static TZrUInt32 jit_slot_type_displacement(SZrJitAssembler *assembler, TZrUInt32 stackSlot, TZrBool written) {
+    return jit_slot_byte_offset(assembler, stackSlot, written) + (TZrUInt32)offsetof(SZrTypeValue, type);
+}
+
+static void jit_emit_branch(SZrJitAssembler *assembler, TZrUInt32 conditionCode, TZrUInt32 targetIndex, TZrBool toExit) {
+    SZrJitFixup *fixup;
+
+    if (conditionCode != 0u) {
+        jit_emit_byte(assembler, 0x0Fu);
+        jit_emit_byte(assembler, conditionCode);
+    } else {
+        jit_emit_byte(assembler, 0xE9u);
+    }
+    if (assembler->fixupCount >= assembler->fixupCapacity) {
+        assembler->overflowed = ZR_TRUE;
+        return;
+    }
+    fixup = &assembler->fixups[assembler->fixupCount++];
+    fixup->patchOffset = (TZrUInt32)assembler->length;
+    fixup->targetIndex = targetIndex;
+    fixup->toExit = toExit;
+    jit_emit_u32(assembler, 0u);
+}
+
+static void jit_emit_exit_if(SZrJitAssembler *assembler, TZrUInt32 conditionCode) {
+    jit_emit_branch(assembler, conditionCode, assembler->currentIndex, ZR_TRUE);
+}
+
+// mov reg, qword [rdi + slot.value]
+static void jit_emit_load_slot(SZrJitAssembler *assembler, TZrUInt32 reg, TZrUInt32 slot) {
+    jit_emit_byte(assembler, 0x48u);
+    jit_emit_byte(assembler, 0x8Bu);
+    jit_emit_byte(assembler, 0x87u | (reg << 3));
+    jit_emit_u32(assembler, jit_slot_value_displacement(assembler, slot, ZR_FALSE));
+}
+
+// mov reg, imm64
+static void jit_emit_load_immediate(SZrJitAssembler *assembler, TZrUInt32 reg, TZrUInt64 value) {
+    jit_emit_byte(assembler, 0x48u);
+    jit_emit_byte(assembler, 0xB8u + reg);
+    jit_emit_u64(assembler, value);
+}
+
+// mov qword [rdi + slot.value], rax; mov [rdi + slot.type], tag
+static void jit_emit_store_rax(SZrJitAssembler *assembler, TZrUInt32 slot, EZrValueType type) {
+    jit_emit_byte(assembler, 0x48u);
+    jit_emit_byte(assembler, 0x89u);
+    jit_emit_byte(assembler, 0x87u);
+    jit_emit_u32(assembler, jit_slot_value_displacement(assembler, slot, ZR_TRUE));
+    if (sizeof(TZrValueTypeTag) == 1u) {
+        jit_emit_byte(assembler, 0xC6u);
+        jit_emit_byte(assembler, 0x87u);
+        jit_emit_u32(assembler, jit_slot_type_displacement(assembler, slot, ZR_TRUE));
+        jit_emit_byte(assembler, (TZrUInt32)type);
+    } else {
+        jit_emit_byte(assembler, 0xC7u);
+        jit_emit_byte(assembler, 0x87u);
+        jit_emit_u32(assembler, jit_slot_type_displacement(assembler, slot, ZR_TRUE));
+        jit_emit_u32(assembler, (TZrUInt32)type);
+    }
+}
+
+// cmp [rdi + slot.type], INT64; jne exit
+static void jit_emit_guard_int64(SZrJitAssembler *assembler, TZrUInt32 slot) {
+    if (sizeof(TZrValueTypeTag) == 1u) {
+        jit_emit_byte(assembler, 0x80u);
+        jit_emit_byte(assembler, 0xBFu);
+        jit_emit_u32(assembler, jit_slot_type_displacement(assembler, slot, ZR_FALSE));
+        jit_emit_byte(assembler, (TZrUInt32)ZR_VALUE_TYPE_INT64);
+    } else {
+        jit_emit_byte(assembler, 0x81u);
+        jit_emit_byte(assembler, 0xBFu);
+        jit_emit_u32(assembler, jit_slot_type_displacement(assembler, slot, ZR_FALSE));
+        jit_emit_u32(assembler, (TZrUInt32)ZR_VALUE_TYPE_INT64);
+    }
+    jit_emit_exit_if(assembler, ZR_JIT_CC_NE);
+}
+
+// cmp dword [rsi], 0; jne exit. keeps debugger signals and hooks observable inside native loops.
+static void jit_emit_trap_poll(SZrJitAssembler *assembler) {
+    jit_emit_byte(assembler, 0x83u);
+    jit_emit_byte(assembler, 0x3Eu);
+    jit_emit_byte(assembler, 0x00u);
+    jit_emit_exit_if(assembler, ZR_JIT_CC_NE);
+}
+
+static void jit_emit_exit_stub(SZrJitAssembler *assembler, TZrUInt32 instructionIndex) {
+    jit_emit_byte(assembler, 0xB8u);
+    jit_emit_u32(assembler, instructionIndex);
+    jit_emit_byte(assembler, 0xC3u);
+}
+
+// rax = rax <op> rcx. division guards rcx against 0 (runtime error path) and -1 (INT64_MIN overflow trap).
+static void jit_emit_binary(SZrJitAssembler *assembler, EZrJitBinaryKind kind) {
+    switch (kind) {
+        case ZR_JIT_BINARY_ADD:
+            jit_emit_byte(assembler, 0x48u);
+            jit_emit_byte(assembler, 0x01u);
+            jit_emit_byte(assembler, 0xC8u);
+            break;
+        case ZR_JIT_BINARY_SUB:
+            jit_emit_byte(assembler, 0x48u);
+            jit_emit_byte(assembler, 0x29u);
+            jit_emit_byte(assembler, 0xC8u);
+            break;
+        case ZR_JIT_BINARY_MUL:
+            jit_emit_byte(assembler, 0x48u);
+            jit_emit_byte(assembler, 0x0Fu);
+            jit_emit_byte(assembler, 0xAFu);
+            jit_emit_byte(assembler, 0xC1u);
+            break;
+        case ZR_JIT_BINARY_DIV:
+        case ZR_JIT_BINARY_MOD:
+            // test rcx, rcx; je exit
+            jit_emit_byte(assembler, 0x48u);
+            jit_emit_byte(assembler, 0x85u);
+            jit_emit_byte(assembler, 0xC9u);
+            jit_emit_exit_if(assembler, ZR_JIT_CC_E);
+            if (kind == ZR_JIT_BINARY_DIV) {
+                // cmp rcx, -1; je exit
+                jit_emit_byte(assembler, 0x48u);
+                jit_emit_byte(assembler, 0x83u);
+                jit_emit_byte(assembler, 0xF9u);
+                jit_emit_byte(assembler, 0xFFu);
+                jit_emit_exit_if(assembler, ZR_JIT_CC_E);
+            } else {
+                // the interpreter takes the modulus of |divisor|: jns +3; neg rcx
+                jit_emit_byte(assembler, 0x79u);
+                jit_emit_byte(assembler, 0x03u);
+                jit_emit_byte(assembler, 0x48u);
+                jit_emit_byte(assembler, 0xF7u);
+                jit_emit_byte(assembler, 0xD9u);
+            }
+            // cqo; idiv rcx
+            jit_emit_byte(assembler, 0x48u);
+            jit_emit_byte(assembler, 0x99u);
+            jit_emit_byte(assembler, 0x48u);
+            jit_emit_byte(assembler, 0xF7u);
+            jit_emit_byte(assembler, 0xF9u);
+            if (kind == ZR_JIT_BINARY_MOD) {
+                // mov rax, rdx
+                jit_emit_byte(assembler, 0x48u);
+                jit_emit_byte(assembler, 0x89u);
+                jit_emit_byte(assembler, 0xD0u);
+            }
+            break;
+        default:
+            assembler->overflowed = ZR_TRUE;
+            break;
+    }
+}
+
+static TZrBool jit_slot_in_frame(const SZrJitAssembler *assembler, TZrUInt32 slot) {
+    return slot != ZR_INSTRUCTION_USE_RET_FLAG && slot < assembler->function->stackSize;
+}
+
+static const SZrTypeValue *jit_int_constant(const SZrJitAssembler *assembler, TZrUInt32 constantIndex) {
+    const SZrTypeValue *constant;
+
+    if (constantIndex >= assembler->function->constantValueLength) {
+        return ZR_NULL;
+    }
+    constant = &assembler->function->constantValueList[constantIndex];
+    return ZR_VALUE_IS_TYPE_INT(constant->type) ? constant : ZR_NULL;
+}
+
+// dest = left <op> right, where right is either a slot or an immediate.
+static TZrBool jit_compile_binary(SZrJitAssembler *assembler,
+                                  EZrJitBinaryKind kind,
+                                  TZrUInt32 destinationSlot,
+                                  TZrUInt32 leftSlot,
+                                  TZrUInt32 rightSlot,
+                                  const TZrInt64 *rightImmediate) {
+    if (!jit_slot_in_frame(assembler, destinationSlot) || !jit_slot_in_frame(assembler, leftSlot) ||
+        (rightImmediate == ZR_NULL && !jit_slot_in_frame(assembler, rightSlot))) {
+        return ZR_FALSE;
+    }
+
+    jit_emit_guard_int64(assembler, leftSlot);
+    if (rightImmediate == ZR_NULL) {
+        jit_emit_guard_int64(assembler, rightSlot);
+    }
+    jit_emit_load_slot(assembler, ZR_JIT_REG_RAX, leftSlot);
+    if (rightImmediate == ZR_NULL) {
+        jit_emit_load_slot(assembler, ZR_JIT_REG_RCX, rightSlot);
+    } else {
+        jit_emit_load_immediate(assembler, ZR_JIT_REG_RCX, (TZrUInt64)*rightImmediate);
+    }
+    jit_emit_binary(assembler, kind);
+    jit_emit_store_rax(assembler, destinationSlot, ZR_VALUE_TYPE_INT64);
+    return ZR_TRUE;
+}
+
+static TZrBool jit_compile_binary_const(SZrJitAssembler *assembler,
+                                        EZrJitBinaryKind kind,
+                                        TZrUInt32 destinationSlot,
+                                        TZrUInt32 leftSlot,
+                                        TZrUInt32 constantIndex) {
+    const SZrTypeValue *constant = jit_int_constant(assembler, constantIndex);
+    TZrInt64 right;
+
+    if (constant == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    right = constant->value.nativeObject.nativeInt64;
+    // constant divisors the interpreter raises on (or that would trap idiv) stay interpreted.
+    if ((kind == ZR_JIT_BINARY_DIV && (right == 0 || right == -1)) ||
+        (kind == ZR_JIT_BINARY_MOD && (right == 0 || right == INT64_MIN))) {
+        return ZR_FALSE;
+    }
+    if (kind == ZR_JIT_BINARY_MOD && right < 0) {
+        right = -right;
+    }
+    return jit_compile_binary(assembler, kind, destinationSlot, leftSlot, 0u, &right);
+}
+
+// if (left <cc> right) goto target, right being a slot or an int constant.
+static TZrBool jit_compile_compare_jump(SZrJitAssembler *assembler,
+                                        TZrUInt32 conditionCode,
+                                        TZrUInt32 leftSlot,
+                                        TZrUInt32 rightSlot,
+                                        const SZrTypeValue *rightConstant,
+                                        TZrInt64 targetIndex) {
+    if (targetIndex < 0 || targetIndex >= (TZrInt64)assembler->function->instructionsLength ||
+        !jit_slot_in_frame(assembler, leftSlot) ||
+        (rightConstant == ZR_NULL && !jit_slot_in_frame(assembler, rightSlot))) {
+        return ZR_FALSE;
+    }
+
+    if (targetIndex <= (TZrInt64)assembler->currentIndex) {
+        jit_emit_trap_poll(assembler);
+    }
+    jit_emit_guard_int64(assembler, leftSlot);
+    if (rightConstant == ZR_NULL) {
+        jit_emit_guard_int64(assembler, rightSlot);
+    }
+    jit_emit_load_slot(assembler, ZR_JIT_REG_RAX, leftSlot);
+    if (rightConstant == ZR_NULL) {
+        jit_emit_load_slot(assembler, ZR_JIT_REG_RCX, rightSlot);
+    } else {
+        jit_emit_load_immediate(assembler, ZR_JIT_REG_RCX, (TZrUInt64)rightConstant->value.nativeObject.nativeInt64);
+    }
+    // cmp rax, rcx
+    jit_emit_byte(assembler, 0x48u);
+    jit_emit_byte(assembler, 0x39u);
+    jit_emit_byte(assembler, 0xC8u);
+    jit_emit_branch(assembler, conditionCode, (TZrUInt32)targetIndex, ZR_FALSE);
+    return ZR_TRUE;
+}
+
+static TZrBool jit_compile_constant_load(SZrJitAssembler *assembler, TZrUInt32 destinationSlot, TZrInt32 constantIndex) {
+    const SZrTypeValue *constant;
+
+    if (!jit_slot_in_frame(assembler, destinationSlot) || constantIndex < 0 ||
+        (TZrUInt32)constantIndex >= assembler->function->constantValueLength) {
+        return ZR_FALSE;
+    }
+    constant = &assembler->function->constantValueList[constantIndex];
+    // only payload-only constants: the destination keeps its plain (non-owning) metadata as-is.
+    if (!(ZR_VALUE_IS_TYPE_NUMBER(constant->type) || ZR_VALUE_IS_TYPE_BOOL(constant->type) ||
+          ZR_VALUE_IS_TYPE_NULL(constant->type)) ||
+        constant->isGarbageCollectable || !constant->isNative ||
+        constant->ownershipKind != ZR_OWNERSHIP_VALUE_KIND_NONE) {
+        return ZR_FALSE;
+    }
+    jit_emit_load_immediate(assembler, ZR_JIT_REG_RAX, constant->value.nativeObject.nativeUInt64);
+    jit_emit_store_rax(assembler, destinationSlot, (EZrValueType)constant->type);
+    return ZR_TRUE;
+}
+
+static TZrBool jit_compile_slot_copy(SZrJitAssembler *assembler, TZrUInt32 destinationSlot, TZrInt32 sourceSlot) {
+    if (!jit_slot_in_frame(assembler, destinationSlot) || sourceSlot < 0 ||
+        !jit_slot_in_frame(assembler, (TZrUInt32)sourceSlot)) {
+        return ZR_FALSE;
+    }
+    jit_emit_guard_int64(assembler, (TZrUInt32)sourceSlot);
+    jit_emit_load_slot(assembler, ZR_JIT_REG_RAX, (TZrUInt32)sourceSlot);
+    jit_emit_store_rax(assembler, destinationSlot, ZR_VALUE_TYPE_INT64);
+    return ZR_TRUE;
+}
+
+// emits one instruction template. returns ZR_FALSE for anything outside the supported subset, in which case
+// the caller emits an exit stub in its place.
+static TZrBool jit_compile_instruction(SZrJitAssembler *assembler, const TZrInstruction *instruction) {
+    TZrUInt32 index = assembler->currentIndex;
+    TZrUInt32 destinationSlot = instruction->instruction.operandExtra;
+    TZrUInt16 operandA1 = instruction->instruction.operand.operand1[0];
+    TZrUInt16 operandB1 = instruction->instruction.operand.operand1[1];
+    TZrUInt8 operandA0 = instruction->instruction.operand.operand0[0];
+    TZrUInt8 operandB0 = instruction->instruction.operand.operand0[1];
+    TZrInt32 operandA2 = instruction->instruction.operand.operand2[0];
+    TZrInt64 branchTarget = (TZrInt64)index + 1 + (TZrInt16)operandB1;
+
+    switch ((EZrInstructionCode)instruction->instruction.operationCode) {
+        case ZR_INSTRUCTION_ENUM(GET_CONSTANT):
+            return jit_compile_constant_load(assembler, destinationSlot, operandA2);
+        case ZR_INSTRUCTION_ENUM(GET_STACK):
+        case ZR_INSTRUCTION_ENUM(SET_STACK):
+            return jit_compile_slot_copy(assembler, destinationSlot, operandA2);
+        case ZR_INSTRUCTION_ENUM(ADD_SIGNED):
+        case ZR_INSTRUCTION_ENUM(ADD_SIGNED_PLAIN_DEST):
+            return jit_compile_binary(assembler, ZR_JIT_BINARY_ADD, destinationSlot, operandA1, operandB1, ZR_NULL);
+        case ZR_INSTRUCTION_ENUM(SUB_SIGNED):
+        case ZR_INSTRUCTION_ENUM(SUB_SIGNED_PLAIN_DEST):
+            return jit_compile_binary(assembler, ZR_JIT_BINARY_SUB, destinationSlot, operandA1, operandB1, ZR_NULL);
+        case ZR_INSTRUCTION_ENUM(MUL_SIGNED):
+        case ZR_INSTRUCTION_ENUM(MUL_SIGNED_PLAIN_DEST):
+            return jit_compile_binary(assembler, ZR_JIT_BINARY_MUL, destinationSlot, operandA1, operandB1, ZR_NULL);
+        case ZR_INSTRUCTION_ENUM(DIV_SIGNED):
+            return jit_compile_binary(assembler, ZR_JIT_BINARY_DIV, destinationSlot, operandA1, operandB1, ZR_NULL);
+        case ZR_INSTRUCTION_ENUM(MOD_SIGNED):
+            return jit_compile_binary(assembler, ZR_JIT_BINARY_MOD, destinationSlot, operandA1, operandB1, ZR_NULL);
+        case ZR_INSTRUCTION_ENUM(ADD_SIGNED_CONST):
+        case ZR_INSTRUCTION_ENUM(ADD_SIGNED_CONST_PLAIN_DEST):
+            return jit_compile_binary_const(assembler, ZR_JIT_BINARY_ADD, destinationSlot, operandA1, operandB1);
+        case ZR_INSTRUCTION_ENUM(SUB_SIGNED_CONST):
+        case ZR_INSTRUCTION_ENUM(SUB_SIGNED_CONST_PLAIN_DEST):
+            return jit_compile_binary_const(assembler, ZR_JIT_BINARY_SUB, destinationSlot, operandA1, operandB1);
+        case ZR_INSTRUCTION_ENUM(MUL_SIGNED_CONST):
+        case ZR_INSTRUCTION_ENUM(MUL_SIGNED_CONST_PLAIN_DEST):
+            return jit_compile_binary_const(assembler, ZR_JIT_BINARY_MUL, destinationSlot, operandA1, operandB1);
+        case ZR_INSTRUCTION_ENUM(DIV_SIGNED_CONST):
+        case ZR_INSTRUCTION_ENUM(DIV_SIGNED_CONST_PLAIN_DEST):
+            return jit_compile_binary_const(assembler, ZR_JIT_BINARY_DIV, destinationSlot, operandA1, operandB1);
+        case ZR_INSTRUCTION_ENUM(MOD_SIGNED_CONST):
+        case ZR_INSTRUCTION_ENUM(MOD_SIGNED_CONST_PLAIN_DEST):
+            return jit_compile_binary_const(assembler, ZR_JIT_BINARY_MOD, destinationSlot, operandA1, operandB1);
+        case ZR_INSTRUCTION_ENUM(ADD_SIGNED_LOAD_STACK):
+            return jit_compile_binary(assembler, ZR_JIT_BINARY_ADD, destinationSlot, operandA0, operandB0, ZR_NULL);
+        case ZR_INSTRUCTION_ENUM(ADD_SIGNED_MOD_CONST): {
+            // the sum goes through the destination slot first, then the modulus reads it back.
+            if (destinationSlot == operandA0 || destinationSlot == operandB0 ||
+                jit_int_constant(assembler, operandB1) == ZR_NULL ||
+                !jit_compile_binary(assembler, ZR_JIT_BINARY_ADD, destinationSlot, operandA0, operandB0, ZR_NULL)) {
+                return ZR_FALSE;
+            }
+            return jit_compile_binary_const(assembler, ZR_JIT_BINARY_MOD, destinationSlot, destinationSlot, operandB1);
+        }
+        case ZR_INSTRUCTION_ENUM(JUMP): {
+            TZrInt64 target = (TZrInt64)index + 1 + operandA2;
+            if (target < 0 || target >= (TZrInt64)assembler->function->instructionsLength) {
+                return ZR_FALSE;
+            }
+            if (target <= (TZrInt64)index) {
+                jit_emit_trap_poll(assembler);
+            }
+            jit_emit_branch(assembler, 0u, (TZrUInt32)target, ZR_FALSE);
+            return ZR_TRUE;
+        }
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_GREATER_SIGNED):
+            return jit_compile_compare_jump(assembler, ZR_JIT_CC_G, destinationSlot, operandA1, ZR_NULL, branchTarget);
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_LESS_EQUAL_SIGNED):
+            return jit_compile_compare_jump(assembler, ZR_JIT_CC_LE, destinationSlot, operandA1, ZR_NULL, branchTarget);
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_NOT_EQUAL_SIGNED):
+            return jit_compile_compare_jump(assembler, ZR_JIT_CC_NE, destinationSlot, operandA1, ZR_NULL, branchTarget);
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_NOT_EQUAL_SIGNED_CONST): {
+            const SZrTypeValue *constant = jit_int_constant(assembler, operandA1);
+            if (constant == ZR_NULL) {
+                return ZR_FALSE;
+            }
+            return jit_compile_compare_jump(assembler, ZR_JIT_CC_NE, destinationSlot, 0u, constant, branchTarget);
+        }
+        default:
+            return ZR_FALSE;
+    }
+}
+
+static TZrInt64 jit_backward_branch_target(const TZrInstruction *instruction, TZrUInt32 index) {
+    switch ((EZrInstructionCode)instruction->instruction.operationCode) {
+        case ZR_INSTRUCTION_ENUM(JUMP):
+            return (TZrInt64)index + 1 + instruction->instruction.operand.operand2[0];
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_GREATER_SIGNED):
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_LESS_EQUAL_SIGNED):
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_NOT_EQUAL_SIGNED):
+        case ZR_INSTRUCTION_ENUM(JUMP_IF_NOT_EQUAL_SIGNED_CONST):
+            return (TZrInt64)index + 1 + (TZrInt16)instruction->instruction.operand.operand1[1];
+        default:
+            return -1;
+    }
+}
+
+// emits the whole function; instructions outside loopBody (when given) become exit stubs unconditionally.
+static TZrBool jit_assemble(SZrJitAssembler *assembler, const TZrBool *loopBody) {
+    const SZrFunction *function = assembler->function;
+    TZrUInt32 count = function->instructionsLength;
+    TZrUInt32 index;
+
+    assembler->length = 0;
+    assembler->fixupCount = 0;
+    assembler->slotCount = 0;
+    assembler->overflowed = ZR_FALSE;
+    for (index = 0; index < count; index++) {
+        assembler->exitOffsets[index] = ZR_JIT_NO_ENTRY;
+    }
+
+    // prologue: jmp rdx (the loop head selected by the caller)
+    jit_emit_byte(assembler, 0xFFu);
+    jit_emit_byte(assembler, 0xE2u);
+
+    for (index = 0; index < count; index++) {
+        TZrSize templateStart = assembler->length;
+        TZrUInt32 fixupStart = assembler->fixupCount;
+        TZrUInt32 slotStart = assembler->slotCount;
+
+        assembler->currentIndex = index;
+        assembler->labelOffsets[index] = (TZrUInt32)templateStart;
+        assembler->compiled[index] = (loopBody == ZR_NULL || loopBody[index]) &&
+                                     jit_compile_instruction(assembler, &function->instructionsList[index]);
+        if (!assembler->compiled[index]) {
+            // roll back a partially emitted template and leave the instruction to the interpreter.
+            assembler->length = templateStart;
+            assembler->fixupCount = fixupStart;
+            assembler->slotCount = slotStart;
+            assembler->exitOffsets[index] = (TZrUInt32)templateStart;
+            jit_emit_exit_stub(assembler, index);
+        }
+        if (assembler->overflowed) {
+            return ZR_FALSE;
+        }
+    }
+
+    for (index = 0; index < assembler->fixupCount; index++) {
+        SZrJitFixup *fixup = &assembler->fixups[index];
+        if (fixup->toExit && assembler->exitOffsets[fixup->targetIndex] == ZR_JIT_NO_ENTRY) {
+            assembler->exitOffsets[fixup->targetIndex] = (TZrUInt32)assembler->length;
+            jit_emit_exit_stub(assembler, fixup->targetIndex);
+        }
+    }
+    if (assembler->overflowed) {
+        return ZR_FALSE;
+    }
+
+    for (index = 0; index < assembler->fixupCount; index++) {
+        SZrJitFixup *fixup = &assembler->fixups[index];
+        TZrUInt32 target = fixup->toExit ? assembler->exitOffsets[fixup->targetIndex]
+                                         : assembler->labelOffsets[fixup->targetIndex];
+        TZrInt32 relative = (TZrInt32)((TZrInt64)target - (TZrInt64)(fixup->patchOffset + 4u));
+        memcpy(assembler->buffer + fixup->patchOffset, &relative, sizeof(relative));
+    }
+    return ZR_TRUE;
+}
+
+// marks the bodies of backward branches whose every instruction compiled. returns the number of loop heads.
+static TZrUInt32 jit_mark_loops(const SZrJitAssembler *assembler, TZrBool *loopBody, TZrBool *loopHeads) {
+    const SZrFunction *function = assembler->function;
+    TZrUInt32 headCount = 0;
+    TZrUInt32 index;
+
+    for (index = 0; index < function->instructionsLength; index++) {
+        TZrInt64 target = jit_backward_branch_target(&function->instructionsList[index], index);
+        TZrUInt32 bodyIndex;
+        TZrBool covered = assembler->compiled[index];
+
+        if (target < 0 || target > (TZrInt64)index) {
+            continue;
+        }
+        for (bodyIndex = (TZrUInt32)target; bodyIndex <= index && covered; bodyIndex++) {
+            covered = assembler->compiled[bodyIndex];
+        }
+        if (!covered) {
+            continue;
+        }
+        for (bodyIndex = (TZrUInt32)target; bodyIndex <= index; bodyIndex++) {
+            loopBody[bodyIndex] = ZR_TRUE;
+        }
+        if (!loopHeads[target]) {
+            loopHeads[target] = ZR_TRUE;
+            headCount++;
+        }
+    }
+    return headCount;
+}
+
+static TZrBool jit_value_is_plain(const SZrTypeValue *value) {
+    return value->ownershipKind == ZR_OWNERSHIP_VALUE_KIND_NONE && value->ownershipControl == ZR_NULL &&
+           value->ownershipWeakRef == ZR_NULL && !value->isGarbageCollectable && value->isNative;
+}
+
+#endif // ZR_JIT_SUPPORTED
+
+TZrBool ZrCore_Jit_CompileFunction(SZrState *state, SZrFunction *function) {
+#if ZR_JIT_SUPPORTED
+    SZrGlobalState *global;
+    SZrJitAssembler assembler;
+    SZrJitCode *code = ZR_NULL;
+    TZrBool *loopBody;
+    TZrBool *loopHeads;
+    TZrUInt32 count;
+    TZrUInt32 index;
+    TZrSize pageSize;
+    TZrSize scratchSize;
+    TZrByte *scratch;
+    TZrBool succeeded = ZR_FALSE;
+
+    if (state == ZR_NULL || state->global == ZR_NULL || function == ZR_NULL || function->jitCode != ZR_NULL) {
+        return function != ZR_NULL && function->jitCode != ZR_NULL;
+    }
+    // the trap word is polled as a 32-bit load on back-edges.
+    count = function->instructionsLength;
+    if (count == 0 || function->instructionsList == ZR_NULL || function->stackSize == 0u ||
+        sizeof(TZrDebugSignal) != 4u) {
+        function->jitHotness = ZR_JIT_HOTNESS_DISABLED;
+        return ZR_FALSE;
+    }
+
+    global = state->global;
+    memset(&assembler, 0, sizeof(assembler));
+    assembler.global = global;
+    assembler.function = function;
+    assembler.fixupCapacity = count * ZR_JIT_MAX_FIXUPS_PER_INSTRUCTION;
+    scratchSize = sizeof(SZrJitFixup) * (TZrSize)assembler.fixupCapacity +
+                  sizeof(SZrJitSlot) * (TZrSize)function->stackSize + sizeof(TZrUInt32) * (TZrSize)count * 2u +
+                  sizeof(TZrBool) * (TZrSize)count * 3u;
+    scratch = (TZrByte *)ZrCore_Memory_RawMallocWithType(global, scratchSize, ZR_MEMORY_NATIVE_TYPE_JIT_CODE);
+    if (scratch == ZR_NULL) {
+        function->jitHotness = ZR_JIT_HOTNESS_DISABLED;
+        return ZR_FALSE;
+    }
+    memset(scratch, 0, scratchSize);
+    assembler.fixups = (SZrJitFixup *)scratch;
+    assembler.slots = (SZrJitSlot *)(assembler.fixups + assembler.fixupCapacity);
+    assembler.labelOffsets = (TZrUInt32 *)(assembler.slots + function->stackSize);
+    assembler.exitOffsets = assembler.labelOffsets + count;
+    assembler.compiled = (TZrBool *)(assembler.exitOffsets + count);
+    loopBody = assembler.compiled + count;
+    loopHeads = loopBody + count;
+
+    pageSize = (TZrSize)sysconf(_SC_PAGESIZE);
+    assembler.capacity = (TZrSize)count * (ZR_JIT_MAX_TEMPLATE_BYTES + ZR_JIT_EXIT_STUB_BYTES) + 16u;
+    assembler.capacity = (assembler.capacity + pageSize - 1u) / pageSize * pageSize;
+    assembler.buffer = (TZrByte *)mmap(ZR_NULL,
+                                       assembler.capacity,
+                                       PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS,
+                                       -1,
+                                       0);
+    if (assembler.buffer == (TZrByte *)MAP_FAILED) {
+        assembler.buffer = ZR_NULL;
+    }
+
+    // the first pass finds which loops compile completely; the second emits only those loop bodies, so the
+    // slots checked on entry are exactly the ones native code can reach.
+    if (assembler.buffer != ZR_NULL && jit_assemble(&assembler, ZR_NULL) &&
+        jit_mark_loops(&assembler, loopBody, loopHeads) > 0 && jit_assemble(&assembler, loopBody)) {
+        code = (SZrJitCode *)ZrCore_Memory_RawMallocWithType(global,
+                                                             jit_code_metadata_size(count, assembler.slotCount),
+                                                             ZR_MEMORY_NATIVE_TYPE_JIT_CODE);
+    }
+    if (code != ZR_NULL) {
+        memset(code, 0, sizeof(*code));
+        code->code = assembler.buffer;
+        code->codeCapacity = assembler.capacity;
+        code->instructionCount = count;
+        code->slotCount = assembler.slotCount;
+        code->slots = (SZrJitSlot *)(code + 1);
+        code->entryOffsets = (TZrUInt32 *)(code->slots + assembler.slotCount);
+        memcpy(code->slots, assembler.slots, sizeof(SZrJitSlot) * assembler.slotCount);
+        for (index = 0; index < count; index++) {
+            code->entryOffsets[index] = loopHeads[index] && assembler.compiled[index] ? assembler.labelOffsets[index]
+                                                                                     : ZR_JIT_NO_ENTRY;
+        }
+
+        if (mprotect(assembler.buffer, assembler.capacity, PROT_READ | PROT_EXEC) == 0) {
+            code->function = function;
+            code->nextAllocated = global->jitCodeAllocations;
+            if (global->jitCodeAllocations != ZR_NULL) {
+                global->jitCodeAllocations->previousAllocated = code;
+            }
+            global->jitCodeAllocations = code;
+            function->jitCode = code;
+            succeeded = ZR_TRUE;
+        } else {
+            code->code = ZR_NULL;
+            jit_code_free(global, code);
+        }
+    }
+
+    if (!succeeded) {
+        if (assembler.buffer != ZR_NULL) {
+            munmap(assembler.buffer, assembler.capacity);
+        }
+        function->jitHotness = ZR_JIT_HOTNESS_DISABLED;
+    }
+    ZrCore_Memory_RawFreeWithType(global, scratch, scratchSize, ZR_MEMORY_NATIVE_TYPE_JIT_CODE);
+    return succeeded;
+#else
+    ZR_UNUSED_PARAMETER(state);
+    if (function != ZR_NULL) {
+        function->jitHotness = ZR_JIT_HOTNESS_DISABLED;
+    }
+    return ZR_FALSE;
+#endif
+}
+
+TZrBool ZrCore_Jit_TryRunLoop(SZrState *state,
+                              SZrFunction *function,
+                              TZrStackValuePointer base,
+                              const volatile TZrDebugSignal *trap,
+                              TZrUInt32 loopHeadIndex,
+                              TZrUInt32 *outResumeIndex) {
+#if ZR_JIT_SUPPORTED
+    SZrJitCode *code = function->jitCode;
+    FZrJitLoopEntry entry;
+    TZrUInt32 index;
+
+    if (code == ZR_NULL) {
+        if (function->jitHotness == ZR_JIT_HOTNESS_DISABLED || ++function->jitHotness < ZR_JIT_HOTNESS_THRESHOLD ||
+            !ZrCore_Jit_CompileFunction(state, function)) {
+            return ZR_FALSE;
+        }
+        code = function->jitCode;
+    }
+    if (loopHeadIndex >= code->instructionCount || code->entryOffsets[loopHeadIndex] == ZR_JIT_NO_ENTRY) {
+        return ZR_FALSE;
+    }
+
+    // slot addresses were fixed at compile time and compiled stores only rewrite payload and tag, so every slot
+    // must resolve where the code expects it and every written slot must already be non-owning.
+    for (index = 0; index < code->slotCount; index++) {
+        const SZrJitSlot *slot = &code->slots[index];
+        SZrTypeValue *value = execution_inline_frame_get_value_slot(state, function, base, slot->stackSlot);
+
+        if (value != (SZrTypeValue *)((TZrByte *)base + slot->byteOffset) ||
+            (slot->written && !jit_value_is_plain(value))) {
+            code->rejectedEntryCount++;
+            return ZR_FALSE;
+        }
+    }
+
+    memcpy(&entry, &code->code, sizeof(entry));
+    code->entryCount++;
+    *outResumeIndex = entry(base, trap, code->code + code->entryOffsets[loopHeadIndex]);
+    return ZR_TRUE;
+#else
+    ZR_UNUSED_PARAMETER(state);
+    ZR_UNUSED_PARAMETER(function);
+    ZR_UNUSED_PARAMETER(base);
+    ZR_UNUSED_PARAMETER(trap);
+    ZR_UNUSED_PARAMETER(loopHeadIndex);
+    ZR_UNUSED_PARAMETER(outResumeIndex);
+    return ZR_FALSE;
+#endif
+}
@@ -564,6 +564,8 @@ static void execution_member_store_pic_slot(SZrState *state,
     SZrString *cachedMemberName;
     SZrObject *cachedReceiverObject;
     SZrHashKeyValuePair *cachedReceiverPair;
+    const SZrObjectShape *cachedReceiverShape;
+    TZrUInt32 cachedShapeSlotIndex;
     EZrFunctionCallSitePicAccessKind accessKind;
     TZrUInt8 slotFlags;
     EZrFunctionCallSitePicHotFieldKind hotFieldKind;
@@ -627,6 +629,7 @@ static void execution_member_store_pic_slot(SZrState *state,
         object_get_own_string_value_by_name_cached_unchecked(state, receiverObject, cachedMemberName) == ZR_NULL) {
         cachedReceiverObject = receiverObject;
     }
+    object_shape_resolve_pair_slot(cachedReceiverObject, cachedReceiverPair, &cachedReceiverShape, &cachedShapeSlotIndex);
     slotFlags = execution_member_resolve_pic_slot_flags(state, accessKind, cachedMemberName);
 
     if (execution_member_callsite_sanitize_enabled()) {
@@ -639,6 +642,8 @@ static void execution_member_store_pic_slot(SZrState *state,
             slot->cachedOwnerPrototype = ownerPrototype;
             slot->cachedReceiverObject = cachedReceiverObject;
             slot->cachedReceiverPair = cachedReceiverPair;
+            slot->cachedReceiverShape = cachedReceiverShape;
+            slot->cachedShapeSlotIndex = cachedShapeSlotIndex;
             slot->cachedReceiverVersion = receiverPrototype->super.memberVersion;
             slot->cachedOwnerVersion = ownerPrototype->super.memberVersion;
             slot->cachedDescriptorIndex = descriptorIndex;
@@ -694,6 +699,8 @@ static void execution_member_store_pic_slot(SZrState *state,
     slot->cachedOwnerPrototype = ownerPrototype;
     slot->cachedReceiverObject = cachedReceiverObject;
     slot->cachedReceiverPair = cachedReceiverPair;
+    slot->cachedReceiverShape = cachedReceiverShape;
+    slot->cachedShapeSlotIndex = cachedShapeSlotIndex;
     slot->cachedReceiverVersion = receiverPrototype->super.memberVersion;
     slot->cachedOwnerVersion = ownerPrototype->super.memberVersion;
     slot->cachedDescriptorIndex = descriptorIndex;
@@ -1130,6 +1137,10 @@ static ZR_FORCE_INLINE TZrBool execution_member_try_cached_instance_field_object
     pair = hotPairSlot != ZR_NULL
                    ? object_try_match_cached_string_pair_by_name_unchecked(state, *hotPairSlot, memberName)
                    : ZR_NULL;
+    if (pair == ZR_NULL && slot != ZR_NULL) {
+        pair = object_shape_try_get_slot_pair_unchecked(
+                object, slot->cachedReceiverShape, slot->cachedShapeSlotIndex, memberName);
+    }
     if (pair == ZR_NULL) {
         pair = object_get_own_string_pair_by_name_cached_unchecked(state, object, memberName);
         if (pair != ZR_NULL && hotPairSlot != ZR_NULL) {
@@ -1166,6 +1177,10 @@ static ZR_FORCE_INLINE TZrBool execution_member_try_cached_instance_field_object
     pair = hotPairSlot != ZR_NULL
                    ? object_try_match_cached_string_pair_by_name_unchecked(state, *hotPairSlot, memberName)
                    : ZR_NULL;
+    if (pair == ZR_NULL && slot != ZR_NULL) {
+        pair = object_shape_try_get_slot_pair_unchecked(
+                object, slot->cachedReceiverShape, slot->cachedShapeSlotIndex, memberName);
+    }
     if (pair == ZR_NULL) {
         pair = object_get_own_string_pair_by_name_cached_unchecked(state, object, memberName);
         if (pair != ZR_NULL && hotPairSlot != ZR_NULL) {
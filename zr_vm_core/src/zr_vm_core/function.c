@@ -7,6 +7,8 @@
 #include "zr_vm_core/closure.h"
 #include "zr_vm_core/execution.h"
 #include "zr_vm_core/gc.h"
+#include "zr_vm_core/io.h"
+#include "zr_vm_core/jit.h"
 #include "zr_vm_core/log.h"
 #include "zr_vm_core/memory.h"
 #include "zr_vm_core/meta.h"
@@ -254,6 +256,9 @@ SZrFunction *ZrCore_Function_New(struct SZrState *state) {
     function->moduleMetadataBindings = ZR_NULL;
     function->moduleMetadataBindingLength = 0;
     function->moduleMetadataBindingCapacity = 0;
+    function->jitCode = ZR_NULL;
+    function->jitHotness = 0;
+    function->lazyBody = ZR_NULL;
     function->localVariableList = ZR_NULL;
     function->localVariableLength = 0;
     function->lineInSourceStart = 0;
@@ -332,6 +337,11 @@ SZrFunction *ZrCore_Function_New(struct SZrState *state) {
     return function;
 }
 
+// lazy shells keep their instruction count in the lazy body until the first call decodes it
+static TZrUInt32 function_effective_instructions_length(const SZrFunction *function) {
+    return function->lazyBody != ZR_NULL ? function->lazyBody->instructionsLength : function->instructionsLength;
+}
+
 static TZrBool function_matches_inline_child(const SZrFunction *left, const SZrFunction *right) {
     TZrBool sameFunctionName;
 
@@ -345,7 +355,7 @@ static TZrBool function_matches_inline_child(const SZrFunction *left, const SZrF
 
     return sameFunctionName &&
            left->parameterCount == right->parameterCount &&
-           left->instructionsLength == right->instructionsLength &&
+           function_effective_instructions_length(left) == function_effective_instructions_length(right) &&
            left->lineInSourceStart == right->lineInSourceStart &&
            left->lineInSourceEnd == right->lineInSourceEnd;
 }
@@ -1091,6 +1101,9 @@ static void function_reset_to_tombstone(SZrFunction *function) {
     function->moduleMetadataBindings = ZR_NULL;
     function->moduleMetadataBindingLength = 0;
     function->moduleMetadataBindingCapacity = 0;
+    function->jitCode = ZR_NULL;
+    function->jitHotness = 0;
+    function->lazyBody = ZR_NULL;
     function->lineInSourceStart = 0;
     function->lineInSourceEnd = 0;
     function->cachedStatelessClosure = ZR_NULL;
@@ -1100,6 +1113,23 @@ void ZrCore_Function_DetachOwnedBuffers(SZrFunction *function) {
     function_reset_to_tombstone(function);
 }
 
+void ZrCore_Function_ReleaseLazyBodies(struct SZrState *state, SZrFunction *function) {
+    if (function->lazyBody != ZR_NULL) {
+        ZrCore_Io_ResidentImage_Release(state, function->lazyBody->image);
+        ZrCore_Memory_RawFreeWithType(state->global,
+                                      function->lazyBody,
+                                      sizeof(SZrFunctionLazyBody),
+                                      ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+        function->lazyBody = ZR_NULL;
+    }
+    // inline children are not on the collector's object list, so their shells are released with the owner
+    if (!function->childFunctionGraphIsBorrowed && function->childFunctionList != ZR_NULL) {
+        for (TZrUInt32 childIndex = 0; childIndex < function->childFunctionLength; childIndex++) {
+            ZrCore_Function_ReleaseLazyBodies(state, &function->childFunctionList[childIndex]);
+        }
+    }
+}
+
 void ZrCore_Function_Free(struct SZrState *state, SZrFunction *function) {
     SZrGlobalState *global = state->global;
     ZR_ASSERT(function != ZR_NULL);
@@ -1134,6 +1164,8 @@ void ZrCore_Function_Free(struct SZrState *state, SZrFunction *function) {
         }
     }
     ZrCore_Function_FreePrototypeFrameTypeLayoutCache(state, function);
+    ZrCore_Jit_FreeFunctionCode(global, function);
+    ZrCore_Function_ReleaseLazyBodies(state, function);
     if (function->instructionsList != ZR_NULL && function->instructionsLength > 0) {
         ZR_MEMORY_RAW_FREE_LIST(global, function->instructionsList, function->instructionsLength);
     }
@@ -3103,6 +3135,7 @@ TZrBool ZrCore_Function_TryReuseTailVmCall(struct SZrState *state,
         return ZR_FALSE;
     }
 
+    ZrCore_Function_EnsureMaterialized(state, function);
     if (function_precall_has_inline_frame_parameters(function)) {
         return ZR_FALSE;
     }
@@ -3527,6 +3560,7 @@ static ZR_FORCE_INLINE SZrCallInfo *function_pre_call_resolved_vm_internal(struc
     ZR_ASSERT(stackPointer != ZR_NULL);
     ZR_ASSERT(function != ZR_NULL);
 
+    ZrCore_Function_EnsureMaterialized(state, function);
     parametersCount = function->parameterCount;
     stackSize = function->stackSize;
     frameStorageSlotCount = ZrCore_Function_GetFrameStorageSlotCount(function);
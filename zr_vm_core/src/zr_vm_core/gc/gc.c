@@ -13,7 +13,7 @@
 #include <time.h>
 #endif
 
-static TZrUInt64 garbage_collector_now_us(void) {
+TZrUInt64 garbage_collector_now_us(void) {
 #if defined(ZR_PLATFORM_WIN)
     static LARGE_INTEGER frequency = {0};
     LARGE_INTEGER counter;
@@ -391,6 +391,12 @@ void ZrCore_GarbageCollector_New(SZrGlobalState *global) {
     gc->pauseBudgetUs = 2000u;
     gc->remarkBudgetUs = 1000u;
     gc->workerCount = 1u;
+    gc->parallelMarkActive = ZR_FALSE;
+    gc->parallelMarker = ZR_NULL;
+    gc->backgroundSweepEnabled = ZR_FALSE;
+    gc->backgroundSweeper = ZR_NULL;
+    gc->nurseryEnabled = garbage_collector_nursery_forced_by_environment();
+    gc->nursery = ZR_NULL;
     gc->fragmentationCompactThreshold = 35u;
     gc->gcFlags = 0u;
     gc->scheduledCollectionKind = ZR_GARBAGE_COLLECT_COLLECTION_KIND_MINOR;
@@ -429,6 +435,27 @@ void ZrCore_GarbageCollector_New(SZrGlobalState *global) {
     gc->statsSnapshot.lastCollectionKind = ZR_GARBAGE_COLLECT_COLLECTION_KIND_MINOR;
     gc->statsSnapshot.lastRequestedCollectionKind = ZR_GARBAGE_COLLECT_COLLECTION_KIND_MINOR;
     gc->statsSnapshot.collectionPhase = ZR_GARBAGE_COLLECT_COLLECTION_PHASE_IDLE;
+    gc->statsSnapshot.lastMarkWorkerCount = 0u;
+    gc->statsSnapshot.parallelMarkCount = 0u;
+    memset(gc->statsSnapshot.lastMarkWorkerObjects, 0, sizeof(gc->statsSnapshot.lastMarkWorkerObjects));
+    memset(gc->statsSnapshot.lastMarkWorkerWork, 0, sizeof(gc->statsSnapshot.lastMarkWorkerWork));
+    memset(gc->statsSnapshot.lastMarkWorkerSteals, 0, sizeof(gc->statsSnapshot.lastMarkWorkerSteals));
+    gc->statsSnapshot.backgroundSweepEnabled = ZR_FALSE;
+    gc->statsSnapshot.backgroundSweepBatchCount = 0u;
+    gc->statsSnapshot.backgroundSweepObjectCount = 0u;
+    gc->statsSnapshot.backgroundSweepFreeCount = 0u;
+    gc->statsSnapshot.backgroundSweepBytes = 0u;
+    gc->statsSnapshot.backgroundSweepDurationUs = 0u;
+    gc->statsSnapshot.nurseryEnabled = gc->nurseryEnabled;
+    gc->statsSnapshot.nurseryChunkCount = 0u;
+    gc->statsSnapshot.nurseryCapacityBytes = 0u;
+    gc->statsSnapshot.nurseryUsedBytes = 0u;
+    gc->statsSnapshot.nurseryAllocationCount = 0u;
+    gc->statsSnapshot.nurseryFallbackCount = 0u;
+    gc->statsSnapshot.nurseryEvacuatedCount = 0u;
+    gc->statsSnapshot.nurseryEvacuatedBytes = 0u;
+    gc->statsSnapshot.nurseryRetainedCount = 0u;
+    gc->statsSnapshot.nurseryChunkResetCount = 0u;
     memset(gc->collectionCounts, 0, sizeof(gc->collectionCounts));
     memset(gc->collectionTotalDurationUs, 0, sizeof(gc->collectionTotalDurationUs));
     memset(gc->collectionMaxDurationUs, 0, sizeof(gc->collectionMaxDurationUs));
@@ -444,6 +471,8 @@ void ZrCore_GarbageCollector_Free(SZrGlobalState *global, SZrGarbageCollector *c
     }
 
     collector->ignoredObjectCount = 0;
+    // shutdown frees everything inline; pending batches must be gone before the allocator is.
+    garbage_collector_background_sweep_shutdown(global);
 
     if (global->mainThreadState != ZR_NULL) {
         SZrState *state = global->mainThreadState;
@@ -510,6 +539,8 @@ void ZrCore_GarbageCollector_Free(SZrGlobalState *global, SZrGarbageCollector *c
     }
     collector->regionCount = 0;
     collector->regionCapacity = 0;
+    garbage_collector_parallel_mark_shutdown(global);
+    garbage_collector_nursery_shutdown(global);
 
     ZrCore_Memory_RawFreeWithType(global, collector, sizeof(SZrGarbageCollector), ZR_MEMORY_NATIVE_TYPE_MANAGER);
 }
@@ -645,6 +676,7 @@ void ZrCore_GarbageCollector_GcFull(SZrState *state, TZrBool isImmediate) {
     collector->collectionPhase = ZR_GARBAGE_COLLECT_COLLECTION_PHASE_IDLE;
     collector->statsSnapshot.collectionPhase = collector->collectionPhase;
     collector->gcLastStepWork = work > 0 ? work : 1;
+    garbage_collector_background_sweep_flush(global);
     garbage_collector_record_step_telemetry(collector, startedUs);
     if (collector->gcRunningStatus == ZR_GARBAGE_COLLECT_RUNNING_STATUS_PAUSED) {
         collector->gcStatus = ZR_GARBAGE_COLLECT_STATUS_STOP_BY_SELF;
@@ -739,6 +771,7 @@ void ZrCore_GarbageCollector_GcStep(SZrState *state) {
         (statusBefore != collector->gcRunningStatus || debtBefore != collector->gcDebtSize)) {
         collector->gcLastStepWork = 1;
     }
+    garbage_collector_background_sweep_flush(global);
     garbage_collector_record_step_telemetry(collector, startedUs);
     collector->gcLastCompletedRunningStatus = collector->gcRunningStatus;
 }
@@ -775,6 +808,37 @@ void ZrCore_GarbageCollector_SetWorkerCount(SZrGlobalState *global, TZrUInt32 wo
     global->garbageCollector->statsSnapshot.workerCount = workerCount;
 }
 
+void ZrCore_GarbageCollector_SetBackgroundSweep(SZrGlobalState *global, TZrBool enabled) {
+    if (global == ZR_NULL || global->garbageCollector == ZR_NULL) {
+        return;
+    }
+
+    if (!enabled && global->garbageCollector->backgroundSweepEnabled) {
+        garbage_collector_background_sweep_flush(global);
+        garbage_collector_background_sweep_wait(global);
+    }
+    global->garbageCollector->backgroundSweepEnabled = enabled ? ZR_TRUE : ZR_FALSE;
+    global->garbageCollector->statsSnapshot.backgroundSweepEnabled = global->garbageCollector->backgroundSweepEnabled;
+}
+
+void ZrCore_GarbageCollector_WaitBackgroundSweep(SZrGlobalState *global) {
+    if (global == ZR_NULL || global->garbageCollector == ZR_NULL) {
+        return;
+    }
+
+    garbage_collector_background_sweep_flush(global);
+    garbage_collector_background_sweep_wait(global);
+}
+
+void ZrCore_GarbageCollector_SetNursery(SZrGlobalState *global, TZrBool enabled) {
+    if (global == ZR_NULL || global->garbageCollector == ZR_NULL) {
+        return;
+    }
+
+    global->garbageCollector->nurseryEnabled = enabled ? ZR_TRUE : ZR_FALSE;
+    global->garbageCollector->statsSnapshot.nurseryEnabled = global->garbageCollector->nurseryEnabled;
+}
+
 void ZrCore_GarbageCollector_ScheduleCollection(SZrGlobalState *global, EZrGarbageCollectCollectionKind kind) {
     garbage_collector_schedule_collection_internal(global, kind, ZR_TRUE);
 }
@@ -788,6 +852,8 @@ void ZrCore_GarbageCollector_GetStatsSnapshot(SZrGlobalState *global, SZrGarbage
     global->garbageCollector->statsSnapshot.pauseBudgetUs = global->garbageCollector->pauseBudgetUs;
     global->garbageCollector->statsSnapshot.remarkBudgetUs = global->garbageCollector->remarkBudgetUs;
     global->garbageCollector->statsSnapshot.workerCount = global->garbageCollector->workerCount;
+    garbage_collector_background_sweep_refresh_snapshot(global->garbageCollector);
+    garbage_collector_nursery_refresh_snapshot(global->garbageCollector);
     garbage_collector_refresh_pressure_snapshot(global->garbageCollector);
     global->garbageCollector->statsSnapshot.rememberedObjectCount =
             (TZrUInt32)global->garbageCollector->rememberedObjectCount;
@@ -866,6 +932,12 @@ void ZrCore_GarbageCollector_PinObject(SZrState *state,
     if ((pinKind & ZR_GARBAGE_COLLECT_PIN_KIND_PERSISTENT_ROOT) != 0) {
         escapeFlags |= ZR_GARBAGE_COLLECT_ESCAPE_KIND_GLOBAL_ROOT;
     }
+    // a pinned nursery resident becomes old in place and keeps its chunk until it dies.
+    if (object->garbageCollectMark.nurseryChunkId != 0u &&
+        object->garbageCollectMark.storageKind == ZR_GARBAGE_COLLECT_STORAGE_KIND_YOUNG_MOVABLE &&
+        state->global->garbageCollector->nursery != ZR_NULL) {
+        state->global->garbageCollector->nursery->retainedCount++;
+    }
     ZrCore_RawObject_SetStorageKind(object, ZR_GARBAGE_COLLECT_STORAGE_KIND_OLD_PINNED);
     ZrCore_RawObject_SetRegionKind(object, ZR_GARBAGE_COLLECT_REGION_KIND_PINNED);
     object->garbageCollectMark.regionId = garbage_collector_reassign_region_id_cached(
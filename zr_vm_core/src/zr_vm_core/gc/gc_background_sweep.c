@@ -0,0 +1,303 @@
+//
+// Background sweep: hands the allocator frees of swept objects to a helper thread.
+//
+
+#include "gc/gc_internal.h"
+
+#include "gc/gc_thread.h"
+
+// batches kept for reuse once the sweeper thread has drained them; extra ones go back to the allocator.
+#define ZR_GC_BACKGROUND_SWEEP_SPARE_BATCH_MAX 8u
+
+typedef struct SZrGcSweepFree {
+    TZrPtr pointer;
+    TZrSize size;
+    EZrMemoryNativeType type;
+} SZrGcSweepFree;
+
+typedef struct SZrGcSweepBatch {
+    struct SZrGcSweepBatch *next;
+    TZrUInt32 count;
+    TZrUInt32 objectCount;
+    TZrUInt64 bytes;
+    SZrGcSweepFree frees[ZR_GC_BACKGROUND_SWEEP_BATCH_CAPACITY];
+} SZrGcSweepBatch;
+
+typedef struct SZrGcBackgroundSweeper {
+    SZrGlobalState *global;
+    // batch being filled by the collecting thread; never seen by the sweeper thread until queued.
+    SZrGcSweepBatch *filling;
+
+    // everything below is guarded by lock.
+    ZrGcMutex lock;
+    ZrGcCondition idleCondition;
+    SZrGcSweepBatch *queueHead;
+    SZrGcSweepBatch *queueTail;
+    SZrGcSweepBatch *spareBatches;
+    TZrUInt32 spareBatchCount;
+    ZrGcThread thread;
+    // running: the thread is draining the queue; joinPending: it exited and still has to be joined.
+    TZrBool running;
+    TZrBool joinPending;
+
+    TZrUInt64 batchCount;
+    TZrUInt64 objectCount;
+    TZrUInt64 freeCount;
+    TZrUInt64 bytes;
+    TZrUInt64 durationUs;
+} SZrGcBackgroundSweeper;
+
+static void gc_sweep_batch_free_all(SZrGlobalState *global, SZrGcSweepBatch *batch) {
+    for (TZrUInt32 index = 0; index < batch->count; index++) {
+        SZrGcSweepFree *entry = &batch->frees[index];
+
+        ZrCore_Memory_RawFreeWithType(global, entry->pointer, entry->size, entry->type);
+    }
+}
+
+// the caller holds sweeper->lock.
+static void gc_sweep_recycle_batch(SZrGcBackgroundSweeper *sweeper, SZrGcSweepBatch *batch) {
+    if (sweeper->spareBatchCount < ZR_GC_BACKGROUND_SWEEP_SPARE_BATCH_MAX) {
+        batch->next = sweeper->spareBatches;
+        sweeper->spareBatches = batch;
+        sweeper->spareBatchCount++;
+        return;
+    }
+    ZrCore_Memory_RawFreeWithType(sweeper->global, batch, sizeof(SZrGcSweepBatch), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+}
+
+/*
+ * The thread exits as soon as the queue is empty instead of parking. Allocators with thread caches (the builtin
+ * pooled allocator) hand a thread's freed blocks back for reuse when it exits, so a parked sweeper would keep
+ * every block it freed out of the mutator's reach.
+ */
+static ZR_GC_THREAD_ROUTINE(gc_sweep_thread_main, argument) {
+    SZrGcBackgroundSweeper *sweeper = (SZrGcBackgroundSweeper *)argument;
+
+    gc_thread_mutex_lock(&sweeper->lock);
+    while (sweeper->queueHead != ZR_NULL) {
+        SZrGcSweepBatch *batch = sweeper->queueHead;
+        TZrUInt64 startedUs;
+        TZrUInt64 finishedUs;
+
+        sweeper->queueHead = batch->next;
+        if (sweeper->queueHead == ZR_NULL) {
+            sweeper->queueTail = ZR_NULL;
+        }
+        gc_thread_mutex_unlock(&sweeper->lock);
+
+        startedUs = garbage_collector_now_us();
+        gc_sweep_batch_free_all(sweeper->global, batch);
+        finishedUs = garbage_collector_now_us();
+
+        gc_thread_mutex_lock(&sweeper->lock);
+        sweeper->batchCount++;
+        sweeper->objectCount += batch->objectCount;
+        sweeper->freeCount += batch->count;
+        sweeper->bytes += batch->bytes;
+        sweeper->durationUs += finishedUs >= startedUs ? finishedUs - startedUs : 0u;
+        gc_sweep_recycle_batch(sweeper, batch);
+    }
+    sweeper->running = ZR_FALSE;
+    sweeper->joinPending = ZR_TRUE;
+    gc_thread_condition_broadcast(&sweeper->idleCondition);
+    gc_thread_mutex_unlock(&sweeper->lock);
+    ZR_GC_THREAD_ROUTINE_RETURN;
+}
+
+static SZrGcBackgroundSweeper *gc_sweep_acquire_sweeper(SZrGlobalState *global) {
+    SZrGarbageCollector *collector = global->garbageCollector;
+    SZrGcBackgroundSweeper *sweeper = collector->backgroundSweeper;
+
+    if (sweeper != ZR_NULL) {
+        return sweeper;
+    }
+
+    sweeper = ZrCore_Memory_RawMallocWithType(global, sizeof(SZrGcBackgroundSweeper), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    if (sweeper == ZR_NULL) {
+        return ZR_NULL;
+    }
+    memset(sweeper, 0, sizeof(*sweeper));
+    sweeper->global = global;
+    gc_thread_mutex_init(&sweeper->lock);
+    gc_thread_condition_init(&sweeper->idleCondition);
+    collector->backgroundSweeper = sweeper;
+    return sweeper;
+}
+
+static SZrGcSweepBatch *gc_sweep_take_batch(SZrGcBackgroundSweeper *sweeper) {
+    SZrGcSweepBatch *batch;
+
+    gc_thread_mutex_lock(&sweeper->lock);
+    batch = sweeper->spareBatches;
+    if (batch != ZR_NULL) {
+        sweeper->spareBatches = batch->next;
+        sweeper->spareBatchCount--;
+    }
+    gc_thread_mutex_unlock(&sweeper->lock);
+
+    if (batch == ZR_NULL) {
+        batch = ZrCore_Memory_RawMallocWithType(sweeper->global,
+                                                sizeof(SZrGcSweepBatch),
+                                                ZR_MEMORY_NATIVE_TYPE_MANAGER);
+        if (batch == ZR_NULL) {
+            return ZR_NULL;
+        }
+    }
+    batch->next = ZR_NULL;
+    batch->count = 0;
+    batch->objectCount = 0;
+    batch->bytes = 0;
+    return batch;
+}
+
+// joins a sweeper thread that already left its loop; the caller holds sweeper->lock and must not have running set.
+static void gc_sweep_join_exited_thread(SZrGcBackgroundSweeper *sweeper) {
+    if (sweeper->joinPending) {
+        sweeper->joinPending = ZR_FALSE;
+        gc_thread_join(sweeper->thread);
+    }
+}
+
+static void gc_sweep_publish(SZrGcBackgroundSweeper *sweeper, SZrGcSweepBatch *batch) {
+    gc_thread_mutex_lock(&sweeper->lock);
+    if (sweeper->queueTail != ZR_NULL) {
+        sweeper->queueTail->next = batch;
+    } else {
+        sweeper->queueHead = batch;
+    }
+    sweeper->queueTail = batch;
+
+    if (!sweeper->running) {
+        gc_sweep_join_exited_thread(sweeper);
+        if (gc_thread_start(&sweeper->thread, gc_sweep_thread_main, sweeper)) {
+            sweeper->running = ZR_TRUE;
+        } else {
+            // no thread available: free the queue here rather than leaving it stranded.
+            while (sweeper->queueHead != ZR_NULL) {
+                SZrGcSweepBatch *pending = sweeper->queueHead;
+
+                sweeper->queueHead = pending->next;
+                gc_sweep_batch_free_all(sweeper->global, pending);
+                gc_sweep_recycle_batch(sweeper, pending);
+            }
+            sweeper->queueTail = ZR_NULL;
+        }
+    }
+    gc_thread_mutex_unlock(&sweeper->lock);
+}
+
+TZrBool garbage_collector_background_sweep_defer_free(SZrGlobalState *global,
+                                                      TZrPtr pointer,
+                                                      TZrSize size,
+                                                      EZrMemoryNativeType type) {
+    SZrGcBackgroundSweeper *sweeper = gc_sweep_acquire_sweeper(global);
+    SZrGcSweepBatch *batch;
+    SZrGcSweepFree *entry;
+
+    if (sweeper == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    batch = sweeper->filling;
+    if (batch == ZR_NULL) {
+        batch = gc_sweep_take_batch(sweeper);
+        if (batch == ZR_NULL) {
+            return ZR_FALSE;
+        }
+        sweeper->filling = batch;
+    }
+
+    entry = &batch->frees[batch->count++];
+    entry->pointer = pointer;
+    entry->size = size;
+    entry->type = type;
+    batch->bytes += size;
+    if (type == ZR_MEMORY_NATIVE_TYPE_OBJECT) {
+        batch->objectCount++;
+    }
+
+    if (batch->count == ZR_GC_BACKGROUND_SWEEP_BATCH_CAPACITY) {
+        sweeper->filling = ZR_NULL;
+        gc_sweep_publish(sweeper, batch);
+    }
+    return ZR_TRUE;
+}
+
+void garbage_collector_background_sweep_flush(SZrGlobalState *global) {
+    SZrGcBackgroundSweeper *sweeper = global->garbageCollector->backgroundSweeper;
+    SZrGcSweepBatch *batch;
+
+    if (sweeper == ZR_NULL || sweeper->filling == ZR_NULL || sweeper->filling->count == 0) {
+        return;
+    }
+
+    batch = sweeper->filling;
+    sweeper->filling = ZR_NULL;
+    gc_sweep_publish(sweeper, batch);
+}
+
+void garbage_collector_background_sweep_wait(SZrGlobalState *global) {
+    SZrGcBackgroundSweeper *sweeper = global->garbageCollector->backgroundSweeper;
+
+    if (sweeper == ZR_NULL) {
+        return;
+    }
+
+    gc_thread_mutex_lock(&sweeper->lock);
+    while (sweeper->running) {
+        gc_thread_condition_wait(&sweeper->idleCondition, &sweeper->lock);
+    }
+    gc_sweep_join_exited_thread(sweeper);
+    gc_thread_mutex_unlock(&sweeper->lock);
+}
+
+void garbage_collector_background_sweep_refresh_snapshot(SZrGarbageCollector *collector) {
+    SZrGcBackgroundSweeper *sweeper = collector->backgroundSweeper;
+
+    collector->statsSnapshot.backgroundSweepEnabled = collector->backgroundSweepEnabled;
+    if (sweeper == ZR_NULL) {
+        return;
+    }
+
+    gc_thread_mutex_lock(&sweeper->lock);
+    collector->statsSnapshot.backgroundSweepBatchCount = sweeper->batchCount;
+    collector->statsSnapshot.backgroundSweepObjectCount = sweeper->objectCount;
+    collector->statsSnapshot.backgroundSweepFreeCount = sweeper->freeCount;
+    collector->statsSnapshot.backgroundSweepBytes = sweeper->bytes;
+    collector->statsSnapshot.backgroundSweepDurationUs = sweeper->durationUs;
+    gc_thread_mutex_unlock(&sweeper->lock);
+}
+
+void garbage_collector_background_sweep_shutdown(SZrGlobalState *global) {
+    SZrGarbageCollector *collector;
+    SZrGcBackgroundSweeper *sweeper;
+
+    if (global == ZR_NULL || global->garbageCollector == ZR_NULL) {
+        return;
+    }
+
+    collector = global->garbageCollector;
+    sweeper = collector->backgroundSweeper;
+    collector->backgroundSweepEnabled = ZR_FALSE;
+    if (sweeper == ZR_NULL) {
+        return;
+    }
+
+    garbage_collector_background_sweep_flush(global);
+    garbage_collector_background_sweep_wait(global);
+    garbage_collector_background_sweep_refresh_snapshot(collector);
+    if (sweeper->filling != ZR_NULL) {
+        ZrCore_Memory_RawFreeWithType(global, sweeper->filling, sizeof(SZrGcSweepBatch), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    }
+    while (sweeper->spareBatches != ZR_NULL) {
+        SZrGcSweepBatch *batch = sweeper->spareBatches;
+
+        sweeper->spareBatches = batch->next;
+        ZrCore_Memory_RawFreeWithType(global, batch, sizeof(SZrGcSweepBatch), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    }
+    gc_thread_condition_destroy(&sweeper->idleCondition);
+    gc_thread_mutex_destroy(&sweeper->lock);
+    ZrCore_Memory_RawFreeWithType(global, sweeper, sizeof(SZrGcBackgroundSweeper), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    collector->backgroundSweeper = ZR_NULL;
+}
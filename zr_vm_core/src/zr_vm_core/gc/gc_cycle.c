@@ -918,7 +918,6 @@ static void garbage_collector_clear_forwarding_metadata(SZrGarbageCollector *col
     object = collector->gcObjectList;
     while (object != ZR_NULL) {
         object->garbageCollectMark.forwardingAddress = ZR_NULL;
-        object->garbageCollectMark.forwardingRefLocation = ZR_NULL;
         object = object->next;
     }
 }
@@ -1014,6 +1013,7 @@ static TZrSize garbage_collector_restart_minor_collection(SZrState *state) {
     garbage_collector_begin_minor_scan_epoch(collector);
 
     work += garbage_collector_prepare_minor_collection(state);
+    work += garbage_collector_mark_coroutine_roots(state);
     work += garbage_collector_mark_minor_root_object(state, ZR_CAST_RAW_OBJECT_AS_SUPER(state));
     work += garbage_collector_mark_minor_root_value(state, &global->loadedModulesRegistry);
     work += garbage_collector_mark_minor_root_object(state, ZR_CAST_RAW_OBJECT_AS_SUPER(global->errorPrototype));
@@ -1343,6 +1343,23 @@ static TZrSize garbage_collector_rewrite_aot_root_frames(SZrState *threadState)
     return work;
 }
 
+static TZrSize garbage_collector_rewrite_handle_scopes(SZrState *threadState) {
+    TZrSize work = 0;
+    SZrGcHandleScope *scope;
+
+    if (threadState == ZR_NULL) {
+        return 0;
+    }
+
+    for (scope = threadState->gcHandleScopeStack; scope != ZR_NULL; scope = scope->previous) {
+        for (TZrUInt32 index = 0u; index < scope->count; index++) {
+            work += garbage_collector_rewrite_raw_object_slot_counted(&scope->objects[index]);
+        }
+    }
+
+    return work;
+}
+
 static TZrBool garbage_collector_rewrite_resolved_inline_frame_values(SZrState *threadState,
                                                                       const SZrFunction *function,
                                                                       TZrStackValuePointer frameBase,
@@ -1859,6 +1876,7 @@ static TZrSize garbage_collector_rewrite_object_graph(SZrState *state, SZrRawObj
 
             work += garbage_collector_rewrite_thread_frame_slots(threadState);
             work += garbage_collector_rewrite_aot_root_frames(threadState);
+            work += garbage_collector_rewrite_handle_scopes(threadState);
             work += garbage_collector_rewrite_call_info_functions(state, threadState);
 
             if (threadState->hasCurrentException &&
@@ -1897,6 +1915,10 @@ static TZrSize garbage_collector_rewrite_forwarded_roots(SZrState *state) {
     }
 
     garbage_collector_rewrite_raw_object_slot((SZrRawObject **)&global->mainThreadState);
+    // coroutine threads are not on gcObjectList, so their frames are rewritten from the registry here.
+    for (SZrState *coroutine = global->coroutineList; coroutine != ZR_NULL; coroutine = coroutine->nextCoroutine) {
+        work += garbage_collector_rewrite_object_graph(state, ZR_CAST_RAW_OBJECT_AS_SUPER(coroutine));
+    }
 
     for (TZrSize bucketIndex = 0; bucketIndex < ZR_GLOBAL_API_STRING_CACHE_BUCKET_COUNT; bucketIndex++) {
         for (TZrSize depthIndex = 0; depthIndex < ZR_GLOBAL_API_STRING_CACHE_BUCKET_DEPTH; depthIndex++) {
@@ -1931,6 +1953,10 @@ static TZrSize garbage_collector_rewrite_forwarded_roots(SZrState *state) {
         }
     }
 
+    for (SZrObjectShape *shape = global->objectShapeAllocations; shape != ZR_NULL; shape = shape->nextAllocated) {
+        work += garbage_collector_rewrite_string_slot(&shape->name);
+    }
+
     if (global->garbageCollector != ZR_NULL) {
         work += garbage_collector_rewrite_raw_object_registry(global->garbageCollector->ignoredObjects,
                                                               global->garbageCollector->ignoredObjectCount,
@@ -1963,7 +1989,9 @@ static void garbage_collector_minor_target_for_object(SZrGarbageCollector *colle
         reason = ZR_GARBAGE_COLLECT_PROMOTION_REASON_SURVIVAL;
     }
 
-    if (object->garbageCollectMark.pinFlags != ZR_GARBAGE_COLLECT_PIN_KIND_NONE) {
+    // handle-scope pins only last for one native call, so they keep the address but not a pinned region
+    if ((object->garbageCollectMark.pinFlags & ~(TZrUInt32)ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE) !=
+        ZR_GARBAGE_COLLECT_PIN_KIND_NONE) {
         *outRegionKind = ZR_GARBAGE_COLLECT_REGION_KIND_PINNED;
         *outStorageKind = ZR_GARBAGE_COLLECT_STORAGE_KIND_OLD_PINNED;
         *outGenerationalStatus = ZR_GARBAGE_COLLECT_GENERATIONAL_OBJECT_STATUS_ALIVE;
@@ -2031,8 +2059,8 @@ static ZR_FORCE_INLINE TZrBool garbage_collector_should_reassign_minor_in_place(
             /*
              * Minor promotion only changes generational/region metadata; these objects
              * already participate in the post-mark rewrite pass and the promoted-object
-             * remembered-set registration. Because the runtime stores objects as
-             * individually allocated nodes instead of bump-pointer semispaces, keeping
+             * remembered-set registration. Outside the nursery (which the caller
+             * evacuates first) objects are individually allocated nodes, so keeping
              * the address stable avoids clone+root-rewrite+from-space-free churn
              * without removing any required graph rewrite work.
              */
@@ -2042,6 +2070,18 @@ static ZR_FORCE_INLINE TZrBool garbage_collector_should_reassign_minor_in_place(
     }
 }
 
+/*
+ * Nursery residents are copied out so their chunk can be rewound. Anything native code may address directly keeps
+ * its address: pinned objects (including native-call and handle-scope pins), ignore-registry members and
+ * ownership-tracked objects.
+ */
+static ZR_FORCE_INLINE TZrBool garbage_collector_should_evacuate_from_nursery(const SZrRawObject *object) {
+    return object->garbageCollectMark.nurseryChunkId != 0u &&
+           object->garbageCollectMark.pinFlags == ZR_GARBAGE_COLLECT_PIN_KIND_NONE &&
+           object->garbageCollectMark.ignoredRegistryIndex == ZR_MAX_SIZE &&
+           object->ownershipControl == ZR_NULL;
+}
+
 static ZR_FORCE_INLINE void garbage_collector_apply_minor_target(SZrGarbageCollector *collector,
                                                                  SZrRawObject *object,
                                                                  TZrUInt32 regionId,
@@ -2057,7 +2097,8 @@ static ZR_FORCE_INLINE void garbage_collector_apply_minor_target(SZrGarbageColle
     object->garbageCollectMark.regionDescriptorIndex = regionDescriptorIndex;
     object->garbageCollectMark.generationalStatus = generationalStatus;
     object->garbageCollectMark.promotionReason = promotionReason;
-    object->garbageCollectMark.survivalAge = survivalAge;
+    object->garbageCollectMark.survivalAge =
+            (TZrUInt16)(survivalAge < ZR_GC_SURVIVAL_AGE_MAX ? survivalAge : ZR_GC_SURVIVAL_AGE_MAX);
     object->garbageCollectMark.generation = collector->gcGeneration;
     object->garbageCollectMark.minorScanEpoch = collector->minorCollectionEpoch;
 }
@@ -2223,6 +2264,47 @@ static ZR_FORCE_INLINE void garbage_collector_clone_object_raw_int_storage(
     cloneCoreObject->superArrayRawIntDirty = sourceCoreObject->superArrayRawIntDirty;
 }
 
+static ZR_FORCE_INLINE void garbage_collector_move_object_hash_index(SZrRawObject *sourceObject,
+                                                                     SZrRawObject *cloneObject,
+                                                                     TZrSize objectSize) {
+    SZrObject *sourceCoreObject;
+
+    if (sourceObject == ZR_NULL || cloneObject == ZR_NULL || objectSize < sizeof(SZrObject) ||
+        (sourceObject->type != ZR_RAW_OBJECT_TYPE_ARRAY && sourceObject->type != ZR_RAW_OBJECT_TYPE_OBJECT)) {
+        return;
+    }
+
+    /*
+     * The hash index and its tombstone bitmap only store entry positions and cached hashes, never
+     * GC pointers, so the evacuated clone can take over the native buffers instead of copying them.
+     * The from-space original is freed in the same collection and must not release the moved buffers.
+     */
+    sourceCoreObject = ZR_CAST(SZrObject *, sourceObject);
+    sourceCoreObject->hashIndexSlots = ZR_NULL;
+    sourceCoreObject->hashIndexCapacity = 0;
+    sourceCoreObject->hashIndexCount = 0;
+    sourceCoreObject->hashIndexTombstones = ZR_NULL;
+    sourceCoreObject->hashIndexTombstoneWords = 0;
+    sourceCoreObject->hashIndexTombstoneCount = 0;
+}
+
+static ZR_FORCE_INLINE void garbage_collector_move_object_byte_storage(SZrRawObject *sourceObject,
+                                                                       SZrRawObject *cloneObject,
+                                                                       TZrSize objectSize) {
+    SZrObject *sourceCoreObject;
+
+    if (sourceObject == ZR_NULL || cloneObject == ZR_NULL || objectSize < sizeof(SZrObject) ||
+        sourceObject->type != ZR_RAW_OBJECT_TYPE_OBJECT) {
+        return;
+    }
+
+    // the clone keeps the storage reference the original held; dropping it here would free live bytes.
+    sourceCoreObject = ZR_CAST(SZrObject *, sourceObject);
+    sourceCoreObject->byteStorage = ZR_NULL;
+    sourceCoreObject->byteStorageOffset = 0;
+    sourceCoreObject->byteStorageLength = 0;
+}
+
 static SZrRawObject *garbage_collector_clone_for_minor_evacuation(
         SZrState *state,
         SZrRawObject *object,
@@ -2277,11 +2359,17 @@ static SZrRawObject *garbage_collector_clone_for_minor_evacuation(
     insertedNext = collector->gcObjectList;
     ZrCore_Memory_RawCopy(cloneObject, object, objectSize);
     garbage_collector_clone_object_raw_int_storage(state, object, cloneObject, objectSize);
+    garbage_collector_move_object_hash_index(object, cloneObject, objectSize);
+    garbage_collector_move_object_byte_storage(object, cloneObject, objectSize);
     cloneObject->next = insertedNext;
     collector->gcObjectList = cloneObject;
     cloneObject->gcList = ZR_NULL;
+    if (object->garbageCollectMark.nurseryChunkId != 0u && collector->nursery != ZR_NULL) {
+        cloneObject->garbageCollectMark.nurseryChunkId = 0u;
+        collector->nursery->evacuatedCount++;
+        collector->nursery->evacuatedBytes += objectSize;
+    }
     cloneObject->garbageCollectMark.forwardingAddress = ZR_NULL;
-    cloneObject->garbageCollectMark.forwardingRefLocation = ZR_NULL;
     garbage_collector_apply_minor_target(collector,
                                          cloneObject,
                                          cloneRegionId,
@@ -2301,7 +2389,6 @@ static SZrRawObject *garbage_collector_clone_for_minor_evacuation(
     }
 
     object->garbageCollectMark.forwardingAddress = cloneObject;
-    object->garbageCollectMark.forwardingRefLocation = ZR_NULL;
     return cloneObject;
 }
 
@@ -2337,6 +2424,7 @@ static ZR_FORCE_INLINE TZrBool garbage_collector_object_can_old_compact(SZrGarba
     }
 
     if (garbage_collector_ignore_registry_contains(collector, object) ||
+        (object->garbageCollectMark.pinFlags & ZR_GARBAGE_COLLECT_PIN_KIND_HANDLE_SCOPE) != 0u ||
         object->ownershipControl != ZR_NULL ||
         object->scanMarkGcFunction != ZR_NULL) {
         return ZR_FALSE;
@@ -2513,8 +2601,8 @@ static TZrSize garbage_collector_run_old_compaction(SZrState *state) {
         SZrRawObject *nextObject = object->next;
 
         /*
-         * GC objects are individually allocated nodes, not semispace bump ranges.
-         * Old-space compaction only needs to repack logical region bookkeeping, so
+         * Old objects are individually allocated nodes; only the young nursery is
+         * bump-allocated. Old-space compaction only needs to repack logical region bookkeeping, so
          * compactable objects can keep stable addresses and avoid clone+rewrite+free.
          */
         if (garbage_collector_object_can_old_compact(collector, state, object) &&
@@ -2552,8 +2640,9 @@ static TZrSize garbage_collector_run_minor_evacuation(SZrState *state) {
                                                           &generationalStatus,
                                                           &promotionReason,
                                                           &survivalAge);
-                if (garbage_collector_object_supports_evacuation(state, object) &&
-                    !garbage_collector_should_reassign_minor_in_place(object)) {
+                if (garbage_collector_should_evacuate_from_nursery(object) ||
+                    (garbage_collector_object_supports_evacuation(state, object) &&
+                     !garbage_collector_should_reassign_minor_in_place(object))) {
                     SZrRawObject *promotedObject = garbage_collector_clone_for_minor_evacuation(state,
                                                                                                  object,
                                                                                                  objectSize,
@@ -2568,6 +2657,9 @@ static TZrSize garbage_collector_run_minor_evacuation(SZrState *state) {
                         work++;
                     }
                 } else {
+                    if (object->garbageCollectMark.nurseryChunkId != 0u && collector->nursery != ZR_NULL) {
+                        collector->nursery->retainedCount++;
+                    }
                     garbage_collector_reassign_minor_target(state,
                                                             object,
                                                             regionKind,
@@ -2763,6 +2855,7 @@ TZrSize garbage_collector_atomic(SZrState *state) {
 
     global->garbageCollector->gcRunningStatus = ZR_GARBAGE_COLLECT_RUNNING_STATUS_ATOMIC;
 
+    work += garbage_collector_mark_coroutine_roots(state);
     stateObject = ZR_CAST_RAW_OBJECT_AS_SUPER(state);
     if (stateObject != ZR_NULL &&
         stateObject->type < ZR_RAW_OBJECT_TYPE_CLOSURE_ENUM_MAX &&
@@ -2795,6 +2888,8 @@ TZrSize garbage_collector_atomic(SZrState *state) {
 
     work += ZrGarbageCollectorPropagateAll(state);
     work += garbage_collector_process_weak_tables(state);
+    // the mark is complete here, and dead objects are never read again, so unused shapes can go now.
+    work += ZrCore_ObjectShape_FreeUnmarked(global);
     global->garbageCollector->gcGeneration = ZR_GC_OTHER_GENERATION(global->garbageCollector);
     return work;
 }
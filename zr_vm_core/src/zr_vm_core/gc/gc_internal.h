@@ -99,6 +99,9 @@ static ZR_FORCE_INLINE TZrSize garbage_collector_get_object_base_size_fast(const
         case ZR_RAW_OBJECT_TYPE_STRING: {
             const SZrString *stringValue = (const SZrString *)object;
 
+            if (ZrCore_String_IsConcatNode(stringValue)) {
+                return sizeof(SZrString) + sizeof(SZrStringConcatNode);
+            }
             return stringValue->shortStringLength < ZR_VM_LONG_STRING_FLAG
                            ? sizeof(SZrString) + (TZrSize)stringValue->shortStringLength + 1u
                            : sizeof(SZrString);
@@ -465,8 +468,105 @@ void garbage_collector_mark_object(SZrState *state, SZrRawObject *object);
 void garbage_collector_mark_value(SZrState *state, SZrTypeValue *value);
 TZrSize garbage_collector_mark_string_roots(SZrState *state);
 TZrSize garbage_collector_mark_ignored_roots(SZrState *state);
+TZrSize garbage_collector_mark_coroutine_roots(SZrState *state);
 void garbage_collector_link_to_gray_list(SZrRawObject *object, SZrRawObject **list);
 void garbage_collector_to_gc_list_and_mark_wait_to_scan(SZrRawObject *object, SZrRawObject **list);
+TZrSize garbage_collector_scan_gray_object(SZrState *state, SZrRawObject *object);
+
+TZrBool garbage_collector_parallel_mark_enabled(SZrGarbageCollector *collector);
+TZrBool garbage_collector_parallel_propagate_all(SZrState *state, TZrSize *outWork);
+void garbage_collector_parallel_mark_object(SZrState *state, SZrRawObject *object);
+void garbage_collector_parallel_mark_push_gray(SZrRawObject *object);
+void garbage_collector_parallel_mark_shutdown(SZrGlobalState *global);
+
+TZrUInt64 garbage_collector_now_us(void);
+TZrBool garbage_collector_background_sweep_defer_free(SZrGlobalState *global,
+                                                      TZrPtr pointer,
+                                                      TZrSize size,
+                                                      EZrMemoryNativeType type);
+void garbage_collector_background_sweep_flush(SZrGlobalState *global);
+void garbage_collector_background_sweep_wait(SZrGlobalState *global);
+void garbage_collector_background_sweep_refresh_snapshot(SZrGarbageCollector *collector);
+void garbage_collector_background_sweep_shutdown(SZrGlobalState *global);
+
+// Frees memory owned by a dead object, handing it to the background sweeper when that mode is on.
+static ZR_FORCE_INLINE void garbage_collector_free_swept_memory(SZrGlobalState *global,
+                                                                TZrPtr pointer,
+                                                                TZrSize size,
+                                                                EZrMemoryNativeType type) {
+    if (global->garbageCollector->backgroundSweepEnabled &&
+        garbage_collector_background_sweep_defer_free(global, pointer, size, type)) {
+        return;
+    }
+    ZrCore_Memory_RawFreeWithType(global, pointer, size, type);
+}
+
+// Bump-pointer eden chunk of the nursery (gc_nursery.c).
+typedef struct SZrGcNurseryChunk {
+    TZrBytePtr base;
+    TZrBytePtr cursor;
+    TZrBytePtr limit;
+    // objects still occupying the chunk; it is only rewound once this drops to zero.
+    TZrSize residentCount;
+} SZrGcNurseryChunk;
+
+typedef struct SZrGcNursery {
+    SZrGcNurseryChunk *chunks;
+    TZrUInt32 chunkCount;
+    TZrUInt32 chunkCapacity;
+    // 1-based id of the chunk being bumped; 0 until the first nursery allocation.
+    TZrUInt32 currentChunkId;
+    TZrSize chunkBytes;
+    TZrUInt64 allocationCount;
+    TZrUInt64 fallbackCount;
+    TZrUInt64 evacuatedCount;
+    TZrUInt64 evacuatedBytes;
+    TZrUInt64 retainedCount;
+    TZrUInt64 chunkResetCount;
+} SZrGcNursery;
+
+#define ZR_GC_NURSERY_ALIGN_SIZE(SIZE) (((SIZE) + ZR_ALIGN_SIZE - 1u) & ~((TZrSize)ZR_ALIGN_SIZE - 1u))
+
+TZrPtr garbage_collector_nursery_allocate_slow(SZrGlobalState *global, TZrSize size, TZrUInt32 *outChunkId);
+void garbage_collector_nursery_release(SZrGarbageCollector *collector, SZrRawObject *object);
+void garbage_collector_nursery_refresh_snapshot(SZrGarbageCollector *collector);
+void garbage_collector_nursery_shutdown(SZrGlobalState *global);
+TZrBool garbage_collector_nursery_forced_by_environment(void);
+
+/*
+ * Only plain SZrObject-sized objects go to the nursery. Arrays hash by address and prototypes, modules and the
+ * other runtime types are held by raw pointer from native structures, so none of them may move.
+ */
+static ZR_FORCE_INLINE TZrBool garbage_collector_nursery_accepts(const SZrGarbageCollector *collector,
+                                                                 EZrValueType type,
+                                                                 TZrSize size) {
+    return collector->nurseryEnabled && type == ZR_VALUE_TYPE_OBJECT && size == sizeof(SZrObject);
+}
+
+// Returns ZR_NULL when every chunk is full; the caller then allocates through the allocator.
+static ZR_FORCE_INLINE TZrPtr garbage_collector_nursery_allocate(SZrGlobalState *global,
+                                                                 TZrSize size,
+                                                                 TZrUInt32 *outChunkId) {
+    SZrGarbageCollector *collector = global->garbageCollector;
+    SZrGcNursery *nursery = collector->nursery;
+    TZrSize alignedSize = ZR_GC_NURSERY_ALIGN_SIZE(size);
+
+    if (nursery != ZR_NULL && nursery->currentChunkId != 0u) {
+        SZrGcNurseryChunk *chunk = &nursery->chunks[nursery->currentChunkId - 1u];
+
+        if ((TZrSize)(chunk->limit - chunk->cursor) >= alignedSize) {
+            TZrPtr memory = chunk->cursor;
+
+            chunk->cursor += alignedSize;
+            chunk->residentCount++;
+            nursery->allocationCount++;
+            collector->gcDebtSize += (TZrMemoryOffset)size;
+            *outChunkId = nursery->currentChunkId;
+            return memory;
+        }
+    }
+    return garbage_collector_nursery_allocate_slow(global, size, outChunkId);
+}
 
 static ZR_FORCE_INLINE void garbage_collector_mark_ignored_root_if_needed_fast(
         SZrState *state,
@@ -577,6 +677,11 @@ static ZR_FORCE_INLINE void garbage_collector_mark_raw_object_internal(
     }
 
     collector = state->global->garbageCollector;
+    if (ZR_UNLIKELY(collector->parallelMarkActive)) {
+        // Parallel mark only runs outside minor collections; gc_parallel_mark.c claims and queues.
+        garbage_collector_parallel_mark_object(state, object);
+        return;
+    }
     minorActive = garbage_collector_minor_collection_is_active_fast(collector);
     if (garbage_collector_try_mark_embedded_child_function_fast(state, collector, minorActive, object)) {
         return;
@@ -4,6 +4,9 @@
 
 #include "gc/gc_internal.h"
 
+#include "gc/gc_thread.h"
+#include "zr_vm_core/object_shape.h"
+
 #include "zr_vm_common/zr_aot_abi.h"
 
 static ZR_FORCE_INLINE void garbage_collector_mark_known_string_object_major_fast(SZrRawObject *object) {
@@ -150,6 +153,37 @@ static TZrSize garbage_collector_mark_object_node_map(SZrState *state, SZrObject
     return garbage_collector_mark_hash_set(state, &object->nodeMap);
 }
 
+/*
+ * Stamps the shape of a scanned object, and its ancestors, with the current full-mark epoch so
+ * ZrCore_ObjectShape_FreeUnmarked keeps them. Parallel mark workers race on the same shapes, so the
+ * stamp goes through atomics; the walk stops at the first ancestor already stamped.
+ */
+static void garbage_collector_mark_object_shape(SZrGlobalState *global, SZrObjectShape *shape) {
+    TZrInt32 epoch = (TZrInt32)global->objectShapeMarkEpoch;
+
+    for (; shape != ZR_NULL; shape = shape->parent) {
+        volatile TZrInt32 *stamp = (volatile TZrInt32 *)&shape->markEpoch;
+
+        if (gc_thread_atomic_load(stamp) == epoch) {
+            return;
+        }
+        gc_thread_atomic_store(stamp, epoch);
+    }
+}
+
+// shape names are compared by address on every transition, so they stay alive as long as the shape does.
+static TZrSize garbage_collector_mark_object_shape_names(SZrState *state) {
+    TZrSize work = 0;
+
+    for (SZrObjectShape *shape = state->global->objectShapeAllocations; shape != ZR_NULL; shape = shape->nextAllocated) {
+        if (shape->name != ZR_NULL) {
+            garbage_collector_mark_object(state, ZR_CAST_RAW_OBJECT_AS_SUPER(shape->name));
+            work++;
+        }
+    }
+    return work;
+}
+
 static TZrSize garbage_collector_mark_string_table_minor_roots(SZrGlobalState *global) {
     SZrStringTable *stringTable;
     TZrSize work = 0;
@@ -390,6 +424,7 @@ TZrSize garbage_collector_mark_string_roots(SZrState *state) {
         work += garbage_collector_mark_concat_pair_cache_major_roots(global);
         work += garbage_collector_mark_string_table_major_roots(global->stringTable);
     }
+    work += garbage_collector_mark_object_shape_names(state);
 
     return work;
 }
@@ -644,6 +679,26 @@ static TZrSize garbage_collector_mark_aot_root_frames(SZrState *state, SZrState
     return work;
 }
 
+static TZrSize garbage_collector_mark_handle_scopes(SZrState *state, SZrState *threadState) {
+    TZrSize work = 0;
+    const SZrGcHandleScope *scope;
+
+    if (threadState == ZR_NULL) {
+        return 0;
+    }
+
+    for (scope = threadState->gcHandleScopeStack; scope != ZR_NULL; scope = scope->previous) {
+        for (TZrUInt32 index = 0u; index < scope->count; index++) {
+            if (scope->objects[index] != ZR_NULL) {
+                garbage_collector_mark_object(state, scope->objects[index]);
+                work++;
+            }
+        }
+    }
+
+    return work;
+}
+
 static TZrBool garbage_collector_stack_slot_intersects_resolved_inline_frame(SZrState *threadState,
                                                                             TZrStackValuePointer stackSlot) {
     SZrCallInfo *callInfo;
@@ -787,6 +842,16 @@ void garbage_collector_to_gc_list_and_mark_wait_to_scan(SZrRawObject *object, SZ
     garbage_collector_link_to_gray_list(object, list);
 }
 
+static ZR_FORCE_INLINE void garbage_collector_push_gray_object(SZrGarbageCollector *collector, SZrRawObject *object) {
+    if (collector->parallelMarkActive) {
+        // the caller already claimed the object, so it goes straight onto the current worker's stack.
+        garbage_collector_parallel_mark_push_gray(object);
+        return;
+    }
+
+    garbage_collector_link_to_gray_list(object, &collector->waitToScanObjectList);
+}
+
 void ZrGarbageCollectorReallyMarkObject(SZrState *state, SZrRawObject *object) {
     SZrGlobalState *global;
 
@@ -836,7 +901,7 @@ void ZrGarbageCollectorReallyMarkObject(SZrState *state, SZrRawObject *object) {
                     }
                 }
             }
-            garbage_collector_link_to_gray_list(object, &global->garbageCollector->waitToScanObjectList);
+            garbage_collector_push_gray_object(global->garbageCollector, object);
             break;
         }
         case ZR_RAW_OBJECT_TYPE_CLOSURE_VALUE: {
@@ -845,7 +910,7 @@ void ZrGarbageCollectorReallyMarkObject(SZrState *state, SZrRawObject *object) {
             if (ZrCore_ClosureValue_IsClosed(closureValue)) {
                 ZR_GC_SET_REFERENCED(object);
             } else {
-                garbage_collector_link_to_gray_list(object, &global->garbageCollector->waitToScanObjectList);
+                garbage_collector_push_gray_object(global->garbageCollector, object);
             }
             garbage_collector_mark_value(state, &closureValue->value.valuePointer->value);
             break;
@@ -868,7 +933,7 @@ void ZrGarbageCollectorReallyMarkObject(SZrState *state, SZrRawObject *object) {
         case ZR_RAW_OBJECT_TYPE_FUNCTION:
         case ZR_RAW_OBJECT_TYPE_OBJECT:
         case ZR_RAW_OBJECT_TYPE_THREAD:
-            garbage_collector_link_to_gray_list(object, &global->garbageCollector->waitToScanObjectList);
+            garbage_collector_push_gray_object(global->garbageCollector, object);
             break;
         default:
             ZR_ASSERT(ZR_FALSE);
@@ -889,6 +954,9 @@ static TZrSize garbage_collector_scan_object(SZrState *state, SZrRawObject *obje
             SZrObject *obj = ZR_CAST_OBJECT(state, object);
 
             work += garbage_collector_mark_object_node_map(state, obj);
+            if (obj != ZR_NULL && obj->shape != ZR_NULL) {
+                garbage_collector_mark_object_shape(state->global, obj->shape);
+            }
             if (obj != ZR_NULL && obj->internalType == ZR_OBJECT_INTERNAL_TYPE_OBJECT_PROTOTYPE) {
                 garbage_collector_mark_object_prototype_graph(state, (SZrObjectPrototype *)obj, &work);
             }
@@ -1177,6 +1245,7 @@ static TZrSize garbage_collector_scan_object(SZrState *state, SZrRawObject *obje
                 work++;
             }
             work += garbage_collector_mark_aot_root_frames(state, threadState);
+            work += garbage_collector_mark_handle_scopes(state, threadState);
 
             closureValue = threadState->stackClosureValueList;
             while (closureValue != ZR_NULL) {
@@ -1262,6 +1331,15 @@ static TZrSize garbage_collector_scan_object(SZrState *state, SZrRawObject *obje
     return work;
 }
 
+TZrSize garbage_collector_scan_gray_object(SZrState *state, SZrRawObject *object) {
+    if (!ZR_GC_IS_REFERENCED(object) &&
+        object->garbageCollectMark.status != ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_PERMANENT) {
+        ZR_GC_SET_REFERENCED(object);
+    }
+
+    return garbage_collector_scan_object(state, object);
+}
+
 TZrSize ZrGarbageCollectorPropagateMark(SZrState *state) {
     SZrGlobalState *global = state->global;
     SZrRawObject *object = global->garbageCollector->waitToScanObjectList;
@@ -1272,13 +1350,7 @@ TZrSize ZrGarbageCollectorPropagateMark(SZrState *state) {
 
     global->garbageCollector->waitToScanObjectList = object->gcList;
     object->gcList = ZR_NULL;
-
-    if (!ZR_GC_IS_REFERENCED(object) &&
-        object->garbageCollectMark.status != ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_PERMANENT) {
-        ZR_GC_SET_REFERENCED(object);
-    }
-
-    return garbage_collector_scan_object(state, object);
+    return garbage_collector_scan_gray_object(state, object);
 }
 
 static ZR_FORCE_INLINE TZrBool garbage_collector_activate_pending_gray_list(SZrGarbageCollector *collector) {
@@ -1296,6 +1368,7 @@ static ZR_FORCE_INLINE TZrBool garbage_collector_activate_pending_gray_list(SZrG
 ZR_CORE_API TZrSize ZrGarbageCollectorPropagateAll(SZrState *state) {
     SZrGlobalState *global = state->global;
     TZrSize total = 0;
+    TZrUInt64 scannedObjects = 0;
     SZrGarbageCollector *collector;
 
     if (global == ZR_NULL || global->garbageCollector == ZR_NULL) {
@@ -1303,16 +1376,69 @@ ZR_CORE_API TZrSize ZrGarbageCollectorPropagateAll(SZrState *state) {
     }
 
     collector = global->garbageCollector;
+    if (garbage_collector_parallel_mark_enabled(collector) &&
+        garbage_collector_parallel_propagate_all(state, &total)) {
+        return total;
+    }
+
     while (garbage_collector_activate_pending_gray_list(collector)) {
         TZrSize work;
 
         work = ZrGarbageCollectorPropagateMark(state);
         total += work;
+        scannedObjects++;
     }
 
+    if (!garbage_collector_minor_collection_is_active_fast(collector)) {
+        if (collector->statsSnapshot.lastMarkWorkerCount == 0u) {
+            collector->statsSnapshot.lastMarkWorkerCount = 1u;
+        }
+        collector->statsSnapshot.lastMarkWorkerObjects[0] += scannedObjects;
+        collector->statsSnapshot.lastMarkWorkerWork[0] += total;
+    }
     return total;
 }
 
+static void garbage_collector_reset_mark_worker_stats(SZrGarbageCollector *collector) {
+    SZrGarbageCollectorStatsSnapshot *snapshot = &collector->statsSnapshot;
+
+    snapshot->lastMarkWorkerCount = 0u;
+    memset(snapshot->lastMarkWorkerObjects, 0, sizeof(snapshot->lastMarkWorkerObjects));
+    memset(snapshot->lastMarkWorkerWork, 0, sizeof(snapshot->lastMarkWorkerWork));
+    memset(snapshot->lastMarkWorkerSteals, 0, sizeof(snapshot->lastMarkWorkerSteals));
+}
+
+static void garbage_collector_mark_parked_thread(SZrState *state, SZrState *threadState) {
+    SZrRawObject *threadObject = ZR_CAST_RAW_OBJECT_AS_SUPER(threadState);
+
+    // stacks have no write barrier: a thread scanned earlier is re-armed so its current frames are rescanned.
+    if (ZR_GC_IS_REFERENCED(threadObject)) {
+        threadObject->garbageCollectMark.status = ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_INITED;
+    }
+    ZrGarbageCollectorReallyMarkObject(state, threadObject);
+}
+
+TZrSize garbage_collector_mark_coroutine_roots(SZrState *state) {
+    SZrGlobalState *global;
+    TZrSize work = 0;
+
+    if (state == ZR_NULL || state->global == ZR_NULL) {
+        return 0;
+    }
+
+    global = state->global;
+    // coroutine threads live outside gcObjectList, so only this walk keeps their stacks alive.
+    for (SZrState *coroutine = global->coroutineList; coroutine != ZR_NULL; coroutine = coroutine->nextCoroutine) {
+        garbage_collector_mark_parked_thread(state, coroutine);
+        work++;
+    }
+    if (state->isCoroutine && global->mainThreadState != ZR_NULL) {
+        garbage_collector_mark_parked_thread(state, global->mainThreadState);
+        work++;
+    }
+    return work;
+}
+
 ZR_CORE_API void ZrGarbageCollectorRestartCollection(SZrState *state) {
     SZrGlobalState *global;
     SZrRawObject *stateObject;
@@ -1329,7 +1455,11 @@ ZR_CORE_API void ZrGarbageCollectorRestartCollection(SZrState *state) {
     global->garbageCollector->waitToScanObjectList = ZR_NULL;
     global->garbageCollector->waitToScanAgainObjectList = ZR_NULL;
     global->garbageCollector->waitToReleaseObjectList = ZR_NULL;
+    garbage_collector_reset_mark_worker_stats(global->garbageCollector);
+    // shapes stamped with the new epoch from here on are the ones garbage_collector_atomic keeps.
+    global->objectShapeMarkEpoch++;
 
+    garbage_collector_mark_coroutine_roots(state);
     stateObject = ZR_CAST_RAW_OBJECT_AS_SUPER(state);
     if (stateObject != ZR_NULL &&
         stateObject->type < ZR_RAW_OBJECT_TYPE_CLOSURE_ENUM_MAX &&
@@ -1518,3 +1648,27 @@ void ZrCore_GarbageCollector_BarrierBack(SZrState *state, SZrRawObject *object)
 void ZrCore_RawObject_Barrier(SZrState *state, SZrRawObject *object, SZrRawObject *valueObject) {
     ZrCore_GarbageCollector_Barrier(state, object, valueObject);
 }
+
+/*
+ * Forward barrier for every reference an object holds at once: used after an object's body is rebuilt in place, so
+ * a black owner is scanned again instead of barriering each new reference separately.
+ */
+void ZrCore_GarbageCollector_BarrierRebuilt(SZrState *state, SZrRawObject *object) {
+    SZrGlobalState *global;
+
+    if (state == ZR_NULL || object == ZR_NULL) {
+        return;
+    }
+
+    global = state->global;
+    if (global == ZR_NULL || global->garbageCollector == ZR_NULL) {
+        return;
+    }
+
+    if (garbage_collector_object_is_old_or_pinned(object)) {
+        garbage_collector_remember_object(global, object);
+    }
+    if (ZrCore_GarbageCollector_IsInvariant(global) && ZrCore_RawObject_IsMarkReferenced(object)) {
+        garbage_collector_scan_object(state, object);
+    }
+}
@@ -0,0 +1,165 @@
+//
+// Nursery: bump-pointer eden chunks for young plain objects, emptied by minor evacuation.
+//
+
+#include "gc/gc_internal.h"
+
+#include <stdlib.h>
+
+static SZrGcNursery *gc_nursery_acquire(SZrGlobalState *global) {
+    SZrGarbageCollector *collector = global->garbageCollector;
+    SZrGcNursery *nursery = collector->nursery;
+    TZrUInt32 chunkCapacity;
+
+    if (nursery != ZR_NULL) {
+        return nursery;
+    }
+
+    chunkCapacity = collector->youngRegionCountTarget > 0u ? collector->youngRegionCountTarget : 1u;
+    nursery = ZrCore_Memory_RawMallocWithType(global, sizeof(SZrGcNursery), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    if (nursery == ZR_NULL) {
+        return ZR_NULL;
+    }
+    memset(nursery, 0, sizeof(*nursery));
+    nursery->chunks = ZrCore_Memory_RawMallocWithType(global,
+                                                      chunkCapacity * sizeof(SZrGcNurseryChunk),
+                                                      ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    if (nursery->chunks == ZR_NULL) {
+        ZrCore_Memory_RawFreeWithType(global, nursery, sizeof(SZrGcNursery), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+        return ZR_NULL;
+    }
+    memset(nursery->chunks, 0, chunkCapacity * sizeof(SZrGcNurseryChunk));
+    nursery->chunkCapacity = chunkCapacity;
+    // capacity and chunk size are fixed at creation; later youngRegion* changes apply to the next collector.
+    nursery->chunkBytes = collector->youngRegionSize > 0u ? (TZrSize)collector->youngRegionSize : 256u * 1024u;
+    collector->nursery = nursery;
+    return nursery;
+}
+
+static TZrBool gc_nursery_chunk_fits(const SZrGcNurseryChunk *chunk, TZrSize alignedSize) {
+    return (TZrSize)(chunk->limit - chunk->cursor) >= alignedSize;
+}
+
+/*
+ * Picks the next chunk to bump: an empty chunk is rewound first so the nursery stays compact, then any chunk with
+ * enough tail left behind retained residents, then a fresh chunk while under capacity.
+ */
+static TZrUInt32 gc_nursery_select_chunk(SZrGlobalState *global, SZrGcNursery *nursery, TZrSize alignedSize) {
+    SZrGcNurseryChunk *chunk;
+
+    for (TZrUInt32 index = 0; index < nursery->chunkCount; index++) {
+        chunk = &nursery->chunks[index];
+        if (chunk->residentCount == 0u && chunk->cursor != chunk->base) {
+            chunk->cursor = chunk->base;
+            nursery->chunkResetCount++;
+        }
+        if (chunk->residentCount == 0u && gc_nursery_chunk_fits(chunk, alignedSize)) {
+            return index + 1u;
+        }
+    }
+
+    for (TZrUInt32 index = 0; index < nursery->chunkCount; index++) {
+        if (gc_nursery_chunk_fits(&nursery->chunks[index], alignedSize)) {
+            return index + 1u;
+        }
+    }
+
+    if (nursery->chunkCount >= nursery->chunkCapacity || alignedSize > nursery->chunkBytes) {
+        return 0u;
+    }
+
+    chunk = &nursery->chunks[nursery->chunkCount];
+    chunk->base = ZrCore_Memory_RawMallocWithType(global, nursery->chunkBytes, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    if (chunk->base == ZR_NULL) {
+        return 0u;
+    }
+    chunk->cursor = chunk->base;
+    chunk->limit = chunk->base + nursery->chunkBytes;
+    chunk->residentCount = 0u;
+    nursery->chunkCount++;
+    return nursery->chunkCount;
+}
+
+TZrPtr garbage_collector_nursery_allocate_slow(SZrGlobalState *global, TZrSize size, TZrUInt32 *outChunkId) {
+    SZrGcNursery *nursery = gc_nursery_acquire(global);
+    TZrSize alignedSize = ZR_GC_NURSERY_ALIGN_SIZE(size);
+    TZrUInt32 chunkId;
+
+    if (nursery == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    chunkId = gc_nursery_select_chunk(global, nursery, alignedSize);
+    if (chunkId == 0u) {
+        nursery->fallbackCount++;
+        return ZR_NULL;
+    }
+
+    nursery->currentChunkId = chunkId;
+    return garbage_collector_nursery_allocate(global, size, outChunkId);
+}
+
+void garbage_collector_nursery_release(SZrGarbageCollector *collector, SZrRawObject *object) {
+    SZrGcNursery *nursery = collector->nursery;
+    TZrUInt32 chunkId = object->garbageCollectMark.nurseryChunkId;
+
+    object->garbageCollectMark.nurseryChunkId = 0u;
+    if (nursery == ZR_NULL || chunkId == 0u || chunkId > nursery->chunkCount) {
+        return;
+    }
+    if (nursery->chunks[chunkId - 1u].residentCount > 0u) {
+        nursery->chunks[chunkId - 1u].residentCount--;
+    }
+}
+
+void garbage_collector_nursery_refresh_snapshot(SZrGarbageCollector *collector) {
+    SZrGcNursery *nursery = collector->nursery;
+    SZrGarbageCollectorStatsSnapshot *snapshot = &collector->statsSnapshot;
+
+    snapshot->nurseryEnabled = collector->nurseryEnabled;
+    if (nursery == ZR_NULL) {
+        return;
+    }
+
+    snapshot->nurseryChunkCount = nursery->chunkCount;
+    snapshot->nurseryCapacityBytes = (TZrUInt64)nursery->chunkCount * nursery->chunkBytes;
+    snapshot->nurseryUsedBytes = 0u;
+    for (TZrUInt32 index = 0; index < nursery->chunkCount; index++) {
+        snapshot->nurseryUsedBytes += (TZrUInt64)(nursery->chunks[index].cursor - nursery->chunks[index].base);
+    }
+    snapshot->nurseryAllocationCount = nursery->allocationCount;
+    snapshot->nurseryFallbackCount = nursery->fallbackCount;
+    snapshot->nurseryEvacuatedCount = nursery->evacuatedCount;
+    snapshot->nurseryEvacuatedBytes = nursery->evacuatedBytes;
+    snapshot->nurseryRetainedCount = nursery->retainedCount;
+    snapshot->nurseryChunkResetCount = nursery->chunkResetCount;
+}
+
+// ZR_VM_GC_NURSERY=1 turns the nursery on for every new collector so whole test suites can run against it.
+TZrBool garbage_collector_nursery_forced_by_environment(void) {
+    const TZrChar *flag = getenv("ZR_VM_GC_NURSERY");
+
+    return flag != ZR_NULL && flag[0] != '\0' && strcmp(flag, "0") != 0 ? ZR_TRUE : ZR_FALSE;
+}
+
+// Runs after the shutdown collection; objects still resident at this point go away with their chunks.
+void garbage_collector_nursery_shutdown(SZrGlobalState *global) {
+    SZrGarbageCollector *collector = global->garbageCollector;
+    SZrGcNursery *nursery = collector->nursery;
+
+    collector->nurseryEnabled = ZR_FALSE;
+    if (nursery == ZR_NULL) {
+        return;
+    }
+
+    for (TZrUInt32 index = 0; index < nursery->chunkCount; index++) {
+        ZrCore_Memory_RawFreeWithType(
+                global, nursery->chunks[index].base, nursery->chunkBytes, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    }
+    ZrCore_Memory_RawFreeWithType(global,
+                                  nursery->chunks,
+                                  nursery->chunkCapacity * sizeof(SZrGcNurseryChunk),
+                                  ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    ZrCore_Memory_RawFreeWithType(global, nursery, sizeof(SZrGcNursery), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+    collector->nursery = ZR_NULL;
+}
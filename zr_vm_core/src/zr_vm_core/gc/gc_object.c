@@ -4,6 +4,8 @@
 
 #include "gc/gc_internal.h"
 
+#include "zr_vm_core/jit.h"
+
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -989,23 +991,64 @@ static ZR_FORCE_INLINE void garbage_collector_free_object_known_size(
         object->scanMarkGcFunction(state, object);
     }
 
+    if (object->type == ZR_RAW_OBJECT_TYPE_FUNCTION) {
+        // a function the collector reclaims without ZrCore_Function_Free still gives back its machine code
+        // and its references on a resident .zro image
+        ZrCore_Jit_FreeFunctionCode(global, ZR_CAST(SZrFunction *, object));
+        ZrCore_Function_ReleaseLazyBodies(state, ZR_CAST(SZrFunction *, object));
+    }
+
+    if (object->type == ZR_RAW_OBJECT_TYPE_STRING) {
+        // long strings may own a code-point index; concat nodes hold a reference on their shared append buffer
+        ZrCore_String_ReleaseCodePointIndex(global, ZR_CAST(SZrString *, object));
+        ZrCore_String_ReleaseConcatNode(global, ZR_CAST(SZrString *, object));
+    }
+
     if ((object->type == ZR_RAW_OBJECT_TYPE_ARRAY || object->type == ZR_RAW_OBJECT_TYPE_OBJECT) &&
         objectSize >= sizeof(SZrObject)) {
         SZrObject *coreObject = ZR_CAST(SZrObject *, object);
         if (coreObject->superArrayRawIntData != ZR_NULL &&
             coreObject->superArrayRawIntCapacity > 0) {
-            ZrCore_Memory_RawFreeWithType(global,
-                                          coreObject->superArrayRawIntData,
-                                          coreObject->superArrayRawIntCapacity * sizeof(TZrInt64),
-                                          ZR_MEMORY_NATIVE_TYPE_ARRAY);
+            garbage_collector_free_swept_memory(global,
+                                                coreObject->superArrayRawIntData,
+                                                coreObject->superArrayRawIntCapacity * sizeof(TZrInt64),
+                                                ZR_MEMORY_NATIVE_TYPE_ARRAY);
             coreObject->superArrayRawIntData = ZR_NULL;
             coreObject->superArrayRawIntLength = 0;
             coreObject->superArrayRawIntCapacity = 0;
             coreObject->superArrayRawIntDirty = ZR_FALSE;
         }
+        if (coreObject->hashIndexSlots != ZR_NULL &&
+            coreObject->hashIndexCapacity > 0) {
+            garbage_collector_free_swept_memory(global,
+                                                coreObject->hashIndexSlots,
+                                                coreObject->hashIndexCapacity * sizeof(SZrObjectHashIndexSlot),
+                                                ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+            coreObject->hashIndexSlots = ZR_NULL;
+            coreObject->hashIndexCapacity = 0;
+            coreObject->hashIndexCount = 0;
+        }
+        if (coreObject->hashIndexTombstones != ZR_NULL &&
+            coreObject->hashIndexTombstoneWords > 0) {
+            garbage_collector_free_swept_memory(global,
+                                                coreObject->hashIndexTombstones,
+                                                coreObject->hashIndexTombstoneWords * sizeof(TZrUInt64),
+                                                ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+            coreObject->hashIndexTombstones = ZR_NULL;
+            coreObject->hashIndexTombstoneWords = 0;
+            coreObject->hashIndexTombstoneCount = 0;
+        }
+        if (coreObject->byteStorage != ZR_NULL) {
+            ZrCore_Object_ReleaseByteStorage(global, coreObject);
+        }
     }
 
-    ZrCore_Memory_RawFreeWithType(global, object, objectSize, ZR_MEMORY_NATIVE_TYPE_OBJECT);
+    if (object->garbageCollectMark.nurseryChunkId != 0u) {
+        // nursery chunks are rewound as a whole; the object only stops holding its chunk.
+        garbage_collector_nursery_release(global->garbageCollector, object);
+        return;
+    }
+    garbage_collector_free_swept_memory(global, object, objectSize, ZR_MEMORY_NATIVE_TYPE_OBJECT);
 }
 
 void garbage_collector_free_object_sized(SZrState *state, SZrRawObject *object, TZrSize objectSize) {
@@ -1037,8 +1080,17 @@ void garbage_collector_free_object(SZrState *state, SZrRawObject *object) {
 
 SZrRawObject *ZrCore_RawObject_New(SZrState *state, EZrValueType type, TZrSize size, TZrBool isNative) {
     SZrGlobalState *global = state->global;
-    TZrPtr memory = ZrCore_Memory_GcMalloc(state, ZR_MEMORY_NATIVE_TYPE_OBJECT, size);
-    SZrRawObject *object = ZR_CAST_RAW_OBJECT(memory);
+    TZrUInt32 nurseryChunkId = 0u;
+    TZrPtr memory = ZR_NULL;
+    SZrRawObject *object;
+
+    if (garbage_collector_nursery_accepts(global->garbageCollector, type, size)) {
+        memory = garbage_collector_nursery_allocate(global, size, &nurseryChunkId);
+    }
+    if (memory == ZR_NULL) {
+        memory = ZrCore_Memory_GcMalloc(state, ZR_MEMORY_NATIVE_TYPE_OBJECT, size);
+    }
+    object = ZR_CAST_RAW_OBJECT(memory);
     raw_object_trace("raw object new request state=%p type=%d size=%llu memory=%p",
                      (void *)state,
                      (int)type,
@@ -1051,6 +1103,7 @@ SZrRawObject *ZrCore_RawObject_New(SZrState *state, EZrValueType type, TZrSize s
     ZrCore_Memory_RawSet(object, 0, size);
     ZrCore_RawObject_Construct(object, (EZrRawObjectType)type);
     object->isNative = isNative;
+    object->garbageCollectMark.nurseryChunkId = nurseryChunkId;
     object->garbageCollectMark.status = global->garbageCollector->gcInitializeObjectStatus;
     object->garbageCollectMark.generation = global->garbageCollector->gcGeneration;
     object->garbageCollectMark.regionId = garbage_collector_try_allocate_region_id_current_fast(
@@ -1191,6 +1244,10 @@ void ZrCore_RawObject_MarkAsPermanent(SZrState *state, SZrRawObject *object) {
     object->garbageCollectMark.pinFlags |= ZR_GARBAGE_COLLECT_PIN_KIND_PERSISTENT_ROOT;
     object->garbageCollectMark.escapeFlags |= ZR_GARBAGE_COLLECT_ESCAPE_KIND_GLOBAL_ROOT;
     object->garbageCollectMark.promotionReason = ZR_GARBAGE_COLLECT_PROMOTION_REASON_GLOBAL_ROOT;
+    // the mark skips permanent objects, so a shape they used would look unused and be freed under them.
+    if (object->type == ZR_RAW_OBJECT_TYPE_OBJECT) {
+        ZR_CAST_OBJECT(state, object)->shape = ZR_NULL;
+    }
     raw_object_trace("raw object permanent object=%p status=%d region=%u",
                      (void *)object,
                      (int)previousStatus,
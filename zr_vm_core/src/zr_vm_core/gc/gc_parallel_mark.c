@@ -0,0 +1,518 @@
+//
+// Parallel mark: per-worker gray stacks with batch stealing for full/major PropagateAll.
+//
+
+#include "gc/gc_internal.h"
+
+#include "gc/gc_thread.h"
+
+// a worker holding at least THRESHOLD gray objects hands the top BATCH to its stealable list.
+#define ZR_GC_PARALLEL_MARK_DONATE_THRESHOLD 32u
+#define ZR_GC_PARALLEL_MARK_DONATE_BATCH 16u
+// idle workers spin this many polls before yielding the CPU.
+#define ZR_GC_PARALLEL_MARK_IDLE_SPINS 64u
+
+struct SZrGcParallelMarker;
+
+typedef struct SZrGcMarkWorker {
+    struct SZrGcParallelMarker *marker;
+    TZrUInt32 index;
+    // private gray stack, linked through gcList; only the owning thread touches it.
+    SZrRawObject *grayStack;
+    TZrSize grayCount;
+    // donated batch other workers may take whole; written under stealLock, polled without it.
+    ZrGcMutex stealLock;
+    SZrRawObject *volatile stealable;
+    TZrSize stealableCount;
+    TZrUInt64 scannedObjects;
+    TZrUInt64 work;
+    TZrUInt64 steals;
+    // keeps neighbouring workers' hot fields off the same cache line.
+    TZrByte padding[64];
+} SZrGcMarkWorker;
+
+typedef struct SZrGcParallelMarker {
+    SZrGlobalState *global;
+    SZrState *state;
+    TZrUInt32 workerCount;
+    TZrUInt32 threadCount;
+    volatile TZrInt32 activeWorkers;
+
+    // round control for the helper threads.
+    ZrGcMutex controlLock;
+    ZrGcCondition startCondition;
+    ZrGcCondition doneCondition;
+    TZrUInt64 round;
+    TZrUInt32 finishedThreads;
+    TZrBool shutdown;
+
+    // objects that must be finished on the collecting thread, and embedded child functions whose mark resets status.
+    ZrGcMutex serialLock;
+    SZrRawObject *serialList;
+
+    ZrGcThread threads[ZR_GC_PARALLEL_MARK_WORKER_MAX];
+    SZrGcMarkWorker workers[ZR_GC_PARALLEL_MARK_WORKER_MAX];
+} SZrGcParallelMarker;
+
+static ZR_GC_THREAD_LOCAL SZrGcMarkWorker *g_gc_current_mark_worker = ZR_NULL;
+
+static ZR_FORCE_INLINE volatile TZrInt32 *gc_mark_status_word(SZrRawObject *object) {
+    return (volatile TZrInt32 *)&object->garbageCollectMark.status;
+}
+
+static ZR_FORCE_INLINE SZrRawObject *gc_mark_worker_pop(SZrGcMarkWorker *worker) {
+    SZrRawObject *object = worker->grayStack;
+
+    if (object != ZR_NULL) {
+        worker->grayStack = object->gcList;
+        object->gcList = ZR_NULL;
+        worker->grayCount--;
+    }
+    return object;
+}
+
+static void gc_mark_worker_donate(SZrGcMarkWorker *worker) {
+    SZrRawObject *head = worker->grayStack;
+    SZrRawObject *tail = head;
+
+    for (TZrUInt32 index = 1; index < ZR_GC_PARALLEL_MARK_DONATE_BATCH; index++) {
+        tail = tail->gcList;
+    }
+    worker->grayStack = tail->gcList;
+    worker->grayCount -= ZR_GC_PARALLEL_MARK_DONATE_BATCH;
+    tail->gcList = ZR_NULL;
+
+    gc_thread_mutex_lock(&worker->stealLock);
+    gc_thread_atomic_store_pointer(&worker->stealable, head);
+    worker->stealableCount = ZR_GC_PARALLEL_MARK_DONATE_BATCH;
+    gc_thread_mutex_unlock(&worker->stealLock);
+}
+
+static TZrBool gc_mark_worker_take_stealable(SZrGcMarkWorker *worker, SZrGcMarkWorker *victim) {
+    SZrRawObject *list;
+    TZrSize count;
+
+    if (gc_thread_atomic_load_pointer(&victim->stealable) == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    gc_thread_mutex_lock(&victim->stealLock);
+    list = victim->stealable;
+    count = victim->stealableCount;
+    gc_thread_atomic_store_pointer(&victim->stealable, ZR_NULL);
+    victim->stealableCount = 0;
+    gc_thread_mutex_unlock(&victim->stealLock);
+    if (list == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    worker->grayStack = list;
+    worker->grayCount = count;
+    return ZR_TRUE;
+}
+
+static TZrBool gc_mark_worker_steal(SZrGcMarkWorker *worker) {
+    SZrGcParallelMarker *marker = worker->marker;
+
+    for (TZrUInt32 offset = 1; offset < marker->workerCount; offset++) {
+        SZrGcMarkWorker *victim = &marker->workers[(worker->index + offset) % marker->workerCount];
+
+        if (gc_mark_worker_take_stealable(worker, victim)) {
+            worker->steals++;
+            return ZR_TRUE;
+        }
+    }
+    return ZR_FALSE;
+}
+
+static TZrBool gc_mark_any_stealable(SZrGcParallelMarker *marker) {
+    for (TZrUInt32 index = 0; index < marker->workerCount; index++) {
+        if (gc_thread_atomic_load_pointer(&marker->workers[index].stealable) != ZR_NULL) {
+            return ZR_TRUE;
+        }
+    }
+    return ZR_FALSE;
+}
+
+/*
+ * Termination: a worker only donates while it is active and always drains its own stealable list
+ * before going idle, so once activeWorkers reaches zero every list is empty and stays empty.
+ */
+static TZrBool gc_mark_worker_refill(SZrGcMarkWorker *worker) {
+    SZrGcParallelMarker *marker = worker->marker;
+    TZrUInt32 spins = 0;
+
+    if (gc_mark_worker_take_stealable(worker, worker) || gc_mark_worker_steal(worker)) {
+        return ZR_TRUE;
+    }
+
+    gc_thread_atomic_add(&marker->activeWorkers, -1);
+    for (;;) {
+        if (gc_mark_any_stealable(marker)) {
+            gc_thread_atomic_add(&marker->activeWorkers, 1);
+            if (gc_mark_worker_steal(worker)) {
+                return ZR_TRUE;
+            }
+            gc_thread_atomic_add(&marker->activeWorkers, -1);
+        }
+        if (gc_thread_atomic_load(&marker->activeWorkers) == 0) {
+            return ZR_FALSE;
+        }
+        if (++spins >= ZR_GC_PARALLEL_MARK_IDLE_SPINS) {
+            spins = 0;
+            gc_thread_yield();
+        }
+    }
+}
+
+static void gc_mark_serial_push(SZrGcParallelMarker *marker, SZrRawObject *object) {
+    gc_thread_mutex_lock(&marker->serialLock);
+    object->gcList = marker->serialList;
+    marker->serialList = object;
+    gc_thread_mutex_unlock(&marker->serialLock);
+}
+
+static void gc_mark_worker_drain(SZrGcMarkWorker *worker) {
+    SZrGcParallelMarker *marker = worker->marker;
+    SZrState *state = marker->state;
+
+    g_gc_current_mark_worker = worker;
+    for (;;) {
+        SZrRawObject *object;
+
+        if (worker->grayCount >= ZR_GC_PARALLEL_MARK_DONATE_THRESHOLD &&
+            gc_thread_atomic_load_pointer(&worker->stealable) == ZR_NULL &&
+            (TZrUInt32)gc_thread_atomic_load(&marker->activeWorkers) < marker->workerCount) {
+            gc_mark_worker_donate(worker);
+        }
+
+        object = gc_mark_worker_pop(worker);
+        if (object == ZR_NULL) {
+            if (!gc_mark_worker_refill(worker)) {
+                break;
+            }
+            continue;
+        }
+
+        if (object->type == ZR_RAW_OBJECT_TYPE_THREAD) {
+            // stack and call-info walks resolve frame layouts lazily; keep them on the collecting thread.
+            gc_mark_serial_push(marker, object);
+            continue;
+        }
+
+        worker->work += garbage_collector_scan_gray_object(state, object);
+        worker->scannedObjects++;
+    }
+    g_gc_current_mark_worker = ZR_NULL;
+}
+
+static ZR_GC_THREAD_ROUTINE(gc_mark_thread_main, argument) {
+    SZrGcMarkWorker *worker = (SZrGcMarkWorker *)argument;
+    SZrGcParallelMarker *marker = worker->marker;
+    TZrUInt64 seenRound = 0;
+
+    gc_thread_mutex_lock(&marker->controlLock);
+    for (;;) {
+        while (!marker->shutdown && marker->round == seenRound) {
+            gc_thread_condition_wait(&marker->startCondition, &marker->controlLock);
+        }
+        if (marker->shutdown) {
+            break;
+        }
+        seenRound = marker->round;
+        gc_thread_mutex_unlock(&marker->controlLock);
+
+        gc_mark_worker_drain(worker);
+
+        gc_thread_mutex_lock(&marker->controlLock);
+        marker->finishedThreads++;
+        if (marker->finishedThreads == marker->threadCount) {
+            gc_thread_condition_broadcast(&marker->doneCondition);
+        }
+    }
+    gc_thread_mutex_unlock(&marker->controlLock);
+    ZR_GC_THREAD_ROUTINE_RETURN;
+}
+
+static void gc_mark_marker_destroy(SZrGcParallelMarker *marker) {
+    SZrGlobalState *global = marker->global;
+
+    gc_thread_mutex_lock(&marker->controlLock);
+    marker->shutdown = ZR_TRUE;
+    gc_thread_condition_broadcast(&marker->startCondition);
+    gc_thread_mutex_unlock(&marker->controlLock);
+    for (TZrUInt32 index = 0; index < marker->threadCount; index++) {
+        gc_thread_join(marker->threads[index]);
+    }
+
+    for (TZrUInt32 index = 0; index < ZR_GC_PARALLEL_MARK_WORKER_MAX; index++) {
+        gc_thread_mutex_destroy(&marker->workers[index].stealLock);
+    }
+    gc_thread_mutex_destroy(&marker->serialLock);
+    gc_thread_condition_destroy(&marker->doneCondition);
+    gc_thread_condition_destroy(&marker->startCondition);
+    gc_thread_mutex_destroy(&marker->controlLock);
+    ZrCore_Memory_RawFreeWithType(global, marker, sizeof(SZrGcParallelMarker), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+}
+
+static SZrGcParallelMarker *gc_mark_marker_create(SZrGlobalState *global, TZrUInt32 workerCount) {
+    SZrGcParallelMarker *marker =
+            ZrCore_Memory_RawMallocWithType(global, sizeof(SZrGcParallelMarker), ZR_MEMORY_NATIVE_TYPE_MANAGER);
+
+    if (marker == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    memset(marker, 0, sizeof(*marker));
+    marker->global = global;
+    marker->workerCount = workerCount;
+    gc_thread_mutex_init(&marker->controlLock);
+    gc_thread_condition_init(&marker->startCondition);
+    gc_thread_condition_init(&marker->doneCondition);
+    gc_thread_mutex_init(&marker->serialLock);
+    for (TZrUInt32 index = 0; index < ZR_GC_PARALLEL_MARK_WORKER_MAX; index++) {
+        marker->workers[index].marker = marker;
+        marker->workers[index].index = index;
+        gc_thread_mutex_init(&marker->workers[index].stealLock);
+    }
+
+    // worker 0 is the collecting thread itself.
+    for (TZrUInt32 index = 1; index < workerCount; index++) {
+        if (!gc_thread_start(&marker->threads[marker->threadCount],
+                             gc_mark_thread_main,
+                             &marker->workers[index])) {
+            break;
+        }
+        marker->threadCount++;
+    }
+    marker->workerCount = marker->threadCount + 1u;
+    return marker;
+}
+
+static TZrUInt32 gc_mark_effective_worker_count(const SZrGarbageCollector *collector) {
+    if (collector->workerCount > ZR_GC_PARALLEL_MARK_WORKER_MAX) {
+        return ZR_GC_PARALLEL_MARK_WORKER_MAX;
+    }
+    return collector->workerCount;
+}
+
+static SZrGcParallelMarker *gc_mark_acquire_marker(SZrGlobalState *global) {
+    SZrGarbageCollector *collector = global->garbageCollector;
+    TZrUInt32 workerCount = gc_mark_effective_worker_count(collector);
+
+    if (collector->parallelMarker != ZR_NULL && collector->parallelMarker->workerCount != workerCount) {
+        gc_mark_marker_destroy(collector->parallelMarker);
+        collector->parallelMarker = ZR_NULL;
+    }
+    if (collector->parallelMarker == ZR_NULL) {
+        collector->parallelMarker = gc_mark_marker_create(global, workerCount);
+    }
+    return collector->parallelMarker;
+}
+
+static SZrRawObject *gc_mark_take_gray_lists(SZrGarbageCollector *collector) {
+    SZrRawObject *list = collector->waitToScanObjectList;
+    SZrRawObject *again = collector->waitToScanAgainObjectList;
+
+    collector->waitToScanObjectList = ZR_NULL;
+    collector->waitToScanAgainObjectList = ZR_NULL;
+    if (list == ZR_NULL) {
+        return again;
+    }
+    if (again != ZR_NULL) {
+        SZrRawObject *tail = list;
+
+        while (tail->gcList != ZR_NULL) {
+            tail = tail->gcList;
+        }
+        tail->gcList = again;
+    }
+    return list;
+}
+
+static TZrSize gc_mark_run_round(SZrState *state, SZrGcParallelMarker *marker, SZrRawObject *grayList) {
+    SZrGarbageCollector *collector = state->global->garbageCollector;
+    SZrGarbageCollectorStatsSnapshot *snapshot = &collector->statsSnapshot;
+    TZrUInt32 next = 0;
+    TZrSize work = 0;
+
+    for (TZrUInt32 index = 0; index < marker->workerCount; index++) {
+        SZrGcMarkWorker *worker = &marker->workers[index];
+
+        worker->grayStack = ZR_NULL;
+        worker->grayCount = 0;
+        gc_thread_atomic_store_pointer(&worker->stealable, ZR_NULL);
+        worker->stealableCount = 0;
+        worker->scannedObjects = 0;
+        worker->work = 0;
+        worker->steals = 0;
+    }
+    while (grayList != ZR_NULL) {
+        SZrRawObject *object = grayList;
+        SZrGcMarkWorker *worker = &marker->workers[next];
+
+        grayList = object->gcList;
+        object->gcList = worker->grayStack;
+        worker->grayStack = object;
+        worker->grayCount++;
+        next = next + 1u < marker->workerCount ? next + 1u : 0u;
+    }
+
+    marker->state = state;
+    gc_thread_atomic_store(&marker->activeWorkers, (TZrInt32)marker->workerCount);
+    collector->parallelMarkActive = ZR_TRUE;
+
+    gc_thread_mutex_lock(&marker->controlLock);
+    marker->finishedThreads = 0;
+    marker->round++;
+    gc_thread_condition_broadcast(&marker->startCondition);
+    gc_thread_mutex_unlock(&marker->controlLock);
+
+    gc_mark_worker_drain(&marker->workers[0]);
+
+    gc_thread_mutex_lock(&marker->controlLock);
+    while (marker->finishedThreads < marker->threadCount) {
+        gc_thread_condition_wait(&marker->doneCondition, &marker->controlLock);
+    }
+    gc_thread_mutex_unlock(&marker->controlLock);
+    collector->parallelMarkActive = ZR_FALSE;
+
+    for (TZrUInt32 index = 0; index < marker->workerCount; index++) {
+        SZrGcMarkWorker *worker = &marker->workers[index];
+
+        snapshot->lastMarkWorkerObjects[index] += worker->scannedObjects;
+        snapshot->lastMarkWorkerWork[index] += worker->work;
+        snapshot->lastMarkWorkerSteals[index] += worker->steals;
+        work += worker->work;
+    }
+    return work;
+}
+
+static TZrSize gc_mark_finish_serial_objects(SZrState *state, SZrGcParallelMarker *marker) {
+    SZrGarbageCollectorStatsSnapshot *snapshot = &state->global->garbageCollector->statsSnapshot;
+    SZrRawObject *list = marker->serialList;
+    TZrSize work = 0;
+
+    marker->serialList = ZR_NULL;
+    while (list != ZR_NULL) {
+        SZrRawObject *object = list;
+
+        list = object->gcList;
+        object->gcList = ZR_NULL;
+        if (object->type == ZR_RAW_OBJECT_TYPE_THREAD) {
+            TZrSize objectWork = garbage_collector_scan_gray_object(state, object);
+
+            work += objectWork;
+            snapshot->lastMarkWorkerObjects[0]++;
+            snapshot->lastMarkWorkerWork[0] += objectWork;
+        } else {
+            // native data was claimed by a worker; its values and scan callback are marked here.
+            ZrGarbageCollectorReallyMarkObject(state, object);
+        }
+    }
+    return work;
+}
+
+TZrBool garbage_collector_parallel_mark_enabled(SZrGarbageCollector *collector) {
+    return collector->workerCount > 1u && !garbage_collector_minor_collection_is_active_fast(collector);
+}
+
+TZrBool garbage_collector_parallel_propagate_all(SZrState *state, TZrSize *outWork) {
+    SZrGlobalState *global = state->global;
+    SZrGarbageCollector *collector = global->garbageCollector;
+    SZrGcParallelMarker *marker;
+    TZrSize total = 0;
+
+    // helper threads are only started once there is gray work; an empty drain stays on the serial path.
+    if (collector->waitToScanObjectList == ZR_NULL && collector->waitToScanAgainObjectList == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    marker = gc_mark_acquire_marker(global);
+    if (marker == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    if (collector->statsSnapshot.lastMarkWorkerCount < marker->workerCount) {
+        collector->statsSnapshot.lastMarkWorkerCount = marker->workerCount;
+    }
+    collector->statsSnapshot.parallelMarkCount++;
+
+    // serial objects may gray new objects on the collector list, which then need another parallel round.
+    for (;;) {
+        SZrRawObject *grayList = gc_mark_take_gray_lists(collector);
+
+        if (grayList == ZR_NULL) {
+            break;
+        }
+        total += gc_mark_run_round(state, marker, grayList);
+        total += gc_mark_finish_serial_objects(state, marker);
+    }
+
+    *outWork = total;
+    return ZR_TRUE;
+}
+
+void garbage_collector_parallel_mark_object(SZrState *state, SZrRawObject *object) {
+    SZrGcMarkWorker *worker = g_gc_current_mark_worker;
+    volatile TZrInt32 *status;
+
+    if (object == ZR_NULL || worker == ZR_NULL ||
+        object->type >= ZR_RAW_OBJECT_TYPE_CLOSURE_ENUM_MAX || object->type == ZR_RAW_OBJECT_TYPE_INVALID) {
+        return;
+    }
+
+    if (object->type == ZR_RAW_OBJECT_TYPE_FUNCTION && ZR_CAST_FUNCTION(state, object)->ownerFunction != ZR_NULL) {
+        // embedded child functions re-stamp generation and status before marking, so they are serialized.
+        TZrBool handled;
+
+        gc_thread_mutex_lock(&worker->marker->serialLock);
+        handled = garbage_collector_try_mark_embedded_child_function_fast(
+                state, state->global->garbageCollector, ZR_FALSE, object);
+        gc_thread_mutex_unlock(&worker->marker->serialLock);
+        if (handled) {
+            return;
+        }
+    }
+
+    status = gc_mark_status_word(object);
+    if (gc_thread_atomic_load(status) != (TZrInt32)ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_INITED) {
+        return;
+    }
+    if (object->type == ZR_RAW_OBJECT_TYPE_STRING) {
+        gc_thread_atomic_store(status, (TZrInt32)ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_REFERENCED);
+        return;
+    }
+    if (!gc_thread_atomic_compare_exchange(status,
+                                         (TZrInt32)ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_INITED,
+                                         (TZrInt32)ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_WAIT_TO_SCAN)) {
+        return;
+    }
+    if (object->type == ZR_RAW_OBJECT_TYPE_NATIVE_DATA) {
+        gc_mark_serial_push(worker->marker, object);
+        return;
+    }
+
+    ZrGarbageCollectorReallyMarkObject(state, object);
+}
+
+void garbage_collector_parallel_mark_push_gray(SZrRawObject *object) {
+    SZrGcMarkWorker *worker = g_gc_current_mark_worker;
+
+    // claimed objects are already WAIT_TO_SCAN; embedded child functions arrive here INITED under serialLock.
+    if (object->garbageCollectMark.status == ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_INITED) {
+        gc_thread_atomic_store(gc_mark_status_word(object),
+                             (TZrInt32)ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_WAIT_TO_SCAN);
+    }
+    object->gcList = worker->grayStack;
+    worker->grayStack = object;
+    worker->grayCount++;
+}
+
+void garbage_collector_parallel_mark_shutdown(SZrGlobalState *global) {
+    if (global == ZR_NULL || global->garbageCollector == ZR_NULL || global->garbageCollector->parallelMarker == ZR_NULL) {
+        return;
+    }
+
+    gc_mark_marker_destroy(global->garbageCollector->parallelMarker);
+    global->garbageCollector->parallelMarker = ZR_NULL;
+}
@@ -0,0 +1,139 @@
+//
+// Thread, lock and atomic wrappers for the GC helper threads (parallel mark, background sweep).
+//
+
+#ifndef ZR_VM_CORE_GC_THREAD_H
+#define ZR_VM_CORE_GC_THREAD_H
+
+#include "zr_vm_core/conf.h"
+#include "zr_vm_core/raw_object.h"
+
+#if defined(ZR_PLATFORM_WIN)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(_MSC_VER)
+#define ZR_GC_THREAD_LOCAL __declspec(thread)
+#else
+#define ZR_GC_THREAD_LOCAL _Thread_local
+#endif
+
+#if defined(ZR_PLATFORM_WIN)
+typedef CRITICAL_SECTION ZrGcMutex;
+typedef CONDITION_VARIABLE ZrGcCondition;
+typedef HANDLE ZrGcThread;
+typedef unsigned(__stdcall *FZrGcThreadRoutine)(void *argument);
+
+#define ZR_GC_THREAD_ROUTINE(NAME, ARGUMENT) unsigned __stdcall NAME(void *ARGUMENT)
+#define ZR_GC_THREAD_ROUTINE_RETURN return 0
+
+static ZR_FORCE_INLINE void gc_thread_mutex_init(ZrGcMutex *mutex) { InitializeCriticalSection(mutex); }
+static ZR_FORCE_INLINE void gc_thread_mutex_destroy(ZrGcMutex *mutex) { DeleteCriticalSection(mutex); }
+static ZR_FORCE_INLINE void gc_thread_mutex_lock(ZrGcMutex *mutex) { EnterCriticalSection(mutex); }
+static ZR_FORCE_INLINE void gc_thread_mutex_unlock(ZrGcMutex *mutex) { LeaveCriticalSection(mutex); }
+static ZR_FORCE_INLINE void gc_thread_condition_init(ZrGcCondition *condition) { InitializeConditionVariable(condition); }
+static ZR_FORCE_INLINE void gc_thread_condition_destroy(ZrGcCondition *condition) { ZR_UNUSED_PARAMETER(condition); }
+static ZR_FORCE_INLINE void gc_thread_condition_signal(ZrGcCondition *condition) { WakeConditionVariable(condition); }
+static ZR_FORCE_INLINE void gc_thread_condition_broadcast(ZrGcCondition *condition) {
+    WakeAllConditionVariable(condition);
+}
+static ZR_FORCE_INLINE void gc_thread_condition_wait(ZrGcCondition *condition, ZrGcMutex *mutex) {
+    SleepConditionVariableCS(condition, mutex, INFINITE);
+}
+static ZR_FORCE_INLINE void gc_thread_yield(void) { SwitchToThread(); }
+
+static ZR_FORCE_INLINE TZrBool gc_thread_start(ZrGcThread *thread, FZrGcThreadRoutine routine, void *argument) {
+    uintptr_t handle = _beginthreadex(ZR_NULL, 0, routine, argument, 0, ZR_NULL);
+
+    if (handle == 0) {
+        return ZR_FALSE;
+    }
+    *thread = (HANDLE)handle;
+    return ZR_TRUE;
+}
+static ZR_FORCE_INLINE void gc_thread_join(ZrGcThread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+static ZR_FORCE_INLINE TZrInt32 gc_thread_atomic_load(volatile TZrInt32 *target) {
+    return (TZrInt32)InterlockedCompareExchange((volatile LONG *)target, 0, 0);
+}
+static ZR_FORCE_INLINE void gc_thread_atomic_store(volatile TZrInt32 *target, TZrInt32 value) {
+    InterlockedExchange((volatile LONG *)target, (LONG)value);
+}
+static ZR_FORCE_INLINE void gc_thread_atomic_add(volatile TZrInt32 *target, TZrInt32 delta) {
+    InterlockedExchangeAdd((volatile LONG *)target, (LONG)delta);
+}
+static ZR_FORCE_INLINE TZrBool gc_thread_atomic_compare_exchange(volatile TZrInt32 *target,
+                                                                 TZrInt32 expected,
+                                                                 TZrInt32 desired) {
+    return InterlockedCompareExchange((volatile LONG *)target, (LONG)desired, (LONG)expected) == (LONG)expected;
+}
+static ZR_FORCE_INLINE SZrRawObject *gc_thread_atomic_load_pointer(SZrRawObject *volatile *target) {
+    return (SZrRawObject *)InterlockedCompareExchangePointer((PVOID volatile *)target, ZR_NULL, ZR_NULL);
+}
+static ZR_FORCE_INLINE void gc_thread_atomic_store_pointer(SZrRawObject *volatile *target, SZrRawObject *value) {
+    InterlockedExchangePointer((PVOID volatile *)target, value);
+}
+#else
+typedef pthread_mutex_t ZrGcMutex;
+typedef pthread_cond_t ZrGcCondition;
+typedef pthread_t ZrGcThread;
+typedef void *(*FZrGcThreadRoutine)(void *argument);
+
+#define ZR_GC_THREAD_ROUTINE(NAME, ARGUMENT) void *NAME(void *ARGUMENT)
+#define ZR_GC_THREAD_ROUTINE_RETURN return ZR_NULL
+
+static ZR_FORCE_INLINE void gc_thread_mutex_init(ZrGcMutex *mutex) { pthread_mutex_init(mutex, ZR_NULL); }
+static ZR_FORCE_INLINE void gc_thread_mutex_destroy(ZrGcMutex *mutex) { pthread_mutex_destroy(mutex); }
+static ZR_FORCE_INLINE void gc_thread_mutex_lock(ZrGcMutex *mutex) { pthread_mutex_lock(mutex); }
+static ZR_FORCE_INLINE void gc_thread_mutex_unlock(ZrGcMutex *mutex) { pthread_mutex_unlock(mutex); }
+static ZR_FORCE_INLINE void gc_thread_condition_init(ZrGcCondition *condition) { pthread_cond_init(condition, ZR_NULL); }
+static ZR_FORCE_INLINE void gc_thread_condition_destroy(ZrGcCondition *condition) { pthread_cond_destroy(condition); }
+static ZR_FORCE_INLINE void gc_thread_condition_signal(ZrGcCondition *condition) { pthread_cond_signal(condition); }
+static ZR_FORCE_INLINE void gc_thread_condition_broadcast(ZrGcCondition *condition) {
+    pthread_cond_broadcast(condition);
+}
+static ZR_FORCE_INLINE void gc_thread_condition_wait(ZrGcCondition *condition, ZrGcMutex *mutex) {
+    pthread_cond_wait(condition, mutex);
+}
+static ZR_FORCE_INLINE void gc_thread_yield(void) { sched_yield(); }
+
+static ZR_FORCE_INLINE TZrBool gc_thread_start(ZrGcThread *thread, FZrGcThreadRoutine routine, void *argument) {
+    return pthread_create(thread, ZR_NULL, routine, argument) == 0;
+}
+static ZR_FORCE_INLINE void gc_thread_join(ZrGcThread thread) { pthread_join(thread, ZR_NULL); }
+
+static ZR_FORCE_INLINE TZrInt32 gc_thread_atomic_load(volatile TZrInt32 *target) {
+    return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+static ZR_FORCE_INLINE void gc_thread_atomic_store(volatile TZrInt32 *target, TZrInt32 value) {
+    __atomic_store_n(target, value, __ATOMIC_SEQ_CST);
+}
+static ZR_FORCE_INLINE void gc_thread_atomic_add(volatile TZrInt32 *target, TZrInt32 delta) {
+    __atomic_add_fetch(target, delta, __ATOMIC_SEQ_CST);
+}
+static ZR_FORCE_INLINE TZrBool gc_thread_atomic_compare_exchange(volatile TZrInt32 *target,
+                                                                 TZrInt32 expected,
+                                                                 TZrInt32 desired) {
+    return __atomic_compare_exchange_n(target, &expected, desired, ZR_FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+                   ? ZR_TRUE
+                   : ZR_FALSE;
+}
+static ZR_FORCE_INLINE SZrRawObject *gc_thread_atomic_load_pointer(SZrRawObject *volatile *target) {
+    return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+static ZR_FORCE_INLINE void gc_thread_atomic_store_pointer(SZrRawObject *volatile *target, SZrRawObject *value) {
+    __atomic_store_n(target, value, __ATOMIC_SEQ_CST);
+}
+#endif
+
+#endif // ZR_VM_CORE_GC_THREAD_H
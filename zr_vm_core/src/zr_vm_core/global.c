@@ -10,6 +10,7 @@
 #include "zr_vm_core/gc.h"
 #include "zr_vm_core/hash.h"
 #include "zr_vm_core/hash_set.h"
+#include "zr_vm_core/jit.h"
 #include "zr_vm_core/memory.h"
 #include "zr_vm_core/meta.h"
 #include "zr_vm_core/object.h"
@@ -170,7 +171,7 @@ static TZrInt64 global_state_string_length_getter_native(SZrState *state) {
         return 1;
     }
 
-    if (!ZrCore_String_GetCodePointLength(receiverString, &codePointLength)) {
+    if (!ZrCore_String_GetCodePointLength(state, receiverString, &codePointLength)) {
         ZrCore_Debug_RunError(state, "invalid UTF-8 string");
     }
 
@@ -197,7 +198,7 @@ static TZrInt64 global_state_string_byte_length_getter_native(SZrState *state) {
     }
 
     byteLength = ZrCore_String_GetByteLength(receiverString);
-    if (!ZrCore_Utf8_IsValid(ZrCore_String_GetNativeString(receiverString), byteLength)) {
+    if (!ZrCore_String_IsValidUtf8(state, receiverString)) {
         ZrCore_Debug_RunError(state, "invalid UTF-8 string");
     }
 
@@ -209,7 +210,7 @@ static TZrInt64 global_state_string_byte_length_getter_native(SZrState *state) {
 static TZrInt64 global_state_string_to_array_native(SZrState *state) {
     TZrStackValuePointer base;
     SZrString *receiverString;
-    SZrObject *byteArray = ZR_NULL;
+    SZrObject *bytes = ZR_NULL;
 
     if (state == ZR_NULL || state->callInfoList == ZR_NULL) {
         return 0;
@@ -223,17 +224,17 @@ static TZrInt64 global_state_string_to_array_native(SZrState *state) {
         return 1;
     }
 
-    if (!ZrCore_Utf8_IsValid(ZrCore_String_GetNativeString(receiverString),
-                             ZrCore_String_GetByteLength(receiverString))) {
+    if (!ZrCore_String_IsValidUtf8(state, receiverString)) {
         ZrCore_Debug_RunError(state, "invalid UTF-8 string");
     }
 
-    if (!ZrCore_String_ToByteArray(state, receiverString, &byteArray) || byteArray == ZR_NULL) {
-        ZrCore_Debug_RunError(state, "failed to materialize string byte array");
+    if (!ZrCore_String_ToByteArray(state, receiverString, &bytes) || bytes == ZR_NULL) {
+        ZrCore_Debug_RunError(state, "failed to materialize string bytes");
     }
 
-    ZrCore_Value_InitAsRawObject(state, ZrCore_Stack_GetValue(base), ZR_CAST_RAW_OBJECT_AS_SUPER(byteArray));
-    ZrCore_Stack_GetValue(base)->type = ZR_VALUE_TYPE_ARRAY;
+    // resolving the Bytes prototype may import zr.system and grow the stack, so re-read the frame base.
+    base = state->callInfoList->functionBase.valuePointer;
+    ZrCore_Value_InitAsRawObject(state, ZrCore_Stack_GetValue(base), ZR_CAST_RAW_OBJECT_AS_SUPER(bytes));
     state->stackTop.valuePointer = base + 1;
     return 1;
 }
@@ -373,6 +374,7 @@ SZrGlobalState *ZrCore_GlobalState_New(FZrAllocator allocator, TZrPtr userAlloca
     global->mainThreadState = newState;
     global_trace("global new state created state=%p", (void *)newState);
     global->threadWithStackClosures = ZR_NULL;
+    global->coroutineList = ZR_NULL;
     // todo: main thread cannot yield
 
     // todo:
@@ -394,6 +396,9 @@ SZrGlobalState *ZrCore_GlobalState_New(FZrAllocator allocator, TZrPtr userAlloca
     global->aotModuleLoaderUserData = ZR_NULL;
     global->nativeModuleLoader = ZR_NULL;
     global->nativeModuleLoaderUserData = ZR_NULL;
+    global->startupImage = ZR_NULL;
+    global->moduleRegistryGeneration = 0;
+    global->startupImageGeneration = 0;
     global->moduleLoadDiagnostic[0] = '\0';
     global->ownershipStrongRefObserver = ZR_NULL;
     global->ownershipStrongRefObserverUserData = ZR_NULL;
@@ -434,6 +439,9 @@ SZrGlobalState *ZrCore_GlobalState_New(FZrAllocator allocator, TZrPtr userAlloca
     global->aotModuleLoaderUserData = ZR_NULL;
     global->nativeModuleLoader = ZR_NULL;
     global->nativeModuleLoaderUserData = ZR_NULL;
+    global->startupImage = ZR_NULL;
+    global->moduleRegistryGeneration = 0;
+    global->startupImageGeneration = 0;
     global->moduleLoadDiagnostic[0] = '\0';
     global->ownershipStrongRefObserver = ZR_NULL;
     global->ownershipStrongRefObserverUserData = ZR_NULL;
@@ -670,9 +678,19 @@ void ZrCore_GlobalState_Free(SZrGlobalState *global) {
         ZrCore_Array_Free(global->mainThreadState, &global->importCompileInfoStack);
     }
 
+    // suspended coroutines still hold open closure values that point at gc objects
+    while (global->coroutineList != ZR_NULL) {
+        ZrCore_State_FreeCoroutine(global->coroutineList);
+    }
+
     ZrCore_GarbageCollector_Free(global, global->garbageCollector);
     global->garbageCollector = ZR_NULL;
 
+    ZrCore_Module_SetStartupImage(global, ZR_NULL);
+
+    ZrCore_ObjectShape_FreeAll(global);
+    ZrCore_Jit_FreeAll(global);
+
     ZrCore_StringTable_Free(global, global->stringTable);
     global->stringTable = ZR_NULL;
 
@@ -31,6 +31,48 @@ TZrUInt64 ZrCore_Hash_Create(SZrGlobalState *global, TZrNativeString string, TZr
     return ZrHashSeedCreateInternal(string, length, global->hashSeed);
 }
 
+// seeded like ZrCore_Hash_Create so streamed digests are interchangeable with one-shot string hashes.
+SZrHashStream *ZrCore_HashStream_New(SZrGlobalState *global) {
+    XXH3_state_t *state;
+
+    if (global == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    state = XXH3_createState();
+    if (state == ZR_NULL) {
+        return ZR_NULL;
+    }
+    if (XXH3_64bits_reset_withSeed(state, global->hashSeed) == XXH_ERROR) {
+        XXH3_freeState(state);
+        return ZR_NULL;
+    }
+    return (SZrHashStream *)state;
+}
+
+TZrBool ZrCore_HashStream_Update(SZrHashStream *stream, const TZrByte *data, TZrSize length) {
+    if (stream == ZR_NULL || (data == ZR_NULL && length > 0)) {
+        return ZR_FALSE;
+    }
+    if (length == 0) {
+        return ZR_TRUE;
+    }
+    return XXH3_64bits_update((XXH3_state_t *)stream, data, length) != XXH_ERROR;
+}
+
+TZrUInt64 ZrCore_HashStream_Digest(const SZrHashStream *stream) {
+    if (stream == ZR_NULL) {
+        return 0;
+    }
+    return XXH3_64bits_digest((const XXH3_state_t *)stream);
+}
+
+void ZrCore_HashStream_Free(SZrHashStream *stream) {
+    if (stream != ZR_NULL) {
+        XXH3_freeState((XXH3_state_t *)stream);
+    }
+}
+
 TZrUInt64 ZrCore_Hash_CreateStable64(const TZrByte *data, TZrSize length) {
     return XXH3_64bits(data, length);
 }
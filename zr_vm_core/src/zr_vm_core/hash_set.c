@@ -169,7 +169,7 @@ TZrBool ZrCore_HashSet_Rehash(SZrState *state, SZrHashSet *set, TZrSize newCapac
                 ZR_VALUE_IS_TYPE_NULL(objectPtr->key.type)) {
                 hash = objectPtr->key.value.nativeObject.nativeUInt64;
             } else if (objectPtr->key.isGarbageCollectable && objectPtr->key.value.object != ZR_NULL) {
-                hash = objectPtr->key.value.object->hash;
+                hash = ZrCore_RawObject_GetHash(objectPtr->key.value.object);
             } else {
                 hash = ZrCore_Value_GetHash(state, &objectPtr->key);
             }
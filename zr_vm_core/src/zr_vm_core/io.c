@@ -42,33 +42,61 @@ static TZrInt32 io_read_char(SZrIo *io) {
     return c;
 }
 
+// Fixed-size fields nearly always sit inside the current chunk (always, for a resident image).
+static ZR_FORCE_INLINE void io_read_exact(SZrIo *io, TZrPtr buffer, TZrSize size) {
+    if (ZR_LIKELY(io->remained >= size)) {
+        ZrCore_Memory_RawCopy(buffer, io->pointer, size);
+        io->remained -= size;
+        io->pointer += size;
+        return;
+    }
+    ZrCore_Io_Read(io, (TZrBytePtr)buffer, size);
+}
+
+/*
+ * Hands out `size` bytes of a resident image in place when the caller keeps the image open until runtime
+ * conversion and the bytes are aligned for their element type; ZR_NULL means the caller copies as before.
+ */
+static TZrBytePtr io_borrow_resident(SZrIo *io, TZrSize size, TZrSize alignment) {
+    TZrBytePtr data;
+
+    if (!io->borrowResidentImage || !io->isResidentImage || io->remained < size ||
+        ((TZrSize)io->pointer & (alignment - 1u)) != 0u) {
+        return ZR_NULL;
+    }
+    data = io->pointer;
+    io->pointer += size;
+    io->remained -= size;
+    return data;
+}
+
 static ZR_FORCE_INLINE TZrSize io_read_size(SZrIo *io) {
     TZrSize size;
-    ZrCore_Io_Read(io, (TZrBytePtr) &size, sizeof(size));
+    io_read_exact(io, &size, sizeof(size));
     return size;
 }
 
 static ZR_FORCE_INLINE TZrFloat64 io_read_float(SZrIo *io) {
     TZrFloat64 value;
-    ZrCore_Io_Read(io, (TZrBytePtr) &value, sizeof(value));
+    io_read_exact(io, &value, sizeof(value));
     return value;
 }
 
 static ZR_FORCE_INLINE TZrInt64 io_read_int(SZrIo *io) {
     TZrInt64 value;
-    ZrCore_Io_Read(io, (TZrBytePtr) &value, sizeof(value));
+    io_read_exact(io, &value, sizeof(value));
     return value;
 }
 
 static ZR_FORCE_INLINE TZrUInt64 io_read_u_int(SZrIo *io) {
     TZrUInt64 value;
-    ZrCore_Io_Read(io, (TZrBytePtr) &value, sizeof(value));
+    io_read_exact(io, &value, sizeof(value));
     return value;
 }
 
 #define ZR_IO_READ_RAW(IO, VALUE, SIZE) ZrCore_Io_Read(IO, &(VALUE), SIZE);
 
-#define ZR_IO_READ_NATIVE_TYPE(IO, DATA, TYPE) ZrCore_Io_Read(IO, (TZrBytePtr) & (DATA), sizeof(TYPE))
+#define ZR_IO_READ_NATIVE_TYPE(IO, DATA, TYPE) io_read_exact(IO, &(DATA), sizeof(TYPE))
 
 
 static SZrString *io_read_string_with_length(SZrIo *io) {
@@ -342,6 +370,7 @@ static void io_read_function_exception_handlers(SZrIo *io,
 }
 
 static void io_read_functions(SZrIo *io, SZrIoFunction *functions, TZrSize count);
+static void io_read_function_record(SZrIo *io, SZrIoFunction *function);
 static void io_read_function_constant_variables(SZrIo *io, SZrIoFunctionConstantVariable *variables, TZrSize count) {
     SZrGlobalState *global = io->state->global;
     for (TZrSize i = 0; i < count; i++) {
@@ -353,7 +382,7 @@ static void io_read_function_constant_variables(SZrIo *io, SZrIoFunctionConstant
             ZR_IO_READ_NATIVE_TYPE(io, variable->hasFunctionValue, TZrBool);
             if (variable->hasFunctionValue) {
                 variable->functionValue = ZR_IO_MALLOC_NATIVE_DATA(global, sizeof(SZrIoFunction));
-                io_read_functions(io, variable->functionValue, 1);
+                io_read_function_record(io, variable->functionValue);
             }
         } else {
             io_read_value(io, variable->type, &variable->value);
@@ -1175,8 +1204,7 @@ static void io_read_function_closures(SZrIo *io, SZrIoFunctionClosure *closures,
     for (TZrSize i = 0; i < count; i++) {
         SZrIoFunctionClosure *closure = &closures[i];
         closure->subFunction = ZR_IO_MALLOC_NATIVE_DATA(global, sizeof(SZrIoFunction));
-        io_read_functions(io, closure->subFunction, 1);
-        // todo:
+        io_read_function_record(io, closure->subFunction);
     }
 }
 
@@ -1194,6 +1222,10 @@ static void io_read_function_debug_infos(SZrIo *io, SZrIoFunctionDebugInfo *debu
         ZR_IO_READ_NATIVE_TYPE(io, debugInfo->instructionsLength, TZrSize);
         debugInfo->instructionsLine = ZR_NULL;
         if (debugInfo->instructionsLength > 0) {
+            debugInfo->instructionsLine = (TZrUInt64 *)io_borrow_resident(
+                    io, sizeof(TZrUInt64) * debugInfo->instructionsLength, alignof(TZrUInt64));
+        }
+        if (debugInfo->instructionsLength > 0 && debugInfo->instructionsLine == ZR_NULL) {
             debugInfo->instructionsLine =
                     ZR_IO_MALLOC_NATIVE_DATA(global, sizeof(TZrUInt64) * debugInfo->instructionsLength);
             if (debugInfo->instructionsLine != ZR_NULL) {
@@ -1210,6 +1242,13 @@ static void io_read_function_debug_infos(SZrIo *io, SZrIoFunctionDebugInfo *debu
 
         if (io->sourceVersionPatch >= ZR_IO_SOURCE_PATCH_HAS_FUNCTION_SOURCE_RANGES &&
             debugInfo->instructionsLength > 0) {
+            debugInfo->instructionRanges = (SZrIoInstructionSourceRange *)io_borrow_resident(
+                    io,
+                    sizeof(SZrIoInstructionSourceRange) * debugInfo->instructionsLength,
+                    alignof(SZrIoInstructionSourceRange));
+        }
+        if (io->sourceVersionPatch >= ZR_IO_SOURCE_PATCH_HAS_FUNCTION_SOURCE_RANGES &&
+            debugInfo->instructionsLength > 0 && debugInfo->instructionRanges == ZR_NULL) {
             debugInfo->instructionRanges = ZR_IO_MALLOC_NATIVE_DATA(global,
                                                                     sizeof(SZrIoInstructionSourceRange) *
                                                                             debugInfo->instructionsLength);
@@ -1281,6 +1320,9 @@ static void io_read_functions(SZrIo *io, SZrIoFunction *functions, TZrSize count
     SZrGlobalState *global = io->state->global;
     for (TZrSize i = 0; i < count; i++) {
         SZrIoFunction *function = &functions[i];
+        function->deferredRecord = ZR_NULL;
+        function->deferredRecordLength = 0;
+        function->deferredImage = ZR_NULL;
         function->name = io_read_string_with_length(io);
         ZR_IO_READ_NATIVE_TYPE(io, function->startLine, TZrUInt64);
         ZR_IO_READ_NATIVE_TYPE(io, function->endLine, TZrUInt64);
@@ -1297,9 +1339,13 @@ static void io_read_functions(SZrIo *io, SZrIoFunction *functions, TZrSize count
         ZR_IO_READ_NATIVE_TYPE(io, function->instructionsLength, TZrSize);
         // read instructions ...
         if (function->instructionsLength > 0) {
+            TZrSize instructionBytes = sizeof(TZrInstruction) * function->instructionsLength;
             function->instructions =
-                    ZR_IO_MALLOC_NATIVE_DATA(global, sizeof(TZrInstruction) * function->instructionsLength);
-            ZrCore_Io_Read(io, (TZrBytePtr) function->instructions, sizeof(TZrInstruction) * function->instructionsLength);
+                    (TZrInstruction *)io_borrow_resident(io, instructionBytes, alignof(TZrInstruction));
+            if (function->instructions == ZR_NULL) {
+                function->instructions = ZR_IO_MALLOC_NATIVE_DATA(global, instructionBytes);
+                ZrCore_Io_Read(io, (TZrBytePtr) function->instructions, instructionBytes);
+            }
         } else {
             function->instructions = ZR_NULL;
         }
@@ -1593,9 +1639,13 @@ static void io_read_functions(SZrIo *io, SZrIoFunction *functions, TZrSize count
         if (io->sourceVersionPatch >= ZR_IO_SOURCE_PATCH_HAS_PROTOTYPE_BLOB) {
             ZR_IO_READ_NATIVE_TYPE(io, function->prototypeDataLength, TZrSize);
             if (function->prototypeDataLength > 0) {
-                function->prototypeData = ZR_IO_MALLOC_NATIVE_DATA(global, function->prototypeDataLength);
-                if (function->prototypeData != ZR_NULL) {
-                    ZrCore_Io_Read(io, function->prototypeData, function->prototypeDataLength);
+                function->prototypeData =
+                        io_borrow_resident(io, function->prototypeDataLength, alignof(TZrUInt32));
+                if (function->prototypeData == ZR_NULL) {
+                    function->prototypeData = ZR_IO_MALLOC_NATIVE_DATA(global, function->prototypeDataLength);
+                    if (function->prototypeData != ZR_NULL) {
+                        ZrCore_Io_Read(io, function->prototypeData, function->prototypeDataLength);
+                    }
                 }
             }
         }
@@ -1618,6 +1668,88 @@ static void io_read_functions(SZrIo *io, SZrIoFunction *functions, TZrSize count
     }
 }
 
+// Only called once the whole record is known to sit in the current chunk of a resident image.
+static ZR_FORCE_INLINE void io_skip_resident(SZrIo *io, TZrSize size) {
+    io->pointer += size;
+    io->remained -= size;
+}
+
+static void io_skip_string_with_length(SZrIo *io) { io_skip_resident(io, io_read_size(io)); }
+
+/*
+ * Reads what a runtime shell needs before its first call: the name, lines and arity the constant rebinding matches on,
+ * the stack size, and the capture list closure creation walks. Instructions, locals and everything after the captures
+ * stay in the image; the caller moves the cursor past the record.
+ */
+static void io_read_function_header_deferred(SZrIo *io, SZrIoFunction *function) {
+    SZrGlobalState *global = io->state->global;
+    TZrSize frameSlotLayoutsLength;
+    TZrSize localVariablesLength;
+
+    function->name = io_read_string_with_length(io);
+    ZR_IO_READ_NATIVE_TYPE(io, function->startLine, TZrUInt64);
+    ZR_IO_READ_NATIVE_TYPE(io, function->endLine, TZrUInt64);
+    ZR_IO_READ_NATIVE_TYPE(io, function->parametersLength, TZrSize);
+    ZR_IO_READ_NATIVE_TYPE(io, function->hasVarArgs, TZrUInt64);
+    ZR_IO_READ_NATIVE_TYPE(io, function->stackSize, TZrUInt32);
+    if (io->sourceVersionPatch >= ZR_IO_SOURCE_PATCH_HAS_FUNCTION_FRAME_LAYOUT) {
+        io_skip_resident(io, sizeof(TZrUInt32) * 2u);
+        frameSlotLayoutsLength = io_read_size(io);
+        io_skip_resident(io, frameSlotLayoutsLength * (sizeof(TZrUInt32) * 5u + sizeof(TZrUInt8) * 2u + sizeof(TZrUInt16)));
+    }
+    ZR_IO_READ_NATIVE_TYPE(io, function->instructionsLength, TZrSize);
+    io_skip_resident(io, sizeof(TZrInstruction) * function->instructionsLength);
+
+    localVariablesLength = io_read_size(io);
+    for (TZrSize index = 0; index < localVariablesLength; index++) {
+        io_skip_string_with_length(io);
+        io_skip_resident(io, sizeof(TZrUInt32) + sizeof(TZrUInt64) * 4u);
+        if (io->sourceVersionPatch >= ZR_IO_SOURCE_PATCH_HAS_FUNCTION_ESCAPE_METADATA) {
+            io_skip_resident(io, sizeof(TZrUInt32) * 2u);
+        }
+    }
+
+    ZR_IO_READ_NATIVE_TYPE(io, function->closureVariablesLength, TZrSize);
+    if (function->closureVariablesLength > 0) {
+        function->closureVariables = ZR_IO_MALLOC_NATIVE_DATA(global, sizeof(SZrIoFunctionClosureVariable) *
+                                                                              function->closureVariablesLength);
+        if (function->closureVariables != ZR_NULL) {
+            io_read_function_closure_variables(io, function->closureVariables, function->closureVariablesLength);
+        }
+    }
+}
+
+// Nested records (closures and constant function values) are length-prefixed from ZR_IO_SOURCE_PATCH_HAS_FUNCTION_RECORD_LENGTH.
+static void io_read_function_record(SZrIo *io, SZrIoFunction *function) {
+    TZrSize recordLength;
+    TZrBytePtr record;
+
+    ZrCore_Memory_RawSet(function, 0, sizeof(*function));
+    if (io->sourceVersionPatch < ZR_IO_SOURCE_PATCH_HAS_FUNCTION_RECORD_LENGTH) {
+        io_read_functions(io, function, 1);
+        return;
+    }
+
+    recordLength = io_read_size(io);
+    if (io->residentImage == ZR_NULL || !io->isResidentImage || io->remained < recordLength) {
+        io_read_functions(io, function, 1);
+        return;
+    }
+
+    record = io->pointer;
+    io_read_function_header_deferred(io, function);
+    if ((TZrSize)(io->pointer - record) > recordLength) {
+        ZrCore_Debug_RunError(io->state,
+                              "io function record is shorter than its header: recordLength=%u",
+                              (TZrUInt32)recordLength);
+    }
+    function->deferredRecord = record;
+    function->deferredRecordLength = recordLength;
+    function->deferredImage = io->residentImage;
+    io->remained -= recordLength - (TZrSize)(io->pointer - record);
+    io->pointer = record + recordLength;
+}
+
 static void io_read_method(SZrIo *io, SZrIoMethod *method) {
     SZrGlobalState *global = io->state->global;
     method->name = io_read_string_with_length(io);
@@ -1811,7 +1943,10 @@ SZrIo *ZrCore_Io_New(struct SZrGlobalState *global) {
     io->pointer = ZR_NULL;
     io->remained = 0;
     io->isBinary = ZR_FALSE;
+    io->isResidentImage = ZR_FALSE;
+    io->borrowResidentImage = ZR_FALSE;
     io->sourceVersionPatch = 0;
+    io->residentImage = ZR_NULL;
     return io;
 }
 
@@ -1829,7 +1964,10 @@ void ZrCore_Io_Init(SZrState *state, SZrIo *io, FZrIoRead read, FZrIoClose close
     io->pointer = ZR_NULL;
     io->remained = 0;
     io->isBinary = ZR_FALSE;
+    io->isResidentImage = ZR_FALSE;
+    io->borrowResidentImage = ZR_FALSE;
     io->sourceVersionPatch = 0;
+    io->residentImage = ZR_NULL;
 }
 
 TZrSize ZrCore_Io_Read(SZrIo *io, TZrBytePtr buffer, TZrSize size) {
@@ -1867,6 +2005,9 @@ SZrIoSource *ZrCore_Io_ReadSourceNew(SZrIo *io) {
     ZR_IO_READ_NATIVE_TYPE(io, source->versionPatch, TZrUInt32);
     ZR_IO_READ_NATIVE_TYPE(io, source->format, TZrUInt64);
     io->sourceVersionPatch = source->versionPatch;
+    if (io->residentImage != ZR_NULL) {
+        io->residentImage->sourceVersionPatch = source->versionPatch;
+    }
     if (source->versionPatch > ZR_IO_SOURCE_PATCH_CURRENT) {
         ZrCore_Debug_RunError(io->state,
                               "io source version patch is newer than this runtime: actualPatch=%u supportedPatch=%u",
@@ -1884,12 +2025,84 @@ SZrIoSource *ZrCore_Io_ReadSourceNew(SZrIo *io) {
         ZrCore_Debug_RunError(io->state, "io source version is too old for this runtime");
         return ZR_NULL;
     }
+    source->valueCellSize = 0;
+    source->stackSlotSize = 0;
+    if (source->versionPatch >= ZR_IO_SOURCE_PATCH_HAS_VALUE_CELL_SIZE) {
+        ZR_IO_READ_NATIVE_TYPE(io, source->valueCellSize, TZrUInt8);
+        ZR_IO_READ_NATIVE_TYPE(io, source->stackSlotSize, TZrUInt8);
+        if (source->valueCellSize != (TZrUInt8)sizeof(SZrTypeValue) ||
+            source->stackSlotSize != (TZrUInt8)sizeof(SZrTypeValueOnStack)) {
+            ZrCore_Debug_RunError(io->state,
+                                  "io source frame layout was written for another value cell: "
+                                  "valueCellSize=%u stackSlotSize=%u expectedValueCellSize=%u expectedStackSlotSize=%u",
+                                  (TZrUInt32)source->valueCellSize,
+                                  (TZrUInt32)source->stackSlotSize,
+                                  (TZrUInt32)sizeof(SZrTypeValue),
+                                  (TZrUInt32)sizeof(SZrTypeValueOnStack));
+            return ZR_NULL;
+        }
+    } else if (source->versionPatch >= ZR_IO_SOURCE_PATCH_HAS_FUNCTION_FRAME_LAYOUT) {
+        // frame byte offsets are in units of a value cell whose size was not recorded, so they cannot be trusted
+        ZrCore_Debug_RunError(io->state,
+                              "io source frame layout predates the recorded value cell size; recompile it: actualPatch=%u",
+                              source->versionPatch);
+        return ZR_NULL;
+    }
     ZR_IO_READ_NATIVE_TYPE(io, source->modulesLength, TZrSize);
     source->modules = ZR_IO_MALLOC_NATIVE_DATA(global, sizeof(SZrIoModule) * source->modulesLength);
     io_read_modules(io, source->modules, source->modulesLength);
     return source;
 }
 
+SZrIoResidentImage *ZrCore_Io_ResidentImage_Adopt(SZrState *state, SZrIo *io) {
+    SZrIoResidentImage *image;
+
+    // without a close there is no owner to hand over, so the bytes may not outlive the caller.
+    if (state == ZR_NULL || io == ZR_NULL || !io->isResidentImage || io->close == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    image = ZR_IO_MALLOC_NATIVE_DATA(state->global, sizeof(SZrIoResidentImage));
+    if (image == ZR_NULL) {
+        return ZR_NULL;
+    }
+    image->referenceCount = 1;
+    image->sourceVersionPatch = io->sourceVersionPatch;
+    image->close = io->close;
+    image->customData = io->customData;
+    // the reader still needs customData; only the duty to close moves to the image.
+    io->close = ZR_NULL;
+    io->residentImage = image;
+    return image;
+}
+
+void ZrCore_Io_ResidentImage_Retain(SZrIoResidentImage *image) {
+    if (image != ZR_NULL) {
+        image->referenceCount++;
+    }
+}
+
+void ZrCore_Io_ResidentImage_Release(SZrState *state, SZrIoResidentImage *image) {
+    if (image == ZR_NULL || --image->referenceCount > 0) {
+        return;
+    }
+
+    if (image->close != ZR_NULL) {
+        image->close(state, image->customData);
+    }
+    ZR_IO_FREE_NATIVE_DATA(state->global, image, sizeof(SZrIoResidentImage));
+}
+
+TZrBool ZrCore_Io_ReadFunction(SZrIo *io, SZrIoFunction *function) {
+    if (io == ZR_NULL || function == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    ZrCore_Memory_RawSet(function, 0, sizeof(*function));
+    io_read_functions(io, function, 1);
+    return ZR_TRUE;
+}
+
 void ZrCore_Io_ReadSourceFree(struct SZrGlobalState *global, SZrIoSource *source) {
     ZR_UNUSED_PARAMETER(global);
     ZR_UNUSED_PARAMETER(source);
@@ -5,6 +5,7 @@
 #include "zr_vm_core/io.h"
 
 #include "zr_vm_core/closure.h"
+#include "zr_vm_core/debug.h"
 #include "zr_vm_core/function.h"
 #include "zr_vm_core/gc.h"
 #include "zr_vm_core/memory.h"
@@ -639,6 +640,122 @@ static TZrBool io_runtime_convert_constant(SZrState *state,
     }
 }
 
+static TZrBool io_runtime_copy_closure_variables(SZrState *state,
+                                                const SZrIoFunction *source,
+                                                SZrFunction *function) {
+    SZrGlobalState *global = state->global;
+
+    if (source->closureVariablesLength > 0) {
+        TZrSize closureBytes = sizeof(SZrFunctionClosureVariable) * source->closureVariablesLength;
+        function->closureValueList =
+                (SZrFunctionClosureVariable *)ZrCore_Memory_RawMallocWithType(global,
+                                                                              closureBytes,
+                                                                              ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+        if (function->closureValueList == ZR_NULL) {
+            return ZR_FALSE;
+        }
+
+        for (TZrSize index = 0; index < source->closureVariablesLength; index++) {
+            function->closureValueList[index].name = source->closureVariables[index].name;
+            function->closureValueList[index].inStack = source->closureVariables[index].inStack ? ZR_TRUE : ZR_FALSE;
+            function->closureValueList[index].index = source->closureVariables[index].index;
+            function->closureValueList[index].valueType = (EZrValueType)source->closureVariables[index].valueType;
+            function->closureValueList[index].scopeDepth = source->closureVariables[index].scopeDepth;
+            function->closureValueList[index].escapeFlags = source->closureVariables[index].escapeFlags;
+        }
+        function->closureValueLength = (TZrUInt32)source->closureVariablesLength;
+    }
+    return ZR_TRUE;
+}
+
+/*
+ * A record the reader left in a resident image becomes a shell: the header and captures are enough to create closures
+ * over it and to rebind constants to it, and ZrCore_Function_MaterializeLazyBody decodes the rest on the first call.
+ */
+static TZrBool io_runtime_populate_lazy_function(SZrState *state,
+                                                 const SZrIoFunction *source,
+                                                 SZrFunction *function) {
+    SZrFunctionLazyBody *lazyBody;
+
+    function->functionName = source->name;
+    function->parameterCount = (TZrUInt16)source->parametersLength;
+    function->hasVariableArguments = source->hasVarArgs ? ZR_TRUE : ZR_FALSE;
+    function->stackSize = source->stackSize;
+    function->lineInSourceStart = (TZrUInt32)source->startLine;
+    function->lineInSourceEnd = (TZrUInt32)source->endLine;
+    if (!io_runtime_copy_closure_variables(state, source, function)) {
+        return ZR_FALSE;
+    }
+
+    lazyBody = (SZrFunctionLazyBody *)ZrCore_Memory_RawMallocWithType(state->global,
+                                                                      sizeof(SZrFunctionLazyBody),
+                                                                      ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+    if (lazyBody == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    lazyBody->image = source->deferredImage;
+    lazyBody->record = source->deferredRecord;
+    lazyBody->recordLength = source->deferredRecordLength;
+    lazyBody->instructionsLength = (TZrUInt32)source->instructionsLength;
+    ZrCore_Io_ResidentImage_Retain(lazyBody->image);
+    function->lazyBody = lazyBody;
+    return ZR_TRUE;
+}
+
+static SZrFunction *io_runtime_constant_function(const SZrTypeValue *constant) {
+    SZrRawObject *rawObject;
+
+    if ((constant->type != ZR_VALUE_TYPE_FUNCTION && constant->type != ZR_VALUE_TYPE_CLOSURE) ||
+        constant->value.object == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    rawObject = constant->value.object;
+    if (rawObject->type == ZR_RAW_OBJECT_TYPE_FUNCTION) {
+        return ZR_CAST(SZrFunction *, rawObject);
+    }
+    if (rawObject->type == ZR_RAW_OBJECT_TYPE_CLOSURE && !constant->isNative) {
+        return ZR_CAST(SZrClosure *, rawObject)->function;
+    }
+    return ZR_NULL;
+}
+
+/*
+ * Rebinds constant functions to the inline children. A lazy constant copy that loses its slot is never called,
+ * so its hold on the resident image is dropped here instead of waiting for the GC to find the orphan.
+ */
+static TZrBool io_runtime_rebind_constant_functions(SZrState *state, SZrFunction *function) {
+    SZrGlobalState *global = state->global;
+    SZrFunction **previous = ZR_NULL;
+    TZrSize previousBytes = sizeof(SZrFunction *) * function->constantValueLength;
+
+    if (function->childFunctionLength > 0 && function->constantValueLength > 0) {
+        previous = (SZrFunction **)ZrCore_Memory_RawMallocWithType(global,
+                                                                   previousBytes,
+                                                                   ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+        if (previous == ZR_NULL) {
+            return ZR_FALSE;
+        }
+        for (TZrUInt32 index = 0; index < function->constantValueLength; index++) {
+            previous[index] = io_runtime_constant_function(&function->constantValueList[index]);
+        }
+    }
+
+    ZrCore_Function_RebindConstantFunctionValuesToChildren(function);
+
+    if (previous != ZR_NULL) {
+        for (TZrUInt32 index = 0; index < function->constantValueLength; index++) {
+            if (previous[index] != ZR_NULL &&
+                previous[index]->lazyBody != ZR_NULL &&
+                previous[index] != io_runtime_constant_function(&function->constantValueList[index])) {
+                ZrCore_Function_ReleaseLazyBodies(state, previous[index]);
+            }
+        }
+        ZrCore_Memory_RawFreeWithType(global, previous, previousBytes, ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+    }
+    return ZR_TRUE;
+}
+
 static TZrBool io_runtime_populate_function(SZrState *state,
                                             const SZrIoFunction *source,
                                             SZrFunction *function) {
@@ -648,6 +765,10 @@ static TZrBool io_runtime_populate_function(SZrState *state,
         return ZR_FALSE;
     }
 
+    if (source->deferredRecord != ZR_NULL) {
+        return io_runtime_populate_lazy_function(state, source, function);
+    }
+
     global = state->global;
     function->functionName = source->name;
     function->parameterCount = (TZrUInt16)source->parametersLength;
@@ -717,25 +838,8 @@ static TZrBool io_runtime_populate_function(SZrState *state,
         function->localVariableLength = (TZrUInt32)source->localVariablesLength;
     }
 
-    if (source->closureVariablesLength > 0) {
-        TZrSize closureBytes = sizeof(SZrFunctionClosureVariable) * source->closureVariablesLength;
-        function->closureValueList =
-                (SZrFunctionClosureVariable *)ZrCore_Memory_RawMallocWithType(global,
-                                                                              closureBytes,
-                                                                              ZR_MEMORY_NATIVE_TYPE_FUNCTION);
-        if (function->closureValueList == ZR_NULL) {
-            return ZR_FALSE;
-        }
-
-        for (TZrSize index = 0; index < source->closureVariablesLength; index++) {
-            function->closureValueList[index].name = source->closureVariables[index].name;
-            function->closureValueList[index].inStack = source->closureVariables[index].inStack ? ZR_TRUE : ZR_FALSE;
-            function->closureValueList[index].index = source->closureVariables[index].index;
-            function->closureValueList[index].valueType = (EZrValueType)source->closureVariables[index].valueType;
-            function->closureValueList[index].scopeDepth = source->closureVariables[index].scopeDepth;
-            function->closureValueList[index].escapeFlags = source->closureVariables[index].escapeFlags;
-        }
-        function->closureValueLength = (TZrUInt32)source->closureVariablesLength;
+    if (!io_runtime_copy_closure_variables(state, source, function)) {
+        return ZR_FALSE;
     }
 
     if (source->catchClauseCount > 0) {
@@ -1137,7 +1241,9 @@ static TZrBool io_runtime_populate_function(SZrState *state,
         function->childFunctionLength = (TZrUInt32)source->closuresLength;
     }
 
-    ZrCore_Function_RebindConstantFunctionValuesToChildren(function);
+    if (!io_runtime_rebind_constant_functions(state, function)) {
+        return ZR_FALSE;
+    }
     ZrCore_Function_ClearChildOwnerLinks(function);
 
     return ZR_TRUE;
@@ -1383,3 +1489,101 @@ struct SZrFunction *ZrCore_Io_LoadEntryFunctionToRuntime(struct SZrState *state,
 
     return function;
 }
+
+typedef struct SZrIoRuntimeLazyRecordReader {
+    const TZrByte *record;
+    TZrSize recordLength;
+    TZrBool consumed;
+} SZrIoRuntimeLazyRecordReader;
+
+static TZrBytePtr io_runtime_lazy_record_read(SZrState *state, TZrPtr customData, ZR_OUT TZrSize *size) {
+    SZrIoRuntimeLazyRecordReader *reader = (SZrIoRuntimeLazyRecordReader *)customData;
+
+    ZR_UNUSED_PARAMETER(state);
+
+    if (reader == ZR_NULL || size == ZR_NULL || reader->consumed) {
+        return ZR_NULL;
+    }
+
+    reader->consumed = ZR_TRUE;
+    *size = reader->recordLength;
+    return (TZrBytePtr)reader->record;
+}
+
+void ZrCore_Function_MaterializeLazyBody(struct SZrState *state, SZrFunction *function) {
+    SZrFunctionLazyBody *lazyBody;
+    SZrIoRuntimeLazyRecordReader reader;
+    SZrIo io;
+    SZrIoFunction source;
+    TZrBool populated;
+
+    if (state == ZR_NULL || function == ZR_NULL || function->lazyBody == ZR_NULL) {
+        return;
+    }
+
+    lazyBody = function->lazyBody;
+    reader.record = lazyBody->record;
+    reader.recordLength = lazyBody->recordLength;
+    reader.consumed = ZR_FALSE;
+    ZrCore_Io_Init(state, &io, io_runtime_lazy_record_read, ZR_NULL, &reader);
+    io.isBinary = ZR_TRUE;
+    io.isResidentImage = ZR_TRUE;
+    io.borrowResidentImage = ZR_TRUE;
+    io.sourceVersionPatch = lazyBody->image->sourceVersionPatch;
+    // nested records stay deferred and take their own image references while the body is converted
+    io.residentImage = lazyBody->image;
+    ZrCore_Io_ReadFunction(&io, &source);
+
+    // the shell only owned its capture list; the full conversion rebuilds it with everything else
+    function->lazyBody = ZR_NULL;
+    if (function->closureValueList != ZR_NULL && function->closureValueLength > 0) {
+        ZrCore_Memory_RawFreeWithType(state->global,
+                                      function->closureValueList,
+                                      sizeof(SZrFunctionClosureVariable) * function->closureValueLength,
+                                      ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+    }
+    function->closureValueList = ZR_NULL;
+    function->closureValueLength = 0;
+    populated = io_runtime_populate_function(state, &source, function);
+    ZrCore_Io_ResidentImage_Release(state, lazyBody->image);
+    ZrCore_Memory_RawFreeWithType(state->global, lazyBody, sizeof(SZrFunctionLazyBody), ZR_MEMORY_NATIVE_TYPE_FUNCTION);
+
+    // a collector that already blackened the shell has not seen any reference the body just added
+    ZrCore_GarbageCollector_BarrierRebuilt(state, ZR_CAST_RAW_OBJECT_AS_SUPER(function));
+    if (!populated) {
+        ZrCore_Debug_RunError(state,
+                              "failed to decode lazily loaded function body: lineInSourceStart=%u",
+                              (TZrUInt32)function->lineInSourceStart);
+    }
+}
+
+void ZrCore_Function_MaterializeGraph(struct SZrState *state, SZrFunction *function) {
+    if (state == ZR_NULL || function == ZR_NULL) {
+        return;
+    }
+
+    ZrCore_Function_EnsureMaterialized(state, function);
+    for (TZrUInt32 childIndex = 0; childIndex < function->childFunctionLength; childIndex++) {
+        ZrCore_Function_MaterializeGraph(state, &function->childFunctionList[childIndex]);
+    }
+
+    // constants rebound to children were covered above; only shells that stayed separate copies are left
+    for (TZrUInt32 constantIndex = 0; constantIndex < function->constantValueLength; constantIndex++) {
+        const SZrTypeValue *constant = &function->constantValueList[constantIndex];
+        SZrFunction *constantFunction = ZR_NULL;
+
+        if (constant->value.object == ZR_NULL || constant->isNative) {
+            continue;
+        }
+        if (constant->type == ZR_VALUE_TYPE_FUNCTION &&
+            constant->value.object->type == ZR_RAW_OBJECT_TYPE_FUNCTION) {
+            constantFunction = ZR_CAST(SZrFunction *, constant->value.object);
+        } else if (constant->type == ZR_VALUE_TYPE_CLOSURE &&
+                   constant->value.object->type == ZR_RAW_OBJECT_TYPE_CLOSURE) {
+            constantFunction = ZR_CAST(SZrClosure *, constant->value.object)->function;
+        }
+        if (constantFunction != ZR_NULL && constantFunction->lazyBody != ZR_NULL) {
+            ZrCore_Function_MaterializeGraph(state, constantFunction);
+        }
+    }
+}
@@ -787,7 +787,7 @@ static TZrInt64 meta_sub_string_int(SZrState *state) {
             TZrSize newLength = 0;
             TZrNativeString nativeStr = ZrCore_String_GetNativeString(str);
 
-            if (!ZrCore_String_GetCodePointLength(str, &codePointLength)) {
+            if (!ZrCore_String_GetCodePointLength(state, str, &codePointLength)) {
                 ZrCore_Debug_RunError(state, "invalid UTF-8 string");
             }
             if (count < 0) {
@@ -797,7 +797,8 @@ static TZrInt64 meta_sub_string_int(SZrState *state) {
                 count = (TZrInt64) codePointLength;
             }
 
-            if (!ZrCore_String_CodePointCountToByteOffset(str,
+            if (!ZrCore_String_CodePointCountToByteOffset(state,
+                                                          str,
                                                           codePointLength - (TZrSize)count,
                                                           &newLength)) {
                 ZrCore_Debug_RunError(state, "invalid UTF-8 string");
@@ -181,7 +181,7 @@ TZrUInt64 ZrCore_Module_CalculatePathHash(SZrState *state, SZrString *fullPath)
         pathStr = ZrCore_String_GetNativeStringShort(fullPath);
         pathLen = fullPath->shortStringLength;
     } else {
-        pathStr = *ZrCore_String_GetNativeStringLong(fullPath);
+        pathStr = ZrCore_String_GetNativeString(fullPath);
         pathLen = fullPath->longStringLength;
     }
 
@@ -238,6 +238,7 @@ void ZrCore_Module_AddToCache(SZrState *state, SZrString *path, struct SZrObject
     zr_module_init_string_key(state, &key, path);
     zr_module_init_object_value(state, &moduleValue, ZR_CAST_RAW_OBJECT_AS_SUPER(module));
     ZrCore_Object_SetValue(state, registry, &key, &moduleValue);
+    state->global->moduleRegistryGeneration++;
 }
 
 void ZrCore_Module_RemoveFromCache(SZrState *state, SZrString *path) {
@@ -255,6 +256,7 @@ void ZrCore_Module_RemoveFromCache(SZrState *state, SZrString *path) {
 
     zr_module_init_string_key(state, &key, path);
     ZrCore_HashSet_Remove(state, &registry->nodeMap, &key);
+    state->global->moduleRegistryGeneration++;
 }
 
 const SZrModuleExportDescriptor *ZrCore_Module_FindExportDescriptor(struct SZrObjectModule *module, SZrString *name) {
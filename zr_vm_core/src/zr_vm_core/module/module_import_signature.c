@@ -5,7 +5,6 @@
 
 #include "zr_vm_core/function.h"
 
-#define ZR_MODULE_RUNTIME_ENTRY_FUNCTION_FIELD "__zr_reflection_entry_function"
 
 static const SZrFunctionTypedExportSymbol *module_import_signature_find_typed_export_symbol(
         const SZrFunction *function,
@@ -27,6 +27,10 @@
 
 typedef TZrUInt8 EZrAccessModifier;
 
+#define ZR_MODULE_RUNTIME_ENTRY_FUNCTION_FIELD "__zr_reflection_entry_function"
+// reserved0 bit: the module was created from a script entry function and can be captured into a startup image.
+#define ZR_MODULE_RUNTIME_SCRIPT_ENTRY ((TZrUInt8)2)
+
 typedef struct {
     SZrObjectPrototype *prototype;
     SZrString *typeName;
@@ -18,6 +18,25 @@ typedef struct SZrModuleLoaderExecuteRequest {
     TZrStackValuePointer resultBase;
 } SZrModuleLoaderExecuteRequest;
 
+typedef struct SZrModuleLoaderStartupImageReader {
+    const SZrModuleStartupImageEntry *entry;
+    TZrBool consumed;
+} SZrModuleLoaderStartupImageReader;
+
+static TZrBytePtr module_loader_startup_image_read(SZrState *state, TZrPtr customData, ZR_OUT TZrSize *size) {
+    SZrModuleLoaderStartupImageReader *reader = (SZrModuleLoaderStartupImageReader *)customData;
+
+    ZR_UNUSED_PARAMETER(state);
+
+    if (reader == ZR_NULL || size == ZR_NULL || reader->consumed || reader->entry == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    reader->consumed = ZR_TRUE;
+    *size = reader->entry->length;
+    return (TZrBytePtr)reader->entry->bytes;
+}
+
 static ZR_FORCE_INLINE SZrRawObject *module_loader_refresh_forwarded_raw_object(SZrRawObject *rawObject) {
     SZrRawObject *forwardedObject;
 
@@ -892,6 +911,8 @@ struct SZrObjectModule *ZrCore_Module_ImportByPath(SZrState *state, SZrString *p
     TZrNativeString pathStr;
     TZrSize pathLen;
     SZrIo io;
+    SZrModuleLoaderStartupImageReader startupImageReader;
+    const SZrModuleStartupImageEntry *startupImageEntry;
     SZrFunction *func;
     SZrClosure *closure;
     struct SZrObjectModule *module;
@@ -957,18 +978,11 @@ struct SZrObjectModule *ZrCore_Module_ImportByPath(SZrState *state, SZrString *p
 
     }
 
-    if (global->sourceLoader == ZR_NULL) {
-        if (ZrCore_GlobalState_GetModuleLoadDiagnostic(global) == ZR_NULL) {
-            ZrCore_GlobalState_SetModuleLoadDiagnostic(global, "loader=source result=unconfigured");
-        }
-        return ZR_NULL;
-    }
-
     if (path->shortStringLength < ZR_VM_LONG_STRING_FLAG) {
         pathStr = ZrCore_String_GetNativeStringShort(path);
         pathLen = path->shortStringLength;
     } else {
-        pathStr = *ZrCore_String_GetNativeStringLong(path);
+        pathStr = ZrCore_String_GetNativeString(path);
         pathLen = path->longStringLength;
     }
 
@@ -977,7 +991,20 @@ struct SZrObjectModule *ZrCore_Module_ImportByPath(SZrState *state, SZrString *p
         return ZR_NULL;
     }
 
-    if (!global->sourceLoader(state, pathStr, ZR_NULL, &io)) {
+    // modules captured by the spawning isolate load from its startup image instead of being compiled again.
+    startupImageEntry = ZrCore_Module_FindStartupImageEntry(global->startupImage, pathStr, pathLen);
+    if (startupImageEntry != ZR_NULL) {
+        startupImageReader.entry = startupImageEntry;
+        startupImageReader.consumed = ZR_FALSE;
+        ZrCore_Io_Init(state, &io, module_loader_startup_image_read, ZR_NULL, &startupImageReader);
+        io.isBinary = ZR_TRUE;
+        io.isResidentImage = ZR_TRUE;
+    } else if (global->sourceLoader == ZR_NULL) {
+        if (ZrCore_GlobalState_GetModuleLoadDiagnostic(global) == ZR_NULL) {
+            ZrCore_GlobalState_SetModuleLoadDiagnostic(global, "loader=source result=unconfigured");
+        }
+        return ZR_NULL;
+    } else if (!global->sourceLoader(state, pathStr, ZR_NULL, &io)) {
         if (ZrCore_GlobalState_GetModuleLoadDiagnostic(global) == ZR_NULL) {
             ZrCore_GlobalState_SetModuleLoadDiagnostic(global, "loader=source result=unavailable");
         }
@@ -986,18 +1013,29 @@ struct SZrObjectModule *ZrCore_Module_ImportByPath(SZrState *state, SZrString *p
 
     func = ZR_NULL;
     if (io.isBinary) {
-        SZrIoSource *ioSource = ZrCore_Io_ReadSourceNew(&io);
-        if (io.close != ZR_NULL) {
-            io.close(state, io.customData);
-        }
-
+        SZrIoSource *ioSource;
+        SZrIoResidentImage *residentImage;
+
+        // the converted function copies what it keeps, so borrowed sections only need the image until here.
+        io.borrowResidentImage = ZR_TRUE;
+        // nested function bodies stay in an owned image until first called; the startup image has no owner to adopt.
+        residentImage = ZrCore_Io_ResidentImage_Adopt(state, &io);
+        ioSource = ZrCore_Io_ReadSourceNew(&io);
         if (ioSource == ZR_NULL) {
+            ZrCore_Io_ResidentImage_Release(state, residentImage);
+            if (io.close != ZR_NULL) {
+                io.close(state, io.customData);
+            }
             ZrCore_GlobalState_SetModuleLoadDiagnostic(global, "loader=binary-reader result=read-failed");
             return ZR_NULL;
         }
 
         func = ZrCore_Io_LoadEntryFunctionToRuntime(state, ioSource);
         ZrCore_Io_ReadSourceFree(global, ioSource);
+        ZrCore_Io_ResidentImage_Release(state, residentImage);
+        if (io.close != ZR_NULL) {
+            io.close(state, io.customData);
+        }
         if (func == ZR_NULL) {
             if (ZrCore_GlobalState_GetModuleLoadDiagnostic(global) == ZR_NULL) {
                 ZrCore_GlobalState_SetModuleLoadDiagnostic(global, "loader=binary-runtime result=load-failed");
@@ -1052,6 +1090,7 @@ struct SZrObjectModule *ZrCore_Module_ImportByPath(SZrState *state, SZrString *p
 
     pathHash = ZrCore_Module_CalculatePathHash(state, path);
     ZrCore_Module_SetInfo(state, module, path, pathHash, path);
+    module->reserved0 = (TZrUInt8)(module->reserved0 | ZR_MODULE_RUNTIME_SCRIPT_ENTRY);
     ZrCore_Reflection_AttachModuleRuntimeMetadata(state, module, func);
 
     if (func != ZR_NULL) {
@@ -1117,6 +1156,8 @@ struct SZrObjectModule *ZrCore_Module_ImportByPath(SZrState *state, SZrString *p
         request.anchor = &callBaseAnchor;
         request.resultBase = ZR_NULL;
         status = ZrCore_Exception_TryRun(state, module_loader_execute_entry_body, &request);
+        // the entry body may have grown the stack; reload the caller top from its anchor.
+        savedStackTop = ZrCore_Function_StackAnchorRestore(state, &savedStackTopAnchor);
         if (status != ZR_THREAD_STATUS_FINE) {
             ZrCore_Module_SetInitializationState(module, ZR_MODULE_INIT_STATE_FAILED);
             state->stackTop.valuePointer = savedStackTop;
@@ -1151,7 +1192,9 @@ struct SZrObjectModule *ZrCore_Module_ImportByPath(SZrState *state, SZrString *p
         module_loader_finalize_pending_entry_exports(state);
     }
     ZrCore_Module_SetInitializationState(module, ZR_MODULE_INIT_STATE_READY);
+    // a module becoming ready changes what a startup image capture would contain.
+    state->global->moduleRegistryGeneration++;
 
-    state->stackTop.valuePointer = savedStackTop;
+    state->stackTop.valuePointer = ZrCore_Function_StackAnchorRestore(state, &savedStackTopAnchor);
     return module;
 }
@@ -0,0 +1,280 @@
+//
+// Startup image: the serialized script modules of one isolate, shared read-only with the isolates it spawns.
+//
+
+#include "module/module_internal.h"
+
+#if defined(ZR_PLATFORM_WIN)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+#include <stdlib.h>
+
+// each image starts 16-byte aligned so the resident .zro reader can borrow its sections in place.
+#define ZR_MODULE_STARTUP_IMAGE_ALIGN ((TZrSize)16)
+#define ZR_MODULE_STARTUP_IMAGE_ALIGN_UP(size)                                                                         \
+    (((size) + ZR_MODULE_STARTUP_IMAGE_ALIGN - 1) & ~(ZR_MODULE_STARTUP_IMAGE_ALIGN - 1))
+
+typedef struct SZrModuleStartupImageCapture {
+    const TZrChar *path;
+    TZrSize pathLength;
+    TZrByte *bytes;
+    TZrSize length;
+    // serializer-owned bytes are freed after packing; inherited ones belong to the previous image.
+    TZrBool ownsBytes;
+} SZrModuleStartupImageCapture;
+
+#if defined(ZR_PLATFORM_WIN)
+static ZR_FORCE_INLINE TZrInt32 module_startup_image_ref_add(volatile TZrInt32 *target, TZrInt32 delta) {
+    return (TZrInt32)InterlockedExchangeAdd((volatile LONG *)target, (LONG)delta) + delta;
+}
+#else
+static ZR_FORCE_INLINE TZrInt32 module_startup_image_ref_add(volatile TZrInt32 *target, TZrInt32 delta) {
+    return __atomic_add_fetch(target, delta, __ATOMIC_ACQ_REL);
+}
+#endif
+
+static SZrFunction *module_startup_image_entry_function(SZrState *state, SZrObjectModule *module) {
+    SZrString *fieldName;
+    SZrTypeValue key;
+
+    fieldName = ZrCore_String_CreateFromNative(state, ZR_MODULE_RUNTIME_ENTRY_FUNCTION_FIELD);
+    if (fieldName == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    zr_module_init_string_key(state, &key, fieldName);
+    return ZrCore_Closure_GetMetadataFunctionFromValue(state, ZrCore_Object_GetValue(state, &module->super, &key));
+}
+
+static TZrBool module_startup_image_is_capturable(SZrObject *object) {
+    SZrObjectModule *module;
+
+    if (object == ZR_NULL || object->internalType != ZR_OBJECT_INTERNAL_TYPE_MODULE) {
+        return ZR_FALSE;
+    }
+
+    module = (SZrObjectModule *)object;
+    return (module->reserved0 & ZR_MODULE_RUNTIME_SCRIPT_ENTRY) != 0 &&
+           module->initState == ZR_MODULE_INIT_STATE_READY && module->fullPath != ZR_NULL;
+}
+
+static TZrUInt32 module_startup_image_count_modules(SZrState *state, SZrObject *registry) {
+    TZrUInt32 count = 0;
+
+    for (TZrSize bucketIndex = 0; bucketIndex < registry->nodeMap.capacity; ++bucketIndex) {
+        for (SZrHashKeyValuePair *pair = registry->nodeMap.buckets[bucketIndex]; pair != ZR_NULL; pair = pair->next) {
+            if (pair->value.type == ZR_VALUE_TYPE_OBJECT && pair->value.value.object != ZR_NULL &&
+                module_startup_image_is_capturable(ZR_CAST_OBJECT(state, pair->value.value.object))) {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Lays the header, the entry table, the paths and the 16-byte aligned module images out in one block so the whole
+ * image is a single allocation that any thread may free.
+ */
+static SZrModuleStartupImage *module_startup_image_pack(const SZrModuleStartupImageCapture *captures,
+                                                        TZrUInt32 captureCount) {
+    SZrModuleStartupImage *image;
+    TZrSize headerSize = ZR_MODULE_STARTUP_IMAGE_ALIGN_UP(sizeof(SZrModuleStartupImage));
+    TZrSize tableSize = ZR_MODULE_STARTUP_IMAGE_ALIGN_UP(captureCount * sizeof(SZrModuleStartupImageEntry));
+    TZrSize totalSize = headerSize + tableSize;
+    TZrByte *cursor;
+
+    for (TZrUInt32 index = 0; index < captureCount; index++) {
+        totalSize += ZR_MODULE_STARTUP_IMAGE_ALIGN_UP(captures[index].pathLength + 1);
+        totalSize += ZR_MODULE_STARTUP_IMAGE_ALIGN_UP(captures[index].length);
+    }
+
+    image = (SZrModuleStartupImage *)malloc(totalSize);
+    if (image == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    memset(image, 0, headerSize + tableSize);
+    image->refCount = 1;
+    image->entryCount = captureCount;
+    image->entries = (SZrModuleStartupImageEntry *)((TZrByte *)image + headerSize);
+    image->storageSize = totalSize;
+    cursor = (TZrByte *)image + headerSize + tableSize;
+    for (TZrUInt32 index = 0; index < captureCount; index++) {
+        SZrModuleStartupImageEntry *entry = &image->entries[index];
+        TZrSize pathLength = captures[index].pathLength;
+
+        memcpy(cursor, captures[index].path, pathLength);
+        cursor[pathLength] = '\0';
+        entry->path = (const TZrChar *)cursor;
+        entry->pathLength = pathLength;
+        cursor += ZR_MODULE_STARTUP_IMAGE_ALIGN_UP(pathLength + 1);
+
+        memcpy(cursor, captures[index].bytes, captures[index].length);
+        entry->bytes = cursor;
+        entry->length = captures[index].length;
+        cursor += ZR_MODULE_STARTUP_IMAGE_ALIGN_UP(captures[index].length);
+    }
+
+    return image;
+}
+
+static TZrBool module_startup_image_has_capture(const SZrModuleStartupImageCapture *captures,
+                                                TZrUInt32 captureCount,
+                                                const TZrChar *path,
+                                                TZrSize pathLength) {
+    for (TZrUInt32 index = 0; index < captureCount; index++) {
+        if (captures[index].pathLength == pathLength && memcmp(captures[index].path, path, pathLength) == 0) {
+            return ZR_TRUE;
+        }
+    }
+    return ZR_FALSE;
+}
+
+SZrModuleStartupImage *ZrCore_Module_CaptureStartupImage(SZrState *state,
+                                                         FZrModuleStartupImageSerialize serialize,
+                                                         FZrModuleStartupImageFreeBuffer freeBuffer) {
+    SZrGlobalState *global;
+    SZrObject *registry;
+    SZrModuleStartupImage *previous;
+    SZrModuleStartupImageCapture *captures;
+    SZrModuleStartupImage *image;
+    TZrUInt32 moduleCount;
+    TZrUInt32 captureCapacity;
+    TZrUInt32 captureCount = 0;
+
+    if (state == ZR_NULL || state->global == ZR_NULL || serialize == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    global = state->global;
+    previous = global->startupImage;
+    registry = zr_module_get_loaded_modules_registry(state);
+    if (registry == ZR_NULL || !registry->nodeMap.isValid || registry->nodeMap.buckets == ZR_NULL) {
+        return ZrCore_Module_RetainStartupImage(previous);
+    }
+
+    // any register, replace, unload or module becoming ready bumps the generation, so a same-sized registry with
+    // a replaced module is still recaptured.
+    if (previous != ZR_NULL && global->startupImageGeneration == global->moduleRegistryGeneration) {
+        return ZrCore_Module_RetainStartupImage(previous);
+    }
+
+    moduleCount = module_startup_image_count_modules(state, registry);
+    if (moduleCount == 0) {
+        return ZrCore_Module_RetainStartupImage(previous);
+    }
+
+    captureCapacity = moduleCount + (previous != ZR_NULL ? previous->entryCount : 0u);
+    captures = (SZrModuleStartupImageCapture *)malloc(captureCapacity * sizeof(SZrModuleStartupImageCapture));
+    if (captures == ZR_NULL) {
+        return ZrCore_Module_RetainStartupImage(previous);
+    }
+
+    // a module that fails to serialize is left out; an isolate that misses it compiles it from source as before.
+    for (TZrSize bucketIndex = 0; bucketIndex < registry->nodeMap.capacity; ++bucketIndex) {
+        for (SZrHashKeyValuePair *pair = registry->nodeMap.buckets[bucketIndex]; pair != ZR_NULL; pair = pair->next) {
+            SZrModuleStartupImageCapture *capture = &captures[captureCount];
+            SZrObjectModule *module;
+            SZrFunction *entryFunction;
+
+            if (captureCount >= moduleCount || pair->value.type != ZR_VALUE_TYPE_OBJECT ||
+                pair->value.value.object == ZR_NULL ||
+                !module_startup_image_is_capturable(ZR_CAST_OBJECT(state, pair->value.value.object))) {
+                continue;
+            }
+
+            module = (SZrObjectModule *)ZR_CAST_OBJECT(state, pair->value.value.object);
+            entryFunction = module_startup_image_entry_function(state, module);
+            if (entryFunction == ZR_NULL || !serialize(state, entryFunction, &capture->bytes, &capture->length) ||
+                capture->bytes == ZR_NULL) {
+                continue;
+            }
+
+            capture->path = ZrCore_String_GetNativeString(module->fullPath);
+            capture->pathLength = ZrCore_String_GetByteLength(module->fullPath);
+            capture->ownsBytes = ZR_TRUE;
+            captureCount++;
+        }
+    }
+
+    // an isolate booted from an image passes on the modules it never imported itself.
+    for (TZrUInt32 index = 0; previous != ZR_NULL && index < previous->entryCount; index++) {
+        const SZrModuleStartupImageEntry *entry = &previous->entries[index];
+
+        if (!module_startup_image_has_capture(captures, captureCount, entry->path, entry->pathLength)) {
+            captures[captureCount].path = entry->path;
+            captures[captureCount].pathLength = entry->pathLength;
+            captures[captureCount].bytes = (TZrByte *)entry->bytes;
+            captures[captureCount].length = entry->length;
+            captures[captureCount].ownsBytes = ZR_FALSE;
+            captureCount++;
+        }
+    }
+
+    image = module_startup_image_pack(captures, captureCount);
+    for (TZrUInt32 index = 0; index < captureCount; index++) {
+        if (captures[index].ownsBytes && freeBuffer != ZR_NULL) {
+            freeBuffer(captures[index].bytes);
+        }
+    }
+    free(captures);
+    if (image == ZR_NULL) {
+        return ZrCore_Module_RetainStartupImage(previous);
+    }
+
+    // the global keeps the creation reference; the caller gets its own.
+    global->startupImage = image;
+    global->startupImageGeneration = global->moduleRegistryGeneration;
+    ZrCore_Module_ReleaseStartupImage(previous);
+    return ZrCore_Module_RetainStartupImage(image);
+}
+
+SZrModuleStartupImage *ZrCore_Module_RetainStartupImage(SZrModuleStartupImage *image) {
+    if (image != ZR_NULL) {
+        module_startup_image_ref_add(&image->refCount, 1);
+    }
+    return image;
+}
+
+void ZrCore_Module_ReleaseStartupImage(SZrModuleStartupImage *image) {
+    if (image != ZR_NULL && module_startup_image_ref_add(&image->refCount, -1) == 0) {
+        free(image);
+    }
+}
+
+void ZrCore_Module_SetStartupImage(SZrGlobalState *global, SZrModuleStartupImage *image) {
+    SZrModuleStartupImage *previous;
+
+    if (global == ZR_NULL || global->startupImage == image) {
+        return;
+    }
+
+    previous = global->startupImage;
+    global->startupImage = ZrCore_Module_RetainStartupImage(image);
+    // an adopted image covers this registry as it stands; later loads bump the generation past it.
+    global->startupImageGeneration = global->moduleRegistryGeneration;
+    ZrCore_Module_ReleaseStartupImage(previous);
+}
+
+const SZrModuleStartupImageEntry *ZrCore_Module_FindStartupImageEntry(const SZrModuleStartupImage *image,
+                                                                      const TZrChar *path,
+                                                                      TZrSize pathLength) {
+    if (image == ZR_NULL || path == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    for (TZrUInt32 index = 0; index < image->entryCount; index++) {
+        const SZrModuleStartupImageEntry *entry = &image->entries[index];
+        if (entry->pathLength == pathLength && memcmp(entry->path, path, pathLength) == 0) {
+            return entry;
+        }
+    }
+
+    return ZR_NULL;
+}
@@ -1417,6 +1417,7 @@ SZrObject *ZrCore_Object_New(SZrState *state, SZrObjectPrototype *prototype) {
     object->internalType = ZR_OBJECT_INTERNAL_TYPE_OBJECT;
     object->memberVersion = 0;
     ZrCore_HashSet_Construct(&object->nodeMap);
+    object->shape = ZR_NULL;
     object_reset_hot_field_pair_cache(object);
     return object;
 }
@@ -1435,6 +1436,7 @@ SZrObject *ZrCore_Object_NewCustomized(struct SZrState *state, TZrSize size, EZr
     object->internalType = internalType;
     object->memberVersion = 0;
     ZrCore_HashSet_Construct(&object->nodeMap);
+    object->shape = ZR_NULL;
     object_reset_hot_field_pair_cache(object);
     return object;
 }
@@ -1449,6 +1451,7 @@ void ZrCore_Object_Init(struct SZrState *state, SZrObject *object) {
                  object != ZR_NULL ? (void *)object->nodeMap.buckets : ZR_NULL,
                  object != ZR_NULL ? (unsigned long long)object->nodeMap.capacity : 0ull);
     object_reset_hot_field_pair_cache(object);
+    object->shape = ZR_NULL;
     ZrCore_HashSet_Init(state, &object->nodeMap, ZR_OBJECT_TABLE_INITIAL_SIZE_LOG2);
     object_trace("object init exit object=%p nodeMap{valid=%d buckets=%p capacity=%llu threshold=%llu elementCount=%llu}",
                  (void *)object,
@@ -1489,8 +1492,30 @@ SZrObject *ZrCore_Object_CloneStruct(struct SZrState *state, const SZrObject *so
     }
 
     if (object_node_map_is_ready(source)) {
+        const SZrHashPairPoolBlock *headBlock = source->nodeMap.pairPoolHead;
+        TZrSize slotCount = source->shape != ZR_NULL && headBlock != ZR_NULL ? source->shape->slotCount : 0;
+
+        // slots go first and in order so the clone takes the same transitions and lands on the source's shape;
+        // bucket order would scatter them and push every copy of a struct onto its own shape path.
+        if (slotCount > 0 && slotCount > headBlock->used) {
+            slotCount = headBlock->used;
+        }
+        for (TZrSize slotIndex = 0; slotIndex < slotCount; slotIndex++) {
+            const SZrHashKeyValuePair *pair = &headBlock->pairs[slotIndex];
+            if (pair->key.type == ZR_VALUE_TYPE_NULL) {
+                continue;
+            }
+            ZrCore_Object_SetValue(state, clone, &pair->key, &pair->value);
+            if (state->threadStatus != ZR_THREAD_STATUS_FINE) {
+                failed = ZR_TRUE;
+                goto cleanup;
+            }
+        }
         for (TZrSize bucketIndex = 0; bucketIndex < source->nodeMap.capacity; bucketIndex++) {
             for (SZrHashKeyValuePair *pair = source->nodeMap.buckets[bucketIndex]; pair != ZR_NULL; pair = pair->next) {
+                if (slotCount > 0 && pair >= headBlock->pairs && pair < headBlock->pairs + slotCount) {
+                    continue;
+                }
                 ZrCore_Object_SetValue(state, clone, &pair->key, &pair->value);
                 if (state->threadStatus != ZR_THREAD_STATUS_FINE) {
                     failed = ZR_TRUE;
@@ -1500,6 +1525,17 @@ SZrObject *ZrCore_Object_CloneStruct(struct SZrState *state, const SZrObject *so
         }
     }
 
+    // packed native components (zr.math values and the like) are part of the value, so the copy owns its own bytes.
+    if (source->byteStorage != ZR_NULL) {
+        if (!ZrCore_Object_AllocateByteStorage(state, clone, source->byteStorageLength)) {
+            failed = ZR_TRUE;
+            goto cleanup;
+        }
+        ZrCore_Memory_RawCopy(ZrCore_Object_GetByteStorageData(clone),
+                              ZrCore_Object_GetByteStorageData(source),
+                              source->byteStorageLength);
+    }
+
 cleanup:
     if (cloneIgnored && state->global != ZR_NULL && clone != ZR_NULL) {
         ZrCore_GarbageCollector_UnignoreObject(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(clone));
@@ -1670,7 +1706,10 @@ static void object_set_value_core(SZrState *state,
         return;
     }
 
-    pair = ZrCore_HashSet_Add(state, nodeMap, storageKey);
+    pair = object_shape_try_add_pair(state, object, storageKey);
+    if (pair == ZR_NULL) {
+        pair = ZrCore_HashSet_Add(state, nodeMap, storageKey);
+    }
     if (pair == ZR_NULL) {
         object_unpin_value_object(state->global, value, valuePinned);
         object_unpin_value_object(state->global, storageKey, keyPinned);
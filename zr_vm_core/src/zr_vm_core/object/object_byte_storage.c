@@ -0,0 +1,146 @@
+//
+// Contiguous byte storage attached to byte-buffer objects and their slice views.
+//
+
+#include "zr_vm_core/object.h"
+
+#include "zr_vm_core/gc.h"
+#include "zr_vm_core/memory.h"
+#include "zr_vm_core/state.h"
+
+static SZrObjectByteStorage *object_byte_storage_new(SZrState *state, TZrSize capacity) {
+    SZrObjectByteStorage *storage;
+
+    if (capacity > ZR_MAX_SIZE - sizeof(SZrObjectByteStorage)) {
+        return ZR_NULL;
+    }
+
+    storage = (SZrObjectByteStorage *)ZrCore_Memory_GcMalloc(state,
+                                                              ZR_MEMORY_NATIVE_TYPE_ARRAY,
+                                                              sizeof(SZrObjectByteStorage) + capacity);
+    storage->referenceCount = 1;
+    storage->capacity = capacity;
+    if (capacity > 0) {
+        memset(ZR_OBJECT_BYTE_STORAGE_DATA(storage), 0, capacity);
+    }
+    return storage;
+}
+
+// storage comes from ZrCore_Memory_GcMalloc, so freeing it pays back the debt that allocation added
+static void object_byte_storage_free(SZrGlobalState *global, SZrObjectByteStorage *storage) {
+    TZrSize size = sizeof(SZrObjectByteStorage) + storage->capacity;
+
+    ZrCore_Memory_RawFreeWithType(global, storage, size, ZR_MEMORY_NATIVE_TYPE_ARRAY);
+    if (global->garbageCollector != ZR_NULL) {
+        if ((TZrMemoryOffset)size <= global->garbageCollector->gcDebtSize) {
+            global->garbageCollector->gcDebtSize -= (TZrMemoryOffset)size;
+        } else {
+            global->garbageCollector->gcDebtSize = 0;
+        }
+    }
+}
+
+static void object_byte_storage_attach(SZrObject *object,
+                                       SZrObjectByteStorage *storage,
+                                       TZrSize offset,
+                                       TZrSize length) {
+    object->byteStorage = storage;
+    object->byteStorageOffset = offset;
+    object->byteStorageLength = length;
+}
+
+TZrBool ZrCore_Object_AllocateByteStorage(SZrState *state, SZrObject *object, TZrSize length) {
+    SZrObjectByteStorage *storage;
+
+    if (state == ZR_NULL || object == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    storage = object_byte_storage_new(state, length);
+    if (storage == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    ZrCore_Object_ReleaseByteStorage(state->global, object);
+    object_byte_storage_attach(object, storage, 0, length);
+    return ZR_TRUE;
+}
+
+TZrBool ZrCore_Object_ShareByteStorage(SZrState *state,
+                                       SZrObject *object,
+                                       const SZrObject *source,
+                                       TZrSize offset,
+                                       TZrSize length) {
+    SZrObjectByteStorage *storage;
+    TZrSize absoluteOffset;
+
+    if (state == ZR_NULL || object == ZR_NULL || source == ZR_NULL || source->byteStorage == ZR_NULL ||
+        offset > source->byteStorageLength || length > source->byteStorageLength - offset) {
+        return ZR_FALSE;
+    }
+
+    storage = source->byteStorage;
+    absoluteOffset = source->byteStorageOffset + offset;
+    storage->referenceCount++;
+    ZrCore_Object_ReleaseByteStorage(state->global, object);
+    object_byte_storage_attach(object, storage, absoluteOffset, length);
+    return ZR_TRUE;
+}
+
+TZrBool ZrCore_Object_ResizeByteStorage(SZrState *state, SZrObject *object, TZrSize length) {
+    SZrObjectByteStorage *storage;
+    SZrObjectByteStorage *newStorage;
+    TZrSize newCapacity;
+
+    if (state == ZR_NULL || object == ZR_NULL || object->byteStorage == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    storage = object->byteStorage;
+    if (length <= object->byteStorageLength) {
+        object->byteStorageLength = length;
+        return ZR_TRUE;
+    }
+
+    /*
+     * Growing in place is only safe while no slice view can observe the tail; shared storage is
+     * detached first so existing views keep their bytes (copy-on-grow).
+     */
+    if (storage->referenceCount == 1 && length <= storage->capacity - object->byteStorageOffset) {
+        memset(ZR_OBJECT_BYTE_STORAGE_DATA(storage) + object->byteStorageOffset + object->byteStorageLength,
+               0,
+               length - object->byteStorageLength);
+        object->byteStorageLength = length;
+        return ZR_TRUE;
+    }
+
+    newCapacity = object->byteStorageLength <= ZR_MAX_SIZE / 2 ? object->byteStorageLength * 2 : length;
+    if (newCapacity < length) {
+        newCapacity = length;
+    }
+    newStorage = object_byte_storage_new(state, newCapacity);
+    if (newStorage == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    ZrCore_Memory_RawCopy(ZR_OBJECT_BYTE_STORAGE_DATA(newStorage),
+                          ZrCore_Object_GetByteStorageData(object),
+                          object->byteStorageLength);
+    ZrCore_Object_ReleaseByteStorage(state->global, object);
+    object_byte_storage_attach(object, newStorage, 0, length);
+    return ZR_TRUE;
+}
+
+void ZrCore_Object_ReleaseByteStorage(SZrGlobalState *global, SZrObject *object) {
+    SZrObjectByteStorage *storage;
+
+    if (object == ZR_NULL || object->byteStorage == ZR_NULL) {
+        return;
+    }
+
+    storage = object->byteStorage;
+    object_byte_storage_attach(object, ZR_NULL, 0, 0);
+    if (--storage->referenceCount == 0 && global != ZR_NULL) {
+        object_byte_storage_free(global, storage);
+    }
+}
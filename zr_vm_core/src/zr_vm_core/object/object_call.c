@@ -277,6 +277,17 @@ static TZrBool object_sync_struct_receiver_value(SZrState *state,
             }
         }
     }
+    // packed native components (zr.math values and the like) travel with the struct value as well.
+    if (sourceObject->byteStorage != ZR_NULL) {
+        if ((targetObject->byteStorage == ZR_NULL ||
+             targetObject->byteStorageLength != sourceObject->byteStorageLength) &&
+            !ZrCore_Object_AllocateByteStorage(state, targetObject, sourceObject->byteStorageLength)) {
+            return ZR_FALSE;
+        }
+        ZrCore_Memory_RawCopy(ZrCore_Object_GetByteStorageData(targetObject),
+                              ZrCore_Object_GetByteStorageData(sourceObject),
+                              sourceObject->byteStorageLength);
+    }
 
     receiverTarget->type = stackReceiver->type;
     receiverTarget->value.object = ZR_CAST_RAW_OBJECT_AS_SUPER(targetObject);
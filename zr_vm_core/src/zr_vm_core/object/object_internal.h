@@ -200,6 +200,51 @@ static ZR_FORCE_INLINE SZrHashKeyValuePair *object_try_get_cached_string_pair_un
     return pair;
 }
 
+// adds key as the next shape slot when the object is still shaped; ZR_NULL means use a plain nodeMap pair.
+SZrHashKeyValuePair *object_shape_try_add_pair(SZrState *state, SZrObject *object, const SZrTypeValue *key);
+
+// call-site lookup keyed on (shape, slot): no hash probe, only a key pointer check that also rejects pairs
+// a removal cleared. shaped objects keep their first slots in the head pool block, in slot order.
+static ZR_FORCE_INLINE SZrHashKeyValuePair *object_shape_try_get_slot_pair_unchecked(SZrObject *object,
+                                                                                    const SZrObjectShape *shape,
+                                                                                    TZrUInt32 slotIndex,
+                                                                                    struct SZrString *memberName) {
+    SZrHashPairPoolBlock *block;
+    SZrHashKeyValuePair *pair;
+
+    if (shape == ZR_NULL || object->shape != shape) {
+        return ZR_NULL;
+    }
+
+    block = object->nodeMap.pairPoolHead;
+    if (ZR_UNLIKELY(block == ZR_NULL || slotIndex >= block->used)) {
+        return ZR_NULL;
+    }
+
+    pair = &block->pairs[slotIndex];
+    return pair->key.value.object == ZR_CAST_RAW_OBJECT_AS_SUPER(memberName) ? pair : ZR_NULL;
+}
+
+static ZR_FORCE_INLINE void object_shape_resolve_pair_slot(const SZrObject *object,
+                                                           const SZrHashKeyValuePair *pair,
+                                                           const SZrObjectShape **outShape,
+                                                           TZrUInt32 *outSlotIndex) {
+    const SZrHashPairPoolBlock *block;
+
+    *outShape = ZR_NULL;
+    *outSlotIndex = 0;
+    if (object == ZR_NULL || pair == ZR_NULL || object->shape == ZR_NULL) {
+        return;
+    }
+
+    block = object->nodeMap.pairPoolHead;
+    if (block != ZR_NULL && pair >= block->pairs && pair < block->pairs + block->used &&
+        (TZrSize)(pair - block->pairs) < object->shape->slotCount) {
+        *outShape = object->shape;
+        *outSlotIndex = (TZrUInt32)(pair - block->pairs);
+    }
+}
+
 static ZR_FORCE_INLINE SZrHashKeyValuePair *object_get_own_string_pair_by_name_cached_unchecked(
         SZrState *state,
         SZrObject *object,
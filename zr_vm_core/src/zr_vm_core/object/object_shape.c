@@ -0,0 +1,288 @@
+//
+// Hidden-class shapes: transition trees over field names, with slot values kept in the nodeMap pair pool.
+//
+
+#include "zr_vm_core/object_shape.h"
+
+#include "zr_vm_core/gc.h"
+#include "zr_vm_core/global.h"
+#include "zr_vm_core/hash_set.h"
+#include "zr_vm_core/memory.h"
+#include "zr_vm_core/object.h"
+#include "zr_vm_core/state.h"
+#include "zr_vm_core/string.h"
+
+#include "object/object_internal.h"
+
+static SZrObjectShape *object_shape_new(SZrState *state, SZrObjectShape *parent, SZrString *name) {
+    SZrGlobalState *global = state->global;
+    SZrObjectShape *shape;
+
+    shape = (SZrObjectShape *)ZrCore_Memory_RawMallocWithType(global,
+                                                              sizeof(SZrObjectShape),
+                                                              ZR_MEMORY_NATIVE_TYPE_OBJECT_SHAPE);
+    if (shape == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    shape->parent = parent;
+    shape->root = parent != ZR_NULL ? parent->root : shape;
+    shape->firstTransition = ZR_NULL;
+    shape->nextSibling = ZR_NULL;
+    shape->name = name;
+    shape->id = ++global->objectShapeCount;
+    shape->slotCount = parent != ZR_NULL ? parent->slotCount + 1u : 0u;
+    shape->transitionCount = 0;
+    shape->expectedSlotCount = 0;
+    // a shape created mid-mark counts as seen by that mark, so it survives until the next full cycle.
+    shape->markEpoch = global->objectShapeMarkEpoch;
+    shape->nextAllocated = global->objectShapeAllocations;
+    global->objectShapeAllocations = shape;
+    return shape;
+}
+
+SZrObjectShape *ZrCore_ObjectShape_GetRoot(SZrState *state, SZrObjectPrototype *prototype) {
+    SZrObjectShape **rootSlot;
+
+    if (state == ZR_NULL || state->global == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    // per-prototype roots keep the slot-count estimate of one class apart from unrelated object literals.
+    rootSlot = prototype != ZR_NULL ? &prototype->instanceShapeRoot : &state->global->objectShapeRoot;
+    if (*rootSlot == ZR_NULL) {
+        *rootSlot = object_shape_new(state, ZR_NULL, ZR_NULL);
+    }
+    return *rootSlot;
+}
+
+SZrObjectShape *ZrCore_ObjectShape_Transition(SZrState *state, SZrObjectShape *shape, SZrString *name) {
+    SZrObjectShape *child;
+
+    if (state == ZR_NULL || shape == ZR_NULL || name == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    for (child = shape->firstTransition; child != ZR_NULL; child = child->nextSibling) {
+        if (child->name == name) {
+            child->markEpoch = state->global->objectShapeMarkEpoch;
+            return child;
+        }
+    }
+
+    if (shape->slotCount >= ZR_OBJECT_SHAPE_MAX_SLOT_COUNT ||
+        shape->transitionCount >= ZR_OBJECT_SHAPE_MAX_TRANSITION_COUNT) {
+        return ZR_NULL;
+    }
+
+    child = object_shape_new(state, shape, name);
+    if (child == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    child->nextSibling = shape->firstTransition;
+    shape->firstTransition = child;
+    shape->transitionCount++;
+    return child;
+}
+
+TZrInt32 ZrCore_ObjectShape_FindSlot(const SZrObjectShape *shape, SZrString *name) {
+    while (shape != ZR_NULL && shape->parent != ZR_NULL) {
+        if (shape->name == name) {
+            return (TZrInt32)shape->slotCount - 1;
+        }
+        shape = shape->parent;
+    }
+    return -1;
+}
+
+SZrHashKeyValuePair *ZrCore_Object_GetShapeSlotPair(SZrObject *object, TZrUInt32 slotIndex) {
+    SZrHashPairPoolBlock *block;
+
+    if (object == ZR_NULL || object->shape == ZR_NULL || slotIndex >= object->shape->slotCount) {
+        return ZR_NULL;
+    }
+
+    for (block = object->nodeMap.pairPoolHead; block != ZR_NULL; block = block->next) {
+        if (slotIndex < block->used) {
+            return &block->pairs[slotIndex];
+        }
+        slotIndex -= (TZrUInt32)block->used;
+    }
+    return ZR_NULL;
+}
+
+static void object_shape_unlink_transition(SZrObjectShape *shape) {
+    SZrObjectShape **link = &shape->parent->firstTransition;
+
+    while (*link != ZR_NULL) {
+        if (*link == shape) {
+            *link = shape->nextSibling;
+            shape->parent->transitionCount--;
+            return;
+        }
+        link = &(*link)->nextSibling;
+    }
+}
+
+TZrSize ZrCore_ObjectShape_FreeUnmarked(SZrGlobalState *global) {
+    SZrObjectShape **link;
+    SZrObjectShape *shape;
+    TZrUInt32 epoch;
+    TZrSize freedCount = 0;
+
+    if (global == ZR_NULL) {
+        return 0;
+    }
+
+    epoch = global->objectShapeMarkEpoch;
+    // a transition stamps only the child it returned, so close the kept set over parents before freeing.
+    for (shape = global->objectShapeAllocations; shape != ZR_NULL; shape = shape->nextAllocated) {
+        SZrObjectShape *ancestor;
+
+        if (shape->markEpoch != epoch) {
+            continue;
+        }
+        for (ancestor = shape; ancestor != ZR_NULL; ancestor = ancestor->parent) {
+            if (ancestor != shape && ancestor->markEpoch == epoch) {
+                break;
+            }
+            ancestor->markEpoch = epoch;
+        }
+    }
+
+    // children are allocated after their parent and the list is newest-first, so a freed shape's parent is
+    // always still allocated when it is unlinked. roots stay: prototypes and the global slot point at them.
+    link = &global->objectShapeAllocations;
+    while ((shape = *link) != ZR_NULL) {
+        if (shape->parent == ZR_NULL) {
+            shape->expectedSlotCount = 0;
+            link = &shape->nextAllocated;
+            continue;
+        }
+        if (shape->markEpoch == epoch) {
+            link = &shape->nextAllocated;
+            continue;
+        }
+
+        *link = shape->nextAllocated;
+        object_shape_unlink_transition(shape);
+        ZrCore_Memory_RawFreeWithType(global, shape, sizeof(SZrObjectShape), ZR_MEMORY_NATIVE_TYPE_OBJECT_SHAPE);
+        freedCount++;
+    }
+
+    for (shape = global->objectShapeAllocations; shape != ZR_NULL; shape = shape->nextAllocated) {
+        if (shape->root->expectedSlotCount < shape->slotCount) {
+            shape->root->expectedSlotCount = shape->slotCount;
+        }
+    }
+    return freedCount;
+}
+
+void ZrCore_ObjectShape_FreeAll(SZrGlobalState *global) {
+    SZrObjectShape *shape;
+
+    if (global == ZR_NULL) {
+        return;
+    }
+
+    shape = global->objectShapeAllocations;
+    while (shape != ZR_NULL) {
+        SZrObjectShape *next = shape->nextAllocated;
+        ZrCore_Memory_RawFreeWithType(global, shape, sizeof(SZrObjectShape), ZR_MEMORY_NATIVE_TYPE_OBJECT_SHAPE);
+        shape = next;
+    }
+    global->objectShapeAllocations = ZR_NULL;
+    global->objectShapeRoot = ZR_NULL;
+}
+
+static TZrBool object_shape_reserve_slot(SZrState *state, SZrObject *object, const SZrObjectShape *shape) {
+    SZrHashSet *nodeMap = &object->nodeMap;
+    TZrSize nextSlotCount = (TZrSize)shape->slotCount + 1u;
+    TZrSize target;
+
+    if (nodeMap->pairPoolUsed < nodeMap->pairPoolCapacity) {
+        return ZR_TRUE;
+    }
+
+    // the first block is sized from what earlier instances of this class grew to, so a constructor that
+    // assigns every field fills one contiguous block; later growth doubles.
+    target = nodeMap->pairPoolCapacity == 0 ? shape->root->expectedSlotCount : nodeMap->pairPoolCapacity * 2u;
+    if (target < nextSlotCount) {
+        target = nextSlotCount;
+    }
+    if (target > ZR_OBJECT_SHAPE_MAX_SLOT_COUNT) {
+        target = ZR_OBJECT_SHAPE_MAX_SLOT_COUNT;
+    }
+    return ZrCore_HashSet_EnsurePairPoolForElementCount(state, nodeMap, target);
+}
+
+SZrHashKeyValuePair *object_shape_try_add_pair(SZrState *state, SZrObject *object, const SZrTypeValue *key) {
+    SZrHashSet *nodeMap = &object->nodeMap;
+    SZrObjectShape *shape = object->shape;
+    SZrObjectShape *next;
+    SZrHashKeyValuePair *pair;
+    TZrUInt64 hash;
+    TZrSize bucketIndex;
+
+    // permanent objects are never scanned by the mark, so they could not keep a shape alive.
+    if (object->super.type != ZR_RAW_OBJECT_TYPE_OBJECT ||
+        (object->internalType != ZR_OBJECT_INTERNAL_TYPE_OBJECT &&
+         object->internalType != ZR_OBJECT_INTERNAL_TYPE_STRUCT) ||
+        object->super.garbageCollectMark.status == ZR_GARBAGE_COLLECT_INCREMENTAL_OBJECT_STATUS_PERMANENT) {
+        object->shape = ZR_NULL;
+        return ZR_NULL;
+    }
+
+    if (shape == ZR_NULL) {
+        if (nodeMap->elementCount != 0 || nodeMap->pairPoolUsed != 0) {
+            return ZR_NULL;
+        }
+        shape = ZrCore_ObjectShape_GetRoot(state, object->prototype);
+        if (shape == ZR_NULL) {
+            return ZR_NULL;
+        }
+    }
+
+    // anything that added, removed or pooled pairs behind the shape's back turns the object into a dictionary.
+    if (object_try_get_direct_storage_key_unchecked(key) == ZR_NULL ||
+        nodeMap->elementCount != shape->slotCount ||
+        nodeMap->pairPoolUsed != shape->slotCount) {
+        object->shape = ZR_NULL;
+        return ZR_NULL;
+    }
+
+    // allocate before taking the transition: a collection triggered here may free shapes no object uses yet.
+    if (!object_shape_reserve_slot(state, object, shape) ||
+        (nodeMap->elementCount + 1 > nodeMap->resizeThreshold &&
+         !ZrCore_HashSet_Rehash(state, nodeMap, nodeMap->capacity * ZR_HASH_SET_CAPACITY_GROWTH_FACTOR))) {
+        object->shape = ZR_NULL;
+        return ZR_NULL;
+    }
+    next = ZrCore_ObjectShape_Transition(state, shape, ZR_CAST(SZrString *, key->value.object));
+    if (next == ZR_NULL) {
+        object->shape = ZR_NULL;
+        return ZR_NULL;
+    }
+
+    pair = ZrCore_HashSet_TakeReservedPair(nodeMap);
+    if (pair == ZR_NULL) {
+        object->shape = ZR_NULL;
+        return ZR_NULL;
+    }
+
+    ZrCore_Value_ResetAsNull(&pair->key);
+    ZrCore_Value_ResetAsNull(&pair->value);
+    ZrCore_Value_Copy(state, &pair->key, key);
+    hash = ZrCore_Value_GetHash(state, key);
+    bucketIndex = ZR_HASH_MOD(hash, nodeMap->capacity);
+    pair->next = nodeMap->buckets[bucketIndex];
+    nodeMap->buckets[bucketIndex] = pair;
+    nodeMap->elementCount++;
+
+    object->shape = next;
+    if (next->root->expectedSlotCount < next->slotCount) {
+        next->root->expectedSlotCount = next->slotCount;
+    }
+    return pair;
+}
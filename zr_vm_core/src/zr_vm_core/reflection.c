@@ -1350,7 +1350,13 @@ static void reflection_populate_parameters_from_function(SZrState *state,
 }
 
 static SZrFunction *reflection_extract_function_from_value(SZrState *state, const SZrTypeValue *value) {
-    return ZrCore_Closure_GetMetadataFunctionFromValue(state, value);
+    SZrFunction *function = ZrCore_Closure_GetMetadataFunctionFromValue(state, value);
+
+    // parameter metadata, decorators and return types are not decoded on a lazy shell yet
+    if (function != ZR_NULL) {
+        ZrCore_Function_EnsureMaterialized(state, function);
+    }
+    return function;
 }
 
 static SZrFunction *reflection_find_entry_function_from_stack(SZrState *state) {
@@ -2431,7 +2437,7 @@ ZR_CORE_API SZrObject *ZrCore_Reflection_BuildDecoratorTargetMemberReflection(SZ
                                               reflection_extract_function_from_constant_index(state,
                                                                                             entryFunction,
                                                                                             member->functionConstantIndex),
-                                              prototype->super.super.hash ^
+                                              ZrCore_RawObject_GetHash(&prototype->super.super) ^
                                                       ((TZrUInt64)memberIndex + ZR_RUNTIME_REFLECTION_MEMBER_HASH_BASE +
                                                        (TZrUInt64)0x1000u));
         }
@@ -2507,7 +2513,7 @@ ZR_CORE_API SZrObject *ZrCore_Reflection_BuildDecoratorTargetMemberReflection(SZ
                                                         compiledNameText,
                                                         qualifiedMemberName,
                                                         kind,
-                                                        prototype->super.super.hash ^
+                                                        ZrCore_RawObject_GetHash(&prototype->super.super) ^
                                                                 ((TZrUInt64)memberIndex +
                                                                  ZR_RUNTIME_REFLECTION_MEMBER_HASH_BASE));
         if (memberReflection == ZR_NULL) {
@@ -2745,7 +2751,7 @@ static void reflection_populate_script_members(SZrState *state,
                                                         memberName,
                                                         qualifiedMemberName,
                                                         kind,
-                                                        prototype->super.super.hash ^
+                                                        ZrCore_RawObject_GetHash(&prototype->super.super) ^
                                                                 ((TZrUInt64)memberIndex + ZR_RUNTIME_REFLECTION_MEMBER_HASH_BASE));
         if (memberReflection == ZR_NULL) {
             continue;
@@ -2850,7 +2856,7 @@ static void reflection_populate_script_members(SZrState *state,
                                                   member,
                                                   entryFunction,
                                                   memberFunction,
-                                                  prototype->super.super.hash ^
+                                                  ZrCore_RawObject_GetHash(&prototype->super.super) ^
                                                           ((TZrUInt64)memberIndex + ZR_RUNTIME_REFLECTION_MEMBER_HASH_BASE +
                                                            (TZrUInt64)0x1000u));
             }
@@ -3647,7 +3653,7 @@ static SZrObject *reflection_build_type_reflection(SZrState *state,
                                   name,
                                   qualifiedName,
                                   kind,
-                                  prototype != ZR_NULL ? prototype->super.super.hash : XXH3_64bits(qualifiedName, strlen(qualifiedName)));
+                                  prototype != ZR_NULL ? ZrCore_RawObject_GetHash(&prototype->super.super) : XXH3_64bits(qualifiedName, strlen(qualifiedName)));
     if (prototype != ZR_NULL) {
         reflection_cache_put(state, &cacheKey, typeReflection);
     }
@@ -8,6 +8,7 @@
 #include "zr_vm_common/zr_runtime_sentinel_conf.h"
 #include "zr_vm_core/call_info.h"
 #include "zr_vm_core/callback.h"
+#include "zr_vm_core/closure.h"
 #include "zr_vm_core/gc.h"
 #include "zr_vm_core/global.h"
 #include "zr_vm_core/memory.h"
@@ -81,6 +82,7 @@ void ZrCore_State_Init(SZrState *state, SZrGlobalState *global) {
     state->stackBase.valuePointer = ZR_NULL;
     state->aotGcRootFrameStack = ZR_NULL;
     state->aotGcRootFrameDepth = 0u;
+    state->gcHandleScopeStack = ZR_NULL;
     // call info
     state->callInfoList = ZR_NULL;
     state->callInfoListLength = 0;
@@ -207,6 +209,82 @@ void ZrCore_State_Free(SZrGlobalState *global, SZrState *state) {
     ZrCore_Memory_Allocate(global, state, sizeof(SZrState), 0, ZR_MEMORY_NATIVE_TYPE_STATE);
 }
 
+SZrState *ZrCore_State_NewCoroutine(SZrState *state) {
+    SZrGlobalState *global;
+    SZrState *coroutine;
+
+    if (state == ZR_NULL || state->global == ZR_NULL || state->global->mainThreadState == ZR_NULL) {
+        return ZR_NULL;
+    }
+    global = state->global;
+    coroutine = ZrCore_State_New(global);
+    if (coroutine == ZR_NULL) {
+        return ZR_NULL;
+    }
+    // State_Init publishes the new thread as the profiling owner; keep the creator there
+    ZrCore_Profile_SetCurrentState(state);
+    state_stack_init(coroutine, global->mainThreadState);
+    coroutine->enableRuntimeBoundsCheck = state->enableRuntimeBoundsCheck;
+    coroutine->enableRuntimeTypeCheck = state->enableRuntimeTypeCheck;
+    coroutine->enableRuntimeRangeCheck = state->enableRuntimeRangeCheck;
+    coroutine->allowDebugHook = state->allowDebugHook;
+    coroutine->debugHook = state->debugHook;
+    coroutine->debugHookSignal = state->debugHookSignal;
+    coroutine->baseDebugHookCount = state->baseDebugHookCount;
+    ZrStateResetDebugHookCount(coroutine);
+    // coroutine threads are not on the gc object list; the collector scans them through coroutineList
+    coroutine->isCoroutine = ZR_TRUE;
+    coroutine->nextCoroutine = global->coroutineList;
+    global->coroutineList = coroutine;
+    state_trace("coroutine created coroutine=%p parent=%p", (void *)coroutine, (void *)state);
+    return coroutine;
+}
+
+void ZrCore_State_FreeCoroutine(SZrState *coroutine) {
+    SZrGlobalState *global;
+    SZrState **cursor;
+    SZrCallInfo *callInfo;
+
+    if (coroutine == ZR_NULL || !coroutine->isCoroutine || coroutine->global == ZR_NULL) {
+        return;
+    }
+    global = coroutine->global;
+
+    // close every open closure value so captured slots outlive the stack
+    coroutine->stackTop.valuePointer = coroutine->stackTail.valuePointer;
+    ZrCore_Closure_CloseStackValue(coroutine, coroutine->stackBase.valuePointer);
+    if (ZrCore_State_IsInClosureValueThreadList(coroutine)) {
+        cursor = &global->threadWithStackClosures;
+        while (*cursor != ZR_NULL && *cursor != coroutine) {
+            cursor = &(*cursor)->threadWithStackClosures;
+        }
+        if (*cursor == coroutine) {
+            *cursor = coroutine->threadWithStackClosures;
+        }
+        coroutine->threadWithStackClosures = coroutine;
+    }
+
+    cursor = &global->coroutineList;
+    while (*cursor != ZR_NULL && *cursor != coroutine) {
+        cursor = &(*cursor)->nextCoroutine;
+    }
+    if (*cursor == coroutine) {
+        *cursor = coroutine->nextCoroutine;
+    }
+    coroutine->nextCoroutine = ZR_NULL;
+
+    callInfo = coroutine->baseCallInfo.next;
+    while (callInfo != ZR_NULL) {
+        SZrCallInfo *next = callInfo->next;
+        ZrCore_Memory_RawFreeWithType(global, callInfo, sizeof(SZrCallInfo), ZR_MEMORY_NATIVE_TYPE_CALL_INFO);
+        callInfo = next;
+    }
+    coroutine->baseCallInfo.next = ZR_NULL;
+    coroutine->callInfoList = &coroutine->baseCallInfo;
+    state_trace("coroutine freed coroutine=%p", (void *)coroutine);
+    ZrCore_State_Free(global, coroutine);
+}
+
 TZrInt32 ZrCore_State_ResetThread(SZrState *state, EZrThreadStatus status) {
     // 重置线程状态
     // 调用栈回到创建时基础调用栈
@@ -227,6 +305,7 @@ TZrInt32 ZrCore_State_ResetThread(SZrState *state, EZrThreadStatus status) {
     state->exceptionHandlerStackLength = 0;
     state->aotGcRootFrameStack = ZR_NULL;
     state->aotGcRootFrameDepth = 0u;
+    state->gcHandleScopeStack = ZR_NULL;
     state->pendingControl.kind = ZR_VM_PENDING_CONTROL_NONE;
     state->pendingControl.callInfo = ZR_NULL;
     state->pendingControl.targetInstructionOffset = 0;
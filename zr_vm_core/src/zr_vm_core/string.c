@@ -10,6 +10,7 @@
 #include "zr_vm_core/hash.h"
 #include "zr_vm_core/hash_set.h"
 #include "zr_vm_core/memory.h"
+#include "zr_vm_core/module.h"
 #include "zr_vm_core/object.h"
 #include "zr_vm_core/stack.h"
 #include "zr_vm_core/utf8.h"
@@ -245,6 +246,350 @@ static ZR_FORCE_INLINE void string_concat_pair_cache_store(SZrState *state,
     bucket[0].result = result;
 }
 
+/*
+ * Long concatenation results are concat nodes rather than fresh flat copies. A node is a prefix view of an
+ * append buffer shared by the chain that produced it: `s = s + piece` writes `piece` after the buffer tail
+ * and mints a node for the longer prefix, so building n bytes through repeated `+` copies O(n) bytes in total
+ * instead of O(n^2). Bytes below a node's length never change, which keeps older nodes valid while the buffer
+ * keeps growing; a node that does not end at the tail forks a new buffer when it is extended.
+ *
+ * Hashes stay eager: the buffer carries a streaming hash fed with every appended piece, and each node takes the
+ * digest of its prefix, which equals ZrCore_Hash_Create over the same bytes.
+ *
+ * A node is flattened only when a NUL-terminated view is requested. The node ending at the tail borrows the
+ * buffer block itself (the exposed tip); before the next append the tip takes ownership of that block and the
+ * buffer continues in a fresh one, so a native pointer handed out for the tip stays valid for the node's whole
+ * lifetime. Any other node flattens into a private copy once. Nodes stay GC leaves: the buffer is native memory
+ * released by reference count when the collector frees the last node.
+ */
+struct SZrStringAppendBuffer {
+    SZrGlobalState *global;
+    TZrSize referenceCount;
+    TZrSize length;
+    TZrSize capacity;
+    SZrHashStream *hashStream;
+    SZrString *exposedTip;
+    TZrChar *data;
+    // every byte written so far is ASCII; nodes inherit it as ZR_VM_STRING_FLAG_ASCII
+    TZrBool allAscii;
+};
+
+typedef struct SZrStringAppendBuffer SZrStringAppendBuffer;
+
+static ZR_FORCE_INLINE SZrStringConcatNode *string_concat_node(const SZrString *string) {
+    return (SZrStringConcatNode *)string->stringDataExtend;
+}
+
+// bytes of any string without flattening it; not NUL-terminated for concat nodes
+static ZR_FORCE_INLINE const TZrChar *string_peek_bytes(const SZrString *string) {
+    if (string->shortStringLength < ZR_VM_LONG_STRING_FLAG) {
+        return ZrCore_String_GetNativeStringShort(string);
+    }
+    if (ZrCore_String_IsConcatNode(string)) {
+        return string_concat_node(string)->appendBuffer->data;
+    }
+    return *ZrCore_String_GetNativeStringLong(string);
+}
+
+static TZrChar *string_copy_terminated(SZrGlobalState *global, const TZrChar *bytes, TZrSize length) {
+    TZrChar *copy = (TZrChar *)ZrCore_Memory_RawMallocWithType(global, length + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
+
+    if (copy == ZR_NULL) {
+        return ZR_NULL;
+    }
+    if (length > 0) {
+        memcpy(copy, bytes, length);
+    }
+    copy[length] = '\0';
+    return copy;
+}
+
+static void string_append_buffer_free(SZrStringAppendBuffer *buffer) {
+    SZrGlobalState *global = buffer->global;
+
+    if (buffer->data != ZR_NULL) {
+        ZrCore_Memory_RawFreeWithType(global, buffer->data, buffer->capacity + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
+    }
+    ZrCore_HashStream_Free(buffer->hashStream);
+    ZrCore_Memory_RawFreeWithType(global, buffer, sizeof(SZrStringAppendBuffer), ZR_MEMORY_NATIVE_TYPE_STRING);
+}
+
+static SZrStringAppendBuffer *string_append_buffer_new(SZrGlobalState *global, TZrSize capacity) {
+    SZrStringAppendBuffer *buffer;
+
+    if (capacity < ZR_VM_STRING_APPEND_BUFFER_MIN_CAPACITY) {
+        capacity = ZR_VM_STRING_APPEND_BUFFER_MIN_CAPACITY;
+    }
+    buffer = (SZrStringAppendBuffer *)ZrCore_Memory_RawMallocWithType(global,
+                                                                      sizeof(SZrStringAppendBuffer),
+                                                                      ZR_MEMORY_NATIVE_TYPE_STRING);
+    if (buffer == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    buffer->global = global;
+    buffer->referenceCount = 0;
+    buffer->length = 0;
+    buffer->capacity = capacity;
+    buffer->exposedTip = ZR_NULL;
+    buffer->allAscii = ZR_TRUE;
+    buffer->hashStream = ZrCore_HashStream_New(global);
+    buffer->data = (TZrChar *)ZrCore_Memory_RawMallocWithType(global, capacity + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
+    if (buffer->hashStream == ZR_NULL || buffer->data == ZR_NULL) {
+        string_append_buffer_free(buffer);
+        return ZR_NULL;
+    }
+    return buffer;
+}
+
+static void string_append_buffer_release(SZrStringAppendBuffer *buffer) {
+    ZR_ASSERT(buffer->referenceCount > 0);
+    if (--buffer->referenceCount == 0) {
+        string_append_buffer_free(buffer);
+    }
+}
+
+static TZrBool string_append_buffer_grown_capacity(const SZrStringAppendBuffer *buffer,
+                                                   TZrSize extra,
+                                                   TZrSize *outCapacity) {
+    TZrSize required;
+    TZrSize newCapacity;
+
+    if (extra >= ZR_MAX_SIZE - buffer->length) {
+        return ZR_FALSE;
+    }
+    required = buffer->length + extra;
+    if (required <= buffer->capacity) {
+        *outCapacity = buffer->capacity;
+        return ZR_TRUE;
+    }
+
+    newCapacity = buffer->capacity <= (ZR_MAX_SIZE - 1) / 2 ? buffer->capacity * 2 : required;
+    if (newCapacity < required) {
+        newCapacity = required;
+    }
+    *outCapacity = newCapacity;
+    return ZR_TRUE;
+}
+
+// the exposed tip keeps the current block (its flat view must never move); appends continue in a new block
+static TZrBool string_append_buffer_detach_tip(SZrStringAppendBuffer *buffer, TZrSize extra) {
+    SZrString *tip = buffer->exposedTip;
+    SZrStringConcatNode *tipNode;
+    TZrSize newCapacity;
+    TZrChar *data;
+
+    if (tip == ZR_NULL) {
+        return ZR_TRUE;
+    }
+    if (!string_append_buffer_grown_capacity(buffer, extra, &newCapacity)) {
+        return ZR_FALSE;
+    }
+
+    data = (TZrChar *)ZrCore_Memory_RawMallocWithType(buffer->global, newCapacity + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
+    if (data == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    memcpy(data, buffer->data, buffer->length);
+
+    tipNode = string_concat_node(tip);
+    ZR_ASSERT(tipNode->flatString == buffer->data);
+    tipNode->flatStringSize = buffer->capacity + 1;
+    buffer->data = data;
+    buffer->capacity = newCapacity;
+    buffer->exposedTip = ZR_NULL;
+    return ZR_TRUE;
+}
+
+static TZrBool string_append_buffer_reserve(SZrStringAppendBuffer *buffer, TZrSize extra) {
+    TZrSize newCapacity;
+    TZrChar *data;
+
+    if (!string_append_buffer_grown_capacity(buffer, extra, &newCapacity)) {
+        return ZR_FALSE;
+    }
+    if (newCapacity == buffer->capacity) {
+        return ZR_TRUE;
+    }
+
+    // no node borrows the block here, so it may move
+    ZR_ASSERT(buffer->exposedTip == ZR_NULL);
+    data = (TZrChar *)ZrCore_Memory_Allocate(buffer->global,
+                                             buffer->data,
+                                             buffer->capacity + 1,
+                                             newCapacity + 1,
+                                             ZR_MEMORY_NATIVE_TYPE_STRING);
+    if (data == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    buffer->data = data;
+    buffer->capacity = newCapacity;
+    return ZR_TRUE;
+}
+
+static void string_append_buffer_write(SZrStringAppendBuffer *buffer, const TZrChar *bytes, TZrSize length) {
+    TZrChar *destination;
+
+    if (length == 0) {
+        return;
+    }
+    ZR_ASSERT(buffer->length + length <= buffer->capacity);
+    destination = buffer->data + buffer->length;
+    memcpy(destination, bytes, length);
+    (void)ZrCore_HashStream_Update(buffer->hashStream, (const TZrByte *)destination, length);
+    if (buffer->allAscii && !ZrCore_Utf8_IsAscii(destination, length)) {
+        buffer->allAscii = ZR_FALSE;
+    }
+    buffer->length += length;
+}
+
+// a buffer that ends exactly at `left`, with room for `extra` more bytes
+static SZrStringAppendBuffer *string_append_buffer_prepare(SZrState *state, const SZrString *left, TZrSize extra) {
+    SZrStringAppendBuffer *buffer;
+    TZrSize leftLength = ZrCore_String_GetByteLength(left);
+
+    if (ZrCore_String_IsConcatNode(left)) {
+        buffer = string_concat_node(left)->appendBuffer;
+        if (buffer->length == leftLength) {
+            if (!string_append_buffer_detach_tip(buffer, extra) || !string_append_buffer_reserve(buffer, extra)) {
+                return ZR_NULL;
+            }
+            return buffer;
+        }
+    }
+
+    if (extra >= ZR_MAX_SIZE / 2 - leftLength) {
+        return ZR_NULL;
+    }
+    buffer = string_append_buffer_new(state->global, (leftLength + extra) * 2);
+    if (buffer == ZR_NULL) {
+        return ZR_NULL;
+    }
+    string_append_buffer_write(buffer, string_peek_bytes(left), leftLength);
+    return buffer;
+}
+
+static SZrString *string_append_buffer_commit(SZrState *state, SZrStringAppendBuffer *buffer) {
+    SZrString *result;
+    SZrStringConcatNode *node;
+
+    // referenced before allocating so a collection triggered by the allocation cannot release the buffer
+    buffer->referenceCount++;
+    result = (SZrString *)ZrCore_RawObject_New(state,
+                                               ZR_VALUE_TYPE_STRING,
+                                               sizeof(SZrString) + sizeof(SZrStringConcatNode),
+                                               ZR_TRUE);
+    if (result == ZR_NULL) {
+        string_append_buffer_release(buffer);
+        return ZR_NULL;
+    }
+
+    result->shortStringLength = ZR_VM_LONG_STRING_FLAG;
+    result->stringFlags = ZR_VM_STRING_FLAG_CONCAT_NODE | (buffer->allAscii ? ZR_VM_STRING_FLAG_ASCII : 0U);
+    result->longStringLength = buffer->length;
+    node = string_concat_node(result);
+    node->flatString = ZR_NULL;
+    node->flatStringSize = 0;
+    node->codePointIndex = ZR_NULL;
+    node->appendBuffer = buffer;
+    ZrCore_RawObject_InitHash(ZR_CAST_RAW_OBJECT_AS_SUPER(result), ZrCore_HashStream_Digest(buffer->hashStream));
+    return result;
+}
+
+// left + pieces... + nativeTail as a concat node; the caller guarantees the result is a long string
+static SZrString *string_concat_append(SZrState *state,
+                                       const SZrString *left,
+                                       SZrString *const *pieces,
+                                       TZrSize pieceCount,
+                                       TZrNativeString nativeTail,
+                                       TZrSize nativeTailLength) {
+    SZrStringAppendBuffer *buffer;
+    TZrSize extra = nativeTailLength;
+
+    for (TZrSize index = 0; index < pieceCount; index++) {
+        TZrSize pieceLength = ZrCore_String_GetByteLength(pieces[index]);
+
+        if (pieceLength >= ZR_MAX_SIZE - extra) {
+            return ZR_NULL;
+        }
+        extra += pieceLength;
+    }
+    if (extra == 0) {
+        return (SZrString *)left;
+    }
+
+    buffer = string_append_buffer_prepare(state, left, extra);
+    if (buffer == ZR_NULL) {
+        return ZR_NULL;
+    }
+    // pieces are read after reserving: a piece may live in this very buffer, which may have moved
+    for (TZrSize index = 0; index < pieceCount; index++) {
+        string_append_buffer_write(buffer, string_peek_bytes(pieces[index]), ZrCore_String_GetByteLength(pieces[index]));
+    }
+    string_append_buffer_write(buffer, nativeTail, nativeTailLength);
+    return string_append_buffer_commit(state, buffer);
+}
+
+TZrNativeString ZrCore_String_Flatten(const SZrString *string) {
+    SZrStringConcatNode *node;
+    SZrStringAppendBuffer *buffer;
+    TZrSize length;
+
+    if (string == ZR_NULL) {
+        return ZR_NULL;
+    }
+    if (string->shortStringLength < ZR_VM_LONG_STRING_FLAG) {
+        return ZrCore_String_GetNativeStringShort(string);
+    }
+    if (!ZrCore_String_IsConcatNode(string)) {
+        return *ZrCore_String_GetNativeStringLong(string);
+    }
+
+    node = string_concat_node(string);
+    if (node->flatString != ZR_NULL) {
+        return node->flatString;
+    }
+
+    buffer = node->appendBuffer;
+    length = string->longStringLength;
+    if (length == buffer->length && buffer->exposedTip == ZR_NULL) {
+        buffer->data[length] = '\0';
+        buffer->exposedTip = (SZrString *)string;
+        node->flatString = buffer->data;
+        return node->flatString;
+    }
+
+    node->flatString = string_copy_terminated(buffer->global, buffer->data, length);
+    if (node->flatString != ZR_NULL) {
+        node->flatStringSize = length + 1;
+    }
+    return node->flatString;
+}
+
+void ZrCore_String_ReleaseConcatNode(SZrGlobalState *global, SZrString *string) {
+    SZrStringConcatNode *node;
+    SZrStringAppendBuffer *buffer;
+
+    if (global == ZR_NULL || !ZrCore_String_IsConcatNode(string)) {
+        return;
+    }
+
+    node = string_concat_node(string);
+    buffer = node->appendBuffer;
+    if (buffer == ZR_NULL) {
+        return;
+    }
+    if (buffer->exposedTip == string) {
+        buffer->exposedTip = ZR_NULL;
+    } else if (node->flatString != ZR_NULL) {
+        ZrCore_Memory_RawFreeWithType(global, node->flatString, node->flatStringSize, ZR_MEMORY_NATIVE_TYPE_STRING);
+    }
+    node->flatString = ZR_NULL;
+    node->flatStringSize = 0;
+    node->appendBuffer = ZR_NULL;
+    string_append_buffer_release(buffer);
+}
+
 static SZrString *string_create_native_concat_segments(SZrState *state,
                                                        TZrNativeString leftNative,
                                                        TZrSize leftLength,
@@ -277,8 +622,8 @@ static SZrString *string_create_native_concat_segments(SZrState *state,
                                                                          totalLength + 1,
                                                                          ZR_MEMORY_NATIVE_TYPE_STRING));
         SZrString *result;
-        TZrNativeString *pointer;
-        TZrSize totalSize = sizeof(SZrString) + sizeof(TZrNativeString);
+        SZrStringLongExtend *extend;
+        TZrSize totalSize = sizeof(SZrString) + sizeof(SZrStringLongExtend);
 
         if (buffer == ZR_NULL) {
             return ZR_NULL;
@@ -297,10 +642,14 @@ static SZrString *string_create_native_concat_segments(SZrState *state,
             return ZR_NULL;
         }
 
-        pointer = (TZrNativeString *)&(result->stringDataExtend);
-        *pointer = buffer;
+        extend = (SZrStringLongExtend *)result->stringDataExtend;
+        extend->nativeString = buffer;
+        extend->codePointIndex = ZR_NULL;
         result->shortStringLength = ZR_VM_LONG_STRING_FLAG;
         result->longStringLength = totalLength;
+        if (ZrCore_Utf8_IsAscii(buffer, totalLength)) {
+            result->stringFlags |= ZR_VM_STRING_FLAG_ASCII;
+        }
         ZrCore_RawObject_InitHash(ZR_CAST_RAW_OBJECT_AS_SUPER(result), ZrCore_Hash_Create(global, buffer, totalLength));
         return result;
     }
@@ -484,6 +833,19 @@ static void zr_string_concat_stack_values(SZrState *state, TZrSize count, TZrBoo
         totalLength += zr_string_length_local(stringValue);
     }
 
+    if (totalLength > ZR_VM_SHORT_STRING_MAX) {
+        // long results extend the first operand's append buffer instead of copying every operand again
+        SZrString *result = string_concat_append(state, stringValues[0], stringValues + 1, count - 1, ZR_NULL, 0);
+
+        firstSlot = ZrCore_Function_StackAnchorRestore(state, &firstSlotAnchor);
+        ZrCore_Memory_RawFreeWithType(global,
+                                stringValues,
+                                count * sizeof(SZrString *),
+                                ZR_MEMORY_NATIVE_TYPE_ARRAY);
+        zr_string_collapse_stack_window(state, firstSlot, result);
+        return;
+    }
+
     buffer = (TZrNativeString)ZrCore_Memory_RawMallocWithType(global,
                                                       totalLength + 1,
                                                       ZR_MEMORY_NATIVE_TYPE_STRING);
@@ -496,10 +858,9 @@ static void zr_string_concat_stack_values(SZrState *state, TZrSize count, TZrBoo
         for (TZrSize i = 0; i < count; i++) {
             SZrString *stringValue = stringValues[i];
             TZrSize length = zr_string_length_local(stringValue);
-            TZrNativeString nativeString = ZrCore_String_GetNativeString(stringValue);
 
-            if (length > 0 && nativeString != ZR_NULL) {
-                memcpy(cursor, nativeString, length);
+            if (length > 0) {
+                memcpy(cursor, string_peek_bytes(stringValue), length);
                 cursor += length;
             }
         }
@@ -711,17 +1072,22 @@ static SZrString *string_object_create(SZrState *state, TZrNativeString string,
         constantString->nextShortString = ZR_NULL;
         stringBuffer = (TZrNativeString) constantString->stringDataExtend;
     } else {
-        totalSize += sizeof(TZrNativeString);
+        totalSize += sizeof(SZrStringLongExtend);
         constantString = (SZrString *) ZrCore_RawObject_New(state, ZR_VALUE_TYPE_STRING, totalSize, ZR_TRUE);
-        TZrNativeString *pointer = (TZrNativeString *) &(constantString->stringDataExtend);
-        *pointer = (TZrNativeString) ZrCore_Memory_RawMallocWithType(global, length + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
+        SZrStringLongExtend *extend = (SZrStringLongExtend *) constantString->stringDataExtend;
+        extend->nativeString =
+                (TZrNativeString) ZrCore_Memory_RawMallocWithType(global, length + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
+        extend->codePointIndex = ZR_NULL;
 
-        ZrCore_Memory_RawCopy(*pointer, string, length);
+        ZrCore_Memory_RawCopy(extend->nativeString, string, length);
 
-        (*pointer)[length] = '\0';
+        extend->nativeString[length] = '\0';
         constantString->shortStringLength = ZR_VM_LONG_STRING_FLAG;
         constantString->longStringLength = length;
-        stringBuffer = *pointer;
+        stringBuffer = extend->nativeString;
+    }
+    if (ZrCore_Utf8_IsAscii(stringBuffer, length)) {
+        constantString->stringFlags |= ZR_VM_STRING_FLAG_ASCII;
     }
 
     ZrCore_RawObject_InitHash(ZR_CAST_RAW_OBJECT_AS_SUPER(constantString),
@@ -794,12 +1160,9 @@ static ZR_FORCE_INLINE SZrString *string_create_long(SZrState *state, TZrNativeS
 }
 
 SZrString *ZrCore_String_ConcatPair(SZrState *state, const SZrString *left, const SZrString *right) {
-    SZrGlobalState *global;
     TZrSize leftLength;
     TZrSize rightLength;
     TZrSize totalLength;
-    TZrNativeString leftNative;
-    TZrNativeString rightNative;
     SZrString *cachedResult;
 
     if (state == ZR_NULL || left == ZR_NULL || right == ZR_NULL || state->global == ZR_NULL) {
@@ -814,18 +1177,16 @@ SZrString *ZrCore_String_ConcatPair(SZrState *state, const SZrString *left, cons
     leftLength = ZrCore_String_GetByteLength(left);
     rightLength = ZrCore_String_GetByteLength(right);
     totalLength = leftLength + rightLength;
-    leftNative = ZrCore_String_GetNativeString(left);
-    rightNative = ZrCore_String_GetNativeString(right);
 
     if (totalLength <= ZR_VM_SHORT_STRING_MAX) {
         TZrChar stackBuffer[ZR_VM_SHORT_STRING_MAX + 1];
         SZrString *result;
 
-        if (leftLength > 0 && leftNative != ZR_NULL) {
-            memcpy(stackBuffer, leftNative, leftLength);
+        if (leftLength > 0) {
+            memcpy(stackBuffer, string_peek_bytes(left), leftLength);
         }
-        if (rightLength > 0 && rightNative != ZR_NULL) {
-            memcpy(stackBuffer + leftLength, rightNative, rightLength);
+        if (rightLength > 0) {
+            memcpy(stackBuffer + leftLength, string_peek_bytes(right), rightLength);
         }
         stackBuffer[totalLength] = '\0';
         result = string_create_short(state, stackBuffer, totalLength);
@@ -833,28 +1194,7 @@ SZrString *ZrCore_String_ConcatPair(SZrState *state, const SZrString *left, cons
         return result;
     }
 
-    global = state->global;
-    {
-        TZrNativeString buffer =
-                (TZrNativeString)ZrCore_Memory_RawMallocWithType(global, totalLength + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
-        SZrString *result;
-
-        if (buffer == ZR_NULL) {
-            return ZR_NULL;
-        }
-
-        if (leftLength > 0 && leftNative != ZR_NULL) {
-            memcpy(buffer, leftNative, leftLength);
-        }
-        if (rightLength > 0 && rightNative != ZR_NULL) {
-            memcpy(buffer + leftLength, rightNative, rightLength);
-        }
-        buffer[totalLength] = '\0';
-
-        result = string_create_long(state, buffer, totalLength);
-        ZrCore_Memory_RawFreeWithType(global, buffer, totalLength + 1, ZR_MEMORY_NATIVE_TYPE_STRING);
-        return result;
-    }
+    return string_concat_append(state, left, (SZrString *const *)&right, 1, ZR_NULL, 0);
 }
 
 SZrString *ZrCore_String_ConcatStringAndNative(SZrState *state,
@@ -869,13 +1209,80 @@ SZrString *ZrCore_String_ConcatStringAndNative(SZrState *state,
         return ZR_NULL;
     }
 
-    stringNative = ZrCore_String_GetNativeString(stringValue);
     stringLength = ZrCore_String_GetByteLength(stringValue);
+    if (stringOnLeft && stringLength + nativeLength > ZR_VM_SHORT_STRING_MAX) {
+        return string_concat_append(state, stringValue, ZR_NULL, 0, nativeString, nativeLength);
+    }
+
+    stringNative = (TZrNativeString)string_peek_bytes(stringValue);
     return stringOnLeft ? string_create_native_concat_segments(state, stringNative, stringLength, nativeString, nativeLength)
                         : string_create_native_concat_segments(state, nativeString, nativeLength, stringNative, stringLength);
 }
 
 
+static TZrBool string_builder_text_key(SZrState *state, SZrTypeValue *outKey) {
+    SZrString *keyString = ZR_STRING_LITERAL(state, ZR_STRING_BUILDER_TEXT_FIELD);
+
+    if (keyString == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    ZrCore_Value_InitAsRawObject(state, outKey, ZR_CAST_RAW_OBJECT_AS_SUPER(keyString));
+    outKey->type = ZR_VALUE_TYPE_STRING;
+    return ZR_TRUE;
+}
+
+SZrString *ZrCore_String_BuilderGetText(SZrState *state, SZrObject *builder) {
+    SZrTypeValue key;
+    const SZrTypeValue *text;
+
+    if (state == ZR_NULL || builder == ZR_NULL || !string_builder_text_key(state, &key)) {
+        return ZR_NULL;
+    }
+
+    text = ZrCore_Object_GetValue(state, builder, &key);
+    if (text != ZR_NULL && text->type == ZR_VALUE_TYPE_STRING) {
+        return ZR_CAST_STRING(state, text->value.object);
+    }
+    return ZrCore_String_Create(state, "", 0);
+}
+
+TZrBool ZrCore_String_BuilderAppend(SZrState *state, SZrObject *builder, const SZrTypeValue *value) {
+    SZrGcHandleScope handleScope;
+    SZrTypeValue stableValue;
+    SZrTypeValue key;
+    SZrTypeValue textValue;
+    SZrString *piece;
+    SZrString *text;
+    SZrString *result = ZR_NULL;
+
+    if (state == ZR_NULL || builder == ZR_NULL || value == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    stableValue = *value;
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
+    (void)ZrCore_State_HandleScopePushObject(&handleScope, ZR_CAST_RAW_OBJECT_AS_SUPER(builder));
+    (void)ZrCore_State_HandleScopePushValue(&handleScope, &stableValue);
+    piece = stableValue.type == ZR_VALUE_TYPE_STRING ? ZR_CAST_STRING(state, stableValue.value.object)
+                                                     : ZrCore_Value_ConvertToString(state, &stableValue);
+    if (piece != ZR_NULL) {
+        (void)ZrCore_State_HandleScopePushObject(&handleScope, ZR_CAST_RAW_OBJECT_AS_SUPER(piece));
+        text = ZrCore_String_BuilderGetText(state, builder);
+        (void)ZrCore_State_HandleScopePushObject(&handleScope, ZR_CAST_RAW_OBJECT_AS_SUPER(text));
+        // the text is the tip of its append buffer, so this writes only the new bytes
+        result = text != ZR_NULL ? ZrCore_String_ConcatPair(state, text, piece) : ZR_NULL;
+    }
+    if (result != ZR_NULL && string_builder_text_key(state, &key)) {
+        ZrCore_Value_InitAsRawObject(state, &textValue, ZR_CAST_RAW_OBJECT_AS_SUPER(result));
+        textValue.type = ZR_VALUE_TYPE_STRING;
+        ZrCore_Object_SetValue(state, builder, &key, &textValue);
+    } else {
+        result = ZR_NULL;
+    }
+    ZrCore_State_HandleScopeClose(state, &handleScope);
+    return result != ZR_NULL;
+}
+
 SZrString *ZrCore_String_Create(SZrState *state, TZrNativeString string, TZrSize length) {
     string_trace("string create dispatch length=%llu text=%p", (unsigned long long)length, (const void *)string);
     if (length <= ZR_VM_SHORT_STRING_MAX) {
@@ -934,78 +1341,251 @@ SZrString *ZrCore_String_CreateTryHitCache(SZrState *state, TZrNativeString stri
     return apiCache[0];
 }
 
-TZrBool ZrCore_String_GetCodePointLength(const SZrString *string, TZrSize *outLength) {
-    TZrNativeString nativeString;
-    TZrSize byteLength;
+/*
+ * Code-point indexing. ASCII strings are flagged when they are created, so their code-point length is the byte
+ * length and a code-point offset is a byte offset. Other strings are validated and measured once, on the first
+ * code-point query: short strings cache the count in shortCodePointLength, long strings build a
+ * SZrStringCodePointIndex holding the count plus the byte offset of every
+ * ZR_VM_STRING_CODE_POINT_BREADCRUMB_STRIDE-th code point, so an offset lookup starts at the nearest
+ * breadcrumb and walks at most one stride. Invalid UTF-8 is remembered with ZR_VM_STRING_FLAG_UTF8_INVALID.
+ */
+struct SZrStringCodePointIndex {
+    TZrSize codePointLength;
+    TZrSize breadcrumbCount;
+    // breadcrumbs[i] is the byte offset of code point i * ZR_VM_STRING_CODE_POINT_BREADCRUMB_STRIDE
+    TZrSize breadcrumbs[1];
+};
+
+typedef struct SZrStringCodePointIndex SZrStringCodePointIndex;
+
+static ZR_FORCE_INLINE TZrSize string_code_point_index_size(TZrSize breadcrumbCount) {
+    return sizeof(SZrStringCodePointIndex) + (breadcrumbCount - 1) * sizeof(TZrSize);
+}
 
-    if (outLength == ZR_NULL || string == ZR_NULL) {
+static SZrStringCodePointIndex **string_code_point_index_slot(const SZrString *string) {
+    if (ZrCore_String_IsConcatNode(string)) {
+        return &string_concat_node(string)->codePointIndex;
+    }
+    return &((SZrStringLongExtend *)string->stringDataExtend)->codePointIndex;
+}
+
+// validates and counts once; ZR_FALSE for invalid UTF-8
+static TZrBool string_measure_code_points(SZrString *string, TZrSize *outLength) {
+    if (!ZrCore_Utf8_CountCodePoints((TZrNativeString)string_peek_bytes(string),
+                                     ZrCore_String_GetByteLength(string),
+                                     outLength)) {
+        string->stringFlags |= ZR_VM_STRING_FLAG_UTF8_INVALID;
         return ZR_FALSE;
     }
+    return ZR_TRUE;
+}
+
+// the index of a long non-ASCII string; ZR_NULL when the bytes are invalid or the index cannot be allocated
+static SZrStringCodePointIndex *string_code_point_index_get(SZrState *state, SZrString *string) {
+    SZrStringCodePointIndex **slot = string_code_point_index_slot(string);
+    SZrStringCodePointIndex *index = *slot;
+    const TZrChar *bytes;
+    TZrSize byteLength;
+    TZrSize codePointLength;
+    TZrSize breadcrumbCount;
+
+    if (index != ZR_NULL) {
+        return index;
+    }
+    if (!string_measure_code_points(string, &codePointLength)) {
+        return ZR_NULL;
+    }
+
+    breadcrumbCount = codePointLength / ZR_VM_STRING_CODE_POINT_BREADCRUMB_STRIDE + 1;
+    index = (SZrStringCodePointIndex *)ZrCore_Memory_RawMallocWithType(state->global,
+                                                                     string_code_point_index_size(breadcrumbCount),
+                                                                     ZR_MEMORY_NATIVE_TYPE_STRING);
+    if (index == ZR_NULL) {
+        return ZR_NULL;
+    }
 
-    nativeString = ZrCore_String_GetNativeString(string);
+    bytes = string_peek_bytes(string);
     byteLength = ZrCore_String_GetByteLength(string);
-    return ZrCore_Utf8_CountCodePoints(nativeString, byteLength, outLength);
+    index->codePointLength = codePointLength;
+    index->breadcrumbCount = breadcrumbCount;
+    index->breadcrumbs[0] = 0;
+    for (TZrSize crumb = 1; crumb < breadcrumbCount; crumb++) {
+        index->breadcrumbs[crumb] = ZrCore_Utf8_SkipCodePoints(bytes,
+                                                               byteLength,
+                                                               index->breadcrumbs[crumb - 1],
+                                                               ZR_VM_STRING_CODE_POINT_BREADCRUMB_STRIDE);
+    }
+    *slot = index;
+    return index;
+}
+
+void ZrCore_String_ReleaseCodePointIndex(SZrGlobalState *global, SZrString *string) {
+    SZrStringCodePointIndex **slot;
+
+    if (global == ZR_NULL || string == ZR_NULL || string->shortStringLength < ZR_VM_LONG_STRING_FLAG) {
+        return;
+    }
+
+    slot = string_code_point_index_slot(string);
+    if (*slot != ZR_NULL) {
+        ZrCore_Memory_RawFreeWithType(global,
+                                      *slot,
+                                      string_code_point_index_size((*slot)->breadcrumbCount),
+                                      ZR_MEMORY_NATIVE_TYPE_STRING);
+        *slot = ZR_NULL;
+    }
 }
 
-TZrBool ZrCore_String_CodePointCountToByteOffset(const SZrString *string,
+TZrBool ZrCore_String_GetCodePointLength(SZrState *state, const SZrString *string, TZrSize *outLength) {
+    SZrString *mutableString = (SZrString *)string;
+    SZrStringCodePointIndex *index;
+
+    if (state == ZR_NULL || outLength == ZR_NULL || string == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    if (ZrCore_String_IsAscii(string)) {
+        *outLength = ZrCore_String_GetByteLength(string);
+        return ZR_TRUE;
+    }
+    if ((string->stringFlags & ZR_VM_STRING_FLAG_UTF8_INVALID) != 0) {
+        return ZR_FALSE;
+    }
+
+    if (string->shortStringLength < ZR_VM_LONG_STRING_FLAG) {
+        if ((string->stringFlags & ZR_VM_STRING_FLAG_CODE_POINTS_READY) == 0) {
+            TZrSize codePointLength;
+
+            if (!string_measure_code_points(mutableString, &codePointLength)) {
+                return ZR_FALSE;
+            }
+            mutableString->shortCodePointLength = (TZrUInt8)codePointLength;
+            mutableString->stringFlags |= ZR_VM_STRING_FLAG_CODE_POINTS_READY;
+        }
+        *outLength = string->shortCodePointLength;
+        return ZR_TRUE;
+    }
+
+    index = string_code_point_index_get(state, mutableString);
+    if (index == ZR_NULL) {
+        // out of memory for the index: count without caching
+        return (string->stringFlags & ZR_VM_STRING_FLAG_UTF8_INVALID) == 0 &&
+               string_measure_code_points(mutableString, outLength);
+    }
+    *outLength = index->codePointLength;
+    return ZR_TRUE;
+}
+
+TZrBool ZrCore_String_CodePointCountToByteOffset(SZrState *state,
+                                                 const SZrString *string,
                                                  TZrSize codePointCount,
                                                  TZrSize *outOffset) {
-    TZrNativeString nativeString;
+    SZrStringCodePointIndex *index;
     TZrSize byteLength;
+    TZrSize crumb;
 
-    if (outOffset == ZR_NULL || string == ZR_NULL) {
+    if (state == ZR_NULL || outOffset == ZR_NULL || string == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    nativeString = ZrCore_String_GetNativeString(string);
     byteLength = ZrCore_String_GetByteLength(string);
-    return ZrCore_Utf8_CodePointCountToByteOffset(nativeString, byteLength, codePointCount, outOffset);
+    if (ZrCore_String_IsAscii(string)) {
+        *outOffset = codePointCount < byteLength ? codePointCount : byteLength;
+        return ZR_TRUE;
+    }
+    if ((string->stringFlags & ZR_VM_STRING_FLAG_UTF8_INVALID) != 0) {
+        return ZR_FALSE;
+    }
+
+    index = string->shortStringLength == ZR_VM_LONG_STRING_FLAG
+                    ? string_code_point_index_get(state, (SZrString *)string)
+                    : ZR_NULL;
+    if (index == ZR_NULL) {
+        // short strings are bounded by ZR_VM_SHORT_STRING_MAX bytes, a direct walk is as cheap as any index
+        return (string->stringFlags & ZR_VM_STRING_FLAG_UTF8_INVALID) == 0 &&
+               ZrCore_Utf8_CodePointCountToByteOffset((TZrNativeString)string_peek_bytes(string),
+                                                      byteLength,
+                                                      codePointCount,
+                                                      outOffset);
+    }
+
+    if (codePointCount >= index->codePointLength) {
+        *outOffset = byteLength;
+        return ZR_TRUE;
+    }
+    crumb = codePointCount / ZR_VM_STRING_CODE_POINT_BREADCRUMB_STRIDE;
+    *outOffset = ZrCore_Utf8_SkipCodePoints(string_peek_bytes(string),
+                                            byteLength,
+                                            index->breadcrumbs[crumb],
+                                            codePointCount % ZR_VM_STRING_CODE_POINT_BREADCRUMB_STRIDE);
+    return ZR_TRUE;
+}
+
+TZrBool ZrCore_String_IsValidUtf8(SZrState *state, const SZrString *string) {
+    TZrSize codePointLength;
+
+    return ZrCore_String_GetCodePointLength(state, string, &codePointLength);
+}
+
+// zr.system.Bytes 原型按模块导出查找；core 不链接 lib_system，未注册 zr.system 的宿主得到无原型的字节缓冲
+static SZrObjectPrototype *string_find_bytes_prototype(SZrState *state) {
+    SZrString *moduleName = ZrCore_String_CreateFromNative(state, "zr.system");
+    SZrString *typeName = ZrCore_String_CreateFromNative(state, "Bytes");
+    struct SZrObjectModule *module;
+    const SZrTypeValue *exported;
+    SZrObject *object;
+
+    if (moduleName == ZR_NULL || typeName == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    module = ZrCore_Module_ImportByPath(state, moduleName);
+    exported = module != ZR_NULL ? ZrCore_Module_GetPubExport(state, module, typeName) : ZR_NULL;
+    if (exported == ZR_NULL || exported->type != ZR_VALUE_TYPE_OBJECT || exported->value.object == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    object = ZR_CAST_OBJECT(state, exported->value.object);
+    return object->internalType == ZR_OBJECT_INTERNAL_TYPE_OBJECT_PROTOTYPE ? (SZrObjectPrototype *)object : ZR_NULL;
 }
 
 TZrBool ZrCore_String_ToByteArray(SZrState *state,
                                   const SZrString *string,
-                                  SZrObject **outArray) {
-    SZrObject *array;
-    SZrTypeValue receiver;
-    TZrNativeString nativeString;
+                                  SZrObject **outBytes) {
+    SZrObject *bytes;
+    SZrObjectPrototype *prototype;
     TZrSize byteLength;
-    const TZrUInt8 *bytes;
 
-    if (outArray != ZR_NULL) {
-        *outArray = ZR_NULL;
+    if (outBytes != ZR_NULL) {
+        *outBytes = ZR_NULL;
     }
 
-    if (state == ZR_NULL || string == ZR_NULL || outArray == ZR_NULL) {
+    if (state == ZR_NULL || string == ZR_NULL || outBytes == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    nativeString = ZrCore_String_GetNativeString(string);
     byteLength = ZrCore_String_GetByteLength(string);
-    if (!ZrCore_Utf8_IsValid(nativeString, byteLength)) {
+    if (!ZrCore_String_IsValidUtf8(state, string)) {
         return ZR_FALSE;
     }
 
-    array = ZrCore_Object_NewCustomized(state, sizeof(SZrObject), ZR_OBJECT_INTERNAL_TYPE_ARRAY);
-    if (array == ZR_NULL) {
+    prototype = string_find_bytes_prototype(state);
+    bytes = ZrCore_Object_NewCustomized(state, sizeof(SZrObject), ZR_OBJECT_INTERNAL_TYPE_OBJECT);
+    if (bytes == ZR_NULL) {
         return ZR_FALSE;
     }
-    ZrCore_Object_Init(state, array);
+    bytes->prototype = prototype;
+    ZrCore_Object_Init(state, bytes);
 
-    ZrCore_Value_InitAsRawObject(state, &receiver, ZR_CAST_RAW_OBJECT_AS_SUPER(array));
-    receiver.type = ZR_VALUE_TYPE_ARRAY;
-    bytes = (const TZrUInt8 *)nativeString;
-    for (TZrSize index = 0; index < byteLength; index++) {
-        SZrTypeValue indexValue;
-        SZrTypeValue elementValue;
-
-        ZrCore_Value_InitAsInt(state, &indexValue, (TZrInt64)index);
-        ZrCore_Value_InitAsUInt(state, &elementValue, (TZrUInt64)bytes[index]);
-        if (!ZrCore_Object_SetByIndex(state, &receiver, &indexValue, &elementValue)) {
-            return ZR_FALSE;
-        }
+    if (!ZrCore_Object_AllocateByteStorage(state, bytes, byteLength)) {
+        return ZR_FALSE;
+    }
+    if (byteLength > 0) {
+        ZrCore_Memory_RawCopy(ZrCore_Object_GetByteStorageData(bytes),
+                              (TZrPtr)ZrCore_String_GetNativeString(string),
+                              byteLength);
     }
 
-    *outArray = array;
+    *outBytes = bytes;
     return ZR_TRUE;
 }
 
@@ -1024,7 +1604,8 @@ TZrBool ZrCore_String_Equal(SZrString *string1, SZrString *string2) {
         if (string1->longStringLength != string2->longStringLength) {
             return ZR_FALSE;
         }
-        return ZrCore_Memory_RawCompare(*ZrCore_String_GetNativeStringLong(string1), *ZrCore_String_GetNativeStringLong(string2),
+        // concat nodes compare their buffered prefix without being flattened
+        return ZrCore_Memory_RawCompare((TZrPtr)string_peek_bytes(string1), (TZrPtr)string_peek_bytes(string2),
                                   string1->longStringLength * sizeof(TZrChar)) == 0;
     }
 
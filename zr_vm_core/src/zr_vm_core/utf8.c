@@ -4,8 +4,40 @@
 
 #include "zr_vm_core/utf8.h"
 
+#include <string.h>
+
 #include "utf8proc/utf8proc.h"
 
+/*
+ * ASCII runs are consumed a machine word at a time: a word whose bytes all have the high bit clear is eight
+ * complete code points, so validation, counting and offset walks only fall back to utf8proc for the
+ * multi-byte sequences themselves. Loads go through memcpy, so unaligned buffers are fine.
+ */
+#define ZR_UTF8_WORD_SIZE sizeof(TZrUInt64)
+#define ZR_UTF8_WORD_HIGH_BITS ((TZrUInt64)0x8080808080808080ULL)
+
+static ZR_FORCE_INLINE TZrUInt64 zr_utf8_load_word(const TZrChar *bytes) {
+    TZrUInt64 word;
+
+    memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+// length of the whole-word ASCII prefix of string[0, length)
+static ZR_FORCE_INLINE TZrSize zr_utf8_ascii_word_run(const TZrChar *string, TZrSize length) {
+    TZrSize offset = 0;
+
+    while (length - offset >= ZR_UTF8_WORD_SIZE &&
+           (zr_utf8_load_word(string + offset) & ZR_UTF8_WORD_HIGH_BITS) == 0) {
+        offset += ZR_UTF8_WORD_SIZE;
+    }
+    return offset;
+}
+
+static ZR_FORCE_INLINE TZrBool zr_utf8_is_continuation_byte(TZrChar byte) {
+    return ((TZrUInt8)byte & 0xC0U) == 0x80U;
+}
+
 static TZrBool zr_utf8_decode_internal(TZrNativeString string,
                                        TZrSize length,
                                        utf8proc_int32_t *outCodePoint,
@@ -40,6 +72,15 @@ TZrBool ZrCore_Utf8_IsValid(TZrNativeString string, TZrSize length) {
 
     while (offset < length) {
         TZrSize consumedBytes = 0;
+
+        offset += zr_utf8_ascii_word_run(string + offset, length - offset);
+        if (offset >= length) {
+            break;
+        }
+        if ((TZrUInt8)string[offset] < 0x80U) {
+            offset++;
+            continue;
+        }
         if (!zr_utf8_decode_internal(string + offset,
                                      length - offset,
                                      ZR_NULL,
@@ -52,6 +93,21 @@ TZrBool ZrCore_Utf8_IsValid(TZrNativeString string, TZrSize length) {
     return ZR_TRUE;
 }
 
+TZrBool ZrCore_Utf8_IsAscii(const TZrChar *string, TZrSize length) {
+    TZrSize offset;
+
+    if (string == ZR_NULL) {
+        return length == 0 ? ZR_TRUE : ZR_FALSE;
+    }
+
+    for (offset = zr_utf8_ascii_word_run(string, length); offset < length; offset++) {
+        if (((TZrUInt8)string[offset] & 0x80U) != 0) {
+            return ZR_FALSE;
+        }
+    }
+    return ZR_TRUE;
+}
+
 TZrBool ZrCore_Utf8_DecodeCodePoint(TZrNativeString string,
                                     TZrSize length,
                                     TZrUInt32 *outCodePoint,
@@ -113,6 +169,18 @@ TZrBool ZrCore_Utf8_CountCodePoints(TZrNativeString string,
 
     while (offset < length) {
         TZrSize consumedBytes = 0;
+        TZrSize asciiRun = zr_utf8_ascii_word_run(string + offset, length - offset);
+
+        offset += asciiRun;
+        count += asciiRun;
+        if (offset >= length) {
+            break;
+        }
+        if ((TZrUInt8)string[offset] < 0x80U) {
+            offset++;
+            count++;
+            continue;
+        }
         if (!zr_utf8_decode_internal(string + offset,
                                      length - offset,
                                      ZR_NULL,
@@ -148,6 +216,21 @@ TZrBool ZrCore_Utf8_CodePointCountToByteOffset(TZrNativeString string,
 
     while (offset < length && count < codePointCount) {
         TZrSize consumedBytes = 0;
+        TZrSize remainingBytes = length - offset;
+        TZrSize asciiRun = zr_utf8_ascii_word_run(string + offset,
+                                                  codePointCount - count < remainingBytes ? codePointCount - count
+                                                                                          : remainingBytes);
+
+        offset += asciiRun;
+        count += asciiRun;
+        if (offset >= length || count >= codePointCount) {
+            break;
+        }
+        if ((TZrUInt8)string[offset] < 0x80U) {
+            offset++;
+            count++;
+            continue;
+        }
         if (!zr_utf8_decode_internal(string + offset,
                                      length - offset,
                                      ZR_NULL,
@@ -161,3 +244,30 @@ TZrBool ZrCore_Utf8_CodePointCountToByteOffset(TZrNativeString string,
     *outOffset = offset;
     return ZR_TRUE;
 }
+
+TZrSize ZrCore_Utf8_SkipCodePoints(const TZrChar *string,
+                                   TZrSize length,
+                                   TZrSize offset,
+                                   TZrSize codePointCount) {
+    if (string == ZR_NULL) {
+        return offset;
+    }
+
+    while (codePointCount > 0 && offset < length) {
+        TZrSize remainingBytes = length - offset;
+        TZrSize asciiRun = zr_utf8_ascii_word_run(string + offset,
+                                                  codePointCount < remainingBytes ? codePointCount : remainingBytes);
+
+        offset += asciiRun;
+        codePointCount -= asciiRun;
+        if (codePointCount == 0 || offset >= length) {
+            break;
+        }
+        offset++;
+        codePointCount--;
+        while (offset < length && zr_utf8_is_continuation_byte(string[offset])) {
+            offset++;
+        }
+    }
+    return offset;
+}
@@ -246,11 +246,14 @@ TZrUInt64 ZrCore_Value_GetHash(struct SZrState *state, const SZrTypeValue *value
         } break;
         case ZR_VALUE_TYPE_OBJECT: {
             SZrObject *object = ZR_CAST_OBJECT(state, value->value.object);
-            hash = object->super.hash;
+            hash = ZrCore_RawObject_GetHash(&object->super);
         } break;
             // todo: support more types
         default: {
-            hash = value->value.nativeObject.nativeUInt64;
+            // identity-hashed like objects so the hash set rehash below agrees with lookups
+            hash = value->isGarbageCollectable && value->value.object != ZR_NULL
+                           ? ZrCore_RawObject_GetHash(value->value.object)
+                           : value->value.nativeObject.nativeUInt64;
         } break;
     }
     return hash;
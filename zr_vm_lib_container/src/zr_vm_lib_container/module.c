@@ -35,7 +35,11 @@ static const TZrChar *kContainerPairSecondField = "second";
 
 enum {
     ZR_CONTAINER_FIELD_CACHE_CAPACITY = 48,
-    ZR_CONTAINER_HOT_MAP_LOOKUP_CACHE_SLOT_COUNT = 4
+    ZR_CONTAINER_HOT_MAP_LOOKUP_CACHE_SLOT_COUNT = 4,
+    ZR_CONTAINER_HASH_INDEX_MIN_ENTRY_COUNT = 8,
+    ZR_CONTAINER_HASH_INDEX_INITIAL_CAPACITY = 16,
+    ZR_CONTAINER_HASH_INDEX_MAX_LOAD_PERCENT = 70,
+    ZR_CONTAINER_ENTRIES_COMPACT_MIN_TOMBSTONES = 8
 };
 
 typedef struct ZrContainerFieldStringCacheEntry {
@@ -97,6 +101,8 @@ static ZR_FORCE_INLINE TZrBool zr_container_pair_matches_field_string(SZrState *
                                                                        SZrString *fieldString);
 static ZR_FORCE_INLINE void zr_container_cache_string_lookup_pair_mru(SZrObject *object,
                                                                        SZrHashKeyValuePair *pair);
+static ZR_FORCE_INLINE void zr_container_hash_index_reset(SZrObject *entries);
+static ZR_FORCE_INLINE void zr_container_entries_reset_tombstones(SZrObject *entries);
 
 static ZR_FORCE_INLINE TZrBool zr_container_field_name_equals(const TZrChar *fieldName, const TZrChar *expectedFieldName) {
     return fieldName == expectedFieldName ||
@@ -1610,6 +1616,8 @@ static void zr_container_array_clear_items_reuse_storage(SZrObject *items) {
     items->cachedIteratorNextNodePair = ZR_NULL;
     items->superArrayRawIntLength = 0;
     items->superArrayRawIntDirty = ZR_FALSE;
+    zr_container_hash_index_reset(items);
+    zr_container_entries_reset_tombstones(items);
     items->memberVersion++;
 }
 
@@ -2380,268 +2388,566 @@ static SZrObject *zr_container_make_linked_node(SZrState *state, const SZrTypeVa
     return node;
 }
 
-static TZrBool zr_container_map_find_index(SZrState *state,
-                                           SZrObject *entries,
-                                           const SZrTypeValue *key,
-                                           TZrSize *outIndex,
-                                           SZrObject **outEntryObject) {
-    TZrUInt64 wantedHash;
-    TZrSize length;
+/*
+ * Map/Set removal keeps insertion order by leaving the removed entry where it is and only marking its
+ * position here. Its index slot is gone, so hashed lookups never reach it; positional readers skip it
+ * until zr_container_entries_compact squeezes the tombstones out in one batch.
+ */
+static ZR_FORCE_INLINE TZrBool zr_container_entries_is_tombstone(const SZrObject *entries, TZrSize index) {
+    TZrSize word = index / 64u;
 
-    if (outIndex != ZR_NULL) {
-        *outIndex = 0;
+    return entries->hashIndexTombstoneCount > 0u && word < entries->hashIndexTombstoneWords &&
+           ((entries->hashIndexTombstones[word] >> (index % 64u)) & 1u) != 0u;
+}
+
+static ZR_FORCE_INLINE TZrSize zr_container_entries_live_count(SZrObject *entries) {
+    TZrSize length = zr_container_array_length_fast(entries);
+
+    return entries != ZR_NULL && entries->hashIndexTombstoneCount < length
+                   ? length - entries->hashIndexTombstoneCount
+                   : 0u;
+}
+
+static ZR_FORCE_INLINE void zr_container_entries_reset_tombstones(SZrObject *entries) {
+    if (entries == ZR_NULL) {
+        return;
     }
-    if (outEntryObject != ZR_NULL) {
-        *outEntryObject = ZR_NULL;
+    if (entries->hashIndexTombstones != ZR_NULL && entries->hashIndexTombstoneCount > 0u) {
+        memset(entries->hashIndexTombstones, 0, entries->hashIndexTombstoneWords * sizeof(TZrUInt64));
     }
-    if (state == ZR_NULL || entries == ZR_NULL || key == ZR_NULL) {
+    entries->hashIndexTombstoneCount = 0;
+}
+
+static TZrBool zr_container_entries_mark_tombstone(SZrState *state, SZrObject *entries, TZrSize index) {
+    TZrSize word = index / 64u;
+
+    if (word >= entries->hashIndexTombstoneWords) {
+        TZrSize newWords = (zr_container_array_length_fast(entries) + 63u) / 64u;
+        TZrUInt64 *newBits;
+
+        if (newWords < entries->hashIndexTombstoneWords * 2u) {
+            newWords = entries->hashIndexTombstoneWords * 2u;
+        }
+        if (newWords <= word) {
+            newWords = word + 1u;
+        }
+        newBits = (TZrUInt64 *)ZrCore_Memory_RawMallocWithType(state->global,
+                                                               newWords * sizeof(TZrUInt64),
+                                                               ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+        if (newBits == ZR_NULL) {
+            return ZR_FALSE;
+        }
+        memset(newBits, 0, newWords * sizeof(TZrUInt64));
+        if (entries->hashIndexTombstones != ZR_NULL) {
+            memcpy(newBits, entries->hashIndexTombstones, entries->hashIndexTombstoneWords * sizeof(TZrUInt64));
+            ZrCore_Memory_RawFreeWithType(state->global,
+                                          entries->hashIndexTombstones,
+                                          entries->hashIndexTombstoneWords * sizeof(TZrUInt64),
+                                          ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+        }
+        entries->hashIndexTombstones = newBits;
+        entries->hashIndexTombstoneWords = newWords;
+    }
+
+    entries->hashIndexTombstones[word] |= (TZrUInt64)1u << (index % 64u);
+    entries->hashIndexTombstoneCount++;
+    // the removed entry still sits at its position, so a hot lookup cached for its key must not survive
+    entries->memberVersion++;
+    return ZR_TRUE;
+}
+
+static ZR_FORCE_INLINE TZrSize zr_container_hash_index_home_slot(TZrUInt64 hash, TZrSize mask) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return (TZrSize)hash & mask;
+}
+
+static ZR_FORCE_INLINE TZrBool zr_container_hash_index_is_current(const SZrObject *entries) {
+    return entries != ZR_NULL &&
+           entries->hashIndexSlots != ZR_NULL &&
+           entries->hashIndexCount + entries->hashIndexTombstoneCount ==
+                   zr_container_array_length_fast((SZrObject *)entries);
+}
+
+static void zr_container_hash_index_release(SZrState *state, SZrObject *entries) {
+    if (entries == ZR_NULL) {
+        return;
+    }
+    if (entries->hashIndexSlots != ZR_NULL && entries->hashIndexCapacity > 0 && state != ZR_NULL &&
+        state->global != ZR_NULL) {
+        ZrCore_Memory_RawFreeWithType(state->global,
+                                      entries->hashIndexSlots,
+                                      entries->hashIndexCapacity * sizeof(SZrObjectHashIndexSlot),
+                                      ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+    }
+    entries->hashIndexSlots = ZR_NULL;
+    entries->hashIndexCapacity = 0;
+    entries->hashIndexCount = 0;
+}
+
+static ZR_FORCE_INLINE void zr_container_hash_index_reset(SZrObject *entries) {
+    if (entries == ZR_NULL || entries->hashIndexSlots == ZR_NULL) {
+        return;
+    }
+
+    memset(entries->hashIndexSlots, 0, entries->hashIndexCapacity * sizeof(SZrObjectHashIndexSlot));
+    entries->hashIndexCount = 0;
+}
+
+static ZR_FORCE_INLINE void zr_container_hash_index_insert_slot(SZrObjectHashIndexSlot *slots,
+                                                                TZrSize mask,
+                                                                TZrUInt64 hash,
+                                                                TZrSize entryIndex) {
+    TZrSize slotIndex = zr_container_hash_index_home_slot(hash, mask);
+
+    while (slots[slotIndex].entryIndexPlusOne != 0u) {
+        slotIndex = (slotIndex + 1u) & mask;
+    }
+    slots[slotIndex].hash = hash;
+    slots[slotIndex].entryIndexPlusOne = entryIndex + 1u;
+}
+
+static ZR_FORCE_INLINE TZrSize zr_container_hash_index_capacity_for(TZrSize entryCount) {
+    TZrSize capacity = ZR_CONTAINER_HASH_INDEX_INITIAL_CAPACITY;
+
+    while (capacity < (ZR_MAX_SIZE / 2u) &&
+           entryCount * 100u >= capacity * ZR_CONTAINER_HASH_INDEX_MAX_LOAD_PERCENT) {
+        capacity *= 2u;
+    }
+    return capacity;
+}
+
+static TZrBool zr_container_hash_index_resize(SZrState *state, SZrObject *entries, TZrSize newCapacity) {
+    SZrObjectHashIndexSlot *newSlots;
+    TZrSize newMask;
+
+    if (state == ZR_NULL || state->global == ZR_NULL || entries == ZR_NULL || newCapacity == 0u ||
+        newCapacity > (ZR_MAX_SIZE / sizeof(SZrObjectHashIndexSlot))) {
         return ZR_FALSE;
     }
 
-    if (key->type == ZR_VALUE_TYPE_STRING && key->value.object != ZR_NULL) {
-        SZrRawObject *wantedRawObject = key->value.object;
-        SZrString *wantedString = ZR_NULL;
-
-        {
-            ZrContainerHotMapLookupCache *cache = zr_container_hot_map_lookup_cache(state);
-
-            if (zr_container_try_hot_map_lookup_cache(state,
-                                                      cache,
-                                                      entries,
-                                                      wantedRawObject,
-                                                      outIndex,
-                                                      outEntryObject)) {
-                return ZR_TRUE;
-            }
+    newSlots = (SZrObjectHashIndexSlot *)ZrCore_Memory_RawMallocWithType(state->global,
+                                                                         newCapacity * sizeof(SZrObjectHashIndexSlot),
+                                                                         ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+    if (newSlots == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    memset(newSlots, 0, newCapacity * sizeof(SZrObjectHashIndexSlot));
+
+    newMask = newCapacity - 1u;
+    for (TZrSize slotIndex = 0; slotIndex < entries->hashIndexCapacity; slotIndex++) {
+        const SZrObjectHashIndexSlot *slot = &entries->hashIndexSlots[slotIndex];
+
+        if (slot->entryIndexPlusOne != 0u) {
+            zr_container_hash_index_insert_slot(newSlots, newMask, slot->hash, slot->entryIndexPlusOne - 1u);
         }
+    }
 
-        wantedHash = wantedRawObject->hash;
-        wantedString = ZR_CAST_STRING(state, wantedRawObject);
-        if (wantedString == ZR_NULL) {
-            return ZR_FALSE;
+    if (entries->hashIndexSlots != ZR_NULL && entries->hashIndexCapacity > 0) {
+        ZrCore_Memory_RawFreeWithType(state->global,
+                                      entries->hashIndexSlots,
+                                      entries->hashIndexCapacity * sizeof(SZrObjectHashIndexSlot),
+                                      ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+    }
+    entries->hashIndexSlots = newSlots;
+    entries->hashIndexCapacity = newCapacity;
+    return ZR_TRUE;
+}
+
+static ZR_FORCE_INLINE const SZrTypeValue *zr_container_hash_index_entry_key(SZrState *state,
+                                                                             SZrObject *entries,
+                                                                             TZrBool mapEntries,
+                                                                             TZrSize index,
+                                                                             SZrTypeValue *scratch) {
+    if (mapEntries) {
+        SZrObject *entryObject = zr_container_array_get_object_fast(state, entries, index);
+
+        return entryObject != ZR_NULL ? zr_container_map_entry_get_first_value_fast(state, entryObject) : ZR_NULL;
+    }
+
+    if (zr_container_array_raw_int_active(entries)) {
+        if (index >= entries->superArrayRawIntLength) {
+            return ZR_NULL;
         }
+        ZR_VALUE_FAST_SET(scratch, nativeInt64, entries->superArrayRawIntData[index], ZR_VALUE_TYPE_INT64);
+        return scratch;
+    }
 
-        length = zr_container_array_length_fast(entries);
-        for (TZrSize index = 0; index < length; index++) {
-            const SZrTypeValue *entryKey;
-            SZrObject *entryObject = zr_container_array_get_object_fast(state, entries, index);
+    return zr_container_array_get_value_fast(state, entries, index);
+}
 
-            if (entryObject == ZR_NULL) {
-                continue;
-            }
+static ZR_FORCE_INLINE TZrBool zr_container_hash_index_keys_equal(SZrState *state,
+                                                                  TZrBool mapEntries,
+                                                                  const SZrTypeValue *entryKey,
+                                                                  const SZrTypeValue *key) {
+    if (entryKey == ZR_NULL || key == ZR_NULL) {
+        return ZR_FALSE;
+    }
 
-            entryKey = zr_container_map_entry_get_first_value_fast(state, entryObject);
-            if (entryKey == ZR_NULL || entryKey->type != ZR_VALUE_TYPE_STRING || entryKey->value.object == ZR_NULL) {
-                continue;
-            }
-            if (entryKey->value.object == wantedRawObject) {
-                if (outIndex != ZR_NULL) {
-                    *outIndex = index;
-                }
-                if (outEntryObject != ZR_NULL) {
-                    *outEntryObject = entryObject;
-                }
-                zr_container_update_hot_map_lookup_cache(state,
-                                                         entries,
-                                                         wantedRawObject,
-                                                         index,
-                                                         entryObject);
-                return ZR_TRUE;
-            }
-            if (entryKey->value.object->hash != wantedHash) {
-                continue;
-            }
+    if (key->type == ZR_VALUE_TYPE_STRING) {
+        SZrString *entryString;
+        SZrString *wantedString;
+
+        if (entryKey->type != ZR_VALUE_TYPE_STRING || entryKey->value.object == ZR_NULL || key->value.object == ZR_NULL) {
+            return ZR_FALSE;
+        }
+        if (entryKey->value.object == key->value.object) {
+            return ZR_TRUE;
+        }
 
-            {
-                SZrString *entryString = ZR_CAST_STRING(state, entryKey->value.object);
+        // short strings are interned, so only two distinct long strings can still compare equal
+        entryString = ZR_CAST_STRING(state, entryKey->value.object);
+        wantedString = ZR_CAST_STRING(state, key->value.object);
+        return entryString != ZR_NULL && wantedString != ZR_NULL &&
+               !ZrCore_String_IsShort(entryString) &&
+               !ZrCore_String_IsShort(wantedString) &&
+               ZrCore_String_Equal(entryString, wantedString);
+    }
 
-                if (entryString != ZR_NULL &&
-                    !ZrCore_String_IsShort(entryString) &&
-                    !ZrCore_String_IsShort(wantedString) &&
-                    ZrCore_String_Equal(entryString, wantedString)) {
-                    if (outIndex != ZR_NULL) {
-                        *outIndex = index;
-                    }
-                    if (outEntryObject != ZR_NULL) {
-                        *outEntryObject = entryObject;
-                    }
-                    zr_container_update_hot_map_lookup_cache(state,
-                                                             entries,
-                                                             wantedRawObject,
-                                                             index,
-                                                             entryObject);
-                    return ZR_TRUE;
-                }
-            }
+    if (ZR_VALUE_IS_TYPE_INT(key->type)) {
+        if (ZR_VALUE_IS_TYPE_INT(entryKey->type)) {
+            return zr_container_int_values_equal_fast(entryKey, key);
+        }
+        if (!mapEntries) {
+            return ZR_FALSE;
         }
+    }
+
+    return zr_container_values_equal(state, entryKey, key);
+}
+
+static TZrBool zr_container_hash_index_build(SZrState *state, SZrObject *entries, TZrBool mapEntries) {
+    TZrSize length;
+    TZrSize liveCount = 0;
+    TZrSize capacity;
+    TZrSize mask;
+    SZrTypeValue scratch;
 
-        zr_container_update_hot_map_lookup_cache(state, entries, wantedRawObject, 0u, ZR_NULL);
+    if (state == ZR_NULL || entries == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    wantedHash = zr_container_value_hash(state, key);
     length = zr_container_array_length_fast(entries);
+    capacity = zr_container_hash_index_capacity_for(zr_container_entries_live_count(entries));
+    if (entries->hashIndexSlots == ZR_NULL || entries->hashIndexCapacity < capacity) {
+        zr_container_hash_index_release(state, entries);
+        if (!zr_container_hash_index_resize(state, entries, capacity)) {
+            return ZR_FALSE;
+        }
+    } else {
+        zr_container_hash_index_reset(entries);
+    }
+
+    mask = entries->hashIndexCapacity - 1u;
     for (TZrSize index = 0; index < length; index++) {
         const SZrTypeValue *entryKey;
-        SZrObject *entryObject = zr_container_array_get_object_fast(state, entries, index);
+        TZrUInt64 entryHash;
 
-        if (entryObject == ZR_NULL) {
+        if (zr_container_entries_is_tombstone(entries, index)) {
             continue;
         }
+        entryKey = zr_container_hash_index_entry_key(state, entries, mapEntries, index, &scratch);
+        entryHash = entryKey != ZR_NULL ? zr_container_value_hash(state, entryKey) : 0u;
+        if (state->threadStatus != ZR_THREAD_STATUS_FINE || entries->hashIndexSlots == ZR_NULL) {
+            zr_container_hash_index_release(state, entries);
+            return ZR_FALSE;
+        }
+        zr_container_hash_index_insert_slot(entries->hashIndexSlots, mask, entryHash, index);
+        liveCount++;
+    }
+    entries->hashIndexCount = liveCount;
+    return ZR_TRUE;
+}
 
-        entryKey = zr_container_map_entry_get_first_value_fast(state, entryObject);
-        if (entryKey != ZR_NULL && zr_container_value_hash(state, entryKey) == wantedHash &&
-            zr_container_values_equal(state, entryKey, key)) {
-            if (outIndex != ZR_NULL) {
-                *outIndex = index;
-            }
-            if (outEntryObject != ZR_NULL) {
-                *outEntryObject = entryObject;
+static TZrBool zr_container_hash_index_lookup(SZrState *state,
+                                              SZrObject *entries,
+                                              TZrBool mapEntries,
+                                              const SZrTypeValue *key,
+                                              TZrUInt64 hash,
+                                              TZrSize *outIndex) {
+    TZrSize mask = entries->hashIndexCapacity - 1u;
+    TZrSize slotIndex = zr_container_hash_index_home_slot(hash, mask);
+    SZrTypeValue scratch;
+
+    for (;;) {
+        const SZrObjectHashIndexSlot *slot = &entries->hashIndexSlots[slotIndex];
+
+        if (slot->entryIndexPlusOne == 0u) {
+            return ZR_FALSE;
+        }
+        if (slot->hash == hash) {
+            TZrSize entryIndex = slot->entryIndexPlusOne - 1u;
+            const SZrTypeValue *entryKey =
+                    zr_container_hash_index_entry_key(state, entries, mapEntries, entryIndex, &scratch);
+
+            if (zr_container_hash_index_keys_equal(state, mapEntries, entryKey, key)) {
+                *outIndex = entryIndex;
+                return ZR_TRUE;
             }
-            return ZR_TRUE;
         }
+        slotIndex = (slotIndex + 1u) & mask;
     }
+}
 
-    return ZR_FALSE;
+static void zr_container_hash_index_append(SZrState *state, SZrObject *entries, TZrUInt64 hash, TZrSize entryIndex) {
+    if (entries == ZR_NULL || entries->hashIndexSlots == ZR_NULL) {
+        return;
+    }
+
+    // the index is only extended when it described every entry before this push
+    if (entries->hashIndexCount + entries->hashIndexTombstoneCount != entryIndex ||
+        zr_container_array_length_fast(entries) != entryIndex + 1u) {
+        zr_container_hash_index_release(state, entries);
+        return;
+    }
+
+    if ((entries->hashIndexCount + 1u) * 100u >= entries->hashIndexCapacity * ZR_CONTAINER_HASH_INDEX_MAX_LOAD_PERCENT &&
+        !zr_container_hash_index_resize(state, entries, entries->hashIndexCapacity * 2u)) {
+        zr_container_hash_index_release(state, entries);
+        return;
+    }
+
+    zr_container_hash_index_insert_slot(entries->hashIndexSlots, entries->hashIndexCapacity - 1u, hash, entryIndex);
+    entries->hashIndexCount++;
 }
 
-static ZR_FORCE_INLINE SZrObject *zr_container_map_find_entry_object_fast(SZrState *state,
-                                                                          SZrObject *entries,
-                                                                          const SZrTypeValue *key) {
-    TZrUInt64 wantedHash;
-    TZrSize length;
+static TZrBool zr_container_hash_index_find_slot(const SZrObject *entries,
+                                                 TZrUInt64 hash,
+                                                 TZrSize entryIndex,
+                                                 TZrSize *outSlot) {
+    TZrSize mask = entries->hashIndexCapacity - 1u;
+    TZrSize slotIndex = zr_container_hash_index_home_slot(hash, mask);
 
-    if (state == ZR_NULL || entries == ZR_NULL || key == ZR_NULL) {
-        return ZR_NULL;
+    while (entries->hashIndexSlots[slotIndex].entryIndexPlusOne != entryIndex + 1u) {
+        if (entries->hashIndexSlots[slotIndex].entryIndexPlusOne == 0u) {
+            return ZR_FALSE;
+        }
+        slotIndex = (slotIndex + 1u) & mask;
     }
+    *outSlot = slotIndex;
+    return ZR_TRUE;
+}
 
-    if (key->type == ZR_VALUE_TYPE_STRING && key->value.object != ZR_NULL) {
-        SZrRawObject *wantedRawObject = key->value.object;
-        SZrString *wantedString = ZR_NULL;
-        SZrObject *entryObject = ZR_NULL;
+static void zr_container_hash_index_remove(SZrState *state, SZrObject *entries, TZrUInt64 hash, TZrSize entryIndex) {
+    SZrObjectHashIndexSlot *slots;
+    TZrSize mask;
+    TZrSize hole;
+    TZrSize probe;
 
-        {
-            ZrContainerHotMapLookupCache *cache = zr_container_hot_map_lookup_cache(state);
+    if (entries == ZR_NULL || entries->hashIndexSlots == ZR_NULL) {
+        return;
+    }
+    if (!zr_container_hash_index_is_current(entries) ||
+        !zr_container_hash_index_find_slot(entries, hash, entryIndex, &hole)) {
+        zr_container_hash_index_release(state, entries);
+        return;
+    }
 
-            entryObject = zr_container_try_hot_map_lookup_cache_entry(cache, entries, wantedRawObject);
-            if (entryObject != ZR_NULL) {
-                return entryObject;
-            }
+    // backward-shift deletion keeps linear probe chains intact without index-side tombstones
+    slots = entries->hashIndexSlots;
+    mask = entries->hashIndexCapacity - 1u;
+    probe = hole;
+    for (;;) {
+        TZrSize home;
+
+        probe = (probe + 1u) & mask;
+        if (slots[probe].entryIndexPlusOne == 0u) {
+            break;
+        }
+        home = zr_container_hash_index_home_slot(slots[probe].hash, mask);
+        if (((probe - home) & mask) >= ((probe - hole) & mask)) {
+            slots[hole] = slots[probe];
+            hole = probe;
         }
+    }
+    slots[hole].hash = 0u;
+    slots[hole].entryIndexPlusOne = 0u;
+    entries->hashIndexCount--;
+}
 
-        wantedHash = wantedRawObject->hash;
-        wantedString = ZR_CAST_STRING(state, wantedRawObject);
-        if (wantedString == ZR_NULL) {
-            return ZR_NULL;
+static TZrBool zr_container_entries_compact_raw_int_fast(SZrObject *entries, TZrSize *remap) {
+    SZrHashSet *nodeMap = &entries->nodeMap;
+    TZrSize length = entries->superArrayRawIntLength;
+    TZrSize write = 0;
+
+    if (!zr_container_array_raw_int_active(entries) || nodeMap->elementCount != length || !nodeMap->isValid ||
+        nodeMap->buckets == ZR_NULL || length > nodeMap->capacity) {
+        return ZR_FALSE;
+    }
+    for (TZrSize cursor = 0; cursor < length; cursor++) {
+        if (zr_container_array_dense_int_pair_at(entries, cursor) == ZR_NULL) {
+            return ZR_FALSE;
         }
+    }
 
-        length = zr_container_array_length_fast(entries);
-        for (TZrSize index = 0; index < length; index++) {
-            const SZrTypeValue *entryKey;
+    for (TZrSize read = 0; read < length; read++) {
+        if (zr_container_entries_is_tombstone(entries, read)) {
+            continue;
+        }
+        if (remap != ZR_NULL) {
+            remap[read] = write;
+        }
+        entries->superArrayRawIntData[write] = entries->superArrayRawIntData[read];
+        if (!entries->superArrayRawIntDirty) {
+            zr_container_array_store_dense_int_pair_value(nodeMap->buckets[write], entries->superArrayRawIntData[write]);
+        }
+        write++;
+    }
+    for (TZrSize cursor = write; cursor < length; cursor++) {
+        nodeMap->buckets[cursor] = ZR_NULL;
+    }
+    nodeMap->elementCount = write;
+    entries->superArrayRawIntLength = write;
+    return ZR_TRUE;
+}
 
-            entryObject = zr_container_array_get_object_fast(state, entries, index);
-            if (entryObject == ZR_NULL) {
-                continue;
-            }
+static TZrBool zr_container_entries_compact_generic(SZrState *state, SZrObject *entries, TZrSize *remap) {
+    TZrSize length = zr_container_array_length_fast(entries);
+    TZrSize write = 0;
 
-            entryKey = zr_container_map_entry_get_first_value_fast(state, entryObject);
-            if (entryKey == ZR_NULL || entryKey->type != ZR_VALUE_TYPE_STRING || entryKey->value.object == ZR_NULL) {
-                continue;
-            }
-            if (entryKey->value.object == wantedRawObject) {
-                zr_container_update_hot_map_lookup_cache(state, entries, wantedRawObject, index, entryObject);
-                return entryObject;
-            }
-            if (entryKey->value.object->hash != wantedHash) {
-                continue;
-            }
+    if (zr_container_array_raw_int_active(entries) && entries->superArrayRawIntDirty &&
+        !zr_container_storage_sync_raw_int_pairs_fast(entries)) {
+        return ZR_FALSE;
+    }
 
-            {
-                SZrString *entryString = ZR_CAST_STRING(state, entryKey->value.object);
+    for (TZrSize read = 0; read < length; read++) {
+        if (zr_container_entries_is_tombstone(entries, read)) {
+            continue;
+        }
+        if (remap != ZR_NULL) {
+            remap[read] = write;
+        }
+        if (write != read) {
+            const SZrTypeValue *source = zr_container_array_get_value_fast(state, entries, read);
+            SZrTypeValue moved;
 
-                if (entryString != ZR_NULL &&
-                    !ZrCore_String_IsShort(entryString) &&
-                    !ZrCore_String_IsShort(wantedString) &&
-                    ZrCore_String_Equal(entryString, wantedString)) {
-                    zr_container_update_hot_map_lookup_cache(state, entries, wantedRawObject, index, entryObject);
-                    return entryObject;
-                }
+            if (source == ZR_NULL) {
+                return ZR_FALSE;
+            }
+            moved = *source;
+            if (!zr_container_storage_set(state, entries, write, &moved)) {
+                return ZR_FALSE;
             }
         }
+        write++;
+    }
+    while (zr_container_array_length_fast(entries) > write) {
+        if (!zr_container_storage_remove_last(state, entries)) {
+            return ZR_FALSE;
+        }
+    }
+    return ZR_TRUE;
+}
 
-        return ZR_NULL;
+/*
+ * Shifts the live entries down over the tombstones in one stable pass and renumbers the index slots
+ * through an old-to-new position map, so no key is rehashed. Removal only calls this once the
+ * tombstones outnumber the live entries, which keeps Map.remove/Set.remove amortized O(1).
+ */
+static TZrBool zr_container_entries_compact(SZrState *state, SZrObject *entries) {
+    TZrSize length;
+    TZrSize *remap = ZR_NULL;
+    TZrBool compacted;
+
+    if (state == ZR_NULL || entries == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    if (entries->hashIndexTombstoneCount == 0u) {
+        return ZR_TRUE;
     }
 
-    wantedHash = zr_container_value_hash(state, key);
     length = zr_container_array_length_fast(entries);
-    for (TZrSize index = 0; index < length; index++) {
-        const SZrTypeValue *entryKey;
-        SZrObject *entryObject = zr_container_array_get_object_fast(state, entries, index);
+    if (zr_container_hash_index_is_current(entries)) {
+        remap = (TZrSize *)ZrCore_Memory_RawMallocWithType(state->global,
+                                                           length * sizeof(TZrSize),
+                                                           ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
+    }
+    if (remap == ZR_NULL) {
+        // the index is rebuilt from the compacted storage on the next lookup
+        zr_container_hash_index_release(state, entries);
+    }
 
-        if (entryObject == ZR_NULL) {
-            continue;
-        }
+    compacted = zr_container_entries_compact_raw_int_fast(entries, remap) ||
+                zr_container_entries_compact_generic(state, entries, remap);
+    if (compacted && remap != ZR_NULL) {
+        for (TZrSize slotIndex = 0; slotIndex < entries->hashIndexCapacity; slotIndex++) {
+            SZrObjectHashIndexSlot *slot = &entries->hashIndexSlots[slotIndex];
 
-        entryKey = zr_container_map_entry_get_first_value_fast(state, entryObject);
-        if (entryKey != ZR_NULL && zr_container_value_hash(state, entryKey) == wantedHash &&
-            zr_container_values_equal(state, entryKey, key)) {
-            return entryObject;
+            if (slot->entryIndexPlusOne != 0u) {
+                slot->entryIndexPlusOne = remap[slot->entryIndexPlusOne - 1u] + 1u;
+            }
         }
+    } else if (!compacted) {
+        zr_container_hash_index_release(state, entries);
+    }
+    if (remap != ZR_NULL) {
+        ZrCore_Memory_RawFreeWithType(state->global, remap, length * sizeof(TZrSize), ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET);
     }
 
-    return ZR_NULL;
+    zr_container_entries_reset_tombstones(entries);
+    entries->memberVersion++;
+    return compacted;
 }
 
-static TZrBool zr_container_set_find_index(SZrState *state,
-                                           SZrObject *entries,
-                                           const SZrTypeValue *value,
-                                           TZrSize *outIndex) {
+static TZrBool zr_container_entries_remove(SZrState *state, SZrObject *entries, TZrUInt64 hash, TZrSize index) {
+    TZrSize tombstoneCount;
+
+    zr_container_hash_index_remove(state, entries, hash, index);
+    if (!zr_container_entries_mark_tombstone(state, entries, index)) {
+        // the entry stays live; a rebuilt index picks it up again
+        zr_container_hash_index_release(state, entries);
+        return ZR_FALSE;
+    }
+
+    tombstoneCount = entries->hashIndexTombstoneCount;
+    if (tombstoneCount >= ZR_CONTAINER_ENTRIES_COMPACT_MIN_TOMBSTONES &&
+        tombstoneCount >= zr_container_entries_live_count(entries)) {
+        return zr_container_entries_compact(state, entries);
+    }
+    return ZR_TRUE;
+}
+
+static TZrBool zr_container_hashed_find_index(SZrState *state,
+                                              SZrObject *entries,
+                                              TZrBool mapEntries,
+                                              const SZrTypeValue *key,
+                                              TZrSize *outIndex) {
     TZrUInt64 wantedHash;
     TZrSize length;
+    TZrSize foundIndex = 0;
+    SZrTypeValue scratch;
 
     if (outIndex != ZR_NULL) {
         *outIndex = 0;
     }
-    if (state == ZR_NULL || entries == ZR_NULL || value == ZR_NULL) {
+    if (state == ZR_NULL || entries == ZR_NULL || key == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    length = zr_container_array_length_fast(entries);
-    if (ZR_VALUE_IS_TYPE_INT(value->type)) {
-        if (zr_container_array_raw_int_active(entries)) {
-            TZrInt64 signedNeedle;
+    wantedHash = zr_container_value_hash(state, key);
 
-            if (zr_container_try_read_int64_needle_fast(value, &signedNeedle)) {
-                for (TZrSize index = 0; index < length; index++) {
-                    if (entries->superArrayRawIntData[index] == signedNeedle) {
-                        if (outIndex != ZR_NULL) {
-                            *outIndex = index;
-                        }
-                        return ZR_TRUE;
-                    }
-                }
-            }
+    length = zr_container_array_length_fast(entries);
+    if (length >= ZR_CONTAINER_HASH_INDEX_MIN_ENTRY_COUNT &&
+        (zr_container_hash_index_is_current(entries) || zr_container_hash_index_build(state, entries, mapEntries))) {
+        if (!zr_container_hash_index_lookup(state, entries, mapEntries, key, wantedHash, &foundIndex)) {
             return ZR_FALSE;
         }
-
-        for (TZrSize index = 0; index < length; index++) {
-            const SZrTypeValue *entryValue = zr_container_array_get_value_fast(state, entries, index);
-
-            if (zr_container_int_values_equal_fast(entryValue, value)) {
-                if (outIndex != ZR_NULL) {
-                    *outIndex = index;
-                }
-                return ZR_TRUE;
-            }
+        if (outIndex != ZR_NULL) {
+            *outIndex = foundIndex;
         }
-        return ZR_FALSE;
+        return ZR_TRUE;
     }
 
-    wantedHash = zr_container_value_hash(state, value);
     for (TZrSize index = 0; index < length; index++) {
-        const SZrTypeValue *entryValue = zr_container_array_get_value_fast(state, entries, index);
-        if (entryValue != ZR_NULL && zr_container_value_hash(state, entryValue) == wantedHash &&
-            zr_container_values_equal(state, entryValue, value)) {
+        const SZrTypeValue *entryKey;
+
+        if (zr_container_entries_is_tombstone(entries, index)) {
+            continue;
+        }
+        entryKey = zr_container_hash_index_entry_key(state, entries, mapEntries, index, &scratch);
+        if (entryKey != ZR_NULL && zr_container_value_hash(state, entryKey) == wantedHash &&
+            zr_container_hash_index_keys_equal(state, mapEntries, entryKey, key)) {
             if (outIndex != ZR_NULL) {
                 *outIndex = index;
             }
@@ -2652,6 +2958,83 @@ static TZrBool zr_container_set_find_index(SZrState *state,
     return ZR_FALSE;
 }
 
+static TZrBool zr_container_map_find_index(SZrState *state,
+                                           SZrObject *entries,
+                                           const SZrTypeValue *key,
+                                           TZrSize *outIndex,
+                                           SZrObject **outEntryObject) {
+    TZrSize index = 0;
+    SZrObject *entryObject = ZR_NULL;
+    ZrContainerHotMapLookupCache *cache = ZR_NULL;
+    TZrBool found;
+
+    if (outIndex != ZR_NULL) {
+        *outIndex = 0;
+    }
+    if (outEntryObject != ZR_NULL) {
+        *outEntryObject = ZR_NULL;
+    }
+    if (state == ZR_NULL || entries == ZR_NULL || key == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    if (key->type == ZR_VALUE_TYPE_STRING && key->value.object != ZR_NULL) {
+        cache = zr_container_hot_map_lookup_cache(state);
+        if (zr_container_try_hot_map_lookup_cache(state, cache, entries, key->value.object, outIndex, outEntryObject)) {
+            return ZR_TRUE;
+        }
+    }
+
+    found = zr_container_hashed_find_index(state, entries, ZR_TRUE, key, &index);
+    if (found) {
+        entryObject = zr_container_array_get_object_fast(state, entries, index);
+        if (outIndex != ZR_NULL) {
+            *outIndex = index;
+        }
+        if (outEntryObject != ZR_NULL) {
+            *outEntryObject = entryObject;
+        }
+    }
+
+    if (cache != ZR_NULL) {
+        zr_container_update_hot_map_lookup_cache(state,
+                                                 entries,
+                                                 key->value.object,
+                                                 found ? index : 0u,
+                                                 found ? entryObject : ZR_NULL);
+    }
+    return found;
+}
+
+static ZR_FORCE_INLINE SZrObject *zr_container_map_find_entry_object_fast(SZrState *state,
+                                                                          SZrObject *entries,
+                                                                          const SZrTypeValue *key) {
+    SZrObject *entryObject = ZR_NULL;
+
+    if (state == ZR_NULL || entries == ZR_NULL || key == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    if (key->type == ZR_VALUE_TYPE_STRING && key->value.object != ZR_NULL) {
+        ZrContainerHotMapLookupCache *cache = zr_container_hot_map_lookup_cache(state);
+
+        entryObject = zr_container_try_hot_map_lookup_cache_entry(cache, entries, key->value.object);
+        if (entryObject != ZR_NULL) {
+            return entryObject;
+        }
+    }
+
+    zr_container_map_find_index(state, entries, key, ZR_NULL, &entryObject);
+    return entryObject;
+}
+
+static TZrBool zr_container_set_find_index(SZrState *state,
+                                           SZrObject *entries,
+                                           const SZrTypeValue *value,
+                                           TZrSize *outIndex) {
+    return zr_container_hashed_find_index(state, entries, ZR_FALSE, value, outIndex);
+}
+
 static TZrBool zr_container_array_ensure_capacity(SZrState *state, SZrObject *arrayObject, TZrSize requiredLength) {
     TZrInt64 capacity;
 
@@ -3429,6 +3812,7 @@ static TZrBool zr_container_map_contains_key(ZrLibCallContext *context, SZrTypeV
 static TZrBool zr_container_map_remove(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *self = zr_container_self_object(context);
     SZrObject *entries;
+    const SZrTypeValue *key;
     TZrSize index;
 
     if (self == ZR_NULL || result == ZR_NULL) {
@@ -3436,8 +3820,13 @@ static TZrBool zr_container_map_remove(ZrLibCallContext *context, SZrTypeValue *
     }
 
     entries = zr_container_ensure_entries_array_fast(context->state, self);
-    if (!zr_container_map_find_index(context->state, entries, ZrLib_CallContext_Argument(context, 0), &index, ZR_NULL) ||
-        !zr_container_storage_remove_at(context->state, entries, index)) {
+    key = ZrLib_CallContext_Argument(context, 0);
+    if (!zr_container_map_find_index(context->state, entries, key, &index, ZR_NULL)) {
+        zr_container_result_set_bool_fast(result, ZR_FALSE);
+        return ZR_TRUE;
+    }
+    if (!zr_container_entries_remove(
+                context->state, entries, zr_container_value_hash(context->state, key), index)) {
         zr_container_result_set_bool_fast(result, ZR_FALSE);
         return ZR_TRUE;
     }
@@ -3445,7 +3834,7 @@ static TZrBool zr_container_map_remove(ZrLibCallContext *context, SZrTypeValue *
     if (!zr_container_set_int_field_fast(context->state,
                                          self,
                                          kContainerCountField,
-                                         (TZrInt64)zr_container_array_length_fast(entries))) {
+                                         (TZrInt64)zr_container_entries_live_count(entries))) {
         return ZR_FALSE;
     }
     zr_container_result_set_bool_fast(result, ZR_TRUE);
@@ -3483,6 +3872,10 @@ static TZrBool zr_container_map_get_iterator(ZrLibCallContext *context, SZrTypeV
     }
 
     entries = zr_container_ensure_entries_array_fast(context->state, self);
+    // iterators walk storage positions directly, so pending tombstones are squeezed out first
+    if (entries != ZR_NULL && !zr_container_entries_compact(context->state, entries)) {
+        return ZR_FALSE;
+    }
     iterator = zr_container_iterator_make(context->state,
                                           entries,
                                           ZR_VALUE_TYPE_ARRAY,
@@ -3615,6 +4008,10 @@ static ZR_FORCE_INLINE TZrBool zr_container_map_set_item_core(SZrState *state,
         if (!zr_container_storage_push(state, entries, &pairValue)) {
             return ZR_FALSE;
         }
+        zr_container_hash_index_append(state,
+                                       entries,
+                                       zr_container_value_hash(state, keyValue),
+                                       zr_container_array_length_fast(entries) - 1u);
         insertedNewEntry = ZR_TRUE;
     }
 
@@ -3622,7 +4019,7 @@ static ZR_FORCE_INLINE TZrBool zr_container_map_set_item_core(SZrState *state,
         !zr_container_set_int_field_fast(state,
                                          self,
                                          kContainerCountField,
-                                         (TZrInt64)zr_container_array_length_fast(entries))) {
+                                         (TZrInt64)zr_container_entries_live_count(entries))) {
         return ZR_FALSE;
     }
     return result == ZR_NULL ? ZR_TRUE : zr_container_result_copy_no_profile(state, result, mappedValue);
@@ -3701,11 +4098,17 @@ static TZrBool zr_container_set_add(ZrLibCallContext *context, SZrTypeValue *res
         return ZR_TRUE;
     }
 
-    if (!zr_container_storage_push(context->state, entries, value) ||
-        !zr_container_set_int_field_fast(context->state,
+    if (!zr_container_storage_push(context->state, entries, value)) {
+        return ZR_FALSE;
+    }
+    zr_container_hash_index_append(context->state,
+                                   entries,
+                                   zr_container_value_hash(context->state, value),
+                                   zr_container_array_length_fast(entries) - 1u);
+    if (!zr_container_set_int_field_fast(context->state,
                                          self,
                                          kContainerCountField,
-                                         (TZrInt64)zr_container_array_length_fast(entries))) {
+                                         (TZrInt64)zr_container_entries_live_count(entries))) {
         return ZR_FALSE;
     }
     zr_container_result_set_bool_fast(result, ZR_TRUE);
@@ -3730,6 +4133,7 @@ static TZrBool zr_container_set_contains(ZrLibCallContext *context, SZrTypeValue
 static TZrBool zr_container_set_remove(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *self = zr_container_self_object(context);
     SZrObject *entries;
+    const SZrTypeValue *value;
     TZrSize index;
 
     if (self == ZR_NULL || result == ZR_NULL) {
@@ -3737,8 +4141,13 @@ static TZrBool zr_container_set_remove(ZrLibCallContext *context, SZrTypeValue *
     }
 
     entries = zr_container_ensure_entries_array_fast(context->state, self);
-    if (!zr_container_set_find_index(context->state, entries, ZrLib_CallContext_Argument(context, 0), &index) ||
-        !zr_container_storage_remove_at(context->state, entries, index)) {
+    value = ZrLib_CallContext_Argument(context, 0);
+    if (!zr_container_set_find_index(context->state, entries, value, &index)) {
+        zr_container_result_set_bool_fast(result, ZR_FALSE);
+        return ZR_TRUE;
+    }
+    if (!zr_container_entries_remove(
+                context->state, entries, zr_container_value_hash(context->state, value), index)) {
         zr_container_result_set_bool_fast(result, ZR_FALSE);
         return ZR_TRUE;
     }
@@ -3746,7 +4155,7 @@ static TZrBool zr_container_set_remove(ZrLibCallContext *context, SZrTypeValue *
     if (!zr_container_set_int_field_fast(context->state,
                                          self,
                                          kContainerCountField,
-                                         (TZrInt64)zr_container_array_length_fast(entries))) {
+                                         (TZrInt64)zr_container_entries_live_count(entries))) {
         return ZR_FALSE;
     }
     zr_container_result_set_bool_fast(result, ZR_TRUE);
@@ -3784,6 +4193,10 @@ static TZrBool zr_container_set_get_iterator(ZrLibCallContext *context, SZrTypeV
     }
 
     entries = zr_container_ensure_entries_array_fast(context->state, self);
+    // iterators walk storage positions directly, so pending tombstones are squeezed out first
+    if (entries != ZR_NULL && !zr_container_entries_compact(context->state, entries)) {
+        return ZR_FALSE;
+    }
     iterator = zr_container_iterator_make(context->state,
                                           entries,
                                           ZR_VALUE_TYPE_ARRAY,
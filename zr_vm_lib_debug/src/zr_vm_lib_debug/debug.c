@@ -1677,6 +1677,8 @@ TZrBool ZrDebug_AgentStart(SZrState *state,
         return ZR_FALSE;
     }
 
+    // breakpoints resolve against the whole function tree, so bodies still left in a resident image are decoded now
+    ZrCore_Function_MaterializeGraph(state, entryFunction);
     agent->state = state;
     agent->entryFunction = entryFunction;
     agent->config = effectiveConfig;
@@ -814,6 +814,26 @@ static void zr_debug_read_indexed_storage_value(SZrState *state,
         return;
     }
 
+    if (storage->hashIndexTombstoneCount > 0u && storage->hashIndexTombstones != ZR_NULL) {
+        // Map/Set entries removed since the last compaction still occupy storage; show live entries only.
+        TZrSize physical;
+        TZrSize live = 0;
+
+        for (physical = 0; physical < storage->nodeMap.elementCount; physical++) {
+            TZrSize word = physical / 64u;
+            TZrBool removed = word < storage->hashIndexTombstoneWords &&
+                              ((storage->hashIndexTombstones[word] >> (physical % 64u)) & 1u) != 0u;
+
+            if (!removed) {
+                if (live == index) {
+                    break;
+                }
+                live++;
+            }
+        }
+        index = physical;
+    }
+
     ZrCore_Value_InitAsInt(state, &key, (TZrInt64)index);
     resolvedValue = ZrCore_Object_GetValue(state, storage, &key);
     if (resolvedValue != ZR_NULL) {
@@ -881,7 +901,7 @@ TZrBool zr_debug_try_resolve_indexed_storage(SZrState *state,
             *outSyntheticName = "entries";
         }
         if (outLength != ZR_NULL && outStorage != ZR_NULL && *outStorage != ZR_NULL) {
-            *outLength = (*outStorage)->nodeMap.elementCount;
+            *outLength = (*outStorage)->nodeMap.elementCount - (*outStorage)->hashIndexTombstoneCount;
         }
         return outStorage == ZR_NULL || *outStorage != ZR_NULL;
     }
@@ -21,6 +21,7 @@ TZrBool ZrFfi_Library_GetSymbol(ZrLibCallContext *context, SZrTypeValue *result)
 TZrBool ZrFfi_Library_GetVersion(ZrLibCallContext *context, SZrTypeValue *result);
 
 TZrBool ZrFfi_Symbol_Call(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrFfi_Symbol_CallBatch(ZrLibCallContext *context, SZrTypeValue *result);
 TZrBool ZrFfi_Symbol_MetaCall(ZrLibCallContext *context, SZrTypeValue *result);
 
 TZrBool ZrFfi_Callback_Close(ZrLibCallContext *context, SZrTypeValue *result);
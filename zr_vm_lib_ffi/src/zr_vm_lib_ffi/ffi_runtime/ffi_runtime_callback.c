@@ -480,6 +480,7 @@ void zr_ffi_handle_finalize(SZrState *state, SZrRawObject *rawObject) {
         case ZR_FFI_HANDLE_SYMBOL: {
             ZrFfiSymbolData *symbolData = (ZrFfiSymbolData *) handleData;
             zr_ffi_symbol_release_owner(state, object);
+            zr_ffi_call_plan_release(&symbolData->plan);
             zr_ffi_destroy_signature(symbolData->signature);
             free(symbolData->symbolName);
             free(symbolData);
@@ -62,6 +62,10 @@ typedef intptr_t ZrFfiAbiSignedSlot;
 #define ZR_FFI_HIDDEN_OWNER_FIELD "__zr_ffi_owner"
 #define ZR_FFI_HIDDEN_CALLBACK_FIELD "__zr_ffi_callback"
 
+// calls with at most this many arguments and frame words marshal on the C stack
+#define ZR_FFI_INLINE_ARGUMENT_COUNT 8U
+#define ZR_FFI_INLINE_FRAME_WORDS 32U
+
 typedef enum ZrFfiErrorCode {
     ZR_FFI_ERROR_NONE = 0,
     ZR_FFI_ERROR_LOAD,
@@ -167,6 +171,39 @@ struct ZrFfiTypeLayout {
     } as;
 };
 
+// how one argument is lowered into its frame slot; resolved once when a symbol is bound
+typedef enum ZrFfiArgumentLowering {
+    ZR_FFI_LOWERING_GENERIC = 0,
+    ZR_FFI_LOWERING_INTEGER,
+    ZR_FFI_LOWERING_FLOAT,
+    ZR_FFI_LOWERING_BOOL,
+    ZR_FFI_LOWERING_POINTER,
+    ZR_FFI_LOWERING_STRING,
+    ZR_FFI_LOWERING_CALLBACK
+} ZrFfiArgumentLowering;
+
+typedef struct ZrFfiArgumentSlot {
+    ZrFfiArgumentLowering lowering;
+    ZrFfiTypeKind kind;
+    ZrFfiTypeLayout *type;
+    TZrSize offset;
+} ZrFfiArgumentSlot;
+
+// per-signature invoker: every argument and the return value live at fixed offsets of one frame
+typedef struct ZrFfiCallPlan {
+    ZrFfiArgumentSlot *slots;
+    TZrSize argumentCount;
+    TZrSize returnOffset;
+    TZrSize frameSize;
+} ZrFfiCallPlan;
+
+typedef union ZrFfiFrameWord {
+    ZrFfiAbiUnsignedSlot slot;
+    TZrUInt64 u64;
+    double f64;
+    void *pointer;
+} ZrFfiFrameWord;
+
 typedef struct ZrFfiHandleData {
     ZrFfiHandleKind kind;
     TZrBool finalized;
@@ -185,6 +222,8 @@ typedef struct ZrFfiSymbolData {
     void *symbolAddress;
     char *symbolName;
     ZrFfiSignature *signature;
+    ZrFfiCallPlan plan;
+    ZrFfiLibraryData *library;
     TZrBool closed;
 } ZrFfiSymbolData;
 
@@ -222,11 +261,6 @@ typedef struct ZrFfiBufferData {
     TZrSize pinCount;
 } ZrFfiBufferData;
 
-typedef struct ZrFfiMarshalledValue {
-    void *argumentPointer;
-    void *ownedAllocation;
-} ZrFfiMarshalledValue;
-
 typedef struct ZrFfiCallbackInvokeArgs {
     const SZrTypeValue *callbackValue;
     SZrTypeValue *argumentValues;
@@ -302,10 +336,23 @@ void zr_ffi_symbol_release_owner(SZrState *state, SZrObject *object);
 void zr_ffi_pointer_release_owner(SZrState *state, SZrObject *object);
 void zr_ffi_handle_finalize(SZrState *state, SZrRawObject *rawObject);
 void zr_ffi_callback_trampoline(ffi_cif *cif, void *returnValue, void **arguments, void *userData);
+TZrBool zr_ffi_call_plan_init(ZrFfiCallPlan *plan, const ZrFfiSignature *signature);
+void zr_ffi_call_plan_release(ZrFfiCallPlan *plan);
+TZrBool zr_ffi_symbol_invoke_values(SZrState *state,
+                                    SZrObject *selfObject,
+                                    ZrFfiSymbolData *symbolData,
+                                    const SZrTypeValue *const *arguments,
+                                    TZrSize argumentCount,
+                                    SZrTypeValue *result);
 TZrBool zr_ffi_symbol_invoke_array(SZrState *state,
                                           SZrObject *selfObject,
                                           ZrFfiSymbolData *symbolData,
                                           SZrObject *argumentsArray,
                                           SZrTypeValue *result);
+TZrBool zr_ffi_symbol_invoke_batch(SZrState *state,
+                                   SZrObject *selfObject,
+                                   ZrFfiSymbolData *symbolData,
+                                   SZrObject *columnsArray,
+                                   SZrTypeValue *result);
 
 #endif // ZR_VM_LIB_FFI_RUNTIME_INTERNAL_H
@@ -0,0 +1,615 @@
+#include "ffi_runtime/ffi_runtime_internal.h"
+
+// "callBatch row " + 20 digits + ": " fits with room to spare
+#define ZR_FFI_BATCH_ROW_PREFIX_RESERVE 48U
+
+typedef struct ZrFfiCallFrame {
+    ZrFfiFrameWord inlineWords[ZR_FFI_INLINE_FRAME_WORDS];
+    void *inlineArguments[ZR_FFI_INLINE_ARGUMENT_COUNT];
+    SZrGcNativeCallPin inlinePins[ZR_FFI_INLINE_ARGUMENT_COUNT];
+    SZrObject *inlineCallbacks[ZR_FFI_INLINE_ARGUMENT_COUNT];
+    unsigned char *bytes;
+    void **arguments;
+    SZrGcNativeCallPin *pins;
+    SZrObject **callbacks;
+    TZrSize pinnedCount;
+    void *heapBlock;
+} ZrFfiCallFrame;
+
+static ZrFfiArgumentLowering zr_ffi_argument_lowering_for_type(const ZrFfiTypeLayout *type,
+                                                               ZrFfiTypeKind *outKind) {
+    while (type != ZR_NULL && type->kind == ZR_FFI_TYPE_ENUM) {
+        type = type->as.enumType.underlying;
+    }
+    *outKind = type != ZR_NULL ? type->kind : ZR_FFI_TYPE_VOID;
+
+    switch (*outKind) {
+        case ZR_FFI_TYPE_BOOL:
+            return ZR_FFI_LOWERING_BOOL;
+        case ZR_FFI_TYPE_I8:
+        case ZR_FFI_TYPE_U8:
+        case ZR_FFI_TYPE_I16:
+        case ZR_FFI_TYPE_U16:
+        case ZR_FFI_TYPE_I32:
+        case ZR_FFI_TYPE_U32:
+        case ZR_FFI_TYPE_I64:
+        case ZR_FFI_TYPE_U64:
+            return ZR_FFI_LOWERING_INTEGER;
+        case ZR_FFI_TYPE_F32:
+        case ZR_FFI_TYPE_F64:
+            return ZR_FFI_LOWERING_FLOAT;
+        case ZR_FFI_TYPE_POINTER:
+            return ZR_FFI_LOWERING_POINTER;
+        case ZR_FFI_TYPE_STRING:
+            return ZR_FFI_LOWERING_STRING;
+        case ZR_FFI_TYPE_FUNCTION:
+            return ZR_FFI_LOWERING_CALLBACK;
+        default:
+            return ZR_FFI_LOWERING_GENERIC;
+    }
+}
+
+TZrBool zr_ffi_call_plan_init(ZrFfiCallPlan *plan, const ZrFfiSignature *signature) {
+    TZrSize offset = 0;
+    TZrSize index;
+
+    if (plan == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    memset(plan, 0, sizeof(*plan));
+    if (signature == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    if (signature->parameterCount > 0) {
+        plan->slots = (ZrFfiArgumentSlot *) calloc(signature->parameterCount, sizeof(ZrFfiArgumentSlot));
+        if (plan->slots == ZR_NULL) {
+            return ZR_FALSE;
+        }
+    }
+    plan->argumentCount = signature->parameterCount;
+
+    for (index = 0; index < signature->parameterCount; index++) {
+        ZrFfiArgumentSlot *slot = &plan->slots[index];
+        slot->type = signature->parameters[index].type;
+        slot->lowering = zr_ffi_argument_lowering_for_type(slot->type, &slot->kind);
+        slot->offset = offset;
+        offset = zr_ffi_align_up(offset + zr_ffi_non_void_call_storage_size(slot->type), sizeof(ZrFfiFrameWord));
+    }
+
+    plan->returnOffset = offset;
+    plan->frameSize = zr_ffi_align_up(offset + zr_ffi_non_void_call_storage_size(signature->returnType),
+                                      sizeof(ZrFfiFrameWord));
+    return ZR_TRUE;
+}
+
+void zr_ffi_call_plan_release(ZrFfiCallPlan *plan) {
+    if (plan == ZR_NULL) {
+        return;
+    }
+
+    free(plan->slots);
+    memset(plan, 0, sizeof(*plan));
+}
+
+static TZrBool zr_ffi_call_frame_begin(ZrFfiCallFrame *frame, const ZrFfiCallPlan *plan) {
+    TZrSize count = plan->argumentCount;
+    TZrSize index;
+
+    frame->pinnedCount = 0;
+    frame->heapBlock = ZR_NULL;
+    if (count <= ZR_FFI_INLINE_ARGUMENT_COUNT && plan->frameSize <= sizeof(frame->inlineWords)) {
+        frame->bytes = (unsigned char *) frame->inlineWords;
+        frame->arguments = frame->inlineArguments;
+        frame->pins = frame->inlinePins;
+        frame->callbacks = frame->inlineCallbacks;
+    } else {
+        // one block: frame words, then pins, argument pointers and callback owners
+        TZrSize pinsOffset = plan->frameSize;
+        TZrSize argumentsOffset = zr_ffi_align_up(pinsOffset + count * sizeof(SZrGcNativeCallPin), sizeof(void *));
+        TZrSize callbacksOffset = argumentsOffset + count * sizeof(void *);
+
+        frame->heapBlock = malloc(callbacksOffset + count * sizeof(SZrObject *));
+        if (frame->heapBlock == ZR_NULL) {
+            return ZR_FALSE;
+        }
+        frame->bytes = (unsigned char *) frame->heapBlock;
+        frame->pins = (SZrGcNativeCallPin *) (frame->bytes + pinsOffset);
+        frame->arguments = (void **) (frame->bytes + argumentsOffset);
+        frame->callbacks = (SZrObject **) (frame->bytes + callbacksOffset);
+    }
+
+    for (index = 0; index < count; index++) {
+        frame->arguments[index] = frame->bytes + plan->slots[index].offset;
+    }
+    return ZR_TRUE;
+}
+
+static void zr_ffi_call_frame_unpin(SZrState *state, ZrFfiCallFrame *frame) {
+    while (frame->pinnedCount > 0) {
+        frame->pinnedCount--;
+        ZrCore_Gc_NativeCallUnpin(state->global, &frame->pins[frame->pinnedCount]);
+    }
+}
+
+static void zr_ffi_call_frame_end(SZrState *state, ZrFfiCallFrame *frame) {
+    zr_ffi_call_frame_unpin(state, frame);
+    free(frame->heapBlock);
+    frame->heapBlock = ZR_NULL;
+}
+
+static void zr_ffi_store_integer(ZrFfiTypeKind kind, TZrInt64 value, void *buffer) {
+    switch (kind) {
+        case ZR_FFI_TYPE_I8:
+            *(int8_t *) buffer = (int8_t) value;
+            break;
+        case ZR_FFI_TYPE_U8:
+            *(uint8_t *) buffer = (uint8_t) value;
+            break;
+        case ZR_FFI_TYPE_I16:
+            *(int16_t *) buffer = (int16_t) value;
+            break;
+        case ZR_FFI_TYPE_U16:
+            *(uint16_t *) buffer = (uint16_t) value;
+            break;
+        case ZR_FFI_TYPE_I32:
+            *(int32_t *) buffer = (int32_t) value;
+            break;
+        case ZR_FFI_TYPE_U32:
+            *(uint32_t *) buffer = (uint32_t) value;
+            break;
+        case ZR_FFI_TYPE_I64:
+            *(int64_t *) buffer = (int64_t) value;
+            break;
+        default:
+            *(uint64_t *) buffer = (uint64_t) value;
+            break;
+    }
+}
+
+// direct lowering for plain scalars, strings and Buffer/Pointer handles; anything else takes the generic path
+static TZrBool zr_ffi_lower_argument_fast(SZrState *state,
+                                          const ZrFfiArgumentSlot *slot,
+                                          const SZrTypeValue *value,
+                                          void *buffer) {
+    switch (slot->lowering) {
+        case ZR_FFI_LOWERING_INTEGER:
+            if (ZR_VALUE_IS_TYPE_SIGNED_INT(value->type)) {
+                zr_ffi_store_integer(slot->kind, value->value.nativeObject.nativeInt64, buffer);
+                return ZR_TRUE;
+            }
+            if (ZR_VALUE_IS_TYPE_UNSIGNED_INT(value->type)) {
+                zr_ffi_store_integer(slot->kind, (TZrInt64) value->value.nativeObject.nativeUInt64, buffer);
+                return ZR_TRUE;
+            }
+            return ZR_FALSE;
+        case ZR_FFI_LOWERING_FLOAT: {
+            double numericValue;
+            if (ZR_VALUE_IS_TYPE_FLOAT(value->type)) {
+                numericValue = value->value.nativeObject.nativeDouble;
+            } else if (ZR_VALUE_IS_TYPE_SIGNED_INT(value->type)) {
+                numericValue = (double) value->value.nativeObject.nativeInt64;
+            } else if (ZR_VALUE_IS_TYPE_UNSIGNED_INT(value->type)) {
+                numericValue = (double) value->value.nativeObject.nativeUInt64;
+            } else {
+                return ZR_FALSE;
+            }
+            if (slot->kind == ZR_FFI_TYPE_F32) {
+                *(float *) buffer = (float) numericValue;
+            } else {
+                *(double *) buffer = numericValue;
+            }
+            return ZR_TRUE;
+        }
+        case ZR_FFI_LOWERING_BOOL:
+            if (value->type != ZR_VALUE_TYPE_BOOL) {
+                return ZR_FALSE;
+            }
+            *(TZrBool *) buffer = value->value.nativeObject.nativeBool ? ZR_TRUE : ZR_FALSE;
+            return ZR_TRUE;
+        case ZR_FFI_LOWERING_STRING:
+            return zr_ffi_read_string_value(state, value, (const char **) buffer);
+        case ZR_FFI_LOWERING_POINTER: {
+            SZrObject *handleObject = ZR_NULL;
+            ZrFfiHandleData *handleData;
+            if (value->type == ZR_VALUE_TYPE_NULL) {
+                *(void **) buffer = ZR_NULL;
+                return ZR_TRUE;
+            }
+            if (!zr_ffi_value_is_object(value, &handleObject)) {
+                return ZR_FALSE;
+            }
+            handleData = zr_ffi_get_handle_data(state, handleObject);
+            if (handleData == ZR_NULL) {
+                return ZR_FALSE;
+            }
+            // buffers are passed by address; the bytes are never copied
+            if (handleData->kind == ZR_FFI_HANDLE_BUFFER && !((ZrFfiBufferData *) handleData)->closeRequested) {
+                *(void **) buffer = ((ZrFfiBufferData *) handleData)->bytes;
+                return ZR_TRUE;
+            }
+            if (handleData->kind == ZR_FFI_HANDLE_POINTER && !((ZrFfiPointerData *) handleData)->closed) {
+                *(void **) buffer = ((ZrFfiPointerData *) handleData)->address;
+                return ZR_TRUE;
+            }
+            return ZR_FALSE;
+        }
+        default:
+            return ZR_FALSE;
+    }
+}
+
+static TZrBool zr_ffi_call_frame_marshal(SZrState *state,
+                                         ZrFfiSymbolData *symbolData,
+                                         ZrFfiCallFrame *frame,
+                                         const SZrTypeValue *const *arguments,
+                                         ZrFfiErrorCode *outCode,
+                                         char *message,
+                                         TZrSize messageSize) {
+    const ZrFfiCallPlan *plan = &symbolData->plan;
+    TZrSize index;
+
+    memset(frame->bytes, 0, plan->frameSize);
+    for (index = 0; index < plan->argumentCount; index++) {
+        const ZrFfiArgumentSlot *slot = &plan->slots[index];
+        const SZrTypeValue *argumentValue = arguments[index];
+        void *buffer = frame->arguments[index];
+        char detail[ZR_FFI_ERROR_BUFFER_LENGTH] = {0};
+
+        frame->callbacks[index] = ZR_NULL;
+        if (argumentValue == ZR_NULL) {
+            *outCode = ZR_FFI_ERROR_MARSHAL;
+            snprintf(message, messageSize, "argument %llu is missing", (unsigned long long) (index + 1));
+            return ZR_FALSE;
+        }
+        if (!ZrCore_Gc_NativeCallPinValue(state, argumentValue, &frame->pins[index])) {
+            *outCode = ZR_FFI_ERROR_NATIVE_CALL;
+            snprintf(message, messageSize, "failed to pin argument %llu for ffi call", (unsigned long long) (index + 1));
+            return ZR_FALSE;
+        }
+        frame->pinnedCount = index + 1;
+
+        if (slot->lowering == ZR_FFI_LOWERING_CALLBACK) {
+            SZrObject *callbackObject = ZR_NULL;
+            ZrFfiCallbackData *callbackData = ZR_NULL;
+            if (!zr_ffi_value_is_object(argumentValue, &callbackObject)) {
+                *outCode = ZR_FFI_ERROR_MARSHAL;
+                snprintf(message, messageSize, "argument %llu must be a CallbackHandle",
+                         (unsigned long long) (index + 1));
+                return ZR_FALSE;
+            }
+            callbackData = (ZrFfiCallbackData *) zr_ffi_get_handle_data(state, callbackObject);
+            if (callbackData == ZR_NULL || callbackData->base.kind != ZR_FFI_HANDLE_CALLBACK || callbackData->closed) {
+                *outCode = ZR_FFI_ERROR_MARSHAL;
+                snprintf(message, messageSize, "argument %llu is not an open CallbackHandle",
+                         (unsigned long long) (index + 1));
+                return ZR_FALSE;
+            }
+            callbackData->lastError = ZR_FFI_ERROR_NONE;
+            callbackData->lastErrorMessage[0] = '\0';
+            *(void **) buffer = callbackData->codePointer;
+            frame->callbacks[index] = callbackObject;
+            continue;
+        }
+
+        if (zr_ffi_lower_argument_fast(state, slot, argumentValue, buffer)) {
+            continue;
+        }
+        if (!zr_ffi_build_scalar_argument(state, argumentValue, slot->type, buffer, detail, sizeof(detail))) {
+            *outCode = ZR_FFI_ERROR_MARSHAL;
+            snprintf(message, messageSize, "argument %llu for symbol '%s' failed to marshal: %s",
+                     (unsigned long long) (index + 1),
+                     symbolData->symbolName != ZR_NULL ? symbolData->symbolName : "<symbol>", detail);
+            return ZR_FALSE;
+        }
+    }
+    return ZR_TRUE;
+}
+
+static TZrBool zr_ffi_call_frame_invoke(SZrState *state,
+                                        ZrFfiSymbolData *symbolData,
+                                        ZrFfiCallFrame *frame,
+                                        const SZrTypeValue *const *arguments,
+                                        SZrTypeValue *result,
+                                        ZrFfiErrorCode *outCode,
+                                        char *message,
+                                        TZrSize messageSize) {
+    void *returnStorage = frame->bytes + symbolData->plan.returnOffset;
+    TZrBool succeeded = zr_ffi_call_frame_marshal(state, symbolData, frame, arguments, outCode, message, messageSize);
+    TZrSize index;
+
+    if (succeeded) {
+        char detail[ZR_FFI_ERROR_BUFFER_LENGTH] = {0};
+        if (!zr_ffi_invoke_native_symbol(symbolData, returnStorage, frame->arguments, detail, sizeof(detail))) {
+            *outCode = ZR_FFI_ERROR_NATIVE_CALL;
+            snprintf(message, messageSize, "%s", detail[0] != '\0' ? detail : "ffi native call failed");
+            succeeded = ZR_FALSE;
+        }
+    }
+    for (index = 0; succeeded && index < symbolData->plan.argumentCount; index++) {
+        ZrFfiCallbackData *callbackData;
+        if (frame->callbacks[index] == ZR_NULL) {
+            continue;
+        }
+        callbackData = (ZrFfiCallbackData *) zr_ffi_get_handle_data(state, frame->callbacks[index]);
+        if (callbackData != ZR_NULL && callbackData->lastError != ZR_FFI_ERROR_NONE) {
+            *outCode = callbackData->lastError;
+            snprintf(message, messageSize, "%s",
+                     callbackData->lastErrorMessage[0] != '\0' ? callbackData->lastErrorMessage
+                                                               : "ffi callback failed");
+            succeeded = ZR_FALSE;
+        }
+    }
+    if (succeeded && !zr_ffi_set_result_from_scalar(state, symbolData->signature->returnType, returnStorage, result)) {
+        *outCode = ZR_FFI_ERROR_MARSHAL;
+        snprintf(message, messageSize, "failed to marshal return value from symbol '%s'",
+                 symbolData->symbolName != ZR_NULL ? symbolData->symbolName : "<symbol>");
+        succeeded = ZR_FALSE;
+    }
+    zr_ffi_call_frame_unpin(state, frame);
+    return succeeded;
+}
+
+static TZrBool zr_ffi_symbol_check_callable(SZrState *state,
+                                            SZrObject *selfObject,
+                                            ZrFfiSymbolData *symbolData,
+                                            TZrSize argumentCount) {
+    ZrFfiLibraryData *libraryData;
+
+    if (selfObject == ZR_NULL || symbolData == ZR_NULL) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "symbol invoke requires a valid SymbolHandle");
+        return ZR_FALSE;
+    }
+    if (symbolData->base.kind != ZR_FFI_HANDLE_SYMBOL) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "symbol handle has unexpected internal kind");
+        return ZR_FALSE;
+    }
+    if (symbolData->closed) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "symbol handle is closed");
+        return ZR_FALSE;
+    }
+    libraryData = symbolData->library;
+    if (libraryData == ZR_NULL) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "symbol handle has no owning LibraryHandle");
+        return ZR_FALSE;
+    }
+    if (libraryData->closeRequested || libraryData->libraryHandle == ZR_NULL) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_LOAD, "owning library handle is closed");
+        return ZR_FALSE;
+    }
+    if (symbolData->signature == ZR_NULL || argumentCount != symbolData->signature->parameterCount) {
+        zr_ffi_raise_error(
+                state, ZR_FFI_ERROR_MARSHAL, "symbol '%s' expected %llu arguments but got %llu",
+                symbolData->symbolName != ZR_NULL ? symbolData->symbolName : "<symbol>",
+                (unsigned long long) (symbolData->signature != ZR_NULL ? symbolData->signature->parameterCount : 0),
+                (unsigned long long) argumentCount);
+        return ZR_FALSE;
+    }
+#if !ZR_VM_HAS_LIBFFI
+    zr_ffi_raise_error(state, ZR_FFI_ERROR_ABI_MISMATCH, "this build does not include libffi");
+    return ZR_FALSE;
+#else
+    return ZR_TRUE;
+#endif
+}
+
+TZrBool zr_ffi_symbol_invoke_values(SZrState *state,
+                                    SZrObject *selfObject,
+                                    ZrFfiSymbolData *symbolData,
+                                    const SZrTypeValue *const *arguments,
+                                    TZrSize argumentCount,
+                                    SZrTypeValue *result) {
+    ZrFfiCallFrame frame;
+    SZrGcNativeCallPin selfPin = {0};
+    ZrFfiErrorCode errorCode = ZR_FFI_ERROR_NONE;
+    char message[ZR_FFI_DIAGNOSTIC_BUFFER_LENGTH] = {0};
+    TZrBool succeeded;
+
+    if (!zr_ffi_symbol_check_callable(state, selfObject, symbolData, argumentCount)) {
+        return ZR_FALSE;
+    }
+    if (!zr_ffi_call_frame_begin(&frame, &symbolData->plan)) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "out of memory while preparing ffi arguments");
+        return ZR_FALSE;
+    }
+    if (!ZrCore_Gc_NativeCallPinObject(state, ZR_CAST_RAW_OBJECT_AS_SUPER(selfObject), &selfPin)) {
+        zr_ffi_call_frame_end(state, &frame);
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "failed to pin symbol handle for ffi call");
+        return ZR_FALSE;
+    }
+
+    succeeded = zr_ffi_call_frame_invoke(state, symbolData, &frame, arguments, result, &errorCode, message,
+                                         sizeof(message));
+    ZrCore_Gc_NativeCallUnpin(state->global, &selfPin);
+    zr_ffi_call_frame_end(state, &frame);
+    if (!succeeded) {
+        zr_ffi_raise_error(state, errorCode, "%s", message);
+    }
+    return succeeded;
+}
+
+TZrBool zr_ffi_symbol_invoke_array(SZrState *state,
+                                          SZrObject *selfObject,
+                                          ZrFfiSymbolData *symbolData,
+                                          SZrObject *argumentsArray,
+                                          SZrTypeValue *result) {
+    const SZrTypeValue *inlineArguments[ZR_FFI_INLINE_ARGUMENT_COUNT];
+    const SZrTypeValue **arguments = inlineArguments;
+    TZrSize argumentCount;
+    TZrSize index;
+    TZrBool succeeded;
+
+    if (argumentsArray == ZR_NULL) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "symbol invoke requires an arguments array");
+        return ZR_FALSE;
+    }
+    argumentCount = zr_ffi_array_length(state, argumentsArray);
+    if (!zr_ffi_symbol_check_callable(state, selfObject, symbolData, argumentCount)) {
+        return ZR_FALSE;
+    }
+    if (argumentCount > ZR_FFI_INLINE_ARGUMENT_COUNT) {
+        arguments = (const SZrTypeValue **) malloc(argumentCount * sizeof(const SZrTypeValue *));
+        if (arguments == ZR_NULL) {
+            zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "out of memory while preparing ffi arguments");
+            return ZR_FALSE;
+        }
+    }
+    for (index = 0; index < argumentCount; index++) {
+        arguments[index] = zr_ffi_array_get(state, argumentsArray, index);
+    }
+
+    succeeded = zr_ffi_symbol_invoke_values(state, selfObject, symbolData, arguments, argumentCount, result);
+    if (arguments != inlineArguments) {
+        free(arguments);
+    }
+    return succeeded;
+}
+
+TZrBool zr_ffi_symbol_invoke_batch(SZrState *state,
+                                   SZrObject *selfObject,
+                                   ZrFfiSymbolData *symbolData,
+                                   SZrObject *columnsArray,
+                                   SZrTypeValue *result) {
+    SZrObject *inlineColumns[ZR_FFI_INLINE_ARGUMENT_COUNT];
+    const SZrTypeValue *inlineRow[ZR_FFI_INLINE_ARGUMENT_COUNT];
+    SZrObject **columns = inlineColumns;
+    const SZrTypeValue **rowArguments = inlineRow;
+    ZrFfiCallFrame frame;
+    SZrGcNativeCallPin selfPin = {0};
+    ZrLibTempValueRoot resultsRoot;
+    SZrObject *resultsArray = ZR_NULL;
+    ZrFfiErrorCode errorCode = ZR_FFI_ERROR_NONE;
+    char message[ZR_FFI_DIAGNOSTIC_BUFFER_LENGTH] = {0};
+    TZrSize columnCount;
+    TZrSize rowCount = 0;
+    TZrSize row = 0;
+    TZrSize index;
+    TZrBool hasColumn = ZR_FALSE;
+    TZrBool frameReady = ZR_FALSE;
+    TZrBool rootReady = ZR_FALSE;
+    TZrBool succeeded = ZR_FALSE;
+
+    if (columnsArray == ZR_NULL) {
+        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "callBatch requires an array of argument columns");
+        return ZR_FALSE;
+    }
+    columnCount = zr_ffi_array_length(state, columnsArray);
+    if (!zr_ffi_symbol_check_callable(state, selfObject, symbolData, columnCount)) {
+        return ZR_FALSE;
+    }
+    if (columnCount > ZR_FFI_INLINE_ARGUMENT_COUNT) {
+        columns = (SZrObject **) malloc(columnCount * sizeof(SZrObject *));
+        rowArguments = (const SZrTypeValue **) malloc(columnCount * sizeof(const SZrTypeValue *));
+        if (columns == ZR_NULL || rowArguments == ZR_NULL) {
+            errorCode = ZR_FFI_ERROR_MARSHAL;
+            snprintf(message, sizeof(message), "out of memory while preparing ffi batch columns");
+            goto cleanup;
+        }
+    }
+
+    // array columns supply one value per row; any other value is passed unchanged to every row
+    for (index = 0; index < columnCount; index++) {
+        const SZrTypeValue *columnValue = zr_ffi_array_get(state, columnsArray, index);
+        columns[index] = ZR_NULL;
+        rowArguments[index] = columnValue;
+        if (columnValue != ZR_NULL && columnValue->type == ZR_VALUE_TYPE_ARRAY && columnValue->value.object != ZR_NULL) {
+            SZrObject *columnArray = ZR_CAST_OBJECT(state, columnValue->value.object);
+            TZrSize columnLength = zr_ffi_array_length(state, columnArray);
+            if (hasColumn && columnLength != rowCount) {
+                errorCode = ZR_FFI_ERROR_MARSHAL;
+                snprintf(message, sizeof(message), "callBatch column %llu has %llu rows but expected %llu",
+                         (unsigned long long) (index + 1), (unsigned long long) columnLength,
+                         (unsigned long long) rowCount);
+                goto cleanup;
+            }
+            rowCount = columnLength;
+            hasColumn = ZR_TRUE;
+            columns[index] = columnArray;
+        }
+    }
+    if (!hasColumn) {
+        errorCode = ZR_FFI_ERROR_MARSHAL;
+        snprintf(message, sizeof(message), "callBatch requires at least one array column");
+        goto cleanup;
+    }
+
+    if (!zr_ffi_call_frame_begin(&frame, &symbolData->plan)) {
+        errorCode = ZR_FFI_ERROR_MARSHAL;
+        snprintf(message, sizeof(message), "out of memory while preparing ffi arguments");
+        goto cleanup;
+    }
+    frameReady = ZR_TRUE;
+    if (!ZrCore_Gc_NativeCallPinObject(state, ZR_CAST_RAW_OBJECT_AS_SUPER(selfObject), &selfPin)) {
+        errorCode = ZR_FFI_ERROR_NATIVE_CALL;
+        snprintf(message, sizeof(message), "failed to pin symbol handle for ffi call");
+        goto cleanup;
+    }
+    if (symbolData->signature->returnType->kind != ZR_FFI_TYPE_VOID) {
+        if (!ZrLib_TempValueRoot_Begin(state, &resultsRoot)) {
+            errorCode = ZR_FFI_ERROR_MARSHAL;
+            snprintf(message, sizeof(message), "failed to root ffi batch results");
+            goto cleanup;
+        }
+        rootReady = ZR_TRUE;
+        resultsArray = ZrLib_Array_New(state);
+        if (resultsArray == ZR_NULL) {
+            errorCode = ZR_FFI_ERROR_MARSHAL;
+            snprintf(message, sizeof(message), "out of memory while preparing ffi batch results");
+            goto cleanup;
+        }
+        ZrLib_TempValueRoot_SetObject(&resultsRoot, resultsArray, ZR_VALUE_TYPE_ARRAY);
+    }
+
+    for (row = 0; row < rowCount; row++) {
+        SZrTypeValue rowResult;
+        char rowMessage[ZR_FFI_DIAGNOSTIC_BUFFER_LENGTH] = {0};
+
+        for (index = 0; index < columnCount; index++) {
+            if (columns[index] != ZR_NULL) {
+                rowArguments[index] = zr_ffi_array_get(state, columns[index], row);
+            }
+        }
+        if (!zr_ffi_call_frame_invoke(state, symbolData, &frame, rowArguments, &rowResult, &errorCode, rowMessage,
+                                      sizeof(rowMessage))) {
+            // cut the row's own diagnostic, not the prefix, when both do not fit
+            snprintf(message,
+                     sizeof(message),
+                     "callBatch row %llu: %.*s",
+                     (unsigned long long) (row + 1),
+                     (int) (sizeof(rowMessage) - ZR_FFI_BATCH_ROW_PREFIX_RESERVE),
+                     rowMessage);
+            goto cleanup;
+        }
+        if (resultsArray != ZR_NULL && !ZrLib_Array_PushValue(state, resultsArray, &rowResult)) {
+            errorCode = ZR_FFI_ERROR_MARSHAL;
+            snprintf(message, sizeof(message), "failed to append ffi batch result");
+            goto cleanup;
+        }
+    }
+
+    if (resultsArray != ZR_NULL) {
+        ZrLib_Value_SetObject(state, result, resultsArray, ZR_VALUE_TYPE_ARRAY);
+    } else {
+        ZrLib_Value_SetInt(state, result, (TZrInt64) rowCount);
+    }
+    succeeded = ZR_TRUE;
+
+cleanup:
+    ZrCore_Gc_NativeCallUnpin(state->global, &selfPin);
+    if (frameReady) {
+        zr_ffi_call_frame_end(state, &frame);
+    }
+    if (rootReady) {
+        ZrLib_TempValueRoot_End(&resultsRoot);
+    }
+    if (columns != inlineColumns) {
+        free(columns);
+    }
+    if (rowArguments != inlineRow) {
+        free((void *) rowArguments);
+    }
+    if (!succeeded) {
+        zr_ffi_raise_error(state, errorCode, "%s", message);
+    }
+    return succeeded;
+}
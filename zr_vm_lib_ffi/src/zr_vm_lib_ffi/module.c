@@ -32,6 +32,9 @@ static const ZrLibMethodDescriptor g_library_methods[] = {
 static const ZrLibMethodDescriptor g_symbol_methods[] = {
         ZR_LIB_METHOD_DESCRIPTOR_INIT("call", 1, 1, ZrFfi_Symbol_Call, "value",
                                       "Call the compiled symbol with an argument array.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("callBatch", 1, 1, ZrFfi_Symbol_CallBatch, "value",
+                                      "Call the compiled symbol once per row of per-parameter argument columns.",
+                                      ZR_FALSE, ZR_NULL, 0),
 };
 
 static const ZrLibMetaMethodDescriptor g_symbol_meta_methods[] = {
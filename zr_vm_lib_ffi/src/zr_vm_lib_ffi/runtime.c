@@ -299,6 +299,14 @@ TZrBool ZrFfi_Library_GetSymbol(ZrLibCallContext *context, SZrTypeValue *result)
     symbolData->symbolAddress = symbolAddress;
     symbolData->symbolName = zr_ffi_strdup(symbolName);
     symbolData->signature = signature;
+    symbolData->library = libraryData;
+    if (!zr_ffi_call_plan_init(&symbolData->plan, signature)) {
+        zr_ffi_destroy_signature(signature);
+        free(symbolData->symbolName);
+        free(symbolData);
+        zr_ffi_raise_error(context->state, ZR_FFI_ERROR_SYMBOL, "out of memory while compiling SymbolHandle");
+        return ZR_FALSE;
+    }
     libraryData->openSymbolCount++;
 
     ZrLib_Value_SetObject(context->state, &ownerValue, selfObject, ZR_VALUE_TYPE_OBJECT);
@@ -306,6 +314,7 @@ TZrBool ZrFfi_Library_GetSymbol(ZrLibCallContext *context, SZrTypeValue *result)
                                                            &ownerValue, ZR_NULL);
     if (symbolObject == ZR_NULL) {
         libraryData->openSymbolCount--;
+        zr_ffi_call_plan_release(&symbolData->plan);
         zr_ffi_destroy_signature(signature);
         free(symbolData->symbolName);
         free(symbolData);
@@ -631,188 +640,6 @@ TZrBool ZrFfi_Buffer_Slice(ZrLibCallContext *context, SZrTypeValue *result) {
     return ZR_TRUE;
 }
 
-TZrBool zr_ffi_symbol_invoke_array(SZrState *state,
-                                          SZrObject *selfObject,
-                                          ZrFfiSymbolData *symbolData,
-                                          SZrObject *argumentsArray,
-                                          SZrTypeValue *result) {
-    const SZrTypeValue *ownerValue;
-    SZrObject *ownerObject;
-    ZrFfiLibraryData *libraryData;
-    TZrSize argumentCount;
-    TZrSize index;
-    char errorBuffer[ZR_FFI_ERROR_BUFFER_LENGTH] = {0};
-#if ZR_VM_HAS_LIBFFI
-    ZrFfiMarshalledValue *marshalledValues = ZR_NULL;
-    void **ffiArguments = ZR_NULL;
-    SZrTypeValue **callbackArguments = ZR_NULL;
-    SZrGcNativeCallPin selfPin = {0};
-    SZrGcNativeCallPin ownerPin = {0};
-    SZrGcNativeCallPin *argumentPins = ZR_NULL;
-    unsigned char *returnStorage = ZR_NULL;
-    TZrBool callSucceeded = ZR_FALSE;
-#endif
-    if (selfObject == ZR_NULL || symbolData == ZR_NULL) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "symbol invoke requires a valid SymbolHandle");
-        return ZR_FALSE;
-    }
-    if (symbolData->base.kind != ZR_FFI_HANDLE_SYMBOL) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "symbol handle has unexpected internal kind");
-        return ZR_FALSE;
-    }
-    if (symbolData->closed) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "symbol handle is closed");
-        return ZR_FALSE;
-    }
-    if (argumentsArray == ZR_NULL) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "symbol invoke requires an arguments array");
-        return ZR_FALSE;
-    }
-    ownerValue = zr_ffi_find_field_raw(state, selfObject, ZR_FFI_HIDDEN_OWNER_FIELD);
-    if (ownerValue == ZR_NULL || ownerValue->type != ZR_VALUE_TYPE_OBJECT || ownerValue->value.object == ZR_NULL) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "symbol handle has no owning LibraryHandle");
-        return ZR_FALSE;
-    }
-    ownerObject = ZR_CAST_OBJECT(state, ownerValue->value.object);
-    libraryData = (ZrFfiLibraryData *) zr_ffi_get_handle_data(state, ownerObject);
-    if (libraryData == ZR_NULL || libraryData->base.kind != ZR_FFI_HANDLE_LIBRARY || libraryData->closeRequested ||
-        libraryData->libraryHandle == ZR_NULL) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_LOAD, "owning library handle is closed");
-        return ZR_FALSE;
-    }
-    argumentCount = zr_ffi_array_length(state, argumentsArray);
-    if (symbolData->signature == ZR_NULL || argumentCount != symbolData->signature->parameterCount) {
-        zr_ffi_raise_error(
-                state, ZR_FFI_ERROR_MARSHAL, "symbol '%s' expected %llu arguments but got %llu",
-                symbolData->symbolName != ZR_NULL ? symbolData->symbolName : "<symbol>",
-                (unsigned long long) (symbolData->signature != ZR_NULL ? symbolData->signature->parameterCount : 0),
-                (unsigned long long) argumentCount);
-        return ZR_FALSE;
-    }
-#if !ZR_VM_HAS_LIBFFI
-    zr_ffi_raise_error(state, ZR_FFI_ERROR_ABI_MISMATCH, "this build does not include libffi");
-    return ZR_FALSE;
-#else
-    if (argumentCount > 0) {
-        marshalledValues = (ZrFfiMarshalledValue *) calloc(argumentCount, sizeof(ZrFfiMarshalledValue));
-        ffiArguments = (void **) calloc(argumentCount, sizeof(void *));
-        callbackArguments = (SZrTypeValue **) calloc(argumentCount, sizeof(SZrTypeValue *));
-        argumentPins = (SZrGcNativeCallPin *) calloc(argumentCount, sizeof(SZrGcNativeCallPin));
-    }
-    if ((argumentCount > 0 &&
-         (marshalledValues == ZR_NULL || ffiArguments == ZR_NULL || callbackArguments == ZR_NULL ||
-          argumentPins == ZR_NULL))) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "out of memory while preparing ffi arguments");
-        goto cleanup;
-    }
-    if (!ZrCore_Gc_NativeCallPinObject(state, ZR_CAST_RAW_OBJECT_AS_SUPER(selfObject), &selfPin) ||
-        !ZrCore_Gc_NativeCallPinValue(state, ownerValue, &ownerPin)) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "failed to pin symbol handle for ffi call");
-        goto cleanup;
-    }
-    for (index = 0; index < argumentCount; index++) {
-        const SZrTypeValue *argumentValue = zr_ffi_array_get(state, argumentsArray, index);
-        ZrFfiTypeLayout *parameterType = symbolData->signature->parameters[index].type;
-        ZrFfiMarshalledValue *marshalledValue = &marshalledValues[index];
-        if (!ZrCore_Gc_NativeCallPinValue(state, argumentValue, &argumentPins[index])) {
-            zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "failed to pin argument %llu for ffi call",
-                               (unsigned long long)(index + 1));
-            goto cleanup;
-        }
-        if (parameterType->kind == ZR_FFI_TYPE_FUNCTION) {
-            SZrObject *callbackObject = ZR_NULL;
-            ZrFfiCallbackData *callbackData = ZR_NULL;
-            if (!zr_ffi_value_is_object(argumentValue, &callbackObject)) {
-                zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "argument %llu must be a CallbackHandle",
-                                   (unsigned long long) (index + 1));
-                goto cleanup;
-            }
-            callbackData = (ZrFfiCallbackData *) zr_ffi_get_handle_data(state, callbackObject);
-            if (callbackData == ZR_NULL || callbackData->base.kind != ZR_FFI_HANDLE_CALLBACK || callbackData->closed) {
-                zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "argument %llu is not an open CallbackHandle",
-                                   (unsigned long long) (index + 1));
-                goto cleanup;
-            }
-            callbackData->lastError = ZR_FFI_ERROR_NONE;
-            callbackData->lastErrorMessage[0] = '\0';
-            marshalledValue->ownedAllocation = calloc(1, sizeof(void *));
-            if (marshalledValue->ownedAllocation == ZR_NULL) {
-                zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL,
-                                   "out of memory while marshalling callback argument");
-                goto cleanup;
-            }
-            *(void **) marshalledValue->ownedAllocation = callbackData->codePointer;
-            marshalledValue->argumentPointer = marshalledValue->ownedAllocation;
-            ffiArguments[index] = marshalledValue->argumentPointer;
-            callbackArguments[index] = (SZrTypeValue *) argumentValue;
-            continue;
-        }
-        marshalledValue->ownedAllocation = calloc(1, zr_ffi_non_void_call_storage_size(parameterType));
-        if (marshalledValue->ownedAllocation == ZR_NULL) {
-            zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "out of memory while marshalling argument");
-            goto cleanup;
-        }
-        if (!zr_ffi_build_scalar_argument(state, argumentValue, parameterType,
-                                          marshalledValue->ownedAllocation, errorBuffer, sizeof(errorBuffer))) {
-            zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL,
-                               "argument %llu for symbol '%s' failed to marshal: %s", (unsigned long long) (index + 1),
-                               symbolData->symbolName != ZR_NULL ? symbolData->symbolName : "<symbol>", errorBuffer);
-            goto cleanup;
-        }
-        marshalledValue->argumentPointer = marshalledValue->ownedAllocation;
-        ffiArguments[index] = marshalledValue->argumentPointer;
-    }
-    returnStorage = (unsigned char *) calloc(1, zr_ffi_non_void_call_storage_size(symbolData->signature->returnType));
-    if (returnStorage == ZR_NULL) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "out of memory while preparing ffi return storage");
-        goto cleanup;
-    }
-    if (!zr_ffi_invoke_native_symbol(symbolData, returnStorage, ffiArguments, errorBuffer, sizeof(errorBuffer))) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_NATIVE_CALL, "%s",
-                           errorBuffer[0] != '\0' ? errorBuffer : "ffi native call failed");
-        goto cleanup;
-    }
-    for (index = 0; index < argumentCount; index++) {
-        if (callbackArguments[index] != ZR_NULL) {
-            SZrObject *callbackObject = ZR_CAST_OBJECT(state, callbackArguments[index]->value.object);
-            ZrFfiCallbackData *callbackData =
-                    (ZrFfiCallbackData *) zr_ffi_get_handle_data(state, callbackObject);
-            if (callbackData != ZR_NULL && callbackData->lastError != ZR_FFI_ERROR_NONE) {
-                zr_ffi_raise_error(state, callbackData->lastError, "%s",
-                                   callbackData->lastErrorMessage[0] != '\0' ? callbackData->lastErrorMessage
-                                                                             : "ffi callback failed");
-                goto cleanup;
-            }
-        }
-    }
-    if (!zr_ffi_set_result_from_scalar(state, symbolData->signature->returnType, returnStorage, result)) {
-        zr_ffi_raise_error(state, ZR_FFI_ERROR_MARSHAL, "failed to marshal return value from symbol '%s'",
-                           symbolData->symbolName != ZR_NULL ? symbolData->symbolName : "<symbol>");
-        goto cleanup;
-    }
-    callSucceeded = ZR_TRUE;
-cleanup:
-    if (marshalledValues != ZR_NULL) {
-        for (index = 0; index < argumentCount; index++) {
-            free(marshalledValues[index].ownedAllocation);
-        }
-    }
-    if (argumentPins != ZR_NULL) {
-        for (index = argumentCount; index > 0; index--) {
-            ZrCore_Gc_NativeCallUnpin(state->global, &argumentPins[index - 1u]);
-        }
-    }
-    ZrCore_Gc_NativeCallUnpin(state->global, &ownerPin);
-    ZrCore_Gc_NativeCallUnpin(state->global, &selfPin);
-    free(marshalledValues);
-    free(ffiArguments);
-    free(callbackArguments);
-    free(argumentPins);
-    free(returnStorage);
-    return callSucceeded;
-#endif
-}
-
 TZrBool ZrFfi_Symbol_Call(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *selfObject = zr_ffi_get_self_object(context);
     ZrFfiSymbolData *symbolData = ZR_NULL;
@@ -830,39 +657,53 @@ TZrBool ZrFfi_Symbol_Call(ZrLibCallContext *context, SZrTypeValue *result) {
     return zr_ffi_symbol_invoke_array(context->state, selfObject, symbolData, argumentsArray, result);
 }
 
-TZrBool ZrFfi_Symbol_MetaCall(ZrLibCallContext *context, SZrTypeValue *result) {
+TZrBool ZrFfi_Symbol_CallBatch(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *selfObject = zr_ffi_get_self_object(context);
     ZrFfiSymbolData *symbolData = ZR_NULL;
-    SZrObject *argumentsArray;
-    ZrLibTempValueRoot arrayRoot;
+    SZrObject *columnsArray = ZR_NULL;
 
     if (context == ZR_NULL || result == ZR_NULL || selfObject == ZR_NULL) {
         return ZR_FALSE;
     }
 
     symbolData = (ZrFfiSymbolData *) zr_ffi_get_handle_data(context->state, selfObject);
-    if (!ZrLib_CallContext_BeginTempValueRoot(context, &arrayRoot)) {
+    if (!ZrLib_CallContext_ReadArray(context, 0, &columnsArray) || columnsArray == ZR_NULL) {
         return ZR_FALSE;
     }
-    argumentsArray = ZrLib_Array_New(context->state);
-    if (argumentsArray == ZR_NULL) {
-        ZrLib_TempValueRoot_End(&arrayRoot);
-        zr_ffi_raise_error(context->state, ZR_FFI_ERROR_MARSHAL, "out of memory while preparing direct symbol call");
+
+    return zr_ffi_symbol_invoke_batch(context->state, selfObject, symbolData, columnsArray, result);
+}
+
+TZrBool ZrFfi_Symbol_MetaCall(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *selfObject = zr_ffi_get_self_object(context);
+    ZrFfiSymbolData *symbolData = ZR_NULL;
+    const SZrTypeValue *inlineArguments[ZR_FFI_INLINE_ARGUMENT_COUNT];
+    const SZrTypeValue **arguments = inlineArguments;
+    TZrSize argumentCount;
+    TZrSize index;
+    TZrBool succeeded;
+
+    if (context == ZR_NULL || result == ZR_NULL || selfObject == ZR_NULL) {
         return ZR_FALSE;
     }
-    ZrLib_TempValueRoot_SetObject(&arrayRoot, argumentsArray, ZR_VALUE_TYPE_ARRAY);
 
-    for (TZrSize index = 0; index < ZrLib_CallContext_ArgumentCount(context); index++) {
-        if (!ZrLib_Array_PushValue(context->state, argumentsArray, ZrLib_CallContext_Argument(context, index))) {
-            ZrLib_TempValueRoot_End(&arrayRoot);
-            zr_ffi_raise_error(context->state, ZR_FFI_ERROR_MARSHAL, "failed to append direct symbol call argument");
+    // positional arguments are marshalled straight from the call frame, without an intermediate array
+    symbolData = (ZrFfiSymbolData *) zr_ffi_get_handle_data(context->state, selfObject);
+    argumentCount = ZrLib_CallContext_ArgumentCount(context);
+    if (argumentCount > ZR_FFI_INLINE_ARGUMENT_COUNT) {
+        arguments = (const SZrTypeValue **) malloc(argumentCount * sizeof(const SZrTypeValue *));
+        if (arguments == ZR_NULL) {
+            zr_ffi_raise_error(context->state, ZR_FFI_ERROR_MARSHAL, "out of memory while preparing direct symbol call");
             return ZR_FALSE;
         }
     }
+    for (index = 0; index < argumentCount; index++) {
+        arguments[index] = ZrLib_CallContext_Argument(context, index);
+    }
 
-    {
-        TZrBool succeeded = zr_ffi_symbol_invoke_array(context->state, selfObject, symbolData, argumentsArray, result);
-        ZrLib_TempValueRoot_End(&arrayRoot);
-        return succeeded;
+    succeeded = zr_ffi_symbol_invoke_values(context->state, selfObject, symbolData, arguments, argumentCount, result);
+    if (arguments != inlineArguments) {
+        free(arguments);
     }
+    return succeeded;
 }
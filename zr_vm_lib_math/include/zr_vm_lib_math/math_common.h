@@ -10,6 +10,7 @@
 #include "zr_vm_core/debug.h"
 #include "zr_vm_core/object.h"
 #include "zr_vm_core/string.h"
+#include "zr_vm_core/type_layout.h"
 #include "zr_vm_core/value.h"
 
 #include <math.h>
@@ -46,11 +47,38 @@ typedef struct ZrMathComplex {
     TZrFloat64 imag;
 } ZrMathComplex;
 
+typedef enum EZrMathValueType {
+    ZR_MATH_VALUE_TYPE_VECTOR2 = 0,
+    ZR_MATH_VALUE_TYPE_VECTOR3,
+    ZR_MATH_VALUE_TYPE_VECTOR4,
+    ZR_MATH_VALUE_TYPE_QUATERNION,
+    ZR_MATH_VALUE_TYPE_COMPLEX,
+    ZR_MATH_VALUE_TYPE_MATRIX3X3,
+    ZR_MATH_VALUE_TYPE_MATRIX4X4,
+    ZR_MATH_VALUE_TYPE_COUNT
+} EZrMathValueType;
+
+#define ZR_MATH_VALUE_MAX_FIELD_COUNT 16U
+
+// fixed struct layout of a zr.math value type: fieldCount float64 fields packed in declaration order. instances
+// keep exactly that run in their byte storage, so field i is storage double i.
+typedef struct ZrMathValueLayout {
+    const TZrChar *typeName;
+    const TZrChar *const *fieldNames;
+    TZrUInt32 fieldCount;
+    SZrTypeLayout typeLayout;
+} ZrMathValueLayout;
+
+#define ZR_MATH_TENSOR_MAX_RANK 16U
+
+// row-major float64 elements live in the tensor object's byte storage; dims and strides are element counts.
 typedef struct ZrMathTensorStorage {
     SZrObject *shape;
-    SZrObject *data;
+    TZrFloat64 *values;
     TZrSize rank;
     TZrInt64 size;
+    TZrSize dims[ZR_MATH_TENSOR_MAX_RANK];
+    TZrSize strides[ZR_MATH_TENSOR_MAX_RANK];
 } ZrMathTensorStorage;
 
 TZrFloat64 ZrMath_AbsFloat(TZrFloat64 value);
@@ -74,6 +102,11 @@ TZrBool ZrMath_ConstructFloatObject(ZrLibCallContext *context,
                                     const TZrFloat64 *fieldValues,
                                     TZrSize fieldCount);
 
+const ZrMathValueLayout *ZrMath_GetValueLayout(EZrMathValueType type);
+TZrBool ZrMath_ApplyValueLayouts(SZrState *state, SZrObjectModule *module);
+SZrObject *ZrMath_MakeValueObject(SZrState *state, EZrMathValueType type, const TZrFloat64 *values);
+TZrBool ZrMath_ReadValueObject(SZrState *state, SZrObject *object, EZrMathValueType type, TZrFloat64 *outValues);
+
 SZrObject *ZrMath_MakeVector2(SZrState *state, TZrFloat64 x, TZrFloat64 y);
 SZrObject *ZrMath_MakeVector3(SZrState *state, TZrFloat64 x, TZrFloat64 y, TZrFloat64 z);
 SZrObject *ZrMath_MakeVector4(SZrState *state, TZrFloat64 x, TZrFloat64 y, TZrFloat64 z, TZrFloat64 w);
@@ -95,12 +128,18 @@ TZrBool ZrMath_ArrayReadInt(SZrState *state, SZrObject *array, TZrSize index, TZ
 TZrBool ZrMath_ArraySetValue(SZrState *state, SZrObject *array, TZrSize index, const SZrTypeValue *value);
 
 TZrBool ZrMath_TensorGetStorage(SZrState *state, SZrObject *tensor, ZrMathTensorStorage *outStorage);
-TZrBool ZrMath_TensorPopulate(SZrState *state, SZrObject *tensor, SZrObject *shapeArray, SZrObject *dataArray);
-SZrObject *ZrMath_TensorMake(SZrState *state, SZrObject *shapeArray, SZrObject *dataArray);
-TZrBool ZrMath_TensorShapeEquals(SZrState *state, SZrObject *lhsShape, SZrObject *rhsShape);
-TZrBool ZrMath_TensorComputeOffset(SZrState *state, SZrObject *shape, SZrObject *indices, TZrSize *outOffset);
-TZrInt64 ZrMath_TensorTotalSize(SZrState *state, SZrObject *shapeArray);
-SZrObject *ZrMath_TensorMakeZeroData(SZrState *state, TZrInt64 size);
+TZrBool ZrMath_TensorPopulate(SZrState *state,
+                              SZrObject *tensor,
+                              const TZrSize *dims,
+                              TZrSize rank,
+                              ZrMathTensorStorage *outStorage);
+SZrObject *ZrMath_TensorMake(SZrState *state, const TZrSize *dims, TZrSize rank, ZrMathTensorStorage *outStorage);
+TZrBool ZrMath_TensorShapeEquals(const ZrMathTensorStorage *lhs, const ZrMathTensorStorage *rhs);
+TZrBool ZrMath_TensorComputeOffset(SZrState *state,
+                                   const ZrMathTensorStorage *storage,
+                                   SZrObject *indices,
+                                   TZrSize *outOffset);
+TZrInt64 ZrMath_TensorReadShape(SZrState *state, SZrObject *shapeArray, TZrSize *outDims, TZrSize *outRank);
 
 TZrBool ZrMath_MakeStringResult(SZrState *state, SZrTypeValue *result, const TZrChar *format, ...);
 
@@ -4,6 +4,8 @@
 
 #include "zr_vm_lib_math/math_common.h"
 
+#include "zr_vm_core/module.h"
+
 #include <stdio.h>
 
 #if defined(__AVX2__)
@@ -17,22 +19,170 @@
 #include <arm_neon.h>
 #endif
 
-static SZrObject *zr_math_make_object_with_fields(SZrState *state,
-                                                  const TZrChar *typeName,
-                                                  const TZrChar *const *fieldNames,
-                                                  const TZrFloat64 *fieldValues,
-                                                  TZrSize fieldCount) {
-    SZrObject *object = ZrLib_Type_NewInstance(state, typeName);
-    TZrSize index;
-    if (object == ZR_NULL) {
+static const TZrChar *const kZrMathVectorFields[] = {"x", "y", "z", "w"};
+static const TZrChar *const kZrMathComplexFields[] = {"real", "imag"};
+static const TZrChar *const kZrMathMatrix3Fields[] = {"m00", "m01", "m02", "m10", "m11", "m12", "m20", "m21", "m22"};
+static const TZrChar *const kZrMathMatrix4Fields[] = {"m00", "m01", "m02", "m03", "m10", "m11", "m12", "m13",
+                                                      "m20", "m21", "m22", "m23", "m30", "m31", "m32", "m33"};
+
+#define ZR_MATH_FLOAT64_FIELD(INDEX) {(INDEX) * 8u, 8u, 0u, ZR_TYPE_LAYOUT_FIELD_FLAG_NONE, 0u}
+
+static const SZrTypeLayoutField kZrMathFloat64Fields[ZR_MATH_VALUE_MAX_FIELD_COUNT] = {
+        ZR_MATH_FLOAT64_FIELD(0u),  ZR_MATH_FLOAT64_FIELD(1u),  ZR_MATH_FLOAT64_FIELD(2u),  ZR_MATH_FLOAT64_FIELD(3u),
+        ZR_MATH_FLOAT64_FIELD(4u),  ZR_MATH_FLOAT64_FIELD(5u),  ZR_MATH_FLOAT64_FIELD(6u),  ZR_MATH_FLOAT64_FIELD(7u),
+        ZR_MATH_FLOAT64_FIELD(8u),  ZR_MATH_FLOAT64_FIELD(9u),  ZR_MATH_FLOAT64_FIELD(10u), ZR_MATH_FLOAT64_FIELD(11u),
+        ZR_MATH_FLOAT64_FIELD(12u), ZR_MATH_FLOAT64_FIELD(13u), ZR_MATH_FLOAT64_FIELD(14u), ZR_MATH_FLOAT64_FIELD(15u),
+};
+
+// every value type is a blittable pod run of float64 fields; they all share the one field table above.
+#define ZR_MATH_VALUE_LAYOUT(TYPE_NAME, FIELD_NAMES, COUNT)                                                           \
+    {                                                                                                                  \
+        .typeName = (TYPE_NAME), .fieldNames = (FIELD_NAMES), .fieldCount = (COUNT),                                   \
+        .typeLayout = {                                                                                                \
+                .byteSize = (COUNT) * 8u,                                                                              \
+                .byteAlign = 8u,                                                                                       \
+                .kind = ZR_TYPE_LAYOUT_KIND_STRUCT,                                                                    \
+                .copyKind = ZR_TYPE_LAYOUT_COPY_KIND_POD,                                                              \
+                .dropKind = ZR_TYPE_LAYOUT_DROP_KIND_NONE,                                                             \
+                .fields = kZrMathFloat64Fields,                                                                        \
+                .fieldCount = (COUNT),                                                                                 \
+                .blittable = ZR_TRUE,                                                                                  \
+        },                                                                                                             \
+    }
+
+static const ZrMathValueLayout kZrMathValueLayouts[ZR_MATH_VALUE_TYPE_COUNT] = {
+        ZR_MATH_VALUE_LAYOUT("Vector2", kZrMathVectorFields, 2u),
+        ZR_MATH_VALUE_LAYOUT("Vector3", kZrMathVectorFields, 3u),
+        ZR_MATH_VALUE_LAYOUT("Vector4", kZrMathVectorFields, 4u),
+        ZR_MATH_VALUE_LAYOUT("Quaternion", kZrMathVectorFields, 4u),
+        ZR_MATH_VALUE_LAYOUT("Complex", kZrMathComplexFields, 2u),
+        ZR_MATH_VALUE_LAYOUT("Matrix3x3", kZrMathMatrix3Fields, 9u),
+        ZR_MATH_VALUE_LAYOUT("Matrix4x4", kZrMathMatrix4Fields, 16u),
+};
+
+#undef ZR_MATH_VALUE_LAYOUT
+#undef ZR_MATH_FLOAT64_FIELD
+
+static TZrBool zr_math_value_name_matches(SZrString *name, const TZrChar *fieldName) {
+    TZrSize length = strlen(fieldName);
+    return name != ZR_NULL && ZrCore_String_GetByteLength(name) == length &&
+           memcmp(ZrCore_String_GetNativeString(name), fieldName, length) == 0;
+}
+
+/*
+ * Values of the fixed-layout types keep their components as one packed float64[N] in the object's byte
+ * storage, in layout order. Natives copy that run in and out directly; scripts reach the components through
+ * the native properties ZrMath_ApplyValueLayouts installs over the declared fields.
+ */
+static TZrFloat64 *zr_math_value_storage(const SZrObject *object, TZrSize fieldCount) {
+    if (object == ZR_NULL || object->byteStorage == ZR_NULL ||
+        object->byteStorageLength != fieldCount * sizeof(TZrFloat64)) {
         return ZR_NULL;
     }
-    for (index = 0; index < fieldCount; index++) {
-        ZrMath_WriteFloatField(state, object, fieldNames[index], fieldValues[index]);
+    return (TZrFloat64 *)ZrCore_Object_GetByteStorageData(object);
+}
+
+static TZrBool zr_math_store_values(SZrState *state, SZrObject *object, const TZrFloat64 *values, TZrSize count) {
+    TZrFloat64 *storage = zr_math_value_storage(object, count);
+
+    if (storage == ZR_NULL) {
+        if (object->byteStorage != ZR_NULL ||
+            !ZrCore_Object_AllocateByteStorage(state, object, count * sizeof(TZrFloat64))) {
+            return ZR_FALSE;
+        }
+        storage = zr_math_value_storage(object, count);
     }
-    return object;
+    memcpy(storage, values, count * sizeof(TZrFloat64));
+    return ZR_TRUE;
 }
 
+static TZrInt64 zr_math_value_property_finish(SZrState *state, TZrStackValuePointer base) {
+    state->stackTop.valuePointer = base + 1;
+    return 1;
+}
+
+static TZrInt64 zr_math_value_get_component(SZrState *state, TZrUInt32 index) {
+    TZrStackValuePointer base = state->callInfoList->functionBase.valuePointer;
+    SZrTypeValue *receiver = ZrCore_Stack_GetValue(base + 1);
+    SZrObject *object = receiver->type == ZR_VALUE_TYPE_OBJECT ? ZR_CAST_OBJECT(state, receiver->value.object) : ZR_NULL;
+
+    if (object != ZR_NULL && object->byteStorage != ZR_NULL &&
+        object->byteStorageLength >= (index + 1u) * sizeof(TZrFloat64)) {
+        ZrLib_Value_SetFloat(state, ZrCore_Stack_GetValue(base), ((TZrFloat64 *)ZrCore_Object_GetByteStorageData(object))[index]);
+    } else {
+        ZrCore_Value_ResetAsNull(ZrCore_Stack_GetValue(base));
+    }
+    return zr_math_value_property_finish(state, base);
+}
+
+static TZrInt64 zr_math_value_set_component(SZrState *state, TZrUInt32 index) {
+    TZrStackValuePointer base = state->callInfoList->functionBase.valuePointer;
+    SZrTypeValue *receiver = ZrCore_Stack_GetValue(base + 1);
+    SZrObject *object = receiver->type == ZR_VALUE_TYPE_OBJECT ? ZR_CAST_OBJECT(state, receiver->value.object) : ZR_NULL;
+    TZrFloat64 value;
+
+    // an instance that skipped its constructor gets zeroed components on the first write.
+    if (object != ZR_NULL && object->byteStorage == ZR_NULL && object->prototype != ZR_NULL &&
+        object->prototype->layoutByteSize > 0u) {
+        ZrCore_Object_AllocateByteStorage(state, object, object->prototype->layoutByteSize);
+    }
+    if (object == ZR_NULL || object->byteStorage == ZR_NULL ||
+        object->byteStorageLength < (index + 1u) * sizeof(TZrFloat64)) {
+        ZrCore_Debug_RunError(state, "math value has no component storage");
+    }
+    if (!ZrMath_NumberFromValue(ZrCore_Stack_GetValue(base + 2), &value)) {
+        ZrCore_Debug_RunError(state, "math value components must be numbers");
+    }
+    ((TZrFloat64 *)ZrCore_Object_GetByteStorageData(object))[index] = value;
+    ZrCore_Value_ResetAsNull(ZrCore_Stack_GetValue(base));
+    return zr_math_value_property_finish(state, base);
+}
+
+#define ZR_MATH_VALUE_COMPONENT_ACCESSORS(INDEX)                                                                      \
+    static TZrInt64 zr_math_value_get_component_##INDEX(SZrState *state) {                                           \
+        return zr_math_value_get_component(state, (INDEX));                                                            \
+    }                                                                                                                  \
+    static TZrInt64 zr_math_value_set_component_##INDEX(SZrState *state) {                                           \
+        return zr_math_value_set_component(state, (INDEX));                                                            \
+    }
+
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(0)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(1)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(2)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(3)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(4)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(5)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(6)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(7)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(8)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(9)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(10)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(11)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(12)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(13)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(14)
+ZR_MATH_VALUE_COMPONENT_ACCESSORS(15)
+
+#undef ZR_MATH_VALUE_COMPONENT_ACCESSORS
+
+static const FZrNativeFunction kZrMathComponentGetters[ZR_MATH_VALUE_MAX_FIELD_COUNT] = {
+        zr_math_value_get_component_0,  zr_math_value_get_component_1,  zr_math_value_get_component_2,
+        zr_math_value_get_component_3,  zr_math_value_get_component_4,  zr_math_value_get_component_5,
+        zr_math_value_get_component_6,  zr_math_value_get_component_7,  zr_math_value_get_component_8,
+        zr_math_value_get_component_9,  zr_math_value_get_component_10, zr_math_value_get_component_11,
+        zr_math_value_get_component_12, zr_math_value_get_component_13, zr_math_value_get_component_14,
+        zr_math_value_get_component_15,
+};
+
+static const FZrNativeFunction kZrMathComponentSetters[ZR_MATH_VALUE_MAX_FIELD_COUNT] = {
+        zr_math_value_set_component_0,  zr_math_value_set_component_1,  zr_math_value_set_component_2,
+        zr_math_value_set_component_3,  zr_math_value_set_component_4,  zr_math_value_set_component_5,
+        zr_math_value_set_component_6,  zr_math_value_set_component_7,  zr_math_value_set_component_8,
+        zr_math_value_set_component_9,  zr_math_value_set_component_10, zr_math_value_set_component_11,
+        zr_math_value_set_component_12, zr_math_value_set_component_13, zr_math_value_set_component_14,
+        zr_math_value_set_component_15,
+};
+
 TZrFloat64 ZrMath_AbsFloat(TZrFloat64 value) {
     return value < 0.0 ? -value : value;
 }
@@ -226,7 +376,6 @@ TZrBool ZrMath_ConstructFloatObject(ZrLibCallContext *context,
                                     const TZrFloat64 *fieldValues,
                                     TZrSize fieldCount) {
     SZrObject *object;
-    TZrSize index;
 
     if (context == ZR_NULL || result == ZR_NULL || fieldNames == ZR_NULL || fieldValues == ZR_NULL) {
         return ZR_FALSE;
@@ -237,107 +386,218 @@ TZrBool ZrMath_ConstructFloatObject(ZrLibCallContext *context,
         return ZR_FALSE;
     }
 
-    for (index = 0; index < fieldCount; index++) {
-        ZrMath_WriteFloatField(context->state, object, fieldNames[index], fieldValues[index]);
+    if (fieldCount > ZR_MATH_VALUE_MAX_FIELD_COUNT ||
+        !zr_math_store_values(context->state, object, fieldValues, fieldCount)) {
+        return ZR_FALSE;
     }
-
     return ZrMath_FinishConstructObject(context, result, object);
 }
 
+const ZrMathValueLayout *ZrMath_GetValueLayout(EZrMathValueType type) {
+    return (TZrUInt32)type < ZR_MATH_VALUE_TYPE_COUNT ? &kZrMathValueLayouts[type] : ZR_NULL;
+}
+
+static SZrFunction *zr_math_create_component_accessor(SZrState *state, FZrNativeFunction nativeFunction) {
+    SZrClosureNative *closure = ZrCore_ClosureNative_New(state, 0);
+
+    if (closure == ZR_NULL) {
+        return ZR_NULL;
+    }
+    closure->nativeFunction = nativeFunction;
+    ZrCore_RawObject_MarkAsPermanent(state, ZR_CAST_RAW_OBJECT_AS_SUPER(closure));
+    return ZR_CAST(SZrFunction *, ZR_CAST_RAW_OBJECT_AS_SUPER(closure));
+}
+
+// turns the declared instance fields, in layout order, into properties backed by the packed component storage.
+static TZrBool zr_math_install_component_properties(SZrObjectPrototype *prototype,
+                                                    const ZrMathValueLayout *layout,
+                                                    SZrFunction *const *getters,
+                                                    SZrFunction *const *setters) {
+    TZrUInt32 count = 0;
+    TZrUInt32 index;
+
+    for (index = 0; index < prototype->memberDescriptorCount; index++) {
+        SZrMemberDescriptor *descriptor = &prototype->memberDescriptors[index];
+
+        if (descriptor->kind != ZR_MEMBER_DESCRIPTOR_KIND_FIELD || descriptor->isStatic || descriptor->name == ZR_NULL) {
+            continue;
+        }
+        if (count >= layout->fieldCount || !zr_math_value_name_matches(descriptor->name, layout->fieldNames[count])) {
+            return ZR_FALSE;
+        }
+        descriptor->kind = ZR_MEMBER_DESCRIPTOR_KIND_PROPERTY;
+        descriptor->getterFunction = getters[count];
+        descriptor->setterFunction = setters[count];
+        count++;
+    }
+    return count == layout->fieldCount;
+}
+
+TZrBool ZrMath_ApplyValueLayouts(SZrState *state, SZrObjectModule *module) {
+    SZrFunction *getters[ZR_MATH_VALUE_MAX_FIELD_COUNT];
+    SZrFunction *setters[ZR_MATH_VALUE_MAX_FIELD_COUNT];
+    TZrUInt32 index;
+
+    if (state == ZR_NULL || module == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    for (index = 0; index < ZR_MATH_VALUE_MAX_FIELD_COUNT; index++) {
+        getters[index] = zr_math_create_component_accessor(state, kZrMathComponentGetters[index]);
+        setters[index] = zr_math_create_component_accessor(state, kZrMathComponentSetters[index]);
+        if (getters[index] == ZR_NULL || setters[index] == ZR_NULL) {
+            return ZR_FALSE;
+        }
+    }
+    for (index = 0; index < ZR_MATH_VALUE_TYPE_COUNT; index++) {
+        const ZrMathValueLayout *layout = &kZrMathValueLayouts[index];
+        SZrString *name = ZrCore_String_Create(state, (TZrNativeString)layout->typeName, strlen(layout->typeName));
+        const SZrTypeValue *exported = name != ZR_NULL ? ZrCore_Module_GetPubExport(state, module, name) : ZR_NULL;
+        SZrObjectPrototype *prototype;
+        SZrObject *object;
+
+        if (exported == ZR_NULL || exported->type != ZR_VALUE_TYPE_OBJECT || exported->value.object == ZR_NULL) {
+            continue;
+        }
+        object = ZR_CAST_OBJECT(state, exported->value.object);
+        if (object->internalType != ZR_OBJECT_INTERNAL_TYPE_OBJECT_PROTOTYPE) {
+            continue;
+        }
+        prototype = (SZrObjectPrototype *)object;
+        prototype->layoutByteSize = layout->typeLayout.byteSize;
+        prototype->layoutByteAlign = layout->typeLayout.byteAlign;
+        if (!zr_math_install_component_properties(prototype, layout, getters, setters)) {
+            return ZR_FALSE;
+        }
+    }
+    return ZR_TRUE;
+}
+
+SZrObject *ZrMath_MakeValueObject(SZrState *state, EZrMathValueType type, const TZrFloat64 *values) {
+    const ZrMathValueLayout *layout = ZrMath_GetValueLayout(type);
+    SZrObject *object;
+
+    if (state == ZR_NULL || layout == ZR_NULL || values == ZR_NULL) {
+        return ZR_NULL;
+    }
+    object = ZrLib_Type_NewInstance(state, layout->typeName);
+    if (object != ZR_NULL && !zr_math_store_values(state, object, values, layout->fieldCount)) {
+        return ZR_NULL;
+    }
+    return object;
+}
+
+TZrBool ZrMath_ReadValueObject(SZrState *state, SZrObject *object, EZrMathValueType type, TZrFloat64 *outValues) {
+    const ZrMathValueLayout *layout = ZrMath_GetValueLayout(type);
+    const TZrFloat64 *storage;
+
+    ZR_UNUSED_PARAMETER(state);
+    if (layout == ZR_NULL || object == ZR_NULL || outValues == ZR_NULL || object->prototype == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // the storage width alone cannot tell Vector2 from Complex, so the prototype name has to match as well.
+    storage = zr_math_value_storage(object, layout->fieldCount);
+    if (storage == ZR_NULL || !zr_math_value_name_matches(object->prototype->name, layout->typeName)) {
+        return ZR_FALSE;
+    }
+    memcpy(outValues, storage, layout->fieldCount * sizeof(TZrFloat64));
+    return ZR_TRUE;
+}
+
 SZrObject *ZrMath_MakeVector2(SZrState *state, TZrFloat64 x, TZrFloat64 y) {
-    static const TZrChar *const kFields[] = {"x", "y"};
     const TZrFloat64 values[] = {x, y};
-    return zr_math_make_object_with_fields(state, "Vector2", kFields, values, ZR_ARRAY_COUNT(kFields));
+    return ZrMath_MakeValueObject(state, ZR_MATH_VALUE_TYPE_VECTOR2, values);
 }
 
 SZrObject *ZrMath_MakeVector3(SZrState *state, TZrFloat64 x, TZrFloat64 y, TZrFloat64 z) {
-    static const TZrChar *const kFields[] = {"x", "y", "z"};
     const TZrFloat64 values[] = {x, y, z};
-    return zr_math_make_object_with_fields(state, "Vector3", kFields, values, ZR_ARRAY_COUNT(kFields));
+    return ZrMath_MakeValueObject(state, ZR_MATH_VALUE_TYPE_VECTOR3, values);
 }
 
 SZrObject *ZrMath_MakeVector4(SZrState *state, TZrFloat64 x, TZrFloat64 y, TZrFloat64 z, TZrFloat64 w) {
-    static const TZrChar *const kFields[] = {"x", "y", "z", "w"};
     const TZrFloat64 values[] = {x, y, z, w};
-    return zr_math_make_object_with_fields(state, "Vector4", kFields, values, ZR_ARRAY_COUNT(kFields));
+    return ZrMath_MakeValueObject(state, ZR_MATH_VALUE_TYPE_VECTOR4, values);
 }
 
 SZrObject *ZrMath_MakeQuaternion(SZrState *state, TZrFloat64 x, TZrFloat64 y, TZrFloat64 z, TZrFloat64 w) {
-    static const TZrChar *const kFields[] = {"x", "y", "z", "w"};
     const TZrFloat64 values[] = {x, y, z, w};
-    return zr_math_make_object_with_fields(state, "Quaternion", kFields, values, ZR_ARRAY_COUNT(kFields));
+    return ZrMath_MakeValueObject(state, ZR_MATH_VALUE_TYPE_QUATERNION, values);
 }
 
 SZrObject *ZrMath_MakeComplex(SZrState *state, TZrFloat64 real, TZrFloat64 imag) {
-    static const TZrChar *const kFields[] = {"real", "imag"};
     const TZrFloat64 values[] = {real, imag};
-    return zr_math_make_object_with_fields(state, "Complex", kFields, values, ZR_ARRAY_COUNT(kFields));
+    return ZrMath_MakeValueObject(state, ZR_MATH_VALUE_TYPE_COMPLEX, values);
 }
 
 SZrObject *ZrMath_MakeMatrix3x3(SZrState *state, const TZrFloat64 *values) {
-    static const TZrChar *const kFields[] = {"m00","m01","m02","m10","m11","m12","m20","m21","m22"};
-    return zr_math_make_object_with_fields(state, "Matrix3x3", kFields, values, ZR_ARRAY_COUNT(kFields));
+    return ZrMath_MakeValueObject(state, ZR_MATH_VALUE_TYPE_MATRIX3X3, values);
 }
 
 SZrObject *ZrMath_MakeMatrix4x4(SZrState *state, const TZrFloat64 *values) {
-    static const TZrChar *const kFields[] = {
-            "m00","m01","m02","m03","m10","m11","m12","m13","m20","m21","m22","m23","m30","m31","m32","m33"
-    };
-    return zr_math_make_object_with_fields(state, "Matrix4x4", kFields, values, ZR_ARRAY_COUNT(kFields));
+    return ZrMath_MakeValueObject(state, ZR_MATH_VALUE_TYPE_MATRIX4X4, values);
 }
 
 TZrBool ZrMath_ReadVector2Object(SZrState *state, SZrObject *object, ZrMathVector2 *outValue) {
-    return outValue != ZR_NULL && ZrMath_ReadFloatField(state, object, "x", &outValue->x) &&
-           ZrMath_ReadFloatField(state, object, "y", &outValue->y);
+    TZrFloat64 values[2];
+    if (outValue == ZR_NULL || !ZrMath_ReadValueObject(state, object, ZR_MATH_VALUE_TYPE_VECTOR2, values)) {
+        return ZR_FALSE;
+    }
+    outValue->x = values[0];
+    outValue->y = values[1];
+    return ZR_TRUE;
 }
 
 TZrBool ZrMath_ReadVector3Object(SZrState *state, SZrObject *object, ZrMathVector3 *outValue) {
-    return outValue != ZR_NULL && ZrMath_ReadFloatField(state, object, "x", &outValue->x) &&
-           ZrMath_ReadFloatField(state, object, "y", &outValue->y) &&
-           ZrMath_ReadFloatField(state, object, "z", &outValue->z);
+    TZrFloat64 values[3];
+    if (outValue == ZR_NULL || !ZrMath_ReadValueObject(state, object, ZR_MATH_VALUE_TYPE_VECTOR3, values)) {
+        return ZR_FALSE;
+    }
+    outValue->x = values[0];
+    outValue->y = values[1];
+    outValue->z = values[2];
+    return ZR_TRUE;
 }
 
 TZrBool ZrMath_ReadVector4Object(SZrState *state, SZrObject *object, ZrMathVector4 *outValue) {
-    return outValue != ZR_NULL && ZrMath_ReadFloatField(state, object, "x", &outValue->x) &&
-           ZrMath_ReadFloatField(state, object, "y", &outValue->y) &&
-           ZrMath_ReadFloatField(state, object, "z", &outValue->z) &&
-           ZrMath_ReadFloatField(state, object, "w", &outValue->w);
+    TZrFloat64 values[4];
+    if (outValue == ZR_NULL || !ZrMath_ReadValueObject(state, object, ZR_MATH_VALUE_TYPE_VECTOR4, values)) {
+        return ZR_FALSE;
+    }
+    outValue->x = values[0];
+    outValue->y = values[1];
+    outValue->z = values[2];
+    outValue->w = values[3];
+    return ZR_TRUE;
 }
 
 TZrBool ZrMath_ReadQuaternionObject(SZrState *state, SZrObject *object, ZrMathQuaternion *outValue) {
-    return outValue != ZR_NULL && ZrMath_ReadFloatField(state, object, "x", &outValue->x) &&
-           ZrMath_ReadFloatField(state, object, "y", &outValue->y) &&
-           ZrMath_ReadFloatField(state, object, "z", &outValue->z) &&
-           ZrMath_ReadFloatField(state, object, "w", &outValue->w);
+    TZrFloat64 values[4];
+    if (outValue == ZR_NULL || !ZrMath_ReadValueObject(state, object, ZR_MATH_VALUE_TYPE_QUATERNION, values)) {
+        return ZR_FALSE;
+    }
+    outValue->x = values[0];
+    outValue->y = values[1];
+    outValue->z = values[2];
+    outValue->w = values[3];
+    return ZR_TRUE;
 }
 
 TZrBool ZrMath_ReadComplexObject(SZrState *state, SZrObject *object, ZrMathComplex *outValue) {
-    return outValue != ZR_NULL && ZrMath_ReadFloatField(state, object, "real", &outValue->real) &&
-           ZrMath_ReadFloatField(state, object, "imag", &outValue->imag);
+    TZrFloat64 values[2];
+    if (outValue == ZR_NULL || !ZrMath_ReadValueObject(state, object, ZR_MATH_VALUE_TYPE_COMPLEX, values)) {
+        return ZR_FALSE;
+    }
+    outValue->real = values[0];
+    outValue->imag = values[1];
+    return ZR_TRUE;
 }
 
 TZrBool ZrMath_ReadMatrix3Object(SZrState *state, SZrObject *object, TZrFloat64 *outValues) {
-    static const TZrChar *const kFields[] = {"m00","m01","m02","m10","m11","m12","m20","m21","m22"};
-    TZrSize index;
-    for (index = 0; outValues != ZR_NULL && index < ZR_ARRAY_COUNT(kFields); index++) {
-        if (!ZrMath_ReadFloatField(state, object, kFields[index], &outValues[index])) {
-            return ZR_FALSE;
-        }
-    }
-    return outValues != ZR_NULL;
+    return ZrMath_ReadValueObject(state, object, ZR_MATH_VALUE_TYPE_MATRIX3X3, outValues);
 }
 
 TZrBool ZrMath_ReadMatrix4Object(SZrState *state, SZrObject *object, TZrFloat64 *outValues) {
-    static const TZrChar *const kFields[] = {
-            "m00","m01","m02","m03","m10","m11","m12","m13","m20","m21","m22","m23","m30","m31","m32","m33"
-    };
-    TZrSize index;
-    for (index = 0; outValues != ZR_NULL && index < ZR_ARRAY_COUNT(kFields); index++) {
-        if (!ZrMath_ReadFloatField(state, object, kFields[index], &outValues[index])) {
-            return ZR_FALSE;
-        }
-    }
-    return outValues != ZR_NULL;
+    return ZrMath_ReadValueObject(state, object, ZR_MATH_VALUE_TYPE_MATRIX4X4, outValues);
 }
 
 TZrBool ZrMath_ArrayReadFloat(SZrState *state, SZrObject *array, TZrSize index, TZrFloat64 *outValue) {
@@ -355,130 +615,156 @@ TZrBool ZrMath_ArraySetValue(SZrState *state, SZrObject *array, TZrSize index, c
     return ZR_TRUE;
 }
 
-TZrInt64 ZrMath_TensorTotalSize(SZrState *state, SZrObject *shapeArray) {
-    TZrInt64 total = 1;
+TZrInt64 ZrMath_TensorReadShape(SZrState *state, SZrObject *shapeArray, TZrSize *outDims, TZrSize *outRank) {
+    TZrSize rank;
+    TZrSize total = 1;
     TZrSize index;
-    for (index = 0; index < ZrLib_Array_Length(shapeArray); index++) {
+    if (shapeArray == ZR_NULL || outDims == ZR_NULL || outRank == ZR_NULL) {
+        return -1;
+    }
+    rank = ZrLib_Array_Length(shapeArray);
+    if (rank > ZR_MATH_TENSOR_MAX_RANK) {
+        return -1;
+    }
+    for (index = 0; index < rank; index++) {
         TZrInt64 dimension = 0;
-        if (!ZrMath_ArrayReadInt(state, shapeArray, index, &dimension) || dimension <= 0) {
+        if (!ZrMath_ArrayReadInt(state, shapeArray, index, &dimension) || dimension <= 0 ||
+            (TZrSize)dimension > (ZR_MAX_SIZE / sizeof(TZrFloat64)) / total) {
             return -1;
         }
-        total *= dimension;
+        outDims[index] = (TZrSize)dimension;
+        total *= (TZrSize)dimension;
     }
-    return total;
-}
-
-SZrObject *ZrMath_TensorMakeZeroData(SZrState *state, TZrInt64 size) {
-    SZrObject *data = ZrLib_Array_New(state);
-    TZrInt64 index;
-    for (index = 0; data != ZR_NULL && index < size; index++) {
-        SZrTypeValue value;
-        ZrLib_Value_SetFloat(state, &value, 0.0);
-        ZrLib_Array_PushValue(state, data, &value);
-    }
-    return data;
+    *outRank = rank;
+    return (TZrInt64)total;
 }
 
 TZrBool ZrMath_TensorGetStorage(SZrState *state, SZrObject *tensor, ZrMathTensorStorage *outStorage) {
     const SZrTypeValue *shapeValue;
-    const SZrTypeValue *dataValue;
-    const SZrTypeValue *rankValue;
-    const SZrTypeValue *sizeValue;
-    TZrInt64 rank = 0;
+    TZrSize stride = 1;
+    TZrSize index;
     if (tensor == ZR_NULL || outStorage == ZR_NULL) {
         return ZR_FALSE;
     }
     memset(outStorage, 0, sizeof(*outStorage));
     shapeValue = ZrLib_Object_GetFieldCString(state, tensor, "shape");
-    dataValue = ZrLib_Object_GetFieldCString(state, tensor, "__data");
-    rankValue = ZrLib_Object_GetFieldCString(state, tensor, "rank");
-    sizeValue = ZrLib_Object_GetFieldCString(state, tensor, "size");
-    if (shapeValue == ZR_NULL || dataValue == ZR_NULL || rankValue == ZR_NULL || sizeValue == ZR_NULL ||
-        shapeValue->type != ZR_VALUE_TYPE_ARRAY || dataValue->type != ZR_VALUE_TYPE_ARRAY ||
-        !ZrMath_IntFromValue(rankValue, &rank) || !ZrMath_IntFromValue(sizeValue, &outStorage->size)) {
+    if (shapeValue == ZR_NULL || shapeValue->type != ZR_VALUE_TYPE_ARRAY || tensor->byteStorage == ZR_NULL) {
         return ZR_FALSE;
     }
     outStorage->shape = ZR_CAST_OBJECT(state, shapeValue->value.object);
-    outStorage->data = ZR_CAST_OBJECT(state, dataValue->value.object);
-    outStorage->rank = (TZrSize)rank;
+    outStorage->rank = ZrLib_Array_Length(outStorage->shape);
+    if (outStorage->rank > ZR_MATH_TENSOR_MAX_RANK) {
+        return ZR_FALSE;
+    }
+    for (index = outStorage->rank; index > 0; index--) {
+        TZrInt64 dimension = 0;
+        if (!ZrMath_ArrayReadInt(state, outStorage->shape, index - 1, &dimension) || dimension <= 0 ||
+            (TZrSize)dimension > (ZR_MAX_SIZE / sizeof(TZrFloat64)) / stride) {
+            return ZR_FALSE;
+        }
+        outStorage->dims[index - 1] = (TZrSize)dimension;
+        outStorage->strides[index - 1] = stride;
+        stride *= (TZrSize)dimension;
+    }
+    // shape is a script-visible array, so it is checked against the packed element count on every access.
+    if (tensor->byteStorageLength != stride * sizeof(TZrFloat64)) {
+        return ZR_FALSE;
+    }
+    outStorage->size = (TZrInt64)stride;
+    outStorage->values = (TZrFloat64 *)ZrCore_Object_GetByteStorageData(tensor);
     return ZR_TRUE;
 }
 
-TZrBool ZrMath_TensorPopulate(SZrState *state, SZrObject *tensor, SZrObject *shapeArray, SZrObject *dataArray) {
-    TZrInt64 totalSize;
+TZrBool ZrMath_TensorPopulate(SZrState *state,
+                              SZrObject *tensor,
+                              const TZrSize *dims,
+                              TZrSize rank,
+                              ZrMathTensorStorage *outStorage) {
+    SZrObject *shapeArray;
+    SZrTypeValue value;
+    TZrSize total = 1;
+    TZrSize index;
 
-    if (state == ZR_NULL || tensor == ZR_NULL || shapeArray == ZR_NULL || dataArray == ZR_NULL) {
+    if (state == ZR_NULL || tensor == ZR_NULL || (dims == ZR_NULL && rank > 0) || rank > ZR_MATH_TENSOR_MAX_RANK) {
         return ZR_FALSE;
     }
+    for (index = 0; index < rank; index++) {
+        if (dims[index] == 0 || dims[index] > (ZR_MAX_SIZE / sizeof(TZrFloat64)) / total) {
+            return ZR_FALSE;
+        }
+        total *= dims[index];
+    }
 
-    totalSize = ZrMath_TensorTotalSize(state, shapeArray);
-    if (totalSize < 0 || (TZrSize)totalSize != ZrLib_Array_Length(dataArray)) {
+    shapeArray = ZrLib_Array_New(state);
+    if (shapeArray == ZR_NULL) {
         return ZR_FALSE;
     }
-
-    {
-        SZrTypeValue shapeValue;
-        SZrTypeValue dataValue;
-        ZrLib_Value_SetObject(state, &shapeValue, shapeArray, ZR_VALUE_TYPE_ARRAY);
-        ZrLib_Value_SetObject(state, &dataValue, dataArray, ZR_VALUE_TYPE_ARRAY);
-        ZrLib_Object_SetFieldCString(state, tensor, "shape", &shapeValue);
-        ZrLib_Object_SetFieldCString(state, tensor, "__data", &dataValue);
+    // attach the shape before filling it so the tensor keeps it reachable while it grows.
+    ZrLib_Value_SetObject(state, &value, shapeArray, ZR_VALUE_TYPE_ARRAY);
+    ZrLib_Object_SetFieldCString(state, tensor, "shape", &value);
+    for (index = 0; index < rank; index++) {
+        ZrLib_Value_SetInt(state, &value, (TZrInt64)dims[index]);
+        ZrLib_Array_PushValue(state, shapeArray, &value);
     }
 
-    ZrMath_WriteIntField(state, tensor, "rank", (TZrInt64)ZrLib_Array_Length(shapeArray));
-    ZrMath_WriteIntField(state, tensor, "size", totalSize);
-    return ZR_TRUE;
+    ZrMath_WriteIntField(state, tensor, "rank", (TZrInt64)rank);
+    ZrMath_WriteIntField(state, tensor, "size", (TZrInt64)total);
+    if (!ZrCore_Object_AllocateByteStorage(state, tensor, total * sizeof(TZrFloat64))) {
+        return ZR_FALSE;
+    }
+    return outStorage == ZR_NULL || ZrMath_TensorGetStorage(state, tensor, outStorage);
 }
 
-SZrObject *ZrMath_TensorMake(SZrState *state, SZrObject *shapeArray, SZrObject *dataArray) {
-    SZrObject *tensor = ZrLib_Type_NewInstance(state, "Tensor");
-    if (tensor == ZR_NULL) {
+SZrObject *ZrMath_TensorMake(SZrState *state, const TZrSize *dims, TZrSize rank, ZrMathTensorStorage *outStorage) {
+    ZrLibTempValueRoot root;
+    SZrObject *tensor;
+
+    if (!ZrLib_TempValueRoot_Begin(state, &root)) {
         return ZR_NULL;
     }
 
-    if (!ZrMath_TensorPopulate(state, tensor, shapeArray, dataArray)) {
-        return ZR_NULL;
+    tensor = ZrLib_Type_NewInstance(state, "Tensor");
+    if (tensor != ZR_NULL) {
+        ZrLib_TempValueRoot_SetObject(&root, tensor, ZR_VALUE_TYPE_OBJECT);
+        if (!ZrMath_TensorPopulate(state, tensor, dims, rank, outStorage)) {
+            tensor = ZR_NULL;
+        }
     }
 
+    ZrLib_TempValueRoot_End(&root);
     return tensor;
 }
 
-TZrBool ZrMath_TensorShapeEquals(SZrState *state, SZrObject *lhsShape, SZrObject *rhsShape) {
+TZrBool ZrMath_TensorShapeEquals(const ZrMathTensorStorage *lhs, const ZrMathTensorStorage *rhs) {
     TZrSize index;
-    TZrSize count = ZrLib_Array_Length(lhsShape);
-    if (count != ZrLib_Array_Length(rhsShape)) {
+    if (lhs == ZR_NULL || rhs == ZR_NULL || lhs->rank != rhs->rank) {
         return ZR_FALSE;
     }
-    for (index = 0; index < count; index++) {
-        TZrInt64 lhs = 0;
-        TZrInt64 rhs = 0;
-        if (!ZrMath_ArrayReadInt(state, lhsShape, index, &lhs) ||
-            !ZrMath_ArrayReadInt(state, rhsShape, index, &rhs) ||
-            lhs != rhs) {
+    for (index = 0; index < lhs->rank; index++) {
+        if (lhs->dims[index] != rhs->dims[index]) {
             return ZR_FALSE;
         }
     }
     return ZR_TRUE;
 }
 
-TZrBool ZrMath_TensorComputeOffset(SZrState *state, SZrObject *shape, SZrObject *indices, TZrSize *outOffset) {
-    TZrSize rank = ZrLib_Array_Length(shape);
-    TZrSize stride = 1;
+TZrBool ZrMath_TensorComputeOffset(SZrState *state,
+                                   const ZrMathTensorStorage *storage,
+                                   SZrObject *indices,
+                                   TZrSize *outOffset) {
     TZrSize offset = 0;
     TZrSize index;
-    if (outOffset == ZR_NULL || rank != ZrLib_Array_Length(indices)) {
+    if (storage == ZR_NULL || indices == ZR_NULL || outOffset == ZR_NULL ||
+        storage->rank != ZrLib_Array_Length(indices)) {
         return ZR_FALSE;
     }
-    for (index = rank; index > 0; index--) {
-        TZrInt64 dimension = 0;
+    for (index = 0; index < storage->rank; index++) {
         TZrInt64 position = 0;
-        if (!ZrMath_ArrayReadInt(state, shape, index - 1, &dimension) ||
-            !ZrMath_ArrayReadInt(state, indices, index - 1, &position) ||
-            position < 0 || position >= dimension) {
+        if (!ZrMath_ArrayReadInt(state, indices, index, &position) ||
+            position < 0 || (TZrSize)position >= storage->dims[index]) {
             return ZR_FALSE;
         }
-        offset += (TZrSize)position * stride;
-        stride *= (TZrSize)dimension;
+        offset += (TZrSize)position * storage->strides[index];
     }
     *outOffset = offset;
     return ZR_TRUE;
@@ -83,6 +83,14 @@ static void zr_math_append_hints(const ZrLibTypeHintDescriptor *descriptors, TZr
     *offset += count;
 }
 
+// value types carry a fixed float64 layout; publish it on their prototypes once they exist.
+static TZrBool zr_math_on_materialize(SZrState *state,
+                                      SZrObjectModule *module,
+                                      const ZrLibModuleDescriptor *descriptor) {
+    ZR_UNUSED_PARAMETER(descriptor);
+    return ZrMath_ApplyValueLayouts(state, module);
+}
+
 #define ZR_MATH_APPEND_FUNCTION_REGISTRY(getter)             \
     do {                                                     \
         const ZrLibFunctionDescriptor *descriptors = getter(&count); \
@@ -152,6 +160,7 @@ static void zr_math_initialize_module_descriptor(void) {
     g_math_module_descriptor.moduleVersion = "1.0.0";
     g_math_module_descriptor.minRuntimeAbi = ZR_VM_NATIVE_RUNTIME_ABI_VERSION;
     g_math_module_descriptor.requiredCapabilities = 0;
+    g_math_module_descriptor.onMaterialize = zr_math_on_materialize;
 
     g_math_initialized = ZR_TRUE;
 }
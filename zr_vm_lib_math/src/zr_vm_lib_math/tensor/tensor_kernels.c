@@ -0,0 +1,371 @@
+//
+// Dense float64 kernels behind zr.math Tensor.
+//
+
+#include "tensor/tensor_kernels.h"
+
+#if defined(__AVX2__)
+#define ZR_VM_LIB_MATH_TENSOR_USE_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE4_1__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ZR_VM_LIB_MATH_TENSOR_USE_SSE2 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define ZR_VM_LIB_MATH_TENSOR_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
+// baseline builds on x86 GCC/Clang still carry an AVX2 variant and pick it once the cpu reports support.
+#if !defined(ZR_VM_LIB_MATH_TENSOR_USE_AVX2) && defined(ZR_VM_LIB_MATH_TENSOR_USE_SSE2) &&                        \
+        (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ZR_VM_LIB_MATH_TENSOR_DISPATCH_AVX2 1
+#define ZR_MATH_TENSOR_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+#define ZR_MATH_TENSOR_MATMUL_BLOCK_INNER 128U
+#define ZR_MATH_TENSOR_MATMUL_BLOCK_COLS 256U
+#define ZR_MATH_TENSOR_TRANSPOSE_TILE 32U
+
+typedef struct ZrMathTensorKernelTable {
+    void (*fill)(TZrFloat64 *out, TZrFloat64 value, TZrSize count);
+    void (*addScaled)(TZrFloat64 *out,
+                      const TZrFloat64 *lhs,
+                      const TZrFloat64 *rhs,
+                      TZrFloat64 factor,
+                      TZrSize count);
+    void (*scale)(TZrFloat64 *out, const TZrFloat64 *values, TZrFloat64 factor, TZrSize count);
+    TZrFloat64 (*sum)(const TZrFloat64 *values, TZrSize count);
+    // out += factor * values, the inner step of the blocked matmul.
+    void (*axpy)(TZrFloat64 *out, const TZrFloat64 *values, TZrFloat64 factor, TZrSize count);
+} ZrMathTensorKernelTable;
+
+static void zr_math_tensor_fill_base(TZrFloat64 *out, TZrFloat64 value, TZrSize count) {
+    TZrSize index = 0;
+#if defined(ZR_VM_LIB_MATH_TENSOR_USE_AVX2)
+    __m256d splat = _mm256_set1_pd(value);
+    for (; index + 4 <= count; index += 4) {
+        _mm256_storeu_pd(out + index, splat);
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_SSE2)
+    __m128d splat = _mm_set1_pd(value);
+    for (; index + 2 <= count; index += 2) {
+        _mm_storeu_pd(out + index, splat);
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_NEON)
+    float64x2_t splat = vdupq_n_f64(value);
+    for (; index + 2 <= count; index += 2) {
+        vst1q_f64(out + index, splat);
+    }
+#endif
+    for (; index < count; index++) {
+        out[index] = value;
+    }
+}
+
+static void zr_math_tensor_add_scaled_base(TZrFloat64 *out,
+                                           const TZrFloat64 *lhs,
+                                           const TZrFloat64 *rhs,
+                                           TZrFloat64 factor,
+                                           TZrSize count) {
+    TZrSize index = 0;
+#if defined(ZR_VM_LIB_MATH_TENSOR_USE_AVX2)
+    __m256d scale = _mm256_set1_pd(factor);
+    for (; index + 4 <= count; index += 4) {
+        __m256d a = _mm256_loadu_pd(lhs + index);
+        __m256d b = _mm256_loadu_pd(rhs + index);
+        _mm256_storeu_pd(out + index, _mm256_add_pd(a, _mm256_mul_pd(b, scale)));
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_SSE2)
+    __m128d scale = _mm_set1_pd(factor);
+    for (; index + 2 <= count; index += 2) {
+        __m128d a = _mm_loadu_pd(lhs + index);
+        __m128d b = _mm_loadu_pd(rhs + index);
+        _mm_storeu_pd(out + index, _mm_add_pd(a, _mm_mul_pd(b, scale)));
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_NEON)
+    float64x2_t scale = vdupq_n_f64(factor);
+    for (; index + 2 <= count; index += 2) {
+        float64x2_t a = vld1q_f64(lhs + index);
+        float64x2_t b = vld1q_f64(rhs + index);
+        vst1q_f64(out + index, vaddq_f64(a, vmulq_f64(b, scale)));
+    }
+#endif
+    for (; index < count; index++) {
+        out[index] = lhs[index] + rhs[index] * factor;
+    }
+}
+
+static void zr_math_tensor_scale_base(TZrFloat64 *out, const TZrFloat64 *values, TZrFloat64 factor, TZrSize count) {
+    TZrSize index = 0;
+#if defined(ZR_VM_LIB_MATH_TENSOR_USE_AVX2)
+    __m256d scale = _mm256_set1_pd(factor);
+    for (; index + 4 <= count; index += 4) {
+        _mm256_storeu_pd(out + index, _mm256_mul_pd(_mm256_loadu_pd(values + index), scale));
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_SSE2)
+    __m128d scale = _mm_set1_pd(factor);
+    for (; index + 2 <= count; index += 2) {
+        _mm_storeu_pd(out + index, _mm_mul_pd(_mm_loadu_pd(values + index), scale));
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_NEON)
+    float64x2_t scale = vdupq_n_f64(factor);
+    for (; index + 2 <= count; index += 2) {
+        vst1q_f64(out + index, vmulq_f64(vld1q_f64(values + index), scale));
+    }
+#endif
+    for (; index < count; index++) {
+        out[index] = values[index] * factor;
+    }
+}
+
+static TZrFloat64 zr_math_tensor_sum_base(const TZrFloat64 *values, TZrSize count) {
+    TZrSize index = 0;
+    TZrFloat64 result = 0.0;
+#if defined(ZR_VM_LIB_MATH_TENSOR_USE_AVX2)
+    __m256d sum = _mm256_setzero_pd();
+    TZrFloat64 partial[4];
+    for (; index + 4 <= count; index += 4) {
+        sum = _mm256_add_pd(sum, _mm256_loadu_pd(values + index));
+    }
+    _mm256_storeu_pd(partial, sum);
+    result = partial[0] + partial[1] + partial[2] + partial[3];
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_SSE2)
+    __m128d sum = _mm_setzero_pd();
+    TZrFloat64 partial[2];
+    for (; index + 2 <= count; index += 2) {
+        sum = _mm_add_pd(sum, _mm_loadu_pd(values + index));
+    }
+    _mm_storeu_pd(partial, sum);
+    result = partial[0] + partial[1];
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_NEON)
+    float64x2_t sum = vdupq_n_f64(0.0);
+    for (; index + 2 <= count; index += 2) {
+        sum = vaddq_f64(sum, vld1q_f64(values + index));
+    }
+    result = vgetq_lane_f64(sum, 0) + vgetq_lane_f64(sum, 1);
+#endif
+    for (; index < count; index++) {
+        result += values[index];
+    }
+    return result;
+}
+
+static void zr_math_tensor_axpy_base(TZrFloat64 *out, const TZrFloat64 *values, TZrFloat64 factor, TZrSize count) {
+    TZrSize index = 0;
+#if defined(ZR_VM_LIB_MATH_TENSOR_USE_AVX2)
+    __m256d scale = _mm256_set1_pd(factor);
+    for (; index + 4 <= count; index += 4) {
+        __m256d acc = _mm256_loadu_pd(out + index);
+        _mm256_storeu_pd(out + index, _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(values + index), scale)));
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_SSE2)
+    __m128d scale = _mm_set1_pd(factor);
+    for (; index + 2 <= count; index += 2) {
+        __m128d acc = _mm_loadu_pd(out + index);
+        _mm_storeu_pd(out + index, _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(values + index), scale)));
+    }
+#elif defined(ZR_VM_LIB_MATH_TENSOR_USE_NEON)
+    float64x2_t scale = vdupq_n_f64(factor);
+    for (; index + 2 <= count; index += 2) {
+        vst1q_f64(out + index, vaddq_f64(vld1q_f64(out + index), vmulq_f64(vld1q_f64(values + index), scale)));
+    }
+#endif
+    for (; index < count; index++) {
+        out[index] += values[index] * factor;
+    }
+}
+
+static const ZrMathTensorKernelTable kZrMathTensorKernelsBase = {
+        zr_math_tensor_fill_base,
+        zr_math_tensor_add_scaled_base,
+        zr_math_tensor_scale_base,
+        zr_math_tensor_sum_base,
+        zr_math_tensor_axpy_base,
+};
+
+#if defined(ZR_VM_LIB_MATH_TENSOR_DISPATCH_AVX2)
+// multiply and add stay separate (no fma) so elementwise results match the baseline kernels; only sum reassociates.
+ZR_MATH_TENSOR_AVX2_TARGET static void zr_math_tensor_fill_avx2(TZrFloat64 *out, TZrFloat64 value, TZrSize count) {
+    TZrSize index = 0;
+    __m256d splat = _mm256_set1_pd(value);
+    for (; index + 4 <= count; index += 4) {
+        _mm256_storeu_pd(out + index, splat);
+    }
+    for (; index < count; index++) {
+        out[index] = value;
+    }
+}
+
+ZR_MATH_TENSOR_AVX2_TARGET static void zr_math_tensor_add_scaled_avx2(TZrFloat64 *out,
+                                                                      const TZrFloat64 *lhs,
+                                                                      const TZrFloat64 *rhs,
+                                                                      TZrFloat64 factor,
+                                                                      TZrSize count) {
+    TZrSize index = 0;
+    __m256d scale = _mm256_set1_pd(factor);
+    for (; index + 4 <= count; index += 4) {
+        __m256d a = _mm256_loadu_pd(lhs + index);
+        __m256d b = _mm256_loadu_pd(rhs + index);
+        _mm256_storeu_pd(out + index, _mm256_add_pd(a, _mm256_mul_pd(b, scale)));
+    }
+    for (; index < count; index++) {
+        out[index] = lhs[index] + rhs[index] * factor;
+    }
+}
+
+ZR_MATH_TENSOR_AVX2_TARGET static void zr_math_tensor_scale_avx2(TZrFloat64 *out,
+                                                                 const TZrFloat64 *values,
+                                                                 TZrFloat64 factor,
+                                                                 TZrSize count) {
+    TZrSize index = 0;
+    __m256d scale = _mm256_set1_pd(factor);
+    for (; index + 4 <= count; index += 4) {
+        _mm256_storeu_pd(out + index, _mm256_mul_pd(_mm256_loadu_pd(values + index), scale));
+    }
+    for (; index < count; index++) {
+        out[index] = values[index] * factor;
+    }
+}
+
+ZR_MATH_TENSOR_AVX2_TARGET static TZrFloat64 zr_math_tensor_sum_avx2(const TZrFloat64 *values, TZrSize count) {
+    TZrSize index = 0;
+    __m256d sum = _mm256_setzero_pd();
+    TZrFloat64 partial[4];
+    TZrFloat64 result;
+    for (; index + 4 <= count; index += 4) {
+        sum = _mm256_add_pd(sum, _mm256_loadu_pd(values + index));
+    }
+    _mm256_storeu_pd(partial, sum);
+    result = partial[0] + partial[1] + partial[2] + partial[3];
+    for (; index < count; index++) {
+        result += values[index];
+    }
+    return result;
+}
+
+ZR_MATH_TENSOR_AVX2_TARGET static void zr_math_tensor_axpy_avx2(TZrFloat64 *out,
+                                                                const TZrFloat64 *values,
+                                                                TZrFloat64 factor,
+                                                                TZrSize count) {
+    TZrSize index = 0;
+    __m256d scale = _mm256_set1_pd(factor);
+    for (; index + 4 <= count; index += 4) {
+        __m256d acc = _mm256_loadu_pd(out + index);
+        _mm256_storeu_pd(out + index, _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(values + index), scale)));
+    }
+    for (; index < count; index++) {
+        out[index] += values[index] * factor;
+    }
+}
+
+static const ZrMathTensorKernelTable kZrMathTensorKernelsAvx2 = {
+        zr_math_tensor_fill_avx2,
+        zr_math_tensor_add_scaled_avx2,
+        zr_math_tensor_scale_avx2,
+        zr_math_tensor_sum_avx2,
+        zr_math_tensor_axpy_avx2,
+};
+#endif
+
+static const ZrMathTensorKernelTable *zr_math_tensor_kernels(void) {
+#if defined(ZR_VM_LIB_MATH_TENSOR_DISPATCH_AVX2)
+    // racing threads resolve to the same table, so the cached pointer needs no lock.
+    static const ZrMathTensorKernelTable *resolved = ZR_NULL;
+    const ZrMathTensorKernelTable *table = resolved;
+    if (table == ZR_NULL) {
+        __builtin_cpu_init();
+        table = __builtin_cpu_supports("avx2") ? &kZrMathTensorKernelsAvx2 : &kZrMathTensorKernelsBase;
+        resolved = table;
+    }
+    return table;
+#else
+    return &kZrMathTensorKernelsBase;
+#endif
+}
+
+void ZrMath_TensorKernel_Fill(TZrFloat64 *out, TZrFloat64 value, TZrSize count) {
+    if (out != ZR_NULL) {
+        zr_math_tensor_kernels()->fill(out, value, count);
+    }
+}
+
+void ZrMath_TensorKernel_AddScaled(TZrFloat64 *out,
+                                   const TZrFloat64 *lhs,
+                                   const TZrFloat64 *rhs,
+                                   TZrFloat64 factor,
+                                   TZrSize count) {
+    if (out != ZR_NULL && lhs != ZR_NULL && rhs != ZR_NULL) {
+        zr_math_tensor_kernels()->addScaled(out, lhs, rhs, factor, count);
+    }
+}
+
+void ZrMath_TensorKernel_Scale(TZrFloat64 *out, const TZrFloat64 *values, TZrFloat64 factor, TZrSize count) {
+    if (out != ZR_NULL && values != ZR_NULL) {
+        zr_math_tensor_kernels()->scale(out, values, factor, count);
+    }
+}
+
+TZrFloat64 ZrMath_TensorKernel_Sum(const TZrFloat64 *values, TZrSize count) {
+    return values != ZR_NULL ? zr_math_tensor_kernels()->sum(values, count) : 0.0;
+}
+
+void ZrMath_TensorKernel_Transpose(TZrFloat64 *out, const TZrFloat64 *values, TZrSize rows, TZrSize cols) {
+    TZrSize rowBlock;
+    TZrSize colBlock;
+
+    if (out == ZR_NULL || values == ZR_NULL) {
+        return;
+    }
+
+    // square tiles keep both the strided reads and the strided writes inside a few cache lines.
+    for (rowBlock = 0; rowBlock < rows; rowBlock += ZR_MATH_TENSOR_TRANSPOSE_TILE) {
+        TZrSize rowEnd = rows - rowBlock < ZR_MATH_TENSOR_TRANSPOSE_TILE ? rows : rowBlock + ZR_MATH_TENSOR_TRANSPOSE_TILE;
+        for (colBlock = 0; colBlock < cols; colBlock += ZR_MATH_TENSOR_TRANSPOSE_TILE) {
+            TZrSize colEnd =
+                    cols - colBlock < ZR_MATH_TENSOR_TRANSPOSE_TILE ? cols : colBlock + ZR_MATH_TENSOR_TRANSPOSE_TILE;
+            TZrSize row;
+            for (row = rowBlock; row < rowEnd; row++) {
+                TZrSize col;
+                for (col = colBlock; col < colEnd; col++) {
+                    out[col * rows + row] = values[row * cols + col];
+                }
+            }
+        }
+    }
+}
+
+void ZrMath_TensorKernel_Matmul(TZrFloat64 *out,
+                                const TZrFloat64 *lhs,
+                                const TZrFloat64 *rhs,
+                                TZrSize rows,
+                                TZrSize inner,
+                                TZrSize cols) {
+    const ZrMathTensorKernelTable *kernels;
+    TZrSize innerBlock;
+    TZrSize colBlock;
+
+    if (out == ZR_NULL || lhs == ZR_NULL || rhs == ZR_NULL) {
+        return;
+    }
+
+    kernels = zr_math_tensor_kernels();
+    // i-k-j order streams rhs rows through the vector axpy; blocking k and j keeps the rhs panel hot across rows.
+    for (colBlock = 0; colBlock < cols; colBlock += ZR_MATH_TENSOR_MATMUL_BLOCK_COLS) {
+        TZrSize colCount = cols - colBlock < ZR_MATH_TENSOR_MATMUL_BLOCK_COLS ? cols - colBlock
+                                                                             : ZR_MATH_TENSOR_MATMUL_BLOCK_COLS;
+        for (innerBlock = 0; innerBlock < inner; innerBlock += ZR_MATH_TENSOR_MATMUL_BLOCK_INNER) {
+            TZrSize innerEnd = inner - innerBlock < ZR_MATH_TENSOR_MATMUL_BLOCK_INNER
+                                       ? inner
+                                       : innerBlock + ZR_MATH_TENSOR_MATMUL_BLOCK_INNER;
+            TZrSize row;
+            for (row = 0; row < rows; row++) {
+                const TZrFloat64 *lhsRow = lhs + row * inner;
+                TZrFloat64 *outRow = out + row * cols + colBlock;
+                TZrSize k;
+                for (k = innerBlock; k < innerEnd; k++) {
+                    kernels->axpy(outRow, rhs + k * cols + colBlock, lhsRow[k], colCount);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,28 @@
+//
+// Dense float64 kernels behind zr.math Tensor.
+//
+
+#ifndef ZR_VM_LIB_MATH_TENSOR_KERNELS_H
+#define ZR_VM_LIB_MATH_TENSOR_KERNELS_H
+
+#include "zr_vm_common/zr_common_conf.h"
+
+// all kernels work on packed row-major buffers; out may alias lhs/values but not rhs of a matmul.
+void ZrMath_TensorKernel_Fill(TZrFloat64 *out, TZrFloat64 value, TZrSize count);
+void ZrMath_TensorKernel_AddScaled(TZrFloat64 *out,
+                                   const TZrFloat64 *lhs,
+                                   const TZrFloat64 *rhs,
+                                   TZrFloat64 factor,
+                                   TZrSize count);
+void ZrMath_TensorKernel_Scale(TZrFloat64 *out, const TZrFloat64 *values, TZrFloat64 factor, TZrSize count);
+TZrFloat64 ZrMath_TensorKernel_Sum(const TZrFloat64 *values, TZrSize count);
+void ZrMath_TensorKernel_Transpose(TZrFloat64 *out, const TZrFloat64 *values, TZrSize rows, TZrSize cols);
+// out[rows x cols] = lhs[rows x inner] * rhs[inner x cols]; out must be zeroed and distinct from both inputs.
+void ZrMath_TensorKernel_Matmul(TZrFloat64 *out,
+                                const TZrFloat64 *lhs,
+                                const TZrFloat64 *rhs,
+                                TZrSize rows,
+                                TZrSize inner,
+                                TZrSize cols);
+
+#endif // ZR_VM_LIB_MATH_TENSOR_KERNELS_H
@@ -6,7 +6,7 @@
 #define ZR_NETWORK_API ZR_API
 
 #define ZR_NETWORK_ENDPOINT_TEXT_CAPACITY 96U
-#define ZR_NETWORK_FRAME_BUFFER_CAPACITY 8192U
+#define ZR_NETWORK_FRAME_BUFFER_CAPACITY 16384U
 #define ZR_NETWORK_WAIT_INFINITE ((TZrUInt32) 0xFFFFFFFFu)
 
 #endif
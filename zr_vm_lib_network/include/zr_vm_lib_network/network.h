@@ -27,6 +27,14 @@ typedef struct SZrNetworkUdpSocket {
     TZrBool isOpen;
 } SZrNetworkUdpSocket;
 
+// returns ZR_TRUE when it made progress (e.g. ran a queued task) so the waiter re-polls without blocking.
+typedef TZrBool (*FZrNetworkIdleCallback)(TZrPtr userData);
+
+typedef struct SZrNetworkIdleHook {
+    FZrNetworkIdleCallback callback;
+    TZrPtr userData;
+} SZrNetworkIdleHook;
+
 ZR_NETWORK_API TZrBool ZrNetwork_ParseEndpoint(const TZrChar *text, SZrNetworkEndpoint *outEndpoint,
                                                TZrChar *errorBuffer, TZrSize errorBufferSize);
 
@@ -103,6 +111,10 @@ ZR_NETWORK_API TZrBool ZrNetwork_UdpSocketReceive(SZrNetworkUdpSocket *socket,
                                                   TZrSize *outLength,
                                                   SZrNetworkEndpoint *outRemoteEndpoint);
 
+ZR_NETWORK_API SZrNetworkIdleHook ZrNetwork_Reactor_SetIdleHook(SZrNetworkIdleHook hook);
+
+ZR_NETWORK_API const TZrChar *ZrNetwork_Reactor_BackendName(void);
+
 ZR_NETWORK_API TZrBool ZrNetwork_FormatEndpoint(const SZrNetworkEndpoint *endpoint,
                                                 TZrChar *buffer,
                                                 TZrSize bufferSize);
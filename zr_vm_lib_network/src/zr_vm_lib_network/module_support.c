@@ -1,5 +1,7 @@
 #include "network/network_internal.h"
 
+#include "zr_vm_core/task_runtime.h"
+
 #include <stdlib.h>
 #include <string.h>
 
@@ -192,3 +194,19 @@ TZrBool zr_network_read_byte_count_arg(const ZrLibCallContext *context,
     *outLength = (TZrSize) value;
     return ZR_TRUE;
 }
+
+static TZrBool zr_network_yield_to_coroutine_scheduler(TZrPtr userData) {
+    return ZrCore_TaskRuntime_YieldCoroutineScheduler((SZrState *) userData);
+}
+
+SZrNetworkIdleHook zr_network_begin_cooperative_wait(SZrState *state) {
+    SZrNetworkIdleHook hook;
+
+    hook.callback = zr_network_yield_to_coroutine_scheduler;
+    hook.userData = state;
+    return ZrNetwork_Reactor_SetIdleHook(hook);
+}
+
+void zr_network_end_cooperative_wait(SZrNetworkIdleHook previous) {
+    ZrNetwork_Reactor_SetIdleHook(previous);
+}
@@ -7,37 +7,13 @@
 #endif
 #endif
 
-#include "zr_vm_lib_network/network.h"
+#include "network/network_reactor.h"
 
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#if defined(_WIN32)
-#include <winsock2.h>
-#include <ws2tcpip.h>
-typedef SOCKET ZrNetworkSocket;
-typedef int ZrNetworkSockLen;
-#define ZR_NETWORK_INVALID_SOCKET INVALID_SOCKET
-#define ZR_NETWORK_SHUT_RDWR SD_BOTH
-#define ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode) ((errorCode) == WSAEWOULDBLOCK || (errorCode) == WSAEINPROGRESS)
-#else
-#include <arpa/inet.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <netinet/in.h>
-#include <sys/ioctl.h>
-#include <sys/select.h>
-#include <sys/socket.h>
-#include <unistd.h>
-typedef int ZrNetworkSocket;
-typedef socklen_t ZrNetworkSockLen;
-#define ZR_NETWORK_INVALID_SOCKET (-1)
-#define ZR_NETWORK_SHUT_RDWR SHUT_RDWR
-#define ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode) ((errorCode) == EWOULDBLOCK || (errorCode) == EAGAIN || (errorCode) == EINPROGRESS)
-#endif
-
 #define ZR_NETWORK_FRAME_HEADER_SIZE 4U
 typedef enum EZrNetworkIoResult {
     ZR_NETWORK_IO_RESULT_SUCCESS = 0,
@@ -107,6 +83,7 @@ static void network_close_socket(ZrNetworkSocket socketHandle) {
     if (socketHandle == ZR_NETWORK_INVALID_SOCKET) {
         return;
     }
+    zr_network_reactor_forget(socketHandle);
 #if defined(_WIN32)
     closesocket(socketHandle);
 #else
@@ -115,36 +92,19 @@ static void network_close_socket(ZrNetworkSocket socketHandle) {
 }
 
 static int network_wait_socket(ZrNetworkSocket socketHandle, TZrUInt32 timeoutMs, TZrBool writeSet) {
-    fd_set sockets;
-    struct timeval timeout;
-    struct timeval *timeoutPointer = ZR_NULL;
-    int status;
-
-    FD_ZERO(&sockets);
-    FD_SET(socketHandle, &sockets);
-    if (timeoutMs != ZR_NETWORK_WAIT_INFINITE) {
-        timeout.tv_sec = (long)(timeoutMs / 1000U);
-        timeout.tv_usec = (long)((timeoutMs % 1000U) * 1000U);
-        timeoutPointer = &timeout;
-    }
+    return zr_network_reactor_wait(socketHandle,
+                                   writeSet ? ZR_NETWORK_REACTOR_INTEREST_WRITE : ZR_NETWORK_REACTOR_INTEREST_READ,
+                                   timeoutMs);
+}
 
-    do {
-#if defined(_WIN32)
-        status = select(0, writeSet ? ZR_NULL : &sockets, writeSet ? &sockets : ZR_NULL, ZR_NULL, timeoutPointer);
-#else
-        status = select(socketHandle + 1,
-                        writeSet ? ZR_NULL : &sockets,
-                        writeSet ? &sockets : ZR_NULL,
-                        ZR_NULL,
-                        timeoutPointer);
-#endif
-#if !defined(_WIN32)
-    } while (status < 0 && errno == EINTR);
-#else
-    } while (ZR_FALSE);
-#endif
+static TZrUInt32 network_remaining_timeout(TZrUInt32 timeoutMs, TZrUInt64 startMs) {
+    TZrUInt64 elapsed;
 
-    return status;
+    if (timeoutMs == ZR_NETWORK_WAIT_INFINITE) {
+        return timeoutMs;
+    }
+    elapsed = zr_network_reactor_now_ms() - startMs;
+    return elapsed >= timeoutMs ? 0 : (TZrUInt32)(timeoutMs - elapsed);
 }
 
 static TZrBool network_set_nonblocking(ZrNetworkSocket socketHandle, TZrBool enabled) {
@@ -255,28 +215,95 @@ static void network_update_endpoints(ZrNetworkSocket socketHandle,
     }
 }
 
-static EZrNetworkIoResult network_read_exact(ZrNetworkSocket socketHandle,
-                                             TZrUInt32 timeoutMs,
-                                             TZrByte *buffer,
-                                             TZrSize length) {
-    TZrSize total = 0;
-    while (total < length) {
-        int waitStatus = network_wait_socket(socketHandle, timeoutMs, ZR_FALSE);
-        int received;
+/*
+ * Every socket is non-blocking: transfers try the syscall first and only park in the reactor when
+ * the kernel reports it would block, so a socket with data pending costs no readiness probe.
+ */
+static EZrNetworkIoResult network_recv_some(ZrNetworkSocket socketHandle,
+                                            TZrUInt32 timeoutMs,
+                                            TZrByte *buffer,
+                                            TZrSize length,
+                                            TZrSize *outReceived) {
+    TZrUInt64 startMs = 0;
+    TZrBool waited = ZR_FALSE;
+
+    for (;;) {
+        int received = recv(socketHandle, (char *)buffer, length > INT_MAX ? INT_MAX : (int)length, 0);
+        int errorCode;
+        int waitStatus;
+
+        if (received > 0) {
+            *outReceived = (TZrSize)received;
+            return ZR_NETWORK_IO_RESULT_SUCCESS;
+        }
+        if (received == 0) {
+            return ZR_NETWORK_IO_RESULT_CLOSED;
+        }
+        errorCode = network_last_error();
+        if (ZR_NETWORK_SOCKET_INTERRUPTED(errorCode)) {
+            continue;
+        }
+        if (!ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode)) {
+            return ZR_NETWORK_IO_RESULT_ERROR;
+        }
+        if (!waited) {
+            startMs = zr_network_reactor_now_ms();
+            waited = ZR_TRUE;
+        }
+        waitStatus = network_wait_socket(socketHandle, network_remaining_timeout(timeoutMs, startMs), ZR_FALSE);
         if (waitStatus == 0) {
             return ZR_NETWORK_IO_RESULT_TIMEOUT;
         }
         if (waitStatus < 0) {
             return ZR_NETWORK_IO_RESULT_ERROR;
         }
-        received = recv(socketHandle, (char *)(buffer + total), (int)(length - total), 0);
-        if (received == 0) {
-            return ZR_NETWORK_IO_RESULT_CLOSED;
+    }
+}
+
+static TZrBool network_send_all(ZrNetworkSocket socketHandle, const TZrByte *bytes, TZrSize length, TZrSize *outSent) {
+    TZrSize total = 0;
+
+    while (total < length) {
+        TZrSize chunk = length - total;
+        int sent = send(socketHandle, (const char *)(bytes + total), chunk > INT_MAX ? INT_MAX : (int)chunk,
+#if defined(MSG_NOSIGNAL)
+                        MSG_NOSIGNAL
+#else
+                        0
+#endif
+        );
+        int errorCode;
+
+        if (sent > 0) {
+            total += (TZrSize)sent;
+            continue;
         }
-        if (received < 0) {
-            return ZR_NETWORK_IO_RESULT_ERROR;
+        errorCode = network_last_error();
+        if (sent < 0 && ZR_NETWORK_SOCKET_INTERRUPTED(errorCode)) {
+            continue;
+        }
+        if (sent == 0 || !ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode) ||
+            network_wait_socket(socketHandle, ZR_NETWORK_WAIT_INFINITE, ZR_TRUE) <= 0) {
+            *outSent = total;
+            return ZR_FALSE;
         }
-        total += (TZrSize)received;
+    }
+    *outSent = total;
+    return ZR_TRUE;
+}
+
+static EZrNetworkIoResult network_read_exact(ZrNetworkSocket socketHandle,
+                                             TZrUInt32 timeoutMs,
+                                             TZrByte *buffer,
+                                             TZrSize length) {
+    TZrSize total = 0;
+    while (total < length) {
+        TZrSize received = 0;
+        EZrNetworkIoResult result = network_recv_some(socketHandle, timeoutMs, buffer + total, length - total, &received);
+        if (result != ZR_NETWORK_IO_RESULT_SUCCESS) {
+            return result;
+        }
+        total += received;
     }
     return ZR_NETWORK_IO_RESULT_SUCCESS;
 }
@@ -404,7 +431,8 @@ TZrBool ZrNetwork_TcpListenerOpen(const SZrNetworkEndpoint *requested, SZrNetwor
                &reuseAddress,
 #endif
                (ZrNetworkSockLen)sizeof(reuseAddress));
-    if (bind(socketHandle, (const struct sockaddr *)&storage, storageLength) != 0 || listen(socketHandle, 16) != 0) {
+    if (bind(socketHandle, (const struct sockaddr *)&storage, storageLength) != 0 ||
+        listen(socketHandle, SOMAXCONN) != 0 || !network_set_nonblocking(socketHandle, ZR_TRUE)) {
         network_write_socket_error(errorBuffer, errorBufferSize, "failed to open TCP listener", network_last_error());
         network_close_socket(socketHandle);
         return ZR_FALSE;
@@ -434,17 +462,44 @@ void ZrNetwork_ListenerClose(SZrNetworkListener *listener) {
 TZrBool ZrNetwork_ListenerAccept(SZrNetworkListener *listener, TZrUInt32 timeoutMs, SZrNetworkStream *outStream) {
     ZrNetworkSocket listenerSocket;
     ZrNetworkSocket streamSocket;
+    TZrUInt64 startMs = zr_network_reactor_now_ms();
     if (listener == ZR_NULL || outStream == ZR_NULL || !listener->isOpen) {
         return ZR_FALSE;
     }
     listenerSocket = network_load_socket(listener->nativeHandle);
-    if (listenerSocket == ZR_NETWORK_INVALID_SOCKET || network_wait_socket(listenerSocket, timeoutMs, ZR_FALSE) <= 0) {
+    if (listenerSocket == ZR_NETWORK_INVALID_SOCKET) {
         return ZR_FALSE;
     }
-    streamSocket = accept(listenerSocket, ZR_NULL, ZR_NULL);
-    if (streamSocket == ZR_NETWORK_INVALID_SOCKET) {
+    for (;;) {
+        int errorCode;
+#if defined(__linux__)
+        streamSocket = accept4(listenerSocket, ZR_NULL, ZR_NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+        streamSocket = accept(listenerSocket, ZR_NULL, ZR_NULL);
+#endif
+        if (streamSocket != ZR_NETWORK_INVALID_SOCKET) {
+            break;
+        }
+        errorCode = network_last_error();
+        if (ZR_NETWORK_SOCKET_INTERRUPTED(errorCode)) {
+            continue;
+        }
+        // a client that resets before it is accepted is reported here; keep waiting for the next one.
+        if ((!ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode)
+#if !defined(_WIN32)
+             && errorCode != ECONNABORTED
+#endif
+             ) ||
+            network_wait_socket(listenerSocket, network_remaining_timeout(timeoutMs, startMs), ZR_FALSE) <= 0) {
+            return ZR_FALSE;
+        }
+    }
+#if !defined(__linux__)
+    if (!network_set_nonblocking(streamSocket, ZR_TRUE)) {
+        network_close_socket(streamSocket);
         return ZR_FALSE;
     }
+#endif
     memset(outStream, 0, sizeof(*outStream));
     outStream->nativeHandle = network_store_socket(streamSocket);
     outStream->isOpen = ZR_TRUE;
@@ -487,7 +542,6 @@ TZrBool ZrNetwork_TcpStreamConnect(const SZrNetworkEndpoint *endpoint, TZrUInt32
             return ZR_FALSE;
         }
     }
-    network_set_nonblocking(socketHandle, ZR_FALSE);
     outStream->nativeHandle = network_store_socket(socketHandle);
     outStream->isOpen = ZR_TRUE;
     network_update_endpoints(socketHandle, &outStream->localEndpoint, &outStream->remoteEndpoint);
@@ -516,53 +570,35 @@ void ZrNetwork_StreamClose(SZrNetworkStream *stream) {
 }
 
 TZrBool ZrNetwork_StreamWrite(SZrNetworkStream *stream, const TZrByte *bytes, TZrSize length, TZrSize *outWritten) {
-    ZrNetworkSocket socketHandle;
     TZrSize total = 0;
+    TZrBool written;
     if (outWritten != ZR_NULL) {
         *outWritten = 0;
     }
     if (stream == ZR_NULL || !stream->isOpen || bytes == ZR_NULL) {
         return ZR_FALSE;
     }
-    socketHandle = network_load_socket(stream->nativeHandle);
-    while (total < length) {
-        int sent = send(socketHandle, (const char *)(bytes + total), (int)(length - total),
-#if defined(MSG_NOSIGNAL)
-                        MSG_NOSIGNAL
-#else
-                        0
-#endif
-        );
-        if (sent <= 0) {
-            return ZR_FALSE;
-        }
-        total += (TZrSize)sent;
-    }
-    if (outWritten != ZR_NULL) {
+    written = network_send_all(network_load_socket(stream->nativeHandle), bytes, length, &total);
+    if (written && outWritten != ZR_NULL) {
         *outWritten = total;
     }
-    return ZR_TRUE;
+    return written;
 }
 
 TZrBool ZrNetwork_StreamRead(SZrNetworkStream *stream, TZrUInt32 timeoutMs, TZrByte *buffer, TZrSize bufferSize, TZrSize *outLength) {
-    ZrNetworkSocket socketHandle;
-    int received;
+    TZrSize received = 0;
     if (outLength != ZR_NULL) {
         *outLength = 0;
     }
     if (stream == ZR_NULL || !stream->isOpen || buffer == ZR_NULL || bufferSize == 0 || bufferSize > INT_MAX) {
         return ZR_FALSE;
     }
-    socketHandle = network_load_socket(stream->nativeHandle);
-    if (network_wait_socket(socketHandle, timeoutMs, ZR_FALSE) <= 0) {
-        return ZR_FALSE;
-    }
-    received = recv(socketHandle, (char *)buffer, (int)bufferSize, 0);
-    if (received <= 0) {
+    if (network_recv_some(network_load_socket(stream->nativeHandle), timeoutMs, buffer, bufferSize, &received) !=
+        ZR_NETWORK_IO_RESULT_SUCCESS) {
         return ZR_FALSE;
     }
     if (outLength != ZR_NULL) {
-        *outLength = (TZrSize)received;
+        *outLength = received;
     }
     return ZR_TRUE;
 }
@@ -669,7 +705,8 @@ TZrBool ZrNetwork_UdpSocketBind(const SZrNetworkEndpoint *requested, SZrNetworkU
                &reuseAddress,
 #endif
                (ZrNetworkSockLen)sizeof(reuseAddress));
-    if (bind(socketHandle, (const struct sockaddr *)&storage, storageLength) != 0) {
+    if (bind(socketHandle, (const struct sockaddr *)&storage, storageLength) != 0 ||
+        !network_set_nonblocking(socketHandle, ZR_TRUE)) {
         network_write_socket_error(errorBuffer, errorBufferSize, "failed to bind UDP socket", network_last_error());
         network_close_socket(socketHandle);
         return ZR_FALSE;
@@ -701,7 +738,20 @@ TZrBool ZrNetwork_UdpSocketSend(SZrNetworkUdpSocket *socket, const SZrNetworkEnd
         return ZR_FALSE;
     }
     socketHandle = network_load_socket(socket->nativeHandle);
-    sent = sendto(socketHandle, (const char *)bytes, (int)length, 0, (const struct sockaddr *)&storage, storageLength);
+    for (;;) {
+        int errorCode;
+        sent = sendto(socketHandle, (const char *)bytes, (int)length, 0, (const struct sockaddr *)&storage, storageLength);
+        if (sent >= 0) {
+            break;
+        }
+        errorCode = network_last_error();
+        if (ZR_NETWORK_SOCKET_INTERRUPTED(errorCode) ||
+            (ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode) &&
+             network_wait_socket(socketHandle, ZR_NETWORK_WAIT_INFINITE, ZR_TRUE) > 0)) {
+            continue;
+        }
+        break;
+    }
     if (sent < 0) {
         network_write_socket_error(errorBuffer, errorBufferSize, "failed to send UDP payload", network_last_error());
         return ZR_FALSE;
@@ -716,6 +766,7 @@ TZrBool ZrNetwork_UdpSocketReceive(SZrNetworkUdpSocket *socket, TZrUInt32 timeou
     ZrNetworkSocket socketHandle;
     struct sockaddr_storage storage;
     ZrNetworkSockLen storageLength = (ZrNetworkSockLen)sizeof(storage);
+    TZrUInt64 startMs = zr_network_reactor_now_ms();
     int received;
     if (outLength != ZR_NULL) {
         *outLength = 0;
@@ -724,11 +775,23 @@ TZrBool ZrNetwork_UdpSocketReceive(SZrNetworkUdpSocket *socket, TZrUInt32 timeou
         return ZR_FALSE;
     }
     socketHandle = network_load_socket(socket->nativeHandle);
-    if (network_wait_socket(socketHandle, timeoutMs, ZR_FALSE) <= 0) {
-        return ZR_FALSE;
+    for (;;) {
+        int errorCode;
+        storageLength = (ZrNetworkSockLen)sizeof(storage);
+        received = recvfrom(socketHandle, (char *)buffer, (int)bufferSize, 0, (struct sockaddr *)&storage, &storageLength);
+        if (received >= 0) {
+            break;
+        }
+        errorCode = network_last_error();
+        if (ZR_NETWORK_SOCKET_INTERRUPTED(errorCode)) {
+            continue;
+        }
+        if (!ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode) ||
+            network_wait_socket(socketHandle, network_remaining_timeout(timeoutMs, startMs), ZR_FALSE) <= 0) {
+            return ZR_FALSE;
+        }
     }
-    received = recvfrom(socketHandle, (char *)buffer, (int)bufferSize, 0, (struct sockaddr *)&storage, &storageLength);
-    if (received <= 0) {
+    if (received == 0) {
         return ZR_FALSE;
     }
     if (outRemoteEndpoint != ZR_NULL) {
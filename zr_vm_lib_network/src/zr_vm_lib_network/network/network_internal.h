@@ -3,6 +3,7 @@
 
 #include "zr_vm_core/debug.h"
 #include "zr_vm_core/exception.h"
+#include "zr_vm_core/gc.h"
 #include "zr_vm_core/object.h"
 #include "zr_vm_core/string.h"
 #include "zr_vm_library/native_binding.h"
@@ -44,4 +45,8 @@ TZrBool zr_network_read_byte_count_arg(const ZrLibCallContext *context,
                                        TZrSize index,
                                        TZrSize *outLength);
 
+// installs a reactor idle hook that steps zr.coroutine.coroutineScheduler while a socket is not ready.
+SZrNetworkIdleHook zr_network_begin_cooperative_wait(SZrState *state);
+void zr_network_end_cooperative_wait(SZrNetworkIdleHook previous);
+
 #endif
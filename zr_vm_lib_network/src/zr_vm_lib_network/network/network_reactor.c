@@ -0,0 +1,356 @@
+//
+// Per-thread socket readiness reactor. Sockets stay non-blocking and only fall back here after an
+// operation reports EAGAIN; Linux waits on a lazily created epoll set, other platforms poll the one
+// socket. While nothing is ready the thread's idle hook runs, so queued coroutine work keeps moving.
+//
+
+#if !defined(_WIN32)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+#endif
+
+#include "network/network_reactor.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#define ZR_NETWORK_REACTOR_USE_EPOLL 1
+#include <pthread.h>
+#include <sys/epoll.h>
+#endif
+
+#if !defined(_WIN32)
+#include <poll.h>
+#include <time.h>
+#endif
+
+#if defined(_MSC_VER)
+#define ZR_NETWORK_REACTOR_THREAD_LOCAL __declspec(thread)
+#else
+#define ZR_NETWORK_REACTOR_THREAD_LOCAL _Thread_local
+#endif
+
+#define ZR_NETWORK_REACTOR_EVENT_BATCH 64
+#define ZR_NETWORK_REACTOR_HINT_MIN_CAPACITY 256u
+
+static ZR_NETWORK_REACTOR_THREAD_LOCAL SZrNetworkIdleHook g_network_idle_hook;
+
+TZrUInt64 zr_network_reactor_now_ms(void) {
+#if defined(_WIN32)
+    return (TZrUInt64)GetTickCount64();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (TZrUInt64)now.tv_sec * 1000u + (TZrUInt64)now.tv_nsec / 1000000u;
+#endif
+}
+
+static int network_reactor_remaining_ms(TZrUInt32 timeoutMs, TZrUInt64 startMs) {
+    TZrUInt64 elapsed;
+
+    if (timeoutMs == ZR_NETWORK_WAIT_INFINITE) {
+        return -1;
+    }
+    elapsed = zr_network_reactor_now_ms() - startMs;
+    if (elapsed >= timeoutMs) {
+        return 0;
+    }
+    return timeoutMs - elapsed > (TZrUInt64)INT_MAX ? INT_MAX : (int)(timeoutMs - elapsed);
+}
+
+static TZrBool network_reactor_run_idle(void) {
+    SZrNetworkIdleHook hook = g_network_idle_hook;
+
+    return hook.callback != ZR_NULL && hook.callback(hook.userData) ? ZR_TRUE : ZR_FALSE;
+}
+
+SZrNetworkIdleHook ZrNetwork_Reactor_SetIdleHook(SZrNetworkIdleHook hook) {
+    SZrNetworkIdleHook previous = g_network_idle_hook;
+
+    g_network_idle_hook = hook;
+    return previous;
+}
+
+#if defined(ZR_NETWORK_REACTOR_USE_EPOLL)
+typedef struct ZrNetworkEpollReactor {
+    int epollFd;
+    // readiness reported for sockets other than the one being waited for, consumed by their next wait.
+    TZrUInt8 *readyHints;
+    TZrSize hintCapacity;
+} ZrNetworkEpollReactor;
+
+static pthread_key_t g_network_reactor_key;
+static pthread_once_t g_network_reactor_once = PTHREAD_ONCE_INIT;
+static TZrBool g_network_reactor_key_ready = ZR_FALSE;
+
+static void network_reactor_destroy(void *value) {
+    ZrNetworkEpollReactor *reactor = (ZrNetworkEpollReactor *)value;
+
+    if (reactor == ZR_NULL) {
+        return;
+    }
+    close(reactor->epollFd);
+    free(reactor->readyHints);
+    free(reactor);
+}
+
+static void network_reactor_init_key(void) {
+    g_network_reactor_key_ready = pthread_key_create(&g_network_reactor_key, network_reactor_destroy) == 0;
+}
+
+static ZrNetworkEpollReactor *network_reactor_current(TZrBool create) {
+    ZrNetworkEpollReactor *reactor;
+
+    pthread_once(&g_network_reactor_once, network_reactor_init_key);
+    if (!g_network_reactor_key_ready) {
+        return ZR_NULL;
+    }
+
+    reactor = (ZrNetworkEpollReactor *)pthread_getspecific(g_network_reactor_key);
+    if (reactor != ZR_NULL || !create) {
+        return reactor;
+    }
+
+    reactor = (ZrNetworkEpollReactor *)calloc(1, sizeof(*reactor));
+    if (reactor == ZR_NULL) {
+        return ZR_NULL;
+    }
+    reactor->epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (reactor->epollFd < 0 || pthread_setspecific(g_network_reactor_key, reactor) != 0) {
+        if (reactor->epollFd >= 0) {
+            close(reactor->epollFd);
+        }
+        free(reactor);
+        return ZR_NULL;
+    }
+    return reactor;
+}
+
+static void network_reactor_record_hint(ZrNetworkEpollReactor *reactor, int socketHandle, TZrUInt8 readiness) {
+    if (socketHandle < 0) {
+        return;
+    }
+    if ((TZrSize)socketHandle >= reactor->hintCapacity) {
+        TZrSize capacity = reactor->hintCapacity > 0 ? reactor->hintCapacity : ZR_NETWORK_REACTOR_HINT_MIN_CAPACITY;
+        TZrUInt8 *hints;
+
+        while (capacity <= (TZrSize)socketHandle) {
+            capacity *= 2u;
+        }
+        hints = (TZrUInt8 *)realloc(reactor->readyHints, capacity);
+        if (hints == ZR_NULL) {
+            // a dropped hint only costs the next waiter an extra epoll_ctl round trip.
+            return;
+        }
+        memset(hints + reactor->hintCapacity, 0, capacity - reactor->hintCapacity);
+        reactor->readyHints = hints;
+        reactor->hintCapacity = capacity;
+    }
+    reactor->readyHints[socketHandle] |= readiness;
+}
+
+static TZrUInt8 network_reactor_event_readiness(TZrUInt32 events) {
+    TZrUInt8 readiness = 0;
+
+    if ((events & (EPOLLERR | EPOLLHUP)) != 0) {
+        return (TZrUInt8)(ZR_NETWORK_REACTOR_INTEREST_READ | ZR_NETWORK_REACTOR_INTEREST_WRITE);
+    }
+    if ((events & (EPOLLIN | EPOLLRDHUP)) != 0) {
+        readiness |= ZR_NETWORK_REACTOR_INTEREST_READ;
+    }
+    if ((events & EPOLLOUT) != 0) {
+        readiness |= ZR_NETWORK_REACTOR_INTEREST_WRITE;
+    }
+    return readiness;
+}
+
+static TZrBool network_reactor_arm(ZrNetworkEpollReactor *reactor, int socketHandle, TZrUInt32 interest) {
+    struct epoll_event event;
+
+    /*
+     * One-shot registrations stay in the set after the socket is served but stop reporting, so an
+     * unread socket cannot keep waking waits for other sockets; every wait re-arms its own socket.
+     */
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLONESHOT | EPOLLRDHUP;
+    if ((interest & ZR_NETWORK_REACTOR_INTEREST_READ) != 0) {
+        event.events |= EPOLLIN;
+    }
+    if ((interest & ZR_NETWORK_REACTOR_INTEREST_WRITE) != 0) {
+        event.events |= EPOLLOUT;
+    }
+    event.data.fd = socketHandle;
+    if (epoll_ctl(reactor->epollFd, EPOLL_CTL_MOD, socketHandle, &event) == 0) {
+        return ZR_TRUE;
+    }
+    // closed sockets drop out of the set on their own, so an unknown descriptor is simply added.
+    return errno == ENOENT && epoll_ctl(reactor->epollFd, EPOLL_CTL_ADD, socketHandle, &event) == 0 ? ZR_TRUE
+                                                                                                    : ZR_FALSE;
+}
+
+static int network_reactor_epoll_wait(ZrNetworkEpollReactor *reactor,
+                                      int socketHandle,
+                                      TZrUInt32 interest,
+                                      TZrUInt32 timeoutMs) {
+    struct epoll_event events[ZR_NETWORK_REACTOR_EVENT_BATCH];
+    TZrUInt64 startMs = zr_network_reactor_now_ms();
+    TZrBool needsArm = ZR_TRUE;
+
+    if ((TZrSize)socketHandle < reactor->hintCapacity && (reactor->readyHints[socketHandle] & interest) != 0) {
+        reactor->readyHints[socketHandle] &= (TZrUInt8)~interest;
+        return 1;
+    }
+
+    for (;;) {
+        TZrBool ranIdle;
+        int pollTimeout;
+        int count;
+        int index;
+        TZrBool ready = ZR_FALSE;
+
+        // an idle step may have waited on (and consumed) this socket itself, so re-arm after one.
+        if (needsArm && !network_reactor_arm(reactor, socketHandle, interest)) {
+            return -1;
+        }
+        ranIdle = network_reactor_run_idle();
+        needsArm = ranIdle;
+        pollTimeout = ranIdle ? 0 : network_reactor_remaining_ms(timeoutMs, startMs);
+
+        count = epoll_wait(reactor->epollFd, events, ZR_NETWORK_REACTOR_EVENT_BATCH, pollTimeout);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+
+        for (index = 0; index < count; index++) {
+            TZrUInt8 readiness = network_reactor_event_readiness(events[index].events);
+
+            if (events[index].data.fd == socketHandle) {
+                ready = ZR_TRUE;
+                continue;
+            }
+            network_reactor_record_hint(reactor, events[index].data.fd, readiness);
+        }
+        if (ready) {
+            return 1;
+        }
+        if (network_reactor_remaining_ms(timeoutMs, startMs) == 0) {
+            return 0;
+        }
+    }
+}
+#endif
+
+#if defined(_WIN32)
+static int network_reactor_select_once(ZrNetworkSocket socketHandle, TZrUInt32 interest, int timeoutMs) {
+    fd_set sockets;
+    struct timeval timeout;
+
+    // Windows fd_set is a counted handle array, so a single socket never hits the FD_SETSIZE limit.
+    FD_ZERO(&sockets);
+    FD_SET(socketHandle, &sockets);
+    timeout.tv_sec = timeoutMs < 0 ? 0 : (long)(timeoutMs / 1000);
+    timeout.tv_usec = timeoutMs < 0 ? 0 : (long)((timeoutMs % 1000) * 1000);
+    return select(0,
+                  (interest & ZR_NETWORK_REACTOR_INTEREST_READ) != 0 ? &sockets : ZR_NULL,
+                  (interest & ZR_NETWORK_REACTOR_INTEREST_WRITE) != 0 ? &sockets : ZR_NULL,
+                  ZR_NULL,
+                  timeoutMs < 0 ? ZR_NULL : &timeout);
+}
+#else
+static int network_reactor_poll_once(ZrNetworkSocket socketHandle, TZrUInt32 interest, int timeoutMs) {
+    struct pollfd entry;
+    int status;
+
+    memset(&entry, 0, sizeof(entry));
+    entry.fd = socketHandle;
+    if ((interest & ZR_NETWORK_REACTOR_INTEREST_READ) != 0) {
+        entry.events |= POLLIN;
+    }
+    if ((interest & ZR_NETWORK_REACTOR_INTEREST_WRITE) != 0) {
+        entry.events |= POLLOUT;
+    }
+    status = poll(&entry, 1, timeoutMs);
+    if (status > 0 && (entry.revents & POLLNVAL) != 0) {
+        return -1;
+    }
+    return status < 0 && errno == EINTR ? 0 : status;
+}
+#endif
+
+static int network_reactor_single_wait(ZrNetworkSocket socketHandle, TZrUInt32 interest, TZrUInt32 timeoutMs) {
+    TZrUInt64 startMs = zr_network_reactor_now_ms();
+
+    for (;;) {
+        TZrBool ranIdle = network_reactor_run_idle();
+        int status;
+
+#if defined(_WIN32)
+        status = network_reactor_select_once(socketHandle,
+                                             interest,
+                                             ranIdle ? 0 : network_reactor_remaining_ms(timeoutMs, startMs));
+#else
+        status = network_reactor_poll_once(socketHandle,
+                                           interest,
+                                           ranIdle ? 0 : network_reactor_remaining_ms(timeoutMs, startMs));
+#endif
+        if (status != 0) {
+            return status > 0 ? 1 : -1;
+        }
+        if (network_reactor_remaining_ms(timeoutMs, startMs) == 0) {
+            return 0;
+        }
+    }
+}
+
+int zr_network_reactor_wait(ZrNetworkSocket socketHandle, TZrUInt32 interest, TZrUInt32 timeoutMs) {
+    if (socketHandle == ZR_NETWORK_INVALID_SOCKET) {
+        return -1;
+    }
+
+#if defined(ZR_NETWORK_REACTOR_USE_EPOLL)
+    {
+        ZrNetworkEpollReactor *reactor = network_reactor_current(ZR_TRUE);
+
+        if (reactor != ZR_NULL) {
+            return network_reactor_epoll_wait(reactor, socketHandle, interest, timeoutMs);
+        }
+    }
+#endif
+    return network_reactor_single_wait(socketHandle, interest, timeoutMs);
+}
+
+void zr_network_reactor_forget(ZrNetworkSocket socketHandle) {
+#if defined(ZR_NETWORK_REACTOR_USE_EPOLL)
+    ZrNetworkEpollReactor *reactor = network_reactor_current(ZR_FALSE);
+
+    // the kernel drops a closed descriptor from every epoll set; only the cached readiness is ours.
+    if (reactor != ZR_NULL && socketHandle >= 0 && (TZrSize)socketHandle < reactor->hintCapacity) {
+        reactor->readyHints[socketHandle] = 0;
+    }
+#else
+    ZR_UNUSED_PARAMETER(socketHandle);
+#endif
+}
+
+const TZrChar *ZrNetwork_Reactor_BackendName(void) {
+#if defined(ZR_NETWORK_REACTOR_USE_EPOLL)
+    if (network_reactor_current(ZR_TRUE) != ZR_NULL) {
+        return "epoll";
+    }
+#endif
+#if defined(_WIN32)
+    return "select";
+#else
+    return "poll";
+#endif
+}
@@ -0,0 +1,39 @@
+#ifndef ZR_VM_LIB_NETWORK_REACTOR_H
+#define ZR_VM_LIB_NETWORK_REACTOR_H
+
+#include "zr_vm_lib_network/network.h"
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef SOCKET ZrNetworkSocket;
+typedef int ZrNetworkSockLen;
+#define ZR_NETWORK_INVALID_SOCKET INVALID_SOCKET
+#define ZR_NETWORK_SHUT_RDWR SD_BOTH
+#define ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode) ((errorCode) == WSAEWOULDBLOCK || (errorCode) == WSAEINPROGRESS)
+#define ZR_NETWORK_SOCKET_INTERRUPTED(errorCode) ((errorCode) == WSAEINTR)
+#else
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+typedef int ZrNetworkSocket;
+typedef socklen_t ZrNetworkSockLen;
+#define ZR_NETWORK_INVALID_SOCKET (-1)
+#define ZR_NETWORK_SHUT_RDWR SHUT_RDWR
+#define ZR_NETWORK_SOCKET_WOULD_BLOCK(errorCode) ((errorCode) == EWOULDBLOCK || (errorCode) == EAGAIN || (errorCode) == EINPROGRESS)
+#define ZR_NETWORK_SOCKET_INTERRUPTED(errorCode) ((errorCode) == EINTR)
+#endif
+
+#define ZR_NETWORK_REACTOR_INTEREST_READ 1u
+#define ZR_NETWORK_REACTOR_INTEREST_WRITE 2u
+
+// returns 1 when ready, 0 on timeout and -1 on error, like the select() call it replaces.
+int zr_network_reactor_wait(ZrNetworkSocket socketHandle, TZrUInt32 interest, TZrUInt32 timeoutMs);
+void zr_network_reactor_forget(ZrNetworkSocket socketHandle);
+TZrUInt64 zr_network_reactor_now_ms(void);
+
+#endif
@@ -119,13 +119,18 @@ static TZrBool zr_network_tcp_listener_accept(ZrLibCallContext *context, SZrType
     ZrNetworkVmHandle *handle = zr_network_tcp_listener_handle(context);
     TZrUInt32 timeoutMs = ZR_NETWORK_WAIT_INFINITE;
     SZrNetworkStream stream;
+    SZrNetworkIdleHook previousHook;
+    TZrBool accepted;
 
     if (handle == ZR_NULL || !zr_network_read_timeout_arg(context, 0, timeoutMs, &timeoutMs)) {
         return ZR_FALSE;
     }
 
     memset(&stream, 0, sizeof(stream));
-    if (!ZrNetwork_ListenerAccept(&handle->value.listener, timeoutMs, &stream)) {
+    previousHook = zr_network_begin_cooperative_wait(context->state);
+    accepted = ZrNetwork_ListenerAccept(&handle->value.listener, timeoutMs, &stream);
+    zr_network_end_cooperative_wait(previousHook);
+    if (!accepted) {
         ZrLib_Value_SetNull(result);
         return ZR_TRUE;
     }
@@ -189,6 +194,8 @@ static TZrBool zr_network_tcp_stream_read(ZrLibCallContext *context, SZrTypeValu
     TZrSize maxBytes = 0;
     TZrSize readLength = 0;
     TZrByte *buffer;
+    SZrNetworkIdleHook previousHook;
+    TZrBool received;
 
     if (handle == ZR_NULL || !zr_network_read_byte_count_arg(context, 0, &maxBytes) ||
         !zr_network_read_timeout_arg(context, 1, timeoutMs, &timeoutMs)) {
@@ -200,7 +207,10 @@ static TZrBool zr_network_tcp_stream_read(ZrLibCallContext *context, SZrTypeValu
         return zr_network_raise_runtime_error(context->state, "failed to allocate TCP read buffer");
     }
 
-    if (!ZrNetwork_StreamRead(&handle->value.stream, timeoutMs, buffer, maxBytes, &readLength)) {
+    previousHook = zr_network_begin_cooperative_wait(context->state);
+    received = ZrNetwork_StreamRead(&handle->value.stream, timeoutMs, buffer, maxBytes, &readLength);
+    zr_network_end_cooperative_wait(previousHook);
+    if (!received) {
         free(buffer);
         ZrLib_Value_SetNull(result);
         return ZR_TRUE;
@@ -212,23 +222,72 @@ static TZrBool zr_network_tcp_stream_read(ZrLibCallContext *context, SZrTypeValu
     return ZR_TRUE;
 }
 
+static TZrBool zr_network_tcp_stream_read_bytes(ZrLibCallContext *context, SZrTypeValue *result) {
+    ZrNetworkVmHandle *handle = zr_network_tcp_stream_handle(context);
+    TZrUInt32 timeoutMs = ZR_NETWORK_WAIT_INFINITE;
+    TZrSize maxBytes = 0;
+    TZrSize readLength = 0;
+    SZrObject *bytes;
+    SZrGcNativeCallPin bytesPin;
+    SZrNetworkIdleHook previousHook;
+    TZrBool received;
+
+    if (handle == ZR_NULL || !zr_network_read_byte_count_arg(context, 0, &maxBytes) ||
+        !zr_network_read_timeout_arg(context, 1, timeoutMs, &timeoutMs)) {
+        return ZR_FALSE;
+    }
+
+    bytes = ZrLib_Bytes_New(context->state, ZR_NULL, maxBytes);
+    if (bytes == ZR_NULL) {
+        return zr_network_raise_runtime_error(context->state, "failed to allocate TCP read buffer");
+    }
+    ZrLib_Value_SetObject(context->state, result, bytes, ZR_VALUE_TYPE_OBJECT);
+
+    // queued tasks may run (and collect) while the socket is not ready; the buffer is only on the C stack.
+    ZrCore_Gc_NativeCallPinObject(context->state, ZR_CAST_RAW_OBJECT_AS_SUPER(bytes), &bytesPin);
+    previousHook = zr_network_begin_cooperative_wait(context->state);
+    received = ZrNetwork_StreamRead(&handle->value.stream, timeoutMs, ZrLib_Bytes_Data(bytes), maxBytes, &readLength);
+    zr_network_end_cooperative_wait(previousHook);
+    ZrCore_Gc_NativeCallUnpin(context->state->global, &bytesPin);
+    if (!received) {
+        ZrLib_Value_SetNull(result);
+        return ZR_TRUE;
+    }
+
+    return ZrLib_Bytes_Resize(context->state, bytes, readLength);
+}
+
 static TZrBool zr_network_tcp_stream_write(ZrLibCallContext *context, SZrTypeValue *result) {
     ZrNetworkVmHandle *handle = zr_network_tcp_stream_handle(context);
+    SZrTypeValue *payload = ZrLib_CallContext_Argument(context, 0);
+    SZrObject *bytes;
     SZrString *text = ZR_NULL;
     TZrSize written = 0;
-    const TZrChar *nativeText;
+    const TZrByte *data;
+    TZrSize length;
+    SZrNetworkIdleHook previousHook;
 
-    if (handle == ZR_NULL || !ZrLib_CallContext_ReadString(context, 0, &text)) {
+    if (handle == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    nativeText = ZrCore_String_GetNativeString(text);
-    if (!ZrNetwork_StreamWrite(&handle->value.stream,
-                               (const TZrByte *) nativeText,
-                               nativeText != ZR_NULL ? strlen(nativeText) : 0,
-                               &written)) {
+    bytes = payload != ZR_NULL ? ZrLib_Value_GetBytes(context->state, payload) : ZR_NULL;
+    if (bytes != ZR_NULL) {
+        data = ZrLib_Bytes_Data(bytes);
+        length = ZrLib_Bytes_Length(bytes);
+    } else {
+        if (!ZrLib_CallContext_ReadString(context, 0, &text)) {
+            return ZR_FALSE;
+        }
+        data = (const TZrByte *) ZrCore_String_GetNativeString(text);
+        length = data != ZR_NULL ? strlen((const TZrChar *) data) : 0;
+    }
+
+    previousHook = zr_network_begin_cooperative_wait(context->state);
+    if (!ZrNetwork_StreamWrite(&handle->value.stream, data, length, &written)) {
         written = 0;
     }
+    zr_network_end_cooperative_wait(previousHook);
 
     ZrLib_Value_SetInt(context->state, result, (TZrInt64) written);
     return ZR_TRUE;
@@ -331,8 +390,11 @@ static const ZrLibMethodDescriptor g_tcp_listener_methods[] = {
 static const ZrLibMethodDescriptor g_tcp_stream_methods[] = {
         ZR_LIB_METHOD_DESCRIPTOR_INIT("read", 2, 2, zr_network_tcp_stream_read, "string",
                                       "Read bytes from the stream or return null on timeout/EOF.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("readBytes", 2, 2, zr_network_tcp_stream_read_bytes, "zr.system.Bytes",
+                                      "Read raw bytes into a Bytes buffer or return null on timeout/EOF.", ZR_FALSE,
+                                      ZR_NULL, 0),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("write", 1, 1, zr_network_tcp_stream_write, "int",
-                                      "Write a UTF-8 string to the stream.", ZR_FALSE, ZR_NULL, 0),
+                                      "Write a UTF-8 string or Bytes buffer to the stream.", ZR_FALSE, ZR_NULL, 0),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("close", 0, 0, zr_network_tcp_stream_close, "null",
                                       "Close the TCP stream.", ZR_FALSE, ZR_NULL, 0),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("isClosed", 0, 0, zr_network_tcp_stream_is_closed, "bool",
@@ -44,18 +44,30 @@ static TZrBool zr_network_udp_finish_socket(SZrState *state, SZrTypeValue *resul
 static TZrBool zr_network_udp_finish_packet(SZrState *state,
                                             SZrTypeValue *result,
                                             const SZrNetworkEndpoint *remoteEndpoint,
-                                            const TZrByte *buffer,
+                                            SZrObject *bytes,
                                             TZrSize readLength) {
     SZrObject *packet;
     SZrTypeValue fieldValue;
+    const TZrChar *payload;
+    const TZrChar *terminator;
 
     packet = zr_network_new_typed_object(state, kUdpModuleName, "UdpPacket");
     if (packet == ZR_NULL) {
         return zr_network_raise_runtime_error(state, "failed to allocate UdpPacket object");
     }
 
-    ZrLib_Value_SetString(state, &fieldValue, (const TZrChar *) buffer);
+    // the string view keeps its historical NUL-terminated semantics; `bytes` carries the exact datagram.
+    payload = (const TZrChar *) ZrLib_Bytes_Data(bytes);
+    terminator = payload != ZR_NULL ? (const TZrChar *) memchr(payload, '\0', readLength) : ZR_NULL;
+    ZrLib_Value_SetStringObject(state,
+                                &fieldValue,
+                                ZrCore_String_Create(state,
+                                                     (TZrNativeString) payload,
+                                                     terminator != ZR_NULL ? (TZrSize) (terminator - payload)
+                                                                           : (payload != ZR_NULL ? readLength : 0)));
     ZrLib_Object_SetFieldCString(state, packet, "payload", &fieldValue);
+    ZrLib_Value_SetObject(state, &fieldValue, bytes, ZR_VALUE_TYPE_OBJECT);
+    ZrLib_Object_SetFieldCString(state, packet, "bytes", &fieldValue);
     ZrLib_Value_SetInt(state, &fieldValue, (TZrInt64) readLength);
     ZrLib_Object_SetFieldCString(state, packet, "length", &fieldValue);
     ZrLib_Value_SetString(state,
@@ -133,21 +145,35 @@ static TZrBool zr_network_udp_port(ZrLibCallContext *context, SZrTypeValue *resu
 static TZrBool zr_network_udp_send(ZrLibCallContext *context, SZrTypeValue *result) {
     ZrNetworkVmHandle *handle = zr_network_udp_handle(context);
     SZrNetworkEndpoint target;
+    SZrTypeValue *payloadValue;
+    SZrObject *bytes;
     SZrString *payload = ZR_NULL;
-    const TZrChar *nativePayload;
+    const TZrByte *data;
+    TZrSize length;
     TZrSize written = 0;
     TZrChar error[256];
 
-    if (handle == ZR_NULL || !zr_network_read_endpoint_args(context, 0, 1, &target) ||
-        !ZrLib_CallContext_ReadString(context, 2, &payload)) {
+    if (handle == ZR_NULL || !zr_network_read_endpoint_args(context, 0, 1, &target)) {
         return ZR_FALSE;
     }
 
-    nativePayload = ZrCore_String_GetNativeString(payload);
+    payloadValue = ZrLib_CallContext_Argument(context, 2);
+    bytes = payloadValue != ZR_NULL ? ZrLib_Value_GetBytes(context->state, payloadValue) : ZR_NULL;
+    if (bytes != ZR_NULL) {
+        data = ZrLib_Bytes_Data(bytes);
+        length = ZrLib_Bytes_Length(bytes);
+    } else {
+        if (!ZrLib_CallContext_ReadString(context, 2, &payload)) {
+            return ZR_FALSE;
+        }
+        data = (const TZrByte *)ZrCore_String_GetNativeString(payload);
+        length = data != ZR_NULL ? strlen((const TZrChar *)data) : 0;
+    }
+
     if (!ZrNetwork_UdpSocketSend(&handle->value.udpSocket,
                                  &target,
-                                 (const TZrByte *)nativePayload,
-                                 nativePayload != ZR_NULL ? strlen(nativePayload) : 0,
+                                 data,
+                                 length,
                                  &written,
                                  error,
                                  sizeof(error))) {
@@ -164,38 +190,42 @@ static TZrBool zr_network_udp_receive(ZrLibCallContext *context, SZrTypeValue *r
     TZrSize maxBytes = 0;
     TZrSize readLength = 0;
     SZrNetworkEndpoint remoteEndpoint;
-    TZrByte *buffer;
+    SZrObject *bytes;
+    SZrGcNativeCallPin bytesPin;
+    SZrNetworkIdleHook previousHook;
+    TZrBool received;
 
     if (handle == ZR_NULL || !zr_network_read_byte_count_arg(context, 0, &maxBytes) ||
         !zr_network_read_timeout_arg(context, 1, timeoutMs, &timeoutMs)) {
         return ZR_FALSE;
     }
 
-    buffer = (TZrByte *)malloc(maxBytes + 1);
-    if (buffer == ZR_NULL) {
+    bytes = ZrLib_Bytes_New(context->state, ZR_NULL, maxBytes);
+    if (bytes == ZR_NULL) {
         return zr_network_raise_runtime_error(context->state, "failed to allocate UDP receive buffer");
     }
+    ZrLib_Value_SetObject(context->state, result, bytes, ZR_VALUE_TYPE_OBJECT);
 
     memset(&remoteEndpoint, 0, sizeof(remoteEndpoint));
-    if (!ZrNetwork_UdpSocketReceive(&handle->value.udpSocket,
-                                    timeoutMs,
-                                    buffer,
-                                    maxBytes,
-                                    &readLength,
-                                    &remoteEndpoint)) {
-        free(buffer);
+    ZrCore_Gc_NativeCallPinObject(context->state, ZR_CAST_RAW_OBJECT_AS_SUPER(bytes), &bytesPin);
+    previousHook = zr_network_begin_cooperative_wait(context->state);
+    received = ZrNetwork_UdpSocketReceive(&handle->value.udpSocket,
+                                          timeoutMs,
+                                          ZrLib_Bytes_Data(bytes),
+                                          maxBytes,
+                                          &readLength,
+                                          &remoteEndpoint);
+    zr_network_end_cooperative_wait(previousHook);
+    ZrCore_Gc_NativeCallUnpin(context->state->global, &bytesPin);
+    if (!received) {
         ZrLib_Value_SetNull(result);
         return ZR_TRUE;
     }
 
-    buffer[readLength] = '\0';
-    if (!zr_network_udp_finish_packet(context->state, result, &remoteEndpoint, buffer, readLength)) {
-        free(buffer);
+    if (!ZrLib_Bytes_Resize(context->state, bytes, readLength)) {
         return ZR_FALSE;
     }
-
-    free(buffer);
-    return ZR_TRUE;
+    return zr_network_udp_finish_packet(context->state, result, &remoteEndpoint, bytes, readLength);
 }
 
 static const ZrLibFunctionDescriptor g_udp_functions[] = {
@@ -204,7 +234,7 @@ static const ZrLibFunctionDescriptor g_udp_functions[] = {
 
 static const ZrLibMethodDescriptor g_udp_socket_methods[] = {
         ZR_LIB_METHOD_DESCRIPTOR_INIT("send", 3, 3, zr_network_udp_send, "int",
-                                      "Send a UDP datagram to host/port.", ZR_FALSE, ZR_NULL, 0),
+                                      "Send a UTF-8 string or Bytes datagram to host/port.", ZR_FALSE, ZR_NULL, 0),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("receive", 2, 2, zr_network_udp_receive, "UdpPacket",
                                       "Receive a UDP datagram or return null on timeout.", ZR_FALSE, ZR_NULL, 0),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("close", 0, 0, zr_network_udp_close, "null",
@@ -219,6 +249,7 @@ static const ZrLibMethodDescriptor g_udp_socket_methods[] = {
 
 static const ZrLibFieldDescriptor g_udp_packet_fields[] = {
         ZR_LIB_FIELD_DESCRIPTOR_INIT("payload", "string", "Packet payload as a string."),
+        ZR_LIB_FIELD_DESCRIPTOR_INIT("bytes", "zr.system.Bytes", "Packet payload as a raw byte buffer."),
         ZR_LIB_FIELD_DESCRIPTOR_INIT("host", "string", "Remote sender host."),
         ZR_LIB_FIELD_DESCRIPTOR_INIT("port", "int", "Remote sender port."),
         ZR_LIB_FIELD_DESCRIPTOR_INIT("length", "int", "Payload length in bytes."),
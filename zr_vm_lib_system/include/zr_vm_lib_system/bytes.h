@@ -0,0 +1,32 @@
+//
+// zr.system.Bytes native callbacks.
+//
+
+#ifndef ZR_VM_LIB_SYSTEM_BYTES_H
+#define ZR_VM_LIB_SYSTEM_BYTES_H
+
+#include "zr_vm_lib_system/conf.h"
+
+TZrBool ZrSystem_Bytes_Constructor(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_GetItem(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_SetItem(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_GetItemReadonlyInlineFast(SZrState *state,
+                                                 const SZrTypeValue *selfValue,
+                                                 const SZrTypeValue *indexValue,
+                                                 SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_SetItemReadonlyInlineNoResultFast(SZrState *state,
+                                                         const SZrTypeValue *selfValue,
+                                                         const SZrTypeValue *indexValue,
+                                                         const SZrTypeValue *byteValue);
+TZrBool ZrSystem_Bytes_Slice(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_Copy(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_CopyFrom(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_Fill(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_ToArray(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_ToString(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_FromString(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_Bytes_FromArray(ZrLibCallContext *context, SZrTypeValue *result);
+// turns the declared `length` field of the materialized Bytes prototype into a read-only native property.
+TZrBool ZrSystem_Bytes_InstallLengthProperty(SZrState *state, SZrObjectModule *module);
+
+#endif // ZR_VM_LIB_SYSTEM_BYTES_H
@@ -0,0 +1,16 @@
+//
+// zr.system.StringBuilder native callbacks.
+//
+
+#ifndef ZR_VM_LIB_SYSTEM_STRING_BUILDER_H
+#define ZR_VM_LIB_SYSTEM_STRING_BUILDER_H
+
+#include "zr_vm_lib_system/conf.h"
+
+TZrBool ZrSystem_StringBuilder_Constructor(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_StringBuilder_Append(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_StringBuilder_Clear(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_StringBuilder_Length(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool ZrSystem_StringBuilder_ToString(ZrLibCallContext *context, SZrTypeValue *result);
+
+#endif // ZR_VM_LIB_SYSTEM_STRING_BUILDER_H
@@ -88,32 +88,23 @@ static TZrBool system_assembly_find_current_resource(ZrLibCallContext *context,
     return ZR_TRUE;
 }
 
-static TZrBool system_assembly_make_byte_array(SZrState *state,
-                                               const TZrByte *bytes,
-                                               TZrSize byteCount,
-                                               SZrTypeValue *result) {
-    SZrObject *array;
-    TZrSize index;
+static TZrBool system_assembly_make_bytes(SZrState *state,
+                                          const TZrByte *bytes,
+                                          TZrSize byteCount,
+                                          SZrTypeValue *result) {
+    SZrObject *buffer;
 
     if (state == ZR_NULL || result == ZR_NULL || (bytes == ZR_NULL && byteCount > 0)) {
         errno = EINVAL;
         return ZR_FALSE;
     }
 
-    array = ZrLib_Array_New(state);
-    if (array == ZR_NULL) {
+    buffer = ZrLib_Bytes_New(state, bytes, byteCount);
+    if (buffer == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    for (index = 0; index < byteCount; index++) {
-        SZrTypeValue entryValue;
-        ZrLib_Value_SetInt(state, &entryValue, (TZrInt64)bytes[index]);
-        if (!ZrLib_Array_PushValue(state, array, &entryValue)) {
-            return ZR_FALSE;
-        }
-    }
-
-    ZrLib_Value_SetObject(state, result, array, ZR_VALUE_TYPE_ARRAY);
+    ZrLib_Value_SetObject(state, result, buffer, ZR_VALUE_TYPE_OBJECT);
     return ZR_TRUE;
 }
 
@@ -215,7 +206,7 @@ TZrBool ZrSystem_Assembly_ReadResourceBytes(ZrLibCallContext *context, SZrTypeVa
         return system_assembly_raise_resource_error(context->state, resourceName, error);
     }
 
-    success = system_assembly_make_byte_array(context->state, bytes, byteCount, result);
+    success = system_assembly_make_bytes(context->state, bytes, byteCount, result);
     ZrLibrary_Zrm_FreeBytes(bytes);
     ZrLibrary_Zrm_Close(&archive);
     return success;
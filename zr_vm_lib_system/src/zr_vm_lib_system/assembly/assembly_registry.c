@@ -20,8 +20,8 @@ const ZrLibModuleDescriptor *ZrSystem_AssemblyRegistry_GetModule(void) {
             {"readResourceText", 1, 1, ZrSystem_Assembly_ReadResourceText, "string",
              "Read a current project assembly resource as UTF-8 text.",
              g_resource_name_parameter, ZR_ARRAY_COUNT(g_resource_name_parameter), ZR_NULL, 0, 0U, 0U},
-            {"readResourceBytes", 1, 1, ZrSystem_Assembly_ReadResourceBytes, "array",
-             "Read a current project assembly resource as byte integers.",
+            {"readResourceBytes", 1, 1, ZrSystem_Assembly_ReadResourceBytes, "zr.system.Bytes",
+             "Read a current project assembly resource into a Bytes buffer.",
              g_resource_name_parameter, ZR_ARRAY_COUNT(g_resource_name_parameter), ZR_NULL, 0, 0U, 0U},
     };
     static const ZrLibTypeHintDescriptor kHints[] = {
@@ -29,8 +29,8 @@ const ZrLibModuleDescriptor *ZrSystem_AssemblyRegistry_GetModule(void) {
              "Return whether the current project assembly contains the named resource."},
             {"readResourceText", "function", "readResourceText(name: string): string",
              "Read a current project assembly resource as UTF-8 text."},
-            {"readResourceBytes", "function", "readResourceBytes(name: string): array",
-             "Read a current project assembly resource as byte integers."},
+            {"readResourceBytes", "function", "readResourceBytes(name: string): zr.system.Bytes",
+             "Read a current project assembly resource into a Bytes buffer."},
     };
     static const TZrChar kHintsJson[] =
             "{\n"
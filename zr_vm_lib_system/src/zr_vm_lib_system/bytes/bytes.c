@@ -0,0 +1,384 @@
+//
+// zr.system.Bytes contiguous byte buffer.
+//
+
+#include "zr_vm_lib_system/bytes.h"
+
+#include "zr_vm_core/closure.h"
+#include "zr_vm_core/debug.h"
+#include "zr_vm_core/gc.h"
+#include "zr_vm_core/module.h"
+#include "zr_vm_core/object.h"
+#include "zr_vm_core/stack.h"
+#include "zr_vm_core/string.h"
+#include "zr_vm_core/utf8.h"
+#include "zr_vm_core/value.h"
+
+#include <string.h>
+
+static SZrObject *system_bytes_self(const ZrLibCallContext *context) {
+    SZrObject *self;
+
+    if (context == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    self = ZrLib_Value_GetBytes(context->state, ZrLib_CallContext_Self(context));
+    if (self == ZR_NULL) {
+        ZrCore_Debug_RunError(context->state, "Bytes receiver is not a byte buffer");
+    }
+    return self;
+}
+
+static TZrSize system_bytes_read_index(SZrState *state, const SZrObject *bytes, const SZrTypeValue *indexValue) {
+    TZrInt64 index;
+
+    if (indexValue == ZR_NULL || !ZR_VALUE_IS_TYPE_SIGNED_INT(indexValue->type)) {
+        ZrCore_Debug_RunError(state, "Bytes index must be an int");
+    }
+
+    index = indexValue->value.nativeObject.nativeInt64;
+    if (index < 0 || (TZrUInt64)index >= (TZrUInt64)bytes->byteStorageLength) {
+        ZrCore_Debug_RunError(state, "Bytes index out of range");
+    }
+    return (TZrSize)index;
+}
+
+static TZrByte system_bytes_read_byte_value(SZrState *state, const SZrTypeValue *value) {
+    TZrInt64 intValue;
+
+    if (value == ZR_NULL ||
+        (!ZR_VALUE_IS_TYPE_SIGNED_INT(value->type) && !ZR_VALUE_IS_TYPE_UNSIGNED_INT(value->type))) {
+        ZrCore_Debug_RunError(state, "Bytes value must be an int in 0..255");
+    }
+
+    intValue = ZR_VALUE_IS_TYPE_SIGNED_INT(value->type) ? value->value.nativeObject.nativeInt64
+                                                         : (TZrInt64)value->value.nativeObject.nativeUInt64;
+    if (intValue < 0 || intValue > 255) {
+        ZrCore_Debug_RunError(state, "Bytes value must be an int in 0..255");
+    }
+    return (TZrByte)intValue;
+}
+
+static TZrInt64 system_bytes_read_optional_int(const ZrLibCallContext *context, TZrSize index, TZrInt64 defaultValue) {
+    TZrInt64 value = defaultValue;
+
+    if (ZrLib_CallContext_ArgumentCount(context) > index) {
+        ZrLib_CallContext_ReadInt(context, index, &value);
+    }
+    return value;
+}
+
+// clamps a [start, end) pair to the view; negative positions count from the end like Array.slice.
+static void system_bytes_resolve_range(TZrSize length, TZrInt64 start, TZrInt64 end, TZrSize *outStart, TZrSize *outEnd) {
+    if (start < 0) {
+        start += (TZrInt64)length;
+    }
+    if (end < 0) {
+        end += (TZrInt64)length;
+    }
+    if (start < 0) {
+        start = 0;
+    }
+    if (end > (TZrInt64)length) {
+        end = (TZrInt64)length;
+    }
+    if (end < start) {
+        end = start;
+    }
+    if (start > (TZrInt64)length) {
+        start = end = (TZrInt64)length;
+    }
+    *outStart = (TZrSize)start;
+    *outEnd = (TZrSize)end;
+}
+
+static TZrBool system_bytes_finish(SZrState *state, SZrTypeValue *result, SZrObject *bytes) {
+    if (bytes == ZR_NULL) {
+        ZrCore_Debug_RunError(state, "failed to allocate Bytes");
+    }
+    ZrLib_Value_SetObject(state, result, bytes, ZR_VALUE_TYPE_OBJECT);
+    return ZR_TRUE;
+}
+
+static SZrObject *system_bytes_resolve_construct_target(ZrLibCallContext *context) {
+    SZrTypeValue *selfValue = ZrLib_CallContext_Self(context);
+    SZrObject *self = ZR_NULL;
+    SZrObjectPrototype *ownerPrototype = ZrLib_CallContext_OwnerPrototype(context);
+    SZrObjectPrototype *targetPrototype;
+
+    if (selfValue != ZR_NULL && selfValue->type == ZR_VALUE_TYPE_OBJECT && selfValue->value.object != ZR_NULL) {
+        self = ZR_CAST_OBJECT(context->state, selfValue->value.object);
+    }
+    if (self != ZR_NULL && ownerPrototype != ZR_NULL && ZrCore_Object_IsInstanceOfPrototype(self, ownerPrototype)) {
+        return self;
+    }
+
+    targetPrototype = ZrLib_CallContext_GetConstructTargetPrototype(context);
+    return ZrLib_Type_NewInstanceWithPrototype(context->state,
+                                               targetPrototype != ZR_NULL ? targetPrototype : ownerPrototype);
+}
+
+TZrBool ZrSystem_Bytes_Constructor(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self;
+    TZrInt64 length = system_bytes_read_optional_int(context, 0, 0);
+
+    if (length < 0) {
+        ZrCore_Debug_RunError(context->state, "Bytes length must be non-negative");
+    }
+
+    self = system_bytes_resolve_construct_target(context);
+    if (self == ZR_NULL || !ZrCore_Object_AllocateByteStorage(context->state, self, (TZrSize)length)) {
+        return ZR_FALSE;
+    }
+
+    return system_bytes_finish(context->state, result, self);
+}
+
+// `length` getter: reads the view size straight from the byte storage, so resizes and slices never go stale.
+static TZrInt64 system_bytes_length_getter(SZrState *state) {
+    TZrStackValuePointer base = state->callInfoList->functionBase.valuePointer;
+    SZrObject *bytes = ZrLib_Value_GetBytes(state, ZrCore_Stack_GetValue(base + 1));
+
+    ZrLib_Value_SetInt(state, ZrCore_Stack_GetValue(base), bytes != ZR_NULL ? (TZrInt64)bytes->byteStorageLength : 0);
+    state->stackTop.valuePointer = base + 1;
+    return 1;
+}
+
+TZrBool ZrSystem_Bytes_InstallLengthProperty(SZrState *state, SZrObjectModule *module) {
+    SZrString *typeName;
+    const SZrTypeValue *exported;
+    SZrObject *object;
+    SZrObjectPrototype *prototype;
+    SZrClosureNative *getter;
+
+    if (state == ZR_NULL || module == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    typeName = ZrCore_String_CreateFromNative(state, "Bytes");
+    exported = typeName != ZR_NULL ? ZrCore_Module_GetPubExport(state, module, typeName) : ZR_NULL;
+    if (exported == ZR_NULL || exported->type != ZR_VALUE_TYPE_OBJECT || exported->value.object == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    object = ZR_CAST_OBJECT(state, exported->value.object);
+    if (object->internalType != ZR_OBJECT_INTERNAL_TYPE_OBJECT_PROTOTYPE) {
+        return ZR_FALSE;
+    }
+    prototype = (SZrObjectPrototype *)object;
+
+    for (TZrUInt32 index = 0; index < prototype->memberDescriptorCount; index++) {
+        SZrMemberDescriptor *descriptor = &prototype->memberDescriptors[index];
+
+        if (descriptor->kind != ZR_MEMBER_DESCRIPTOR_KIND_FIELD || descriptor->isStatic || descriptor->name == ZR_NULL ||
+            strcmp(ZrCore_String_GetNativeString(descriptor->name), "length") != 0) {
+            continue;
+        }
+
+        getter = ZrCore_ClosureNative_New(state, 0);
+        if (getter == ZR_NULL) {
+            return ZR_FALSE;
+        }
+        getter->nativeFunction = system_bytes_length_getter;
+        ZrCore_RawObject_MarkAsPermanent(state, ZR_CAST_RAW_OBJECT_AS_SUPER(getter));
+        descriptor->kind = ZR_MEMBER_DESCRIPTOR_KIND_PROPERTY;
+        descriptor->getterFunction = ZR_CAST(SZrFunction *, ZR_CAST_RAW_OBJECT_AS_SUPER(getter));
+        return ZR_TRUE;
+    }
+    return ZR_FALSE;
+}
+
+TZrBool ZrSystem_Bytes_GetItem(ZrLibCallContext *context, SZrTypeValue *result) {
+    return context != ZR_NULL &&
+           ZrSystem_Bytes_GetItemReadonlyInlineFast(context->state,
+                                                    ZrLib_CallContext_Self(context),
+                                                    ZrLib_CallContext_Argument(context, 0),
+                                                    result);
+}
+
+TZrBool ZrSystem_Bytes_SetItem(ZrLibCallContext *context, SZrTypeValue *result) {
+    const SZrTypeValue *byteValue;
+
+    if (context == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    byteValue = ZrLib_CallContext_Argument(context, 1);
+    if (!ZrSystem_Bytes_SetItemReadonlyInlineNoResultFast(context->state,
+                                                          ZrLib_CallContext_Self(context),
+                                                          ZrLib_CallContext_Argument(context, 0),
+                                                          byteValue)) {
+        return ZR_FALSE;
+    }
+    if (result != ZR_NULL) {
+        ZrCore_Value_Copy(context->state, result, byteValue);
+    }
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_Bytes_GetItemReadonlyInlineFast(SZrState *state,
+                                                 const SZrTypeValue *selfValue,
+                                                 const SZrTypeValue *indexValue,
+                                                 SZrTypeValue *result) {
+    SZrObject *bytes = ZrLib_Value_GetBytes(state, selfValue);
+    TZrSize index;
+
+    if (bytes == ZR_NULL || result == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    index = system_bytes_read_index(state, bytes, indexValue);
+    ZrCore_Value_InitAsInt(state, result, (TZrInt64)ZrCore_Object_GetByteStorageData(bytes)[index]);
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_Bytes_SetItemReadonlyInlineNoResultFast(SZrState *state,
+                                                         const SZrTypeValue *selfValue,
+                                                         const SZrTypeValue *indexValue,
+                                                         const SZrTypeValue *byteValue) {
+    SZrObject *bytes = ZrLib_Value_GetBytes(state, selfValue);
+    TZrSize index;
+
+    if (bytes == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    index = system_bytes_read_index(state, bytes, indexValue);
+    ZrCore_Object_GetByteStorageData(bytes)[index] = system_bytes_read_byte_value(state, byteValue);
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_Bytes_Slice(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_bytes_self(context);
+    TZrSize start;
+    TZrSize end;
+
+    system_bytes_resolve_range(self->byteStorageLength,
+                               system_bytes_read_optional_int(context, 0, 0),
+                               system_bytes_read_optional_int(context, 1, (TZrInt64)self->byteStorageLength),
+                               &start,
+                               &end);
+    return system_bytes_finish(context->state, result, ZrLib_Bytes_NewSlice(context->state, self, start, end - start));
+}
+
+TZrBool ZrSystem_Bytes_Copy(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_bytes_self(context);
+
+    return system_bytes_finish(context->state,
+                               result,
+                               ZrLib_Bytes_New(context->state, ZrLib_Bytes_Data(self), ZrLib_Bytes_Length(self)));
+}
+
+TZrBool ZrSystem_Bytes_CopyFrom(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_bytes_self(context);
+    SZrObject *source = ZR_NULL;
+    TZrInt64 offset;
+    TZrSize count;
+
+    ZrLib_CallContext_ReadBytes(context, 0, &source);
+    offset = system_bytes_read_optional_int(context, 1, 0);
+    if (offset < 0 || (TZrUInt64)offset > (TZrUInt64)self->byteStorageLength) {
+        ZrCore_Debug_RunError(context->state, "Bytes.copyFrom offset out of range");
+    }
+
+    count = self->byteStorageLength - (TZrSize)offset;
+    if (source->byteStorageLength < count) {
+        count = source->byteStorageLength;
+    }
+    if (count > 0) {
+        // views of one storage may overlap, so this has to be a memmove.
+        memmove(ZrLib_Bytes_Data(self) + offset, ZrLib_Bytes_Data(source), count);
+    }
+    ZrLib_Value_SetInt(context->state, result, (TZrInt64)count);
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_Bytes_Fill(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_bytes_self(context);
+    TZrByte byteValue = system_bytes_read_byte_value(context->state, ZrLib_CallContext_Argument(context, 0));
+    TZrSize start;
+    TZrSize end;
+
+    system_bytes_resolve_range(self->byteStorageLength,
+                               system_bytes_read_optional_int(context, 1, 0),
+                               system_bytes_read_optional_int(context, 2, (TZrInt64)self->byteStorageLength),
+                               &start,
+                               &end);
+    if (end > start) {
+        memset(ZrLib_Bytes_Data(self) + start, byteValue, end - start);
+    }
+    return system_bytes_finish(context->state, result, self);
+}
+
+TZrBool ZrSystem_Bytes_ToArray(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_bytes_self(context);
+    SZrObject *array = ZrLib_Array_New(context->state);
+    TZrSize index;
+
+    if (array == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    for (index = 0; index < self->byteStorageLength; index++) {
+        SZrTypeValue value;
+        ZrLib_Value_SetInt(context->state, &value, (TZrInt64)ZrLib_Bytes_Data(self)[index]);
+        if (!ZrLib_Array_PushValue(context->state, array, &value)) {
+            return ZR_FALSE;
+        }
+    }
+
+    ZrLib_Value_SetObject(context->state, result, array, ZR_VALUE_TYPE_ARRAY);
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_Bytes_ToString(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_bytes_self(context);
+    SZrString *text;
+
+    if (!ZrCore_Utf8_IsValid((TZrNativeString)ZrLib_Bytes_Data(self), self->byteStorageLength)) {
+        ZrCore_Debug_RunError(context->state, "Bytes payload is not valid UTF-8");
+    }
+
+    text = ZrCore_String_Create(context->state, (TZrNativeString)ZrLib_Bytes_Data(self), self->byteStorageLength);
+    if (text == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    ZrLib_Value_SetStringObject(context->state, result, text);
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_Bytes_FromString(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrString *text = ZR_NULL;
+
+    if (!ZrLib_CallContext_ReadString(context, 0, &text) || text == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    return system_bytes_finish(context->state,
+                               result,
+                               ZrLib_Bytes_New(context->state,
+                                               (const TZrByte *)ZrCore_String_GetNativeString(text),
+                                               ZrCore_String_GetByteLength(text)));
+}
+
+TZrBool ZrSystem_Bytes_FromArray(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *array = ZR_NULL;
+    SZrObject *bytes;
+    TZrSize length;
+    TZrSize index;
+
+    if (!ZrLib_CallContext_ReadArray(context, 0, &array) || array == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    length = ZrLib_Array_Length(array);
+    bytes = ZrLib_Bytes_New(context->state, ZR_NULL, length);
+    if (bytes == ZR_NULL) {
+        return system_bytes_finish(context->state, result, ZR_NULL);
+    }
+    for (index = 0; index < length; index++) {
+        ZrLib_Bytes_Data(bytes)[index] =
+                system_bytes_read_byte_value(context->state, ZrLib_Array_Get(context->state, array, index));
+    }
+    return system_bytes_finish(context->state, result, bytes);
+}
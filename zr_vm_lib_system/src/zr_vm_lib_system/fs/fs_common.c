@@ -338,11 +338,25 @@ TZrBool ZrSystem_Fs_ReadOptionalIntArgument(const ZrLibCallContext *context,
     return ZrLib_CallContext_ReadInt(context, index, outValue);
 }
 
-TZrBool ZrSystem_Fs_ReadArrayArgument(const ZrLibCallContext *context, TZrSize index, SZrObject **outArray) {
-    if (outArray != ZR_NULL) {
-        *outArray = ZR_NULL;
+TZrBool ZrSystem_Fs_ReadBytesArgument(const ZrLibCallContext *context, TZrSize index, SZrObject **outBytes) {
+    SZrTypeValue *value;
+
+    if (outBytes != ZR_NULL) {
+        *outBytes = ZR_NULL;
+    }
+    if (context == ZR_NULL || outBytes == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    value = ZrLib_CallContext_Argument(context, index);
+    *outBytes = ZrLib_Value_GetBytes(context->state, value);
+    if (*outBytes != ZR_NULL) {
+        return ZR_TRUE;
+    }
+    if (value != ZR_NULL && value->type != ZR_VALUE_TYPE_ARRAY) {
+        ZrLib_CallContext_RaiseTypeError(context, index, "Bytes or array");
     }
-    return context != ZR_NULL && outArray != ZR_NULL && ZrLib_CallContext_ReadArray(context, index, outArray);
+    return ZrLib_CallContext_ReadArray(context, index, outBytes);
 }
 
 TZrBool ZrSystem_Fs_RaiseIOException(SZrState *state, const TZrChar *format, ...) {
@@ -102,7 +102,7 @@ static TZrBool system_fs_write_text_file(SZrState *state,
 static TZrBool system_fs_write_bytes_file(SZrState *state,
                                           const TZrChar *path,
                                           const TZrChar *mode,
-                                          SZrObject *array,
+                                          SZrObject *bytes,
                                           TZrInt64 *outWritten) {
     SZrLibrary_File_StreamOpenResult openResult;
     TZrBool success;
@@ -113,7 +113,7 @@ static TZrBool system_fs_write_bytes_file(SZrState *state,
         return ZR_FALSE;
     }
 
-    success = ZrSystem_Fs_WriteBytesToHandle(state, openResult.handle, array, outWritten);
+    success = ZrSystem_Fs_WriteBytesToHandle(state, openResult.handle, bytes, outWritten);
     savedErrno = errno;
     if (!ZrLibrary_File_CloseHandle(openResult.handle) && success) {
         return ZR_FALSE;
@@ -470,14 +470,14 @@ TZrBool ZrSystem_Fs_File_ReadBytes(ZrLibCallContext *context, SZrTypeValue *resu
 TZrBool ZrSystem_Fs_File_WriteBytes(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *self = ZrSystem_Fs_SelfObject(context);
     const TZrChar *fullPath = ZR_NULL;
-    SZrObject *array = ZR_NULL;
+    SZrObject *bytes = ZR_NULL;
     TZrInt64 written = 0;
     if (self == ZR_NULL || result == ZR_NULL ||
         !system_fs_self_full_path(context->state, self, &fullPath) ||
-        !ZrSystem_Fs_ReadArrayArgument(context, 0, &array)) {
+        !ZrSystem_Fs_ReadBytesArgument(context, 0, &bytes)) {
         return ZR_FALSE;
     }
-    if (!system_fs_write_bytes_file(context->state, fullPath, "w", array, &written)) {
+    if (!system_fs_write_bytes_file(context->state, fullPath, "w", bytes, &written)) {
         return ZrSystem_Fs_RaiseErrnoIOException(context->state, "writeBytes", fullPath);
     }
     ZrSystem_Fs_RefreshEntryObject(context->state, self, ZR_NULL, ZR_NULL);
@@ -488,14 +488,14 @@ TZrBool ZrSystem_Fs_File_WriteBytes(ZrLibCallContext *context, SZrTypeValue *res
 TZrBool ZrSystem_Fs_File_AppendBytes(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *self = ZrSystem_Fs_SelfObject(context);
     const TZrChar *fullPath = ZR_NULL;
-    SZrObject *array = ZR_NULL;
+    SZrObject *bytes = ZR_NULL;
     TZrInt64 written = 0;
     if (self == ZR_NULL || result == ZR_NULL ||
         !system_fs_self_full_path(context->state, self, &fullPath) ||
-        !ZrSystem_Fs_ReadArrayArgument(context, 0, &array)) {
+        !ZrSystem_Fs_ReadBytesArgument(context, 0, &bytes)) {
         return ZR_FALSE;
     }
-    if (!system_fs_write_bytes_file(context->state, fullPath, "a", array, &written)) {
+    if (!system_fs_write_bytes_file(context->state, fullPath, "a", bytes, &written)) {
         return ZrSystem_Fs_RaiseErrnoIOException(context->state, "appendBytes", fullPath);
     }
     ZrSystem_Fs_RefreshEntryObject(context->state, self, ZR_NULL, ZR_NULL);
@@ -52,7 +52,8 @@ TZrBool ZrSystem_Fs_ReadOptionalIntArgument(const ZrLibCallContext *context,
                                             TZrSize index,
                                             TZrInt64 defaultValue,
                                             TZrInt64 *outValue);
-TZrBool ZrSystem_Fs_ReadArrayArgument(const ZrLibCallContext *context, TZrSize index, SZrObject **outArray);
+// accepts a zr.system.Bytes buffer or, for compatibility, an int array.
+TZrBool ZrSystem_Fs_ReadBytesArgument(const ZrLibCallContext *context, TZrSize index, SZrObject **outBytes);
 
 TZrBool ZrSystem_Fs_RaiseIOException(SZrState *state, const TZrChar *format, ...);
 TZrBool ZrSystem_Fs_RaiseErrnoIOException(SZrState *state, const TZrChar *action, const TZrChar *path);
@@ -94,7 +95,7 @@ TZrBool ZrSystem_Fs_ReadTextFromHandle(SZrState *state,
                                        ZR_OUT TZrInt64 *outReadCount);
 TZrBool ZrSystem_Fs_WriteBytesToHandle(SZrState *state,
                                        TZrLibrary_File_Handle handle,
-                                       SZrObject *array,
+                                       SZrObject *bytes,
                                        ZR_OUT TZrInt64 *outWrittenCount);
 TZrBool ZrSystem_Fs_WriteTextToHandle(SZrState *state,
                                       TZrLibrary_File_Handle handle,
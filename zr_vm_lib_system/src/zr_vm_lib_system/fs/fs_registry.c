@@ -22,7 +22,7 @@ static const ZrLibParameterDescriptor g_path_and_text_parameters[] = {
 };
 
 static const ZrLibParameterDescriptor g_bytes_parameter[] = {
-        {"bytes", "array", "Byte array represented as integers 0..255."},
+        {"bytes", "any", "zr.system.Bytes buffer or int array of 0..255 values."},
 };
 
 static const ZrLibParameterDescriptor g_create_recursive_parameter[] = {
@@ -127,13 +127,13 @@ static const ZrLibMethodDescriptor g_file_methods[] = {
         ZR_LIB_METHOD_DESCRIPTOR_INIT("appendText", 1, 1, ZrSystem_Fs_File_AppendText, "int",
                                       "Append UTF-8 text to the file.", ZR_FALSE,
                                       g_text_parameter, ZR_ARRAY_COUNT(g_text_parameter)),
-        ZR_LIB_METHOD_DESCRIPTOR_INIT("readBytes", 0, 0, ZrSystem_Fs_File_ReadBytes, "array",
-                                      "Read the whole file as byte integers.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("readBytes", 0, 0, ZrSystem_Fs_File_ReadBytes, "zr.system.Bytes",
+                                      "Read the whole file into a byte buffer.", ZR_FALSE, ZR_NULL, 0),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("writeBytes", 1, 1, ZrSystem_Fs_File_WriteBytes, "int",
-                                      "Replace file contents with byte integers.", ZR_FALSE,
+                                      "Replace file contents with a byte buffer.", ZR_FALSE,
                                       g_bytes_parameter, ZR_ARRAY_COUNT(g_bytes_parameter)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("appendBytes", 1, 1, ZrSystem_Fs_File_AppendBytes, "int",
-                                      "Append byte integers to the file.", ZR_FALSE,
+                                      "Append a byte buffer to the file.", ZR_FALSE,
                                       g_bytes_parameter, ZR_ARRAY_COUNT(g_bytes_parameter)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("copyTo", 1, 2, ZrSystem_Fs_File_CopyTo, "File",
                                       "Copy this file to a new path.", ZR_FALSE,
@@ -170,7 +170,7 @@ static const ZrLibMethodDescriptor g_folder_methods[] = {
 };
 
 static const ZrLibMethodDescriptor g_stream_reader_methods[] = {
-        ZR_LIB_METHOD_DESCRIPTOR_INIT("readBytes", 0, 1, ZrSystem_Fs_Stream_ReadBytes, "array",
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("readBytes", 0, 1, ZrSystem_Fs_Stream_ReadBytes, "zr.system.Bytes",
                                       "Read bytes from the current position.", ZR_FALSE,
                                       g_read_count_parameters, ZR_ARRAY_COUNT(g_read_count_parameters)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("readText", 0, 1, ZrSystem_Fs_Stream_ReadText, "string",
@@ -180,7 +180,7 @@ static const ZrLibMethodDescriptor g_stream_reader_methods[] = {
 
 static const ZrLibMethodDescriptor g_stream_writer_methods[] = {
         ZR_LIB_METHOD_DESCRIPTOR_INIT("writeBytes", 1, 1, ZrSystem_Fs_Stream_WriteBytes, "int",
-                                      "Write byte integers at the current position.", ZR_FALSE,
+                                      "Write a byte buffer at the current position.", ZR_FALSE,
                                       g_bytes_parameter, ZR_ARRAY_COUNT(g_bytes_parameter)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("writeText", 1, 1, ZrSystem_Fs_Stream_WriteText, "int",
                                       "Write UTF-8 text at the current position.", ZR_FALSE,
@@ -190,14 +190,14 @@ static const ZrLibMethodDescriptor g_stream_writer_methods[] = {
 };
 
 static const ZrLibMethodDescriptor g_file_stream_methods[] = {
-        ZR_LIB_METHOD_DESCRIPTOR_INIT("readBytes", 0, 1, ZrSystem_Fs_Stream_ReadBytes, "array",
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("readBytes", 0, 1, ZrSystem_Fs_Stream_ReadBytes, "zr.system.Bytes",
                                       "Read bytes from the current position.", ZR_FALSE,
                                       g_read_count_parameters, ZR_ARRAY_COUNT(g_read_count_parameters)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("readText", 0, 1, ZrSystem_Fs_Stream_ReadText, "string",
                                       "Read UTF-8 text from the current position.", ZR_FALSE,
                                       g_read_count_parameters, ZR_ARRAY_COUNT(g_read_count_parameters)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("writeBytes", 1, 1, ZrSystem_Fs_Stream_WriteBytes, "int",
-                                      "Write byte integers at the current position.", ZR_FALSE,
+                                      "Write a byte buffer at the current position.", ZR_FALSE,
                                       g_bytes_parameter, ZR_ARRAY_COUNT(g_bytes_parameter)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("writeText", 1, 1, ZrSystem_Fs_Stream_WriteText, "int",
                                       "Write UTF-8 text at the current position.", ZR_FALSE,
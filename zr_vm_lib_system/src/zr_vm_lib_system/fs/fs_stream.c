@@ -252,15 +252,27 @@ void ZrSystem_Fs_StreamFinalize(SZrState *state, SZrRawObject *rawObject) {
     system_fs_set_hidden_native_pointer(state, object, ZR_SYSTEM_FS_HIDDEN_STREAM_FIELD, ZR_NULL);
 }
 
+static TZrSize system_fs_initial_bytes_capacity(TZrLibrary_File_Handle handle, TZrInt64 count) {
+    TZrInt64 position = 0;
+    TZrInt64 length = 0;
+
+    if (count >= 0) {
+        return (TZrSize)count;
+    }
+    if (ZrLibrary_File_GetHandlePosition(handle, &position) && ZrLibrary_File_GetHandleLength(handle, &length) &&
+        length > position) {
+        return (TZrSize)(length - position);
+    }
+    return 4096U;
+}
+
 TZrBool ZrSystem_Fs_ReadBytesFromHandle(SZrState *state,
                                         TZrLibrary_File_Handle handle,
                                         TZrInt64 count,
                                         SZrTypeValue *result,
                                         ZR_OUT TZrInt64 *outReadCount) {
-    SZrObject *array;
-    unsigned char *bytes = ZR_NULL;
-    TZrSize size = 0;
-    TZrSize index;
+    SZrObject *bytes;
+    TZrSize usedSize = 0;
 
     if (outReadCount != ZR_NULL) {
         *outReadCount = 0;
@@ -270,29 +282,59 @@ TZrBool ZrSystem_Fs_ReadBytesFromHandle(SZrState *state,
         return ZR_FALSE;
     }
 
-    if (!system_fs_read_buffer_from_handle(handle, count, &bytes, &size)) {
+    /*
+     * Read straight into the Bytes storage sized from the remaining file length; only a file that
+     * grows while being read (or an unsized handle) pays for a storage resize.
+     */
+    bytes = ZrLib_Bytes_New(state, ZR_NULL, system_fs_initial_bytes_capacity(handle, count));
+    if (bytes == ZR_NULL) {
+        errno = ENOMEM;
         return ZR_FALSE;
     }
+    ZrLib_Value_SetObject(state, result, bytes, ZR_VALUE_TYPE_OBJECT);
 
-    array = ZrLib_Array_New(state);
-    if (array == ZR_NULL) {
-        free(bytes);
-        return ZR_FALSE;
-    }
+    for (;;) {
+        TZrSize readSize = 0;
+
+        if (usedSize == ZrLib_Bytes_Length(bytes)) {
+            unsigned char chunk[4096];
+
+            if (count >= 0) {
+                break;
+            }
+            if (!ZrLibrary_File_ReadHandle(handle, chunk, sizeof(chunk), &readSize)) {
+                return ZR_FALSE;
+            }
+            if (readSize == 0) {
+                break;
+            }
+            if (!ZrLib_Bytes_Resize(state, bytes, usedSize + readSize)) {
+                errno = ENOMEM;
+                return ZR_FALSE;
+            }
+            memcpy(ZrLib_Bytes_Data(bytes) + usedSize, chunk, readSize);
+            usedSize += readSize;
+            continue;
+        }
 
-    for (index = 0; index < size; index++) {
-        SZrTypeValue value;
-        ZrLib_Value_SetInt(state, &value, (TZrInt64)bytes[index]);
-        if (!ZrLib_Array_PushValue(state, array, &value)) {
-            free(bytes);
+        if (!ZrLibrary_File_ReadHandle(handle,
+                                       ZrLib_Bytes_Data(bytes) + usedSize,
+                                       ZrLib_Bytes_Length(bytes) - usedSize,
+                                       &readSize)) {
             return ZR_FALSE;
         }
+        if (readSize == 0) {
+            break;
+        }
+        usedSize += readSize;
     }
 
-    free(bytes);
-    ZrLib_Value_SetObject(state, result, array, ZR_VALUE_TYPE_ARRAY);
+    if (usedSize != ZrLib_Bytes_Length(bytes) && !ZrLib_Bytes_Resize(state, bytes, usedSize)) {
+        errno = ENOMEM;
+        return ZR_FALSE;
+    }
     if (outReadCount != ZR_NULL) {
-        *outReadCount = (TZrInt64)size;
+        *outReadCount = (TZrInt64)usedSize;
     }
     return ZR_TRUE;
 }
@@ -338,32 +380,43 @@ TZrBool ZrSystem_Fs_ReadTextFromHandle(SZrState *state,
 
 TZrBool ZrSystem_Fs_WriteBytesToHandle(SZrState *state,
                                        TZrLibrary_File_Handle handle,
-                                       SZrObject *array,
+                                       SZrObject *bytes,
                                        ZR_OUT TZrInt64 *outWrittenCount) {
     TZrSize length;
-    unsigned char *bytes;
+    unsigned char *buffer;
     TZrSize index;
 
     if (outWrittenCount != ZR_NULL) {
         *outWrittenCount = 0;
     }
-    if (state == ZR_NULL || array == ZR_NULL) {
+    if (state == ZR_NULL || bytes == ZR_NULL) {
         errno = EINVAL;
         return ZR_FALSE;
     }
 
-    length = ZrLib_Array_Length(array);
-    bytes = (unsigned char *)malloc(length > 0 ? length : 1);
-    if (bytes == ZR_NULL) {
+    if (bytes->byteStorage != ZR_NULL) {
+        length = ZrLib_Bytes_Length(bytes);
+        if (!system_fs_write_all(handle, ZrLib_Bytes_Data(bytes), length)) {
+            return ZR_FALSE;
+        }
+        if (outWrittenCount != ZR_NULL) {
+            *outWrittenCount = (TZrInt64)length;
+        }
+        return ZR_TRUE;
+    }
+
+    length = ZrLib_Array_Length(bytes);
+    buffer = (unsigned char *)malloc(length > 0 ? length : 1);
+    if (buffer == ZR_NULL) {
         return ZR_FALSE;
     }
 
     for (index = 0; index < length; index++) {
-        const SZrTypeValue *value = ZrLib_Array_Get(state, array, index);
+        const SZrTypeValue *value = ZrLib_Array_Get(state, bytes, index);
         TZrInt64 intValue = 0;
         if (value == ZR_NULL ||
             (!ZR_VALUE_IS_TYPE_SIGNED_INT(value->type) && !ZR_VALUE_IS_TYPE_UNSIGNED_INT(value->type))) {
-            free(bytes);
+            free(buffer);
             errno = EINVAL;
             return ZR_FALSE;
         }
@@ -371,19 +424,19 @@ TZrBool ZrSystem_Fs_WriteBytesToHandle(SZrState *state,
                            ? value->value.nativeObject.nativeInt64
                            : (TZrInt64)value->value.nativeObject.nativeUInt64;
         if (intValue < 0 || intValue > 255) {
-            free(bytes);
+            free(buffer);
             errno = EINVAL;
             return ZR_FALSE;
         }
-        bytes[index] = (unsigned char)intValue;
+        buffer[index] = (unsigned char)intValue;
     }
 
-    if (!system_fs_write_all(handle, bytes, length)) {
-        free(bytes);
+    if (!system_fs_write_all(handle, buffer, length)) {
+        free(buffer);
         return ZR_FALSE;
     }
 
-    free(bytes);
+    free(buffer);
     if (outWrittenCount != ZR_NULL) {
         *outWrittenCount = (TZrInt64)length;
     }
@@ -458,10 +511,10 @@ TZrBool ZrSystem_Fs_Stream_ReadText(ZrLibCallContext *context, SZrTypeValue *res
 TZrBool ZrSystem_Fs_Stream_WriteBytes(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *self = ZrSystem_Fs_SelfObject(context);
     ZrSystemFsStreamData *data = ZR_NULL;
-    SZrObject *array = ZR_NULL;
+    SZrObject *bytes = ZR_NULL;
     TZrInt64 written = 0;
     if (self == ZR_NULL || result == ZR_NULL ||
-        !ZrSystem_Fs_ReadArrayArgument(context, 0, &array) ||
+        !ZrSystem_Fs_ReadBytesArgument(context, 0, &bytes) ||
         !ZrSystem_Fs_StreamEnsureOpen(context->state, self, &data)) {
         return ZR_FALSE;
     }
@@ -469,7 +522,7 @@ TZrBool ZrSystem_Fs_Stream_WriteBytes(ZrLibCallContext *context, SZrTypeValue *r
         return ZrSystem_Fs_RaiseIOException(context->state, "FileStream mode '%s' is not writable",
                                             ZrSystem_Fs_GetStringField(context->state, self, "mode"));
     }
-    if (!ZrSystem_Fs_WriteBytesToHandle(context->state, data->handle, array, &written) ||
+    if (!ZrSystem_Fs_WriteBytesToHandle(context->state, data->handle, bytes, &written) ||
         !ZrSystem_Fs_StreamSyncFields(context->state, self, data)) {
         return ZrSystem_Fs_RaiseErrnoIOException(context->state, "writeBytes", ZrSystem_Fs_GetStringField(context->state, self, "path"));
     }
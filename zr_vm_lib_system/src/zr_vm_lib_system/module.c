@@ -5,12 +5,14 @@
 #include "zr_vm_lib_system/module.h"
 
 #include "zr_vm_lib_system/assembly_registry.h"
+#include "zr_vm_lib_system/bytes.h"
 #include "zr_vm_lib_system/console_registry.h"
 #include "zr_vm_lib_system/env_registry.h"
 #include "zr_vm_lib_system/exception_registry.h"
 #include "zr_vm_lib_system/fs_registry.h"
 #include "zr_vm_lib_system/gc_registry.h"
 #include "zr_vm_lib_system/process_registry.h"
+#include "zr_vm_lib_system/string_builder.h"
 #include "zr_vm_lib_system/vm_registry.h"
 
 #ifndef ZR_ARRAY_COUNT
@@ -23,6 +25,155 @@ static const TZrChar g_system_root_type_hints_json[] =
         "  \"module\": \"zr.system\"\n"
         "}\n";
 
+static const ZrLibParameterDescriptor g_bytes_length_parameter[] = {
+        {"length", "int", "Byte count; new buffers are zero-filled."},
+};
+
+static const ZrLibParameterDescriptor g_bytes_index_parameter[] = {
+        {"index", "int", "Zero-based byte offset."},
+};
+
+static const ZrLibParameterDescriptor g_bytes_set_item_parameters[] = {
+        {"index", "int", "Zero-based byte offset."},
+        {"value", "int", "Byte value 0..255."},
+};
+
+static const ZrLibParameterDescriptor g_bytes_range_parameters[] = {
+        {"start", "int", "Inclusive start offset; negative values count from the end."},
+        {"end", "int", "Exclusive end offset; negative values count from the end."},
+};
+
+static const ZrLibParameterDescriptor g_bytes_copy_from_parameters[] = {
+        {"source", "Bytes", "Buffer to copy from."},
+        {"offset", "int", "Destination offset in this buffer."},
+};
+
+static const ZrLibParameterDescriptor g_bytes_fill_parameters[] = {
+        {"value", "int", "Byte value 0..255."},
+        {"start", "int", "Inclusive start offset; negative values count from the end."},
+        {"end", "int", "Exclusive end offset; negative values count from the end."},
+};
+
+static const ZrLibParameterDescriptor g_bytes_text_parameter[] = {
+        {"text", "string", "UTF-8 text payload."},
+};
+
+static const ZrLibParameterDescriptor g_bytes_array_parameter[] = {
+        {"bytes", "array", "Byte array represented as integers 0..255."},
+};
+
+static const ZrLibFieldDescriptor g_bytes_fields[] = {
+        ZR_LIB_FIELD_DESCRIPTOR_INIT("length", "int", "Byte count of this view, read live from the storage."),
+};
+
+static const ZrLibMethodDescriptor g_bytes_methods[] = {
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("slice", 0, 2, ZrSystem_Bytes_Slice, "Bytes",
+                                      "Return a view over [start, end) that shares this buffer's storage.", ZR_FALSE,
+                                      g_bytes_range_parameters, ZR_ARRAY_COUNT(g_bytes_range_parameters)),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("copy", 0, 0, ZrSystem_Bytes_Copy, "Bytes",
+                                      "Return an independent copy of this view.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("copyFrom", 1, 2, ZrSystem_Bytes_CopyFrom, "int",
+                                      "Copy bytes from another buffer and return the copied count.", ZR_FALSE,
+                                      g_bytes_copy_from_parameters, ZR_ARRAY_COUNT(g_bytes_copy_from_parameters)),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("fill", 1, 3, ZrSystem_Bytes_Fill, "Bytes",
+                                      "Fill [start, end) with one byte value.", ZR_FALSE,
+                                      g_bytes_fill_parameters, ZR_ARRAY_COUNT(g_bytes_fill_parameters)),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("toArray", 0, 0, ZrSystem_Bytes_ToArray, "array",
+                                      "Copy the bytes into an int array.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("toString", 0, 0, ZrSystem_Bytes_ToString, "string",
+                                      "Decode the bytes as UTF-8 text.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("fromString", 1, 1, ZrSystem_Bytes_FromString, "Bytes",
+                                      "Encode UTF-8 text into a new buffer.", ZR_TRUE,
+                                      g_bytes_text_parameter, ZR_ARRAY_COUNT(g_bytes_text_parameter)),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("fromArray", 1, 1, ZrSystem_Bytes_FromArray, "Bytes",
+                                      "Pack an int array into a new buffer.", ZR_TRUE,
+                                      g_bytes_array_parameter, ZR_ARRAY_COUNT(g_bytes_array_parameter)),
+};
+
+static const ZrLibMetaMethodDescriptor g_bytes_meta_methods[] = {
+        {ZR_META_CONSTRUCTOR, 0, 1, ZrSystem_Bytes_Constructor, "Bytes", "Allocate a zero-filled buffer.",
+         g_bytes_length_parameter, ZR_ARRAY_COUNT(g_bytes_length_parameter)},
+        {.metaType = ZR_META_GET_ITEM,
+         .minArgumentCount = 1,
+         .maxArgumentCount = 1,
+         .callback = ZrSystem_Bytes_GetItem,
+         .returnTypeName = "int",
+         .documentation = ZR_NULL,
+         .parameters = g_bytes_index_parameter,
+         .parameterCount = ZR_ARRAY_COUNT(g_bytes_index_parameter),
+         .dispatchFlags = ZR_LIB_NATIVE_DISPATCH_FLAG_STACK_ROOT_CONTEXT |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_NO_SELF_REBIND |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_INLINE_VALUE_CONTEXT |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_RESULT_ALWAYS_WRITTEN |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_READONLY_INLINE_VALUE_CONTEXT,
+         .readonlyInlineGetFastCallback = ZrSystem_Bytes_GetItemReadonlyInlineFast},
+        {.metaType = ZR_META_SET_ITEM,
+         .minArgumentCount = 2,
+         .maxArgumentCount = 2,
+         .callback = ZrSystem_Bytes_SetItem,
+         .returnTypeName = "int",
+         .documentation = ZR_NULL,
+         .parameters = g_bytes_set_item_parameters,
+         .parameterCount = ZR_ARRAY_COUNT(g_bytes_set_item_parameters),
+         .dispatchFlags = ZR_LIB_NATIVE_DISPATCH_FLAG_STACK_ROOT_CONTEXT |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_NO_SELF_REBIND |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_INLINE_VALUE_CONTEXT |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_RESULT_ALWAYS_WRITTEN |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_READONLY_INLINE_VALUE_CONTEXT |
+                          ZR_LIB_NATIVE_DISPATCH_FLAG_RESULT_OPTIONAL,
+         .readonlyInlineSetNoResultFastCallback = ZrSystem_Bytes_SetItemReadonlyInlineNoResultFast},
+};
+
+static const ZrLibParameterDescriptor g_string_builder_initial_parameter[] = {
+        {"initial", "any", "Initial text; non-string values are converted like string concatenation."},
+};
+
+static const ZrLibParameterDescriptor g_string_builder_value_parameter[] = {
+        {"value", "any", "Value to append; non-string values are converted like string concatenation."},
+};
+
+static const ZrLibMethodDescriptor g_string_builder_methods[] = {
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("append", 1, 1, ZrSystem_StringBuilder_Append, "StringBuilder",
+                                      "Append a value and return this builder.", ZR_FALSE,
+                                      g_string_builder_value_parameter,
+                                      ZR_ARRAY_COUNT(g_string_builder_value_parameter)),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("clear", 0, 0, ZrSystem_StringBuilder_Clear, "StringBuilder",
+                                      "Reset the text to empty; earlier toString results are unaffected.", ZR_FALSE,
+                                      ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("length", 0, 0, ZrSystem_StringBuilder_Length, "int",
+                                      "Return the UTF-8 byte length of the text built so far.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("toString", 0, 0, ZrSystem_StringBuilder_ToString, "string",
+                                      "Return the text built so far without copying it.", ZR_FALSE, ZR_NULL, 0),
+};
+
+static const ZrLibMetaMethodDescriptor g_string_builder_meta_methods[] = {
+        {ZR_META_CONSTRUCTOR, 0, 1, ZrSystem_StringBuilder_Constructor, "StringBuilder",
+         "Create a builder, optionally seeded with initial text.", g_string_builder_initial_parameter,
+         ZR_ARRAY_COUNT(g_string_builder_initial_parameter)},
+        {ZR_META_TO_STRING, 0, 0, ZrSystem_StringBuilder_ToString, "string", ZR_NULL, ZR_NULL, 0},
+};
+
+static const ZrLibTypeDescriptor g_system_root_types[] = {
+        ZR_LIB_TYPE_DESCRIPTOR_INIT("Bytes", ZR_OBJECT_PROTOTYPE_TYPE_CLASS, g_bytes_fields,
+                                    ZR_ARRAY_COUNT(g_bytes_fields), g_bytes_methods, ZR_ARRAY_COUNT(g_bytes_methods),
+                                    g_bytes_meta_methods, ZR_ARRAY_COUNT(g_bytes_meta_methods),
+                                    "Contiguous byte buffer; slices are views over shared storage.", ZR_NULL, ZR_NULL,
+                                    0, ZR_NULL, 0, ZR_NULL, ZR_FALSE, ZR_TRUE, "Bytes(length?: int)", ZR_NULL, 0),
+        ZR_LIB_TYPE_DESCRIPTOR_PROTOCOL_INIT(
+                "StringBuilder", ZR_OBJECT_PROTOTYPE_TYPE_CLASS, ZR_NULL, 0, g_string_builder_methods,
+                ZR_ARRAY_COUNT(g_string_builder_methods), g_string_builder_meta_methods,
+                ZR_ARRAY_COUNT(g_string_builder_meta_methods),
+                "Mutable text accumulator with amortized appends; `b += value` and `b = b + value` append in place.",
+                ZR_NULL, ZR_NULL, 0, ZR_NULL, 0, ZR_NULL, ZR_FALSE, ZR_TRUE, "StringBuilder(initial?: any)", ZR_NULL, 0,
+                ZR_PROTOCOL_BIT(ZR_PROTOCOL_ID_STRING_BUILDER)),
+};
+
+static const ZrLibTypeHintDescriptor g_system_root_hints[] = {
+        {"Bytes", "type", "class Bytes", "Contiguous byte buffer; slices are views over shared storage."},
+        {"StringBuilder", "type", "class StringBuilder",
+         "Mutable text accumulator with amortized appends; `b += value` and `b = b + value` append in place."},
+};
+
 static const ZrLibModuleLinkDescriptor g_system_module_links[] = {
         {"console", "zr.system.console", "Console output helpers."},
         {"fs", "zr.system.fs", "Filesystem helpers."},
@@ -34,6 +185,13 @@ static const ZrLibModuleLinkDescriptor g_system_module_links[] = {
         {"vm", "zr.system.vm", "VM inspection and module invocation helpers."},
 };
 
+static TZrBool system_root_on_materialize(SZrState *state,
+                                          SZrObjectModule *module,
+                                          const ZrLibModuleDescriptor *descriptor) {
+    ZR_UNUSED_PARAMETER(descriptor);
+    return ZrSystem_Bytes_InstallLengthProperty(state, module);
+}
+
 static const ZrLibModuleDescriptor g_system_root_module_descriptor = {
         ZR_VM_NATIVE_PLUGIN_ABI_VERSION,
         "zr.system",
@@ -41,18 +199,18 @@ static const ZrLibModuleDescriptor g_system_root_module_descriptor = {
         0,
         ZR_NULL,
         0,
-        ZR_NULL,
-        0,
-        ZR_NULL,
-        0,
+        g_system_root_types,
+        ZR_ARRAY_COUNT(g_system_root_types),
+        g_system_root_hints,
+        ZR_ARRAY_COUNT(g_system_root_hints),
         g_system_root_type_hints_json,
-        "System native module root that aggregates leaf submodules.",
+        "System native module root that aggregates leaf submodules, the shared Bytes buffer type and StringBuilder.",
         g_system_module_links,
         ZR_ARRAY_COUNT(g_system_module_links),
         "1.0.0",
         ZR_VM_NATIVE_RUNTIME_ABI_VERSION,
         0,
-        ZR_NULL,
+        system_root_on_materialize,
 };
 
 const ZrLibModuleDescriptor *ZrVmLibSystem_GetModuleDescriptor(void) {
@@ -0,0 +1,137 @@
+//
+// zr.system.StringBuilder amortized string accumulation.
+//
+// The builder keeps its text in a hidden field. Long text is a concat node at the tip of its append buffer,
+// so append (which `b += value` and `b = b + value` compile to) writes only the new bytes, and toString hands
+// out that node without a copy; the bytes are materialized once, when a NUL-terminated view is first needed.
+//
+
+#include "zr_vm_lib_system/string_builder.h"
+
+#include "zr_vm_core/debug.h"
+#include "zr_vm_core/object.h"
+#include "zr_vm_core/string.h"
+#include "zr_vm_core/value.h"
+
+static SZrObject *system_string_builder_self(const ZrLibCallContext *context) {
+    SZrTypeValue *selfValue;
+    SZrObject *self = ZR_NULL;
+
+    if (context == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    selfValue = ZrLib_CallContext_Self(context);
+    if (selfValue != ZR_NULL && selfValue->type == ZR_VALUE_TYPE_OBJECT && selfValue->value.object != ZR_NULL) {
+        self = ZR_CAST_OBJECT(context->state, selfValue->value.object);
+    }
+    if (self == ZR_NULL ||
+        !ZrCore_ObjectPrototype_ImplementsProtocol(self->prototype, ZR_PROTOCOL_ID_STRING_BUILDER)) {
+        ZrCore_Debug_RunError(context->state, "StringBuilder receiver is not a string builder");
+    }
+    return self;
+}
+
+static SZrObject *system_string_builder_resolve_construct_target(ZrLibCallContext *context) {
+    SZrTypeValue *selfValue = ZrLib_CallContext_Self(context);
+    SZrObject *self = ZR_NULL;
+    SZrObjectPrototype *ownerPrototype = ZrLib_CallContext_OwnerPrototype(context);
+    SZrObjectPrototype *targetPrototype;
+
+    if (selfValue != ZR_NULL && selfValue->type == ZR_VALUE_TYPE_OBJECT && selfValue->value.object != ZR_NULL) {
+        self = ZR_CAST_OBJECT(context->state, selfValue->value.object);
+    }
+    if (self != ZR_NULL && ownerPrototype != ZR_NULL && ZrCore_Object_IsInstanceOfPrototype(self, ownerPrototype)) {
+        return self;
+    }
+
+    targetPrototype = ZrLib_CallContext_GetConstructTargetPrototype(context);
+    return ZrLib_Type_NewInstanceWithPrototype(context->state,
+                                               targetPrototype != ZR_NULL ? targetPrototype : ownerPrototype);
+}
+
+static void system_string_builder_set_text(SZrState *state, SZrObject *self, SZrString *text) {
+    SZrTypeValue textValue;
+
+    ZrLib_Value_SetStringObject(state, &textValue, text);
+    ZrLib_Object_SetFieldCString(state, self, ZR_STRING_BUILDER_TEXT_FIELD, &textValue);
+}
+
+static TZrBool system_string_builder_append_argument(ZrLibCallContext *context, SZrObject *self) {
+    SZrTypeValue *value = ZrLib_CallContext_Argument(context, 0);
+
+    if (value == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    if (!ZrCore_String_BuilderAppend(context->state, self, value)) {
+        ZrCore_Debug_RunError(context->state, "StringBuilder could not append the value");
+    }
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_StringBuilder_Constructor(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_string_builder_resolve_construct_target(context);
+    SZrString *empty;
+
+    if (self == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    empty = ZrCore_String_Create(context->state, "", 0);
+    if (empty == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    system_string_builder_set_text(context->state, self, empty);
+    if (ZrLib_CallContext_ArgumentCount(context) > 0 && !system_string_builder_append_argument(context, self)) {
+        return ZR_FALSE;
+    }
+
+    ZrLib_Value_SetObject(context->state, result, self, ZR_VALUE_TYPE_OBJECT);
+    return ZR_TRUE;
+}
+
+// the compiler lowers `b += value` and `b = b + value` on a builder variable to this call
+TZrBool ZrSystem_StringBuilder_Append(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_string_builder_self(context);
+
+    if (!system_string_builder_append_argument(context, self)) {
+        return ZR_FALSE;
+    }
+    ZrLib_Value_SetObject(context->state, result, self, ZR_VALUE_TYPE_OBJECT);
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_StringBuilder_Clear(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_string_builder_self(context);
+    SZrString *empty = ZrCore_String_Create(context->state, "", 0);
+
+    if (empty == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    // earlier toString results keep their own node; the next append starts a fresh buffer
+    system_string_builder_set_text(context->state, self, empty);
+    ZrLib_Value_SetObject(context->state, result, self, ZR_VALUE_TYPE_OBJECT);
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_StringBuilder_Length(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_string_builder_self(context);
+    SZrString *text = ZrCore_String_BuilderGetText(context->state, self);
+
+    if (text == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    ZrLib_Value_SetInt(context->state, result, (TZrInt64)ZrCore_String_GetByteLength(text));
+    return ZR_TRUE;
+}
+
+TZrBool ZrSystem_StringBuilder_ToString(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self = system_string_builder_self(context);
+    SZrString *text = ZrCore_String_BuilderGetText(context->state, self);
+
+    if (text == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    ZrLib_Value_SetStringObject(context->state, result, text);
+    return ZR_TRUE;
+}
@@ -2,17 +2,15 @@
 
 #if defined(ZR_PLATFORM_WIN)
 #include <process.h>
-#else
-#include <unistd.h>
 #endif
 
 #include "zr_vm_core/closure.h"
 #include "zr_vm_core/conversion.h"
 #include "zr_vm_core/exception.h"
 #include "zr_vm_core/io.h"
+#include "zr_vm_core/module.h"
 #include "zr_vm_core/object.h"
 #include "zr_vm_core/string.h"
-#include "zr_vm_library/file.h"
 #include "zr_vm_library/native_registry.h"
 #include "zr_vm_library/project.h"
 #include "zr_vm_parser/compiler.h"
@@ -23,7 +21,9 @@ static const TZrChar *kTaskPendingWorkersField = "__zr_task_pending_workers";
 static const TZrChar *kTaskWorkerIsolateIdField = "__zr_task_worker_isolate_id";
 
 typedef struct ZrVmTaskWorkerLaunch {
-    TZrChar *binaryPath;
+    TZrByte *callableBytes;
+    TZrSize callableLength;
+    SZrModuleStartupImage *startupImage;
     TZrChar *projectFile;
     TZrChar *projectDirectory;
     TZrChar *projectSource;
@@ -78,7 +78,8 @@ static void zr_vm_task_worker_launch_free(ZrVmTaskWorkerLaunch *launch) {
         free(launch->captures);
     }
 
-    free(launch->binaryPath);
+    ZrParser_Writer_FreeBinaryBuffer(launch->callableBytes);
+    ZrCore_Module_ReleaseStartupImage(launch->startupImage);
     free(launch->projectFile);
     free(launch->projectDirectory);
     free(launch->projectSource);
@@ -123,38 +124,6 @@ static SZrLibrary_Project *zr_vm_task_worker_clone_project(SZrState *state, cons
     return project;
 }
 
-static TZrBool zr_vm_task_worker_make_temp_path(TZrChar *buffer, TZrSize bufferSize) {
-    if (buffer == ZR_NULL || bufferSize == 0) {
-        return ZR_FALSE;
-    }
-
-#if defined(ZR_PLATFORM_WIN)
-    {
-        char tempDirectory[MAX_PATH];
-        UINT result = GetTempPathA((DWORD)sizeof(tempDirectory), tempDirectory);
-        if (result == 0 || result >= sizeof(tempDirectory)) {
-            return ZR_FALSE;
-        }
-        if (GetTempFileNameA(tempDirectory, "zrt", 0, buffer) == 0) {
-            return ZR_FALSE;
-        }
-    }
-#else
-    {
-        const char *pattern = "/tmp/zr_task_worker_XXXXXX";
-        int fd;
-        snprintf(buffer, bufferSize, "%s", pattern);
-        fd = mkstemp(buffer);
-        if (fd < 0) {
-            return ZR_FALSE;
-        }
-        close(fd);
-    }
-#endif
-
-    return ZR_TRUE;
-}
-
 static TZrBool zr_vm_task_worker_append_pending_handle(SZrState *state, SZrObject *scheduler, SZrObject *handle) {
     SZrObject *pendingArray;
     SZrTypeValue pendingValue;
@@ -178,32 +147,53 @@ static TZrBool zr_vm_task_worker_append_pending_handle(SZrState *state, SZrObjec
     return ZrLib_Array_PushValue(state, pendingArray, &handleValue);
 }
 
-static TZrBool zr_vm_task_worker_load_function(SZrState *state, const TZrChar *path, SZrFunction **outFunction) {
-    SZrLibrary_File_Reader *reader;
+typedef struct ZrVmTaskCallableReader {
+    const ZrVmTaskWorkerLaunch *launch;
+    TZrBool consumed;
+} ZrVmTaskCallableReader;
+
+static TZrBytePtr zr_vm_task_callable_reader_read(struct SZrState *state, TZrPtr customData, ZR_OUT TZrSize *size) {
+    ZrVmTaskCallableReader *reader = (ZrVmTaskCallableReader *)customData;
+
+    ZR_UNUSED_PARAMETER(state);
+
+    if (reader == ZR_NULL || size == ZR_NULL || reader->consumed || reader->launch->callableLength == 0) {
+        return ZR_NULL;
+    }
+
+    reader->consumed = ZR_TRUE;
+    *size = reader->launch->callableLength;
+    return (TZrBytePtr)reader->launch->callableBytes;
+}
+
+static void zr_vm_task_callable_reader_close(struct SZrState *state, TZrPtr customData) {
+    ZR_UNUSED_PARAMETER(state);
+    ZR_UNUSED_PARAMETER(customData);
+}
+
+static TZrBool zr_vm_task_worker_load_function(SZrState *state,
+                                               const ZrVmTaskWorkerLaunch *launch,
+                                               SZrFunction **outFunction) {
+    ZrVmTaskCallableReader reader;
     SZrIo io;
     SZrIoSource *source;
 
-    if (state == ZR_NULL || path == ZR_NULL || outFunction == ZR_NULL) {
+    if (state == ZR_NULL || launch == ZR_NULL || launch->callableBytes == ZR_NULL || outFunction == ZR_NULL) {
         return ZR_FALSE;
     }
 
     *outFunction = ZR_NULL;
-    reader = ZrLibrary_File_OpenRead(state->global, (TZrNativeString)path, ZR_TRUE);
-    if (reader == ZR_NULL) {
-        return ZR_FALSE;
-    }
-
-    ZrCore_Io_Init(state, &io, ZrLibrary_File_SourceReadImplementation, ZrLibrary_File_SourceCloseImplementation, reader);
+    memset(&reader, 0, sizeof(reader));
+    reader.launch = launch;
+    ZrCore_Io_Init(state, &io, zr_vm_task_callable_reader_read, zr_vm_task_callable_reader_close, &reader);
     io.isBinary = ZR_TRUE;
     source = ZrCore_Io_ReadSourceNew(&io);
     if (source == ZR_NULL) {
-        ZrLibrary_File_CloseRead(state->global, reader);
         return ZR_FALSE;
     }
 
     *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, source);
     ZrCore_Io_ReadSourceFree(state->global, source);
-    ZrLibrary_File_CloseRead(state->global, reader);
     return *outFunction != ZR_NULL;
 }
 
@@ -384,8 +374,10 @@ static void zr_vm_task_worker_run_launch(ZrVmTaskWorkerLaunch *launch) {
         workerGlobal->userData = project;
         workerGlobal->sourceLoader = ZrLibrary_Project_SourceLoadImplementation;
     }
+    // imports the spawning isolate already compiled are loaded from its startup image.
+    ZrCore_Module_SetStartupImage(workerGlobal, launch->startupImage);
 
-    if (!zr_vm_task_worker_load_function(workerState, launch->binaryPath, &function)) {
+    if (!zr_vm_task_worker_load_function(workerState, launch, &function)) {
         zr_vm_task_worker_queue_error_message(launch->ownerRuntime, launch->ownerHandle, "Failed to load worker callable");
         goto cleanup;
     }
@@ -440,9 +432,6 @@ cleanup:
         workerGlobal->userData = ZR_NULL;
     }
     ZrLibrary_NativeRegistry_Free(workerGlobal);
-    if (launch->binaryPath != ZR_NULL) {
-        remove(launch->binaryPath);
-    }
     ZrCore_GlobalState_Free(workerGlobal);
 }
 
@@ -495,7 +484,8 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context, SZrTypeValue *
     ZrVmTaskWorkerLaunch *launch;
     SZrClosure *closure = ZR_NULL;
     SZrLibrary_Project *project;
-    TZrChar tempPath[512];
+    TZrByte *callableBytes;
+    TZrSize callableLength;
     TZrUInt32 captureIndex;
     TZrUInt32 captureCount = 0;
 
@@ -516,18 +506,18 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context, SZrTypeValue *
         captureCount = closure != ZR_NULL ? (TZrUInt32)closure->closureValueCount : 0u;
     }
 
-    if (!zr_vm_task_worker_make_temp_path(tempPath, sizeof(tempPath)) ||
-        !ZrParser_Writer_WriteBinaryFile(context->state, function, tempPath)) {
+    if (!ZrParser_Writer_WriteBinaryBuffer(context->state, function, &callableBytes, &callableLength)) {
         return zr_vm_task_raise_runtime_error(context->state, "Failed to serialize worker callable");
     }
 
     launch = (ZrVmTaskWorkerLaunch *)malloc(sizeof(*launch));
     if (launch == ZR_NULL) {
-        remove(tempPath);
+        ZrParser_Writer_FreeBinaryBuffer(callableBytes);
         return ZR_FALSE;
     }
     memset(launch, 0, sizeof(*launch));
-    launch->binaryPath = zr_vm_task_worker_strdup(tempPath);
+    launch->callableBytes = callableBytes;
+    launch->callableLength = callableLength;
     launch->captureCount = captureCount;
     launch->ownerRuntime = zr_vm_task_scheduler_get_runtime(context->state, mainScheduler);
     launch->ownerHandle = handle;
@@ -536,6 +526,9 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context, SZrTypeValue *
     launch->workerIsolateId = zr_vm_task_next_worker_isolate_id();
     launch->supportMultithread = zr_vm_task_default_support_multithread(context->state);
     launch->autoCoroutine = zr_vm_task_get_bool_field(context->state, mainScheduler, "__zr_task_auto_coroutine", ZR_TRUE);
+    launch->startupImage = ZrCore_Module_CaptureStartupImage(context->state,
+                                                             ZrParser_Writer_WriteBinaryBuffer,
+                                                             ZrParser_Writer_FreeBinaryBuffer);
 
     project = (SZrLibrary_Project *)context->state->global->userData;
     if (project != ZR_NULL) {
@@ -559,7 +552,6 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context, SZrTypeValue *
         launch->captures = (ZrVmTaskTransportValue *)calloc(captureCount, sizeof(ZrVmTaskTransportValue));
         if (launch->captures == ZR_NULL) {
             zr_vm_task_worker_launch_free(launch);
-            remove(tempPath);
             return ZR_FALSE;
         }
 
@@ -570,8 +562,7 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context, SZrTypeValue *
                                                    &launch->captures[captureIndex],
                                                    "spawnThread only captures sendable scalar values or Channel handles")) {
                 zr_vm_task_worker_launch_free(launch);
-                remove(tempPath);
-                return ZR_FALSE;
+                    return ZR_FALSE;
             }
         }
     }
@@ -581,7 +572,6 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context, SZrTypeValue *
     if (!zr_vm_task_worker_append_pending_handle(context->state, mainScheduler, handle) ||
         !zr_vm_task_worker_start(launch)) {
         zr_vm_task_worker_launch_free(launch);
-        remove(tempPath);
         return zr_vm_task_raise_runtime_error(context->state, "Failed to start worker isolate thread");
     }
 
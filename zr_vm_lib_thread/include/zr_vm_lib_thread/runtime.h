@@ -7,6 +7,17 @@
 
 #include "zr_vm_lib_thread/conf.h"
 
+#define ZR_VM_THREAD_WORKER_POOL_DEFAULT_SIZE 4u
+#define ZR_VM_THREAD_WORKER_POOL_DEFAULT_IDLE_TIMEOUT_MS 30000u
+#define ZR_VM_THREAD_STEAL_SCHEDULER_DEFAULT_WORKERS 4u
+#define ZR_VM_THREAD_STEAL_SCHEDULER_MAX_WORKERS 64u
+
 ZR_VM_THREAD_API const ZrLibModuleDescriptor *ZrVmThread_Runtime_GetModuleDescriptor(void);
 
+// Sets the persistent worker pool size and how long an idle worker keeps its warm isolate (0 = forever).
+ZR_VM_THREAD_API void ZrVmThread_WorkerPool_Configure(TZrUInt32 workerCount, TZrUInt32 idleTimeoutMs);
+
+// Stops idle workers after their queue drains and releases their warm isolates; blocks until they exit.
+ZR_VM_THREAD_API void ZrVmThread_WorkerPool_Shutdown(void);
+
 #endif // ZR_VM_THREAD_RUNTIME_H
@@ -37,6 +37,7 @@ static const TZrChar *kTaskSchedulerOwnerField = "__zr_task_scheduler_owner";
 static const TZrChar *kTaskRunnerCallableField = "__zr_task_runner_callable";
 static const TZrChar *kTaskRunnerStartedField = "__zr_task_runner_started";
 static const TZrChar *kThreadObjectSchedulerField = "__zr_thread_scheduler";
+static const TZrChar *kTaskStealPoolField = "__zr_task_steal_pool";
 static const TZrUInt32 kTaskSchedulerExternalWaitMs = 1u;
 
 static TZrBool zr_vm_task_spawn_on_scheduler(ZrLibCallContext *context,
@@ -416,19 +417,25 @@ TZrBool zr_vm_task_scheduler_process_external(SZrState *state, SZrObject *schedu
         return ZR_FALSE;
     }
 
-    zr_vm_task_sync_mutex_lock(&runtime->mutex);
-    message = runtime->head;
-    if (message != ZR_NULL) {
-        runtime->head = message->next;
-        if (runtime->head == ZR_NULL) {
-            runtime->tail = ZR_NULL;
+    if (runtime->pending == ZR_NULL) {
+        // detach everything published so far and reverse it, restoring completion order.
+        ZrVmTaskSchedulerMessage *stack =
+                (ZrVmTaskSchedulerMessage *)zr_vm_task_atomic_exchange_pointer(&runtime->completionStack, ZR_NULL);
+
+        while (stack != ZR_NULL) {
+            ZrVmTaskSchedulerMessage *next = stack->next;
+
+            stack->next = runtime->pending;
+            runtime->pending = stack;
+            stack = next;
         }
     }
-    zr_vm_task_sync_mutex_unlock(&runtime->mutex);
 
+    message = runtime->pending;
     if (message == ZR_NULL) {
         return ZR_FALSE;
     }
+    runtime->pending = message->next;
 
     if (message->handle != ZR_NULL) {
         if (message->kind == ZR_VM_TASK_SCHEDULER_MESSAGE_COMPLETE &&
@@ -455,6 +462,10 @@ TZrBool zr_vm_task_scheduler_process_external(SZrState *state, SZrObject *schedu
     return ZR_TRUE;
 }
 
+static TZrBool zr_vm_task_scheduler_runtime_has_message(ZrVmTaskSchedulerRuntime *runtime) {
+    return runtime->pending != ZR_NULL || zr_vm_task_atomic_load_pointer(&runtime->completionStack) != ZR_NULL;
+}
+
 TZrBool zr_vm_task_scheduler_wait_for_external(SZrState *state, SZrObject *scheduler, TZrUInt32 timeoutMs) {
     ZrVmTaskSchedulerRuntime *runtime;
     TZrBool hasMessage;
@@ -468,15 +479,11 @@ TZrBool zr_vm_task_scheduler_wait_for_external(SZrState *state, SZrObject *sched
         return ZR_FALSE;
     }
 
-    zr_vm_task_sync_mutex_lock(&runtime->mutex);
-    hasMessage = runtime->head != ZR_NULL ? ZR_TRUE : ZR_FALSE;
-    zr_vm_task_sync_mutex_unlock(&runtime->mutex);
+    hasMessage = zr_vm_task_scheduler_runtime_has_message(runtime);
     if (!hasMessage && timeoutMs > 0u) {
         /* Keep the external wait path Helgrind-clean by polling the queue with a short sleep. */
         zr_vm_task_sync_sleep_ms(timeoutMs);
-        zr_vm_task_sync_mutex_lock(&runtime->mutex);
-        hasMessage = runtime->head != ZR_NULL ? ZR_TRUE : ZR_FALSE;
-        zr_vm_task_sync_mutex_unlock(&runtime->mutex);
+        hasMessage = zr_vm_task_scheduler_runtime_has_message(runtime);
     }
     return hasMessage;
 }
@@ -828,6 +835,18 @@ static TZrInt64 zr_vm_task_scheduler_pump_internal(SZrState *state, SZrObject *s
     return executed;
 }
 
+TZrBool zr_vm_task_scheduler_yield(SZrState *state) {
+    SZrObject *scheduler = zr_vm_task_main_scheduler(state);
+
+    // a native running inside an active pump frame must not re-enter the scheduler.
+    if (scheduler == ZR_NULL || !zr_vm_task_get_bool_field(state, scheduler, kTaskAutoCoroutineField, ZR_TRUE) ||
+        zr_vm_task_get_bool_field(state, scheduler, kTaskIsPumpingField, ZR_FALSE)) {
+        return ZR_FALSE;
+    }
+
+    return zr_vm_task_scheduler_step_internal(state, scheduler);
+}
+
 static TZrBool zr_vm_task_create_async_handle(SZrState *state,
                                               SZrObject *scheduler,
                                               const SZrTypeValue *callable,
@@ -908,18 +927,16 @@ static TZrBool zr_vm_task_wait_for_handle(SZrState *state, SZrObject *handle, SZ
                           "Task is still pending while autoCoroutine is disabled; call Scheduler.pump() first");
 }
 
-static SZrObject *zr_vm_thread_create_scheduler(SZrState *state) {
-    SZrObject *scheduler;
+static SZrObject *zr_vm_thread_init_scheduler(SZrState *state, SZrObject *scheduler) {
     SZrObject *queue;
     SZrTypeValue queueValue;
 
-    if (state == ZR_NULL) {
+    if (state == ZR_NULL || scheduler == ZR_NULL) {
         return ZR_NULL;
     }
 
-    scheduler = zr_vm_task_new_typed_object(state, "Scheduler");
     queue = ZrLib_Array_New(state);
-    if (scheduler == ZR_NULL || queue == ZR_NULL) {
+    if (queue == ZR_NULL) {
         return ZR_NULL;
     }
 
@@ -933,6 +950,19 @@ static SZrObject *zr_vm_thread_create_scheduler(SZrState *state) {
     return scheduler;
 }
 
+static SZrObject *zr_vm_thread_create_scheduler(SZrState *state) {
+    return zr_vm_thread_init_scheduler(state, zr_vm_task_new_typed_object(state, "Scheduler"));
+}
+
+static ZrVmTaskStealPool *zr_vm_thread_scheduler_steal_pool(SZrState *state, SZrObject *scheduler) {
+    const SZrTypeValue *poolValue = zr_vm_task_get_field_value(state, scheduler, kTaskStealPoolField);
+
+    if (poolValue == ZR_NULL || poolValue->type != ZR_VALUE_TYPE_NATIVE_POINTER) {
+        return ZR_NULL;
+    }
+    return (ZrVmTaskStealPool *)poolValue->value.nativeObject.nativePointer;
+}
+
 static const SZrTypeValue *zr_vm_thread_runner_callable(SZrState *state, SZrObject *runner) {
     return zr_vm_task_get_field_value(state, runner, kTaskRunnerCallableField);
 }
@@ -987,7 +1017,86 @@ static TZrBool zr_vm_thread_scheduler_start(ZrLibCallContext *context, SZrTypeVa
                              handle,
                              kTaskStatusField,
                              ZR_VM_TASK_STATUS_QUEUED);
-    return zr_vm_task_spawn_thread_worker(context, callable, result, scheduler);
+    return zr_vm_task_spawn_thread_worker(context,
+                                          callable,
+                                          result,
+                                          scheduler,
+                                          zr_vm_thread_scheduler_steal_pool(context->state, scheduler));
+}
+
+static TZrBool zr_vm_thread_steal_scheduler_construct(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *scheduler;
+    ZrVmTaskStealPool *pool;
+    SZrTypeValue poolValue;
+    TZrInt64 workerCount = ZR_VM_THREAD_STEAL_SCHEDULER_DEFAULT_WORKERS;
+
+    if (context == ZR_NULL || result == ZR_NULL ||
+        !zr_vm_task_require_multithread(context->state, "zr.thread requires supportMultithread = true")) {
+        return ZR_FALSE;
+    }
+
+    if (ZrLib_CallContext_ArgumentCount(context) > 0 && !zr_vm_task_read_strict_int(context, 0, &workerCount)) {
+        return ZR_FALSE;
+    }
+    if (workerCount <= 0 || workerCount > ZR_VM_THREAD_STEAL_SCHEDULER_MAX_WORKERS) {
+        return zr_vm_task_raise_runtime_error(context->state, "WorkStealingScheduler expects 1..64 workers");
+    }
+
+    scheduler = zr_vm_task_resolve_construct_target(context);
+    if (scheduler == ZR_NULL) {
+        scheduler = zr_vm_task_new_typed_object(context->state, "WorkStealingScheduler");
+    }
+    if (zr_vm_thread_init_scheduler(context->state, scheduler) == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    pool = zr_vm_task_steal_pool_new((TZrUInt32)workerCount);
+    if (pool == ZR_NULL) {
+        return zr_vm_task_raise_runtime_error(context->state, "Failed to create work-stealing worker pool");
+    }
+
+    ZrLib_Value_SetNativePointer(context->state, &poolValue, pool);
+    zr_vm_task_set_value_field(context->state, scheduler, kTaskStealPoolField, &poolValue);
+    return zr_vm_task_finish_object(context->state, result, scheduler);
+}
+
+static TZrBool zr_vm_thread_steal_scheduler_start(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *scheduler = zr_vm_task_self_object(context);
+
+    if (scheduler == ZR_NULL || zr_vm_thread_scheduler_steal_pool(context->state, scheduler) == ZR_NULL) {
+        return zr_vm_task_raise_runtime_error(context->state, "WorkStealingScheduler has been shut down");
+    }
+    return zr_vm_task_spawn_on_scheduler(context, result, scheduler);
+}
+
+static TZrBool zr_vm_thread_steal_scheduler_worker_count(ZrLibCallContext *context, SZrTypeValue *result) {
+    ZrVmTaskStealPool *pool = zr_vm_thread_scheduler_steal_pool(context->state, zr_vm_task_self_object(context));
+
+    ZrLib_Value_SetInt(context->state, result, (TZrInt64)zr_vm_task_steal_pool_worker_count(pool));
+    return ZR_TRUE;
+}
+
+static TZrBool zr_vm_thread_steal_scheduler_steal_count(ZrLibCallContext *context, SZrTypeValue *result) {
+    ZrVmTaskStealPool *pool = zr_vm_thread_scheduler_steal_pool(context->state, zr_vm_task_self_object(context));
+
+    ZrLib_Value_SetInt(context->state, result, (TZrInt64)zr_vm_task_steal_pool_steal_count(pool));
+    return ZR_TRUE;
+}
+
+static TZrBool zr_vm_thread_steal_scheduler_shutdown(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *scheduler = zr_vm_task_self_object(context);
+    ZrVmTaskStealPool *pool;
+
+    if (scheduler == ZR_NULL || result == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // completions of the drained launches stay on the scheduler runtime for later awaits.
+    pool = zr_vm_thread_scheduler_steal_pool(context->state, scheduler);
+    zr_vm_task_set_null_field(context->state, scheduler, kTaskStealPoolField);
+    zr_vm_task_steal_pool_shutdown(pool);
+    ZrLib_Value_SetNull(result);
+    return ZR_TRUE;
 }
 
 static TZrBool zr_vm_task_spawn(ZrLibCallContext *context, SZrTypeValue *result) {
@@ -1122,11 +1231,39 @@ static TZrBool zr_vm_task_scheduler_get_auto(ZrLibCallContext *context, SZrTypeV
     return ZR_TRUE;
 }
 
+static TZrBool zr_vm_task_configure_worker_pool(ZrLibCallContext *context, SZrTypeValue *result) {
+    TZrInt64 workerCount;
+    TZrInt64 idleTimeoutMs;
+
+    if (context == ZR_NULL || context->state == ZR_NULL || result == ZR_NULL ||
+        !zr_vm_task_read_strict_int(context, 0, &workerCount) ||
+        !zr_vm_task_read_strict_int(context, 1, &idleTimeoutMs)) {
+        return ZR_FALSE;
+    }
+
+    if (workerCount <= 0 || workerCount > UINT32_MAX || idleTimeoutMs < 0 || idleTimeoutMs > UINT32_MAX) {
+        return zr_vm_task_raise_runtime_error(context->state,
+                                              "configureWorkerPool expects workerCount > 0 and idleTimeoutMs >= 0");
+    }
+
+    ZrVmThread_WorkerPool_Configure((TZrUInt32)workerCount, (TZrUInt32)idleTimeoutMs);
+    ZrLib_Value_SetNull(result);
+    return ZR_TRUE;
+}
+
+static const ZrLibParameterDescriptor g_configure_worker_pool_parameters[] = {
+        {"workerCount", "int", "Number of persistent worker threads that keep a warm isolate."},
+        {"idleTimeoutMs", "int", "Idle time before a worker drops its isolate and exits; 0 keeps it forever."},
+};
+
 static const ZrLibFunctionDescriptor g_task_functions[] = {
         {"spawnThread", 0, 0, zr_vm_task_spawn_thread, "Thread",
          "Create a worker thread launcher backed by a dedicated scheduler.", ZR_NULL, 0},
         {"getCurrentThreadScheduler", 0, 0, zr_vm_task_current_scheduler, "Scheduler",
          "Return the current isolate's zr.thread scheduler wrapper.", ZR_NULL, 0},
+        {"configureWorkerPool", 2, 2, zr_vm_task_configure_worker_pool, "null",
+         "Resize the persistent worker pool and set its idle isolate timeout.", g_configure_worker_pool_parameters,
+         ZR_ARRAY_COUNT(g_configure_worker_pool_parameters)},
 };
 
 static const ZrLibGenericParameterDescriptor g_task_single_generic_parameter[] = {
@@ -1189,6 +1326,31 @@ static const ZrLibMethodDescriptor g_scheduler_methods[] = {
                                       "Return the scheduler autoCoroutine flag.", ZR_FALSE, ZR_NULL, 0),
 };
 
+static const ZrLibMethodDescriptor g_steal_scheduler_methods[] = {
+        {"start", 1, 1, zr_vm_thread_steal_scheduler_start, "zr.task.Task<T>",
+         "Launch a Send TaskRunner on whichever worker isolate picks it up first.", ZR_FALSE,
+         g_thread_start_parameters, ZR_ARRAY_COUNT(g_thread_start_parameters), 0U, g_send_generic_parameter,
+         ZR_ARRAY_COUNT(g_send_generic_parameter)},
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("pump", 0, 0, zr_vm_task_scheduler_pump, "int",
+                                      "Drain worker completions and queued work for this scheduler.", ZR_FALSE,
+                                      ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("step", 0, 0, zr_vm_task_scheduler_step, "bool",
+                                      "Execute one scheduler step, including worker completions.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("setAutoCoroutine", 1, 1, zr_vm_task_scheduler_set_auto, "null",
+                                      "Enable or disable automatic scheduler pumping.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("getAutoCoroutine", 0, 0, zr_vm_task_scheduler_get_auto, "bool",
+                                      "Return the scheduler autoCoroutine flag.", ZR_FALSE, ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("workerCount", 0, 0, zr_vm_thread_steal_scheduler_worker_count, "int",
+                                      "Return the number of worker isolates, or 0 after shutdown.", ZR_FALSE, ZR_NULL,
+                                      0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("stealCount", 0, 0, zr_vm_thread_steal_scheduler_steal_count, "int",
+                                      "Return how many launches idle workers have stolen from busy peers.", ZR_FALSE,
+                                      ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("shutdown", 0, 0, zr_vm_thread_steal_scheduler_shutdown, "null",
+                                      "Finish every started runner, then stop the workers and drop their isolates.",
+                                      ZR_FALSE, ZR_NULL, 0),
+};
+
 static const ZrLibMethodDescriptor g_thread_methods[] = {
         {"start", 1, 1, zr_vm_thread_thread_start, "zr.task.Task<T>",
          "Launch a Send TaskRunner on this thread.", ZR_FALSE, g_thread_start_parameters,
@@ -1196,12 +1358,38 @@ static const ZrLibMethodDescriptor g_thread_methods[] = {
          ZR_ARRAY_COUNT(g_send_generic_parameter)},
 };
 
+static const ZrLibParameterDescriptor g_channel_send_parameters[] = {
+        {"value", "T", "The Send value to enqueue."},
+};
+
+static const ZrLibParameterDescriptor g_channel_send_many_parameters[] = {
+        {"values", "T[]", "The Send values to enqueue in order."},
+};
+
+static const ZrLibParameterDescriptor g_channel_recv_many_parameters[] = {
+        {"maxCount", "int", "Upper bound on the number of values returned."},
+};
+
+static const ZrLibParameterDescriptor g_channel_construct_parameters[] = {
+        {"capacity", "int", "Bounded ring size, rounded up to a power of two; omit or pass 0 for unbounded."},
+};
+
 static const ZrLibMethodDescriptor g_channel_methods[] = {
         ZR_LIB_METHOD_DESCRIPTOR_INIT("send", 1, 1, zr_vm_task_channel_send, "null",
-                                      "Append a value to the channel queue.", ZR_FALSE, ZR_NULL, 0),
+                                      "Append a value to the channel queue, waiting while a bounded channel is full.",
+                                      ZR_FALSE, g_channel_send_parameters, ZR_ARRAY_COUNT(g_channel_send_parameters)),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("trySend", 1, 1, zr_vm_task_channel_try_send, "bool",
+                                      "Append a value without waiting; return false when a bounded channel is full.",
+                                      ZR_FALSE, g_channel_send_parameters, ZR_ARRAY_COUNT(g_channel_send_parameters)),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("sendMany", 1, 1, zr_vm_task_channel_send_many, "int",
+                                      "Append every array element in order and return how many were sent.", ZR_FALSE,
+                                      g_channel_send_many_parameters, ZR_ARRAY_COUNT(g_channel_send_many_parameters)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("recv", 0, 0, zr_vm_task_channel_recv, "T",
                                       "Pop the next queued value, or null when the channel is empty.", ZR_FALSE,
                                       ZR_NULL, 0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("recvMany", 1, 1, zr_vm_task_channel_recv_many, "T[]",
+                                      "Pop up to maxCount queued values without waiting.", ZR_FALSE,
+                                      g_channel_recv_many_parameters, ZR_ARRAY_COUNT(g_channel_recv_many_parameters)),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("close", 0, 0, zr_vm_task_channel_close, "null",
                                       "Close the channel and reject future sends.", ZR_FALSE, ZR_NULL, 0),
         ZR_LIB_METHOD_DESCRIPTOR_INIT("isClosed", 0, 0, zr_vm_task_channel_is_closed, "bool",
@@ -1209,6 +1397,9 @@ static const ZrLibMethodDescriptor g_channel_methods[] = {
         ZR_LIB_METHOD_DESCRIPTOR_INIT("length", 0, 0, zr_vm_task_channel_length, "int",
                                       "Return the number of queued values still pending receipt.", ZR_FALSE, ZR_NULL,
                                       0),
+        ZR_LIB_METHOD_DESCRIPTOR_INIT("capacity", 0, 0, zr_vm_task_channel_capacity, "int",
+                                      "Return the ring capacity of a bounded channel, or 0 when unbounded.", ZR_FALSE,
+                                      ZR_NULL, 0),
 };
 
 static const ZrLibMethodDescriptor g_shared_methods[] = {
@@ -1274,14 +1465,25 @@ static const ZrLibMethodDescriptor g_shared_lock_methods[] = {
                                       "Release this shared lock guard.", ZR_FALSE, ZR_NULL, 0),
 };
 
+static const ZrLibParameterDescriptor g_steal_scheduler_construct_parameters[] = {
+        {"workerCount", "int", "Number of worker threads, each with its own isolate; defaults to 4, at most 64."},
+};
+
+static const ZrLibMetaMethodDescriptor g_steal_scheduler_meta_methods[] = {
+        {ZR_META_CONSTRUCTOR, 0, 1, zr_vm_thread_steal_scheduler_construct, "WorkStealingScheduler",
+         "Construct a scheduler whose worker isolates steal queued runners from each other.",
+         g_steal_scheduler_construct_parameters, ZR_ARRAY_COUNT(g_steal_scheduler_construct_parameters)},
+};
+
 static const ZrLibMetaMethodDescriptor g_shared_meta_methods[] = {
         {ZR_META_CONSTRUCTOR, 1, 1, zr_vm_task_shared_construct, "Shared<T>",
          "Construct a shared wrapper cell from a value.", ZR_NULL, 0},
 };
 
 static const ZrLibMetaMethodDescriptor g_channel_meta_methods[] = {
-        {ZR_META_CONSTRUCTOR, 0, 0, zr_vm_task_channel_construct, "Channel<T>",
-         "Construct a same-isolate FIFO channel wrapper.", ZR_NULL, 0},
+        {ZR_META_CONSTRUCTOR, 0, 1, zr_vm_task_channel_construct, "Channel<T>",
+         "Construct a FIFO channel wrapper, bounded when a capacity is given.", g_channel_construct_parameters,
+         ZR_ARRAY_COUNT(g_channel_construct_parameters)},
 };
 
 static const ZrLibMetaMethodDescriptor g_transfer_meta_methods[] = {
@@ -1312,6 +1514,13 @@ static const ZrLibTypeDescriptor g_task_types[] = {
                                     "Worker-backed scheduler that integrates with zr.task.Task awaiting.", ZR_NULL,
                                     g_scheduler_implements, ZR_ARRAY_COUNT(g_scheduler_implements),
                                     ZR_NULL, 0, ZR_NULL, ZR_FALSE, ZR_FALSE, ZR_NULL, ZR_NULL, 0),
+        ZR_LIB_TYPE_DESCRIPTOR_INIT("WorkStealingScheduler", ZR_OBJECT_PROTOTYPE_TYPE_CLASS, ZR_NULL, 0,
+                                    g_steal_scheduler_methods, ZR_ARRAY_COUNT(g_steal_scheduler_methods),
+                                    g_steal_scheduler_meta_methods, ZR_ARRAY_COUNT(g_steal_scheduler_meta_methods),
+                                    "Scheduler that spreads Send runners over worker isolates with work stealing.",
+                                    ZR_NULL, g_scheduler_implements, ZR_ARRAY_COUNT(g_scheduler_implements), ZR_NULL,
+                                    0, ZR_NULL, ZR_TRUE, ZR_TRUE, "WorkStealingScheduler(workerCount?: int)", ZR_NULL,
+                                    0),
         ZR_LIB_TYPE_DESCRIPTOR_INIT("Thread", ZR_OBJECT_PROTOTYPE_TYPE_CLASS, ZR_NULL, 0, g_thread_methods,
                                     ZR_ARRAY_COUNT(g_thread_methods), ZR_NULL, 0,
                                     "Thread launcher that owns a worker scheduler.", ZR_NULL, ZR_NULL, 0,
@@ -1321,7 +1530,7 @@ static const ZrLibTypeDescriptor g_task_types[] = {
                                     ZR_ARRAY_COUNT(g_channel_meta_methods),
                                     "Cross-isolate FIFO channel wrapper with scheduler wakeups.", ZR_NULL,
                                     g_send_sync_implements, ZR_ARRAY_COUNT(g_send_sync_implements), ZR_NULL, 0,
-                                    ZR_NULL, ZR_TRUE, ZR_TRUE, "Channel()", g_send_generic_parameter,
+                                    ZR_NULL, ZR_TRUE, ZR_TRUE, "Channel(capacity?: int)", g_send_generic_parameter,
                                     ZR_ARRAY_COUNT(g_send_generic_parameter)),
         ZR_LIB_TYPE_DESCRIPTOR_INIT("Shared", ZR_OBJECT_PROTOTYPE_TYPE_CLASS, ZR_NULL, 0, g_shared_methods,
                                     ZR_ARRAY_COUNT(g_shared_methods), g_shared_meta_methods,
@@ -1373,10 +1582,14 @@ static const ZrLibTypeHintDescriptor g_task_hints[] = {
         {"spawnThread", "function", "spawnThread(): Thread", "Create a worker thread launcher."},
         {"getCurrentThreadScheduler", "function", "getCurrentThreadScheduler(): Scheduler",
          "Return the current isolate's zr.thread scheduler wrapper."},
+        {"configureWorkerPool", "function", "configureWorkerPool(workerCount: int, idleTimeoutMs: int): null",
+         "Resize the persistent worker pool and set its idle isolate timeout."},
         {"Send", "type", "interface Send", "Marker contract for values that can move between threads."},
         {"Sync", "type", "interface Sync", "Marker contract for values that can be shared between threads."},
         {"Scheduler", "type", "class Scheduler implements zr.task.IScheduler",
          "Worker-backed scheduler that can start TaskRunner<T> instances."},
+        {"WorkStealingScheduler", "type", "class WorkStealingScheduler implements zr.task.IScheduler",
+         "Scheduler whose worker isolates steal queued TaskRunner<T> instances from each other."},
         {"Thread", "type", "class Thread", "Worker thread launcher with a start(runner) method."},
         {"Channel", "type", "class Channel<T>", "Cross-isolate FIFO channel wrapper."},
         {"Shared", "type", "class Shared<T>", "Shared-value wrapper with strong and weak handles."},
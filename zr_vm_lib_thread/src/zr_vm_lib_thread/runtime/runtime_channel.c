@@ -0,0 +1,379 @@
+//
+// Channel<T> queue storage: the unbounded mutex-guarded list and the bounded lock-free MPMC ring.
+// Values move in and out as encoded transport values; encoding and decoding stay with the callers.
+//
+
+#include "runtime/runtime_internal.h"
+
+static TZrUInt64 zr_vm_task_channel_round_capacity(TZrUInt64 capacity) {
+    TZrUInt64 rounded = 2u;
+
+    while (rounded < capacity && rounded <= (ZR_MAX_SIZE / sizeof(ZrVmTaskChannelSlot)) / 2u) {
+        rounded <<= 1u;
+    }
+    return rounded;
+}
+
+ZrVmTaskChannelTransport *zr_vm_task_channel_transport_new(TZrUInt64 capacity) {
+    ZrVmTaskChannelTransport *transport = (ZrVmTaskChannelTransport *)malloc(sizeof(*transport));
+    TZrUInt64 index;
+
+    if (transport == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    memset(transport, 0, sizeof(*transport));
+    if (capacity > 0) {
+        TZrUInt64 slotCount = zr_vm_task_channel_round_capacity(capacity);
+
+        transport->slots = (ZrVmTaskChannelSlot *)malloc((TZrSize)slotCount * sizeof(ZrVmTaskChannelSlot));
+        if (transport->slots == ZR_NULL) {
+            free(transport);
+            return ZR_NULL;
+        }
+        memset(transport->slots, 0, (TZrSize)slotCount * sizeof(ZrVmTaskChannelSlot));
+        for (index = 0; index < slotCount; index++) {
+            transport->slots[index].sequence = index;
+        }
+        transport->capacity = slotCount;
+        transport->slotMask = slotCount - 1u;
+    }
+
+    zr_vm_task_sync_mutex_init(&transport->mutex);
+    zr_vm_task_sync_condition_init(&transport->condition);
+    return transport;
+}
+
+void zr_vm_task_channel_transport_free(ZrVmTaskChannelTransport *transport) {
+    ZrVmTaskChannelMessage *message;
+
+    if (transport == ZR_NULL) {
+        return;
+    }
+
+    message = transport->head;
+    while (message != ZR_NULL) {
+        ZrVmTaskChannelMessage *next = message->next;
+        free(message);
+        message = next;
+    }
+    zr_vm_task_sync_condition_destroy(&transport->condition);
+    zr_vm_task_sync_mutex_destroy(&transport->mutex);
+    free(transport->slots);
+    free(transport);
+}
+
+static TZrSize zr_vm_task_channel_list_send_many(ZrVmTaskChannelTransport *transport,
+                                                 ZrVmTaskTransportValue *values,
+                                                 TZrSize count,
+                                                 EZrVmTaskChannelStatus *outStatus) {
+    ZrVmTaskChannelMessage *first = ZR_NULL;
+    ZrVmTaskChannelMessage *last = ZR_NULL;
+    TZrSize index;
+
+    // messages are linked outside the lock so a batch costs one critical section.
+    for (index = 0; index < count; index++) {
+        ZrVmTaskChannelMessage *message = (ZrVmTaskChannelMessage *)malloc(sizeof(*message));
+
+        if (message == ZR_NULL) {
+            while (first != ZR_NULL) {
+                ZrVmTaskChannelMessage *next = first->next;
+                free(first);
+                first = next;
+            }
+            *outStatus = ZR_VM_TASK_CHANNEL_STATUS_OUT_OF_MEMORY;
+            return 0;
+        }
+        message->value = values[index];
+        message->next = ZR_NULL;
+        if (last != ZR_NULL) {
+            last->next = message;
+        } else {
+            first = message;
+        }
+        last = message;
+    }
+
+    zr_vm_task_sync_mutex_lock(&transport->mutex);
+    if (transport->closed) {
+        zr_vm_task_sync_mutex_unlock(&transport->mutex);
+        while (first != ZR_NULL) {
+            ZrVmTaskChannelMessage *next = first->next;
+            free(first);
+            first = next;
+        }
+        *outStatus = ZR_VM_TASK_CHANNEL_STATUS_CLOSED;
+        return 0;
+    }
+
+    if (transport->tail != ZR_NULL) {
+        transport->tail->next = first;
+    } else {
+        transport->head = first;
+    }
+    transport->tail = last;
+    transport->length += count;
+    zr_vm_task_sync_condition_signal(&transport->condition);
+    zr_vm_task_sync_mutex_unlock(&transport->mutex);
+    zr_vm_task_scheduler_signal_runtime(transport->notifyRuntime);
+
+    for (index = 0; index < count; index++) {
+        memset(&values[index], 0, sizeof(values[index]));
+    }
+    *outStatus = ZR_VM_TASK_CHANNEL_STATUS_OK;
+    return count;
+}
+
+static TZrSize zr_vm_task_channel_list_recv_many(ZrVmTaskChannelTransport *transport,
+                                                 ZrVmTaskTransportValue *outValues,
+                                                 TZrSize maxCount) {
+    ZrVmTaskChannelMessage *message;
+    ZrVmTaskChannelMessage *taken;
+    TZrSize count = 0;
+
+    zr_vm_task_sync_mutex_lock(&transport->mutex);
+    taken = transport->head;
+    message = taken;
+    while (message != ZR_NULL && count < maxCount) {
+        count++;
+        if (count == maxCount) {
+            break;
+        }
+        message = message->next;
+    }
+    if (count > 0) {
+        transport->head = message != ZR_NULL ? message->next : ZR_NULL;
+        if (message != ZR_NULL) {
+            message->next = ZR_NULL;
+        }
+        if (transport->head == ZR_NULL) {
+            transport->tail = ZR_NULL;
+        }
+        transport->length -= count;
+    }
+    zr_vm_task_sync_mutex_unlock(&transport->mutex);
+
+    count = 0;
+    while (taken != ZR_NULL) {
+        ZrVmTaskChannelMessage *next = taken->next;
+        outValues[count++] = taken->value;
+        free(taken);
+        taken = next;
+    }
+    return count;
+}
+
+/*
+ * Claims up to count consecutive free slots with a single CAS on enqueuePosition. A slot at
+ * position p is free for this lap when its sequence equals p; nobody else can claim p while
+ * enqueuePosition still reads below it, so a successful CAS owns the whole checked range.
+ */
+static TZrSize zr_vm_task_channel_ring_send_many(ZrVmTaskChannelTransport *transport,
+                                                 ZrVmTaskTransportValue *values,
+                                                 TZrSize count,
+                                                 EZrVmTaskChannelStatus *outStatus) {
+    TZrUInt64 position = zr_vm_task_atomic_load(&transport->enqueuePosition);
+    TZrSize claimed;
+    TZrSize index;
+
+    for (;;) {
+        if (zr_vm_task_atomic_load(&transport->closed)) {
+            *outStatus = ZR_VM_TASK_CHANNEL_STATUS_CLOSED;
+            return 0;
+        }
+
+        claimed = 0;
+        while (claimed < count && claimed <= transport->slotMask) {
+            ZrVmTaskChannelSlot *slot = &transport->slots[(position + claimed) & transport->slotMask];
+            if (zr_vm_task_atomic_load(&slot->sequence) != position + claimed) {
+                break;
+            }
+            claimed++;
+        }
+
+        if (claimed == 0) {
+            ZrVmTaskChannelSlot *slot = &transport->slots[position & transport->slotMask];
+            if ((TZrInt64)(zr_vm_task_atomic_load(&slot->sequence) - position) < 0) {
+                *outStatus = ZR_VM_TASK_CHANNEL_STATUS_FULL;
+                return 0;
+            }
+            position = zr_vm_task_atomic_load(&transport->enqueuePosition);
+            continue;
+        }
+
+        if (zr_vm_task_atomic_compare_exchange(&transport->enqueuePosition, position, position + claimed)) {
+            break;
+        }
+        position = zr_vm_task_atomic_load(&transport->enqueuePosition);
+    }
+
+    for (index = 0; index < claimed; index++) {
+        ZrVmTaskChannelSlot *slot = &transport->slots[(position + index) & transport->slotMask];
+
+        slot->value = values[index];
+        memset(&values[index], 0, sizeof(values[index]));
+        zr_vm_task_atomic_store(&slot->sequence, position + index + 1u);
+    }
+    // same wake-up as the list path, issued only after every claimed slot is published.
+    zr_vm_task_scheduler_signal_runtime(transport->notifyRuntime);
+
+    *outStatus = claimed == count ? ZR_VM_TASK_CHANNEL_STATUS_OK : ZR_VM_TASK_CHANNEL_STATUS_FULL;
+    return claimed;
+}
+
+static TZrSize zr_vm_task_channel_ring_recv_many(ZrVmTaskChannelTransport *transport,
+                                                 ZrVmTaskTransportValue *outValues,
+                                                 TZrSize maxCount) {
+    TZrUInt64 position = zr_vm_task_atomic_load(&transport->dequeuePosition);
+    TZrSize claimed;
+    TZrSize index;
+
+    for (;;) {
+        claimed = 0;
+        while (claimed < maxCount && claimed <= transport->slotMask) {
+            ZrVmTaskChannelSlot *slot = &transport->slots[(position + claimed) & transport->slotMask];
+            if (zr_vm_task_atomic_load(&slot->sequence) != position + claimed + 1u) {
+                break;
+            }
+            claimed++;
+        }
+
+        if (claimed == 0) {
+            ZrVmTaskChannelSlot *slot = &transport->slots[position & transport->slotMask];
+            if ((TZrInt64)(zr_vm_task_atomic_load(&slot->sequence) - (position + 1u)) < 0) {
+                return 0;
+            }
+            position = zr_vm_task_atomic_load(&transport->dequeuePosition);
+            continue;
+        }
+
+        if (zr_vm_task_atomic_compare_exchange(&transport->dequeuePosition, position, position + claimed)) {
+            break;
+        }
+        position = zr_vm_task_atomic_load(&transport->dequeuePosition);
+    }
+
+    for (index = 0; index < claimed; index++) {
+        ZrVmTaskChannelSlot *slot = &transport->slots[(position + index) & transport->slotMask];
+
+        outValues[index] = slot->value;
+        memset(&slot->value, 0, sizeof(slot->value));
+        zr_vm_task_atomic_store(&slot->sequence, position + index + transport->slotMask + 1u);
+    }
+
+    // senders only pay for the lock when one of them is actually parked on a full ring.
+    if (zr_vm_task_atomic_load(&transport->waitingSenders) > 0) {
+        zr_vm_task_sync_mutex_lock(&transport->mutex);
+        zr_vm_task_sync_condition_signal(&transport->condition);
+        zr_vm_task_sync_mutex_unlock(&transport->mutex);
+    }
+    return claimed;
+}
+
+TZrSize zr_vm_task_channel_transport_send_many(ZrVmTaskChannelTransport *transport,
+                                               ZrVmTaskTransportValue *values,
+                                               TZrSize count,
+                                               EZrVmTaskChannelStatus *outStatus) {
+    EZrVmTaskChannelStatus status = ZR_VM_TASK_CHANNEL_STATUS_OK;
+    TZrSize sent;
+
+    if (transport == ZR_NULL || (values == ZR_NULL && count > 0)) {
+        status = ZR_VM_TASK_CHANNEL_STATUS_CLOSED;
+        sent = 0;
+    } else if (count == 0) {
+        sent = 0;
+    } else if (transport->slots != ZR_NULL) {
+        sent = zr_vm_task_channel_ring_send_many(transport, values, count, &status);
+    } else {
+        sent = zr_vm_task_channel_list_send_many(transport, values, count, &status);
+    }
+
+    if (outStatus != ZR_NULL) {
+        *outStatus = status;
+    }
+    return sent;
+}
+
+TZrSize zr_vm_task_channel_transport_recv_many(ZrVmTaskChannelTransport *transport,
+                                               ZrVmTaskTransportValue *outValues,
+                                               TZrSize maxCount) {
+    if (transport == ZR_NULL || outValues == ZR_NULL || maxCount == 0) {
+        return 0;
+    }
+
+    return transport->slots != ZR_NULL ? zr_vm_task_channel_ring_recv_many(transport, outValues, maxCount)
+                                       : zr_vm_task_channel_list_recv_many(transport, outValues, maxCount);
+}
+
+static TZrBool zr_vm_task_channel_ring_is_full(ZrVmTaskChannelTransport *transport) {
+    TZrUInt64 position = zr_vm_task_atomic_load(&transport->enqueuePosition);
+    ZrVmTaskChannelSlot *slot = &transport->slots[position & transport->slotMask];
+
+    if (zr_vm_task_atomic_load(&transport->closed)) {
+        return ZR_FALSE;
+    }
+    return (TZrInt64)(zr_vm_task_atomic_load(&slot->sequence) - position) < 0 ? ZR_TRUE : ZR_FALSE;
+}
+
+void zr_vm_task_channel_transport_wait_not_full(ZrVmTaskChannelTransport *transport, TZrUInt32 timeoutMs) {
+    TZrUInt32 spin;
+
+    if (transport == ZR_NULL || transport->slots == ZR_NULL) {
+        return;
+    }
+
+    // receivers usually drain within a few time slices, which is far cheaper than a condition round trip.
+    for (spin = 0; spin < ZR_VM_TASK_CHANNEL_SEND_SPIN_COUNT; spin++) {
+        if (!zr_vm_task_channel_ring_is_full(transport)) {
+            return;
+        }
+        zr_vm_task_sync_yield_thread();
+    }
+
+    zr_vm_task_atomic_add(&transport->waitingSenders, 1);
+    zr_vm_task_sync_mutex_lock(&transport->mutex);
+    // the timeout bounds the window where a receiver drained the ring before this sender registered.
+    if (zr_vm_task_channel_ring_is_full(transport)) {
+        zr_vm_task_sync_condition_wait(&transport->condition, &transport->mutex, timeoutMs);
+    }
+    zr_vm_task_sync_mutex_unlock(&transport->mutex);
+    zr_vm_task_atomic_add(&transport->waitingSenders, -1);
+}
+
+void zr_vm_task_channel_transport_close(ZrVmTaskChannelTransport *transport) {
+    if (transport == ZR_NULL) {
+        return;
+    }
+
+    zr_vm_task_sync_mutex_lock(&transport->mutex);
+    zr_vm_task_atomic_store(&transport->closed, 1u);
+    zr_vm_task_sync_condition_signal(&transport->condition);
+    zr_vm_task_sync_mutex_unlock(&transport->mutex);
+    zr_vm_task_scheduler_signal_runtime(transport->notifyRuntime);
+}
+
+TZrBool zr_vm_task_channel_transport_is_closed(ZrVmTaskChannelTransport *transport) {
+    return transport != ZR_NULL && zr_vm_task_atomic_load(&transport->closed) ? ZR_TRUE : ZR_FALSE;
+}
+
+TZrUInt64 zr_vm_task_channel_transport_length(ZrVmTaskChannelTransport *transport) {
+    TZrUInt64 length;
+
+    if (transport == ZR_NULL) {
+        return 0;
+    }
+
+    if (transport->slots != ZR_NULL) {
+        TZrUInt64 dequeuePosition = zr_vm_task_atomic_load(&transport->dequeuePosition);
+        TZrUInt64 enqueuePosition = zr_vm_task_atomic_load(&transport->enqueuePosition);
+
+        // claimed-but-unpublished slots count as queued; the snapshot is clamped to the ring size.
+        length = enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+        return length > transport->capacity ? transport->capacity : length;
+    }
+
+    zr_vm_task_sync_mutex_lock(&transport->mutex);
+    length = transport->length;
+    zr_vm_task_sync_mutex_unlock(&transport->mutex);
+    return length;
+}
@@ -15,6 +15,7 @@
 #else
 #include <errno.h>
 #include <pthread.h>
+#include <sched.h>
 #include <time.h>
 #endif
 
@@ -117,11 +118,17 @@ typedef struct ZrVmTaskSchedulerMessage {
     struct ZrVmTaskSchedulerMessage *next;
 } ZrVmTaskSchedulerMessage;
 
+/*
+ * Worker completions are pushed onto a lock-free LIFO stack (one CAS per message). The owning
+ * isolate is the only consumer: it detaches the whole stack with one exchange and reverses it into
+ * the owner-private pending list, so completions are still processed in arrival order.
+ * The mutex and condition only back channel wakeups.
+ */
 typedef struct ZrVmTaskSchedulerRuntime {
     ZrVmTaskMutex mutex;
     ZrVmTaskCondition condition;
-    ZrVmTaskSchedulerMessage *head;
-    ZrVmTaskSchedulerMessage *tail;
+    TZrPtr volatile completionStack;
+    ZrVmTaskSchedulerMessage *pending;
     TZrUInt64 isolateId;
 } ZrVmTaskSchedulerRuntime;
 
@@ -130,6 +137,29 @@ typedef struct ZrVmTaskChannelMessage {
     struct ZrVmTaskChannelMessage *next;
 } ZrVmTaskChannelMessage;
 
+#define ZR_VM_TASK_CACHE_LINE_SIZE 64u
+// A sender on a full bounded ring yields its time slice this many times before parking on the transport condition.
+#define ZR_VM_TASK_CHANNEL_SEND_SPIN_COUNT 64u
+#define ZR_VM_TASK_CHANNEL_SEND_WAIT_MS 1u
+
+typedef enum EZrVmTaskChannelStatus {
+    ZR_VM_TASK_CHANNEL_STATUS_OK = 0,
+    ZR_VM_TASK_CHANNEL_STATUS_FULL = 1,
+    ZR_VM_TASK_CHANNEL_STATUS_CLOSED = 2,
+    ZR_VM_TASK_CHANNEL_STATUS_OUT_OF_MEMORY = 3
+} EZrVmTaskChannelStatus;
+
+// Ring slot of a bounded channel; sequence is the Vyukov turn counter that hands the slot between sides.
+typedef struct ZrVmTaskChannelSlot {
+    volatile TZrUInt64 sequence;
+    ZrVmTaskTransportValue value;
+} ZrVmTaskChannelSlot;
+
+/*
+ * Unbounded channels (capacity 0) keep the mutex-guarded message list. Bounded channels use a
+ * power-of-two MPMC ring whose send/recv fast path is a CAS on enqueuePosition/dequeuePosition;
+ * the mutex and condition are then only used to park senders while the ring is full.
+ */
 typedef struct ZrVmTaskChannelTransport {
     ZrVmTaskMutex mutex;
     ZrVmTaskCondition condition;
@@ -137,9 +167,71 @@ typedef struct ZrVmTaskChannelTransport {
     ZrVmTaskChannelMessage *head;
     ZrVmTaskChannelMessage *tail;
     TZrUInt64 length;
-    TZrBool closed;
+    ZrVmTaskChannelSlot *slots;
+    TZrUInt64 capacity;
+    TZrUInt64 slotMask;
+    volatile TZrUInt64 closed;
+    volatile TZrUInt64 waitingSenders;
+    TZrUInt8 enqueuePadding[ZR_VM_TASK_CACHE_LINE_SIZE];
+    volatile TZrUInt64 enqueuePosition;
+    TZrUInt8 dequeuePadding[ZR_VM_TASK_CACHE_LINE_SIZE - sizeof(TZrUInt64)];
+    volatile TZrUInt64 dequeuePosition;
+    TZrUInt8 tailPadding[ZR_VM_TASK_CACHE_LINE_SIZE - sizeof(TZrUInt64)];
 } ZrVmTaskChannelTransport;
 
+// Serialized worker callable; immutable once written and shared by its launch and the warm isolate that loaded it.
+typedef struct ZrVmTaskCallableBlob {
+    TZrUInt32 refCount;
+    TZrUInt32 reserved;
+    TZrSize length;
+    TZrByte *bytes;
+} ZrVmTaskCallableBlob;
+
+typedef struct ZrVmTaskWorkerLaunch {
+    ZrVmTaskCallableBlob *callable;
+    // compiled script modules of the spawning isolate; lets a cold worker isolate skip recompiling its imports.
+    struct SZrModuleStartupImage *startupImage;
+    TZrChar *projectFile;
+    TZrChar *projectDirectory;
+    TZrChar *projectSource;
+    TZrChar *projectBinary;
+    TZrChar *projectEntry;
+    TZrUInt32 captureCount;
+    ZrVmTaskTransportValue *captures;
+    ZrVmTaskSchedulerRuntime *ownerRuntime;
+    struct SZrObject *ownerHandle;
+    FZrAllocator allocator;
+    TZrPtr userAllocationArguments;
+    TZrUInt64 workerIsolateId;
+    TZrBool supportMultithread;
+    TZrBool autoCoroutine;
+    struct ZrVmTaskWorkerLaunch *next;
+} ZrVmTaskWorkerLaunch;
+
+/*
+ * Work-stealing scheduler pool: a fixed set of worker threads, each pinned to its own warm isolate.
+ * Launches are injected through a lock-free stack, moved by the worker that grabs them into its
+ * Chase-Lev deque, and stolen from the top of that deque by idle workers.
+ */
+typedef struct ZrVmTaskStealPool ZrVmTaskStealPool;
+
+// Warm worker isolate owned by one pool thread; reused while the next launch matches its key.
+typedef struct ZrVmTaskWorkerIsolate {
+    SZrGlobalState *global;
+    struct SZrLibrary_Project *project;
+    FZrAllocator allocator;
+    TZrPtr userAllocationArguments;
+    TZrChar *projectFile;
+    TZrChar *projectDirectory;
+    TZrChar *projectSource;
+    TZrChar *projectBinary;
+    TZrChar *projectEntry;
+    TZrBool supportMultithread;
+    TZrBool autoCoroutine;
+    ZrVmTaskCallableBlob *cachedCallable;
+    struct SZrFunction *cachedFunction;
+} ZrVmTaskWorkerIsolate;
+
 #if defined(ZR_PLATFORM_WIN)
 static ZR_FORCE_INLINE void zr_vm_task_sync_mutex_init(ZrVmTaskMutex *mutex) { InitializeCriticalSection(mutex); }
 static ZR_FORCE_INLINE void zr_vm_task_sync_mutex_destroy(ZrVmTaskMutex *mutex) { DeleteCriticalSection(mutex); }
@@ -158,6 +250,37 @@ static ZR_FORCE_INLINE TZrBool zr_vm_task_sync_condition_wait(ZrVmTaskCondition
     return SleepConditionVariableCS(condition, mutex, timeoutMs) ? ZR_TRUE : ZR_FALSE;
 }
 static ZR_FORCE_INLINE void zr_vm_task_sync_sleep_ms(TZrUInt32 timeoutMs) { Sleep(timeoutMs); }
+static ZR_FORCE_INLINE void zr_vm_task_sync_yield_thread(void) { SwitchToThread(); }
+static ZR_FORCE_INLINE TZrUInt64 zr_vm_task_atomic_load(volatile TZrUInt64 *target) {
+    return (TZrUInt64)InterlockedCompareExchange64((volatile LONG64 *)target, 0, 0);
+}
+static ZR_FORCE_INLINE void zr_vm_task_atomic_store(volatile TZrUInt64 *target, TZrUInt64 value) {
+    InterlockedExchange64((volatile LONG64 *)target, (LONG64)value);
+}
+static ZR_FORCE_INLINE TZrUInt64 zr_vm_task_atomic_add(volatile TZrUInt64 *target, TZrInt64 delta) {
+    return (TZrUInt64)InterlockedExchangeAdd64((volatile LONG64 *)target, (LONG64)delta) + (TZrUInt64)delta;
+}
+static ZR_FORCE_INLINE TZrBool zr_vm_task_atomic_compare_exchange(volatile TZrUInt64 *target,
+                                                                  TZrUInt64 expected,
+                                                                  TZrUInt64 desired) {
+    return (TZrUInt64)InterlockedCompareExchange64((volatile LONG64 *)target, (LONG64)desired, (LONG64)expected) ==
+           expected;
+}
+static ZR_FORCE_INLINE TZrPtr zr_vm_task_atomic_load_pointer(TZrPtr volatile *target) {
+    return InterlockedCompareExchangePointer(target, ZR_NULL, ZR_NULL);
+}
+static ZR_FORCE_INLINE void zr_vm_task_atomic_store_pointer(TZrPtr volatile *target, TZrPtr value) {
+    InterlockedExchangePointer(target, value);
+}
+static ZR_FORCE_INLINE TZrPtr zr_vm_task_atomic_exchange_pointer(TZrPtr volatile *target, TZrPtr value) {
+    return InterlockedExchangePointer(target, value);
+}
+static ZR_FORCE_INLINE TZrBool zr_vm_task_atomic_compare_exchange_pointer(TZrPtr volatile *target,
+                                                                          TZrPtr expected,
+                                                                          TZrPtr desired) {
+    return InterlockedCompareExchangePointer(target, desired, expected) == expected;
+}
+static ZR_FORCE_INLINE void zr_vm_task_atomic_fence(void) { MemoryBarrier(); }
 #else
 static ZR_FORCE_INLINE void zr_vm_task_sync_mutex_init(ZrVmTaskMutex *mutex) { pthread_mutex_init(mutex, ZR_NULL); }
 static ZR_FORCE_INLINE void zr_vm_task_sync_mutex_destroy(ZrVmTaskMutex *mutex) { pthread_mutex_destroy(mutex); }
@@ -186,6 +309,40 @@ static ZR_FORCE_INLINE void zr_vm_task_sync_sleep_ms(TZrUInt32 timeoutMs) {
     ts.tv_nsec = (long)(timeoutMs % 1000u) * 1000000L;
     nanosleep(&ts, ZR_NULL);
 }
+static ZR_FORCE_INLINE void zr_vm_task_sync_yield_thread(void) { sched_yield(); }
+static ZR_FORCE_INLINE TZrUInt64 zr_vm_task_atomic_load(volatile TZrUInt64 *target) {
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+}
+static ZR_FORCE_INLINE void zr_vm_task_atomic_store(volatile TZrUInt64 *target, TZrUInt64 value) {
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+}
+static ZR_FORCE_INLINE TZrUInt64 zr_vm_task_atomic_add(volatile TZrUInt64 *target, TZrInt64 delta) {
+    return __atomic_add_fetch(target, (TZrUInt64)delta, __ATOMIC_ACQ_REL);
+}
+static ZR_FORCE_INLINE TZrBool zr_vm_task_atomic_compare_exchange(volatile TZrUInt64 *target,
+                                                                  TZrUInt64 expected,
+                                                                  TZrUInt64 desired) {
+    return __atomic_compare_exchange_n(target, &expected, desired, ZR_FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+                   ? ZR_TRUE
+                   : ZR_FALSE;
+}
+static ZR_FORCE_INLINE TZrPtr zr_vm_task_atomic_load_pointer(TZrPtr volatile *target) {
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+}
+static ZR_FORCE_INLINE void zr_vm_task_atomic_store_pointer(TZrPtr volatile *target, TZrPtr value) {
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+}
+static ZR_FORCE_INLINE TZrPtr zr_vm_task_atomic_exchange_pointer(TZrPtr volatile *target, TZrPtr value) {
+    return __atomic_exchange_n(target, value, __ATOMIC_ACQ_REL);
+}
+static ZR_FORCE_INLINE TZrBool zr_vm_task_atomic_compare_exchange_pointer(TZrPtr volatile *target,
+                                                                          TZrPtr expected,
+                                                                          TZrPtr desired) {
+    return __atomic_compare_exchange_n(target, &expected, desired, ZR_FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+                   ? ZR_TRUE
+                   : ZR_FALSE;
+}
+static ZR_FORCE_INLINE void zr_vm_task_atomic_fence(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
 #endif
 
 SZrObject *zr_vm_task_self_object(const ZrLibCallContext *context);
@@ -195,6 +352,7 @@ ZrVmTaskSchedulerRuntime *zr_vm_task_scheduler_get_runtime(SZrState *state, SZrO
 void zr_vm_task_scheduler_signal_runtime(ZrVmTaskSchedulerRuntime *runtime);
 TZrBool zr_vm_task_scheduler_process_external(SZrState *state, SZrObject *scheduler);
 TZrBool zr_vm_task_scheduler_wait_for_external(SZrState *state, SZrObject *scheduler, TZrUInt32 timeoutMs);
+TZrBool zr_vm_task_scheduler_yield(SZrState *state);
 void zr_vm_task_record_last_worker_isolate(SZrState *state, TZrUInt64 isolateId);
 TZrUInt64 zr_vm_task_next_worker_isolate_id(void);
 TZrBool zr_vm_task_finish_object(SZrState *state, SZrTypeValue *result, SZrObject *object);
@@ -243,6 +401,19 @@ TZrBool zr_vm_task_channel_try_get_transport(SZrState *state,
                                              const SZrTypeValue *value,
                                              ZrVmTaskChannelTransport **outTransport);
 TZrBool zr_vm_task_channel_make_value(SZrState *state, ZrVmTaskChannelTransport *transport, SZrTypeValue *result);
+ZrVmTaskChannelTransport *zr_vm_task_channel_transport_new(TZrUInt64 capacity);
+void zr_vm_task_channel_transport_free(ZrVmTaskChannelTransport *transport);
+TZrSize zr_vm_task_channel_transport_send_many(ZrVmTaskChannelTransport *transport,
+                                               ZrVmTaskTransportValue *values,
+                                               TZrSize count,
+                                               EZrVmTaskChannelStatus *outStatus);
+TZrSize zr_vm_task_channel_transport_recv_many(ZrVmTaskChannelTransport *transport,
+                                               ZrVmTaskTransportValue *outValues,
+                                               TZrSize maxCount);
+void zr_vm_task_channel_transport_wait_not_full(ZrVmTaskChannelTransport *transport, TZrUInt32 timeoutMs);
+void zr_vm_task_channel_transport_close(ZrVmTaskChannelTransport *transport);
+TZrBool zr_vm_task_channel_transport_is_closed(ZrVmTaskChannelTransport *transport);
+TZrUInt64 zr_vm_task_channel_transport_length(ZrVmTaskChannelTransport *transport);
 TZrBool zr_vm_task_mutex_try_get_cell(SZrState *state,
                                       const SZrTypeValue *value,
                                       ZrVmTaskMutexCell **outCell,
@@ -270,7 +441,17 @@ void zr_vm_task_shared_cell_release_weak(ZrVmTaskSharedCell *cell);
 TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context,
                                        const SZrTypeValue *callable,
                                        SZrTypeValue *result,
-                                       SZrObject *mainScheduler);
+                                       SZrObject *mainScheduler,
+                                       ZrVmTaskStealPool *stealPool);
+void zr_vm_task_worker_launch_free(ZrVmTaskWorkerLaunch *launch);
+TZrBool zr_vm_task_worker_run_launch(ZrVmTaskWorkerIsolate *isolate, ZrVmTaskWorkerLaunch *launch);
+void zr_vm_task_worker_isolate_release(ZrVmTaskWorkerIsolate *isolate);
+TZrBool zr_vm_task_worker_pool_submit(ZrVmTaskWorkerLaunch *launch);
+ZrVmTaskStealPool *zr_vm_task_steal_pool_new(TZrUInt32 workerCount);
+TZrBool zr_vm_task_steal_pool_submit(ZrVmTaskStealPool *pool, ZrVmTaskWorkerLaunch *launch);
+TZrUInt32 zr_vm_task_steal_pool_worker_count(const ZrVmTaskStealPool *pool);
+TZrUInt64 zr_vm_task_steal_pool_steal_count(ZrVmTaskStealPool *pool);
+void zr_vm_task_steal_pool_shutdown(ZrVmTaskStealPool *pool);
 
 TZrBool zr_vm_task_channel_construct(ZrLibCallContext *context, SZrTypeValue *result);
 TZrBool zr_vm_task_channel_send(ZrLibCallContext *context, SZrTypeValue *result);
@@ -278,6 +459,10 @@ TZrBool zr_vm_task_channel_recv(ZrLibCallContext *context, SZrTypeValue *result)
 TZrBool zr_vm_task_channel_close(ZrLibCallContext *context, SZrTypeValue *result);
 TZrBool zr_vm_task_channel_is_closed(ZrLibCallContext *context, SZrTypeValue *result);
 TZrBool zr_vm_task_channel_length(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool zr_vm_task_channel_capacity(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool zr_vm_task_channel_try_send(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool zr_vm_task_channel_send_many(ZrLibCallContext *context, SZrTypeValue *result);
+TZrBool zr_vm_task_channel_recv_many(ZrLibCallContext *context, SZrTypeValue *result);
 TZrBool zr_vm_task_shared_construct(ZrLibCallContext *context, SZrTypeValue *result);
 TZrBool zr_vm_task_shared_load(ZrLibCallContext *context, SZrTypeValue *result);
 TZrBool zr_vm_task_shared_store(ZrLibCallContext *context, SZrTypeValue *result);
@@ -0,0 +1,443 @@
+//
+// Work-stealing zr.thread scheduler pool: a fixed set of worker threads, each keeping its own warm
+// isolate and a Chase-Lev deque of launches, fed through a shared lock-free injection stack.
+//
+
+#include "runtime/runtime_internal.h"
+
+#if defined(ZR_PLATFORM_WIN)
+#include <process.h>
+#endif
+
+// per-worker deque slots (power of two); launches that do not fit stay on the injection stack.
+#define ZR_VM_TASK_STEAL_DEQUE_CAPACITY 256u
+#define ZR_VM_TASK_STEAL_DEQUE_MASK (ZR_VM_TASK_STEAL_DEQUE_CAPACITY - 1u)
+// an idle worker rescans its peers this many times, yielding in between, before it parks.
+#define ZR_VM_TASK_STEAL_SPIN_COUNT 32u
+// parked workers still wake this often, so a missed wakeup only costs latency.
+#define ZR_VM_TASK_STEAL_PARK_POLL_MS 10u
+
+/*
+ * Chase-Lev deque: the owning worker pushes and takes at bottom, thieves CAS top forward.
+ * Both indices start at 1 so bottom - 1 never wraps below top.
+ */
+typedef struct ZrVmTaskStealDeque {
+    volatile TZrUInt64 top;
+    TZrUInt8 topPadding[ZR_VM_TASK_CACHE_LINE_SIZE - sizeof(TZrUInt64)];
+    volatile TZrUInt64 bottom;
+    TZrUInt8 bottomPadding[ZR_VM_TASK_CACHE_LINE_SIZE - sizeof(TZrUInt64)];
+    TZrPtr volatile slots[ZR_VM_TASK_STEAL_DEQUE_CAPACITY];
+} ZrVmTaskStealDeque;
+
+typedef struct ZrVmTaskStealWorker {
+    ZrVmTaskStealDeque deque;
+    ZrVmTaskStealPool *pool;
+    TZrUInt32 index;
+    TZrUInt32 randomState;
+    TZrUInt32 idlePolls;
+    // guarded by pool->mutex; cleared as soon as the worker decides to retire.
+    TZrBool live;
+} ZrVmTaskStealWorker;
+
+struct ZrVmTaskStealPool {
+    ZrVmTaskMutex mutex;
+    ZrVmTaskCondition workCondition;
+    ZrVmTaskCondition exitCondition;
+    TZrPtr volatile injectStack;
+    // launches submitted but not yet taken by a worker, wherever they currently sit.
+    volatile TZrUInt64 queuedCount;
+    volatile TZrUInt64 sleepingWorkers;
+    volatile TZrUInt64 liveWorkers;
+    volatile TZrUInt64 stealCount;
+    TZrUInt32 workerCount;
+    TZrUInt32 idleTimeoutMs;
+    TZrUInt32 threadCount;
+    TZrBool shuttingDown;
+    ZrVmTaskStealWorker *workers;
+};
+
+static TZrBool zr_vm_task_steal_deque_push(ZrVmTaskStealDeque *deque, ZrVmTaskWorkerLaunch *launch) {
+    TZrUInt64 bottom = zr_vm_task_atomic_load(&deque->bottom);
+    TZrUInt64 top = zr_vm_task_atomic_load(&deque->top);
+
+    if (bottom - top >= ZR_VM_TASK_STEAL_DEQUE_CAPACITY) {
+        return ZR_FALSE;
+    }
+
+    zr_vm_task_atomic_store_pointer(&deque->slots[bottom & ZR_VM_TASK_STEAL_DEQUE_MASK], launch);
+    zr_vm_task_atomic_store(&deque->bottom, bottom + 1u);
+    return ZR_TRUE;
+}
+
+static ZrVmTaskWorkerLaunch *zr_vm_task_steal_deque_take(ZrVmTaskStealDeque *deque) {
+    TZrUInt64 bottom = zr_vm_task_atomic_load(&deque->bottom) - 1u;
+    TZrUInt64 top;
+    ZrVmTaskWorkerLaunch *launch;
+
+    zr_vm_task_atomic_store(&deque->bottom, bottom);
+    zr_vm_task_atomic_fence();
+    top = zr_vm_task_atomic_load(&deque->top);
+    if (top > bottom) {
+        zr_vm_task_atomic_store(&deque->bottom, bottom + 1u);
+        return ZR_NULL;
+    }
+
+    launch = (ZrVmTaskWorkerLaunch *)zr_vm_task_atomic_load_pointer(
+            &deque->slots[bottom & ZR_VM_TASK_STEAL_DEQUE_MASK]);
+    if (top == bottom) {
+        // last element: race the thieves for it through top.
+        if (!zr_vm_task_atomic_compare_exchange(&deque->top, top, top + 1u)) {
+            launch = ZR_NULL;
+        }
+        zr_vm_task_atomic_store(&deque->bottom, bottom + 1u);
+    }
+    return launch;
+}
+
+static ZrVmTaskWorkerLaunch *zr_vm_task_steal_deque_steal(ZrVmTaskStealDeque *deque) {
+    TZrUInt64 top = zr_vm_task_atomic_load(&deque->top);
+    TZrUInt64 bottom;
+    ZrVmTaskWorkerLaunch *launch;
+
+    zr_vm_task_atomic_fence();
+    bottom = zr_vm_task_atomic_load(&deque->bottom);
+    if (top >= bottom) {
+        return ZR_NULL;
+    }
+
+    launch = (ZrVmTaskWorkerLaunch *)zr_vm_task_atomic_load_pointer(&deque->slots[top & ZR_VM_TASK_STEAL_DEQUE_MASK]);
+    if (!zr_vm_task_atomic_compare_exchange(&deque->top, top, top + 1u)) {
+        return ZR_NULL;
+    }
+    return launch;
+}
+
+static void zr_vm_task_steal_pool_inject_chain(ZrVmTaskStealPool *pool,
+                                               ZrVmTaskWorkerLaunch *first,
+                                               ZrVmTaskWorkerLaunch *last) {
+    TZrPtr top;
+
+    do {
+        top = zr_vm_task_atomic_load_pointer(&pool->injectStack);
+        last->next = (ZrVmTaskWorkerLaunch *)top;
+    } while (!zr_vm_task_atomic_compare_exchange_pointer(&pool->injectStack, top, first));
+}
+
+static void zr_vm_task_steal_pool_wake_sleepers(ZrVmTaskStealPool *pool) {
+    zr_vm_task_atomic_fence();
+    if (zr_vm_task_atomic_load(&pool->sleepingWorkers) == 0u) {
+        return;
+    }
+
+    zr_vm_task_sync_mutex_lock(&pool->mutex);
+    zr_vm_task_sync_condition_signal(&pool->workCondition);
+    zr_vm_task_sync_mutex_unlock(&pool->mutex);
+}
+
+/*
+ * Detaches the whole injection stack, runs its oldest launch directly and moves the rest into the
+ * worker's deque where idle peers can steal them. Overflow goes back onto the injection stack.
+ */
+static ZrVmTaskWorkerLaunch *zr_vm_task_steal_worker_grab_injected(ZrVmTaskStealWorker *worker) {
+    ZrVmTaskStealPool *pool = worker->pool;
+    ZrVmTaskWorkerLaunch *stack;
+    ZrVmTaskWorkerLaunch *ordered = ZR_NULL;
+    ZrVmTaskWorkerLaunch *first;
+    TZrBool pushed = ZR_FALSE;
+
+    if (zr_vm_task_atomic_load_pointer(&pool->injectStack) == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    stack = (ZrVmTaskWorkerLaunch *)zr_vm_task_atomic_exchange_pointer(&pool->injectStack, ZR_NULL);
+    while (stack != ZR_NULL) {
+        ZrVmTaskWorkerLaunch *next = stack->next;
+
+        stack->next = ordered;
+        ordered = stack;
+        stack = next;
+    }
+    if (ordered == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    first = ordered;
+    ordered = ordered->next;
+    first->next = ZR_NULL;
+    while (ordered != ZR_NULL) {
+        ZrVmTaskWorkerLaunch *next = ordered->next;
+
+        if (!zr_vm_task_steal_deque_push(&worker->deque, ordered)) {
+            ZrVmTaskWorkerLaunch *last = ordered;
+
+            while (last->next != ZR_NULL) {
+                last = last->next;
+            }
+            zr_vm_task_steal_pool_inject_chain(pool, ordered, last);
+            break;
+        }
+        ordered->next = ZR_NULL;
+        pushed = ZR_TRUE;
+        ordered = next;
+    }
+
+    if (pushed) {
+        zr_vm_task_steal_pool_wake_sleepers(pool);
+    }
+    return first;
+}
+
+static ZrVmTaskWorkerLaunch *zr_vm_task_steal_worker_steal(ZrVmTaskStealWorker *worker) {
+    ZrVmTaskStealPool *pool = worker->pool;
+    TZrUInt32 start;
+    TZrUInt32 offset;
+
+    if (pool->workerCount < 2u) {
+        return ZR_NULL;
+    }
+
+    // xorshift32 victim order keeps thieves from converging on the same deque.
+    worker->randomState ^= worker->randomState << 13;
+    worker->randomState ^= worker->randomState >> 17;
+    worker->randomState ^= worker->randomState << 5;
+    start = worker->randomState % pool->workerCount;
+    for (offset = 0; offset < pool->workerCount; offset++) {
+        TZrUInt32 victim = (start + offset) % pool->workerCount;
+        ZrVmTaskWorkerLaunch *launch;
+
+        if (victim == worker->index) {
+            continue;
+        }
+
+        launch = zr_vm_task_steal_deque_steal(&pool->workers[victim].deque);
+        if (launch != ZR_NULL) {
+            zr_vm_task_atomic_add(&pool->stealCount, 1);
+            return launch;
+        }
+    }
+    return ZR_NULL;
+}
+
+static ZrVmTaskWorkerLaunch *zr_vm_task_steal_worker_find(ZrVmTaskStealWorker *worker) {
+    ZrVmTaskWorkerLaunch *launch = zr_vm_task_steal_deque_take(&worker->deque);
+
+    if (launch == ZR_NULL) {
+        launch = zr_vm_task_steal_worker_grab_injected(worker);
+    }
+    if (launch == ZR_NULL) {
+        launch = zr_vm_task_steal_worker_steal(worker);
+    }
+    return launch;
+}
+
+// Parks until new work is submitted; returns ZR_FALSE when the worker should retire instead.
+static TZrBool zr_vm_task_steal_worker_park(ZrVmTaskStealWorker *worker) {
+    ZrVmTaskStealPool *pool = worker->pool;
+    TZrBool keepRunning = ZR_TRUE;
+    TZrBool idleExpired = ZR_FALSE;
+
+    zr_vm_task_sync_mutex_lock(&pool->mutex);
+    zr_vm_task_atomic_add(&pool->sleepingWorkers, 1);
+    zr_vm_task_atomic_fence();
+    if (zr_vm_task_atomic_load(&pool->queuedCount) == 0u && !pool->shuttingDown) {
+        if (!zr_vm_task_sync_condition_wait(&pool->workCondition, &pool->mutex, ZR_VM_TASK_STEAL_PARK_POLL_MS)) {
+            worker->idlePolls++;
+            idleExpired = pool->idleTimeoutMs != 0u &&
+                          (TZrUInt64)worker->idlePolls * ZR_VM_TASK_STEAL_PARK_POLL_MS >= pool->idleTimeoutMs;
+        }
+    }
+    zr_vm_task_atomic_add(&pool->sleepingWorkers, -1);
+
+    if (pool->shuttingDown || idleExpired) {
+        // pairs with the queuedCount/liveWorkers check in submit: one side always sees the other.
+        zr_vm_task_atomic_add(&pool->liveWorkers, -1);
+        zr_vm_task_atomic_fence();
+        if (zr_vm_task_atomic_load(&pool->queuedCount) == 0u) {
+            worker->live = ZR_FALSE;
+            keepRunning = ZR_FALSE;
+        } else {
+            zr_vm_task_atomic_add(&pool->liveWorkers, 1);
+        }
+    }
+    zr_vm_task_sync_mutex_unlock(&pool->mutex);
+    return keepRunning;
+}
+
+static void zr_vm_task_steal_worker_run(ZrVmTaskStealWorker *worker) {
+    ZrVmTaskStealPool *pool = worker->pool;
+    ZrVmTaskWorkerIsolate isolate;
+    TZrUInt32 spins = 0;
+
+    memset(&isolate, 0, sizeof(isolate));
+    for (;;) {
+        ZrVmTaskWorkerLaunch *launch = zr_vm_task_steal_worker_find(worker);
+
+        if (launch != ZR_NULL) {
+            zr_vm_task_atomic_add(&pool->queuedCount, -1);
+            spins = 0;
+            worker->idlePolls = 0;
+            zr_vm_task_worker_run_launch(&isolate, launch);
+            zr_vm_task_worker_launch_free(launch);
+            continue;
+        }
+
+        if (spins < ZR_VM_TASK_STEAL_SPIN_COUNT) {
+            spins++;
+            zr_vm_task_sync_yield_thread();
+            continue;
+        }
+
+        spins = 0;
+        if (!zr_vm_task_steal_worker_park(worker)) {
+            break;
+        }
+    }
+
+    zr_vm_task_worker_isolate_release(&isolate);
+
+    zr_vm_task_sync_mutex_lock(&pool->mutex);
+    pool->threadCount--;
+    zr_vm_task_sync_condition_signal(&pool->exitCondition);
+    zr_vm_task_sync_mutex_unlock(&pool->mutex);
+}
+
+#if defined(ZR_PLATFORM_WIN)
+static unsigned __stdcall zr_vm_task_steal_worker_entry(void *argument) {
+    zr_vm_task_steal_worker_run((ZrVmTaskStealWorker *)argument);
+    return 0;
+}
+#else
+static void *zr_vm_task_steal_worker_entry(void *argument) {
+    zr_vm_task_steal_worker_run((ZrVmTaskStealWorker *)argument);
+    return ZR_NULL;
+}
+#endif
+
+static TZrBool zr_vm_task_steal_worker_start_thread(ZrVmTaskStealWorker *worker) {
+#if defined(ZR_PLATFORM_WIN)
+    uintptr_t threadHandle = _beginthreadex(ZR_NULL, 0, zr_vm_task_steal_worker_entry, worker, 0, ZR_NULL);
+    if (threadHandle == 0) {
+        return ZR_FALSE;
+    }
+    CloseHandle((HANDLE)threadHandle);
+    return ZR_TRUE;
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, ZR_NULL, zr_vm_task_steal_worker_entry, worker) != 0) {
+        return ZR_FALSE;
+    }
+    pthread_detach(thread);
+    return ZR_TRUE;
+#endif
+}
+
+// starts a thread for every retired or never-started worker slot; caller holds pool->mutex.
+static void zr_vm_task_steal_pool_start_workers_locked(ZrVmTaskStealPool *pool) {
+    TZrUInt32 index;
+
+    for (index = 0; index < pool->workerCount; index++) {
+        ZrVmTaskStealWorker *worker = &pool->workers[index];
+
+        if (worker->live) {
+            continue;
+        }
+
+        worker->idlePolls = 0;
+        if (!zr_vm_task_steal_worker_start_thread(worker)) {
+            break;
+        }
+        worker->live = ZR_TRUE;
+        pool->threadCount++;
+        zr_vm_task_atomic_add(&pool->liveWorkers, 1);
+    }
+}
+
+ZrVmTaskStealPool *zr_vm_task_steal_pool_new(TZrUInt32 workerCount) {
+    ZrVmTaskStealPool *pool;
+    TZrUInt32 index;
+
+    if (workerCount == 0u || workerCount > ZR_VM_THREAD_STEAL_SCHEDULER_MAX_WORKERS) {
+        return ZR_NULL;
+    }
+
+    pool = (ZrVmTaskStealPool *)malloc(sizeof(*pool));
+    if (pool == ZR_NULL) {
+        return ZR_NULL;
+    }
+    memset(pool, 0, sizeof(*pool));
+
+    pool->workers = (ZrVmTaskStealWorker *)calloc(workerCount, sizeof(ZrVmTaskStealWorker));
+    if (pool->workers == ZR_NULL) {
+        free(pool);
+        return ZR_NULL;
+    }
+
+    zr_vm_task_sync_mutex_init(&pool->mutex);
+    zr_vm_task_sync_condition_init(&pool->workCondition);
+    zr_vm_task_sync_condition_init(&pool->exitCondition);
+    pool->workerCount = workerCount;
+    pool->idleTimeoutMs = ZR_VM_THREAD_WORKER_POOL_DEFAULT_IDLE_TIMEOUT_MS;
+    for (index = 0; index < workerCount; index++) {
+        ZrVmTaskStealWorker *worker = &pool->workers[index];
+
+        worker->deque.top = 1u;
+        worker->deque.bottom = 1u;
+        worker->pool = pool;
+        worker->index = index;
+        worker->randomState = 0x9E3779B9u ^ (index * 0x85EBCA6Bu + 1u);
+    }
+    return pool;
+}
+
+TZrBool zr_vm_task_steal_pool_submit(ZrVmTaskStealPool *pool, ZrVmTaskWorkerLaunch *launch) {
+    if (pool == ZR_NULL || launch == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // counted before the liveness check so a worker deciding to retire sees the pending launch.
+    zr_vm_task_atomic_add(&pool->queuedCount, 1);
+    zr_vm_task_atomic_fence();
+    if (zr_vm_task_atomic_load(&pool->liveWorkers) < pool->workerCount) {
+        zr_vm_task_sync_mutex_lock(&pool->mutex);
+        zr_vm_task_steal_pool_start_workers_locked(pool);
+        if (zr_vm_task_atomic_load(&pool->liveWorkers) == 0u) {
+            zr_vm_task_atomic_add(&pool->queuedCount, -1);
+            zr_vm_task_sync_mutex_unlock(&pool->mutex);
+            return ZR_FALSE;
+        }
+        zr_vm_task_sync_mutex_unlock(&pool->mutex);
+    }
+
+    zr_vm_task_steal_pool_inject_chain(pool, launch, launch);
+    zr_vm_task_steal_pool_wake_sleepers(pool);
+    return ZR_TRUE;
+}
+
+TZrUInt32 zr_vm_task_steal_pool_worker_count(const ZrVmTaskStealPool *pool) {
+    return pool != ZR_NULL ? pool->workerCount : 0u;
+}
+
+TZrUInt64 zr_vm_task_steal_pool_steal_count(ZrVmTaskStealPool *pool) {
+    return pool != ZR_NULL ? zr_vm_task_atomic_load(&pool->stealCount) : 0u;
+}
+
+void zr_vm_task_steal_pool_shutdown(ZrVmTaskStealPool *pool) {
+    if (pool == ZR_NULL) {
+        return;
+    }
+
+    // workers drain every submitted launch before they observe shuttingDown and exit.
+    zr_vm_task_sync_mutex_lock(&pool->mutex);
+    pool->shuttingDown = ZR_TRUE;
+    zr_vm_task_sync_condition_signal(&pool->workCondition);
+    while (pool->threadCount > 0u) {
+        zr_vm_task_sync_condition_wait(&pool->exitCondition, &pool->mutex, ZR_VM_TASK_STEAL_PARK_POLL_MS);
+    }
+    zr_vm_task_sync_mutex_unlock(&pool->mutex);
+
+    zr_vm_task_sync_condition_destroy(&pool->exitCondition);
+    zr_vm_task_sync_condition_destroy(&pool->workCondition);
+    zr_vm_task_sync_mutex_destroy(&pool->mutex);
+    free(pool->workers);
+    free(pool);
+}
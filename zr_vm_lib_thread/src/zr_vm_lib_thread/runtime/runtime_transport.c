@@ -451,39 +451,87 @@ TZrBool zr_vm_task_channel_construct(ZrLibCallContext *context, SZrTypeValue *re
     SZrObject *handle;
     ZrVmTaskChannelTransport *transport;
     SZrTypeValue transportValue;
+    TZrInt64 capacity = 0;
 
     if (context == ZR_NULL || result == ZR_NULL) {
         return ZR_FALSE;
     }
 
+    if (ZrLib_CallContext_ArgumentCount(context) > 0 && !zr_vm_task_read_strict_int(context, 0, &capacity)) {
+        return ZR_FALSE;
+    }
+    if (capacity < 0) {
+        return zr_vm_task_raise_runtime_error(context->state, "Channel capacity must not be negative");
+    }
+
     handle = zr_vm_task_resolve_construct_target(context);
     if (handle == ZR_NULL) {
         handle = zr_vm_task_new_typed_object(context->state, "Channel");
     }
-    transport = (ZrVmTaskChannelTransport *)malloc(sizeof(*transport));
+    transport = zr_vm_task_channel_transport_new((TZrUInt64)capacity);
     if (handle == ZR_NULL || transport == ZR_NULL) {
-        free(transport);
+        zr_vm_task_channel_transport_free(transport);
         return ZR_FALSE;
     }
 
-    memset(transport, 0, sizeof(*transport));
-    zr_vm_task_sync_mutex_init(&transport->mutex);
-    zr_vm_task_sync_condition_init(&transport->condition);
     transport->notifyRuntime = zr_vm_task_scheduler_get_runtime(context->state, zr_vm_task_main_scheduler(context->state));
     ZrLib_Value_SetNativePointer(context->state, &transportValue, transport);
     zr_vm_task_set_value_field(context->state, handle, kTaskChannelTransportField, &transportValue);
     return zr_vm_task_finish_object(context->state, result, handle);
 }
 
-TZrBool zr_vm_task_channel_send(ZrLibCallContext *context, SZrTypeValue *result) {
+static void zr_vm_task_channel_clear_values(ZrVmTaskTransportValue *values, TZrSize count) {
+    TZrSize index;
+
+    for (index = 0; index < count; index++) {
+        zr_vm_task_transport_clear(&values[index]);
+    }
+}
+
+/*
+ * Pushes encoded values in order. A full bounded ring first lets the main scheduler run queued
+ * tasks (the coroutine-style yield), then parks briefly on the transport until a receiver drains it.
+ * Unsent values are cleared before returning, so the caller never owns them afterwards.
+ */
+static TZrBool zr_vm_task_channel_send_values(SZrState *state,
+                                              ZrVmTaskChannelTransport *transport,
+                                              ZrVmTaskTransportValue *values,
+                                              TZrSize count,
+                                              TZrBool wait,
+                                              TZrSize *outSent) {
+    EZrVmTaskChannelStatus status = ZR_VM_TASK_CHANNEL_STATUS_OK;
+    TZrSize sent = 0;
+
+    while (sent < count) {
+        sent += zr_vm_task_channel_transport_send_many(transport, values + sent, count - sent, &status);
+        if (status == ZR_VM_TASK_CHANNEL_STATUS_OK) {
+            continue;
+        }
+        if (status != ZR_VM_TASK_CHANNEL_STATUS_FULL || !wait) {
+            break;
+        }
+        if (!zr_vm_task_scheduler_yield(state)) {
+            zr_vm_task_channel_transport_wait_not_full(transport, ZR_VM_TASK_CHANNEL_SEND_WAIT_MS);
+        }
+    }
+
+    zr_vm_task_channel_clear_values(values + sent, count - sent);
+    if (outSent != ZR_NULL) {
+        *outSent = sent;
+    }
+    if (status == ZR_VM_TASK_CHANNEL_STATUS_CLOSED) {
+        return zr_vm_task_raise_runtime_error(state, "Channel is closed");
+    }
+    return status != ZR_VM_TASK_CHANNEL_STATUS_OUT_OF_MEMORY;
+}
+
+static TZrBool zr_vm_task_channel_send_argument(ZrLibCallContext *context,
+                                                TZrBool wait,
+                                                TZrSize *outSent) {
     SZrObject *self;
     SZrTypeValue *value;
     ZrVmTaskChannelTransport *transport;
-    ZrVmTaskChannelMessage *message;
-
-    if (context == ZR_NULL || result == ZR_NULL) {
-        return ZR_FALSE;
-    }
+    ZrVmTaskTransportValue encoded;
 
     self = zr_vm_task_self_object(context);
     value = ZrLib_CallContext_Argument(context, 0);
@@ -495,48 +543,46 @@ TZrBool zr_vm_task_channel_send(ZrLibCallContext *context, SZrTypeValue *result)
         ZrLib_CallContext_RaiseArityError(context, 1, 1);
     }
 
-    message = (ZrVmTaskChannelMessage *)malloc(sizeof(*message));
-    if (message == ZR_NULL) {
+    if (!zr_vm_task_transport_encode_value(context->state,
+                                           value,
+                                           &encoded,
+                                           "Channel only transports Send values and thread transport handles")) {
         return ZR_FALSE;
     }
-	    memset(message, 0, sizeof(*message));
-	    if (!zr_vm_task_transport_encode_value(context->state,
-	                                           value,
-	                                           &message->value,
-	                                           "Channel only transports Send values and thread transport handles")) {
-	        free(message);
-	        return ZR_FALSE;
-	    }
 
-    zr_vm_task_sync_mutex_lock(&transport->mutex);
-    if (transport->closed) {
-        zr_vm_task_sync_mutex_unlock(&transport->mutex);
-        zr_vm_task_transport_clear(&message->value);
-        free(message);
-        return zr_vm_task_raise_runtime_error(context->state, "Channel is closed");
-    }
+    return zr_vm_task_channel_send_values(context->state, transport, &encoded, 1, wait, outSent);
+}
 
-    if (transport->tail != ZR_NULL) {
-        transport->tail->next = message;
-    } else {
-        transport->head = message;
+TZrBool zr_vm_task_channel_send(ZrLibCallContext *context, SZrTypeValue *result) {
+    if (context == ZR_NULL || result == ZR_NULL || !zr_vm_task_channel_send_argument(context, ZR_TRUE, ZR_NULL)) {
+        return ZR_FALSE;
     }
-    transport->tail = message;
-    transport->length++;
-    zr_vm_task_sync_condition_signal(&transport->condition);
-    zr_vm_task_sync_mutex_unlock(&transport->mutex);
-    zr_vm_task_scheduler_signal_runtime(transport->notifyRuntime);
 
     ZrLib_Value_SetNull(result);
     return ZR_TRUE;
 }
 
-TZrBool zr_vm_task_channel_recv(ZrLibCallContext *context, SZrTypeValue *result) {
+TZrBool zr_vm_task_channel_try_send(ZrLibCallContext *context, SZrTypeValue *result) {
+    TZrSize sent = 0;
+
+    if (context == ZR_NULL || result == ZR_NULL || !zr_vm_task_channel_send_argument(context, ZR_FALSE, &sent)) {
+        return ZR_FALSE;
+    }
+
+    ZrLib_Value_SetBool(context->state, result, sent == 1 ? ZR_TRUE : ZR_FALSE);
+    return ZR_TRUE;
+}
+
+TZrBool zr_vm_task_channel_send_many(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *self;
+    SZrObject *array;
     ZrVmTaskChannelTransport *transport;
-    ZrVmTaskChannelMessage *message;
+    ZrVmTaskTransportValue *values;
+    TZrSize count;
+    TZrSize index;
+    TZrSize sent = 0;
 
-    if (context == ZR_NULL || result == ZR_NULL) {
+    if (context == ZR_NULL || result == ZR_NULL || !ZrLib_CallContext_ReadArray(context, 0, &array)) {
         return ZR_FALSE;
     }
 
@@ -546,32 +592,113 @@ TZrBool zr_vm_task_channel_recv(ZrLibCallContext *context, SZrTypeValue *result)
         return ZR_FALSE;
     }
 
-    zr_vm_task_sync_mutex_lock(&transport->mutex);
-    message = transport->head;
-    if (message != ZR_NULL) {
-        transport->head = message->next;
-        if (transport->head == ZR_NULL) {
-            transport->tail = ZR_NULL;
-        }
-        if (transport->length > 0) {
-            transport->length--;
+    count = ZrLib_Array_Length(array);
+    if (count == 0) {
+        ZrLib_Value_SetInt(context->state, result, 0);
+        return ZR_TRUE;
+    }
+
+    values = (ZrVmTaskTransportValue *)malloc(count * sizeof(*values));
+    if (values == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // encode the whole batch up front so a rejected element leaves the channel untouched.
+    for (index = 0; index < count; index++) {
+        if (!zr_vm_task_transport_encode_value(context->state, ZrLib_Array_Get(context->state, array, index),
+                                               &values[index], ZR_NULL)) {
+            zr_vm_task_channel_clear_values(values, index);
+            free(values);
+            return zr_vm_task_raise_runtime_error(context->state,
+                                                  "Channel only transports Send values and thread transport handles");
         }
     }
-    zr_vm_task_sync_mutex_unlock(&transport->mutex);
 
-    if (message == ZR_NULL) {
+    if (!zr_vm_task_channel_send_values(context->state, transport, values, count, ZR_TRUE, &sent)) {
+        free(values);
+        return ZR_FALSE;
+    }
+
+    free(values);
+    ZrLib_Value_SetInt(context->state, result, (TZrInt64)sent);
+    return ZR_TRUE;
+}
+
+TZrBool zr_vm_task_channel_recv(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self;
+    ZrVmTaskChannelTransport *transport;
+    ZrVmTaskTransportValue value;
+    TZrBool decoded;
+
+    if (context == ZR_NULL || result == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    self = zr_vm_task_self_object(context);
+    transport = zr_vm_task_channel_get_transport_internal(context->state, self);
+    if (self == ZR_NULL || transport == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    if (zr_vm_task_channel_transport_recv_many(transport, &value, 1) == 0) {
         ZrLib_Value_SetNull(result);
         return ZR_TRUE;
     }
 
-    if (!zr_vm_task_transport_decode_value(context->state, &message->value, result)) {
-        zr_vm_task_transport_clear(&message->value);
-        free(message);
+    decoded = zr_vm_task_transport_decode_value(context->state, &value, result);
+    zr_vm_task_transport_clear(&value);
+    return decoded;
+}
+
+TZrBool zr_vm_task_channel_recv_many(ZrLibCallContext *context, SZrTypeValue *result) {
+    SZrObject *self;
+    SZrObject *array;
+    ZrVmTaskChannelTransport *transport;
+    ZrVmTaskTransportValue *values;
+    SZrTypeValue decodedValue;
+    TZrInt64 maxCount = 0;
+    TZrUInt64 limit;
+    TZrSize count;
+    TZrSize index;
+
+    if (context == ZR_NULL || result == ZR_NULL || !zr_vm_task_read_strict_int(context, 0, &maxCount)) {
         return ZR_FALSE;
     }
+    if (maxCount <= 0) {
+        return zr_vm_task_raise_runtime_error(context->state, "Channel.recvMany requires a positive maxCount");
+    }
 
-    zr_vm_task_transport_clear(&message->value);
-    free(message);
+    self = zr_vm_task_self_object(context);
+    transport = zr_vm_task_channel_get_transport_internal(context->state, self);
+    array = ZrLib_Array_New(context->state);
+    if (self == ZR_NULL || transport == ZR_NULL || array == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // a batch never exceeds what is queued right now, which also bounds the scratch buffer.
+    limit = transport->capacity > 0 ? transport->capacity : zr_vm_task_channel_transport_length(transport);
+    if ((TZrUInt64)maxCount < limit) {
+        limit = (TZrUInt64)maxCount;
+    }
+
+    count = 0;
+    values = limit > 0 ? (ZrVmTaskTransportValue *)malloc((TZrSize)limit * sizeof(*values)) : ZR_NULL;
+    if (values != ZR_NULL) {
+        count = zr_vm_task_channel_transport_recv_many(transport, values, (TZrSize)limit);
+    }
+
+    for (index = 0; index < count; index++) {
+        if (!zr_vm_task_transport_decode_value(context->state, &values[index], &decodedValue) ||
+            !ZrLib_Array_PushValue(context->state, array, &decodedValue)) {
+            zr_vm_task_channel_clear_values(values, count);
+            free(values);
+            return ZR_FALSE;
+        }
+    }
+
+    zr_vm_task_channel_clear_values(values, count);
+    free(values);
+    ZrLib_Value_SetObject(context->state, result, array, ZR_VALUE_TYPE_ARRAY);
     return ZR_TRUE;
 }
 
@@ -587,19 +714,13 @@ TZrBool zr_vm_task_channel_close(ZrLibCallContext *context, SZrTypeValue *result
         return ZR_FALSE;
     }
 
-    zr_vm_task_sync_mutex_lock(&transport->mutex);
-    transport->closed = ZR_TRUE;
-    zr_vm_task_sync_condition_signal(&transport->condition);
-    zr_vm_task_sync_mutex_unlock(&transport->mutex);
-    zr_vm_task_scheduler_signal_runtime(transport->notifyRuntime);
-
+    zr_vm_task_channel_transport_close(transport);
     ZrLib_Value_SetNull(result);
     return ZR_TRUE;
 }
 
 TZrBool zr_vm_task_channel_is_closed(ZrLibCallContext *context, SZrTypeValue *result) {
     ZrVmTaskChannelTransport *transport;
-    TZrBool closed;
 
     if (context == ZR_NULL || result == ZR_NULL) {
         return ZR_FALSE;
@@ -610,16 +731,12 @@ TZrBool zr_vm_task_channel_is_closed(ZrLibCallContext *context, SZrTypeValue *re
         return ZR_FALSE;
     }
 
-    zr_vm_task_sync_mutex_lock(&transport->mutex);
-    closed = transport->closed;
-    zr_vm_task_sync_mutex_unlock(&transport->mutex);
-    ZrLib_Value_SetBool(context->state, result, closed);
+    ZrLib_Value_SetBool(context->state, result, zr_vm_task_channel_transport_is_closed(transport));
     return ZR_TRUE;
 }
 
 TZrBool zr_vm_task_channel_length(ZrLibCallContext *context, SZrTypeValue *result) {
     ZrVmTaskChannelTransport *transport;
-    TZrUInt64 length;
 
     if (context == ZR_NULL || result == ZR_NULL) {
         return ZR_FALSE;
@@ -630,9 +747,22 @@ TZrBool zr_vm_task_channel_length(ZrLibCallContext *context, SZrTypeValue *resul
         return ZR_FALSE;
     }
 
-    zr_vm_task_sync_mutex_lock(&transport->mutex);
-    length = transport->length;
-    zr_vm_task_sync_mutex_unlock(&transport->mutex);
-    ZrLib_Value_SetInt(context->state, result, (TZrInt64)length);
+    ZrLib_Value_SetInt(context->state, result, (TZrInt64)zr_vm_task_channel_transport_length(transport));
+    return ZR_TRUE;
+}
+
+TZrBool zr_vm_task_channel_capacity(ZrLibCallContext *context, SZrTypeValue *result) {
+    ZrVmTaskChannelTransport *transport;
+
+    if (context == ZR_NULL || result == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    transport = zr_vm_task_channel_get_transport_internal(context->state, zr_vm_task_self_object(context));
+    if (transport == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    ZrLib_Value_SetInt(context->state, result, (TZrInt64)transport->capacity);
     return ZR_TRUE;
 }
@@ -0,0 +1,226 @@
+//
+// Persistent zr.thread worker pool: a FIFO of worker launches served by long-lived threads that keep
+// a warm isolate between jobs.
+//
+
+#include "runtime/runtime_internal.h"
+
+#if defined(ZR_PLATFORM_WIN)
+#include <process.h>
+#endif
+
+#if defined(_MSC_VER)
+#define ZR_VM_TASK_WORKER_THREAD_LOCAL __declspec(thread)
+#else
+#define ZR_VM_TASK_WORKER_THREAD_LOCAL _Thread_local
+#endif
+
+// idle workers with no timeout still wake up periodically so a reconfigure or shutdown is observed.
+#define ZR_VM_TASK_WORKER_POOL_IDLE_POLL_MS 60000u
+
+typedef struct ZrVmTaskWorkerPool {
+    ZrVmTaskMutex mutex;
+    ZrVmTaskCondition jobCondition;
+    ZrVmTaskCondition exitCondition;
+    ZrVmTaskWorkerLaunch *head;
+    ZrVmTaskWorkerLaunch *tail;
+    TZrUInt32 queuedCount;
+    TZrUInt32 workerCount;
+    TZrUInt32 idleTimeoutMs;
+    // workers still accepting jobs; a retiring worker leaves this count under the mutex before it unlocks
+    TZrUInt32 liveWorkers;
+    // threads that have not finished exiting (their isolate may still be releasing); shutdown waits on this
+    TZrUInt32 threadCount;
+    TZrUInt32 idleWorkers;
+    TZrBool shuttingDown;
+} ZrVmTaskWorkerPool;
+
+static ZrVmTaskWorkerPool g_worker_pool;
+static ZR_VM_TASK_WORKER_THREAD_LOCAL TZrBool g_worker_pool_on_worker_thread = ZR_FALSE;
+
+static void zr_vm_task_worker_pool_init_once(void) {
+    memset(&g_worker_pool, 0, sizeof(g_worker_pool));
+    zr_vm_task_sync_mutex_init(&g_worker_pool.mutex);
+    zr_vm_task_sync_condition_init(&g_worker_pool.jobCondition);
+    zr_vm_task_sync_condition_init(&g_worker_pool.exitCondition);
+    g_worker_pool.workerCount = ZR_VM_THREAD_WORKER_POOL_DEFAULT_SIZE;
+    g_worker_pool.idleTimeoutMs = ZR_VM_THREAD_WORKER_POOL_DEFAULT_IDLE_TIMEOUT_MS;
+}
+
+#if defined(ZR_PLATFORM_WIN)
+static INIT_ONCE g_worker_pool_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK zr_vm_task_worker_pool_init_once_callback(PINIT_ONCE once, PVOID parameter, PVOID *context) {
+    ZR_UNUSED_PARAMETER(once);
+    ZR_UNUSED_PARAMETER(parameter);
+    ZR_UNUSED_PARAMETER(context);
+    zr_vm_task_worker_pool_init_once();
+    return TRUE;
+}
+
+static void zr_vm_task_worker_pool_ensure_init(void) {
+    InitOnceExecuteOnce(&g_worker_pool_once, zr_vm_task_worker_pool_init_once_callback, ZR_NULL, ZR_NULL);
+}
+#else
+static pthread_once_t g_worker_pool_once = PTHREAD_ONCE_INIT;
+
+static void zr_vm_task_worker_pool_ensure_init(void) {
+    pthread_once(&g_worker_pool_once, zr_vm_task_worker_pool_init_once);
+}
+#endif
+
+static ZrVmTaskWorkerLaunch *zr_vm_task_worker_pool_pop_locked(void) {
+    ZrVmTaskWorkerLaunch *launch = g_worker_pool.head;
+
+    if (launch == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    g_worker_pool.head = launch->next;
+    if (g_worker_pool.head == ZR_NULL) {
+        g_worker_pool.tail = ZR_NULL;
+    }
+    g_worker_pool.queuedCount--;
+    launch->next = ZR_NULL;
+    return launch;
+}
+
+static void zr_vm_task_worker_pool_run(void) {
+    ZrVmTaskWorkerIsolate isolate;
+
+    memset(&isolate, 0, sizeof(isolate));
+    g_worker_pool_on_worker_thread = ZR_TRUE;
+
+    zr_vm_task_sync_mutex_lock(&g_worker_pool.mutex);
+    for (;;) {
+        ZrVmTaskWorkerLaunch *launch = zr_vm_task_worker_pool_pop_locked();
+
+        if (launch == ZR_NULL) {
+            TZrUInt32 idleTimeoutMs = g_worker_pool.idleTimeoutMs;
+            TZrBool signalled;
+
+            // surplus workers (after a shrink or a nested-spawn overflow) retire as soon as they go idle.
+            if (g_worker_pool.shuttingDown || g_worker_pool.liveWorkers > g_worker_pool.workerCount) {
+                g_worker_pool.liveWorkers--;
+                break;
+            }
+
+            g_worker_pool.idleWorkers++;
+            signalled = zr_vm_task_sync_condition_wait(&g_worker_pool.jobCondition,
+                                                       &g_worker_pool.mutex,
+                                                       idleTimeoutMs != 0 ? idleTimeoutMs
+                                                                          : ZR_VM_TASK_WORKER_POOL_IDLE_POLL_MS);
+            g_worker_pool.idleWorkers--;
+            if (!signalled && idleTimeoutMs != 0 && g_worker_pool.head == ZR_NULL) {
+                // leave the live count while still holding the mutex, so a submit that follows spawns a fresh worker
+                g_worker_pool.liveWorkers--;
+                break;
+            }
+            continue;
+        }
+
+        zr_vm_task_sync_mutex_unlock(&g_worker_pool.mutex);
+        zr_vm_task_worker_run_launch(&isolate, launch);
+        zr_vm_task_worker_launch_free(launch);
+        zr_vm_task_sync_mutex_lock(&g_worker_pool.mutex);
+    }
+    zr_vm_task_sync_mutex_unlock(&g_worker_pool.mutex);
+
+    zr_vm_task_worker_isolate_release(&isolate);
+
+    zr_vm_task_sync_mutex_lock(&g_worker_pool.mutex);
+    g_worker_pool.threadCount--;
+    zr_vm_task_sync_condition_signal(&g_worker_pool.exitCondition);
+    zr_vm_task_sync_mutex_unlock(&g_worker_pool.mutex);
+}
+
+#if defined(ZR_PLATFORM_WIN)
+static unsigned __stdcall zr_vm_task_worker_pool_entry(void *argument) {
+    ZR_UNUSED_PARAMETER(argument);
+    zr_vm_task_worker_pool_run();
+    return 0;
+}
+#else
+static void *zr_vm_task_worker_pool_entry(void *argument) {
+    ZR_UNUSED_PARAMETER(argument);
+    zr_vm_task_worker_pool_run();
+    return ZR_NULL;
+}
+#endif
+
+static TZrBool zr_vm_task_worker_pool_start_thread(void) {
+#if defined(ZR_PLATFORM_WIN)
+    uintptr_t threadHandle = _beginthreadex(ZR_NULL, 0, zr_vm_task_worker_pool_entry, ZR_NULL, 0, ZR_NULL);
+    if (threadHandle == 0) {
+        return ZR_FALSE;
+    }
+    CloseHandle((HANDLE)threadHandle);
+    return ZR_TRUE;
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, ZR_NULL, zr_vm_task_worker_pool_entry, ZR_NULL) != 0) {
+        return ZR_FALSE;
+    }
+    pthread_detach(thread);
+    return ZR_TRUE;
+#endif
+}
+
+TZrBool zr_vm_task_worker_pool_submit(ZrVmTaskWorkerLaunch *launch) {
+    if (launch == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    zr_vm_task_worker_pool_ensure_init();
+    zr_vm_task_sync_mutex_lock(&g_worker_pool.mutex);
+
+    /*
+     * A job submitted from inside a pool worker may be awaited by that worker, so it is allowed to
+     * grow the pool past its configured size instead of queueing behind a fully blocked pool.
+     */
+    if (g_worker_pool.queuedCount + 1u > g_worker_pool.idleWorkers &&
+        (g_worker_pool.liveWorkers < g_worker_pool.workerCount || g_worker_pool_on_worker_thread)) {
+        if (zr_vm_task_worker_pool_start_thread()) {
+            g_worker_pool.liveWorkers++;
+            g_worker_pool.threadCount++;
+        } else if (g_worker_pool.liveWorkers == 0) {
+            zr_vm_task_sync_mutex_unlock(&g_worker_pool.mutex);
+            return ZR_FALSE;
+        }
+    }
+
+    launch->next = ZR_NULL;
+    if (g_worker_pool.tail != ZR_NULL) {
+        g_worker_pool.tail->next = launch;
+    } else {
+        g_worker_pool.head = launch;
+    }
+    g_worker_pool.tail = launch;
+    g_worker_pool.queuedCount++;
+    zr_vm_task_sync_condition_signal(&g_worker_pool.jobCondition);
+    zr_vm_task_sync_mutex_unlock(&g_worker_pool.mutex);
+    return ZR_TRUE;
+}
+
+void ZrVmThread_WorkerPool_Configure(TZrUInt32 workerCount, TZrUInt32 idleTimeoutMs) {
+    zr_vm_task_worker_pool_ensure_init();
+    zr_vm_task_sync_mutex_lock(&g_worker_pool.mutex);
+    g_worker_pool.workerCount = workerCount > 0 ? workerCount : 1u;
+    g_worker_pool.idleTimeoutMs = idleTimeoutMs;
+    zr_vm_task_sync_condition_signal(&g_worker_pool.jobCondition);
+    zr_vm_task_sync_mutex_unlock(&g_worker_pool.mutex);
+}
+
+void ZrVmThread_WorkerPool_Shutdown(void) {
+    zr_vm_task_worker_pool_ensure_init();
+    zr_vm_task_sync_mutex_lock(&g_worker_pool.mutex);
+    g_worker_pool.shuttingDown = ZR_TRUE;
+    zr_vm_task_sync_condition_signal(&g_worker_pool.jobCondition);
+    while (g_worker_pool.threadCount > 0) {
+        zr_vm_task_sync_condition_wait(&g_worker_pool.exitCondition,
+                                       &g_worker_pool.mutex,
+                                       ZR_VM_TASK_WORKER_POOL_IDLE_POLL_MS);
+    }
+    g_worker_pool.shuttingDown = ZR_FALSE;
+    zr_vm_task_sync_mutex_unlock(&g_worker_pool.mutex);
+}
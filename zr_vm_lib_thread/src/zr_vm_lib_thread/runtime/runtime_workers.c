@@ -1,19 +1,14 @@
 #include "runtime/runtime_internal.h"
 
-#if defined(ZR_PLATFORM_WIN)
-#include <process.h>
-#else
-#include <unistd.h>
-#endif
-
 #include "zr_vm_core/closure.h"
 #include "zr_vm_core/conversion.h"
 #include "zr_vm_core/exception.h"
+#include "zr_vm_core/gc.h"
 #include "zr_vm_core/io.h"
+#include "zr_vm_core/module.h"
 #include "zr_vm_core/object.h"
 #include "zr_vm_core/task_runtime.h"
 #include "zr_vm_core/string.h"
-#include "zr_vm_library/file.h"
 #include "zr_vm_library/native_registry.h"
 #include "zr_vm_library/project.h"
 #include "zr_vm_parser/compiler.h"
@@ -23,24 +18,6 @@
 static const TZrChar *kTaskPendingWorkersField = "__zr_task_pending_workers";
 static const TZrChar *kTaskWorkerIsolateIdField = "__zr_task_worker_isolate_id";
 
-typedef struct ZrVmTaskWorkerLaunch {
-    TZrChar *binaryPath;
-    TZrChar *projectFile;
-    TZrChar *projectDirectory;
-    TZrChar *projectSource;
-    TZrChar *projectBinary;
-    TZrChar *projectEntry;
-    TZrUInt32 captureCount;
-    ZrVmTaskTransportValue *captures;
-    ZrVmTaskSchedulerRuntime *ownerRuntime;
-    SZrObject *ownerHandle;
-    FZrAllocator allocator;
-    TZrPtr userAllocationArguments;
-    TZrUInt64 workerIsolateId;
-    TZrBool supportMultithread;
-    TZrBool autoCoroutine;
-} ZrVmTaskWorkerLaunch;
-
 typedef struct ZrVmTaskWorkerExecuteRequest {
     const SZrTypeValue *callable;
     SZrTypeValue result;
@@ -65,7 +42,49 @@ static TZrChar *zr_vm_task_worker_strdup(const TZrChar *text) {
     return copy;
 }
 
-static void zr_vm_task_worker_launch_free(ZrVmTaskWorkerLaunch *launch) {
+static ZrVmTaskCallableBlob *zr_vm_task_callable_blob_new(SZrState *state, SZrFunction *function) {
+    ZrVmTaskCallableBlob *blob = (ZrVmTaskCallableBlob *)malloc(sizeof(*blob));
+
+    if (blob == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    memset(blob, 0, sizeof(*blob));
+    if (!ZrParser_Writer_WriteBinaryBuffer(state, function, &blob->bytes, &blob->length)) {
+        free(blob);
+        return ZR_NULL;
+    }
+
+    blob->refCount = 1;
+    return blob;
+}
+
+/*
+ * A blob only ever moves between threads together with its launch through the pool queue, so the
+ * plain counter is published by the pool mutex and needs no atomics.
+ */
+static ZrVmTaskCallableBlob *zr_vm_task_callable_blob_retain(ZrVmTaskCallableBlob *blob) {
+    if (blob != ZR_NULL) {
+        blob->refCount++;
+    }
+    return blob;
+}
+
+static void zr_vm_task_callable_blob_release(ZrVmTaskCallableBlob *blob) {
+    if (blob == ZR_NULL || --blob->refCount > 0) {
+        return;
+    }
+
+    ZrParser_Writer_FreeBinaryBuffer(blob->bytes);
+    free(blob);
+}
+
+static TZrBool zr_vm_task_callable_blob_equals(const ZrVmTaskCallableBlob *lhs, const ZrVmTaskCallableBlob *rhs) {
+    return lhs != ZR_NULL && rhs != ZR_NULL && lhs->length == rhs->length &&
+           (lhs == rhs || memcmp(lhs->bytes, rhs->bytes, lhs->length) == 0);
+}
+
+void zr_vm_task_worker_launch_free(ZrVmTaskWorkerLaunch *launch) {
     TZrUInt32 captureIndex;
 
     if (launch == ZR_NULL) {
@@ -79,7 +98,8 @@ static void zr_vm_task_worker_launch_free(ZrVmTaskWorkerLaunch *launch) {
         free(launch->captures);
     }
 
-    free(launch->binaryPath);
+    zr_vm_task_callable_blob_release(launch->callable);
+    ZrCore_Module_ReleaseStartupImage(launch->startupImage);
     free(launch->projectFile);
     free(launch->projectDirectory);
     free(launch->projectSource);
@@ -123,38 +143,6 @@ static SZrLibrary_Project *zr_vm_task_worker_clone_project(SZrState *state, cons
     return project;
 }
 
-static TZrBool zr_vm_task_worker_make_temp_path(TZrChar *buffer, TZrSize bufferSize) {
-    if (buffer == ZR_NULL || bufferSize == 0) {
-        return ZR_FALSE;
-    }
-
-#if defined(ZR_PLATFORM_WIN)
-    {
-        char tempDirectory[MAX_PATH];
-        UINT result = GetTempPathA((DWORD)sizeof(tempDirectory), tempDirectory);
-        if (result == 0 || result >= sizeof(tempDirectory)) {
-            return ZR_FALSE;
-        }
-        if (GetTempFileNameA(tempDirectory, "zrt", 0, buffer) == 0) {
-            return ZR_FALSE;
-        }
-    }
-#else
-    {
-        const char *pattern = "/tmp/zr_task_worker_XXXXXX";
-        int fd;
-        snprintf(buffer, bufferSize, "%s", pattern);
-        fd = mkstemp(buffer);
-        if (fd < 0) {
-            return ZR_FALSE;
-        }
-        close(fd);
-    }
-#endif
-
-    return ZR_TRUE;
-}
-
 static TZrBool zr_vm_task_worker_append_pending_handle(SZrState *state, SZrObject *scheduler, SZrObject *handle) {
     SZrObject *pendingArray;
     SZrTypeValue pendingValue;
@@ -181,33 +169,87 @@ static TZrBool zr_vm_task_worker_append_pending_handle(SZrState *state, SZrObjec
 	    return ZR_TRUE;
 	}
 
-static TZrBool zr_vm_task_worker_load_function(SZrState *state, const TZrChar *path, SZrFunction **outFunction) {
-    SZrLibrary_File_Reader *reader;
+typedef struct ZrVmTaskCallableBlobReader {
+    const ZrVmTaskCallableBlob *blob;
+    TZrBool consumed;
+} ZrVmTaskCallableBlobReader;
+
+static TZrBytePtr zr_vm_task_callable_blob_reader_read(struct SZrState *state, TZrPtr customData, ZR_OUT TZrSize *size) {
+    ZrVmTaskCallableBlobReader *reader = (ZrVmTaskCallableBlobReader *)customData;
+
+    ZR_UNUSED_PARAMETER(state);
+
+    if (reader == ZR_NULL || size == ZR_NULL || reader->consumed || reader->blob->length == 0) {
+        return ZR_NULL;
+    }
+
+    reader->consumed = ZR_TRUE;
+    *size = reader->blob->length;
+    return (TZrBytePtr)reader->blob->bytes;
+}
+
+static void zr_vm_task_callable_blob_reader_close(struct SZrState *state, TZrPtr customData) {
+    ZR_UNUSED_PARAMETER(state);
+    ZR_UNUSED_PARAMETER(customData);
+}
+
+static void zr_vm_task_worker_isolate_drop_cached_callable(ZrVmTaskWorkerIsolate *isolate) {
+    if (isolate->cachedFunction != ZR_NULL && isolate->global != ZR_NULL) {
+        ZrCore_GarbageCollector_UnignoreObject(isolate->global, ZR_CAST_RAW_OBJECT_AS_SUPER(isolate->cachedFunction));
+    }
+    zr_vm_task_callable_blob_release(isolate->cachedCallable);
+    isolate->cachedCallable = ZR_NULL;
+    isolate->cachedFunction = ZR_NULL;
+}
+
+/*
+ * Deserializes the launch's callable straight from its in-memory blob. The warm isolate keeps the last
+ * loaded prototype pinned, so respawning the same callable skips deserialization entirely.
+ */
+static TZrBool zr_vm_task_worker_load_function(ZrVmTaskWorkerIsolate *isolate,
+                                               const ZrVmTaskWorkerLaunch *launch,
+                                               SZrFunction **outFunction) {
+    SZrState *state;
+    ZrVmTaskCallableBlobReader reader;
     SZrIo io;
     SZrIoSource *source;
+    SZrFunction *function;
 
-    if (state == ZR_NULL || path == ZR_NULL || outFunction == ZR_NULL) {
+    if (isolate == ZR_NULL || isolate->global == ZR_NULL || launch == ZR_NULL || launch->callable == ZR_NULL ||
+        outFunction == ZR_NULL) {
         return ZR_FALSE;
     }
 
     *outFunction = ZR_NULL;
-    reader = ZrLibrary_File_OpenRead(state->global, (TZrNativeString)path, ZR_TRUE);
-    if (reader == ZR_NULL) {
-        return ZR_FALSE;
+    if (zr_vm_task_callable_blob_equals(isolate->cachedCallable, launch->callable)) {
+        *outFunction = isolate->cachedFunction;
+        return ZR_TRUE;
     }
 
-    ZrCore_Io_Init(state, &io, ZrLibrary_File_SourceReadImplementation, ZrLibrary_File_SourceCloseImplementation, reader);
+    state = isolate->global->mainThreadState;
+    memset(&reader, 0, sizeof(reader));
+    reader.blob = launch->callable;
+    ZrCore_Io_Init(state, &io, zr_vm_task_callable_blob_reader_read, zr_vm_task_callable_blob_reader_close, &reader);
     io.isBinary = ZR_TRUE;
     source = ZrCore_Io_ReadSourceNew(&io);
     if (source == ZR_NULL) {
-        ZrLibrary_File_CloseRead(state->global, reader);
         return ZR_FALSE;
     }
 
-    *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, source);
+    function = ZrCore_Io_LoadEntryFunctionToRuntime(state, source);
     ZrCore_Io_ReadSourceFree(state->global, source);
-    ZrLibrary_File_CloseRead(state->global, reader);
-    return *outFunction != ZR_NULL;
+    if (function == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    zr_vm_task_worker_isolate_drop_cached_callable(isolate);
+    if (ZrCore_GarbageCollector_IgnoreObject(state, ZR_CAST_RAW_OBJECT_AS_SUPER(function))) {
+        isolate->cachedCallable = zr_vm_task_callable_blob_retain(launch->callable);
+        isolate->cachedFunction = function;
+    }
+
+    *outFunction = function;
+    return ZR_TRUE;
 }
 
 static TZrBool zr_vm_task_worker_build_callable(SZrState *state,
@@ -307,6 +349,7 @@ static void zr_vm_task_worker_enqueue_message(ZrVmTaskSchedulerRuntime *runtime,
                                               SZrObject *handle,
                                               ZrVmTaskTransportValue *payload) {
     ZrVmTaskSchedulerMessage *message;
+    TZrPtr top;
 
     if (runtime == ZR_NULL || handle == ZR_NULL || payload == ZR_NULL) {
         zr_vm_task_transport_clear(payload);
@@ -325,15 +368,11 @@ static void zr_vm_task_worker_enqueue_message(ZrVmTaskSchedulerRuntime *runtime,
     message->payload = *payload;
     memset(payload, 0, sizeof(*payload));
 
-    zr_vm_task_sync_mutex_lock(&runtime->mutex);
-    if (runtime->tail != ZR_NULL) {
-        runtime->tail->next = message;
-    } else {
-        runtime->head = message;
-    }
-    runtime->tail = message;
-    zr_vm_task_sync_condition_signal(&runtime->condition);
-    zr_vm_task_sync_mutex_unlock(&runtime->mutex);
+    // the owner polls the completion stack, so a worker publishes without taking any lock.
+    do {
+        top = zr_vm_task_atomic_load_pointer(&runtime->completionStack);
+        message->next = (ZrVmTaskSchedulerMessage *)top;
+    } while (!zr_vm_task_atomic_compare_exchange_pointer(&runtime->completionStack, top, message));
 }
 
 static void zr_vm_task_worker_queue_error_message(ZrVmTaskSchedulerRuntime *runtime,
@@ -347,50 +386,123 @@ static void zr_vm_task_worker_queue_error_message(ZrVmTaskSchedulerRuntime *runt
     zr_vm_task_worker_enqueue_message(runtime, ZR_VM_TASK_SCHEDULER_MESSAGE_FAULT, handle, &payload);
 }
 
-static void zr_vm_task_worker_run_launch(ZrVmTaskWorkerLaunch *launch) {
+static TZrBool zr_vm_task_worker_text_equals(const TZrChar *lhs, const TZrChar *rhs) {
+    if (lhs == ZR_NULL || rhs == ZR_NULL) {
+        return lhs == rhs;
+    }
+
+    return strcmp(lhs, rhs) == 0;
+}
+
+static TZrBool zr_vm_task_worker_isolate_matches(const ZrVmTaskWorkerIsolate *isolate,
+                                                 const ZrVmTaskWorkerLaunch *launch) {
+    return isolate->global != ZR_NULL && isolate->allocator == launch->allocator &&
+           isolate->userAllocationArguments == launch->userAllocationArguments &&
+           isolate->supportMultithread == launch->supportMultithread &&
+           isolate->autoCoroutine == launch->autoCoroutine &&
+           zr_vm_task_worker_text_equals(isolate->projectFile, launch->projectFile) &&
+           zr_vm_task_worker_text_equals(isolate->projectDirectory, launch->projectDirectory) &&
+           zr_vm_task_worker_text_equals(isolate->projectSource, launch->projectSource) &&
+           zr_vm_task_worker_text_equals(isolate->projectBinary, launch->projectBinary) &&
+           zr_vm_task_worker_text_equals(isolate->projectEntry, launch->projectEntry);
+}
+
+void zr_vm_task_worker_isolate_release(ZrVmTaskWorkerIsolate *isolate) {
+    if (isolate == ZR_NULL) {
+        return;
+    }
+
+    zr_vm_task_worker_isolate_drop_cached_callable(isolate);
+    if (isolate->global != ZR_NULL) {
+        if (isolate->project != ZR_NULL) {
+            ZrLibrary_Project_Free(isolate->global->mainThreadState, isolate->project);
+            isolate->global->userData = ZR_NULL;
+        }
+        ZrLibrary_NativeRegistry_Free(isolate->global);
+        ZrCore_GlobalState_Free(isolate->global);
+    }
+
+    free(isolate->projectFile);
+    free(isolate->projectDirectory);
+    free(isolate->projectSource);
+    free(isolate->projectBinary);
+    free(isolate->projectEntry);
+    memset(isolate, 0, sizeof(*isolate));
+}
+
+/*
+ * Returns ZR_NULL once `isolate` holds a global state that can run `launch`. A warm isolate keeps its
+ * registered builtins and loaded module cache, so only a key mismatch pays for a fresh global state.
+ */
+static const TZrChar *zr_vm_task_worker_isolate_prepare(ZrVmTaskWorkerIsolate *isolate,
+                                                        const ZrVmTaskWorkerLaunch *launch) {
     SZrCallbackGlobal callbacks = {0};
     SZrGlobalState *workerGlobal;
     SZrState *workerState;
-    SZrLibrary_Project *project = ZR_NULL;
-    SZrFunction *function = ZR_NULL;
-    SZrTypeValue callableValue;
-    SZrTypeValue resultValue;
-    TZrBool completed = ZR_FALSE;
 
-    if (launch == ZR_NULL) {
-        return;
+    if (zr_vm_task_worker_isolate_matches(isolate, launch)) {
+        return ZR_NULL;
     }
 
+    zr_vm_task_worker_isolate_release(isolate);
     workerGlobal =
             ZrCore_GlobalState_New(launch->allocator, launch->userAllocationArguments, launch->workerIsolateId, &callbacks);
     if (workerGlobal == ZR_NULL) {
-        zr_vm_task_worker_queue_error_message(launch->ownerRuntime, launch->ownerHandle, "Failed to create worker isolate");
-        return;
+        return "Failed to create worker isolate";
     }
 
+    isolate->global = workerGlobal;
     workerState = workerGlobal->mainThreadState;
     if (workerState == ZR_NULL) {
-        zr_vm_task_worker_queue_error_message(launch->ownerRuntime, launch->ownerHandle, "Worker isolate has no main state");
-        ZrCore_GlobalState_Free(workerGlobal);
-        return;
+        zr_vm_task_worker_isolate_release(isolate);
+        return "Worker isolate has no main state";
     }
 
     ZrParser_ToGlobalState_Register(workerState);
     if (!ZrCore_TaskRuntime_RegisterBuiltins(workerGlobal) || !ZrVmThread_Register(workerGlobal)) {
-        zr_vm_task_worker_queue_error_message(launch->ownerRuntime,
-                                              launch->ownerHandle,
-                                              "Failed to register task/thread runtimes in worker isolate");
-        ZrCore_GlobalState_Free(workerGlobal);
-        return;
+        zr_vm_task_worker_isolate_release(isolate);
+        return "Failed to register task/thread runtimes in worker isolate";
     }
 
-    project = zr_vm_task_worker_clone_project(workerState, launch);
-    if (project != ZR_NULL) {
-        workerGlobal->userData = project;
+    isolate->project = zr_vm_task_worker_clone_project(workerState, launch);
+    if (isolate->project != ZR_NULL) {
+        workerGlobal->userData = isolate->project;
         workerGlobal->sourceLoader = ZrLibrary_Project_SourceLoadImplementation;
     }
 
-    if (!zr_vm_task_worker_load_function(workerState, launch->binaryPath, &function)) {
+    isolate->allocator = launch->allocator;
+    isolate->userAllocationArguments = launch->userAllocationArguments;
+    isolate->projectFile = zr_vm_task_worker_strdup(launch->projectFile);
+    isolate->projectDirectory = zr_vm_task_worker_strdup(launch->projectDirectory);
+    isolate->projectSource = zr_vm_task_worker_strdup(launch->projectSource);
+    isolate->projectBinary = zr_vm_task_worker_strdup(launch->projectBinary);
+    isolate->projectEntry = zr_vm_task_worker_strdup(launch->projectEntry);
+    isolate->supportMultithread = launch->supportMultithread;
+    isolate->autoCoroutine = launch->autoCoroutine;
+    return ZR_NULL;
+}
+
+TZrBool zr_vm_task_worker_run_launch(ZrVmTaskWorkerIsolate *isolate, ZrVmTaskWorkerLaunch *launch) {
+    SZrState *workerState;
+    SZrFunction *function = ZR_NULL;
+    SZrTypeValue callableValue;
+    SZrTypeValue resultValue;
+    const TZrChar *prepareError;
+    TZrBool reusable = ZR_FALSE;
+
+    if (isolate == ZR_NULL || launch == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    prepareError = zr_vm_task_worker_isolate_prepare(isolate, launch);
+    if (prepareError != ZR_NULL) {
+        zr_vm_task_worker_queue_error_message(launch->ownerRuntime, launch->ownerHandle, prepareError);
+        goto cleanup;
+    }
+
+    workerState = isolate->global->mainThreadState;
+    ZrCore_Module_SetStartupImage(isolate->global, launch->startupImage);
+    if (!zr_vm_task_worker_load_function(isolate, launch, &function)) {
         zr_vm_task_worker_queue_error_message(launch->ownerRuntime, launch->ownerHandle, "Failed to load worker callable");
         goto cleanup;
     }
@@ -404,8 +516,8 @@ static void zr_vm_task_worker_run_launch(ZrVmTaskWorkerLaunch *launch) {
     }
 
     ZrLib_Value_SetNull(&resultValue);
-    completed = zr_vm_task_worker_execute_callable(workerState, &callableValue, &resultValue);
-    if (!completed || workerState->threadStatus != ZR_THREAD_STATUS_FINE) {
+    if (!zr_vm_task_worker_execute_callable(workerState, &callableValue, &resultValue) ||
+        workerState->threadStatus != ZR_THREAD_STATUS_FINE) {
         if (workerState->hasCurrentException) {
             SZrTypeValue errorCopy = workerState->currentException;
             SZrString *message = ZrCore_Value_ConvertToString(workerState, &errorCopy);
@@ -439,70 +551,27 @@ static void zr_vm_task_worker_run_launch(ZrVmTaskWorkerLaunch *launch) {
                                           &payload);
     }
 
-cleanup:
-    if (project != ZR_NULL) {
-        ZrLibrary_Project_Free(workerState, project);
-        workerGlobal->userData = ZR_NULL;
-    }
-    ZrLibrary_NativeRegistry_Free(workerGlobal);
-    if (launch->binaryPath != ZR_NULL) {
-        remove(launch->binaryPath);
-    }
-    ZrCore_GlobalState_Free(workerGlobal);
-}
+    // only a cleanly finished job leaves the isolate warm; a fault may have left exception state behind.
+    reusable = ZR_TRUE;
 
-#if defined(ZR_PLATFORM_WIN)
-static unsigned __stdcall zr_vm_task_worker_entry(void *argument) {
-    ZrVmTaskWorkerLaunch *launch = (ZrVmTaskWorkerLaunch *)argument;
-    zr_vm_task_worker_run_launch(launch);
-    zr_vm_task_worker_launch_free(launch);
-    return 0;
-}
-#else
-static void *zr_vm_task_worker_entry(void *argument) {
-    ZrVmTaskWorkerLaunch *launch = (ZrVmTaskWorkerLaunch *)argument;
-    zr_vm_task_worker_run_launch(launch);
-    zr_vm_task_worker_launch_free(launch);
-    return ZR_NULL;
-}
-#endif
-
-static TZrBool zr_vm_task_worker_start(ZrVmTaskWorkerLaunch *launch) {
-    if (launch == ZR_NULL) {
-        return ZR_FALSE;
-    }
-
-#if defined(ZR_PLATFORM_WIN)
-    {
-        uintptr_t threadHandle = _beginthreadex(ZR_NULL, 0, zr_vm_task_worker_entry, launch, 0, ZR_NULL);
-        if (threadHandle == 0) {
-            return ZR_FALSE;
-        }
-        CloseHandle((HANDLE)threadHandle);
-        return ZR_TRUE;
-    }
-#else
-    {
-        pthread_t thread;
-        if (pthread_create(&thread, ZR_NULL, zr_vm_task_worker_entry, launch) != 0) {
-            return ZR_FALSE;
-        }
-        pthread_detach(thread);
-        return ZR_TRUE;
+cleanup:
+    if (!reusable) {
+        zr_vm_task_worker_isolate_release(isolate);
     }
-#endif
+    return reusable;
 }
 
 TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context,
                                        const SZrTypeValue *callable,
                                        SZrTypeValue *result,
-                                       SZrObject *mainScheduler) {
+                                       SZrObject *mainScheduler,
+                                       ZrVmTaskStealPool *stealPool) {
     SZrObject *handle;
     SZrFunction *function;
     ZrVmTaskWorkerLaunch *launch;
     SZrClosure *closure = ZR_NULL;
     SZrLibrary_Project *project;
-    TZrChar tempPath[512];
+    ZrVmTaskCallableBlob *callableBlob;
     TZrUInt32 captureIndex;
     TZrUInt32 captureCount = 0;
 
@@ -522,18 +591,18 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context,
 	        captureCount = closure != ZR_NULL ? (TZrUInt32)closure->closureValueCount : 0u;
 	    }
 
-    if (!zr_vm_task_worker_make_temp_path(tempPath, sizeof(tempPath)) ||
-        !ZrParser_Writer_WriteBinaryFile(context->state, function, tempPath)) {
+    callableBlob = zr_vm_task_callable_blob_new(context->state, function);
+    if (callableBlob == ZR_NULL) {
         return zr_vm_task_raise_runtime_error(context->state, "Failed to serialize worker callable");
     }
 
     launch = (ZrVmTaskWorkerLaunch *)malloc(sizeof(*launch));
     if (launch == ZR_NULL) {
-        remove(tempPath);
+        zr_vm_task_callable_blob_release(callableBlob);
         return ZR_FALSE;
     }
     memset(launch, 0, sizeof(*launch));
-    launch->binaryPath = zr_vm_task_worker_strdup(tempPath);
+    launch->callable = callableBlob;
     launch->captureCount = captureCount;
     launch->ownerRuntime = zr_vm_task_scheduler_get_runtime(context->state, mainScheduler);
     launch->ownerHandle = handle;
@@ -542,6 +611,9 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context,
     launch->workerIsolateId = zr_vm_task_next_worker_isolate_id();
     launch->supportMultithread = zr_vm_task_default_support_multithread(context->state);
     launch->autoCoroutine = zr_vm_task_get_bool_field(context->state, mainScheduler, "__zr_task_auto_coroutine", ZR_TRUE);
+    launch->startupImage = ZrCore_Module_CaptureStartupImage(context->state,
+                                                             ZrParser_Writer_WriteBinaryBuffer,
+                                                             ZrParser_Writer_FreeBinaryBuffer);
 
     project = (SZrLibrary_Project *)context->state->global->userData;
     if (project != ZR_NULL) {
@@ -565,7 +637,6 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context,
 	        launch->captures = (ZrVmTaskTransportValue *)calloc(captureCount, sizeof(ZrVmTaskTransportValue));
 	        if (launch->captures == ZR_NULL) {
 	            zr_vm_task_worker_launch_free(launch);
-	            remove(tempPath);
 	            return ZR_FALSE;
 	        }
 
@@ -576,7 +647,6 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context,
                                                    &launch->captures[captureIndex],
                                                    "spawnThread only captures Send values and thread transport handles")) {
                 zr_vm_task_worker_launch_free(launch);
-                remove(tempPath);
                 return ZR_FALSE;
             }
         }
@@ -585,9 +655,9 @@ TZrBool zr_vm_task_spawn_thread_worker(ZrLibCallContext *context,
     zr_vm_task_set_uint_field(context->state, handle, kTaskWorkerIsolateIdField, launch->workerIsolateId);
     zr_vm_task_record_last_worker_isolate(context->state, launch->workerIsolateId);
     if (!zr_vm_task_worker_append_pending_handle(context->state, mainScheduler, handle) ||
-        !zr_vm_task_worker_start(launch)) {
+        !(stealPool != ZR_NULL ? zr_vm_task_steal_pool_submit(stealPool, launch)
+                               : zr_vm_task_worker_pool_submit(launch))) {
         zr_vm_task_worker_launch_free(launch);
-        remove(tempPath);
         return zr_vm_task_raise_runtime_error(context->state, "Failed to start worker isolate thread");
     }
 
@@ -11,6 +11,7 @@
 #include "zr_vm_library/native_binding.h"
 #include "zr_vm_library/native_hints.h"
 #include "zr_vm_library/native_registry.h"
+#include "zr_vm_library/pooled_allocator.h"
 #include "zr_vm_library/project.h"
 
 #endif //ZR_VM_LIBRARY_H
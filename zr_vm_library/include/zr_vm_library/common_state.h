@@ -7,7 +7,7 @@
 #include "zr_vm_library/conf.h"
 
 /** we provide a default state for user here
- *  - builtin allocator uses default allocator of the system
+ *  - builtin allocator is the size-class pool in pooled_allocator.h (plain libc malloc with ZR_VM_SYSTEM_ALLOCATOR)
  *  - global state uses file loader as source code loader, just provide a .zrp file as the project config file
  *  -
  */
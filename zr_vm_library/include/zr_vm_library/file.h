@@ -46,6 +46,19 @@ struct ZR_STRUCT_ALIGN SZrLibrary_File_Reader {
 
 typedef struct SZrLibrary_File_Reader SZrLibrary_File_Reader;
 
+// Read-only view of a whole file (mmap / MapViewOfFile, or one heap read when mapping is unavailable). As an io
+// reader it hands out the file as a single chunk that stays valid until close.
+struct ZR_STRUCT_ALIGN SZrLibrary_File_MappedReader {
+    TZrBytePtr data;
+    TZrSize size;
+    TZrBool isMapped;
+    TZrBool served;
+    TZrPtr mappingHandle;
+    TZrChar normalizedPath[ZR_LIBRARY_MAX_PATH_LENGTH];
+};
+
+typedef struct SZrLibrary_File_MappedReader SZrLibrary_File_MappedReader;
+
 typedef struct SZrLibrary_File_Info {
     TZrChar path[ZR_LIBRARY_MAX_PATH_LENGTH];
     TZrChar name[ZR_LIBRARY_MAX_PATH_LENGTH];
@@ -158,6 +171,13 @@ ZR_LIBRARY_API SZrLibrary_File_Reader *ZrLibrary_File_OpenRead(SZrGlobalState *g
 
 ZR_LIBRARY_API void ZrLibrary_File_CloseRead(SZrGlobalState *global, SZrLibrary_File_Reader *reader);
 
+ZR_LIBRARY_API SZrLibrary_File_MappedReader *ZrLibrary_File_OpenMapped(SZrGlobalState *global, TZrNativeString path);
+
+ZR_LIBRARY_API void ZrLibrary_File_CloseMapped(SZrGlobalState *global, SZrLibrary_File_MappedReader *reader);
+
+// Opens a .zro through a mapped reader and marks the io as a binary resident image.
+ZR_LIBRARY_API TZrBool ZrLibrary_File_OpenMappedBinaryIo(SZrState *state, TZrNativeString path, SZrIo *io);
+
 ZR_LIBRARY_API TZrBool ZrLibrary_File_SourceLoadImplementation(SZrState *state,
                                                                TZrNativeString path,
                                                                TZrNativeString md5,
@@ -169,4 +189,10 @@ ZR_LIBRARY_API TZrBytePtr ZrLibrary_File_SourceReadImplementation(SZrState *stat
 
 ZR_LIBRARY_API void ZrLibrary_File_SourceCloseImplementation(SZrState *state, TZrPtr reader);
 
+ZR_LIBRARY_API TZrBytePtr ZrLibrary_File_MappedReadImplementation(SZrState *state,
+                                                                  TZrPtr reader,
+                                                                  ZR_OUT TZrSize *size);
+
+ZR_LIBRARY_API void ZrLibrary_File_MappedCloseImplementation(SZrState *state, TZrPtr reader);
+
 #endif // ZR_VM_LIBRARY_FILE_H
@@ -436,6 +436,9 @@ ZR_LIBRARY_API TZrBool ZrLib_CallContext_ReadObject(const ZrLibCallContext *cont
 ZR_LIBRARY_API TZrBool ZrLib_CallContext_ReadArray(const ZrLibCallContext *context,
                                                    TZrSize index,
                                                    SZrObject **outValue);
+ZR_LIBRARY_API TZrBool ZrLib_CallContext_ReadBytes(const ZrLibCallContext *context,
+                                                  TZrSize index,
+                                                  SZrObject **outValue);
 ZR_LIBRARY_API TZrBool ZrLib_CallContext_ReadFunction(const ZrLibCallContext *context,
                                                       TZrSize index,
                                                       SZrTypeValue **outValue);
@@ -479,6 +482,15 @@ ZR_LIBRARY_API TZrBool ZrLib_Array_PushValue(SZrState *state, SZrObject *array,
 ZR_LIBRARY_API TZrSize ZrLib_Array_Length(SZrObject *array);
 ZR_LIBRARY_API const SZrTypeValue *ZrLib_Array_Get(SZrState *state, SZrObject *array, TZrSize index);
 
+// zr.system.Bytes: contiguous byte buffers whose payload lives outside the value heap. Slices share storage.
+#define ZR_LIB_BYTES_TYPE_NAME "zr.system.Bytes"
+ZR_LIBRARY_API SZrObject *ZrLib_Bytes_New(SZrState *state, const TZrByte *bytes, TZrSize length);
+ZR_LIBRARY_API SZrObject *ZrLib_Bytes_NewSlice(SZrState *state, SZrObject *source, TZrSize offset, TZrSize length);
+ZR_LIBRARY_API TZrBool ZrLib_Bytes_Resize(SZrState *state, SZrObject *bytes, TZrSize length);
+ZR_LIBRARY_API TZrByte *ZrLib_Bytes_Data(SZrObject *bytes);
+ZR_LIBRARY_API TZrSize ZrLib_Bytes_Length(const SZrObject *bytes);
+ZR_LIBRARY_API SZrObject *ZrLib_Value_GetBytes(SZrState *state, const SZrTypeValue *value);
+
 ZR_LIBRARY_API SZrObject *ZrLib_Type_NewInstance(SZrState *state, const TZrChar *typeName);
 ZR_LIBRARY_API SZrObject *ZrLib_Type_NewInstanceWithPrototype(SZrState *state, SZrObjectPrototype *prototype);
 ZR_LIBRARY_API SZrObjectPrototype *ZrLib_Type_FindPrototype(SZrState *state, const TZrChar *typeName);
@@ -0,0 +1,36 @@
+//
+// Size-class pooled allocator behind ZrLibrary_CommonState_BuiltinAllocator.
+//
+
+#ifndef ZR_VM_LIBRARY_POOLED_ALLOCATOR_H
+#define ZR_VM_LIBRARY_POOLED_ALLOCATOR_H
+
+#include "zr_vm_library/conf.h"
+
+/** 内置分配器
+ *  - 小于等于 ZR_LIBRARY_POOLED_ALLOCATOR_MAX_SMALL_SIZE 的请求按尺寸类从线程本地缓存分配:
+ *    先取该类的空闲链表，没有时在当前 chunk 上 bump 切分，新对象因此按分配顺序紧挨着放置
+ *  - 栈、数组、哈希桶、文件缓冲等会持续增长的类型以及大块请求直接交给系统 malloc
+ *  - 每个块前有 ZR_LIBRARY_POOLED_ALLOCATOR_ALIGNMENT 字节的块头记录尺寸类，释放和 realloc 不依赖调用方传入的 originalSize
+ *  - 线程退出时其空闲块与未用完的 chunk 归还给进程级仓库，由后续线程复用；chunk 不归还系统
+ *  - 统计按线程记录，只由所属线程写入，汇总时不需要原子加
+ */
+
+#define ZR_LIBRARY_POOLED_ALLOCATOR_MAX_SMALL_SIZE 1024U
+#define ZR_LIBRARY_POOLED_ALLOCATOR_CHUNK_SIZE (64U * 1024U)
+#define ZR_LIBRARY_POOLED_ALLOCATOR_ALIGNMENT 16U
+
+typedef struct SZrLibrary_PooledAllocatorStats {
+    // live allocations per EZrMemoryNativeType hint (allocations minus frees reported with that hint).
+    TZrInt64 liveAllocations[ZR_MEMORY_NATIVE_TYPE_ENUM_MAX];
+    TZrUInt64 pooledAllocations;
+    TZrUInt64 systemAllocations;
+    TZrUInt64 reservedChunkBytes;
+} SZrLibrary_PooledAllocatorStats;
+
+ZR_LIBRARY_API TZrPtr ZrLibrary_PooledAllocator_Allocate(TZrPtr userData, TZrPtr pointer, TZrSize originalSize,
+                                                         TZrSize newSize, TZrInt64 flag);
+
+ZR_LIBRARY_API void ZrLibrary_PooledAllocator_GetStats(SZrLibrary_PooledAllocatorStats *outStats);
+
+#endif // ZR_VM_LIBRARY_POOLED_ALLOCATOR_H
@@ -812,7 +812,6 @@ static TZrBool aot_runtime_append_record(SZrGlobalState *global,
 }
 
 static TZrBool aot_runtime_load_zro_function(SZrState *state, const TZrChar *zroPath, SZrFunction **outFunction) {
-    SZrLibrary_File_Reader *reader;
     SZrIo io;
     SZrIoSource *ioSource;
 
@@ -823,23 +822,19 @@ static TZrBool aot_runtime_load_zro_function(SZrState *state, const TZrChar *zro
         return ZR_FALSE;
     }
 
-    reader = ZrLibrary_File_OpenRead(state->global, (TZrNativeString)zroPath, ZR_TRUE);
-    if (reader == ZR_NULL) {
+    if (!ZrLibrary_File_OpenMappedBinaryIo(state, (TZrNativeString)zroPath, &io)) {
         return ZR_FALSE;
     }
 
-    ZrCore_Io_Init(state, &io, ZrLibrary_File_SourceReadImplementation, ZrLibrary_File_SourceCloseImplementation, reader);
-    io.isBinary = ZR_TRUE;
+    io.borrowResidentImage = ZR_TRUE;
     ioSource = ZrCore_Io_ReadSourceNew(&io);
+    if (ioSource != ZR_NULL) {
+        *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, ioSource);
+        ZrCore_Io_ReadSourceFree(state->global, ioSource);
+    }
     if (io.close != ZR_NULL) {
         io.close(state, io.customData);
     }
-    if (ioSource == ZR_NULL) {
-        return ZR_FALSE;
-    }
-
-    *outFunction = ZrCore_Io_LoadEntryFunctionToRuntime(state, ioSource);
-    ZrCore_Io_ReadSourceFree(state->global, ioSource);
     return *outFunction != ZR_NULL;
 }
 
@@ -5,6 +5,7 @@
 #include "zr_vm_library/conf.h"
 #include "zr_vm_library/file.h"
 #include "zr_vm_library/native_registry.h"
+#include "zr_vm_library/pooled_allocator.h"
 #include "zr_vm_library/project.h"
 
 #include <stdarg.h>
@@ -14,8 +15,6 @@
 
 #include "zr_vm_common/zr_runtime_sentinel_conf.h"
 
-static TZrUInt64 CZrLibrary_CommonState_MemoryCounter[ZR_MEMORY_NATIVE_TYPE_ENUM_MAX] = {0};
-
 static TZrBool zr_library_common_state_trace_enabled(void) {
     static TZrBool initialized = ZR_FALSE;
     static TZrBool enabled = ZR_FALSE;
@@ -44,35 +43,34 @@ static void zr_library_common_state_trace(const TZrChar *format, ...) {
     va_end(arguments);
 }
 
+#if defined(ZR_LIBRARY_SYSTEM_ALLOCATOR)
 static TZrBool zr_library_common_state_allocator_can_release_pointer(TZrPtr pointer) {
     return pointer != ZR_NULL && (uintptr_t)pointer >= (uintptr_t)ZR_RUNTIME_INVALID_POINTER_GUARD_LOW_BOUND;
 }
+#endif
 
 TZrPtr ZrLibrary_CommonState_BuiltinAllocator(TZrPtr userData, TZrPtr pointer, TZrSize originalSize, TZrSize newSize,
                                               TZrInt64 flag) {
+#if defined(ZR_LIBRARY_SYSTEM_ALLOCATOR)
     TZrBool canReleasePointer;
-    TZrBool trackCounter;
 
     ZR_UNUSED_PARAMETER(userData);
     ZR_UNUSED_PARAMETER(originalSize);
+    ZR_UNUSED_PARAMETER(flag);
     canReleasePointer = zr_library_common_state_allocator_can_release_pointer(pointer);
-    trackCounter = flag >= 0 && flag < ZR_MEMORY_NATIVE_TYPE_ENUM_MAX;
     if (newSize == 0) {
-        if (trackCounter && canReleasePointer) {
-            CZrLibrary_CommonState_MemoryCounter[flag]--;
-        }
         if (canReleasePointer) {
             free(pointer);
         }
         return ZR_NULL;
     }
     if (pointer == ZR_NULL || !canReleasePointer) {
-        if (trackCounter) {
-            CZrLibrary_CommonState_MemoryCounter[flag]++;
-        }
         return (TZrPtr) malloc(newSize);
     }
     return (TZrPtr) realloc(pointer, newSize);
+#else
+    return ZrLibrary_PooledAllocator_Allocate(userData, pointer, originalSize, newSize, flag);
+#endif
 }
 
 SZrGlobalState *ZrLibrary_CommonState_CommonGlobalState_New(TZrNativeString configFilePath) {
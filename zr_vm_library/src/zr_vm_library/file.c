@@ -20,7 +20,9 @@
 #include <direct.h>
 #include <io.h>
 #include <sys/stat.h>
+#include <windows.h>
 #else
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -1635,6 +1637,160 @@ void ZrLibrary_File_CloseRead(SZrGlobalState *global, SZrLibrary_File_Reader *re
     ZrCore_Memory_RawFreeWithType(global, reader, sizeof(SZrLibrary_File_Reader), ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER);
 }
 
+static TZrBool file_map_native(SZrLibrary_File_MappedReader *reader) {
+#if defined(ZR_PLATFORM_WIN)
+    HANDLE fileHandle;
+    HANDLE mappingHandle;
+    LPVOID view;
+
+    fileHandle = CreateFileA(reader->normalizedPath,
+                             GENERIC_READ,
+                             FILE_SHARE_READ,
+                             ZR_NULL,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             ZR_NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return ZR_FALSE;
+    }
+    mappingHandle = CreateFileMappingA(fileHandle, ZR_NULL, PAGE_READONLY, 0, 0, ZR_NULL);
+    CloseHandle(fileHandle);
+    if (mappingHandle == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (view == ZR_NULL) {
+        CloseHandle(mappingHandle);
+        return ZR_FALSE;
+    }
+    reader->data = (TZrBytePtr)view;
+    reader->mappingHandle = (TZrPtr)mappingHandle;
+    return ZR_TRUE;
+#else
+    int descriptor;
+    void *view;
+
+    descriptor = open(reader->normalizedPath, O_RDONLY);
+    if (descriptor < 0) {
+        return ZR_FALSE;
+    }
+    view = mmap(ZR_NULL, reader->size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (view == MAP_FAILED) {
+        return ZR_FALSE;
+    }
+    reader->data = (TZrBytePtr)view;
+    return ZR_TRUE;
+#endif
+}
+
+static void file_unmap_native(SZrLibrary_File_MappedReader *reader) {
+#if defined(ZR_PLATFORM_WIN)
+    UnmapViewOfFile(reader->data);
+    if (reader->mappingHandle != ZR_NULL) {
+        CloseHandle((HANDLE)reader->mappingHandle);
+    }
+#else
+    munmap(reader->data, reader->size);
+#endif
+}
+
+static TZrBool file_read_whole_into_heap(SZrGlobalState *global, SZrLibrary_File_MappedReader *reader) {
+    FILE *file = fopen(reader->normalizedPath, "rb");
+    TZrSize readSize;
+
+    if (file == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    reader->data = ZrCore_Memory_RawMallocWithType(global, reader->size, ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER);
+    if (reader->data == ZR_NULL) {
+        fclose(file);
+        return ZR_FALSE;
+    }
+    readSize = fread(reader->data, 1, reader->size, file);
+    fclose(file);
+    if (readSize != reader->size) {
+        ZrCore_Memory_RawFreeWithType(global, reader->data, reader->size, ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER);
+        reader->data = ZR_NULL;
+        return ZR_FALSE;
+    }
+    return ZR_TRUE;
+}
+
+SZrLibrary_File_MappedReader *ZrLibrary_File_OpenMapped(SZrGlobalState *global, TZrNativeString path) {
+    SZrLibrary_File_MappedReader *reader;
+    TZrChar normalizedPath[ZR_LIBRARY_MAX_PATH_LENGTH];
+    TZrInt64 fileSize = 0;
+
+    if (path == ZR_NULL || !ZrLibrary_File_NormalizePath(path, normalizedPath, sizeof(normalizedPath)) ||
+        file_stat_exist(normalizedPath, &fileSize, ZR_NULL, ZR_NULL, ZR_NULL) != ZR_LIBRARY_FILE_IS_FILE ||
+        fileSize < 0) {
+        return ZR_NULL;
+    }
+
+    reader = ZrCore_Memory_RawMallocWithType(global,
+                                             sizeof(SZrLibrary_File_MappedReader),
+                                             ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER);
+    if (reader == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    memset(reader, 0, sizeof(*reader));
+    file_copy_text(reader->normalizedPath, sizeof(reader->normalizedPath), normalizedPath);
+    reader->size = (TZrSize)fileSize;
+    if (reader->size == 0) {
+        return reader;
+    }
+
+    reader->isMapped = file_map_native(reader);
+    if (!reader->isMapped && !file_read_whole_into_heap(global, reader)) {
+        ZrCore_Memory_RawFreeWithType(global,
+                                      reader,
+                                      sizeof(SZrLibrary_File_MappedReader),
+                                      ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER);
+        return ZR_NULL;
+    }
+    return reader;
+}
+
+void ZrLibrary_File_CloseMapped(SZrGlobalState *global, SZrLibrary_File_MappedReader *reader) {
+    if (reader == ZR_NULL) {
+        return;
+    }
+
+    if (reader->data != ZR_NULL) {
+        if (reader->isMapped) {
+            file_unmap_native(reader);
+        } else {
+            ZrCore_Memory_RawFreeWithType(global, reader->data, reader->size, ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER);
+        }
+        reader->data = ZR_NULL;
+    }
+
+    ZrCore_Memory_RawFreeWithType(global,
+                                  reader,
+                                  sizeof(SZrLibrary_File_MappedReader),
+                                  ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER);
+}
+
+TZrBool ZrLibrary_File_OpenMappedBinaryIo(SZrState *state, TZrNativeString path, SZrIo *io) {
+    SZrLibrary_File_MappedReader *reader;
+
+    if (state == ZR_NULL || io == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    reader = ZrLibrary_File_OpenMapped(state->global, path);
+    if (reader == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    ZrCore_Io_Init(state, io, ZrLibrary_File_MappedReadImplementation, ZrLibrary_File_MappedCloseImplementation, reader);
+    io->isBinary = ZR_TRUE;
+    io->isResidentImage = ZR_TRUE;
+    return ZR_TRUE;
+}
+
 TZrBool ZrLibrary_File_SourceLoadImplementation(SZrState *state, TZrNativeString path, TZrNativeString md5, SZrIo *io) {
     SZrLibrary_File_Reader *reader;
 
@@ -1673,3 +1829,24 @@ void ZrLibrary_File_SourceCloseImplementation(SZrState *state, TZrPtr reader) {
 
     ZrLibrary_File_CloseRead(state->global, (SZrLibrary_File_Reader *)reader);
 }
+
+TZrBytePtr ZrLibrary_File_MappedReadImplementation(SZrState *state, TZrPtr reader, ZR_OUT TZrSize *size) {
+    SZrLibrary_File_MappedReader *mappedReader = (SZrLibrary_File_MappedReader *)reader;
+
+    ZR_UNUSED_PARAMETER(state);
+    if (mappedReader == ZR_NULL || size == ZR_NULL || mappedReader->served || mappedReader->data == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    mappedReader->served = ZR_TRUE;
+    *size = mappedReader->size;
+    return mappedReader->data;
+}
+
+void ZrLibrary_File_MappedCloseImplementation(SZrState *state, TZrPtr reader) {
+    if (state == ZR_NULL || reader == ZR_NULL) {
+        return;
+    }
+
+    ZrLibrary_File_CloseMapped(state->global, (SZrLibrary_File_MappedReader *)reader);
+}
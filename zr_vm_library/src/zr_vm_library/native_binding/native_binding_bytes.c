@@ -0,0 +1,90 @@
+//
+// zr.system.Bytes byte-buffer helpers shared by native modules.
+//
+
+#include "native_binding/native_binding_internal.h"
+
+#include "zr_vm_core/memory.h"
+
+static SZrObject *native_binding_bytes_new_instance(SZrState *state) {
+    SZrObject *object = ZrLib_Type_NewInstance(state, ZR_LIB_BYTES_TYPE_NAME);
+
+    // hosts without zr.system still get a working buffer, only without the script-visible methods and `length`.
+    return object != ZR_NULL ? object : ZrLib_Object_New(state);
+}
+
+SZrObject *ZrLib_Bytes_New(SZrState *state, const TZrByte *bytes, TZrSize length) {
+    SZrObject *object;
+
+    if (state == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    object = native_binding_bytes_new_instance(state);
+    if (object == ZR_NULL || !ZrCore_Object_AllocateByteStorage(state, object, length)) {
+        return ZR_NULL;
+    }
+
+    if (bytes != ZR_NULL && length > 0) {
+        ZrCore_Memory_RawCopy(ZrCore_Object_GetByteStorageData(object), (TZrPtr)bytes, length);
+    }
+    return object;
+}
+
+SZrObject *ZrLib_Bytes_NewSlice(SZrState *state, SZrObject *source, TZrSize offset, TZrSize length) {
+    SZrObject *object;
+
+    if (state == ZR_NULL || source == ZR_NULL || source->byteStorage == ZR_NULL ||
+        offset > source->byteStorageLength || length > source->byteStorageLength - offset) {
+        return ZR_NULL;
+    }
+
+    object = native_binding_bytes_new_instance(state);
+    if (object == ZR_NULL || !ZrCore_Object_ShareByteStorage(state, object, source, offset, length)) {
+        return ZR_NULL;
+    }
+
+    return object;
+}
+
+TZrBool ZrLib_Bytes_Resize(SZrState *state, SZrObject *bytes, TZrSize length) {
+    return state != ZR_NULL && bytes != ZR_NULL && ZrCore_Object_ResizeByteStorage(state, bytes, length);
+}
+
+TZrByte *ZrLib_Bytes_Data(SZrObject *bytes) {
+    return ZrCore_Object_GetByteStorageData(bytes);
+}
+
+TZrSize ZrLib_Bytes_Length(const SZrObject *bytes) {
+    return bytes != ZR_NULL ? bytes->byteStorageLength : 0;
+}
+
+SZrObject *ZrLib_Value_GetBytes(SZrState *state, const SZrTypeValue *value) {
+    SZrObject *object;
+
+    if (state == ZR_NULL || value == ZR_NULL || value->type != ZR_VALUE_TYPE_OBJECT || value->value.object == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    object = ZR_CAST_OBJECT(state, value->value.object);
+    return object != ZR_NULL && object->byteStorage != ZR_NULL ? object : ZR_NULL;
+}
+
+TZrBool ZrLib_CallContext_ReadBytes(const ZrLibCallContext *context, TZrSize index, SZrObject **outValue) {
+    SZrTypeValue *value = ZrLib_CallContext_Argument(context, index);
+    SZrObject *bytes;
+
+    if (value == ZR_NULL) {
+        ZrLib_CallContext_RaiseArityError(context, index + 1, UINT16_MAX);
+    }
+
+    bytes = ZrLib_Value_GetBytes(context->state, value);
+    if (bytes == ZR_NULL) {
+        ZrLib_CallContext_RaiseTypeError(context, index, "Bytes");
+    }
+
+    if (outValue != ZR_NULL) {
+        *outValue = bytes;
+    }
+    return ZR_TRUE;
+}
@@ -188,6 +188,7 @@ static ZR_FORCE_INLINE SZrTypeValue *native_binding_temp_root_value_slot(ZrLibTe
 }
 
 static ZR_FORCE_INLINE TZrBool native_binding_pin_raw_object(SZrState *state,
+                                                             SZrGcHandleScope *handleScope,
                                                              SZrRawObject *object,
                                                              TZrBool *addedByCaller) {
     if (addedByCaller != ZR_NULL) {
@@ -200,6 +201,9 @@ static ZR_FORCE_INLINE TZrBool native_binding_pin_raw_object(SZrState *state,
     if (object == ZR_NULL) {
         return ZR_TRUE;
     }
+    if (handleScope != ZR_NULL && ZrCore_State_HandleScopePushObject(handleScope, object)) {
+        return ZR_TRUE;
+    }
 
     return ZrCore_GarbageCollector_IgnoreObjectIfNeededFast(state->global, state, object, addedByCaller);
 }
@@ -288,6 +292,7 @@ TZrInt64 native_binding_dispatcher(SZrState *state) {
     TZrBool hasSavedCallInfoReturn;
     TZrBool hasCopiedSelf;
     TZrBool selfPinAdded;
+    SZrGcHandleScope handleScope;
     TZrBool freeStableArgumentCopies;
     TZrBool freeArgumentPinAdded;
     TZrBool success;
@@ -487,7 +492,12 @@ TZrInt64 native_binding_dispatcher(SZrState *state) {
         }
     }
 
-    if (!native_binding_pin_value_object(state, context.selfValue != ZR_NULL ? &stableSelfCopy : ZR_NULL, &selfPinAdded)) {
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
+    if (!native_binding_pin_value_object(state,
+                                         &handleScope,
+                                         context.selfValue != ZR_NULL ? &stableSelfCopy : ZR_NULL,
+                                         &selfPinAdded)) {
+        ZrCore_State_HandleScopeClose(state, &handleScope);
         for (index = copiedArgumentCount; index > 0; index--) {
             ZrCore_Ownership_ReleaseValue(state, &stableArgumentCopies[index - 1]);
         }
@@ -509,12 +519,16 @@ TZrInt64 native_binding_dispatcher(SZrState *state) {
         return 0;
     }
     for (index = 0; index < context.argumentCount; index++) {
-        if (!native_binding_pin_value_object(state, &stableArgumentCopies[index], &argumentPinAdded[index])) {
+        if (!native_binding_pin_value_object(state,
+                                             &handleScope,
+                                             &stableArgumentCopies[index],
+                                             &argumentPinAdded[index])) {
             while (index > 0) {
                 index--;
                 native_binding_unpin_value_object(state->global, &stableArgumentCopies[index], argumentPinAdded[index]);
             }
             native_binding_unpin_value_object(state->global, &stableSelfCopy, selfPinAdded);
+            ZrCore_State_HandleScopeClose(state, &handleScope);
             for (index = copiedArgumentCount; index > 0; index--) {
                 ZrCore_Ownership_ReleaseValue(state, &stableArgumentCopies[index - 1]);
             }
@@ -632,6 +646,7 @@ cleanup_after_native_callback:
     native_binding_unpin_value_object(state->global,
                                       context.selfValue != ZR_NULL ? &stableSelfCopy : ZR_NULL,
                                       selfPinAdded);
+    ZrCore_State_HandleScopeClose(state, &handleScope);
     for (index = copiedArgumentCount; index > 0; index--) {
         ZrCore_Ownership_ReleaseValue(state, &stableArgumentCopies[index - 1]);
     }
@@ -1277,6 +1292,7 @@ void ZrLib_Object_SetFieldCString(SZrState *state,
                                   const SZrTypeValue *value) {
     SZrTypeValue keyValue;
     SZrString *fieldString;
+    SZrGcHandleScope handleScope;
     TZrBool objectPinAdded = ZR_FALSE;
     TZrBool valuePinAdded = ZR_FALSE;
     TZrBool keyPinAdded = ZR_FALSE;
@@ -1285,34 +1301,29 @@ void ZrLib_Object_SetFieldCString(SZrState *state,
         return;
     }
 
-    if (!native_binding_pin_raw_object(state, ZR_CAST_RAW_OBJECT_AS_SUPER(object), &objectPinAdded)) {
-        return;
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
+    if (!native_binding_pin_raw_object(state, &handleScope, ZR_CAST_RAW_OBJECT_AS_SUPER(object), &objectPinAdded)) {
+        goto cleanup;
     }
-    if (!native_binding_pin_value_object(state, value, &valuePinAdded)) {
-        native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(object), objectPinAdded);
-        return;
+    if (!native_binding_pin_value_object(state, &handleScope, value, &valuePinAdded)) {
+        goto cleanup;
     }
 
     fieldString = ZrCore_String_Create(state, (TZrNativeString)fieldName, strlen(fieldName));
-    if (fieldString == ZR_NULL) {
-        native_binding_unpin_value_object(state->global, value, valuePinAdded);
-        native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(object), objectPinAdded);
-        return;
-    }
-
-    if (!native_binding_pin_raw_object(state, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString), &keyPinAdded)) {
-        native_binding_unpin_value_object(state->global, value, valuePinAdded);
-        native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(object), objectPinAdded);
-        return;
+    if (fieldString == ZR_NULL ||
+        !native_binding_pin_raw_object(state, &handleScope, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString), &keyPinAdded)) {
+        goto cleanup;
     }
     ZrCore_Value_InitAsRawObject(state, &keyValue, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString));
     keyValue.type = ZR_VALUE_TYPE_STRING;
 
     ZrCore_Object_SetValue(state, object, &keyValue, value);
-
     native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString), keyPinAdded);
+
+cleanup:
     native_binding_unpin_value_object(state->global, value, valuePinAdded);
     native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(object), objectPinAdded);
+    ZrCore_State_HandleScopeClose(state, &handleScope);
 }
 
 const SZrTypeValue *ZrLib_Object_GetFieldCString(SZrState *state,
@@ -1320,6 +1331,7 @@ const SZrTypeValue *ZrLib_Object_GetFieldCString(SZrState *state,
                                                  const TZrChar *fieldName) {
     SZrTypeValue keyValue;
     SZrString *fieldString;
+    SZrGcHandleScope handleScope;
     TZrBool objectPinAdded = ZR_FALSE;
     TZrBool keyPinAdded = ZR_FALSE;
     const SZrTypeValue *result = ZR_NULL;
@@ -1328,27 +1340,25 @@ const SZrTypeValue *ZrLib_Object_GetFieldCString(SZrState *state,
         return ZR_NULL;
     }
 
-    if (!native_binding_pin_raw_object(state, ZR_CAST_RAW_OBJECT_AS_SUPER(object), &objectPinAdded)) {
-        return ZR_NULL;
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
+    if (!native_binding_pin_raw_object(state, &handleScope, ZR_CAST_RAW_OBJECT_AS_SUPER(object), &objectPinAdded)) {
+        goto cleanup;
     }
 
     fieldString = ZrCore_String_Create(state, (TZrNativeString)fieldName, strlen(fieldName));
-    if (fieldString == ZR_NULL) {
-        native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(object), objectPinAdded);
-        return ZR_NULL;
-    }
-
-    if (!native_binding_pin_raw_object(state, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString), &keyPinAdded)) {
-        native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(object), objectPinAdded);
-        return ZR_NULL;
+    if (fieldString == ZR_NULL ||
+        !native_binding_pin_raw_object(state, &handleScope, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString), &keyPinAdded)) {
+        goto cleanup;
     }
     ZrCore_Value_InitAsRawObject(state, &keyValue, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString));
     keyValue.type = ZR_VALUE_TYPE_STRING;
 
     result = ZrCore_Object_GetValue(state, object, &keyValue);
-
     native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(fieldString), keyPinAdded);
+
+cleanup:
     native_binding_unpin_raw_object(state->global, ZR_CAST_RAW_OBJECT_AS_SUPER(object), objectPinAdded);
+    ZrCore_State_HandleScopeClose(state, &handleScope);
     return result;
 }
 
@@ -1398,6 +1408,7 @@ static TZrBool native_binding_array_try_push_dense_pair_pool_pinned(SZrState *st
 
 TZrBool ZrLib_Array_PushValue(SZrState *state, SZrObject *array, const SZrTypeValue *value) {
     SZrTypeValue arrayValue;
+    SZrGcHandleScope handleScope;
     TZrBool arrayPinAdded = ZR_FALSE;
     TZrBool valuePinAdded = ZR_FALSE;
     SZrTypeValue key;
@@ -1408,11 +1419,11 @@ TZrBool ZrLib_Array_PushValue(SZrState *state, SZrObject *array, const SZrTypeVa
     }
 
     ZrLib_Value_SetObject(state, &arrayValue, array, native_binding_value_type_for_object(array));
-    if (!native_binding_pin_value_object(state, &arrayValue, &arrayPinAdded)) {
-        return ZR_FALSE;
-    }
-    if (!native_binding_pin_value_object(state, value, &valuePinAdded)) {
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
+    if (!native_binding_pin_value_object(state, &handleScope, &arrayValue, &arrayPinAdded) ||
+        !native_binding_pin_value_object(state, &handleScope, value, &valuePinAdded)) {
         native_binding_unpin_value_object(state->global, &arrayValue, arrayPinAdded);
+        ZrCore_State_HandleScopeClose(state, &handleScope);
         return ZR_FALSE;
     }
 
@@ -1426,6 +1437,7 @@ TZrBool ZrLib_Array_PushValue(SZrState *state, SZrObject *array, const SZrTypeVa
 
     native_binding_unpin_value_object(state->global, value, valuePinAdded);
     native_binding_unpin_value_object(state->global, &arrayValue, arrayPinAdded);
+    ZrCore_State_HandleScopeClose(state, &handleScope);
     return success;
 }
 
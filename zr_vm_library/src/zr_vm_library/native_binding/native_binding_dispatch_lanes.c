@@ -139,6 +139,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_one_argument(
     FZrLibBoundCallback callback;
     ZrLibStableValueCopy stableSelfCopy = {0};
     SZrTypeValue stableArgumentCopy;
+    SZrGcHandleScope handleScope;
     TZrBool argumentPinAdded = ZR_FALSE;
     TZrBool argumentNeedsRelease = ZR_FALSE;
     TZrBool hasStableSelf = ZR_FALSE;
@@ -164,6 +165,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_one_argument(
         hasStableSelf = ZR_TRUE;
         context->selfValue = &stableSelfCopy.value;
     }
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
 
     if (!native_binding_prepare_stable_value_raw(state,
                                                  &stableArgumentCopy,
@@ -175,10 +177,12 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_one_argument(
     context->argumentValuePointers = ZR_NULL;
 
     if (!native_binding_pin_stable_value_if_needed(state,
+                                                   &handleScope,
                                                    hasStableSelf ? &stableSelfCopy.value : ZR_NULL,
                                                    hasStableSelf ? stableSelfCopy.needsRelease : ZR_FALSE,
                                                    &selfPinAdded) ||
         !native_binding_pin_stable_value_if_needed(state,
+                                                   &handleScope,
                                                    &stableArgumentCopy,
                                                    argumentNeedsRelease,
                                                    &argumentPinAdded)) {
@@ -196,6 +200,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_one_argument(
 cleanup:
     native_binding_unpin_value_object(state->global, &stableArgumentCopy, argumentPinAdded);
     native_binding_unpin_value_object(state->global, hasStableSelf ? &stableSelfCopy.value : ZR_NULL, selfPinAdded);
+    ZrCore_State_HandleScopeClose(state, &handleScope);
     native_binding_release_stable_value_raw(state, &stableArgumentCopy, &argumentNeedsRelease);
     if (hasStableSelf) {
         native_binding_release_stable_value(state, &stableSelfCopy);
@@ -213,6 +218,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_two_arguments(
     FZrLibBoundCallback callback;
     ZrLibStableValueCopy stableSelfCopy = {0};
     SZrTypeValue stableArgumentCopies[2];
+    SZrGcHandleScope handleScope;
     TZrBool argumentPinAdded[2] = {ZR_FALSE, ZR_FALSE};
     TZrBool argumentNeedsRelease[2] = {ZR_FALSE, ZR_FALSE};
     TZrBool hasStableSelf = ZR_FALSE;
@@ -238,6 +244,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_two_arguments(
         hasStableSelf = ZR_TRUE;
         context->selfValue = &stableSelfCopy.value;
     }
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
 
     if (!native_binding_prepare_stable_value_raw(state,
                                                  &stableArgumentCopies[0],
@@ -253,14 +260,17 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_two_arguments(
     context->argumentValuePointers = ZR_NULL;
 
     if (!native_binding_pin_stable_value_if_needed(state,
+                                                   &handleScope,
                                                    hasStableSelf ? &stableSelfCopy.value : ZR_NULL,
                                                    hasStableSelf ? stableSelfCopy.needsRelease : ZR_FALSE,
                                                    &selfPinAdded) ||
         !native_binding_pin_stable_value_if_needed(state,
+                                                   &handleScope,
                                                    &stableArgumentCopies[0],
                                                    argumentNeedsRelease[0],
                                                    &argumentPinAdded[0]) ||
         !native_binding_pin_stable_value_if_needed(state,
+                                                   &handleScope,
                                                    &stableArgumentCopies[1],
                                                    argumentNeedsRelease[1],
                                                    &argumentPinAdded[1])) {
@@ -279,6 +289,7 @@ cleanup:
     native_binding_unpin_value_object(state->global, &stableArgumentCopies[1], argumentPinAdded[1]);
     native_binding_unpin_value_object(state->global, &stableArgumentCopies[0], argumentPinAdded[0]);
     native_binding_unpin_value_object(state->global, hasStableSelf ? &stableSelfCopy.value : ZR_NULL, selfPinAdded);
+    ZrCore_State_HandleScopeClose(state, &handleScope);
     native_binding_release_stable_value_raw(state, &stableArgumentCopies[1], &argumentNeedsRelease[1]);
     native_binding_release_stable_value_raw(state, &stableArgumentCopies[0], &argumentNeedsRelease[0]);
     if (hasStableSelf) {
@@ -296,6 +307,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_generic(SZrState *stat
     FZrLibBoundCallback callback;
     ZrLibStableValueCopy stableSelfCopy = {0};
     SZrTypeValue stableArgumentCopies[ZR_LIBRARY_NATIVE_INLINE_ARGUMENT_CAPACITY];
+    SZrGcHandleScope handleScope;
     TZrBool argumentPinAdded[ZR_LIBRARY_NATIVE_INLINE_ARGUMENT_CAPACITY];
     TZrBool argumentNeedsRelease[ZR_LIBRARY_NATIVE_INLINE_ARGUMENT_CAPACITY];
     TZrSize argumentCount;
@@ -333,6 +345,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_generic(SZrState *stat
         hasStableSelf = ZR_TRUE;
         context->selfValue = &stableSelfCopy.value;
     }
+    ZrCore_State_HandleScopeOpen(state, &handleScope);
 
     for (index = 0; index < argumentCount; index++) {
         if (!native_binding_prepare_stable_value_raw(state,
@@ -347,6 +360,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_generic(SZrState *stat
     context->argumentValuePointers = ZR_NULL;
 
     if (!native_binding_pin_stable_value_if_needed(state,
+                                                   &handleScope,
                                                    hasStableSelf ? &stableSelfCopy.value : ZR_NULL,
                                                    hasStableSelf ? stableSelfCopy.needsRelease : ZR_FALSE,
                                                    &selfPinAdded)) {
@@ -354,6 +368,7 @@ static TZrBool native_binding_dispatch_inline_pinned_lane_generic(SZrState *stat
     }
     for (index = 0; index < argumentCount; index++) {
         if (!native_binding_pin_stable_value_if_needed(state,
+                                                       &handleScope,
                                                        &stableArgumentCopies[index],
                                                        argumentNeedsRelease[index],
                                                        &argumentPinAdded[index])) {
@@ -378,6 +393,7 @@ cleanup:
     native_binding_unpin_value_object(state->global,
                                       hasStableSelf ? &stableSelfCopy.value : ZR_NULL,
                                       selfPinAdded);
+    ZrCore_State_HandleScopeClose(state, &handleScope);
     for (index = copiedArgumentCount; index > 0; index--) {
         native_binding_release_stable_value_raw(state,
                                                 &stableArgumentCopies[index - 1],
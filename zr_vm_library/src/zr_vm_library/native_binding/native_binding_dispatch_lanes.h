@@ -25,7 +25,13 @@ static ZR_FORCE_INLINE TZrBool native_binding_value_has_detached_gc_ownership_in
     return control != ZR_NULL && control->object == object && control->isDetachedFromGc;
 }
 
+/*
+ * Arguments are rooted through the call's handle scope: a stack-local push that
+ * the GC scans with the thread. Only when the scope is full does a value fall
+ * back to the collector's ignore registry, reported through addedByCaller.
+ */
 static ZR_FORCE_INLINE TZrBool native_binding_pin_value_object_inline(SZrState *state,
+                                                                      SZrGcHandleScope *handleScope,
                                                                       const SZrTypeValue *value,
                                                                       TZrBool *addedByCaller) {
     SZrRawObject *object;
@@ -47,6 +53,10 @@ static ZR_FORCE_INLINE TZrBool native_binding_pin_value_object_inline(SZrState *
         return ZR_TRUE;
     }
 
+    if (handleScope != ZR_NULL && ZrCore_State_HandleScopePushObject(handleScope, object)) {
+        return ZR_TRUE;
+    }
+
     return ZrCore_GarbageCollector_IgnoreObjectIfNeededFast(state->global, state, object, addedByCaller);
 }
 
@@ -152,6 +162,7 @@ static ZR_FORCE_INLINE void native_binding_release_stable_value_inline(SZrState
 }
 
 static ZR_FORCE_INLINE TZrBool native_binding_pin_stable_value_if_needed_inline(SZrState *state,
+                                                                                SZrGcHandleScope *handleScope,
                                                                                 const SZrTypeValue *value,
                                                                                 TZrBool needsPin,
                                                                                 TZrBool *addedByCaller) {
@@ -162,13 +173,13 @@ static ZR_FORCE_INLINE TZrBool native_binding_pin_stable_value_if_needed_inline(
     /*
      * Shallow stable copies still alias the live VM-stack source slot, so that
      * slot already acts as the GC root. Only cloned/released stable copies need
-     * an extra ignore pin during the native callback.
+     * an extra pin during the native callback.
      */
     if (!needsPin) {
         return ZR_TRUE;
     }
 
-    return native_binding_pin_value_object_inline(state, value, addedByCaller);
+    return native_binding_pin_value_object_inline(state, handleScope, value, addedByCaller);
 }
 
 static ZR_FORCE_INLINE FZrLibBoundCallback native_binding_entry_callback_inline(const ZrLibBindingEntry *entry) {
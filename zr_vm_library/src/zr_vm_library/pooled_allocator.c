@@ -0,0 +1,473 @@
+//
+// Size-class pooled allocator: thread-local free lists and bump chunks for small VM allocations, with a
+// process-wide depot that takes over the blocks of exiting threads.
+//
+#include "zr_vm_library/pooled_allocator.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "zr_vm_common/zr_runtime_sentinel_conf.h"
+
+#if defined(_MSC_VER)
+#define ZR_POOLED_ALLOCATOR_THREAD_LOCAL __declspec(thread)
+#else
+#define ZR_POOLED_ALLOCATOR_THREAD_LOCAL _Thread_local
+#endif
+
+// malloc's own alignment guarantee on 64-bit targets; chunks come from malloc, so payloads keep it.
+#define ZR_POOLED_ALLOCATOR_HEADER_SIZE ((TZrSize)ZR_LIBRARY_POOLED_ALLOCATOR_ALIGNMENT)
+#define ZR_POOLED_ALLOCATOR_CLASS_COUNT 20U
+#define ZR_POOLED_ALLOCATOR_SYSTEM_CLASS 0xFFFFFFFFU
+#define ZR_POOLED_ALLOCATOR_GRANULE_SHIFT 4U
+#define ZR_POOLED_ALLOCATOR_LOOKUP_LENGTH ((ZR_LIBRARY_POOLED_ALLOCATOR_MAX_SMALL_SIZE >> 4U) + 1U)
+// leftover bump space smaller than this is not worth handing to the depot.
+#define ZR_POOLED_ALLOCATOR_MIN_SPARE_REGION 256U
+
+// 16-byte steps up to 128, then four classes per power of two.
+static const TZrUInt32 g_pooled_allocator_class_sizes[ZR_POOLED_ALLOCATOR_CLASS_COUNT] = {
+        16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512, 640, 768, 896, 1024,
+};
+
+// padded to ZR_POOLED_ALLOCATOR_HEADER_SIZE.
+typedef struct SZrPooledAllocatorHeader {
+    TZrUInt32 sizeClass;
+} SZrPooledAllocatorHeader;
+
+typedef struct SZrPooledAllocatorFreeBlock {
+    struct SZrPooledAllocatorFreeBlock *next;
+} SZrPooledAllocatorFreeBlock;
+
+typedef struct SZrPooledAllocatorSpareRegion {
+    struct SZrPooledAllocatorSpareRegion *next;
+    TZrBytePtr limit;
+} SZrPooledAllocatorSpareRegion;
+
+typedef struct SZrPooledAllocatorCache {
+    SZrPooledAllocatorFreeBlock *freeLists[ZR_POOLED_ALLOCATOR_CLASS_COUNT];
+    TZrBytePtr bumpCursor;
+    TZrBytePtr bumpLimit;
+    // written only by the owning thread; readers use relaxed loads.
+    TZrInt64 liveAllocations[ZR_MEMORY_NATIVE_TYPE_ENUM_MAX];
+    TZrUInt64 pooledAllocations;
+    TZrUInt64 systemAllocations;
+    TZrUInt64 reservedChunkBytes;
+    struct SZrPooledAllocatorCache *previous;
+    struct SZrPooledAllocatorCache *next;
+} SZrPooledAllocatorCache;
+
+typedef struct SZrPooledAllocatorDepot {
+    SZrPooledAllocatorFreeBlock *freeLists[ZR_POOLED_ALLOCATOR_CLASS_COUNT];
+    SZrPooledAllocatorSpareRegion *spareRegions;
+    SZrPooledAllocatorCache *caches;
+    SZrLibrary_PooledAllocatorStats retired;
+    // non-zero while freeLists/spareRegions may hold something; lets refills skip the lock.
+    TZrUInt32 hasBlocks;
+} SZrPooledAllocatorDepot;
+
+static TZrUInt8 g_pooled_allocator_class_lookup[ZR_POOLED_ALLOCATOR_LOOKUP_LENGTH];
+static SZrPooledAllocatorDepot g_pooled_allocator_depot;
+static ZR_POOLED_ALLOCATOR_THREAD_LOCAL SZrPooledAllocatorCache *g_pooled_allocator_cache = ZR_NULL;
+
+#if defined(_WIN32)
+static INIT_ONCE g_pooled_allocator_once = INIT_ONCE_STATIC_INIT;
+static SRWLOCK g_pooled_allocator_lock = SRWLOCK_INIT;
+static DWORD g_pooled_allocator_fls = FLS_OUT_OF_INDEXES;
+#else
+static pthread_once_t g_pooled_allocator_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t g_pooled_allocator_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t g_pooled_allocator_key;
+static TZrBool g_pooled_allocator_key_ready = ZR_FALSE;
+#endif
+
+#if defined(_MSC_VER)
+#define ZR_POOLED_ALLOCATOR_LOAD_U32(TARGET) ((TZrUInt32)InterlockedCompareExchange((volatile LONG *)(TARGET), 0, 0))
+#define ZR_POOLED_ALLOCATOR_STORE_U32(TARGET, VALUE) InterlockedExchange((volatile LONG *)(TARGET), (LONG)(VALUE))
+#define ZR_POOLED_ALLOCATOR_LOAD_COUNTER(TARGET) (*(volatile const __int64 *)(TARGET))
+#define ZR_POOLED_ALLOCATOR_STORE_COUNTER(TARGET, VALUE) (*(volatile __int64 *)(TARGET) = (__int64)(VALUE))
+#else
+#define ZR_POOLED_ALLOCATOR_LOAD_U32(TARGET) __atomic_load_n((TARGET), __ATOMIC_ACQUIRE)
+#define ZR_POOLED_ALLOCATOR_STORE_U32(TARGET, VALUE) __atomic_store_n((TARGET), (VALUE), __ATOMIC_RELEASE)
+#define ZR_POOLED_ALLOCATOR_LOAD_COUNTER(TARGET) __atomic_load_n((TARGET), __ATOMIC_RELAXED)
+#define ZR_POOLED_ALLOCATOR_STORE_COUNTER(TARGET, VALUE) __atomic_store_n((TARGET), (VALUE), __ATOMIC_RELAXED)
+#endif
+
+// single-writer counter bump: a plain load/store pair, no locked instruction.
+#define ZR_POOLED_ALLOCATOR_COUNTER_ADD(TARGET, DELTA)                                                                 \
+    ZR_POOLED_ALLOCATOR_STORE_COUNTER((TARGET), ZR_POOLED_ALLOCATOR_LOAD_COUNTER(TARGET) + (DELTA))
+
+static void pooled_allocator_lock(void) {
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&g_pooled_allocator_lock);
+#else
+    pthread_mutex_lock(&g_pooled_allocator_lock);
+#endif
+}
+
+static void pooled_allocator_unlock(void) {
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&g_pooled_allocator_lock);
+#else
+    pthread_mutex_unlock(&g_pooled_allocator_lock);
+#endif
+}
+
+static void pooled_allocator_fold_stats(SZrLibrary_PooledAllocatorStats *target, const SZrPooledAllocatorCache *cache) {
+    TZrSize index;
+
+    for (index = 0; index < ZR_MEMORY_NATIVE_TYPE_ENUM_MAX; index++) {
+        target->liveAllocations[index] += ZR_POOLED_ALLOCATOR_LOAD_COUNTER(&cache->liveAllocations[index]);
+    }
+    target->pooledAllocations += ZR_POOLED_ALLOCATOR_LOAD_COUNTER(&cache->pooledAllocations);
+    target->systemAllocations += ZR_POOLED_ALLOCATOR_LOAD_COUNTER(&cache->systemAllocations);
+    target->reservedChunkBytes += ZR_POOLED_ALLOCATOR_LOAD_COUNTER(&cache->reservedChunkBytes);
+}
+
+static void pooled_allocator_release_cache(void *value) {
+    SZrPooledAllocatorCache *cache = (SZrPooledAllocatorCache *)value;
+    TZrSize sizeClass;
+
+    if (cache == ZR_NULL) {
+        return;
+    }
+
+    pooled_allocator_lock();
+    for (sizeClass = 0; sizeClass < ZR_POOLED_ALLOCATOR_CLASS_COUNT; sizeClass++) {
+        SZrPooledAllocatorFreeBlock *head = cache->freeLists[sizeClass];
+        SZrPooledAllocatorFreeBlock *tail = head;
+
+        if (head == ZR_NULL) {
+            continue;
+        }
+        while (tail->next != ZR_NULL) {
+            tail = tail->next;
+        }
+        tail->next = g_pooled_allocator_depot.freeLists[sizeClass];
+        g_pooled_allocator_depot.freeLists[sizeClass] = head;
+    }
+    if (cache->bumpCursor != ZR_NULL &&
+        (TZrSize)(cache->bumpLimit - cache->bumpCursor) >= ZR_POOLED_ALLOCATOR_MIN_SPARE_REGION) {
+        SZrPooledAllocatorSpareRegion *region = (SZrPooledAllocatorSpareRegion *)cache->bumpCursor;
+
+        region->limit = cache->bumpLimit;
+        region->next = g_pooled_allocator_depot.spareRegions;
+        g_pooled_allocator_depot.spareRegions = region;
+    }
+    ZR_POOLED_ALLOCATOR_STORE_U32(&g_pooled_allocator_depot.hasBlocks, 1U);
+
+    pooled_allocator_fold_stats(&g_pooled_allocator_depot.retired, cache);
+    if (cache->previous != ZR_NULL) {
+        cache->previous->next = cache->next;
+    } else {
+        g_pooled_allocator_depot.caches = cache->next;
+    }
+    if (cache->next != ZR_NULL) {
+        cache->next->previous = cache->previous;
+    }
+    pooled_allocator_unlock();
+
+    if (g_pooled_allocator_cache == cache) {
+        g_pooled_allocator_cache = ZR_NULL;
+    }
+    free(cache);
+}
+
+static void pooled_allocator_build_lookup(void) {
+    TZrUInt32 granule;
+    TZrUInt32 sizeClass = 0;
+
+    for (granule = 0; granule < ZR_POOLED_ALLOCATOR_LOOKUP_LENGTH; granule++) {
+        TZrUInt32 size = granule << ZR_POOLED_ALLOCATOR_GRANULE_SHIFT;
+
+        while (g_pooled_allocator_class_sizes[sizeClass] < size) {
+            sizeClass++;
+        }
+        g_pooled_allocator_class_lookup[granule] = (TZrUInt8)sizeClass;
+    }
+}
+
+#if defined(_WIN32)
+static VOID WINAPI pooled_allocator_fls_release(PVOID value) {
+    pooled_allocator_release_cache(value);
+}
+
+static BOOL CALLBACK pooled_allocator_init_once(PINIT_ONCE once, PVOID parameter, PVOID *context) {
+    ZR_UNUSED_PARAMETER(once);
+    ZR_UNUSED_PARAMETER(parameter);
+    ZR_UNUSED_PARAMETER(context);
+    pooled_allocator_build_lookup();
+    g_pooled_allocator_fls = FlsAlloc(pooled_allocator_fls_release);
+    return TRUE;
+}
+#else
+static void pooled_allocator_init_once(void) {
+    pooled_allocator_build_lookup();
+    g_pooled_allocator_key_ready = pthread_key_create(&g_pooled_allocator_key, pooled_allocator_release_cache) == 0;
+}
+#endif
+
+static void pooled_allocator_ensure_initialized(void) {
+#if defined(_WIN32)
+    InitOnceExecuteOnce(&g_pooled_allocator_once, pooled_allocator_init_once, ZR_NULL, ZR_NULL);
+#else
+    pthread_once(&g_pooled_allocator_once, pooled_allocator_init_once);
+#endif
+}
+
+static SZrPooledAllocatorCache *pooled_allocator_create_cache(void) {
+    SZrPooledAllocatorCache *cache;
+
+    pooled_allocator_ensure_initialized();
+    cache = (SZrPooledAllocatorCache *)calloc(1, sizeof(*cache));
+    if (cache == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    // without a thread-exit hook the cache would be lost with its thread, so it is only published once
+    // the hook is registered.
+#if defined(_WIN32)
+    if (g_pooled_allocator_fls == FLS_OUT_OF_INDEXES || !FlsSetValue(g_pooled_allocator_fls, cache)) {
+        free(cache);
+        return ZR_NULL;
+    }
+#else
+    if (!g_pooled_allocator_key_ready || pthread_setspecific(g_pooled_allocator_key, cache) != 0) {
+        free(cache);
+        return ZR_NULL;
+    }
+#endif
+
+    pooled_allocator_lock();
+    cache->next = g_pooled_allocator_depot.caches;
+    if (cache->next != ZR_NULL) {
+        cache->next->previous = cache;
+    }
+    g_pooled_allocator_depot.caches = cache;
+    pooled_allocator_unlock();
+
+    g_pooled_allocator_cache = cache;
+    return cache;
+}
+
+static ZR_FORCE_INLINE SZrPooledAllocatorCache *pooled_allocator_current_cache(void) {
+    SZrPooledAllocatorCache *cache = g_pooled_allocator_cache;
+
+    return cache != ZR_NULL ? cache : pooled_allocator_create_cache();
+}
+
+static TZrBool pooled_allocator_type_prefers_system(TZrInt64 flag) {
+    // buffers that grow by realloc would just hop size classes; libc can often extend them in place.
+    switch (flag) {
+        case ZR_MEMORY_NATIVE_TYPE_STACK:
+        case ZR_MEMORY_NATIVE_TYPE_HASH_BUCKET:
+        case ZR_MEMORY_NATIVE_TYPE_ARRAY:
+        case ZR_MEMORY_NATIVE_TYPE_FILE_BUFFER:
+        case ZR_MEMORY_NATIVE_TYPE_IO:
+        case ZR_MEMORY_NATIVE_TYPE_JIT_CODE:
+            return ZR_TRUE;
+        default:
+            return ZR_FALSE;
+    }
+}
+
+// moves the depot's blocks for sizeClass (and one spare bump region) into the cache.
+static TZrBool pooled_allocator_refill_from_depot(SZrPooledAllocatorCache *cache, TZrUInt32 sizeClass) {
+    TZrBool refilled = ZR_FALSE;
+
+    if (ZR_POOLED_ALLOCATOR_LOAD_U32(&g_pooled_allocator_depot.hasBlocks) == 0U) {
+        return ZR_FALSE;
+    }
+
+    pooled_allocator_lock();
+    if (g_pooled_allocator_depot.freeLists[sizeClass] != ZR_NULL) {
+        cache->freeLists[sizeClass] = g_pooled_allocator_depot.freeLists[sizeClass];
+        g_pooled_allocator_depot.freeLists[sizeClass] = ZR_NULL;
+        refilled = ZR_TRUE;
+    } else if (g_pooled_allocator_depot.spareRegions != ZR_NULL) {
+        SZrPooledAllocatorSpareRegion *region = g_pooled_allocator_depot.spareRegions;
+
+        g_pooled_allocator_depot.spareRegions = region->next;
+        cache->bumpCursor = (TZrBytePtr)region;
+        cache->bumpLimit = region->limit;
+        refilled = ZR_TRUE;
+    }
+    if (!refilled) {
+        TZrSize index;
+        TZrBool empty = g_pooled_allocator_depot.spareRegions == ZR_NULL;
+
+        for (index = 0; empty && index < ZR_POOLED_ALLOCATOR_CLASS_COUNT; index++) {
+            empty = g_pooled_allocator_depot.freeLists[index] == ZR_NULL;
+        }
+        if (empty) {
+            ZR_POOLED_ALLOCATOR_STORE_U32(&g_pooled_allocator_depot.hasBlocks, 0U);
+        }
+    }
+    pooled_allocator_unlock();
+    return refilled;
+}
+
+static TZrPtr pooled_allocator_allocate_small(SZrPooledAllocatorCache *cache, TZrSize size) {
+    TZrUInt32 sizeClass =
+            g_pooled_allocator_class_lookup[(size + (1U << ZR_POOLED_ALLOCATOR_GRANULE_SHIFT) - 1U) >>
+                                            ZR_POOLED_ALLOCATOR_GRANULE_SHIFT];
+    TZrSize blockSize = ZR_POOLED_ALLOCATOR_HEADER_SIZE + g_pooled_allocator_class_sizes[sizeClass];
+    SZrPooledAllocatorHeader *header;
+    SZrPooledAllocatorFreeBlock *block = cache->freeLists[sizeClass];
+
+    if (block != ZR_NULL) {
+        cache->freeLists[sizeClass] = block->next;
+        header = (SZrPooledAllocatorHeader *)((TZrBytePtr)block - ZR_POOLED_ALLOCATOR_HEADER_SIZE);
+    } else {
+        if ((TZrSize)(cache->bumpLimit - cache->bumpCursor) < blockSize) {
+            if (pooled_allocator_refill_from_depot(cache, sizeClass) &&
+                cache->freeLists[sizeClass] != ZR_NULL) {
+                return pooled_allocator_allocate_small(cache, size);
+            }
+        }
+        if ((TZrSize)(cache->bumpLimit - cache->bumpCursor) < blockSize) {
+            TZrBytePtr chunk = (TZrBytePtr)malloc(ZR_LIBRARY_POOLED_ALLOCATOR_CHUNK_SIZE);
+
+            if (chunk == ZR_NULL) {
+                return ZR_NULL;
+            }
+            // the tail of the previous chunk is dropped; it is smaller than this block.
+            cache->bumpCursor = chunk;
+            cache->bumpLimit = chunk + ZR_LIBRARY_POOLED_ALLOCATOR_CHUNK_SIZE;
+            ZR_POOLED_ALLOCATOR_COUNTER_ADD(&cache->reservedChunkBytes, ZR_LIBRARY_POOLED_ALLOCATOR_CHUNK_SIZE);
+        }
+        header = (SZrPooledAllocatorHeader *)cache->bumpCursor;
+        cache->bumpCursor += blockSize;
+    }
+
+    header->sizeClass = sizeClass;
+    ZR_POOLED_ALLOCATOR_COUNTER_ADD(&cache->pooledAllocations, 1U);
+    return (TZrBytePtr)header + ZR_POOLED_ALLOCATOR_HEADER_SIZE;
+}
+
+static TZrPtr pooled_allocator_allocate_system(SZrPooledAllocatorCache *cache, TZrSize size) {
+    SZrPooledAllocatorHeader *header;
+
+    if (size > SIZE_MAX - ZR_POOLED_ALLOCATOR_HEADER_SIZE) {
+        return ZR_NULL;
+    }
+    header = (SZrPooledAllocatorHeader *)malloc(ZR_POOLED_ALLOCATOR_HEADER_SIZE + size);
+    if (header == ZR_NULL) {
+        return ZR_NULL;
+    }
+    header->sizeClass = ZR_POOLED_ALLOCATOR_SYSTEM_CLASS;
+    ZR_POOLED_ALLOCATOR_COUNTER_ADD(&cache->systemAllocations, 1U);
+    return (TZrBytePtr)header + ZR_POOLED_ALLOCATOR_HEADER_SIZE;
+}
+
+static TZrPtr pooled_allocator_allocate(SZrPooledAllocatorCache *cache, TZrSize size, TZrInt64 flag) {
+    if (size <= ZR_LIBRARY_POOLED_ALLOCATOR_MAX_SMALL_SIZE && !pooled_allocator_type_prefers_system(flag)) {
+        return pooled_allocator_allocate_small(cache, size);
+    }
+    return pooled_allocator_allocate_system(cache, size);
+}
+
+static void pooled_allocator_free(SZrPooledAllocatorCache *cache, TZrPtr pointer) {
+    SZrPooledAllocatorHeader *header =
+            (SZrPooledAllocatorHeader *)((TZrBytePtr)pointer - ZR_POOLED_ALLOCATOR_HEADER_SIZE);
+    SZrPooledAllocatorFreeBlock *block;
+
+    if (header->sizeClass == ZR_POOLED_ALLOCATOR_SYSTEM_CLASS) {
+        free(header);
+        return;
+    }
+
+    ZR_ASSERT(header->sizeClass < ZR_POOLED_ALLOCATOR_CLASS_COUNT);
+    // the block joins the freeing thread's list; blocks migrate between threads and are never unmapped.
+    block = (SZrPooledAllocatorFreeBlock *)pointer;
+    block->next = cache->freeLists[header->sizeClass];
+    cache->freeLists[header->sizeClass] = block;
+}
+
+static TZrPtr pooled_allocator_reallocate(SZrPooledAllocatorCache *cache, TZrPtr pointer, TZrSize newSize,
+                                          TZrInt64 flag) {
+    SZrPooledAllocatorHeader *header =
+            (SZrPooledAllocatorHeader *)((TZrBytePtr)pointer - ZR_POOLED_ALLOCATOR_HEADER_SIZE);
+    TZrSize oldCapacity;
+    TZrPtr result;
+
+    if (header->sizeClass == ZR_POOLED_ALLOCATOR_SYSTEM_CLASS) {
+        // system blocks stay with libc; their old length is not recorded, so they never move into a class.
+        SZrPooledAllocatorHeader *resized;
+
+        if (newSize > SIZE_MAX - ZR_POOLED_ALLOCATOR_HEADER_SIZE) {
+            return ZR_NULL;
+        }
+        resized = (SZrPooledAllocatorHeader *)realloc(header, ZR_POOLED_ALLOCATOR_HEADER_SIZE + newSize);
+        return resized != ZR_NULL ? (TZrBytePtr)resized + ZR_POOLED_ALLOCATOR_HEADER_SIZE : ZR_NULL;
+    }
+
+    oldCapacity = g_pooled_allocator_class_sizes[header->sizeClass];
+    if (newSize <= oldCapacity && newSize > oldCapacity / 2U) {
+        return pointer;
+    }
+
+    result = pooled_allocator_allocate(cache, newSize, flag);
+    if (result == ZR_NULL) {
+        return ZR_NULL;
+    }
+    memcpy(result, pointer, oldCapacity < newSize ? oldCapacity : newSize);
+    pooled_allocator_free(cache, pointer);
+    return result;
+}
+
+TZrPtr ZrLibrary_PooledAllocator_Allocate(TZrPtr userData, TZrPtr pointer, TZrSize originalSize, TZrSize newSize,
+                                          TZrInt64 flag) {
+    SZrPooledAllocatorCache *cache;
+    TZrBool canReleasePointer;
+    TZrBool trackCounter;
+    TZrPtr result;
+
+    ZR_UNUSED_PARAMETER(userData);
+    ZR_UNUSED_PARAMETER(originalSize);
+    cache = pooled_allocator_current_cache();
+    if (cache == ZR_NULL) {
+        return ZR_NULL;
+    }
+    canReleasePointer = pointer != ZR_NULL &&
+                        (uintptr_t)pointer >= (uintptr_t)ZR_RUNTIME_INVALID_POINTER_GUARD_LOW_BOUND;
+    trackCounter = flag >= 0 && flag < ZR_MEMORY_NATIVE_TYPE_ENUM_MAX;
+    if (newSize == 0) {
+        if (canReleasePointer) {
+            if (trackCounter) {
+                ZR_POOLED_ALLOCATOR_COUNTER_ADD(&cache->liveAllocations[flag], -1);
+            }
+            pooled_allocator_free(cache, pointer);
+        }
+        return ZR_NULL;
+    }
+    if (pointer == ZR_NULL || !canReleasePointer) {
+        result = pooled_allocator_allocate(cache, newSize, flag);
+        if (result != ZR_NULL && trackCounter) {
+            ZR_POOLED_ALLOCATOR_COUNTER_ADD(&cache->liveAllocations[flag], 1);
+        }
+        return result;
+    }
+    return pooled_allocator_reallocate(cache, pointer, newSize, flag);
+}
+
+void ZrLibrary_PooledAllocator_GetStats(SZrLibrary_PooledAllocatorStats *outStats) {
+    SZrPooledAllocatorCache *cache;
+
+    if (outStats == ZR_NULL) {
+        return;
+    }
+
+    pooled_allocator_lock();
+    *outStats = g_pooled_allocator_depot.retired;
+    for (cache = g_pooled_allocator_depot.caches; cache != ZR_NULL; cache = cache->next) {
+        pooled_allocator_fold_stats(outStats, cache);
+    }
+    pooled_allocator_unlock();
+}
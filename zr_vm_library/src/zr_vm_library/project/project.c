@@ -1824,7 +1824,13 @@ static TZrBool library_project_resolve_binary_path(const SZrLibrary_Project *pro
 }
 
 static TZrBool library_project_load_resolved_file(SZrState *state, TZrNativeString filePath, TZrBool isBinary, SZrIo *io) {
-    SZrLibrary_File_Reader *reader = ZrLibrary_File_OpenRead(state->global, filePath, isBinary);
+    SZrLibrary_File_Reader *reader;
+
+    if (isBinary) {
+        return ZrLibrary_File_OpenMappedBinaryIo(state, filePath, io);
+    }
+
+    reader = ZrLibrary_File_OpenRead(state->global, filePath, isBinary);
     if (reader == ZR_NULL) {
         return ZR_FALSE;
     }
@@ -2,12 +2,16 @@
 
 #include <string.h>
 
+#include "zr_vm_core/call_info.h"
+#include "zr_vm_core/closure.h"
 #include "zr_vm_core/debug.h"
+#include "zr_vm_core/execution.h"
 #include "zr_vm_core/execution_control.h"
 #include "zr_vm_core/exception.h"
 #include "zr_vm_core/function.h"
 #include "zr_vm_core/module.h"
 #include "zr_vm_core/object.h"
+#include "zr_vm_core/stack.h"
 #include "zr_vm_core/state.h"
 #include "zr_vm_core/string.h"
 #include "zr_vm_core/value.h"
@@ -19,23 +23,50 @@
 #define ZR_ARRAY_COUNT(value) (sizeof(value) / sizeof((value)[0]))
 #endif
 
-typedef struct ZrVmTaskExecuteRequest {
-    const SZrTypeValue *callable;
-    SZrTypeValue result;
-    TZrBool completed;
-} ZrVmTaskExecuteRequest;
+// fixed stack slots of a task coroutine thread
+#define ZR_VM_TASK_COROUTINE_HANDLE_SLOT 1
+#define ZR_VM_TASK_COROUTINE_SCHEDULER_SLOT 2
+#define ZR_VM_TASK_COROUTINE_CALLABLE_SLOT 3
+
+#define ZR_VM_TASK_CONTROL_MAGIC 0x5A525443u
+#define ZR_VM_SCHEDULER_CONTROL_MAGIC 0x5A525343u
+
+struct ZrVmSchedulerControl;
+
+// native state of a zr.task.Task handle, kept in the handle's byte storage so the gc never moves it.
+// every gc reference a live task needs sits on its coroutine stack, so the block holds none of its own.
+typedef struct ZrVmTaskControl {
+    TZrUInt32 magic;
+    EZrVmTaskStatus status;
+    TZrBool started;
+    // null once the task finished
+    SZrState *coroutine;
+    struct ZrVmSchedulerControl *scheduler;
+    // intrusive links: the owner scheduler's ready queue and the waiter list of the awaited task
+    struct ZrVmTaskControl *nextReady;
+    struct ZrVmTaskControl *nextWaiter;
+    struct ZrVmTaskControl *firstWaiter;
+    struct ZrVmTaskControl *lastWaiter;
+} ZrVmTaskControl;
+
+// native state of a zr.coroutine.Scheduler, kept in the scheduler's byte storage
+typedef struct ZrVmSchedulerControl {
+    TZrUInt32 magic;
+    TZrBool autoCoroutine;
+    TZrBool isPumping;
+    ZrVmTaskControl *readyHead;
+    ZrVmTaskControl *readyTail;
+} ZrVmSchedulerControl;
 
 static const TZrChar *kTaskModuleName = "zr.task";
 static const TZrChar *kCoroutineModuleName = "zr.coroutine";
 static const TZrChar *kTaskRootCoroutineSchedulerField = "__zr_coroutine_scheduler";
-static const TZrChar *kTaskQueueField = "__zr_task_queue";
-static const TZrChar *kTaskQueueHeadField = "__zr_task_queue_head";
+static const TZrChar *kTaskResultField = "__zr_task_result";
+static const TZrChar *kTaskErrorField = "__zr_task_error";
+// field protocol of Task handles and schedulers owned by zr.thread
 static const TZrChar *kTaskAutoCoroutineField = "__zr_task_auto_coroutine";
 static const TZrChar *kTaskIsPumpingField = "__zr_task_is_pumping";
 static const TZrChar *kTaskStatusField = "__zr_task_status";
-static const TZrChar *kTaskCallableField = "__zr_task_callable";
-static const TZrChar *kTaskResultField = "__zr_task_result";
-static const TZrChar *kTaskErrorField = "__zr_task_error";
 static const TZrChar *kTaskSchedulerOwnerField = "__zr_task_scheduler_owner";
 static const TZrChar *kTaskRunnerCallableField = "__zr_task_runner_callable";
 static const TZrChar *kTaskRunnerStartedField = "__zr_task_runner_started";
@@ -78,13 +109,6 @@ static void task_runtime_set_value_field(SZrState *state,
     ZrLib_Object_SetFieldCString(state, object, fieldName, value);
 }
 
-static void task_runtime_set_null_field(SZrState *state, SZrObject *object, const TZrChar *fieldName) {
-    SZrTypeValue value;
-
-    ZrLib_Value_SetNull(&value);
-    task_runtime_set_value_field(state, object, fieldName, &value);
-}
-
 static void task_runtime_set_bool_field(SZrState *state, SZrObject *object, const TZrChar *fieldName, TZrBool value) {
     SZrTypeValue fieldValue;
 
@@ -92,13 +116,6 @@ static void task_runtime_set_bool_field(SZrState *state, SZrObject *object, cons
     task_runtime_set_value_field(state, object, fieldName, &fieldValue);
 }
 
-static void task_runtime_set_int_field(SZrState *state, SZrObject *object, const TZrChar *fieldName, TZrInt64 value) {
-    SZrTypeValue fieldValue;
-
-    ZrLib_Value_SetInt(state, &fieldValue, value);
-    task_runtime_set_value_field(state, object, fieldName, &fieldValue);
-}
-
 static const SZrTypeValue *task_runtime_get_field_value(SZrState *state, SZrObject *object, const TZrChar *fieldName) {
     if (state == ZR_NULL || object == ZR_NULL || fieldName == ZR_NULL) {
         return ZR_NULL;
@@ -333,12 +350,67 @@ static SZrObject *task_runtime_new_loaded_module_typed_object(SZrState *state,
     return object;
 }
 
+static ZrVmSchedulerControl *task_runtime_scheduler_control(SZrState *state, SZrObject *scheduler) {
+    ZrVmSchedulerControl *control;
+
+    if (state == ZR_NULL || scheduler == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    if (scheduler->byteStorageLength == sizeof(ZrVmSchedulerControl)) {
+        control = (ZrVmSchedulerControl *)ZrCore_Object_GetByteStorageData(scheduler);
+        return control != ZR_NULL && control->magic == ZR_VM_SCHEDULER_CONTROL_MAGIC ? control : ZR_NULL;
+    }
+
+    // schedulers constructed from script get their control block on first use
+    if (scheduler->byteStorage != ZR_NULL ||
+        !ZrCore_Object_AllocateByteStorage(state, scheduler, sizeof(ZrVmSchedulerControl))) {
+        return ZR_NULL;
+    }
+
+    control = (ZrVmSchedulerControl *)ZrCore_Object_GetByteStorageData(scheduler);
+    control->magic = ZR_VM_SCHEDULER_CONTROL_MAGIC;
+    control->autoCoroutine = task_runtime_default_auto_coroutine(state);
+    control->isPumping = ZR_FALSE;
+    control->readyHead = ZR_NULL;
+    control->readyTail = ZR_NULL;
+    return control;
+}
+
+static ZrVmTaskControl *task_runtime_task_control(SZrObject *handle) {
+    ZrVmTaskControl *control;
+
+    if (handle == ZR_NULL || handle->byteStorageLength != sizeof(ZrVmTaskControl)) {
+        return ZR_NULL;
+    }
+
+    control = (ZrVmTaskControl *)ZrCore_Object_GetByteStorageData(handle);
+    return control != ZR_NULL && control->magic == ZR_VM_TASK_CONTROL_MAGIC ? control : ZR_NULL;
+}
+
+static TZrInt64 task_runtime_task_status(SZrState *state, SZrObject *handle) {
+    ZrVmTaskControl *control = task_runtime_task_control(handle);
+
+    // handles minted by zr.thread still publish their status through the hidden field
+    return control != ZR_NULL ? (TZrInt64)control->status
+                              : task_runtime_get_int_field(state, handle, kTaskStatusField, ZR_VM_TASK_STATUS_CREATED);
+}
+
+static SZrObject *task_runtime_install_coroutine_scheduler(SZrState *state, SZrObject *rootObject, SZrObject *scheduler) {
+    SZrTypeValue schedulerValue;
+
+    if (scheduler == ZR_NULL || task_runtime_scheduler_control(state, scheduler) == ZR_NULL) {
+        return ZR_NULL;
+    }
+
+    ZrLib_Value_SetObject(state, &schedulerValue, scheduler, ZR_VALUE_TYPE_OBJECT);
+    task_runtime_set_value_field(state, rootObject, kTaskRootCoroutineSchedulerField, &schedulerValue);
+    return scheduler;
+}
+
 static SZrObject *task_runtime_ensure_coroutine_scheduler(SZrState *state) {
     SZrObject *rootObject;
     SZrObject *scheduler;
-    SZrObject *queue;
-    SZrTypeValue schedulerValue;
-    SZrTypeValue queueValue;
 
     if (state == ZR_NULL) {
         return ZR_NULL;
@@ -354,28 +426,13 @@ static SZrObject *task_runtime_ensure_coroutine_scheduler(SZrState *state) {
         return scheduler;
     }
 
-    scheduler = task_runtime_new_module_typed_object(state, kCoroutineModuleName, "Scheduler");
-    queue = ZrLib_Array_New(state);
-    if (scheduler == ZR_NULL || queue == ZR_NULL) {
-        return ZR_NULL;
-    }
-
-    ZrLib_Value_SetObject(state, &schedulerValue, scheduler, ZR_VALUE_TYPE_OBJECT);
-    ZrLib_Value_SetObject(state, &queueValue, queue, ZR_VALUE_TYPE_ARRAY);
-    task_runtime_set_value_field(state, rootObject, kTaskRootCoroutineSchedulerField, &schedulerValue);
-    task_runtime_set_value_field(state, scheduler, kTaskQueueField, &queueValue);
-    task_runtime_set_int_field(state, scheduler, kTaskQueueHeadField, 0);
-    task_runtime_set_bool_field(state, scheduler, kTaskAutoCoroutineField, task_runtime_default_auto_coroutine(state));
-    task_runtime_set_bool_field(state, scheduler, kTaskIsPumpingField, ZR_FALSE);
-    return scheduler;
+    return task_runtime_install_coroutine_scheduler(
+            state, rootObject, task_runtime_new_module_typed_object(state, kCoroutineModuleName, "Scheduler"));
 }
 
 static SZrObject *task_runtime_ensure_coroutine_scheduler_for_module(SZrState *state, SZrObjectModule *module) {
     SZrObject *rootObject;
     SZrObject *scheduler;
-    SZrObject *queue;
-    SZrTypeValue schedulerValue;
-    SZrTypeValue queueValue;
 
     if (state == ZR_NULL || module == ZR_NULL) {
         return ZR_NULL;
@@ -391,57 +448,99 @@ static SZrObject *task_runtime_ensure_coroutine_scheduler_for_module(SZrState *s
         return scheduler;
     }
 
-    scheduler = task_runtime_new_loaded_module_typed_object(state, module, "Scheduler");
-    queue = ZrLib_Array_New(state);
-    if (scheduler == ZR_NULL || queue == ZR_NULL) {
+    return task_runtime_install_coroutine_scheduler(
+            state, rootObject, task_runtime_new_loaded_module_typed_object(state, module, "Scheduler"));
+}
+
+static void task_runtime_ready_push(ZrVmSchedulerControl *scheduler, ZrVmTaskControl *task) {
+    task->nextReady = ZR_NULL;
+    task->status = ZR_VM_TASK_STATUS_QUEUED;
+    if (scheduler->readyTail != ZR_NULL) {
+        scheduler->readyTail->nextReady = task;
+    } else {
+        scheduler->readyHead = task;
+    }
+    scheduler->readyTail = task;
+}
+
+static ZrVmTaskControl *task_runtime_ready_pop(ZrVmSchedulerControl *scheduler) {
+    ZrVmTaskControl *task = scheduler->readyHead;
+
+    if (task == ZR_NULL) {
         return ZR_NULL;
     }
 
-    ZrLib_Value_SetObject(state, &schedulerValue, scheduler, ZR_VALUE_TYPE_OBJECT);
-    ZrLib_Value_SetObject(state, &queueValue, queue, ZR_VALUE_TYPE_ARRAY);
-    task_runtime_set_value_field(state, rootObject, kTaskRootCoroutineSchedulerField, &schedulerValue);
-    task_runtime_set_value_field(state, scheduler, kTaskQueueField, &queueValue);
-    task_runtime_set_int_field(state, scheduler, kTaskQueueHeadField, 0);
-    task_runtime_set_bool_field(state, scheduler, kTaskAutoCoroutineField, task_runtime_default_auto_coroutine(state));
-    task_runtime_set_bool_field(state, scheduler, kTaskIsPumpingField, ZR_FALSE);
-    return scheduler;
+    scheduler->readyHead = task->nextReady;
+    if (scheduler->readyHead == ZR_NULL) {
+        scheduler->readyTail = ZR_NULL;
+    }
+    task->nextReady = ZR_NULL;
+    return task;
+}
+
+static void task_runtime_coroutine_start_body(SZrState *state, TZrPtr arguments) {
+    ZR_UNUSED_PARAMETER(arguments);
+    ZrCore_Function_Call(state, state->stackBase.valuePointer + ZR_VM_TASK_COROUTINE_CALLABLE_SLOT, 1);
 }
 
-static SZrObject *task_runtime_scheduler_queue(SZrState *state, SZrObject *scheduler) {
-    SZrObject *queue = task_runtime_get_object_field(state, scheduler, kTaskQueueField);
-    SZrTypeValue queueValue;
+static void task_runtime_coroutine_resume_body(SZrState *state, TZrPtr arguments) {
+    ZR_UNUSED_PARAMETER(arguments);
+    // the suspended frame rewound its program counter, so execution re-enters the pending await call
+    state->nestedNativeCalls++;
+    ZrCore_Execute(state, state->callInfoList);
+    state->nestedNativeCalls--;
+}
 
-    if (queue != ZR_NULL && queue->internalType == ZR_OBJECT_INTERNAL_TYPE_ARRAY) {
-        return queue;
+static SZrObject *task_runtime_coroutine_handle(SZrState *coroutine) {
+    const SZrTypeValue *value;
+
+    if (coroutine == ZR_NULL || !coroutine->isCoroutine) {
+        return ZR_NULL;
     }
 
-    queue = ZrLib_Array_New(state);
-    if (queue == ZR_NULL) {
+    value = ZrCore_Stack_GetValue(coroutine->stackBase.valuePointer + ZR_VM_TASK_COROUTINE_HANDLE_SLOT);
+    if (value == ZR_NULL || value->type != ZR_VALUE_TYPE_OBJECT || value->value.object == ZR_NULL) {
         return ZR_NULL;
     }
 
-    ZrLib_Value_SetObject(state, &queueValue, queue, ZR_VALUE_TYPE_ARRAY);
-    task_runtime_set_value_field(state, scheduler, kTaskQueueField, &queueValue);
-    return queue;
+    return ZR_CAST_OBJECT(coroutine, value->value.object);
 }
 
-static void task_runtime_execute_callable_body(SZrState *state, TZrPtr arguments) {
-    ZrVmTaskExecuteRequest *request = (ZrVmTaskExecuteRequest *)arguments;
+static void task_runtime_release_task_coroutine(ZrVmTaskControl *control) {
+    SZrState *coroutine = control->coroutine;
 
-    if (request == ZR_NULL || request->callable == ZR_NULL) {
-        return;
+    // the coroutine stack was what kept the owner scheduler alive
+    control->coroutine = ZR_NULL;
+    control->scheduler = ZR_NULL;
+    if (coroutine != ZR_NULL) {
+        ZrCore_State_FreeCoroutine(coroutine);
     }
+}
+
+static void task_runtime_wake_waiters(ZrVmTaskControl *control) {
+    ZrVmTaskControl *waiter = control->firstWaiter;
 
-    request->completed = ZrLib_CallValue(state, request->callable, ZR_NULL, ZR_NULL, 0, &request->result);
+    control->firstWaiter = ZR_NULL;
+    control->lastWaiter = ZR_NULL;
+    while (waiter != ZR_NULL) {
+        ZrVmTaskControl *next = waiter->nextWaiter;
+
+        waiter->nextWaiter = ZR_NULL;
+        if (waiter->status == ZR_VM_TASK_STATUS_SUSPENDED && waiter->scheduler != ZR_NULL) {
+            task_runtime_ready_push(waiter->scheduler, waiter);
+        }
+        waiter = next;
+    }
 }
 
 static TZrBool task_runtime_handle_mark_faulted(SZrState *state,
                                                 SZrObject *handle,
+                                                ZrVmTaskControl *control,
                                                 EZrThreadStatus status,
                                                 const SZrTypeValue *fallbackError) {
     SZrTypeValue errorValue;
 
-    if (state == ZR_NULL || handle == ZR_NULL) {
+    if (state == ZR_NULL || handle == ZR_NULL || control == ZR_NULL) {
         return ZR_FALSE;
     }
 
@@ -460,199 +559,161 @@ static TZrBool task_runtime_handle_mark_faulted(SZrState *state,
     }
 
     task_runtime_set_value_field(state, handle, kTaskErrorField, &errorValue);
-    task_runtime_set_null_field(state, handle, kTaskResultField);
-    task_runtime_set_null_field(state, handle, kTaskCallableField);
-    task_runtime_set_int_field(state, handle, kTaskStatusField, ZR_VM_TASK_STATUS_FAULTED);
+    control->status = ZR_VM_TASK_STATUS_FAULTED;
     execution_clear_pending_control(state);
     ZrCore_Exception_ClearCurrent(state);
     state->threadStatus = ZR_THREAD_STATUS_FINE;
     return ZR_TRUE;
 }
 
-static TZrBool task_runtime_execute_task(SZrState *state, SZrObject *handle) {
-    const SZrTypeValue *callable;
-    ZrVmTaskExecuteRequest request;
+static TZrBool task_runtime_execute_task(SZrState *state, ZrVmTaskControl *control) {
+    SZrState *coroutine = control->coroutine;
+    SZrObject *handle;
+    FZrTryFunction body;
     EZrThreadStatus status;
-    SZrTypeValue errorValue;
-    SZrCallInfo *savedCallInfo;
-    SZrFunctionStackAnchor savedStackTopAnchor;
-    SZrFunctionStackAnchor savedCallInfoBaseAnchor;
-    SZrFunctionStackAnchor savedCallInfoTopAnchor;
-    SZrFunctionStackAnchor savedCallInfoReturnAnchor;
-    TZrBool hasSavedCallInfoBase = ZR_FALSE;
-    TZrBool hasSavedCallInfoTop = ZR_FALSE;
-    TZrBool hasSavedCallInfoReturn = ZR_FALSE;
-    TZrUInt32 savedExceptionHandlerStackLength;
-
-    if (state == ZR_NULL || handle == ZR_NULL) {
+    SZrTypeValue resultValue;
+
+    if (coroutine == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    callable = task_runtime_get_field_value(state, handle, kTaskCallableField);
-    if (callable == ZR_NULL) {
-        ZrLib_Value_SetString(state, &errorValue, "Task callable is missing");
-        return task_runtime_handle_mark_faulted(state, handle, ZR_THREAD_STATUS_RUNTIME_ERROR, &errorValue);
-    }
-
-    task_runtime_set_int_field(state, handle, kTaskStatusField, ZR_VM_TASK_STATUS_RUNNING);
-    ZrLib_Value_SetNull(&request.result);
-    request.callable = callable;
-    request.completed = ZR_FALSE;
-    savedCallInfo = state->callInfoList;
-    savedExceptionHandlerStackLength = state->exceptionHandlerStackLength;
-    ZrCore_Function_StackAnchorInit(state, state->stackTop.valuePointer, &savedStackTopAnchor);
-    if (savedCallInfo != ZR_NULL && savedCallInfo->functionBase.valuePointer != ZR_NULL) {
-        ZrCore_Function_StackAnchorInit(state, savedCallInfo->functionBase.valuePointer, &savedCallInfoBaseAnchor);
-        hasSavedCallInfoBase = ZR_TRUE;
-    }
-    if (savedCallInfo != ZR_NULL && savedCallInfo->functionTop.valuePointer != ZR_NULL) {
-        ZrCore_Function_StackAnchorInit(state, savedCallInfo->functionTop.valuePointer, &savedCallInfoTopAnchor);
-        hasSavedCallInfoTop = ZR_TRUE;
-    }
-    if (savedCallInfo != ZR_NULL && savedCallInfo->hasReturnDestination && savedCallInfo->returnDestination != ZR_NULL) {
-        ZrCore_Function_StackAnchorInit(state, savedCallInfo->returnDestination, &savedCallInfoReturnAnchor);
-        hasSavedCallInfoReturn = ZR_TRUE;
-    }
-
-    status = ZrCore_Exception_TryRun(state, task_runtime_execute_callable_body, &request);
-    state->stackTop.valuePointer = ZrCore_Function_StackAnchorRestore(state, &savedStackTopAnchor);
-    if (savedCallInfo != ZR_NULL) {
-        state->callInfoList = savedCallInfo;
-        if (hasSavedCallInfoBase) {
-            savedCallInfo->functionBase.valuePointer = ZrCore_Function_StackAnchorRestore(state, &savedCallInfoBaseAnchor);
-        }
-        if (hasSavedCallInfoTop) {
-            savedCallInfo->functionTop.valuePointer = ZrCore_Function_StackAnchorRestore(state, &savedCallInfoTopAnchor);
-        }
-        if (hasSavedCallInfoReturn) {
-            savedCallInfo->returnDestination = ZrCore_Function_StackAnchorRestore(state, &savedCallInfoReturnAnchor);
-        }
+    body = control->started ? task_runtime_coroutine_resume_body : task_runtime_coroutine_start_body;
+    control->started = ZR_TRUE;
+    control->status = ZR_VM_TASK_STATUS_RUNNING;
+    status = ZrCore_Exception_TryRun(coroutine, body, ZR_NULL);
+    // the coroutine stack roots the handle, so reload it after the task body ran
+    handle = task_runtime_coroutine_handle(coroutine);
+    if (handle == ZR_NULL) {
+        return ZR_FALSE;
     }
-    state->exceptionHandlerStackLength = savedExceptionHandlerStackLength;
-    if (status == ZR_THREAD_STATUS_FINE && request.completed && state->threadStatus == ZR_THREAD_STATUS_FINE) {
-        task_runtime_set_value_field(state, handle, kTaskResultField, &request.result);
-        task_runtime_set_null_field(state, handle, kTaskErrorField);
-        task_runtime_set_null_field(state, handle, kTaskCallableField);
-        task_runtime_set_int_field(state, handle, kTaskStatusField, ZR_VM_TASK_STATUS_COMPLETED);
+
+    if (status == ZR_THREAD_STATUS_YIELD) {
+        // await parked the frame and already registered this task as a waiter
+        coroutine->threadStatus = ZR_THREAD_STATUS_FINE;
         return ZR_TRUE;
     }
 
-    if (status == ZR_THREAD_STATUS_FINE) {
-        status = state->threadStatus != ZR_THREAD_STATUS_FINE ? state->threadStatus : ZR_THREAD_STATUS_RUNTIME_ERROR;
+    if (status == ZR_THREAD_STATUS_FINE && coroutine->threadStatus == ZR_THREAD_STATUS_FINE) {
+        ZrLib_Value_SetNull(&resultValue);
+        ZrCore_Value_Copy(state,
+                          &resultValue,
+                          ZrCore_Stack_GetValue(coroutine->stackBase.valuePointer + ZR_VM_TASK_COROUTINE_CALLABLE_SLOT));
+        task_runtime_set_value_field(state, handle, kTaskResultField, &resultValue);
+        control->status = ZR_VM_TASK_STATUS_COMPLETED;
+    } else {
+        if (status == ZR_THREAD_STATUS_FINE) {
+            status = coroutine->threadStatus != ZR_THREAD_STATUS_FINE ? coroutine->threadStatus
+                                                                      : ZR_THREAD_STATUS_RUNTIME_ERROR;
+        }
+        task_runtime_handle_mark_faulted(coroutine, handle, control, status, ZR_NULL);
     }
-    return task_runtime_handle_mark_faulted(state, handle, status, request.completed ? &request.result : ZR_NULL);
+
+    task_runtime_release_task_coroutine(control);
+    task_runtime_wake_waiters(control);
+    return ZR_TRUE;
 }
 
-static TZrBool task_runtime_scheduler_step_internal(SZrState *state, SZrObject *scheduler) {
-    SZrObject *queue;
-    TZrInt64 head;
-    const SZrTypeValue *queuedValue;
+static TZrBool task_runtime_scheduler_step_internal(SZrState *state, ZrVmSchedulerControl *scheduler) {
+    ZrVmTaskControl *task;
 
     if (state == ZR_NULL || scheduler == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    queue = task_runtime_scheduler_queue(state, scheduler);
-    if (queue == ZR_NULL) {
-        return ZR_FALSE;
-    }
-
-    head = task_runtime_get_int_field(state, scheduler, kTaskQueueHeadField, 0);
-    if (head < 0) {
-        head = 0;
-    }
-
-    queuedValue = ZrLib_Array_Get(state, queue, (TZrSize)head);
-    if (queuedValue == ZR_NULL) {
-        task_runtime_set_int_field(state, scheduler, kTaskQueueHeadField, 0);
-        return ZR_FALSE;
-    }
-
-    task_runtime_set_int_field(state, scheduler, kTaskQueueHeadField, head + 1);
-    if ((queuedValue->type != ZR_VALUE_TYPE_OBJECT && queuedValue->type != ZR_VALUE_TYPE_ARRAY) ||
-        queuedValue->value.object == ZR_NULL) {
-        return ZR_TRUE;
-    }
-
-    return task_runtime_execute_task(state, ZR_CAST_OBJECT(state, queuedValue->value.object));
+    task = task_runtime_ready_pop(scheduler);
+    return task != ZR_NULL && task_runtime_execute_task(state, task);
 }
 
-static TZrInt64 task_runtime_scheduler_pump_internal(SZrState *state, SZrObject *scheduler) {
+static TZrInt64 task_runtime_scheduler_pump_internal(SZrState *state, ZrVmSchedulerControl *scheduler) {
     TZrInt64 executed = 0;
 
-    if (state == ZR_NULL || scheduler == ZR_NULL) {
+    if (state == ZR_NULL || scheduler == ZR_NULL || scheduler->isPumping) {
         return 0;
     }
 
-    if (task_runtime_get_bool_field(state, scheduler, kTaskIsPumpingField, ZR_FALSE)) {
-        return 0;
-    }
-
-    task_runtime_set_bool_field(state, scheduler, kTaskIsPumpingField, ZR_TRUE);
+    scheduler->isPumping = ZR_TRUE;
     while (task_runtime_scheduler_step_internal(state, scheduler)) {
         executed++;
     }
-    task_runtime_set_bool_field(state, scheduler, kTaskIsPumpingField, ZR_FALSE);
+    scheduler->isPumping = ZR_FALSE;
     return executed;
 }
 
 static TZrBool task_runtime_create_task_handle(SZrState *state,
                                                SZrObject *scheduler,
+                                               ZrVmSchedulerControl *schedulerControl,
                                                const SZrTypeValue *callable,
                                                SZrTypeValue *result) {
     SZrObject *handle;
-    SZrTypeValue schedulerValue;
+    ZrVmTaskControl *control;
+    SZrState *coroutine;
+    TZrStackValuePointer base;
 
-    if (state == ZR_NULL || scheduler == ZR_NULL || callable == ZR_NULL || result == ZR_NULL) {
+    if (state == ZR_NULL || scheduler == ZR_NULL || schedulerControl == ZR_NULL || callable == ZR_NULL ||
+        result == ZR_NULL) {
         return ZR_FALSE;
     }
 
     handle = task_runtime_new_module_typed_object(state, kTaskModuleName, "Task");
-    if (handle == ZR_NULL) {
+    if (handle == ZR_NULL || !ZrCore_Object_AllocateByteStorage(state, handle, sizeof(ZrVmTaskControl))) {
         return ZR_FALSE;
     }
 
-    task_runtime_set_int_field(state, handle, kTaskStatusField, ZR_VM_TASK_STATUS_CREATED);
-    task_runtime_set_value_field(state, handle, kTaskCallableField, callable);
-    task_runtime_set_null_field(state, handle, kTaskResultField);
-    task_runtime_set_null_field(state, handle, kTaskErrorField);
-    ZrLib_Value_SetObject(state, &schedulerValue, scheduler, ZR_VALUE_TYPE_OBJECT);
-    task_runtime_set_value_field(state, handle, kTaskSchedulerOwnerField, &schedulerValue);
+    coroutine = ZrCore_State_NewCoroutine(state);
+    if (coroutine == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // slot 0 is the entry frame; the rest keep the handle, its scheduler and the callable alive until it finishes
+    base = coroutine->stackBase.valuePointer;
+    ZrLib_Value_SetObject(coroutine, ZrCore_Stack_GetValue(base + ZR_VM_TASK_COROUTINE_HANDLE_SLOT), handle,
+                          ZR_VALUE_TYPE_OBJECT);
+    ZrLib_Value_SetObject(coroutine, ZrCore_Stack_GetValue(base + ZR_VM_TASK_COROUTINE_SCHEDULER_SLOT), scheduler,
+                          ZR_VALUE_TYPE_OBJECT);
+    ZrCore_Value_Copy(coroutine, ZrCore_Stack_GetValue(base + ZR_VM_TASK_COROUTINE_CALLABLE_SLOT), callable);
+    coroutine->stackTop.valuePointer = base + ZR_VM_TASK_COROUTINE_CALLABLE_SLOT + 1;
+
+    control = (ZrVmTaskControl *)ZrCore_Object_GetByteStorageData(handle);
+    control->magic = ZR_VM_TASK_CONTROL_MAGIC;
+    control->status = ZR_VM_TASK_STATUS_CREATED;
+    control->started = ZR_FALSE;
+    control->coroutine = coroutine;
+    control->scheduler = schedulerControl;
+    control->nextReady = ZR_NULL;
+    control->nextWaiter = ZR_NULL;
+    control->firstWaiter = ZR_NULL;
+    control->lastWaiter = ZR_NULL;
     return task_runtime_finish_object(state, result, handle);
 }
 
-static TZrBool task_runtime_wait_for_task(SZrState *state, SZrObject *handle, SZrTypeValue *result) {
+static TZrBool task_runtime_read_finished_task(SZrState *state,
+                                               SZrObject *handle,
+                                               TZrInt64 status,
+                                               SZrTypeValue *result) {
+    if (status == ZR_VM_TASK_STATUS_FAULTED) {
+        task_runtime_raise_fault(state, task_runtime_get_field_value(state, handle, kTaskErrorField));
+    }
+
+    return task_runtime_copy_value_or_null(state, task_runtime_get_field_value(state, handle, kTaskResultField), result);
+}
+
+static TZrBool task_runtime_wait_for_foreign_task(SZrState *state, SZrObject *handle, SZrTypeValue *result) {
     TZrInt64 status;
     SZrObject *scheduler;
-    TZrBool autoCoroutine;
     TZrBool isPumping;
-    const SZrTypeValue *value;
-
-    if (state == ZR_NULL || handle == ZR_NULL || result == ZR_NULL) {
-        return ZR_FALSE;
-    }
 
     status = task_runtime_get_int_field(state, handle, kTaskStatusField, ZR_VM_TASK_STATUS_CREATED);
-    if (status == ZR_VM_TASK_STATUS_COMPLETED) {
-        value = task_runtime_get_field_value(state, handle, kTaskResultField);
-        return task_runtime_copy_value_or_null(state, value, result);
-    }
-    if (status == ZR_VM_TASK_STATUS_FAULTED) {
-        task_runtime_raise_fault(state, task_runtime_get_field_value(state, handle, kTaskErrorField));
+    if (status == ZR_VM_TASK_STATUS_COMPLETED || status == ZR_VM_TASK_STATUS_FAULTED) {
+        return task_runtime_read_finished_task(state, handle, status, result);
     }
 
     scheduler = task_runtime_get_object_field(state, handle, kTaskSchedulerOwnerField);
-    if (scheduler == ZR_NULL) {
-        scheduler = task_runtime_ensure_coroutine_scheduler(state);
-    }
-    autoCoroutine = scheduler != ZR_NULL && task_runtime_get_bool_field(state, scheduler, kTaskAutoCoroutineField, ZR_TRUE);
     isPumping = scheduler != ZR_NULL && task_runtime_get_bool_field(state, scheduler, kTaskIsPumpingField, ZR_FALSE);
-
-    if (scheduler != ZR_NULL && autoCoroutine) {
+    if (scheduler != ZR_NULL && task_runtime_get_bool_field(state, scheduler, kTaskAutoCoroutineField, ZR_TRUE)) {
         while (ZR_TRUE) {
             status = task_runtime_get_int_field(state, handle, kTaskStatusField, ZR_VM_TASK_STATUS_CREATED);
             if (status == ZR_VM_TASK_STATUS_COMPLETED || status == ZR_VM_TASK_STATUS_FAULTED) {
-                return task_runtime_wait_for_task(state, handle, result);
+                return task_runtime_read_finished_task(state, handle, status, result);
             }
 
             if (!task_runtime_scheduler_invoke_step(state, scheduler)) {
@@ -672,6 +733,46 @@ static TZrBool task_runtime_wait_for_task(SZrState *state, SZrObject *handle, SZ
                           "Task is still pending while autoCoroutine is disabled; call Scheduler.pump() first");
 }
 
+static TZrBool task_runtime_wait_for_task(SZrState *state, SZrObject *handle, SZrTypeValue *result) {
+    ZrVmTaskControl *control;
+    ZrVmSchedulerControl *scheduler;
+    TZrBool isPumping;
+
+    if (state == ZR_NULL || handle == ZR_NULL || result == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    control = task_runtime_task_control(handle);
+    if (control == ZR_NULL) {
+        return task_runtime_wait_for_foreign_task(state, handle, result);
+    }
+
+    scheduler = control->scheduler;
+    isPumping = scheduler != ZR_NULL && scheduler->isPumping;
+    if (scheduler != ZR_NULL && scheduler->autoCoroutine) {
+        // the control block lives outside the gc heap, so it stays valid while other tasks run
+        while (control->status != ZR_VM_TASK_STATUS_COMPLETED && control->status != ZR_VM_TASK_STATUS_FAULTED) {
+            if (!task_runtime_scheduler_step_internal(state, scheduler)) {
+                if (state->threadStatus != ZR_THREAD_STATUS_FINE || state->hasCurrentException) {
+                    return ZR_FALSE;
+                }
+                break;
+            }
+        }
+    }
+
+    if (control->status == ZR_VM_TASK_STATUS_COMPLETED || control->status == ZR_VM_TASK_STATUS_FAULTED) {
+        return task_runtime_read_finished_task(state, handle, control->status, result);
+    }
+
+    if (isPumping) {
+        ZrCore_Debug_RunError(state, "Task is still pending on an active scheduler frame");
+    }
+
+    ZrCore_Debug_RunError(state,
+                          "Task is still pending while autoCoroutine is disabled; call Scheduler.pump() first");
+}
+
 static SZrObject *task_runtime_default_scheduler(SZrState *state) {
     const SZrTypeValue *exportValue;
 
@@ -745,7 +846,8 @@ static TZrBool task_runtime_start_runner_on_scheduler(SZrState *state,
                                                       SZrObject *runner,
                                                       SZrTypeValue *result) {
     const SZrTypeValue *callable;
-    SZrObject *queue;
+    ZrVmSchedulerControl *schedulerControl;
+    ZrVmTaskControl *control;
 
     if (state == ZR_NULL || scheduler == ZR_NULL || runner == ZR_NULL || result == ZR_NULL) {
         return ZR_FALSE;
@@ -760,24 +862,21 @@ static TZrBool task_runtime_start_runner_on_scheduler(SZrState *state,
         return task_runtime_raise_runtime_error(state, "TaskRunner is missing its callable");
     }
 
-    if (!task_runtime_create_task_handle(state, scheduler, callable, result) ||
-        result->type != ZR_VALUE_TYPE_OBJECT || result->value.object == ZR_NULL) {
-        return ZR_FALSE;
+    schedulerControl = task_runtime_scheduler_control(state, scheduler);
+    if (schedulerControl == ZR_NULL) {
+        return task_runtime_raise_runtime_error(state, "Scheduler has no native run queue");
     }
 
-    task_runtime_set_bool_field(state, runner, kTaskRunnerStartedField, ZR_TRUE);
-    queue = task_runtime_scheduler_queue(state, scheduler);
-    if (queue == ZR_NULL || !ZrLib_Array_PushValue(state, queue, result)) {
+    if (!task_runtime_create_task_handle(state, scheduler, schedulerControl, callable, result) ||
+        result->type != ZR_VALUE_TYPE_OBJECT || result->value.object == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    task_runtime_set_int_field(state,
-                               ZR_CAST_OBJECT(state, result->value.object),
-                               kTaskStatusField,
-                               ZR_VM_TASK_STATUS_QUEUED);
-    if (task_runtime_get_bool_field(state, scheduler, kTaskAutoCoroutineField, ZR_TRUE) &&
-        !task_runtime_get_bool_field(state, scheduler, kTaskIsPumpingField, ZR_FALSE)) {
-        task_runtime_scheduler_pump_internal(state, scheduler);
+    task_runtime_set_bool_field(state, runner, kTaskRunnerStartedField, ZR_TRUE);
+    control = task_runtime_task_control(ZR_CAST_OBJECT(state, result->value.object));
+    task_runtime_ready_push(schedulerControl, control);
+    if (schedulerControl->autoCoroutine && !schedulerControl->isPumping) {
+        task_runtime_scheduler_pump_internal(state, schedulerControl);
     }
 
     return ZR_TRUE;
@@ -801,12 +900,70 @@ static TZrBool task_runtime_create_runner(ZrLibCallContext *context, SZrTypeValu
     return task_runtime_finish_object(context->state, result, runner);
 }
 
+static void task_runtime_try_suspend_on_task(SZrState *state, SZrObject *handle) {
+    SZrCallInfo *caller;
+    SZrFunction *function;
+    ZrVmTaskControl *awaited;
+    ZrVmTaskControl *current;
+    const TZrInstruction *programCounter;
+
+    // only a plain VM frame directly entered by the task coroutine can be parked; native re-entry cannot
+    if (!state->isCoroutine || state->nestedNativeCalls != 1 || state->nestedNativeCallYieldFlag != 0 ||
+        state->aotGcRootFrameDepth != 0) {
+        return;
+    }
+
+    // only tasks with a control block wake their waiters; zr.thread handles are awaited synchronously
+    awaited = task_runtime_task_control(handle);
+    current = task_runtime_task_control(task_runtime_coroutine_handle(state));
+    if (awaited == ZR_NULL || current == ZR_NULL || current == awaited || current->coroutine != state) {
+        return;
+    }
+
+    caller = state->callInfoList;
+    if (caller != ZR_NULL && !ZR_CALL_INFO_IS_VM(caller)) {
+        caller = caller->previous;
+    }
+    if (caller == ZR_NULL || caller == &state->baseCallInfo || !ZR_CALL_INFO_IS_VM(caller)) {
+        return;
+    }
+
+    function = ZrCore_Closure_GetMetadataFunctionFromCallInfo(state, caller);
+    programCounter = caller->context.context.programCounter;
+    if (function == ZR_NULL || programCounter == ZR_NULL || programCounter <= function->instructionsList ||
+        programCounter > function->instructionsList + function->instructionsLength) {
+        return;
+    }
+
+    current->nextWaiter = ZR_NULL;
+    if (awaited->lastWaiter != ZR_NULL) {
+        awaited->lastWaiter->nextWaiter = current;
+    } else {
+        awaited->firstWaiter = current;
+    }
+    awaited->lastWaiter = current;
+    current->status = ZR_VM_TASK_STATUS_SUSPENDED;
+
+    // native call sites save pc + 1; stepping back replays the await call once the task is resumed
+    caller->context.context.programCounter = programCounter - 1;
+    state->callInfoList = caller;
+    state->stackTop.valuePointer = caller->functionTop.valuePointer;
+    ZrCore_Exception_Throw(state, ZR_THREAD_STATUS_YIELD);
+}
+
 static TZrBool task_runtime_await_hidden(ZrLibCallContext *context, SZrTypeValue *result) {
     SZrObject *handle;
+    TZrInt64 status;
+
     if (context == ZR_NULL || result == ZR_NULL || !ZrLib_CallContext_ReadObject(context, 0, &handle)) {
         return ZR_FALSE;
     }
 
+    status = task_runtime_task_status(context->state, handle);
+    if (status != ZR_VM_TASK_STATUS_COMPLETED && status != ZR_VM_TASK_STATUS_FAULTED) {
+        // does not return when the current task could be parked
+        task_runtime_try_suspend_on_task(context->state, handle);
+    }
     return task_runtime_wait_for_task(context->state, handle, result);
 }
 
@@ -834,7 +991,7 @@ static TZrBool task_runtime_task_is_completed(ZrLibCallContext *context, SZrType
         return ZR_FALSE;
     }
 
-    status = task_runtime_get_int_field(context->state, self, kTaskStatusField, ZR_VM_TASK_STATUS_CREATED);
+    status = task_runtime_task_status(context->state, self);
     ZrLib_Value_SetBool(context->state,
                         result,
                         (TZrBool)(status == ZR_VM_TASK_STATUS_COMPLETED || status == ZR_VM_TASK_STATUS_FAULTED));
@@ -860,7 +1017,9 @@ static TZrBool task_runtime_scheduler_step_method(ZrLibCallContext *context, SZr
 
     ZrLib_Value_SetBool(context->state,
                         result,
-                        task_runtime_scheduler_step_internal(context->state, task_runtime_self_object(context)));
+                        task_runtime_scheduler_step_internal(
+                                context->state,
+                                task_runtime_scheduler_control(context->state, task_runtime_self_object(context))));
     return ZR_TRUE;
 }
 
@@ -871,34 +1030,39 @@ static TZrBool task_runtime_scheduler_pump_method(ZrLibCallContext *context, SZr
 
     ZrLib_Value_SetInt(context->state,
                        result,
-                       task_runtime_scheduler_pump_internal(context->state, task_runtime_self_object(context)));
+                       task_runtime_scheduler_pump_internal(
+                               context->state,
+                               task_runtime_scheduler_control(context->state, task_runtime_self_object(context))));
     return ZR_TRUE;
 }
 
 static TZrBool task_runtime_scheduler_set_auto_method(ZrLibCallContext *context, SZrTypeValue *result) {
-    SZrObject *self = task_runtime_self_object(context);
+    ZrVmSchedulerControl *control;
     TZrBool autoCoroutine;
 
-    if (self == ZR_NULL || result == ZR_NULL || !ZrLib_CallContext_ReadBool(context, 0, &autoCoroutine)) {
+    if (context == ZR_NULL || result == ZR_NULL || !ZrLib_CallContext_ReadBool(context, 0, &autoCoroutine)) {
+        return ZR_FALSE;
+    }
+
+    control = task_runtime_scheduler_control(context->state, task_runtime_self_object(context));
+    if (control == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    task_runtime_set_bool_field(context->state, self, kTaskAutoCoroutineField, autoCoroutine);
+    control->autoCoroutine = autoCoroutine;
     ZrLib_Value_SetNull(result);
     return ZR_TRUE;
 }
 
 static TZrBool task_runtime_scheduler_get_auto_method(ZrLibCallContext *context, SZrTypeValue *result) {
+    ZrVmSchedulerControl *control;
+
     if (context == ZR_NULL || result == ZR_NULL) {
         return ZR_FALSE;
     }
 
-    ZrLib_Value_SetBool(context->state,
-                        result,
-                        task_runtime_get_bool_field(context->state,
-                                                    task_runtime_self_object(context),
-                                                    kTaskAutoCoroutineField,
-                                                    ZR_TRUE));
+    control = task_runtime_scheduler_control(context->state, task_runtime_self_object(context));
+    ZrLib_Value_SetBool(context->state, result, control == ZR_NULL || control->autoCoroutine);
     return ZR_TRUE;
 }
 
@@ -1033,7 +1197,7 @@ static const ZrLibFunctionDescriptor g_task_functions[] = {
         {"__awaitTask", 1, 1, task_runtime_await_hidden, "T",
          "Internal helper used by %await lowering.", g_await_parameters, ZR_ARRAY_COUNT(g_await_parameters),
          g_task_single_generic_parameter, ZR_ARRAY_COUNT(g_task_single_generic_parameter),
-         ZR_MEMBER_CONTRACT_ROLE_TASK_AWAIT},
+         ZR_MEMBER_CONTRACT_ROLE_TASK_AWAIT, ZR_LIB_NATIVE_DISPATCH_FLAG_STACK_ROOT_CONTEXT},
 };
 
 static const ZrLibFunctionDescriptor g_coroutine_functions[] = {
@@ -1141,6 +1305,30 @@ static const ZrLibModuleDescriptor g_coroutine_descriptor = {
         task_runtime_coroutine_module_materialize,
 };
 
+TZrBool ZrCore_TaskRuntime_YieldCoroutineScheduler(SZrState *state) {
+    SZrObject *rootObject = task_runtime_root_object(state);
+    ZrVmSchedulerControl *scheduler;
+
+    // never materialize a scheduler here: a program that has not started any task has nothing queued.
+    scheduler = rootObject != ZR_NULL
+                        ? task_runtime_scheduler_control(
+                                  state, task_runtime_get_object_field(state, rootObject, kTaskRootCoroutineSchedulerField))
+                        : ZR_NULL;
+    if (scheduler == ZR_NULL || !scheduler->autoCoroutine) {
+        return ZR_FALSE;
+    }
+
+    return task_runtime_scheduler_step_internal(state, scheduler);
+}
+
+EZrVmTaskStatus ZrCore_TaskRuntime_GetTaskStatus(SZrState *state, SZrObject *task) {
+    if (state == ZR_NULL || task == ZR_NULL) {
+        return ZR_VM_TASK_STATUS_CREATED;
+    }
+
+    return (EZrVmTaskStatus)task_runtime_task_status(state, task);
+}
+
 TZrBool ZrCore_TaskRuntime_RegisterBuiltins(SZrGlobalState *global) {
     if (global == ZR_NULL) {
         return ZR_FALSE;
@@ -59,6 +59,11 @@ ZR_PARSER_API TZrBool ZrParser_ConditionalType_Infer(SZrCompilerState *cs, SZrAs
 // 从赋值表达式推断类型
 ZR_PARSER_API TZrBool ZrParser_AssignmentType_Infer(SZrCompilerState *cs, SZrAstNode *node, SZrInferredType *result);
 
+// 识别 StringBuilder 变量的自追加赋值（b += x 或 b = b + x），outAppendedValue 返回被追加的表达式
+ZR_PARSER_API TZrBool ZrParser_AssignmentExpression_IsStringBuilderSelfAppend(SZrCompilerState *cs,
+                                                                            SZrAstNode *node,
+                                                                            SZrAstNode **outAppendedValue);
+
 // 从primary expression推断类型（包括函数调用）
 ZR_PARSER_API TZrBool ZrParser_PrimaryExpressionType_Infer(SZrCompilerState *cs, SZrAstNode *node, SZrInferredType *result);
 
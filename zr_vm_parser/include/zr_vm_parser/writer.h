@@ -75,6 +75,13 @@ ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFileWithOptions(SZrState *state
                                                                  const SZrBinaryWriterOptions *options);
 ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFile(SZrState *state, SZrFunction *function, const TZrChar *filename);
 
+// 将 .zro 二进制写入内存缓冲区（内容与 WriteBinaryFile 相同），缓冲区需用 FreeBinaryBuffer 释放
+ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryBuffer(SZrState *state,
+                                                        SZrFunction *function,
+                                                        TZrByte **outBytes,
+                                                        TZrSize *outLength);
+ZR_PARSER_API void ZrParser_Writer_FreeBinaryBuffer(TZrByte *bytes);
+
 // 将 native helper 函数指针映射为稳定的可序列化 helper id
 ZR_PARSER_API TZrUInt64 ZrParser_Writer_GetSerializableNativeHelperId(FZrNativeFunction function);
 
@@ -148,6 +148,58 @@ static EZrInstructionCode compile_assignment_select_compound_opcode(SZrCompilerS
     return compiler_select_binary_arithmetic_opcode(baseOperator, hasTypeInfo, leftType, leftType, rightType);
 }
 
+// 复合赋值的运算部分；StringBuilder 自追加改为调用 append，在 resultSlot 得到 builder 本身
+static void compile_assignment_emit_compound_operation(SZrCompilerState *cs,
+                                                       EZrInstructionCode opcode,
+                                                       TZrBool appendsToBuilder,
+                                                       TZrUInt32 resultSlot,
+                                                       TZrUInt32 leftSlot,
+                                                       TZrUInt32 rightSlot,
+                                                       SZrFileRange location) {
+    SZrString *appendName;
+    TZrUInt32 memberId;
+    TZrUInt32 receiverSlot;
+    TZrUInt32 argumentSlot;
+
+    if (!appendsToBuilder) {
+        emit_instruction(cs,
+                         create_instruction_2(opcode,
+                                              ZR_COMPILE_SLOT_U16(resultSlot),
+                                              ZR_COMPILE_SLOT_U16(leftSlot),
+                                              ZR_COMPILE_SLOT_U16(rightSlot)));
+        return;
+    }
+
+    appendName = ZrCore_String_CreateFromNative(cs->state, "append");
+    memberId = appendName != ZR_NULL ? compiler_get_or_add_member_entry(cs, appendName) : ZR_PARSER_MEMBER_ID_NONE;
+    if (memberId == ZR_PARSER_MEMBER_ID_NONE) {
+        ZrParser_Compiler_Error(cs, "Failed to register StringBuilder append member", location);
+        return;
+    }
+
+    emit_instruction(cs,
+                     create_instruction_2(ZR_INSTRUCTION_ENUM(GET_MEMBER),
+                                          ZR_COMPILE_SLOT_U16(resultSlot),
+                                          ZR_COMPILE_SLOT_U16(leftSlot),
+                                          (TZrUInt16)memberId));
+    receiverSlot = allocate_stack_slot(cs);
+    emit_instruction(cs,
+                     create_instruction_1(ZR_INSTRUCTION_ENUM(SET_STACK),
+                                          ZR_COMPILE_SLOT_U16(receiverSlot),
+                                          (TZrInt32)leftSlot));
+    argumentSlot = allocate_stack_slot(cs);
+    emit_instruction(cs,
+                     create_instruction_1(ZR_INSTRUCTION_ENUM(SET_STACK),
+                                          ZR_COMPILE_SLOT_U16(argumentSlot),
+                                          (TZrInt32)rightSlot));
+    emit_instruction(cs,
+                     create_instruction_2(ZR_INSTRUCTION_ENUM(FUNCTION_CALL),
+                                          ZR_COMPILE_SLOT_U16(resultSlot),
+                                          ZR_COMPILE_SLOT_U16(resultSlot),
+                                          2));
+    collapse_stack_to_slot(cs, resultSlot);
+}
+
 static void compile_unary_expression(SZrCompilerState *cs, SZrAstNode *node) {
     EZrInstructionCode logicalNotOpcode;
 
@@ -1078,8 +1130,17 @@ static void compile_assignment_expression(SZrCompilerState *cs, SZrAstNode *node
     const TZrChar *op = node->data.assignmentExpression.op.op;
     SZrAstNode *left = node->data.assignmentExpression.left;
     SZrAstNode *right = node->data.assignmentExpression.right;
+    SZrAstNode *appendedValue = ZR_NULL;
+    TZrBool appendsToBuilder = ZR_FALSE;
     memset(&identifierWriteBinding, 0, sizeof(identifierWriteBinding));
 
+    // b = b + x 与 b += x 对 StringBuilder 变量按复合赋值编译为原地 append
+    if (ZrParser_AssignmentExpression_IsStringBuilderSelfAppend(cs, node, &appendedValue)) {
+        appendsToBuilder = ZR_TRUE;
+        op = "+=";
+        right = appendedValue;
+    }
+
     ZrParser_InferredType_Init(cs->state, &leftType, ZR_VALUE_TYPE_OBJECT);
     ZrParser_InferredType_Init(cs->state, &rightType, ZR_VALUE_TYPE_OBJECT);
     if (strcmp(op, "=") == 0) {
@@ -1189,12 +1250,13 @@ static void compile_assignment_expression(SZrCompilerState *cs, SZrAstNode *node
                 emit_instruction(cs, getInst);
                 
                 TZrUInt32 resultSlot = allocate_stack_slot(cs);
-                TZrInstruction opInst = create_instruction_2(
-                        compoundAssignmentOpcode,
-                        ZR_COMPILE_SLOT_U16(resultSlot),
-                        ZR_COMPILE_SLOT_U16(leftSlot),
-                        ZR_COMPILE_SLOT_U16(rightSlot));
-                emit_instruction(cs, opInst);
+                compile_assignment_emit_compound_operation(cs,
+                                                           compoundAssignmentOpcode,
+                                                           appendsToBuilder,
+                                                           resultSlot,
+                                                           leftSlot,
+                                                           rightSlot,
+                                                           node->location);
                 
                 // 赋值
                 TZrInstruction setInst = create_instruction_1(ZR_INSTRUCTION_ENUM(SET_STACK), (TZrUInt16)localVarIndex, (TZrInt32)resultSlot);
@@ -1241,12 +1303,13 @@ static void compile_assignment_expression(SZrCompilerState *cs, SZrAstNode *node
                     }
                     
                     TZrUInt32 resultSlot = allocate_stack_slot(cs);
-                    TZrInstruction opInst = create_instruction_2(
-                            compoundAssignmentOpcode,
-                            ZR_COMPILE_SLOT_U16(resultSlot),
-                            ZR_COMPILE_SLOT_U16(leftSlot),
-                            ZR_COMPILE_SLOT_U16(rightSlot));
-                    emit_instruction(cs, opInst);
+                    compile_assignment_emit_compound_operation(cs,
+                                                               compoundAssignmentOpcode,
+                                                               appendsToBuilder,
+                                                               resultSlot,
+                                                               leftSlot,
+                                                               rightSlot,
+                                                               node->location);
                     
                     // 写入闭包变量
                     if (useUpval) {
@@ -1282,12 +1345,13 @@ static void compile_assignment_expression(SZrCompilerState *cs, SZrAstNode *node
                 emit_instruction(cs, getTableInst);
                 
                 TZrUInt32 resultSlot = allocate_stack_slot(cs);
-                TZrInstruction opInst = create_instruction_2(
-                        compoundAssignmentOpcode,
-                        ZR_COMPILE_SLOT_U16(resultSlot),
-                        ZR_COMPILE_SLOT_U16(leftSlot),
-                        ZR_COMPILE_SLOT_U16(rightSlot));
-                emit_instruction(cs, opInst);
+                compile_assignment_emit_compound_operation(cs,
+                                                           compoundAssignmentOpcode,
+                                                           appendsToBuilder,
+                                                           resultSlot,
+                                                           leftSlot,
+                                                           rightSlot,
+                                                           node->location);
                 
                 TZrInstruction setTableInst = create_instruction_2(ZR_INSTRUCTION_ENUM(SET_MEMBER), (TZrUInt16)resultSlot, (TZrUInt16)globalSlot, (TZrUInt16)memberId);
                 emit_instruction(cs, setTableInst);
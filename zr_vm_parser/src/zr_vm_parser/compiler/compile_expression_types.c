@@ -2205,6 +2205,21 @@ static TZrBool compile_arguments_against_function_resolved_signature(SZrCompiler
     return ZR_TRUE;
 }
 
+static TZrBool member_chain_root_is_string_value(SZrCompilerState *cs, SZrAstNode *propertyNode) {
+    SZrInferredType inferredType;
+    TZrBool isString;
+
+    if (cs == ZR_NULL || propertyNode == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    ZrParser_InferredType_Init(cs->state, &inferredType, ZR_VALUE_TYPE_OBJECT);
+    isString = (TZrBool)(ZrParser_ExpressionType_Infer(cs, propertyNode, &inferredType) &&
+                         inferredType.baseType == ZR_VALUE_TYPE_STRING);
+    ZrParser_InferredType_Free(cs->state, &inferredType);
+    return isString;
+}
+
 void compile_primary_member_chain(SZrCompilerState *cs, SZrAstNode *propertyNode, SZrAstNodeArray *members,
                                          TZrSize memberStartIndex, TZrUInt32 *ioCurrentSlot,
                                          SZrString **ioRootTypeName, TZrBool *ioRootIsTypeReference,
@@ -2379,6 +2394,12 @@ void compile_primary_member_chain(SZrCompilerState *cs, SZrAstNode *propertyNode
                 }
             }
 
+            if (nextIsFunctionCall && !bindReceiverForCall && typeMember == ZR_NULL && i == memberStartIndex &&
+                !rootIsTypeReference && !memberUsesSuperLookup && member_chain_root_is_string_value(cs, propertyNode)) {
+                // string methods live only on the runtime string prototype, so the call still needs its receiver.
+                bindReceiverForCall = ZR_TRUE;
+            }
+
             if (memberExpr->property != ZR_NULL) {
                 if (getterAccessor != ZR_NULL && memberName != ZR_NULL && !memberExpr->computed) {
                     if (memberUsesSuperLookup) {
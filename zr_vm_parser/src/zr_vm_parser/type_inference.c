@@ -2030,6 +2030,61 @@ TZrBool ZrParser_ConditionalType_Infer(SZrCompilerState *cs, SZrAstNode *node, S
     return ZR_TRUE;
 }
 
+// 识别 StringBuilder 变量的自追加赋值
+TZrBool ZrParser_AssignmentExpression_IsStringBuilderSelfAppend(SZrCompilerState *cs,
+                                                               SZrAstNode *node,
+                                                               SZrAstNode **outAppendedValue) {
+    SZrAstNode *left;
+    SZrAstNode *right;
+    SZrAstNode *appendedValue = ZR_NULL;
+    const TZrChar *op;
+    SZrInferredType leftType;
+    TZrBool isBuilder;
+
+    if (outAppendedValue != ZR_NULL) {
+        *outAppendedValue = ZR_NULL;
+    }
+    if (cs == ZR_NULL || node == ZR_NULL || node->type != ZR_AST_ASSIGNMENT_EXPRESSION) {
+        return ZR_FALSE;
+    }
+
+    op = node->data.assignmentExpression.op.op;
+    left = node->data.assignmentExpression.left;
+    right = node->data.assignmentExpression.right;
+    if (op == ZR_NULL || left == ZR_NULL || right == ZR_NULL || left->type != ZR_AST_IDENTIFIER_LITERAL ||
+        left->data.identifier.name == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    // 只有 b += x 与 b = b + x 原地追加；其他 builder + x 仍按普通加法处理
+    if (strcmp(op, "+=") == 0) {
+        appendedValue = right;
+    } else if (strcmp(op, "=") == 0 && right->type == ZR_AST_BINARY_EXPRESSION &&
+               right->data.binaryExpression.op.op != ZR_NULL &&
+               strcmp(right->data.binaryExpression.op.op, "+") == 0 &&
+               right->data.binaryExpression.left != ZR_NULL &&
+               right->data.binaryExpression.left->type == ZR_AST_IDENTIFIER_LITERAL &&
+               right->data.binaryExpression.left->data.identifier.name != ZR_NULL &&
+               ZrCore_String_Equal(right->data.binaryExpression.left->data.identifier.name,
+                                   left->data.identifier.name)) {
+        appendedValue = right->data.binaryExpression.right;
+    }
+    if (appendedValue == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    ZrParser_InferredType_Init(cs->state, &leftType, ZR_VALUE_TYPE_OBJECT);
+    isBuilder = ZrParser_ExpressionType_Infer(cs, left, &leftType) &&
+                inferred_type_implements_protocol_mask(cs,
+                                                       &leftType,
+                                                       ZR_PROTOCOL_BIT(ZR_PROTOCOL_ID_STRING_BUILDER));
+    ZrParser_InferredType_Free(cs->state, &leftType);
+    if (isBuilder && outAppendedValue != ZR_NULL) {
+        *outAppendedValue = appendedValue;
+    }
+    return isBuilder;
+}
+
 // 从赋值表达式推断类型
 TZrBool ZrParser_AssignmentType_Infer(SZrCompilerState *cs, SZrAstNode *node, SZrInferredType *result) {
     TZrBool hasLeftType = ZR_FALSE;
@@ -2040,8 +2095,12 @@ TZrBool ZrParser_AssignmentType_Infer(SZrCompilerState *cs, SZrAstNode *node, SZ
     
     SZrAssignmentExpression *assignExpr = &node->data.assignmentExpression;
     
-    // 推断右值类型
-    if (!ZrParser_ExpressionType_Infer(cs, assignExpr->right, result)) {
+    // 推断右值类型；builder 自追加赋值的结果仍是 builder 本身
+    if (!ZrParser_ExpressionType_Infer(cs,
+                                       ZrParser_AssignmentExpression_IsStringBuilderSelfAppend(cs, node, ZR_NULL)
+                                               ? assignExpr->left
+                                               : assignExpr->right,
+                                       result)) {
         return ZR_FALSE;
     }
     
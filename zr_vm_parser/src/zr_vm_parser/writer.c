@@ -293,6 +293,35 @@ static TZrBool write_io_function_internal(SZrState *state,
                                           const TZrChar *defaultName,
                                           const SZrBinaryWriterOptions *options);
 
+/*
+ * Nested function records are prefixed with their byte length so a loader reading a resident image can skip a body
+ * until the function is first called. Every writer stream is seekable (file, memstream or tmpfile).
+ */
+static TZrBool write_io_function_record(SZrState *state,
+                                        FILE *file,
+                                        SZrFunction *function,
+                                        const SZrBinaryWriterOptions *options) {
+    TZrUInt64 recordLength = 0;
+    long lengthOffset = ftell(file);
+    long recordEnd;
+
+    if (lengthOffset < 0) {
+        return ZR_FALSE;
+    }
+    fwrite(&recordLength, sizeof(TZrUInt64), 1, file);
+    if (!write_io_function_internal(state, file, function, ZR_NULL, options)) {
+        return ZR_FALSE;
+    }
+
+    recordEnd = ftell(file);
+    if (recordEnd < lengthOffset + (long)sizeof(TZrUInt64) || fseek(file, lengthOffset, SEEK_SET) != 0) {
+        return ZR_FALSE;
+    }
+    recordLength = (TZrUInt64)(recordEnd - lengthOffset - (long)sizeof(TZrUInt64));
+    fwrite(&recordLength, sizeof(TZrUInt64), 1, file);
+    return fseek(file, recordEnd, SEEK_SET) == 0 ? ZR_TRUE : ZR_FALSE;
+}
+
 ZR_PARSER_API TZrUInt64 ZrParser_Writer_GetSerializableNativeHelperId(FZrNativeFunction function) {
     if (function == ZR_NULL) {
         return ZR_IO_NATIVE_HELPER_NONE;
@@ -768,7 +797,7 @@ static TZrBool write_value_payload(FILE *file,
             }
             fwrite(&hasFunctionValue, sizeof(TZrBool), 1, file);
             if (hasFunctionValue) {
-                if (!write_io_function_internal(state, file, functionValue, ZR_NULL, ZR_NULL)) {
+                if (!write_io_function_record(state, file, functionValue, ZR_NULL)) {
                     return ZR_FALSE;
                 }
             }
@@ -1604,7 +1633,7 @@ static TZrBool write_io_function_internal(SZrState *state,
         TZrUInt64 closuresLength = function->childFunctionLength;
         fwrite(&closuresLength, sizeof(TZrUInt64), 1, file);
         for (TZrUInt64 i = 0; i < closuresLength; i++) {
-            if (!write_io_function_internal(state, file, &function->childFunctionList[i], ZR_NULL, options)) {
+            if (!write_io_function_record(state, file, &function->childFunctionList[i], options)) {
                 return ZR_FALSE;
             }
         }
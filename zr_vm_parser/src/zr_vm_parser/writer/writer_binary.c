@@ -1,9 +1,15 @@
+#if !defined(ZR_PLATFORM_WIN) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "writer_binary_internal.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "zr_vm_common/zr_io_conf.h"
 #include "zr_vm_common/zr_version_info.h"
+#include "zr_vm_core/stack.h"
 #include "zr_vm_core/string.h"
 
 static void writer_binary_write_native_string_with_length(FILE *file, const TZrChar *text) {
@@ -23,13 +29,12 @@ static void writer_binary_write_native_string_with_length(FILE *file, const TZrC
     }
 }
 
-ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFileWithOptions(SZrState *state,
-                                                                 SZrFunction *function,
-                                                                 const TZrChar *filename,
-                                                                 const SZrBinaryWriterOptions *options) {
+static TZrBool writer_binary_write_stream(SZrState *state,
+                                         FILE *file,
+                                         SZrFunction *function,
+                                         const SZrBinaryWriterOptions *options) {
     const TZrChar *moduleName = "simple";
     const TZrChar *moduleHash = ZR_NULL;
-    FILE *file;
     TZrUInt32 versionMajor = ZR_VM_MAJOR_VERSION;
     TZrUInt32 versionMinor = ZR_VM_MINOR_VERSION;
     TZrUInt32 versionPatch = ZR_IO_SOURCE_PATCH_CURRENT;
@@ -40,11 +45,13 @@ ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFileWithOptions(SZrState *state
     TZrUInt8 endian = ZR_IO_IS_LITTLE_ENDIAN ? ZR_TRUE : ZR_FALSE;
     TZrUInt8 debug;
     TZrUInt8 opt[ZR_IO_SOURCE_HEADER_OPT_BYTES] = {ZR_FALSE, ZR_FALSE, ZR_FALSE};
+    TZrUInt8 valueCellSize = (TZrUInt8)sizeof(SZrTypeValue);
+    TZrUInt8 stackSlotSize = (TZrUInt8)sizeof(SZrTypeValueOnStack);
     TZrUInt64 modulesLength = 1;
     TZrUInt64 importsLength = 0;
     TZrUInt64 declaresLength = 0;
 
-    if (state == ZR_NULL || function == ZR_NULL || filename == ZR_NULL) {
+    if (state == ZR_NULL || file == ZR_NULL || function == ZR_NULL) {
         return ZR_FALSE;
     }
 
@@ -55,11 +62,6 @@ ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFileWithOptions(SZrState *state
         moduleHash = options->moduleHash;
     }
 
-    file = fopen(filename, "wb");
-    if (file == ZR_NULL) {
-        return ZR_FALSE;
-    }
-
     fwrite(ZR_IO_SOURCE_SIGNATURE, sizeof(TZrUInt8), ZR_IO_SOURCE_SIGNATURE_LENGTH, file);
     fwrite(&versionMajor, sizeof(TZrUInt32), 1, file);
     fwrite(&versionMinor, sizeof(TZrUInt32), 1, file);
@@ -73,6 +75,8 @@ ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFileWithOptions(SZrState *state
     debug = ZrParser_Writer_FunctionTreeHasDebugInfo(function) ? ZR_TRUE : ZR_FALSE;
     fwrite(&debug, sizeof(TZrUInt8), 1, file);
     fwrite(opt, sizeof(TZrUInt8), ZR_IO_SOURCE_HEADER_OPT_BYTES, file);
+    fwrite(&valueCellSize, sizeof(TZrUInt8), 1, file);
+    fwrite(&stackSlotSize, sizeof(TZrUInt8), 1, file);
     fwrite(&modulesLength, sizeof(TZrUInt64), 1, file);
 
     writer_binary_write_native_string_with_length(file, moduleName);
@@ -80,14 +84,110 @@ ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFileWithOptions(SZrState *state
     fwrite(&importsLength, sizeof(TZrUInt64), 1, file);
     fwrite(&declaresLength, sizeof(TZrUInt64), 1, file);
 
-    if (!ZrParser_Writer_WriteIoFunction(state, file, function, "__entry", options)) {
-        fclose(file);
+    return ZrParser_Writer_WriteIoFunction(state, file, function, "__entry", options);
+}
+
+ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFileWithOptions(SZrState *state,
+                                                                 SZrFunction *function,
+                                                                 const TZrChar *filename,
+                                                                 const SZrBinaryWriterOptions *options) {
+    FILE *file;
+    TZrBool success;
+
+    if (state == ZR_NULL || function == ZR_NULL || filename == ZR_NULL) {
         return ZR_FALSE;
     }
 
+    file = fopen(filename, "wb");
+    if (file == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    success = writer_binary_write_stream(state, file, function, options);
     fclose(file);
+    return success;
+}
+
+#if defined(ZR_PLATFORM_WIN)
+// the Windows CRT has no open_memstream; an anonymous tmpfile is read back into a heap buffer instead.
+static TZrBool writer_binary_read_back_stream(FILE *file, TZrByte **outBytes, TZrSize *outLength) {
+    long length;
+    TZrByte *bytes;
+
+    if (fflush(file) != 0 || fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) < 0 ||
+        fseek(file, 0, SEEK_SET) != 0) {
+        return ZR_FALSE;
+    }
+
+    bytes = (TZrByte *)malloc(length > 0 ? (size_t)length : 1u);
+    if (bytes == ZR_NULL) {
+        return ZR_FALSE;
+    }
+    if (length > 0 && fread(bytes, 1, (size_t)length, file) != (size_t)length) {
+        free(bytes);
+        return ZR_FALSE;
+    }
+
+    *outBytes = bytes;
+    *outLength = (TZrSize)length;
     return ZR_TRUE;
 }
+#endif
+
+ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryBuffer(SZrState *state,
+                                                        SZrFunction *function,
+                                                        TZrByte **outBytes,
+                                                        TZrSize *outLength) {
+    FILE *file;
+    TZrBool success;
+
+    if (outBytes != ZR_NULL) {
+        *outBytes = ZR_NULL;
+    }
+    if (outLength != ZR_NULL) {
+        *outLength = 0;
+    }
+    if (state == ZR_NULL || function == ZR_NULL || outBytes == ZR_NULL || outLength == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+#if defined(ZR_PLATFORM_WIN)
+    file = tmpfile();
+    if (file == ZR_NULL) {
+        return ZR_FALSE;
+    }
+
+    success = writer_binary_write_stream(state, file, function, ZR_NULL) &&
+              writer_binary_read_back_stream(file, outBytes, outLength);
+    fclose(file);
+    return success;
+#else
+    {
+        char *streamBytes = ZR_NULL;
+        size_t streamLength = 0;
+
+        file = open_memstream(&streamBytes, &streamLength);
+        if (file == ZR_NULL) {
+            return ZR_FALSE;
+        }
+
+        success = writer_binary_write_stream(state, file, function, ZR_NULL);
+        // open_memstream only publishes the final buffer and length once the stream is closed.
+        if (fclose(file) != 0 || !success) {
+            free(streamBytes);
+            return ZR_FALSE;
+        }
+
+        *outBytes = (TZrByte *)streamBytes;
+        *outLength = (TZrSize)streamLength;
+        return ZR_TRUE;
+    }
+#endif
+}
+
+ZR_PARSER_API void ZrParser_Writer_FreeBinaryBuffer(TZrByte *bytes) {
+    free(bytes);
+}
 
 ZR_PARSER_API TZrBool ZrParser_Writer_WriteBinaryFile(SZrState *state, SZrFunction *function, const TZrChar *filename) {
     return ZrParser_Writer_WriteBinaryFileWithOptions(state, function, filename, ZR_NULL);